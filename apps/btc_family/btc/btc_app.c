@@ -81,17 +81,6 @@
  * STATIC FUNCTION PROTOTYPES
  *****************************************************************************/
 
-/**
- * @brief Check if the purpose index is supported by the Bitcoin app.
- *
- * @param purpose_index The purpose index to be checked
- *
- * @return bool Indicates if the provided purpose index is supported
- * @retval true The provided purpose index is supported
- * @retval false The provided purpose index is not supported
- */
-static bool is_purpose_supported(uint32_t purpose_index);
-
 /*****************************************************************************
  * STATIC VARIABLES
  *****************************************************************************/
@@ -115,8 +104,9 @@ const btc_config_t btc_app = {
     // https://github.com/trezor/trezor-firmware/issues/1192
     .max_fee = 2000000,
 
-    // action handlers
-    .is_purpose_supported = is_purpose_supported,
+    // supported purpose indices
+    .supported_purposes = BTC_PURPOSE_FLAG_LEGACY | BTC_PURPOSE_FLAG_SEGWIT |
+                          BTC_PURPOSE_FLAG_NSEGWIT | BTC_PURPOSE_FLAG_TAPROOT,
 };
 
 static const cy_app_desc_t btc_app_desc = {.id = 2,
@@ -137,14 +127,6 @@ static const cy_app_desc_t btc_app_desc = {.id = 2,
  * STATIC FUNCTIONS
  *****************************************************************************/
 
-static bool is_purpose_supported(uint32_t purpose_index) {
-  if (PURPOSE_LEGACY != purpose_index && PURPOSE_SEGWIT != purpose_index &&
-      PURPOSE_NSEGWIT != purpose_index && PURPOSE_TAPROOT != purpose_index) {
-    return false;
-  }
-  return true;
-}
-
 /*****************************************************************************
  * GLOBAL FUNCTIONS
  *****************************************************************************/
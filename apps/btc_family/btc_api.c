@@ -68,6 +68,7 @@
 #include "common_error.h"
 #include "core_api.h"
 #include "events.h"
+#include "session_bench.h"
 
 /*****************************************************************************
  * EXTERN VARIABLES
@@ -84,6 +85,8 @@
 /*****************************************************************************
  * STATIC VARIABLES
  *****************************************************************************/
+/// Location of the prev_txn field of the last decoded query
+static btc_bytes_slice_t prev_txn_slice;
 
 /*****************************************************************************
  * GLOBAL VARIABLES
@@ -92,10 +95,63 @@
 /*****************************************************************************
  * STATIC FUNCTION PROTOTYPES
  *****************************************************************************/
+/**
+ * @brief Records where a bytes field is located in the buffer being decoded
+ * and skips it, instead of copying it into the query
+ * @details Queries are always decoded from memory with pb_istream_from_buffer,
+ * whose stream state is the current read position.
+ */
+static bool decode_bytes_in_place(pb_istream_t *stream,
+                                  const pb_field_t *field,
+                                  void **arg);
+
+/**
+ * @brief Sets the prev_txn callback of the sign txn request about to be
+ * decoded; it lives in a oneof and is cleared when that is selected
+ */
+static bool decode_sign_txn_request_cb(pb_istream_t *stream,
+                                       const pb_field_t *field,
+                                       void **arg);
+
+/**
+ * @brief Sets the callback of the sign txn request about to be decoded
+ */
+static bool decode_query_cb(pb_istream_t *stream,
+                            const pb_field_t *field,
+                            void **arg);
 
 /*****************************************************************************
  * STATIC FUNCTIONS
  *****************************************************************************/
+static bool decode_bytes_in_place(pb_istream_t *stream,
+                                  const pb_field_t *field,
+                                  void **arg) {
+  btc_bytes_slice_t *slice = *arg;
+  slice->bytes = (const uint8_t *)stream->state;
+  slice->size = stream->bytes_left;
+  return pb_read(stream, NULL, stream->bytes_left);
+}
+
+static bool decode_sign_txn_request_cb(pb_istream_t *stream,
+                                       const pb_field_t *field,
+                                       void **arg) {
+  if (BTC_SIGN_TXN_REQUEST_INPUT_TAG == field->tag) {
+    btc_sign_txn_input_t *input = field->pData;
+    input->prev_txn.funcs.decode = decode_bytes_in_place;
+    input->prev_txn.arg = &prev_txn_slice;
+  }
+  return true;
+}
+
+static bool decode_query_cb(pb_istream_t *stream,
+                            const pb_field_t *field,
+                            void **arg) {
+  if (BTC_QUERY_SIGN_TXN_TAG == field->tag) {
+    btc_sign_txn_request_t *request = field->pData;
+    request->cb_request.funcs.decode = decode_sign_txn_request_cb;
+  }
+  return true;
+}
 
 /*****************************************************************************
  * GLOBAL FUNCTIONS
@@ -111,6 +167,8 @@ bool decode_btc_query(const uint8_t *data,
 
   // zeroise for safety from garbage in the query reference
   memzero(query_out, sizeof(btc_query_t));
+  memzero(&prev_txn_slice, sizeof(prev_txn_slice));
+  query_out->cb_request.funcs.decode = decode_query_cb;
 
   /* Create a stream that reads from the buffer. */
   pb_istream_t stream = pb_istream_from_buffer(data, data_size);
@@ -127,6 +185,14 @@ bool decode_btc_query(const uint8_t *data,
   return status;
 }
 
+btc_bytes_slice_t btc_query_get_bytes(const pb_callback_t *field) {
+  btc_bytes_slice_t slice = {.bytes = NULL, .size = 0};
+  if (NULL != field && NULL != field->arg) {
+    slice = *(const btc_bytes_slice_t *)field->arg;
+  }
+  return slice;
+}
+
 bool encode_btc_result(const btc_result_t *result,
                        uint8_t *buffer,
                        uint16_t max_buffer_len,
@@ -169,12 +235,10 @@ void btc_send_error(pb_size_t which_error, uint32_t error_code) {
 }
 
 void btc_send_result(const btc_result_t *result) {
-  // TODO: Eventually 1700 will be replaced by BTC_RESULT_SIZE when all
-  // option files for bitcoin app are complete
-  uint8_t buffer[1700] = {0};
-  size_t bytes_encoded = 0;
-  ASSERT(encode_btc_result(result, buffer, sizeof(buffer), &bytes_encoded));
-  send_response_to_host(&buffer[0], bytes_encoded);
+  // Encoded straight into the usb buffer, after the core message
+  pb_ostream_t stream = begin_response_to_host();
+  ASSERT(pb_encode(&stream, BTC_RESULT_FIELDS, result));
+  end_response_to_host(&stream);
 }
 
 bool btc_get_query(btc_query_t *query, pb_size_t exp_query_tag) {
@@ -184,6 +248,7 @@ bool btc_get_query(btc_query_t *query, pb_size_t exp_query_tag) {
     return false;
   }
 
+  SESSION_BENCH_ENTER(SESSION_PHASE_PARSING);
   if (!decode_btc_query(
           event.usb_event.p_msg, event.usb_event.msg_size, query)) {
     return false;
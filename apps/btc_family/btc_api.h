@@ -22,6 +22,14 @@
 /*****************************************************************************
  * TYPEDEFS
  *****************************************************************************/
+/**
+ * @brief Bytes of a query field left in place in the buffer the query was
+ * decoded from
+ */
+typedef struct {
+  const uint8_t *bytes;
+  size_t size;
+} btc_bytes_slice_t;
 
 /*****************************************************************************
  * EXPORTED VARIABLES
@@ -43,6 +51,18 @@ bool decode_btc_query(const uint8_t *data,
                       uint16_t data_size,
                       btc_query_t *query_out);
 
+/**
+ * @brief Returns the bytes of a callback field decoded by decode_btc_query(),
+ * i.e. the prev_txn of the inputs.
+ * @details The bytes are not copied into the query and stay in the usb buffer
+ * the query was decoded from. They are only valid until a response is sent or
+ * the next query is decoded.
+ *
+ * @param field The callback field in the decoded query
+ * @return btc_bytes_slice_t Bytes of the field, empty if it was not present
+ */
+btc_bytes_slice_t btc_query_get_bytes(const pb_callback_t *field);
+
 /**
  * @brief Encodes the bitcoin result with `BTC_RESULT_FIELDS` to byte-stream
  *
@@ -91,7 +111,8 @@ void btc_send_error(pb_size_t which_error, uint32_t error_code);
  * @details If the encoding is successful, then it sends the corresponding
  * result to the host.
  *
- * The function ASSERTs the result of encode_btc_result internally.
+ * The result is encoded in place in the usb buffer; the function ASSERTs the
+ * encoding internally.
  *
  * @param result The result which needs to be sent to the host.
  */
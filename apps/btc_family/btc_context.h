@@ -27,6 +27,12 @@
 #define BTC_LONG_NAME_MAX_SIZE 16
 #define BECH32_HRP_SIZE 4
 
+/// Purpose indices a fork supports, combined in btc_config_t
+#define BTC_PURPOSE_FLAG_LEGACY (1 << 0)
+#define BTC_PURPOSE_FLAG_SEGWIT (1 << 1)
+#define BTC_PURPOSE_FLAG_NSEGWIT (1 << 2)
+#define BTC_PURPOSE_FLAG_TAPROOT (1 << 3)
+
 /*****************************************************************************
  * TYPEDEFS
  *****************************************************************************/
@@ -82,11 +88,12 @@ typedef struct {
    */
   uint64_t max_fee;
 
-  /** Validates if the provided purpose_index is supported by the Bitcoin fork.
-   * The validation acts as safety check for receive address, account addition
-   * and transaction type for the specific fork of Bitcoin.
+  /** BTC_PURPOSE_FLAG_* of the purpose indices supported by the Bitcoin
+   * fork. The validation acts as safety check for receive address, account
+   * addition and transaction type for the specific fork of Bitcoin. Kept as
+   * data so that the check is a mask rather than a call through the config.
    */
-  bool (*is_purpose_supported)(uint32_t purpose_index);
+  uint8_t supported_purposes;
 } btc_config_t;
 
 /*****************************************************************************
@@ -130,18 +130,27 @@ bool btc_generate_xpub(const uint32_t *path,
                        const uint8_t *seed,
                        const uint32_t version,
                        char *str) {
+  hd_path_cache_t cache = {0};
+  hd_path_cache_init(&cache, curve, seed);
+  bool status =
+      btc_generate_xpub_cached(&cache, path, path_length, version, str);
+  hd_path_cache_clear(&cache);
+  return status;
+}
+
+bool btc_generate_xpub_cached(hd_path_cache_t *cache,
+                              const uint32_t *path,
+                              const size_t path_length,
+                              const uint32_t version,
+                              char *str) {
   uint32_t fingerprint = 0x0;
   HDNode t_node = {0};
   bool status = true;
 
-  status &=
-      derive_hdnode_from_path(path, path_length - 1, curve, seed, &t_node);
+  // the parent stays cached; deriving the account node reuses it
+  status &= hd_path_cache_derive(cache, path, path_length - 1, &t_node);
   fingerprint = hdnode_fingerprint(&t_node);
-  if (0 == hdnode_private_ckd(&t_node, path[path_length - 1])) {
-    // hdnode_private_ckd returns 1 when the derivation succeeds
-    status &= false;
-  }
-  hdnode_fill_public_key(&t_node);
+  status &= hd_path_cache_derive(cache, path, path_length, &t_node);
   if (0 ==
       hdnode_serialize_public(&t_node, fingerprint, version, str, XPUB_SIZE)) {
     status &= false;
@@ -176,8 +185,7 @@ bool btc_derivation_path_guard(const uint32_t *path, uint32_t depth) {
   status = true;
 
   // common checks for xpub/account and address nodes
-  if (NULL == g_btc_app->is_purpose_supported ||
-      !g_btc_app->is_purpose_supported(path[0])) {
+  if (!btc_is_purpose_supported(path[0])) {
     // unsupported purpose index
     status = false;
   }
@@ -203,8 +211,17 @@ bool btc_derivation_path_guard(const uint32_t *path, uint32_t depth) {
 void format_value(const uint64_t value_in_sat,
                   char *msg,
                   const size_t msg_len) {
-  uint8_t precision = get_floating_precision(value_in_sat, SATOSHI_PER_BTC);
-  double fee_in_btc = 1.0 * value_in_sat / (SATOSHI_PER_BTC);
-  snprintf(
-      msg, msg_len, "%0.*f %s", precision, fee_in_btc, g_btc_app->lunit_name);
+  uint8_t value_be[sizeof(value_in_sat)] = {0};
+  char value_string[24] = "";
+
+  for (uint8_t byte = 0; byte < sizeof(value_be); byte++) {
+    value_be[sizeof(value_be) - 1 - byte] =
+        (uint8_t)(value_in_sat >> (8 * byte));
+  }
+  byte_array_to_decimal_string(value_be,
+                               sizeof(value_be),
+                               BTC_DECIMAL,
+                               value_string,
+                               sizeof(value_string));
+  snprintf(msg, msg_len, "%s %s", value_string, g_btc_app->lunit_name);
 }
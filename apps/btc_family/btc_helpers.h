@@ -17,6 +17,8 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include "coin_utils.h"
+
 /*****************************************************************************
  * MACROS AND DEFINES
  *****************************************************************************/
@@ -30,6 +32,8 @@
 #define BTC_ACC_ADDR_DEPTH 5
 
 #define SATOSHI_PER_BTC 100000000
+/// Decimal places of a BTC amount, SATOSHI_PER_BTC = 10^BTC_DECIMAL
+#define BTC_DECIMAL 8
 
 /*****************************************************************************
  * TYPEDEFS
@@ -84,6 +88,28 @@ bool btc_generate_xpub(const uint32_t *path,
                        uint32_t version,
                        char *str);
 
+/**
+ * @brief Same as @ref btc_generate_xpub but derives the nodes through the
+ * provided derivation cache
+ * @details Generating xpubs of sorted paths through the same cache derives
+ * the shared purpose & coin levels only once.
+ *
+ * @param cache                 Derivation cache initialized with seed & curve
+ * @param [in] path             Path of the node to derive xpub
+ * @param [in] path_length      Length of the given path.
+ * @param [in] version          HD version for xpub encoding
+ * @param [out] str             String to store the xpub of XPUB_SIZE
+ *
+ * @return bool Indicating if the derivation was successful
+ * @retval true If the node derivation succeeded.
+ * @retval false If the node derivation failed.
+ */
+bool btc_generate_xpub_cached(hd_path_cache_t *cache,
+                              const uint32_t *path,
+                              size_t path_length,
+                              uint32_t version,
+                              char *str);
+
 /**
  * @brief Returns the HD version for xpub encoding for the specified purpose
  * index.
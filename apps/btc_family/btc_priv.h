@@ -17,12 +17,23 @@
 
 #include <btc/core.pb.h>
 
+#include "bip32.h"
 #include "btc_context.h"
+#include "btc_helpers.h"
+#include "btc_script.h"
+#include "sha2.h"
 
 /*****************************************************************************
  * MACROS AND DEFINES
  *****************************************************************************/
 
+// number of (change, address) keys cached while signing a transaction
+#define BTC_KEY_CACHE_SIZE 4
+// number of verified previous transactions cached while signing a transaction
+#define BTC_PREV_TXN_CACHE_SIZE 4
+// most outputs of a previous transaction kept by its cache entry
+#define BTC_PREV_TXN_CACHE_MAX_OUTPUTS 32
+
 /*****************************************************************************
  * TYPEDEFS
  *****************************************************************************/
@@ -34,16 +45,90 @@ typedef struct {
   uint8_t hash_outputs[32];
 } btc_segwit_cache_t;
 
+/**
+ * Midstate cache for legacy (P2PKH) sighash. The serialization preceding the
+ * input being signed is the same for every input except for the inputs whose
+ * scriptSig is blanked, hence the prefix is extended in place as the inputs are
+ * signed in order.
+ */
+typedef struct {
+  bool filled;
+  // index of the first input not yet digested into prefix
+  uint32_t next_index;
+  // version, input count and blanked inputs [0, next_index)
+  SHA256_CTX prefix;
+} btc_legacy_cache_t;
+
+/**
+ * Keys derived for signing the inputs. Inputs of a transaction commonly share
+ * the change & address index (e.g. consolidation of UTXOs of an address); the
+ * cache avoids repeated child key derivations for them.
+ */
+typedef struct {
+  bool filled;
+  uint32_t change_index;
+  uint32_t address_index;
+  uint8_t private_key[32];
+  uint8_t public_key[33];
+} btc_key_cache_entry_t;
+
+typedef struct {
+  // node at m/purpose'/coin'/account'/change
+  bool change_node_filled;
+  uint32_t change_index;
+  HDNode change_node;
+  btc_key_cache_entry_t entries[BTC_KEY_CACHE_SIZE];
+  // entry to be replaced next when the cache is full
+  uint8_t next_entry;
+} btc_key_cache_t;
+
+/**
+ * Output values of the previous transactions verified while signing. Inputs of
+ * a transaction commonly spend several outputs of one previous transaction
+ * (e.g. a change chain or an exchange withdrawal); their values are checked
+ * against the cache, skipping the parsing & hashing of the same raw
+ * transaction.
+ */
+typedef struct {
+  bool filled;
+  uint8_t txn_hash[32];
+  uint32_t output_count;
+  uint64_t values[BTC_PREV_TXN_CACHE_MAX_OUTPUTS];
+} btc_prev_txn_cache_entry_t;
+
+typedef struct {
+  btc_prev_txn_cache_entry_t entries[BTC_PREV_TXN_CACHE_SIZE];
+  // entry to be replaced next when the cache is full
+  uint8_t next_entry;
+} btc_prev_txn_cache_t;
+
 typedef struct {
   pb_byte_t prev_txn_hash[32];
   uint32_t prev_output_index;
   uint64_t value;
   btc_sign_txn_input_script_pub_key_t script_pub_key;
+  // classification of script_pub_key, evaluated once when the input is fetched
+  btc_script_type_e script_type;
   uint32_t sequence;
   uint32_t change_index;
   uint32_t address_index;
 } btc_txn_input_t;
 
+/**
+ * Totals of the transaction, accumulated as each input and output is accepted
+ * so that the weight and the fee are known once the last output is.
+ */
+typedef struct {
+  // serialized size of the accepted inputs and outputs, without witnesses
+  uint32_t base_size;
+  // accepted inputs spending a segwit output, each adding a witness
+  uint32_t segwit_count;
+  uint64_t input_value;
+  uint64_t output_value;
+  // set if either sum of values wraps; such a transaction is rejected
+  bool overflow;
+} btc_txn_totals_t;
+
 /**
  * @brief Struct to store details of Unsigned Transaction.
  * @details The structure sufficiently describes the transaction to be signed.
@@ -69,6 +154,13 @@ typedef struct {
   btc_sign_txn_metadata_t metadata;
   // Populated for segwit transactions
   btc_segwit_cache_t segwit_cache;
+  // Populated lazily while signing legacy inputs
+  btc_legacy_cache_t legacy_cache;
+  // Populated while signing inputs; holds private keys, clear after use
+  btc_key_cache_t key_cache;
+  // Populated while fetching inputs; NULL for a single input or if the
+  // transaction pool is full
+  btc_prev_txn_cache_t *prev_txn_cache;
 
   /**
    * The structure holds the outputs (TxOut) of the transaction. Refer
@@ -80,6 +172,8 @@ typedef struct {
    * @note Populated by fetch_valid_output()
    */
   btc_sign_txn_output_t *outputs;
+  // classification of each output's script_pub_key, populated alongside outputs
+  btc_script_type_e *output_script_types;
   /**
    * The structure holds the inputs (TxIn) of the transaction. Refer
    * description of `TxIn` at
@@ -90,6 +184,8 @@ typedef struct {
   btc_txn_input_t *inputs;
   // track change output in the list of outputs for quick access
   int change_output_idx;
+  // Populated by fetch_valid_input() and fetch_valid_output()
+  btc_txn_totals_t totals;
 } btc_txn_context_t;
 
 /*****************************************************************************
@@ -102,6 +198,41 @@ extern const btc_config_t *g_btc_app;
  * GLOBAL FUNCTION PROTOTYPES
  *****************************************************************************/
 
+/**
+ * @brief Checks if the purpose index is supported by the current fork
+ *
+ * @param purpose_index Purpose index (hardened) of a derivation path
+ *
+ * @return bool Indicating if the purpose is one of supported_purposes
+ */
+static inline bool btc_is_purpose_supported(uint32_t purpose_index) {
+  uint8_t flag = 0;
+  switch (purpose_index) {
+    case PURPOSE_LEGACY:
+      flag = BTC_PURPOSE_FLAG_LEGACY;
+      break;
+    case PURPOSE_SEGWIT:
+      flag = BTC_PURPOSE_FLAG_SEGWIT;
+      break;
+    case PURPOSE_NSEGWIT:
+      flag = BTC_PURPOSE_FLAG_NSEGWIT;
+      break;
+    case PURPOSE_TAPROOT:
+      flag = BTC_PURPOSE_FLAG_TAPROOT;
+      break;
+    default:
+      return false;
+  }
+  return 0 != (g_btc_app->supported_purposes & flag);
+}
+
+/**
+ * @brief Checks if the current fork has segwit addresses, ie. a bech32 HRP
+ */
+static inline bool btc_has_segwit(void) {
+  return '\0' != g_btc_app->bech32_hrp[0];
+}
+
 /**
  *
  * @param query Reference to the decoded query struct from the host app
@@ -0,0 +1,742 @@
+/**
+ * @file    btc_psbt.c
+ * @author  Cypherock X1 Team
+ * @brief   Streaming reader of Partially Signed Bitcoin Transactions (BIP-174)
+ * @copyright Copyright (c) 2023 HODL TECH PTE LTD
+ * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
+ *target=_blank>https://mitcc.org/</a>
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * (c) Copyright 2023 by HODL TECH PTE LTD
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * "Commons Clause" License Condition v1.0
+ *
+ * The Software is provided to you by the Licensor under the License,
+ * as defined below, subject to the following condition.
+ *
+ * Without limiting other conditions in the License, the grant of
+ * rights under the License will not include, and the License does not
+ * grant to you, the right to Sell the Software.
+ *
+ * For purposes of the foregoing, "Sell" means practicing any or all
+ * of the rights granted to you under the License to provide to third
+ * parties, for a fee or other consideration (including without
+ * limitation fees for hosting or consulting/ support services related
+ * to the Software), a product or service whose value derives, entirely
+ * or substantially, from the functionality of the Software. Any license
+ * notice or attribution required by the License must also include
+ * this Commons Clause License Condition notice.
+ *
+ * Software: All X1Wallet associated files.
+ * License: MIT
+ * Licensor: HODL TECH PTE LTD
+ *
+ ******************************************************************************
+ */
+
+
+/*****************************************************************************
+ * INCLUDES
+ *****************************************************************************/
+
+#include "btc_psbt.h"
+
+#include <string.h>
+
+#include "memzero.h"
+#include "utils.h"
+
+/*****************************************************************************
+ * EXTERN VARIABLES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * PRIVATE MACROS AND DEFINES
+ *****************************************************************************/
+
+#define PSBT_MAGIC_SIZE 5
+
+#define PSBT_GLOBAL_UNSIGNED_TX 0x00
+#define PSBT_GLOBAL_VERSION 0xfb
+#define PSBT_IN_NON_WITNESS_UTXO 0x00
+#define PSBT_IN_WITNESS_UTXO 0x01
+#define PSBT_IN_PARTIAL_SIG 0x02
+#define PSBT_IN_SIGHASH_TYPE 0x03
+#define PSBT_IN_BIP32_DERIVATION 0x06
+#define PSBT_OUT_BIP32_DERIVATION 0x02
+
+/// Counts above this are not a transaction the device can sign
+#define PSBT_MAX_TX_ITEMS 0xffff
+
+/// Invokes the optional callback of the handler; a NULL callback accepts
+#define PSBT_CALLBACK(psbt, callback, ...)                                     \
+  (NULL == (psbt)->handler->callback ||                                        \
+   (psbt)->handler->callback((psbt)->user, __VA_ARGS__))
+
+/*****************************************************************************
+ * PRIVATE TYPEDEFS
+ *****************************************************************************/
+
+/**
+ * Fields of a PSBT in the order of serialization
+ */
+typedef enum {
+  PSBT_STATE_MAGIC = 0,
+  PSBT_STATE_KEY_LEN,    // CompactSize; 0 is the separator ending a map
+  PSBT_STATE_KEY,
+  PSBT_STATE_VALUE_LEN,  // CompactSize
+  PSBT_STATE_VALUE,      // handed over to the sink of the record
+  PSBT_STATE_DONE,
+  PSBT_STATE_ERROR,
+} btc_psbt_state_e;
+
+/**
+ * Destination of the value of the current record
+ */
+typedef enum {
+  PSBT_SINK_SKIP = 0,  // unknown record, dropped as it is read
+  PSBT_SINK_BUFFER,    // small record, kept in the field and parsed at its end
+  PSBT_SINK_TX,        // unsigned transaction, see psbt_tx_update()
+  PSBT_SINK_UTXO,      // non-witness UTXO, streamed to the input verifier
+} btc_psbt_sink_e;
+
+/**
+ * Fields of the unsigned transaction in the order of serialization. It has
+ * empty scriptSigs and no witnesses.
+ */
+typedef enum {
+  PSBT_TX_VERSION = 0,
+  PSBT_TX_IN_COUNT,
+  PSBT_TX_IN_OUTPOINT,
+  PSBT_TX_IN_SCRIPT_LEN,
+  PSBT_TX_IN_SEQUENCE,
+  PSBT_TX_OUT_COUNT,
+  PSBT_TX_OUT_VALUE,
+  PSBT_TX_OUT_SCRIPT_LEN,
+  PSBT_TX_OUT_SCRIPT,
+  PSBT_TX_LOCKTIME,
+  PSBT_TX_DONE,
+  PSBT_TX_ERROR,
+} btc_psbt_tx_state_e;
+
+/*****************************************************************************
+ * STATIC FUNCTION PROTOTYPES
+ *****************************************************************************/
+
+/**
+ * @brief Decodes the CompactSize held in the field
+ * @details A field of a single byte is extended to the size given by its
+ * prefix, in which case the remaining bytes must be read first.
+ *
+ * @param field The bytes read so far
+ * @param field_len Length of the field, updated if extended
+ * @param value Storage for the decoded value
+ *
+ * @return bool Whether the value is decoded
+ */
+static bool psbt_compact_size(const uint8_t *field,
+                              uint32_t *field_len,
+                              uint64_t *value);
+
+/**
+ * @brief Parses the next bytes of the unsigned transaction
+ *
+ * @return bool Whether the bytes are well-formed and accepted by the handler
+ */
+static bool psbt_tx_update(btc_psbt_t *psbt,
+                           const uint8_t *data,
+                           uint32_t size);
+
+/**
+ * @brief Moves the reader to the field of the given state and length
+ * @details A field of zero length is complete right away.
+ */
+static void psbt_set_state(btc_psbt_t *psbt,
+                           btc_psbt_state_e state,
+                           uint64_t field_len);
+
+/**
+ * @brief Handles the end of the current map
+ */
+static void psbt_map_end(btc_psbt_t *psbt);
+
+/**
+ * @brief Picks the sink of the current record from its map and key
+ *
+ * @return bool Whether the record is valid at this position of the PSBT
+ */
+static bool psbt_record_start(btc_psbt_t *psbt);
+
+/**
+ * @brief Checks a UTXO record of the current input against the other one
+ * @details The first UTXO record of the input is kept; the second must spend
+ * the same value with the same script, so that a witness UTXO cannot declare
+ * a value other than the verified non-witness UTXO.
+ *
+ * @return bool Whether the UTXO is the first one or matches the kept one
+ */
+static bool psbt_utxo_match(btc_psbt_t *psbt,
+                            uint64_t value,
+                            const uint8_t *script,
+                            uint16_t script_len);
+
+/**
+ * @brief Hands the value of the current record over to the handler
+ *
+ * @return bool Whether the value is valid and accepted by the handler
+ */
+static bool psbt_record_end(btc_psbt_t *psbt);
+
+/**
+ * @brief Advances the reader past the field which has just been read
+ */
+static void psbt_field_complete(btc_psbt_t *psbt);
+
+/*****************************************************************************
+ * STATIC VARIABLES
+ *****************************************************************************/
+
+static const uint8_t psbt_magic[PSBT_MAGIC_SIZE] = {'p', 's', 'b', 't', 0xff};
+
+/*****************************************************************************
+ * GLOBAL VARIABLES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * STATIC FUNCTIONS
+ *****************************************************************************/
+
+static bool psbt_compact_size(const uint8_t *field,
+                              uint32_t *field_len,
+                              uint64_t *value) {
+  const uint8_t prefix = field[0];
+  if (1 == *field_len && 0xfd <= prefix) {
+    *field_len += (0xfd == prefix ? 2 : (0xfe == prefix ? 4 : 8));
+    return false;
+  }
+
+  *value = 0;
+  if (0xfd > prefix) {
+    *value = prefix;
+  } else {
+    for (uint8_t i = *field_len - 1; i > 0; i--) {
+      *value = (*value << 8) | field[i];
+    }
+  }
+  return true;
+}
+
+static void psbt_tx_set_state(btc_psbt_t *psbt,
+                              btc_psbt_tx_state_e state,
+                              uint32_t field_len) {
+  psbt->tx_state = state;
+  psbt->tx_field_pos = 0;
+  psbt->tx_field_len = field_len;
+}
+
+static void psbt_tx_output_end(btc_psbt_t *psbt, uint16_t script_len) {
+  if (!PSBT_CALLBACK(psbt,
+                     tx_output,
+                     psbt->tx_index,
+                     psbt->tx_value,
+                     psbt->tx_script,
+                     script_len)) {
+    psbt->tx_state = PSBT_TX_ERROR;
+  } else if (++psbt->tx_index < psbt->output_count) {
+    psbt_tx_set_state(psbt, PSBT_TX_OUT_VALUE, 8);
+  } else {
+    psbt_tx_set_state(psbt, PSBT_TX_LOCKTIME, 4);
+  }
+}
+
+static void psbt_tx_field_complete(btc_psbt_t *psbt) {
+  const uint8_t *field = psbt->tx_field;
+  uint64_t value = 0;
+
+  switch (psbt->tx_state) {
+    case PSBT_TX_IN_COUNT:
+    case PSBT_TX_IN_SCRIPT_LEN:
+    case PSBT_TX_OUT_COUNT:
+    case PSBT_TX_OUT_SCRIPT_LEN:
+      if (!psbt_compact_size(field, &psbt->tx_field_len, &value)) {
+        return;
+      }
+      break;
+
+    default:
+      break;
+  }
+
+  switch (psbt->tx_state) {
+    case PSBT_TX_VERSION:
+      psbt->tx_version = U32_READ_LE_ARRAY(field);
+      psbt_tx_set_state(psbt, PSBT_TX_IN_COUNT, 1);
+      break;
+
+    case PSBT_TX_IN_COUNT:
+    case PSBT_TX_OUT_COUNT:
+      // no inputs is also how a segwit marker reads; either is invalid here
+      if (0 == value || PSBT_MAX_TX_ITEMS < value) {
+        psbt->tx_state = PSBT_TX_ERROR;
+      } else if (PSBT_TX_IN_COUNT == psbt->tx_state) {
+        psbt->input_count = value;
+        psbt->tx_index = 0;
+        psbt_tx_set_state(psbt, PSBT_TX_IN_OUTPOINT, 36);
+      } else {
+        psbt->output_count = value;
+        psbt->tx_index = 0;
+        psbt_tx_set_state(psbt, PSBT_TX_OUT_VALUE, 8);
+      }
+      break;
+
+    case PSBT_TX_IN_OUTPOINT:
+      // the field is reused by the next fields; keep the outpoint aside
+      memcpy(psbt->tx_script, field, 36);
+      psbt_tx_set_state(psbt, PSBT_TX_IN_SCRIPT_LEN, 1);
+      break;
+
+    case PSBT_TX_IN_SCRIPT_LEN:
+      // scriptSigs of the unsigned transaction must be empty
+      if (0 != value) {
+        psbt->tx_state = PSBT_TX_ERROR;
+      } else {
+        psbt_tx_set_state(psbt, PSBT_TX_IN_SEQUENCE, 4);
+      }
+      break;
+
+    case PSBT_TX_IN_SEQUENCE:
+      if (!PSBT_CALLBACK(psbt,
+                         tx_input,
+                         psbt->tx_index,
+                         psbt->tx_script,
+                         U32_READ_LE_ARRAY(psbt->tx_script + 32),
+                         U32_READ_LE_ARRAY(field))) {
+        psbt->tx_state = PSBT_TX_ERROR;
+      } else if (++psbt->tx_index < psbt->input_count) {
+        psbt_tx_set_state(psbt, PSBT_TX_IN_OUTPOINT, 36);
+      } else {
+        psbt_tx_set_state(psbt, PSBT_TX_OUT_COUNT, 1);
+      }
+      break;
+
+    case PSBT_TX_OUT_VALUE:
+      psbt->tx_value = U64_READ_LE_ARRAY(field);
+      psbt_tx_set_state(psbt, PSBT_TX_OUT_SCRIPT_LEN, 1);
+      break;
+
+    case PSBT_TX_OUT_SCRIPT_LEN:
+      if (BTC_PSBT_MAX_SCRIPT_SIZE < value) {
+        psbt->tx_state = PSBT_TX_ERROR;
+      } else if (0 == value) {
+        psbt_tx_output_end(psbt, 0);
+      } else {
+        psbt_tx_set_state(psbt, PSBT_TX_OUT_SCRIPT, value);
+      }
+      break;
+
+    case PSBT_TX_OUT_SCRIPT:
+      psbt_tx_output_end(psbt, psbt->tx_field_len);
+      break;
+
+    case PSBT_TX_LOCKTIME:
+      if (!PSBT_CALLBACK(psbt,
+                         tx_meta,
+                         psbt->tx_version,
+                         psbt->input_count,
+                         psbt->output_count,
+                         U32_READ_LE_ARRAY(field))) {
+        psbt->tx_state = PSBT_TX_ERROR;
+      } else {
+        psbt->tx_state = PSBT_TX_DONE;
+      }
+      break;
+
+    default:
+      psbt->tx_state = PSBT_TX_ERROR;
+      break;
+  }
+}
+
+static bool psbt_tx_update(btc_psbt_t *psbt,
+                           const uint8_t *data,
+                           uint32_t size) {
+  while (0 < size && PSBT_TX_DONE > psbt->tx_state) {
+    uint32_t length = psbt->tx_field_len - psbt->tx_field_pos;
+    if (length > size) {
+      length = size;
+    }
+
+    if (PSBT_TX_OUT_SCRIPT == psbt->tx_state) {
+      memcpy(psbt->tx_script + psbt->tx_field_pos, data, length);
+    } else {
+      memcpy(psbt->tx_field + psbt->tx_field_pos, data, length);
+    }
+
+    psbt->tx_field_pos += length;
+    data += length;
+    size -= length;
+    if (psbt->tx_field_pos == psbt->tx_field_len) {
+      psbt_tx_field_complete(psbt);
+    }
+  }
+
+  // the value of the record must end with the locktime
+  return (0 == size && PSBT_TX_ERROR != psbt->tx_state);
+}
+
+static void psbt_set_state(btc_psbt_t *psbt,
+                           btc_psbt_state_e state,
+                           uint64_t field_len) {
+  psbt->state = state;
+  psbt->field_pos = 0;
+  psbt->field_len = field_len;
+  if (UINT32_MAX < field_len) {
+    // not possible in a PSBT the device can sign
+    psbt->state = PSBT_STATE_ERROR;
+  } else if (0 == field_len) {
+    psbt_field_complete(psbt);
+  }
+}
+
+static void psbt_map_end(btc_psbt_t *psbt) {
+  switch (psbt->map) {
+    case BTC_PSBT_MAP_GLOBAL:
+      if (!psbt->tx_found) {
+        psbt->state = PSBT_STATE_ERROR;
+        return;
+      }
+      psbt->map = BTC_PSBT_MAP_INPUT;
+      psbt->index = 0;
+      break;
+
+    case BTC_PSBT_MAP_INPUT:
+      if (!psbt->utxo_found) {
+        // only a non-witness UTXO is verified against the outpoint; the value
+        // declared by a witness UTXO alone could misreport the fee
+        psbt->state = PSBT_STATE_ERROR;
+        return;
+      }
+      psbt->utxo_found = false;
+      psbt->witness_utxo_found = false;
+      if (++psbt->index == psbt->input_count) {
+        psbt->map = BTC_PSBT_MAP_OUTPUT;
+        psbt->index = 0;
+      }
+      break;
+
+    case BTC_PSBT_MAP_OUTPUT:
+    default:
+      if (++psbt->index == psbt->output_count) {
+        psbt->state = PSBT_STATE_DONE;
+        return;
+      }
+      break;
+  }
+  psbt_set_state(psbt, PSBT_STATE_KEY_LEN, 1);
+}
+
+static bool psbt_record_start(btc_psbt_t *psbt) {
+  const uint8_t type = psbt->key[0];
+  const bool bare = (1 == psbt->key_len);
+  const bool with_public_key = (BTC_PSBT_MAX_KEY_SIZE == psbt->key_len);
+  uint8_t prev_txn_hash[32] = {0};
+  uint32_t prev_output_index = 0;
+
+  // records without a known key type are never kept
+  psbt->sink = PSBT_SINK_SKIP;
+  switch (psbt->map) {
+    case BTC_PSBT_MAP_GLOBAL:
+      if (bare && PSBT_GLOBAL_UNSIGNED_TX == type) {
+        if (psbt->tx_found) {
+          return false;
+        }
+        psbt->sink = PSBT_SINK_TX;
+        psbt_tx_set_state(psbt, PSBT_TX_VERSION, 4);
+      } else if (bare && PSBT_GLOBAL_VERSION == type) {
+        psbt->sink = PSBT_SINK_BUFFER;
+      }
+      break;
+
+    case BTC_PSBT_MAP_INPUT:
+      if (bare && PSBT_IN_NON_WITNESS_UTXO == type) {
+        if (NULL == psbt->handler->get_outpoint ||
+            !psbt->handler->get_outpoint(
+                psbt->user, psbt->index, prev_txn_hash, &prev_output_index)) {
+          return false;
+        }
+        // the amount is not known yet; it is read from the UTXO itself
+        btc_verify_input_init(
+            &psbt->verify, prev_txn_hash, prev_output_index, 0);
+        psbt->sink = PSBT_SINK_UTXO;
+      } else if (bare && (PSBT_IN_WITNESS_UTXO == type ||
+                          PSBT_IN_SIGHASH_TYPE == type)) {
+        psbt->sink = PSBT_SINK_BUFFER;
+      } else if (with_public_key && PSBT_IN_BIP32_DERIVATION == type) {
+        psbt->sink = PSBT_SINK_BUFFER;
+      }
+      break;
+
+    case BTC_PSBT_MAP_OUTPUT:
+    default:
+      if (with_public_key && PSBT_OUT_BIP32_DERIVATION == type) {
+        psbt->sink = PSBT_SINK_BUFFER;
+      }
+      break;
+  }
+  return true;
+}
+
+static bool psbt_utxo_match(btc_psbt_t *psbt,
+                            const uint64_t value,
+                            const uint8_t *script,
+                            const uint16_t script_len) {
+  if (!psbt->utxo_found && !psbt->witness_utxo_found) {
+    psbt->utxo_value = value;
+    psbt->utxo_script_len = script_len;
+    memcpy(psbt->utxo_script, script, script_len);
+    return true;
+  }
+  return value == psbt->utxo_value && script_len == psbt->utxo_script_len &&
+         0 == memcmp(script, psbt->utxo_script, script_len);
+}
+
+static bool psbt_bip32_derivation(btc_psbt_t *psbt) {
+  uint32_t path[BTC_PSBT_MAX_DEPTH] = {0};
+  const uint32_t depth = (psbt->value_len - 4) / 4;
+
+  if (4 > psbt->value_len || 0 != psbt->value_len % 4 ||
+      BTC_PSBT_MAX_DEPTH < depth) {
+    return false;
+  }
+  for (uint32_t i = 0; i < depth; i++) {
+    path[i] = U32_READ_LE_ARRAY(psbt->field + 4 + 4 * i);
+  }
+  return PSBT_CALLBACK(psbt,
+                       bip32_derivation,
+                       psbt->map,
+                       psbt->index,
+                       psbt->key + 1,
+                       U32_READ_BE_ARRAY(psbt->field),
+                       path,
+                       depth);
+}
+
+static bool psbt_record_end(btc_psbt_t *psbt) {
+  const uint8_t *field = psbt->field;
+  uint64_t value = 0;
+  uint16_t script_len = 0;
+
+  switch (psbt->sink) {
+    case PSBT_SINK_TX:
+      psbt->tx_found = (PSBT_TX_DONE == psbt->tx_state);
+      return psbt->tx_found;
+
+    case PSBT_SINK_UTXO:
+      // the field is free while the UTXO is streamed, hold its script there
+      if (0 != btc_verify_input_final_utxo(
+                   &psbt->verify, &value, psbt->field, &script_len) ||
+          !psbt_utxo_match(psbt, value, psbt->field, script_len)) {
+        return false;
+      }
+      psbt->utxo_found = true;
+      return PSBT_CALLBACK(
+          psbt, utxo, psbt->index, value, psbt->field, script_len);
+
+    case PSBT_SINK_BUFFER:
+      break;
+
+    case PSBT_SINK_SKIP:
+    default:
+      return true;
+  }
+
+  if (BTC_PSBT_MAP_GLOBAL == psbt->map) {
+    // only version 0 is read; later versions drop the unsigned transaction
+    return (4 == psbt->value_len && 0 == U32_READ_LE_ARRAY(field));
+  }
+
+  switch (psbt->key[0]) {
+    case PSBT_IN_WITNESS_UTXO:
+      // value, CompactSize script length and the script
+      if (9 > psbt->value_len || BTC_PSBT_MAX_SCRIPT_SIZE < field[8] ||
+          9 + (uint32_t)field[8] != psbt->value_len ||
+          !psbt_utxo_match(
+              psbt, U64_READ_LE_ARRAY(field), field + 9, field[8])) {
+        return false;
+      }
+      // only checked; the output is handed over from the non-witness UTXO
+      psbt->witness_utxo_found = true;
+      return true;
+
+    case PSBT_IN_SIGHASH_TYPE:
+      if (4 != psbt->value_len) {
+        return false;
+      }
+      return PSBT_CALLBACK(
+          psbt, sighash, psbt->index, U32_READ_LE_ARRAY(field));
+
+    default:
+      // PSBT_IN_BIP32_DERIVATION or PSBT_OUT_BIP32_DERIVATION
+      return psbt_bip32_derivation(psbt);
+  }
+}
+
+static void psbt_field_complete(btc_psbt_t *psbt) {
+  uint64_t value = 0;
+
+  switch (psbt->state) {
+    case PSBT_STATE_KEY_LEN:
+    case PSBT_STATE_VALUE_LEN:
+      if (!psbt_compact_size(psbt->field, &psbt->field_len, &value)) {
+        return;
+      }
+      break;
+
+    default:
+      break;
+  }
+
+  switch (psbt->state) {
+    case PSBT_STATE_MAGIC:
+      if (0 != memcmp(psbt->field, psbt_magic, sizeof(psbt_magic))) {
+        psbt->state = PSBT_STATE_ERROR;
+      } else {
+        psbt_set_state(psbt, PSBT_STATE_KEY_LEN, 1);
+      }
+      break;
+
+    case PSBT_STATE_KEY_LEN:
+      if (0 == value) {
+        psbt_map_end(psbt);
+      } else {
+        psbt->key_len = (uint32_t)CY_MIN(value, UINT32_MAX);
+        psbt_set_state(psbt, PSBT_STATE_KEY, value);
+      }
+      break;
+
+    case PSBT_STATE_KEY:
+      if (!psbt_record_start(psbt)) {
+        psbt->state = PSBT_STATE_ERROR;
+      } else {
+        psbt_set_state(psbt, PSBT_STATE_VALUE_LEN, 1);
+      }
+      break;
+
+    case PSBT_STATE_VALUE_LEN:
+      psbt->value_len = (uint32_t)CY_MIN(value, UINT32_MAX);
+      if (PSBT_SINK_BUFFER == psbt->sink && sizeof(psbt->field) < value) {
+        psbt->state = PSBT_STATE_ERROR;
+      } else {
+        psbt_set_state(psbt, PSBT_STATE_VALUE, value);
+      }
+      break;
+
+    case PSBT_STATE_VALUE:
+      if (!psbt_record_end(psbt)) {
+        psbt->state = PSBT_STATE_ERROR;
+      } else {
+        psbt_set_state(psbt, PSBT_STATE_KEY_LEN, 1);
+      }
+      break;
+
+    default:
+      psbt->state = PSBT_STATE_ERROR;
+      break;
+  }
+}
+
+/*****************************************************************************
+ * GLOBAL FUNCTIONS
+ *****************************************************************************/
+
+void btc_psbt_init(btc_psbt_t *psbt,
+                   const btc_psbt_handler_t *handler,
+                   void *user) {
+  memzero(psbt, sizeof(btc_psbt_t));
+  psbt->handler = handler;
+  psbt->user = user;
+  psbt_set_state(psbt, PSBT_STATE_MAGIC, PSBT_MAGIC_SIZE);
+}
+
+bool btc_psbt_update(btc_psbt_t *psbt, const uint8_t *data, uint32_t size) {
+  while (0 < size && PSBT_STATE_DONE > psbt->state) {
+    uint32_t length = psbt->field_len - psbt->field_pos;
+    if (length > size) {
+      length = size;
+    }
+
+    if (PSBT_STATE_KEY == psbt->state) {
+      // longer keys are of no known type; only their length matters
+      if (sizeof(psbt->key) > psbt->field_pos) {
+        memcpy(psbt->key + psbt->field_pos,
+               data,
+               CY_MIN(length, sizeof(psbt->key) - psbt->field_pos));
+      }
+    } else if (PSBT_STATE_VALUE != psbt->state) {
+      memcpy(psbt->field + psbt->field_pos, data, length);
+    } else if (PSBT_SINK_BUFFER == psbt->sink) {
+      memcpy(psbt->field + psbt->field_pos, data, length);
+    } else if ((PSBT_SINK_TX == psbt->sink &&
+                !psbt_tx_update(psbt, data, length)) ||
+               (PSBT_SINK_UTXO == psbt->sink &&
+                !btc_verify_input_update(&psbt->verify, data, length))) {
+      psbt->state = PSBT_STATE_ERROR;
+      break;
+    }
+
+    psbt->field_pos += length;
+    data += length;
+    size -= length;
+    if (psbt->field_pos == psbt->field_len) {
+      psbt_field_complete(psbt);
+    }
+  }
+
+  // trailing bytes after the last output map are also treated as malformed
+  return (0 == size && PSBT_STATE_ERROR != psbt->state);
+}
+
+bool btc_psbt_final(btc_psbt_t *psbt) {
+  const bool complete = (PSBT_STATE_DONE == psbt->state);
+  memzero(psbt, sizeof(btc_psbt_t));
+  return complete;
+}
+
+uint16_t btc_psbt_write_partial_sig(const uint8_t *public_key,
+                                    const uint8_t *signature,
+                                    uint8_t sig_len,
+                                    uint8_t *out) {
+  if (0 == sig_len || BTC_PSBT_PARTIAL_SIG_MAX_SIZE - 36 < sig_len) {
+    return 0;
+  }
+
+  // key: length, type and the public key; then the length of the value
+  out[0] = BTC_PSBT_MAX_KEY_SIZE;
+  out[1] = PSBT_IN_PARTIAL_SIG;
+  memcpy(out + 2, public_key, BTC_PSBT_MAX_KEY_SIZE - 1);
+  out[1 + BTC_PSBT_MAX_KEY_SIZE] = sig_len;
+  memcpy(out + 2 + BTC_PSBT_MAX_KEY_SIZE, signature, sig_len);
+  return 2 + BTC_PSBT_MAX_KEY_SIZE + sig_len;
+}
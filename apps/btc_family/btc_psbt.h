@@ -0,0 +1,215 @@
+/**
+ * @file    btc_psbt.h
+ * @author  Cypherock X1 Team
+ * @brief   Streaming reader of Partially Signed Bitcoin Transactions (BIP-174)
+ * @copyright Copyright (c) 2023 HODL TECH PTE LTD
+ * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
+ * target=_blank>https://mitcc.org/</a>
+ */
+#ifndef BTC_PSBT_H
+#define BTC_PSBT_H
+
+/*****************************************************************************
+ * INCLUDES
+ *****************************************************************************/
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "btc_txn_helpers.h"
+
+/*****************************************************************************
+ * MACROS AND DEFINES
+ *****************************************************************************/
+
+/// Largest script of an output or a UTXO accepted in a PSBT
+#define BTC_PSBT_MAX_SCRIPT_SIZE BTC_VERIFY_MAX_SCRIPT_SIZE
+/// Deepest BIP-32 derivation path accepted in a PSBT
+#define BTC_PSBT_MAX_DEPTH 8
+/// Largest key kept by the reader: key type and a compressed public key
+#define BTC_PSBT_MAX_KEY_SIZE 34
+/// Largest value of a known record kept by the reader
+#define BTC_PSBT_MAX_VALUE_SIZE (8 + 1 + BTC_PSBT_MAX_SCRIPT_SIZE)
+
+/// Size of the record written by @ref btc_psbt_write_partial_sig for a DER
+/// signature of at most 72 bytes followed by the sighash byte
+#define BTC_PSBT_PARTIAL_SIG_MAX_SIZE (1 + BTC_PSBT_MAX_KEY_SIZE + 1 + 73)
+
+/*****************************************************************************
+ * TYPEDEFS
+ *****************************************************************************/
+
+/**
+ * @brief Maps of a PSBT, in the order they are serialized
+ */
+typedef enum {
+  BTC_PSBT_MAP_GLOBAL = 0,
+  BTC_PSBT_MAP_INPUT,
+  BTC_PSBT_MAP_OUTPUT,
+} btc_psbt_map_e;
+
+/**
+ * @brief Receives the content of the PSBT as it is read
+ * @details Every callback returns false to reject the PSBT, in which case the
+ * reader stops. Callbacks may be NULL if the content is not needed, except
+ * get_outpoint which is required to verify non-witness UTXOs.
+ */
+typedef struct {
+  /// The unsigned transaction, once its inputs and outputs are read
+  bool (*tx_meta)(void *user,
+                  uint32_t version,
+                  uint32_t input_count,
+                  uint32_t output_count,
+                  uint32_t locktime);
+  /// An input of the unsigned transaction
+  bool (*tx_input)(void *user,
+                   uint32_t index,
+                   const uint8_t *prev_txn_hash,
+                   uint32_t prev_output_index,
+                   uint32_t sequence);
+  /// An output of the unsigned transaction
+  bool (*tx_output)(void *user,
+                    uint32_t index,
+                    uint64_t value,
+                    const uint8_t *script,
+                    uint16_t script_len);
+  /// Returns the outpoint of the input, as given to tx_input
+  bool (*get_outpoint)(void *user,
+                       uint32_t index,
+                       uint8_t *prev_txn_hash,
+                       uint32_t *prev_output_index);
+  /// The output spent by the input, from its non-witness UTXO verified
+  /// against the outpoint of the input; a witness UTXO must match it
+  bool (*utxo)(void *user,
+               uint32_t index,
+               uint64_t value,
+               const uint8_t *script,
+               uint16_t script_len);
+  /// The sighash type of the input
+  bool (*sighash)(void *user, uint32_t index, uint32_t sighash);
+  /// A BIP-32 derivation of an input or an output
+  bool (*bip32_derivation)(void *user,
+                           btc_psbt_map_e map,
+                           uint32_t index,
+                           const uint8_t *public_key,
+                           uint32_t fingerprint,
+                           const uint32_t *path,
+                           uint8_t depth);
+} btc_psbt_handler_t;
+
+/**
+ * @brief State of the streaming reader
+ * @details The PSBT is parsed as it is fed; only the fields of the current
+ * record are kept. The unsigned transaction and the non-witness UTXOs are
+ * parsed in place, hence the PSBT need not be held in memory. Refer
+ * @ref btc_psbt_init for usage.
+ */
+typedef struct {
+  const btc_psbt_handler_t *handler;
+  void *user;
+
+  // position in the PSBT
+  uint8_t state;
+  btc_psbt_map_e map;
+  uint32_t index;
+  uint32_t input_count;
+  uint32_t output_count;
+  bool tx_found;
+  bool utxo_found;
+  bool witness_utxo_found;
+
+  // output spent by the current input, from the first of its UTXO records;
+  // the other must match it
+  uint64_t utxo_value;
+  uint8_t utxo_script[BTC_PSBT_MAX_SCRIPT_SIZE];
+  uint16_t utxo_script_len;
+
+  // current field: magic, compact size, key or value
+  uint8_t field[BTC_PSBT_MAX_VALUE_SIZE];
+  uint32_t field_len;
+  uint32_t field_pos;
+
+  // current record
+  uint8_t key[BTC_PSBT_MAX_KEY_SIZE];
+  uint32_t key_len;
+  uint32_t value_len;
+  uint8_t sink;
+
+  // unsigned transaction parser
+  uint8_t tx_state;
+  uint8_t tx_field[36];
+  uint32_t tx_field_len;
+  uint32_t tx_field_pos;
+  uint32_t tx_items_left;
+  uint32_t tx_index;
+  uint32_t tx_version;
+  uint8_t tx_script[BTC_PSBT_MAX_SCRIPT_SIZE];
+  uint64_t tx_value;
+
+  btc_verify_input_t verify;
+} btc_psbt_t;
+
+/*****************************************************************************
+ * EXPORTED VARIABLES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * GLOBAL FUNCTION PROTOTYPES
+ *****************************************************************************/
+
+/**
+ * @brief Initializes the streaming reader of a PSBT
+ * @details Feed the serialized PSBT with @ref btc_psbt_update (in any number
+ * of chunks) and conclude with @ref btc_psbt_final. Only version 0 PSBTs are
+ * read. Records of unknown types, including proprietary ones, are skipped
+ * without being kept.
+ *
+ * @param [out] psbt     Reference to the reader
+ * @param [in] handler   Callbacks receiving the content of the PSBT
+ * @param [in] user      Passed as is to the callbacks
+ */
+void btc_psbt_init(btc_psbt_t *psbt,
+                   const btc_psbt_handler_t *handler,
+                   void *user);
+
+/**
+ * @brief Parses the next chunk of the PSBT
+ *
+ * @param psbt Reference to the reader
+ * @param [in] data Next bytes of the PSBT
+ * @param [in] size Number of bytes in data
+ *
+ * @return bool Indicating if the bytes so far form a well-formed PSBT
+ * @retval false If the data is malformed, is not supported, extends past the
+ * last output map or a callback rejected it
+ */
+bool btc_psbt_update(btc_psbt_t *psbt, const uint8_t *data, uint32_t size);
+
+/**
+ * @brief Concludes the reading of the fed PSBT and clears the reader
+ *
+ * @param psbt Reference to the reader
+ *
+ * @return bool Indicating if a complete and well-formed PSBT was read, with a
+ * verified non-witness UTXO for every input
+ */
+bool btc_psbt_final(btc_psbt_t *psbt);
+
+/**
+ * @brief Serializes the partial signature of an input as a PSBT record
+ * @details The record (key type 0x02) is meant to be streamed back to the host
+ * within the input map of the signed input.
+ *
+ * @param [in] public_key  Compressed public key of the signer
+ * @param [in] signature   DER signature followed by the sighash byte
+ * @param [in] sig_len     Length of signature
+ * @param [out] out        Buffer of BTC_PSBT_PARTIAL_SIG_MAX_SIZE bytes
+ *
+ * @return uint16_t Length of the record, 0 if the signature is too long
+ */
+uint16_t btc_psbt_write_partial_sig(const uint8_t *public_key,
+                                    const uint8_t *signature,
+                                    uint8_t sig_len,
+                                    uint8_t *out);
+
+#endif /* BTC_PSBT_H */
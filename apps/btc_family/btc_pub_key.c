@@ -71,6 +71,7 @@
 #include "ui_core_confirm.h"
 #include "ui_screens.h"
 #include "wallet_list.h"
+#include "xpub_cache.h"
 
 /*****************************************************************************
  * EXTERN VARIABLES
@@ -118,26 +119,45 @@ static bool check_which_request(const btc_query_t *query,
 static bool validate_request_data(btc_get_public_key_request_t *request);
 
 /**
- * @brief Derives uncompressed public key and address from the provided seed
- * @details The function can provided both public_key and address. It accepts
- * NULL in output parameters and handles accordingly. The function
- * also manages all the terminal errors during derivation/encoding, in which
- * case it will return 0 and send a relevant error to the host closing the
- * request-response pair. All the errors/invalid cases are conveyed to the host
- * as unknown_error = 1 because we expect the data validation was success.
+ * @brief Derives the node of the path for the wallet
+ * @details If the account node of the path is in the xpub cache, the node is
+ * derived from it with public derivation and no card is tapped. Otherwise the
+ * seed is reconstructed from the X1 Cards, and the account node gets cached
+ * when the wallet is usable with the cache. The function manages the terminal
+ * errors, in which case it will return false and send a relevant error to the
+ * host closing the request-response pair.
  *
- * @param seed Reference to the wallet seed generated from X1 Card
+ * @param wallet_id The wallet_id of the wallet
  * @param path Derivation path of the node to be derived
  * @param path_length Expected length of the provided derivation path
+ * @param node Storage location for the derived node
+ *
+ * @return bool Indicating if the node was derived
+ */
+static bool btc_derive_node(const uint8_t *wallet_id,
+                            const uint32_t *path,
+                            uint32_t path_length,
+                            HDNode *node);
+
+/**
+ * @brief Encodes uncompressed public key and address of the provided node
+ * @details The function can provided both public_key and address. It accepts
+ * NULL in output parameters and handles accordingly. The function
+ * also manages all the terminal errors during encoding, in which case it will
+ * return 0 and send a relevant error to the host closing the request-response
+ * pair. All the errors/invalid cases are conveyed to the host as
+ * unknown_error = 1 because we expect the data validation was success.
+ *
+ * @param node Node of the address; only its public key is used
+ * @param path Derivation path of the node
  * @param public_key Storage location for raw uncompressed public key
  * @param address Storage location for encoded public address
  *
  * @return size_t length of the derived public address
- * @retval 0 If derivation failed
+ * @retval 0 If encoding failed
  */
-static size_t btc_get_address(const uint8_t *seed,
+static size_t btc_get_address(HDNode *node,
                               const uint32_t *path,
-                              uint32_t path_length,
                               uint8_t *public_key,
                               char *address);
 
@@ -176,33 +196,60 @@ static bool validate_request_data(btc_get_public_key_request_t *request) {
   return status;
 }
 
-static size_t btc_get_address(const uint8_t *seed,
+static bool btc_derive_node(const uint8_t *wallet_id,
+                            const uint32_t *path,
+                            uint32_t path_length,
+                            HDNode *node) {
+  uint8_t seed[64] = {0};
+  hd_path_cache_t cache = {0};
+  HDNode account = {0};
+  bool status = false;
+
+  if (xpub_cache_derive(wallet_id, path, path_length, node)) {
+    return true;
+  }
+
+  if (!reconstruct_seed(wallet_id, &seed[0], btc_send_error)) {
+    memzero(seed, sizeof(seed));
+    return false;
+  }
+
+  // the account node shares its path with the address; derive it once
+  hd_path_cache_init(&cache, SECP256K1_NAME, seed);
+  status = hd_path_cache_derive(&cache, path, path_length, node);
+  if (status && xpub_cache_path_supported(path, path_length) &&
+      hd_path_cache_derive(&cache, path, XPUB_CACHE_ACCOUNT_DEPTH, &account)) {
+    xpub_cache_store(wallet_id, path, &account);
+  }
+  hd_path_cache_clear(&cache);
+  memzero(&account, sizeof(HDNode));
+  memzero(seed, sizeof(seed));
+
+  if (!status) {
+    // send unknown error; unknown failure reason
+    btc_send_error(ERROR_COMMON_ERROR_UNKNOWN_ERROR_TAG, 1);
+    memzero(node, sizeof(HDNode));
+  }
+  return status;
+}
+
+static size_t btc_get_address(HDNode *node,
                               const uint32_t *path,
-                              uint32_t path_length,
                               uint8_t *public_key,
                               char *address) {
-  HDNode node = {0};
   char addr[50] = "";
   size_t address_length = 0;
 
-  if (!derive_hdnode_from_path(
-          path, path_length, SECP256K1_NAME, seed, &node)) {
-    // send unknown error; unknown failure reason
-    btc_send_error(ERROR_COMMON_ERROR_UNKNOWN_ERROR_TAG, 1);
-    memzero(&node, sizeof(HDNode));
-    return address_length;
-  }
-
   switch (path[0]) {
     case NATIVE_SEGWIT:
       // ignoring the return status and handling by size of address
-      btc_get_segwit_addr(node.public_key,
-                          sizeof(node.public_key),
+      btc_get_segwit_addr(node->public_key,
+                          sizeof(node->public_key),
                           g_btc_app->bech32_hrp,
                           addr);
       break;
     case NON_SEGWIT:
-      hdnode_get_address(&node, g_btc_app->p2pkh_addr_ver, addr, 35);
+      hdnode_get_address(node, g_btc_app->p2pkh_addr_ver, addr, 35);
       break;
     // TODO: add support for taproot and segwit
     default:
@@ -215,13 +262,13 @@ static size_t btc_get_address(const uint8_t *seed,
     btc_send_error(ERROR_COMMON_ERROR_UNKNOWN_ERROR_TAG, 1);
   }
   if (NULL != public_key) {
-    ecdsa_uncompress_pubkey(
-        get_curve_by_name(SECP256K1_NAME)->params, node.public_key, public_key);
+    ecdsa_uncompress_pubkey(get_curve_by_name(SECP256K1_NAME)->params,
+                            node->public_key,
+                            public_key);
   }
   if (NULL != address) {
     memcpy(address, addr, address_length);
   }
-  memzero(&node, sizeof(HDNode));
   return address_length;
 }
 
@@ -248,7 +295,7 @@ static void send_public_key(const uint8_t *public_key) {
 void btc_get_pub_key(btc_query_t *query) {
   char wallet_name[NAME_SIZE] = "";
   char msg[100] = "";
-  uint8_t seed[64] = {0};
+  HDNode node = {0};
   uint8_t public_key[65] = {0};
   btc_get_public_key_intiate_request_t *init_req =
       &query->get_public_key.initiate;
@@ -269,20 +316,19 @@ void btc_get_pub_key(btc_query_t *query) {
   }
 
   set_app_flow_status(BTC_GET_PUBLIC_KEY_STATUS_CONFIRM);
+  const uint32_t *path = init_req->derivation_path;
+  uint32_t path_length = init_req->derivation_path_count;
 
-  if (!reconstruct_seed(
-          query->get_xpubs.initiate.wallet_id, &seed[0], btc_send_error)) {
-    memzero(seed, sizeof(seed));
+  if (!btc_derive_node(
+          query->get_xpubs.initiate.wallet_id, path, path_length, &node)) {
     return;
   }
 
+  // also reported on a cache hit, the host expects the status sequence
   set_app_flow_status(BTC_GET_PUBLIC_KEY_STATUS_SEED_GENERATED);
-  const uint32_t *path = init_req->derivation_path;
-  uint32_t path_length = init_req->derivation_path_count;
-
   delay_scr_init(ui_text_processing, DELAY_SHORT);
-  size_t length = btc_get_address(seed, path, path_length, public_key, msg);
-  memzero(seed, sizeof(seed));
+  size_t length = btc_get_address(&node, path, public_key, msg);
+  memzero(&node, sizeof(HDNode));
   if (0 < length &&
       true == core_scroll_page(ui_text_receive_on, msg, btc_send_error)) {
     set_app_flow_status(BTC_GET_PUBLIC_KEY_STATUS_VERIFY);
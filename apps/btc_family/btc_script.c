@@ -170,7 +170,19 @@ int btc_get_script_pub_address(const uint8_t *script,
                                size_t script_len,
                                char *addr,
                                int out_len) {
-  btc_script_type_e type = btc_get_script_type(script, script_len);
+  return btc_get_typed_script_pub_address(
+      btc_get_script_type(script, script_len),
+      script,
+      script_len,
+      addr,
+      out_len);
+}
+
+int btc_get_typed_script_pub_address(const btc_script_type_e type,
+                                     const uint8_t *script,
+                                     size_t script_len,
+                                     char *addr,
+                                     int out_len) {
   int status = -3;
 
   switch (type) {
@@ -194,6 +206,11 @@ int btc_get_script_pub_address(const uint8_t *script,
     case SCRIPT_TYPE_P2WSH:
     case SCRIPT_TYPE_P2TR:
     case SCRIPT_TYPE_UNKNOWN_SEGWIT: {
+      if (!btc_has_segwit()) {
+        // the fork has no address for a witness program
+        status = -1;
+        break;
+      }
       if (out_len < 73 + BECH32_HRP_SIZE) {
         return -3;
       }
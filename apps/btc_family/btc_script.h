@@ -286,6 +286,24 @@ int btc_get_script_pub_address(const uint8_t *script,
                                char *addr,
                                int out_len);
 
+/**
+ * @brief Same as @ref btc_get_script_pub_address but for a script already
+ * classified with @ref btc_get_script_type
+ *
+ * @param [in] type       - Type of the script as per btc_get_script_type
+ * @param [in] script     - Pointer to the scriptPubKey data bytes
+ * @param [in] script_len - Length of the provided script
+ * @param [out] addr      - Output buffer to hold the null-terminated address
+ * @param [in] out_len    - Size of the output buffer
+ *
+ * @return int Same as btc_get_script_pub_address
+ */
+int btc_get_typed_script_pub_address(btc_script_type_e type,
+                                     const uint8_t *script,
+                                     size_t script_len,
+                                     char *addr,
+                                     int out_len);
+
 /**
  * @brief Validates the change address for a Bitcoin (and its forks)
  * transaction.
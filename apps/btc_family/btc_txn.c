@@ -69,8 +69,14 @@
 #include "coin_utils.h"
 #include "constant_texts.h"
 #include "curves.h"
+#include "events.h"
+#include "flash_api.h"
 #include "reconstruct_wallet_flow.h"
+#include "session_bench.h"
+#include "sha2.h"
 #include "status_api.h"
+#include "task_scheduler.h"
+#include "txn_pool.h"
 #include "ui_core_confirm.h"
 #include "ui_screens.h"
 #include "wallet_list.h"
@@ -83,17 +89,65 @@
  * PRIVATE MACROS AND DEFINES
  *****************************************************************************/
 
-#define TXN_MAX_INPUTS 200
-#define TXN_MAX_OUTPUTS 200
-#define TXN_MAX_UTXO_SUM ((TXN_MAX_INPUTS + TXN_MAX_OUTPUTS) / 2)
+/// Set by the capacity profile: 200 in the standard build, more only in High
+#define TXN_MAX_INPUTS CAPACITY_BTC_MAX_UTXO_SUM
+#define TXN_MAX_OUTPUTS CAPACITY_BTC_MAX_UTXO_SUM
+#define TXN_MAX_UTXO_SUM CAPACITY_BTC_MAX_UTXO_SUM
 #define SCRIPT_SIG_SIZE 128
 
+/// Receivers from which a transaction is summarized, if enabled in settings
+#define BTC_SUMMARY_MIN_RECEIVERS 4
+/// Bytes of the receivers digest shown on the summary
+#define BTC_RECEIVERS_DIGEST_SHOWN 8
+/// Slice of the task preparing the next receiver screen ahead of time
+#define BTC_LOOKAHEAD_SLICE_MS 20
+
+/// Copies the input details of btc_sign_txn_input_t into btc_txn_input_t
+#define CLONE_TXN_INPUT(dst, src)                                              \
+  do {                                                                         \
+    (dst)->prev_output_index = (src)->prev_output_index;                       \
+    (dst)->address_index = (src)->address_index;                               \
+    (dst)->change_index = (src)->change_index;                                 \
+    (dst)->value = (src)->value;                                               \
+    (dst)->sequence = (src)->sequence;                                         \
+    (dst)->script_pub_key.size = (src)->script_pub_key.size;                   \
+    memcpy((dst)->prev_txn_hash, (src)->prev_txn_hash, 32);                    \
+    memcpy((dst)->script_pub_key.bytes,                                        \
+           (src)->script_pub_key.bytes,                                        \
+           (src)->script_pub_key.size);                                        \
+  } while (0)
+
+// sizes assumed by the capacity profile for TXN_MAX_UTXO_SUM
+_Static_assert(sizeof(btc_txn_context_t) <= CAPACITY_BTC_CONTEXT_BYTES,
+               "BTC context outgrew the capacity profile");
+_Static_assert(sizeof(btc_txn_input_t) <= CAPACITY_BTC_INPUT_BYTES &&
+                   sizeof(btc_sign_txn_output_t) + sizeof(btc_script_type_e) <=
+                       CAPACITY_BTC_INPUT_BYTES,
+               "BTC input/output outgrew the capacity profile");
+_Static_assert(CAPACITY_BTC_CONTEXT_BYTES + 3 * 8 +
+                       TXN_MAX_UTXO_SUM * CAPACITY_BTC_INPUT_BYTES <=
+                   TXN_POOL_SIZE,
+               "txn_pool cannot fit a transaction of TXN_MAX_UTXO_SUM");
+_Static_assert(TXN_MAX_UTXO_SUM >= 200,
+               "Capacity profile accepts fewer BTC inputs + outputs than 200");
+
 /*****************************************************************************
  * PRIVATE TYPEDEFS
  *****************************************************************************/
 
 typedef btc_sign_txn_signature_response_signature_t scrip_sig_t;
 
+/**
+ * @brief Receiver screens rendered in idle time, while the user still reads
+ * the screens of the previous receiver
+ */
+typedef struct {
+  int idx;    ///< Output being prepared; -1 if none
+  bool ready; ///< Set once address & value hold the rendering of idx
+  char address[100];
+  char value[100];
+} btc_receiver_lookahead_t;
+
 /*****************************************************************************
  * STATIC FUNCTION PROTOTYPES
  *****************************************************************************/
@@ -184,6 +238,34 @@ static bool fetch_transaction_meta(btc_query_t *query);
  */
 static bool fetch_valid_input(btc_query_t *query);
 
+/**
+ * @brief Validates the input already cloned into btc_txn_context at the given
+ * index against its raw previous transaction
+ * @details In case of failure, the host is informed with an error.
+ *
+ * @param idx Index of the input in btc_txn_context
+ * @param prev_txn Raw previous transaction sent along with the input
+ * @param prev_txn_size Size of prev_txn
+ *
+ * @return bool Indicating if the input is valid
+ */
+static bool validate_input(int idx,
+                           const uint8_t *prev_txn,
+                           uint32_t prev_txn_size);
+
+/**
+ * @brief Validates the output already cloned into btc_txn_context at the given
+ * index
+ * @details The function sends an error to the host if the output is of an
+ * unsupported script type, locks funds in NULL_DATA or declares a second
+ * change output.
+ *
+ * @param idx Index of the output in btc_txn_context
+ *
+ * @return bool Indicating if the output is acceptable
+ */
+static bool validate_output(int idx);
+
 /**
  * @brief Fetches the outputs list for the transaction
  * @details The function refers to the number of outputs declared in the
@@ -214,6 +296,60 @@ static bool fetch_valid_output(btc_query_t *query);
  */
 static bool get_user_verification();
 
+/**
+ * @brief Shows the address and the value of each receiver for confirmation
+ *
+ * @return bool Indicating if the user confirmed every receiver
+ */
+static bool verify_each_receiver();
+
+/**
+ * @brief Shows a summary of the receivers for confirmation
+ * @details The summary holds the total value, the number of receivers and a
+ * digest of the receivers: the leading BTC_RECEIVERS_DIGEST_SHOWN bytes of the
+ * SHA256 of every receiver, in order, as its address with the terminating NUL
+ * followed by its value in satoshi as 8 bytes little-endian. The user can
+ * compare the digest with the one of the payout list, or choose to review each
+ * receiver instead.
+ *
+ * @param receiver_count Number of non-change outputs
+ *
+ * @return bool Indicating if the user approved the receivers
+ */
+static bool verify_receiver_summary(uint16_t receiver_count);
+
+/**
+ * @brief Renders the address of the specified output
+ * @details Sends an error to the host if the script is not recognised.
+ *
+ * @param idx Index of the output
+ * @param address Buffer to store the address in
+ * @param address_size Size of the buffer
+ *
+ * @return bool Indicating if the address was rendered
+ */
+static bool get_output_address(int idx, char *address, size_t address_size);
+
+/**
+ * @brief Scheduler task rendering the receiver queued in receiver_lookahead
+ * @details Runs in the idle loop of get_events() while a receiver screen is
+ * shown. The task renders silently; a script that fails to render is left to
+ * verify_each_receiver() which reports the error when it gets there.
+ *
+ * @param budget_ms Unused, a receiver is rendered in one slice
+ *
+ * @return bool Always false, the task is idle till the next receiver is queued
+ */
+static bool receiver_lookahead_task(uint32_t budget_ms);
+
+/**
+ * @brief Queues the first receiver after the specified output for rendering
+ * in idle time
+ *
+ * @param idx Index of the output currently shown
+ */
+static void receiver_lookahead_queue(int idx);
+
 /**
  * @brief Validates the change output for an exact match with wallet's derived
  * change address.
@@ -230,45 +366,73 @@ static bool get_user_verification();
 static bool validate_change_address(const HDNode *acc_node);
 
 /**
- * @brief Signs all the inputs following SIGHASH_ALL type and prepares script
- * sigs.
+ * @brief Prepares the account node for signing the inputs
  * @details The function internally calls wallet reconstruction sub-flow to get
- * access to the seed. Each input is signed with their respective private key
- * derived at the specified path. The function additionally validates the change
- * output address for sanity. The function will ensure clearing of all the keys
- * and other sensitive data (such as seed, HDNode, etc.) before exiting and
- * should ensure no leakage of secret data.
- *
- * @param signatures Reference to the buffer sufficient enough for storing all
- * the scriptSigs of the transaction being signed. Should be able to store
- * >=btc_txn_context->metadata.input_count.
- *
- * @return bool Indicating if scriptSig for all the provided inputs was
- * successfully generated
- * @retval true If all the scriptSigs are generated without any error
- * @retval false If any of the scriptSig failed to generate
+ * access to the seed and derives the account node at the specified path. It
+ * also populates the segwit cache and validates the change output address for
+ * sanity. The function ensures clearing of the seed before exiting; the caller
+ * must clear the account node after use.
+ *
+ * @param node Reference to the HDNode to store the account node in
+ *
+ * @return bool Indicating if the account node is ready to sign the inputs
+ * @retval true If the account node was derived and the change was valid
+ * @retval false If the seed could not be reconstructed or change was invalid
+ */
+static bool prepare_signing(HDNode *node);
+
+/**
+ * @brief Returns the keys of the specified input from the key cache
+ * @details On a cache miss, the keys are derived from the account node (reusing
+ * the cached change node when the change index matches) and stored in the
+ * cache replacing the oldest entry.
+ *
+ * @param node Reference to the account node prepared by prepare_signing()
+ * @param input Reference to the input to get the keys for
+ *
+ * @return const btc_key_cache_entry_t* Reference to the cached keys
+ */
+static const btc_key_cache_entry_t *get_input_keys(
+    const HDNode *node,
+    const btc_txn_input_t *input);
+
+/**
+ * @brief Signs the input following SIGHASH_ALL type and prepares its scriptSig
+ * @details The input is signed with its private key derived from the account
+ * node. The function ensures clearing of the derived keys before exiting.
+ *
+ * @param node Reference to the account node prepared by prepare_signing()
+ * @param idx Index of the input to sign
+ * @param signature Reference to the buffer to store the scriptSig in
+ *
+ * @return bool Indicating if the scriptSig was successfully generated
+ * @retval true If the scriptSig is generated without any error
+ * @retval false If the digest or the scriptSig could not be generated
  */
-static bool sign_input(scrip_sig_t *signatures);
+static bool sign_input(const HDNode *node, int idx, scrip_sig_t *signature);
 
 /**
- * @brief Sends the generated scriptSigs to the host one-at-a-time
+ * @brief Signs the inputs and sends the scriptSigs to the host one-at-a-time
+ * @details Each input is signed on-demand, so no list of signatures is held.
+ * The scriptSig for the next input is computed right after sending the current
+ * one, overlapping the host processing the sent signature.
  *
  * @param query Reference to an instance of btc_query_t to store transient
  * requests from the host
- * @param sigs Reference to a list of prepared scriptSigs. The buffer should
- * hold at least btc_txn_context->metadata.input_count of scriptSigs
  *
  * @return bool Indicating if all the scriptSig is sent to the host
  * @retval true If all the scriptSig was sent to host successfully
- * @retval false If the host responded with unknown/wrong query
+ * @retval false If the host responded with unknown/wrong query or signing
+ * failed
  */
-static bool send_script_sig(btc_query_t *query, const scrip_sig_t *sigs);
+static bool send_script_sig(btc_query_t *query);
 
 /*****************************************************************************
  * STATIC VARIABLES
  *****************************************************************************/
 
 static btc_txn_context_t *btc_txn_context = NULL;
+static btc_receiver_lookahead_t receiver_lookahead = {.idx = -1};
 
 /*****************************************************************************
  * GLOBAL VARIABLES
@@ -363,105 +527,197 @@ static bool fetch_transaction_meta(btc_query_t *query) {
   memcpy(&btc_txn_context->metadata,
          &query->sign_txn.meta,
          sizeof(btc_sign_txn_metadata_t));
-  btc_txn_context->inputs = (btc_txn_input_t *)malloc(
-      sizeof(btc_txn_input_t) * btc_txn_context->metadata.input_count);
-  btc_txn_context->outputs = (btc_sign_txn_output_t *)malloc(
-      sizeof(btc_sign_txn_output_t) * btc_txn_context->metadata.output_count);
-  // TODO: check if malloc failed; report to host and exit
+  btc_txn_context->inputs =
+      TXN_POOL_NEW(btc_txn_input_t, btc_txn_context->metadata.input_count);
+  btc_txn_context->outputs = TXN_POOL_NEW(
+      btc_sign_txn_output_t, btc_txn_context->metadata.output_count);
+  btc_txn_context->output_script_types = TXN_POOL_NEW(
+      btc_script_type_e, btc_txn_context->metadata.output_count);
+  if (NULL == btc_txn_context->inputs || NULL == btc_txn_context->outputs ||
+      NULL == btc_txn_context->output_script_types) {
+    // the transaction does not fit in the memory reserved for signing
+    btc_send_error(ERROR_COMMON_ERROR_CORRUPT_DATA_TAG,
+                   ERROR_DATA_FLOW_INVALID_DATA);
+    return false;
+  }
+
   send_response(BTC_SIGN_TXN_RESPONSE_META_ACCEPTED_TAG);
   return true;
 }
 
+static const btc_prev_txn_cache_entry_t *prev_txn_cache_find(
+    const uint8_t *txn_hash) {
+  const btc_prev_txn_cache_t *cache = btc_txn_context->prev_txn_cache;
+  if (NULL == cache) {
+    return NULL;
+  }
+  for (uint8_t i = 0; i < BTC_PREV_TXN_CACHE_SIZE; i++) {
+    const btc_prev_txn_cache_entry_t *entry = &cache->entries[i];
+    if (entry->filled &&
+        0 == memcmp(entry->txn_hash, txn_hash, sizeof(entry->txn_hash))) {
+      return entry;
+    }
+  }
+  return NULL;
+}
+
+static bool validate_input(const int idx,
+                           const uint8_t *prev_txn,
+                           const uint32_t prev_txn_size) {
+  btc_txn_input_t *input = &btc_txn_context->inputs[idx];
+  // P2PK 68, P2PKH 25 (21 excluding OP_CODES), P2WPKH 22, P2MS ~, P2SH 23 (21
+  // excluding OP_CODES). refer https://learnmeabitcoin.com/technical/script
+  // for explanation. Currently, the device can spend P2PKH or P2WPKH inputs
+  const btc_script_type_e type = btc_get_script_type(
+      input->script_pub_key.bytes, input->script_pub_key.size);
+  // cache for digest & weight calculation
+  input->script_type = type;
+  const btc_prev_txn_cache_entry_t *cached =
+      prev_txn_cache_find(input->prev_txn_hash);
+
+  if ((SCRIPT_TYPE_P2PKH != type && SCRIPT_TYPE_P2WPKH != type) ||
+      (0 == prev_txn_size && NULL == cached)) {
+    btc_send_error(ERROR_COMMON_ERROR_CORRUPT_DATA_TAG,
+                   ERROR_DATA_FLOW_INVALID_DATA);
+    return false;
+  }
+
+  if (NULL != cached) {
+    // the previous transaction is verified already, any prev_txn sent again
+    // is ignored
+    if (cached->output_count <= input->prev_output_index ||
+        cached->values[input->prev_output_index] != input->value) {
+      btc_send_error(ERROR_COMMON_ERROR_CORRUPT_DATA_TAG,
+                     ERROR_DATA_FLOW_INVALID_DATA);
+      return false;
+    }
+    return true;
+  }
+
+  // TODO: ensure only valid input for the path are being provided. spending a
+  // segwit input on the legacy derivation path does not make sense.
+  // verify transaction details and discard the raw-transaction (prev_txn)
+  btc_verify_input_t verifier = {0};
+  btc_verify_input_init(&verifier,
+                        input->prev_txn_hash,
+                        input->prev_output_index,
+                        input->value);
+  btc_prev_txn_cache_t *cache = btc_txn_context->prev_txn_cache;
+  btc_prev_txn_cache_entry_t *entry = NULL;
+  if (NULL != cache && NULL == cached) {
+    // record the other outputs for the inputs spending them
+    entry = &cache->entries[cache->next_entry];
+    entry->filled = false;
+    memcpy(entry->txn_hash, input->prev_txn_hash, sizeof(entry->txn_hash));
+    btc_verify_input_record_values(&verifier,
+                                   entry->values,
+                                   BTC_PREV_TXN_CACHE_MAX_OUTPUTS,
+                                   &entry->output_count);
+  }
+  const bool parsed =
+      btc_verify_input_update(&verifier, prev_txn, prev_txn_size);
+  if (0 != btc_verify_input_final(&verifier) || !parsed) {
+    // input validation failed, terminate immediately
+    btc_send_error(ERROR_COMMON_ERROR_CORRUPT_DATA_TAG,
+                   ERROR_DATA_FLOW_INVALID_DATA);
+    return false;
+  }
+  if (NULL != entry && 0 < entry->output_count) {
+    entry->filled = true;
+    cache->next_entry = (cache->next_entry + 1) % BTC_PREV_TXN_CACHE_SIZE;
+  }
+  return true;
+}
+
 static bool fetch_valid_input(btc_query_t *query) {
   // Validate inputs for safety from attack. Ref:
   // https://blog.trezor.io/details-of-firmware-updates-for-trezor-one-version-1-9-1-and-trezor-model-t-version-2-3-1-1eba8f60f2dd
-  for (int idx = 0; idx < btc_txn_context->metadata.input_count; idx++) {
-    if (!btc_get_query(query, BTC_QUERY_SIGN_TXN_TAG) ||
-        !check_which_request(query, BTC_SIGN_TXN_REQUEST_INPUT_TAG)) {
+  int idx = 0;
+  if (1 < btc_txn_context->metadata.input_count) {
+    // optional; without it every input is verified on its own
+    btc_txn_context->prev_txn_cache = TXN_POOL_NEW(btc_prev_txn_cache_t, 1);
+  }
+  while (idx < btc_txn_context->metadata.input_count) {
+    if (!btc_get_query(query, BTC_QUERY_SIGN_TXN_TAG)) {
       return false;
     }
-    const btc_sign_txn_input_t *txin = &query->sign_txn.input;
-    // P2PK 68, P2PKH 25 (21 excluding OP_CODES), P2WPKH 22, P2MS ~, P2SH 23 (21
-    // excluding OP_CODES). refer https://learnmeabitcoin.com/technical/script
-    // for explanation. Currently, the device can spend P2PKH or P2WPKH inputs
-    const btc_script_type_e type = btc_get_script_type(
-        txin->script_pub_key.bytes, txin->script_pub_key.size);
-
-    // TODO: ensure only valid input for the path are being provided. spending a
-    // segwit input on the legacy derivation path does not make sense.
-    // verify transaction details and discard the raw-transaction (prev_txn)
-    const btc_sign_txn_input_prev_txn_t *txn = &txin->prev_txn;
-    if ((SCRIPT_TYPE_P2PKH != type && SCRIPT_TYPE_P2WPKH != type) ||
-        0 != btc_verify_input(txn->bytes, txn->size, txin)) {
-      // input validation failed, terminate immediately
-      btc_send_error(ERROR_COMMON_ERROR_CORRUPT_DATA_TAG,
-                     ERROR_DATA_FLOW_INVALID_DATA);
+
+    if (!check_which_request(query, BTC_SIGN_TXN_REQUEST_INPUT_TAG)) {
       return false;
     }
-
     // clone the input details into btc_txn_context
-    btc_txn_input_t *input = &btc_txn_context->inputs[idx];
-    input->prev_output_index = txin->prev_output_index;
-    input->address_index = txin->address_index;
-    input->change_index = txin->change_index;
-    input->value = txin->value;
-    input->sequence = txin->sequence;
-    input->script_pub_key.size = txin->script_pub_key.size;
-    memcpy(input->prev_txn_hash, txin->prev_txn_hash, 32);
-    memcpy(input->script_pub_key.bytes,
-           txin->script_pub_key.bytes,
-           input->script_pub_key.size);
+    const btc_sign_txn_input_t *txin = &query->sign_txn.input;
+    const btc_bytes_slice_t prev_txn = btc_query_get_bytes(&txin->prev_txn);
+    CLONE_TXN_INPUT(&btc_txn_context->inputs[idx], txin);
+    // prev_txn is read from the usb buffer, before any response is sent
+    if (!validate_input(idx, prev_txn.bytes, prev_txn.size)) {
+      return false;
+    }
+    btc_txn_account_input(btc_txn_context, &btc_txn_context->inputs[idx]);
 
     // send accepted response to indicate validation of input passed
     send_response(BTC_SIGN_TXN_RESPONSE_INPUT_ACCEPTED_TAG);
+    idx++;
+  }
+  return true;
+}
+
+static bool validate_output(const int idx) {
+  const btc_sign_txn_output_t *output = &btc_txn_context->outputs[idx];
+  const btc_script_type_e type = btc_get_script_type(
+      output->script_pub_key.bytes, output->script_pub_key.size);
+  // cache for address rendering
+  btc_txn_context->output_script_types[idx] = type;
+  if (SCRIPT_TYPE_P2MS == type || SCRIPT_TYPE_P2PK == type ||
+      SCRIPT_TYPE_NONSTANDARD == type ||
+      (SCRIPT_TYPE_NULL_DATA == type && 0 != output->value) ||
+      (-1 != btc_txn_context->change_output_idx && true == output->is_change)) {
+    // ensure output type is standard & we support verification by user
+    // ensure any funds are not being locked (not spendable) to NULL_DATA
+    // ensure exactly one change address is present/declared
+    btc_send_error(ERROR_COMMON_ERROR_CORRUPT_DATA_TAG,
+                   ERROR_DATA_FLOW_INVALID_DATA);
+    return false;
+  }
+
+  if (output->is_change) {
+    // first change output declaration detected; store for quick access
+    btc_txn_context->change_output_idx = idx;
   }
   return true;
 }
 
 static bool fetch_valid_output(btc_query_t *query) {
-  // track if it is a zero valued transaction; all input is going into fee
-  bool zero_value_transaction = true;
-  // restrict multiple change outputs; it is wastage of fee for user; this is
-  // a loose check as it is externally controlled
-  bool change_detected = false;
   btc_txn_context->change_output_idx = -1;
 
-  for (int idx = 0; idx < btc_txn_context->metadata.output_count; idx++) {
-    if (!btc_get_query(query, BTC_QUERY_SIGN_TXN_TAG) ||
-        !check_which_request(query, BTC_SIGN_TXN_REQUEST_OUTPUT_TAG)) {
+  int idx = 0;
+  while (idx < btc_txn_context->metadata.output_count) {
+    if (!btc_get_query(query, BTC_QUERY_SIGN_TXN_TAG)) {
       return false;
     }
 
-    btc_sign_txn_output_t *output = &query->sign_txn.output;
-    memcpy(
-        &btc_txn_context->outputs[idx], output, sizeof(btc_sign_txn_output_t));
-    if (0 != output->value) {
-      zero_value_transaction = false;
-    }
-    const btc_script_type_e type = btc_get_script_type(
-        output->script_pub_key.bytes, output->script_pub_key.size);
-    if (SCRIPT_TYPE_P2MS == type || SCRIPT_TYPE_P2PK == type ||
-        SCRIPT_TYPE_NONSTANDARD == type ||
-        (SCRIPT_TYPE_NULL_DATA == type && 0 != output->value) ||
-        (true == change_detected && true == output->is_change)) {
-      // ensure output type is standard & we support verification by user
-      // ensure any funds are not being locked (not spendable) to NULL_DATA
-      // ensure exactly one change address is present/declared
-      btc_send_error(ERROR_COMMON_ERROR_CORRUPT_DATA_TAG,
-                     ERROR_DATA_FLOW_INVALID_DATA);
+    if (!check_which_request(query, BTC_SIGN_TXN_REQUEST_OUTPUT_TAG)) {
       return false;
     }
-
-    if (output->is_change) {
-      // first change output declaration detected; store for quick access
-      change_detected = true;
-      btc_txn_context->change_output_idx = idx;
+    memcpy(&btc_txn_context->outputs[idx],
+           &query->sign_txn.output,
+           sizeof(btc_sign_txn_output_t));
+    if (!validate_output(idx)) {
+      return false;
     }
+    btc_txn_account_output(btc_txn_context, &btc_txn_context->outputs[idx]);
     // send accepted response to indicate validation of output passed
     send_response(BTC_SIGN_TXN_RESPONSE_OUTPUT_ACCEPTED_TAG);
+    idx++;
   }
-  if (true == zero_value_transaction) {
+
+  // a wrapped sum implies a non-zero output
+  const btc_txn_totals_t *totals = &btc_txn_context->totals;
+  uint64_t fee = 0;
+  if ((0 == totals->output_value && !totals->overflow) ||
+      !btc_get_txn_fee(btc_txn_context, &fee)) {
     // do not allow zero valued transaction; all input is going into fee
+    // reject an overspending transaction before the user reviews it
     btc_send_error(ERROR_COMMON_ERROR_CORRUPT_DATA_TAG,
                    ERROR_DATA_FLOW_INVALID_DATA);
     return false;
@@ -469,32 +725,185 @@ static bool fetch_valid_output(btc_query_t *query) {
   return true;
 }
 
-static bool get_user_verification() {
+static bool get_output_address(int idx, char *address, size_t address_size) {
+  const btc_sign_txn_output_script_pub_key_t *script =
+      &btc_txn_context->outputs[idx].script_pub_key;
+  int status = btc_get_typed_script_pub_address(
+      btc_txn_context->output_script_types[idx],
+      script->bytes,
+      script->size,
+      address,
+      address_size);
+  if (1 > status) {
+    // send error status as value for unknown error
+    btc_send_error(ERROR_COMMON_ERROR_UNKNOWN_ERROR_TAG, status);
+    return false;
+  }
+  return true;
+}
+
+static bool receiver_lookahead_task(uint32_t budget_ms) {
+  (void)budget_ms;
+  int idx = receiver_lookahead.idx;
+  if (NULL == btc_txn_context || 0 > idx || receiver_lookahead.ready) {
+    return false;
+  }
+
+  const btc_sign_txn_output_t *output = &btc_txn_context->outputs[idx];
+  format_value(output->value,
+               receiver_lookahead.value,
+               sizeof(receiver_lookahead.value));
+  receiver_lookahead.ready =
+      (1 <= btc_get_typed_script_pub_address(
+                btc_txn_context->output_script_types[idx],
+                output->script_pub_key.bytes,
+                output->script_pub_key.size,
+                receiver_lookahead.address,
+                sizeof(receiver_lookahead.address)));
+  if (!receiver_lookahead.ready) {
+    // rendered again inline, which reports the error
+    receiver_lookahead.idx = -1;
+  }
+  return false;
+}
+
+static void receiver_lookahead_queue(int idx) {
+  receiver_lookahead.idx = -1;
+  receiver_lookahead.ready = false;
+  for (idx++; idx < btc_txn_context->metadata.output_count; idx++) {
+    if (false == btc_txn_context->outputs[idx].is_change) {
+      receiver_lookahead.idx = idx;
+      break;
+    }
+  }
+}
+
+static bool verify_each_receiver() {
   char title[20] = "";
   char value[100] = "";
   char address[100] = "";
+  bool status = true;
 
+  sched_add_task(
+      receiver_lookahead_task, SCHED_PRIO_LOW, BTC_LOOKAHEAD_SLICE_MS);
   for (int idx = 0; idx < btc_txn_context->metadata.output_count; idx++) {
     btc_sign_txn_output_t *output = &btc_txn_context->outputs[idx];
-    btc_sign_txn_output_script_pub_key_t *script = &output->script_pub_key;
     snprintf(title, sizeof(title), UI_TEXT_BTC_RECEIVER, (idx + 1));
 
     if (true == output->is_change) {
       // do not show the change outputs to user
       continue;
     }
-    format_value(output->value, value, sizeof(value));
-    int status = btc_get_script_pub_address(
-        script->bytes, script->size, address, sizeof(address));
-    if (1 > status) {
-      // send error status as value for unknown error
-      btc_send_error(ERROR_COMMON_ERROR_UNKNOWN_ERROR_TAG, status);
-      return false;
+    if (idx == receiver_lookahead.idx && receiver_lookahead.ready) {
+      memcpy(address, receiver_lookahead.address, sizeof(address));
+      memcpy(value, receiver_lookahead.value, sizeof(value));
+    } else {
+      format_value(output->value, value, sizeof(value));
+      if (!get_output_address(idx, address, sizeof(address))) {
+        status = false;
+        break;
+      }
     }
+    // the next receiver is rendered while this one is being read
+    receiver_lookahead_queue(idx);
     if (!core_scroll_page(title, address, btc_send_error) ||
         !core_scroll_page(title, value, btc_send_error)) {
+      status = false;
+      break;
+    }
+  }
+  sched_remove_task(receiver_lookahead_task);
+  receiver_lookahead.idx = -1;
+  receiver_lookahead.ready = false;
+  return status;
+}
+
+static bool verify_receiver_summary(uint16_t receiver_count) {
+  char value[100] = "";
+  char address[100] = "";
+  char digest_hex[2 * BTC_RECEIVERS_DIGEST_SHOWN + 1] = "";
+  char display[160] = "";
+  uint8_t digest[SHA256_DIGEST_LENGTH] = {0};
+  uint64_t total = 0;
+  SHA256_CTX sha_256_ctx = {0};
+
+  sha256_Init(&sha_256_ctx);
+  for (int idx = 0; idx < btc_txn_context->metadata.output_count; idx++) {
+    const btc_sign_txn_output_t *output = &btc_txn_context->outputs[idx];
+    if (true == output->is_change) {
+      continue;
+    }
+    if (!get_output_address(idx, address, sizeof(address))) {
+      return false;
+    }
+    if (total + output->value < total) {
+      btc_send_error(ERROR_COMMON_ERROR_CORRUPT_DATA_TAG,
+                     ERROR_DATA_FLOW_INVALID_DATA);
       return false;
     }
+    total += output->value;
+
+    uint8_t value_le[8] = {0};
+    for (uint8_t byte = 0; byte < sizeof(value_le); byte++) {
+      value_le[byte] = (uint8_t)(output->value >> (8 * byte));
+    }
+    sha256_Update(&sha_256_ctx, (const uint8_t *)address, strlen(address) + 1);
+    sha256_Update(&sha_256_ctx, value_le, sizeof(value_le));
+  }
+  sha256_Final(&sha_256_ctx, digest);
+
+  format_value(total, value, sizeof(value));
+  byte_array_to_hex_string(
+      digest, BTC_RECEIVERS_DIGEST_SHOWN, digest_hex, sizeof(digest_hex));
+  snprintf(display,
+           sizeof(display),
+           UI_TEXT_BTC_RECEIVERS_SUMMARY,
+           value,
+           receiver_count,
+           digest_hex);
+  if (!core_scroll_page(ui_text_btc_receivers, display, btc_send_error)) {
+    return false;
+  }
+
+  menu_init(ui_text_options_receivers_review,
+            NUMBER_OF_OPTIONS_RECEIVERS_REVIEW,
+            ui_text_btc_receivers,
+            true);
+  evt_status_t events = get_events(EVENT_CONFIG_UI, MAX_INACTIVITY_TIMEOUT);
+  if (true == events.p0_event.flag) {
+    // core will handle p0 events, exit now
+    return false;
+  }
+  if (UI_EVENT_REJECT == events.ui_event.event_type) {
+    btc_send_error(ERROR_COMMON_ERROR_USER_REJECTION_TAG,
+                   ERROR_USER_REJECTION_CONFIRMATION);
+    return false;
+  }
+
+  // second option drills down to the receivers one by one
+  if (2 == events.ui_event.list_selection) {
+    return verify_each_receiver();
+  }
+  return true;
+}
+
+static bool get_user_verification() {
+  char value[100] = "";
+  uint16_t receiver_count = 0;
+
+  for (int idx = 0; idx < btc_txn_context->metadata.output_count; idx++) {
+    if (false == btc_txn_context->outputs[idx].is_change) {
+      receiver_count++;
+    }
+  }
+
+  bool receivers_verified =
+      (is_summary_review_enabled() &&
+       BTC_SUMMARY_MIN_RECEIVERS <= receiver_count)
+          ? verify_receiver_summary(receiver_count)
+          : verify_each_receiver();
+  if (!receivers_verified) {
+    return false;
   }
 
   // calculate fee in various forms
@@ -548,71 +957,133 @@ static bool validate_change_address(const HDNode *acc_node) {
   return status;
 }
 
-static bool sign_input(scrip_sig_t *signatures) {
+static bool prepare_signing(HDNode *node) {
   uint8_t buffer[64] = {0};
-  HDNode node = {0};
-  HDNode t_node = {0};
-  bool status = false;
   const uint32_t *hd_path = btc_txn_context->init_info.derivation_path;
-  const ecdsa_curve *curve = get_curve_by_name(SECP256K1_NAME)->params;
+  SESSION_BENCH_ENTER(SESSION_PHASE_DERIVATION);
   if (!reconstruct_seed(
           btc_txn_context->init_info.wallet_id, buffer, btc_send_error)) {
     memzero(buffer, sizeof(buffer));
-    return status;
+    return false;
   }
 
   set_app_flow_status(BTC_SIGN_TXN_STATUS_SEED_GENERATED);
 
+  SESSION_BENCH_ENTER(SESSION_PHASE_HASHING);
   // populate hashes cache for segwit transaction types
   btc_segwit_init_cache(btc_txn_context);
-  if (!derive_hdnode_from_path(hd_path, 3, SECP256K1_NAME, buffer, &node) ||
-      false == validate_change_address(&node)) {
+  SESSION_BENCH_ENTER(SESSION_PHASE_DERIVATION);
+  if (!derive_hdnode_from_path(hd_path, 3, SECP256K1_NAME, buffer, node) ||
+      false == validate_change_address(node)) {
     btc_send_error(ERROR_COMMON_ERROR_CORRUPT_DATA_TAG,
                    ERROR_DATA_FLOW_INVALID_DATA);
-    memzero(&node, sizeof(HDNode));
+    memzero(node, sizeof(HDNode));
     memzero(buffer, sizeof(buffer));
-    return status;
+    return false;
   }
+  memzero(buffer, sizeof(buffer));
+  return true;
+}
 
-  status = true;
-  for (int idx = 0; idx < btc_txn_context->metadata.input_count; idx++) {
-    // generate the input digest and respective private key
-    status = btc_digest_input(btc_txn_context, idx, buffer);
-    memcpy(&t_node, &node, sizeof(HDNode));
-    hdnode_private_ckd(&t_node, btc_txn_context->inputs[idx].change_index);
-    hdnode_private_ckd(&t_node, btc_txn_context->inputs[idx].address_index);
-    hdnode_fill_public_key(&t_node);
-    ecdsa_sign_digest(
-        curve, t_node.private_key, buffer, signatures[idx].bytes, NULL, NULL);
-    signatures[idx].size = btc_sig_to_script_sig(
-        signatures[idx].bytes, t_node.public_key, signatures[idx].bytes);
-    if (0 == signatures[idx].size || false == status) {
-      // early exit as digest could not be calculated
-      btc_send_error(ERROR_COMMON_ERROR_UNKNOWN_ERROR_TAG, 1);
-      status = false;
-      break;
+static const btc_key_cache_entry_t *get_input_keys(
+    const HDNode *node,
+    const btc_txn_input_t *input) {
+  btc_key_cache_t *cache = &btc_txn_context->key_cache;
+  for (uint8_t idx = 0; idx < BTC_KEY_CACHE_SIZE; idx++) {
+    const btc_key_cache_entry_t *entry = &cache->entries[idx];
+    if (entry->filled && entry->change_index == input->change_index &&
+        entry->address_index == input->address_index) {
+      return entry;
     }
   }
-  memzero(&node, sizeof(HDNode));
+
+  if (!cache->change_node_filled ||
+      cache->change_index != input->change_index) {
+    memcpy(&cache->change_node, node, sizeof(HDNode));
+    hdnode_private_ckd(&cache->change_node, input->change_index);
+    cache->change_index = input->change_index;
+    cache->change_node_filled = true;
+  }
+
+  HDNode t_node = {0};
+  btc_key_cache_entry_t *entry = &cache->entries[cache->next_entry];
+  cache->next_entry = (cache->next_entry + 1) % BTC_KEY_CACHE_SIZE;
+  memcpy(&t_node, &cache->change_node, sizeof(HDNode));
+  hdnode_private_ckd(&t_node, input->address_index);
+  hdnode_fill_public_key(&t_node);
+  memcpy(entry->private_key, t_node.private_key, sizeof(entry->private_key));
+  memcpy(entry->public_key, t_node.public_key, sizeof(entry->public_key));
+  entry->change_index = input->change_index;
+  entry->address_index = input->address_index;
+  entry->filled = true;
   memzero(&t_node, sizeof(HDNode));
+  return entry;
+}
+
+static bool sign_input(const HDNode *node, int idx, scrip_sig_t *signature) {
+  uint8_t buffer[64] = {0};
+  bool status = false;
+  const ecdsa_curve *curve = get_curve_by_name(SECP256K1_NAME)->params;
+
+  // generate the input digest and respective private key
+  SESSION_BENCH_ENTER(SESSION_PHASE_HASHING);
+  status = btc_digest_input(btc_txn_context, idx, buffer);
+  SESSION_BENCH_ENTER(SESSION_PHASE_DERIVATION);
+  const btc_key_cache_entry_t *keys =
+      get_input_keys(node, &btc_txn_context->inputs[idx]);
+  SESSION_BENCH_ENTER(SESSION_PHASE_SIGNING);
+  ecdsa_sign_digest(
+      curve, keys->private_key, buffer, signature->bytes, NULL, NULL);
+  signature->size = btc_sig_to_script_sig(
+      signature->bytes, keys->public_key, signature->bytes);
+  SESSION_BENCH_ENTER(SESSION_PHASE_OTHER);
+  if (0 == signature->size || false == status) {
+    // digest could not be calculated
+    btc_send_error(ERROR_COMMON_ERROR_UNKNOWN_ERROR_TAG, 1);
+    status = false;
+  } else {
+    // inputs signed so far, answered to the status requests of the host
+    core_status_set_progress(CORE_PROGRESS_SIGN_INPUTS,
+                             idx + 1,
+                             btc_txn_context->metadata.input_count);
+  }
   memzero(buffer, sizeof(buffer));
   return status;
 }
 
-static bool send_script_sig(btc_query_t *query, const scrip_sig_t *sigs) {
+static bool send_script_sig(btc_query_t *query) {
+  HDNode node = {0};
+  bool status = false;
   btc_result_t result = init_btc_result(BTC_RESULT_SIGN_TXN_TAG);
+  scrip_sig_t *signature = &result.sign_txn.signature.signature;
   result.sign_txn.which_response = BTC_SIGN_TXN_RESPONSE_SIGNATURE_TAG;
 
+  if (!prepare_signing(&node) || !sign_input(&node, 0, signature)) {
+    memzero(&node, sizeof(HDNode));
+    memzero(&btc_txn_context->key_cache, sizeof(btc_key_cache_t));
+    return status;
+  }
+
+  status = true;
   for (int idx = 0; idx < btc_txn_context->metadata.input_count; idx++) {
     if (!btc_get_query(query, BTC_QUERY_SIGN_TXN_TAG) ||
         !check_which_request(query, BTC_SIGN_TXN_REQUEST_SIGNATURE_TAG)) {
-      return false;
+      status = false;
+      break;
     }
-    memcpy(
-        &result.sign_txn.signature.signature, &sigs[idx], sizeof(scrip_sig_t));
     btc_send_result(&result);
+
+    // sign the next input while host processes the current signature, unless
+    // the host aborted meanwhile
+    if (idx + 1 < btc_txn_context->metadata.input_count &&
+        (events_p0_pending() || !sign_input(&node, idx + 1, signature))) {
+      status = false;
+      break;
+    }
   }
-  return true;
+  memzero(&node, sizeof(HDNode));
+  memzero(&btc_txn_context->key_cache, sizeof(btc_key_cache_t));
+  return status;
 }
 
 /*****************************************************************************
@@ -620,25 +1091,15 @@ static bool send_script_sig(btc_query_t *query, const scrip_sig_t *sigs) {
  *****************************************************************************/
 
 void btc_sign_transaction(btc_query_t *query) {
-  btc_txn_context = (btc_txn_context_t *)malloc(sizeof(btc_txn_context_t));
-  memzero(btc_txn_context, sizeof(btc_txn_context_t));
-  scrip_sig_t signatures[TXN_MAX_INPUTS] = {0};
+  btc_txn_context = TXN_POOL_NEW(btc_txn_context_t, 1);
+  ASSERT(NULL != btc_txn_context);
 
   if (handle_initiate_query(query) && fetch_transaction_meta(query) &&
       fetch_valid_input(query) && fetch_valid_output(query) &&
-      get_user_verification() && sign_input(&signatures[0]) &&
-      send_script_sig(query, &signatures[0])) {
+      get_user_verification() && send_script_sig(query)) {
     delay_scr_init(ui_text_check_cysync, DELAY_TIME);
   }
 
-  if (NULL != btc_txn_context && NULL != btc_txn_context->inputs) {
-    free(btc_txn_context->inputs);
-  }
-  if (NULL != btc_txn_context && NULL != btc_txn_context->outputs) {
-    free(btc_txn_context->outputs);
-  }
-  if (NULL != btc_txn_context) {
-    free(btc_txn_context);
-    btc_txn_context = NULL;
-  }
+  txn_pool_release();
+  btc_txn_context = NULL;
 }
\ No newline at end of file
@@ -81,6 +81,31 @@
  * PRIVATE TYPEDEFS
  *****************************************************************************/
 
+/**
+ * Fields of a raw transaction in the order of serialization. The states marked
+ * (hashed) are part of the non-witness serialization which forms the txid.
+ */
+typedef enum {
+  VERIFY_STATE_VERSION = 0,     // (hashed)
+  VERIFY_STATE_MARKER,          // segwit marker or first byte of input count
+  VERIFY_STATE_FLAG,            // segwit flag
+  VERIFY_STATE_IN_COUNT,        // (hashed)
+  VERIFY_STATE_IN_OUTPOINT,     // (hashed)
+  VERIFY_STATE_IN_SCRIPT_LEN,   // (hashed)
+  VERIFY_STATE_IN_SCRIPT,       // (hashed)
+  VERIFY_STATE_IN_SEQUENCE,     // (hashed)
+  VERIFY_STATE_OUT_COUNT,       // (hashed)
+  VERIFY_STATE_OUT_VALUE,       // (hashed)
+  VERIFY_STATE_OUT_SCRIPT_LEN,  // (hashed)
+  VERIFY_STATE_OUT_SCRIPT,      // (hashed)
+  VERIFY_STATE_WITNESS_COUNT,
+  VERIFY_STATE_WITNESS_ITEM_LEN,
+  VERIFY_STATE_WITNESS_ITEM,
+  VERIFY_STATE_LOCKTIME,    // (hashed)
+  VERIFY_STATE_DONE,
+  VERIFY_STATE_ERROR,
+} btc_verify_state_e;
+
 /*****************************************************************************
  * STATIC FUNCTION PROTOTYPES
  *****************************************************************************/
@@ -93,7 +118,8 @@
  *          use a fixed size for script_sig in addition to the weight returned
  *          by this function. For P2SH & P2WSH, the function will give wrong
  *          results so we will re-evaluate this function when the support for
- *          those types is added. Refer:
+ *          those types is added. The inputs and outputs are taken from
+ *          the totals accumulated as they were accepted. Refer:
  *          https://github.com/bitcoin/bips/blob/master/bip-0141.mediawiki#transaction-size-calculations
  *          https://github.com/trezor/trezor-firmware/blob/f5983e7843f381423f30b8bc2ffc46e496775e5a/core/src/apps/bitcoin/sign_tx/tx_weight.py#L95
  *          https://github.com/trezor/trezor-firmware/blob/f5983e7843f381423f30b8bc2ffc46e496775e5a/common/protob/messages-bitcoin.proto#L357
@@ -117,14 +143,29 @@ STATIC uint32_t get_transaction_weight(const btc_txn_context_t *txn_ctx);
 STATIC bool digest_outputs(const btc_txn_context_t *context,
                            SHA256_CTX *sha_256_ctx);
 
+/**
+ * @brief Digests an input with an empty scriptSig, as serialized for legacy
+ * sighash of the other inputs of the transaction.
+ *
+ * @param input Reference to the input to digest
+ * @param sha_256_ctx Reference to the SHA256_CTX
+ */
+static void digest_blank_input(const btc_txn_input_t *input,
+                               SHA256_CTX *sha_256_ctx);
+
 /**
  * @brief Calculates digest for p2pkh according to the BIP definition
+ * @details The hasher state over the version, input count and blanked inputs
+ * preceding input_index is taken from context->legacy_cache and the cache is
+ * advanced past input_index. The remaining part (blanked inputs after
+ * input_index, outputs, locktime) has to be digested for every input as a
+ * SHA256 midstate can only be reused for a common prefix.
  *
  * @param context Reference to the bitcoin transaction context
  * @param index The index of the input to digest
  * @param digest Reference to a buffer to hold the calculated digest
  */
-STATIC void calculate_p2pkh_digest(const btc_txn_context_t *context,
+STATIC void calculate_p2pkh_digest(btc_txn_context_t *context,
                                    uint8_t input_index,
                                    uint8_t *digest);
 
@@ -144,6 +185,24 @@ STATIC bool calculate_p2wpkh_digest(const btc_txn_context_t *context,
                                     uint8_t input_index,
                                     uint8_t *digest);
 
+/**
+ * @brief Moves the verifier to the specified state which spans field_len bytes
+ */
+static void verify_set_state(btc_verify_input_t *ctx,
+                             btc_verify_state_e state,
+                             uint64_t field_len);
+
+/**
+ * @brief Moves the verifier past a list entry (input, output, witness) and
+ * selects the next field to parse
+ */
+static void verify_next_entry(btc_verify_input_t *ctx);
+
+/**
+ * @brief Handles a completely received field and selects the next field
+ */
+static void verify_field_complete(btc_verify_input_t *ctx);
+
 /*****************************************************************************
  * STATIC VARIABLES
  *****************************************************************************/
@@ -157,49 +216,41 @@ STATIC bool calculate_p2wpkh_digest(const btc_txn_context_t *context,
  *****************************************************************************/
 
 STATIC uint32_t get_transaction_weight(const btc_txn_context_t *txn_ctx) {
-  uint8_t segwit_count = 0;
+  const btc_txn_totals_t *totals = &txn_ctx->totals;
   uint32_t weight = 0;
 
   // TODO:Replace multiple instructions with single macro for weight
   weight += 4;    // network version size
   weight += 1;    // input count size
-
-  for (uint8_t input_index = 0; input_index < txn_ctx->metadata.input_count;
-       input_index++) {
-    weight += 32;    // previous transaction hash
-    weight += 4;     // previous output index
-    weight += 1;     // script length size
-    weight += 4;     // sequence
-                     // Check if current input is segwit or not
-    if (0 == txn_ctx->inputs[input_index].script_pub_key.bytes[0]) {
-      segwit_count++;
-    } else {
-      weight += EXPECTED_SCRIPT_SIG_SIZE;
-    }
-  }
-
   weight += 1;    // output count size
-
-  for (uint8_t output_index = 0; output_index < txn_ctx->metadata.output_count;
-       output_index++) {
-    weight += 8;    // value size
-    weight += 1;    //  script length size
-    weight += txn_ctx->outputs[output_index].script_pub_key.size;
-  }
-
-  weight += 4;            // locktime
+  weight += 4;    // locktime
+  weight += totals->base_size;    // accepted inputs and outputs
   weight = 4 * weight;    // As per standard non segwit transaction size is
                           // multiplied by 4
 
-  if (segwit_count > 0) {
+  if (totals->segwit_count > 0) {
     weight += 2;    // Segwit headers
     weight += (EXPECTED_SCRIPT_SIG_SIZE *
-               segwit_count);    // Adding sizes of all witnesses for all inputs
+               totals->segwit_count);    // Adding sizes of all witnesses
   }
 
   return weight;
 }
 
+static void digest_blank_input(const btc_txn_input_t *input,
+                               SHA256_CTX *sha_256_ctx) {
+  uint8_t buffer[5] = {0};
+
+  // digest Outpoint (input transaction hash, index)
+  sha256_Update(sha_256_ctx, input->prev_txn_hash, 32);
+  write_le(buffer, input->prev_output_index);
+  // empty scriptSig
+  buffer[4] = 0;
+  sha256_Update(sha_256_ctx, buffer, 5);
+  write_le(buffer, input->sequence);
+  sha256_Update(sha_256_ctx, buffer, 4);
+}
+
 STATIC bool digest_outputs(const btc_txn_context_t *context,
                            SHA256_CTX *sha_256_ctx) {
   uint8_t buffer[100] = {0};
@@ -217,45 +268,54 @@ STATIC bool digest_outputs(const btc_txn_context_t *context,
     sha256_Update(sha_256_ctx, buffer, 1);
     sha256_Update(sha_256_ctx, output->script_pub_key.bytes, buffer[0]);
   }
+  return true;
 }
 
-STATIC void calculate_p2pkh_digest(const btc_txn_context_t *context,
+STATIC void calculate_p2pkh_digest(btc_txn_context_t *context,
                                    const uint8_t input_index,
                                    uint8_t *digest) {
   uint8_t buffer[100] = {0};
   SHA256_CTX sha_256_ctx = {0};
+  btc_legacy_cache_t *cache = &context->legacy_cache;
+
+  if (!cache->filled || input_index < cache->next_index) {
+    // digest version and input count
+    sha256_Init(&cache->prefix);
+    write_le(buffer, context->metadata.version);
+    buffer[4] = context->metadata.input_count;
+    sha256_Update(&cache->prefix, buffer, 5);
+    cache->next_index = 0;
+    cache->filled = true;
+  }
 
-  memzero(&sha_256_ctx, sizeof(sha_256_ctx));
-  sha256_Init(&sha_256_ctx);
+  // catch up with the blanked inputs preceding input_index
+  for (; cache->next_index < input_index; cache->next_index++) {
+    digest_blank_input(&context->inputs[cache->next_index], &cache->prefix);
+  }
+  memcpy(&sha_256_ctx, &cache->prefix, sizeof(sha_256_ctx));
 
-  // digest version and input count
-  write_le(buffer, context->metadata.version);
-  buffer[4] = context->metadata.input_count;
-  sha256_Update(&sha_256_ctx, buffer, 5);
-
-  for (uint8_t idx = 0; idx < context->metadata.input_count; idx++) {
-    btc_txn_input_t *input = &context->inputs[idx];
-
-    // digest Outpoint (input transaction hash, index)
-    sha256_Update(&sha_256_ctx, input->prev_txn_hash, 32);
-    write_le(buffer, input->prev_output_index);
-    sha256_Update(&sha_256_ctx, buffer, 4);
-
-    if (input_index == idx) {
-      // TODO: use Compact size encoding here. Ref -
-      // https://developer.bitcoin.org/reference/transactions.html#compactsize-unsigned-integers
-      // digest the locking script to sign
-      buffer[0] = input->script_pub_key.size;
-      sha256_Update(&sha_256_ctx, buffer, 1);
-      sha256_Update(&sha_256_ctx, input->script_pub_key.bytes, buffer[0]);
-    } else {
-      // skip all the other Outpoints
-      buffer[0] = 0;
-      sha256_Update(&sha_256_ctx, buffer, 1);
-    }
+  btc_txn_input_t *input = &context->inputs[input_index];
+  // digest Outpoint (input transaction hash, index)
+  sha256_Update(&sha_256_ctx, input->prev_txn_hash, 32);
+  write_le(buffer, input->prev_output_index);
+  sha256_Update(&sha_256_ctx, buffer, 4);
+  // TODO: use Compact size encoding here. Ref -
+  // https://developer.bitcoin.org/reference/transactions.html#compactsize-unsigned-integers
+  // digest the locking script to sign
+  buffer[0] = input->script_pub_key.size;
+  sha256_Update(&sha_256_ctx, buffer, 1);
+  sha256_Update(&sha_256_ctx, input->script_pub_key.bytes, buffer[0]);
+  write_le(buffer, input->sequence);
+  sha256_Update(&sha_256_ctx, buffer, 4);
+
+  // advance the cache for the next input to be signed
+  digest_blank_input(input, &cache->prefix);
+  cache->next_index++;
 
-    write_le(buffer, input->sequence);
-    sha256_Update(&sha_256_ctx, buffer, 4);
+  // skip all the other Outpoints
+  for (uint8_t idx = input_index + 1; idx < context->metadata.input_count;
+       idx++) {
+    digest_blank_input(&context->inputs[idx], &sha_256_ctx);
   }
 
   buffer[0] = context->metadata.output_count;
@@ -328,10 +388,305 @@ STATIC bool calculate_p2wpkh_digest(const btc_txn_context_t *context,
   return true;
 }
 
+static void verify_set_state(btc_verify_input_t *ctx,
+                             btc_verify_state_e state,
+                             uint64_t field_len) {
+  ctx->state = state;
+  ctx->field_pos = 0;
+  ctx->field_len = field_len;
+  if (UINT32_MAX < field_len) {
+    // not possible in a valid transaction
+    ctx->state = VERIFY_STATE_ERROR;
+  }
+}
+
+static void verify_next_entry(btc_verify_input_t *ctx) {
+  switch (ctx->state) {
+    case VERIFY_STATE_IN_SCRIPT_LEN:
+    case VERIFY_STATE_IN_SCRIPT:
+      verify_set_state(ctx, VERIFY_STATE_IN_SEQUENCE, 4);
+      break;
+
+    case VERIFY_STATE_IN_SEQUENCE:
+      if (0 < --ctx->items_left) {
+        verify_set_state(ctx, VERIFY_STATE_IN_OUTPOINT, 36);
+      } else {
+        verify_set_state(ctx, VERIFY_STATE_OUT_COUNT, 1);
+      }
+      break;
+
+    case VERIFY_STATE_OUT_COUNT:
+    case VERIFY_STATE_OUT_SCRIPT_LEN:
+    case VERIFY_STATE_OUT_SCRIPT:
+      if (VERIFY_STATE_OUT_COUNT != ctx->state) {
+        ctx->output_index++;
+      }
+      if (ctx->output_index < ctx->output_count) {
+        verify_set_state(ctx, VERIFY_STATE_OUT_VALUE, 8);
+      } else if (ctx->segwit) {
+        ctx->witnesses_left = ctx->input_count;
+        verify_set_state(ctx, VERIFY_STATE_WITNESS_COUNT, 1);
+      } else {
+        verify_set_state(ctx, VERIFY_STATE_LOCKTIME, 4);
+      }
+      break;
+
+    case VERIFY_STATE_WITNESS_ITEM_LEN:
+    case VERIFY_STATE_WITNESS_ITEM:
+      if (0 < --ctx->items_left) {
+        verify_set_state(ctx, VERIFY_STATE_WITNESS_ITEM_LEN, 1);
+        break;
+      }
+      // fall through; all items of the current witness are parsed
+    case VERIFY_STATE_WITNESS_COUNT:
+      if (0 < --ctx->witnesses_left) {
+        verify_set_state(ctx, VERIFY_STATE_WITNESS_COUNT, 1);
+      } else {
+        verify_set_state(ctx, VERIFY_STATE_LOCKTIME, 4);
+      }
+      break;
+
+    default:
+      ctx->state = VERIFY_STATE_ERROR;
+      break;
+  }
+}
+
+static void verify_field_complete(btc_verify_input_t *ctx) {
+  uint64_t value = 0;
+
+  switch (ctx->state) {
+    case VERIFY_STATE_IN_COUNT:
+    case VERIFY_STATE_IN_SCRIPT_LEN:
+    case VERIFY_STATE_OUT_COUNT:
+    case VERIFY_STATE_OUT_SCRIPT_LEN:
+    case VERIFY_STATE_WITNESS_COUNT:
+    case VERIFY_STATE_WITNESS_ITEM_LEN: {
+      // CompactSize; extend the field to read the remaining bytes
+      const uint8_t prefix = ctx->field[0];
+      if (1 == ctx->field_len && 0xfd <= prefix) {
+        ctx->field_len += (0xfd == prefix ? 2 : (0xfe == prefix ? 4 : 8));
+        return;
+      }
+      if (0xfd > prefix) {
+        value = prefix;
+      } else {
+        for (uint8_t i = ctx->field_len - 1; i > 0; i--) {
+          value = (value << 8) | ctx->field[i];
+        }
+      }
+    } break;
+
+    default:
+      break;
+  }
+
+  switch (ctx->state) {
+    case VERIFY_STATE_VERSION:
+      verify_set_state(ctx, VERIFY_STATE_MARKER, 1);
+      break;
+
+    case VERIFY_STATE_MARKER:
+      if (0 == ctx->field[0]) {
+        ctx->segwit = true;
+        verify_set_state(ctx, VERIFY_STATE_FLAG, 1);
+      } else {
+        // not a segwit marker, it is the first byte of input count
+        sha256_Update(&ctx->sha_256_ctx, ctx->field, 1);
+        ctx->state = VERIFY_STATE_IN_COUNT;
+        verify_field_complete(ctx);
+      }
+      break;
+
+    case VERIFY_STATE_FLAG:
+      verify_set_state(ctx, VERIFY_STATE_IN_COUNT, 1);
+      break;
+
+    case VERIFY_STATE_IN_COUNT:
+      ctx->input_count = value;
+      ctx->items_left = value;
+      if (0 == value) {
+        ctx->state = VERIFY_STATE_ERROR;
+      } else {
+        verify_set_state(ctx, VERIFY_STATE_IN_OUTPOINT, 36);
+      }
+      break;
+
+    case VERIFY_STATE_IN_OUTPOINT:
+      verify_set_state(ctx, VERIFY_STATE_IN_SCRIPT_LEN, 1);
+      break;
+
+    case VERIFY_STATE_IN_SCRIPT_LEN:
+    case VERIFY_STATE_OUT_SCRIPT_LEN:
+    case VERIFY_STATE_WITNESS_ITEM_LEN:
+      if (VERIFY_STATE_OUT_SCRIPT_LEN == ctx->state &&
+          ctx->output_index == ctx->prev_output_index) {
+        ctx->found_script_len = (uint32_t)CY_MIN(value, UINT32_MAX);
+      }
+      if (0 < value) {
+        // script (or witness item) body follows its length
+        verify_set_state(ctx, ctx->state + 1, value);
+      } else {
+        verify_next_entry(ctx);
+      }
+      break;
+
+    case VERIFY_STATE_OUT_COUNT:
+      ctx->output_count = value;
+      ctx->output_index = 0;
+      if (NULL != ctx->values_count) {
+        *ctx->values_count = (value <= ctx->values_size) ? (uint32_t)value : 0;
+      }
+      verify_next_entry(ctx);
+      break;
+
+    case VERIFY_STATE_OUT_VALUE:
+      if (ctx->output_index == ctx->prev_output_index) {
+        // only check the specified output index as we are looking for an exact
+        // match; remember the value & compare later
+        ctx->value_found = true;
+        ctx->found_value = U64_READ_LE_ARRAY(ctx->field);
+      }
+      if (NULL != ctx->values && ctx->output_count <= ctx->values_size) {
+        ctx->values[ctx->output_index] = U64_READ_LE_ARRAY(ctx->field);
+      }
+      verify_set_state(ctx, VERIFY_STATE_OUT_SCRIPT_LEN, 1);
+      break;
+
+    case VERIFY_STATE_WITNESS_COUNT:
+      ctx->items_left = value;
+      if (0 < value) {
+        verify_set_state(ctx, VERIFY_STATE_WITNESS_ITEM_LEN, 1);
+      } else {
+        verify_next_entry(ctx);
+      }
+      break;
+
+    case VERIFY_STATE_IN_SCRIPT:
+    case VERIFY_STATE_IN_SEQUENCE:
+    case VERIFY_STATE_OUT_SCRIPT:
+    case VERIFY_STATE_WITNESS_ITEM:
+      verify_next_entry(ctx);
+      break;
+
+    case VERIFY_STATE_LOCKTIME:
+      ctx->state = VERIFY_STATE_DONE;
+      break;
+
+    default:
+      ctx->state = VERIFY_STATE_ERROR;
+      break;
+  }
+}
+
 /*****************************************************************************
  * GLOBAL FUNCTIONS
  *****************************************************************************/
 
+void btc_verify_input_init(btc_verify_input_t *ctx,
+                           const uint8_t *prev_txn_hash,
+                           const uint32_t prev_output_index,
+                           const uint64_t value) {
+  memzero(ctx, sizeof(btc_verify_input_t));
+  sha256_Init(&ctx->sha_256_ctx);
+  memcpy(ctx->prev_txn_hash, prev_txn_hash, sizeof(ctx->prev_txn_hash));
+  ctx->prev_output_index = prev_output_index;
+  ctx->value = value;
+  verify_set_state(ctx, VERIFY_STATE_VERSION, 4);
+}
+
+void btc_verify_input_record_values(btc_verify_input_t *ctx,
+                                    uint64_t *values,
+                                    uint32_t values_size,
+                                    uint32_t *count) {
+  ctx->values = values;
+  ctx->values_size = values_size;
+  ctx->values_count = count;
+  *count = 0;
+}
+
+bool btc_verify_input_update(btc_verify_input_t *ctx,
+                             const uint8_t *data,
+                             uint32_t size) {
+  while (0 < size && VERIFY_STATE_DONE > ctx->state) {
+    uint32_t length = ctx->field_len - ctx->field_pos;
+    if (length > size) {
+      length = size;
+    }
+
+    switch (ctx->state) {
+      case VERIFY_STATE_MARKER:
+      case VERIFY_STATE_FLAG:
+      case VERIFY_STATE_WITNESS_COUNT:
+      case VERIFY_STATE_WITNESS_ITEM_LEN:
+      case VERIFY_STATE_WITNESS_ITEM:
+        // not part of the txid serialization
+        break;
+
+      default:
+        sha256_Update(&ctx->sha_256_ctx, data, length);
+        break;
+    }
+    if (sizeof(ctx->field) >= ctx->field_len) {
+      memcpy(ctx->field + ctx->field_pos, data, length);
+    }
+    if (VERIFY_STATE_OUT_SCRIPT == ctx->state &&
+        ctx->output_index == ctx->prev_output_index &&
+        sizeof(ctx->found_script) >= ctx->field_len) {
+      memcpy(ctx->found_script + ctx->field_pos, data, length);
+    }
+
+    ctx->field_pos += length;
+    data += length;
+    size -= length;
+    if (ctx->field_pos == ctx->field_len) {
+      verify_field_complete(ctx);
+    }
+  }
+
+  // trailing bytes after locktime are also treated as malformed data
+  return (0 == size && VERIFY_STATE_ERROR != ctx->state);
+}
+
+int btc_verify_input_final(btc_verify_input_t *ctx) {
+  uint8_t hash[SHA256_DIGEST_LENGTH] = {0};
+  int status = 0;
+
+  if (VERIFY_STATE_DONE != ctx->state) {
+    status = 4;
+  } else if (!ctx->value_found) {
+    status = 1;
+  } else {
+    sha256_Final(&ctx->sha_256_ctx, hash);
+    sha256_Raw(hash, sizeof(hash), hash);
+    // verify input txn hash
+    if (memcmp(hash, ctx->prev_txn_hash, sizeof(ctx->prev_txn_hash)) != 0) {
+      status = 2;
+    } else if (ctx->found_value != ctx->value) {
+      status = 3;
+    }
+  }
+  memzero(ctx, sizeof(btc_verify_input_t));
+  return status;
+}
+
+int btc_verify_input_final_utxo(btc_verify_input_t *ctx,
+                                uint64_t *value,
+                                uint8_t *script,
+                                uint16_t *script_len) {
+  if (VERIFY_STATE_DONE != ctx->state ||
+      sizeof(ctx->found_script) < ctx->found_script_len) {
+    memzero(ctx, sizeof(btc_verify_input_t));
+    return 4;
+  }
+
+  *value = ctx->found_value;
+  *script_len = ctx->found_script_len;
+  memcpy(script, ctx->found_script, ctx->found_script_len);
+  ctx->value = ctx->found_value;
+  return btc_verify_input_final(ctx);
+}
+
 int btc_verify_input(const uint8_t *raw_txn,
                      const uint32_t size,
                      const btc_sign_txn_input_t *input) {
@@ -339,57 +694,46 @@ int btc_verify_input(const uint8_t *raw_txn,
     return -1;
   }
 
-  uint8_t hash[SHA256_DIGEST_LENGTH] = {0};
-  int32_t offset = 0;
-  int32_t count = 0;
-  int32_t value_offset = 0;
-  int32_t start_offset = 0;
-  uint8_t txn_data[size];
-
-  // ignore network version (4-bytes), skip marker & flag (in segwit)
-  offset += (raw_txn[4] == 0 ? 6 : 4);
-  start_offset = offset;
-  // remember the number of inputs in the raw_txn
-  count = raw_txn[offset++];
-
-  for (int32_t input_index = 0; input_index < count; input_index++) {
-    offset += 36;
-    offset += (raw_txn[offset] + 1 + 4);
-  }
-  // remember the number of outputs in the raw_txn
-  count = raw_txn[offset++];
-  for (int32_t output_index = 0; output_index < count; output_index++) {
-    if (output_index == input->prev_output_index) {
-      // only check the specified output index as we are looking for an exact
-      // match; remember the location of value in the raw_txn & compare later
-      value_offset = offset;
-
-      // NOTE: do not break here, the 'offset' should traverse till the end
-    }
-    offset += 8;
-    offset += (raw_txn[offset] + 1);
-  }
+  btc_verify_input_t ctx = {0};
+  btc_verify_input_init(
+      &ctx, input->prev_txn_hash, input->prev_output_index, input->value);
+  btc_verify_input_update(&ctx, raw_txn, size);
+  return btc_verify_input_final(&ctx);
+}
 
-  if (value_offset == 0) {
-    return 1;
+void btc_txn_account_input(btc_txn_context_t *txn_ctx,
+                           const btc_txn_input_t *input) {
+  btc_txn_totals_t *totals = &txn_ctx->totals;
+
+  totals->base_size += 32;    // previous transaction hash
+  totals->base_size += 4;     // previous output index
+  totals->base_size += 1;     // script length size
+  totals->base_size += 4;     // sequence
+  if (SCRIPT_TYPE_P2WPKH == input->script_type ||
+      SCRIPT_TYPE_P2WSH == input->script_type) {
+    totals->segwit_count++;
+  } else {
+    totals->base_size += EXPECTED_SCRIPT_SIG_SIZE;
   }
 
-  // network version (first 4 bytes)
-  memcpy(txn_data, raw_txn, 4);
-  // txin and txout (skip marker & flag)
-  memcpy(txn_data + 4, raw_txn + start_offset, offset - start_offset);
-  // locktime (last 4 bytes)
-  memcpy(txn_data + offset - start_offset + 4, raw_txn + size - 4, 4);
-  sha256_Raw(txn_data, offset - start_offset + 4 + 4, hash);
-  sha256_Raw(hash, sizeof(hash), hash);
-  // verify input txn hash
-  if (memcmp(hash, input->prev_txn_hash, sizeof(input->prev_txn_hash)) != 0) {
-    return 2;
+  if (UINT64_MAX - totals->input_value < input->value) {
+    totals->overflow = true;
   }
-  if (U64_READ_LE_ARRAY(raw_txn + value_offset) != input->value) {
-    return 3;
+  totals->input_value += input->value;
+}
+
+void btc_txn_account_output(btc_txn_context_t *txn_ctx,
+                            const btc_sign_txn_output_t *output) {
+  btc_txn_totals_t *totals = &txn_ctx->totals;
+
+  totals->base_size += 8;    // value size
+  totals->base_size += 1;    // script length size
+  totals->base_size += output->script_pub_key.size;
+
+  if (UINT64_MAX - totals->output_value < output->value) {
+    totals->overflow = true;
   }
-  return 0;
+  totals->output_value += output->value;
 }
 
 uint64_t get_transaction_fee_threshold(const btc_txn_context_t *txn_ctx) {
@@ -401,24 +745,15 @@ bool btc_get_txn_fee(const btc_txn_context_t *txn_ctx, uint64_t *fee) {
     return false;
   }
 
-  uint64_t input = 0;
-  uint64_t output = 0;
+  const btc_txn_totals_t *totals = &txn_ctx->totals;
   *fee = UINT64_MAX;
 
-  for (int idx = 0; idx < txn_ctx->metadata.input_count; idx++) {
-    input += txn_ctx->inputs[idx].value;
-  }
-
-  for (int idx = 0; idx < txn_ctx->metadata.output_count; idx++) {
-    output += txn_ctx->outputs[idx].value;
-  }
-
-  if (input < output) {
+  if (totals->overflow || totals->input_value < totals->output_value) {
     // case of an overspending transaction
     return false;
   }
 
-  *fee = (input - output);
+  *fee = (totals->input_value - totals->output_value);
   return true;
 }
 
@@ -459,14 +794,12 @@ void btc_segwit_init_cache(btc_txn_context_t *context) {
   memzero(&sha_256_ctx, sizeof(sha_256_ctx));
 }
 
-bool btc_digest_input(const btc_txn_context_t *context,
+bool btc_digest_input(btc_txn_context_t *context,
                       const uint32_t index,
                       uint8_t *digest) {
   bool status = true;
-  // detect input type and calculate appropriate digest
-  btc_sign_txn_input_script_pub_key_t *script =
-      &context->inputs[index].script_pub_key;
-  btc_script_type_e type = btc_get_script_type(script->bytes, script->size);
+  // calculate appropriate digest for the input type detected at ingest
+  const btc_script_type_e type = context->inputs[index].script_type;
 
   if (SCRIPT_TYPE_P2WPKH == type) {
     // segwit digest calculation; could fail if segwit_cache not filled
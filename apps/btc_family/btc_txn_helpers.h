@@ -21,10 +21,51 @@
  *****************************************************************************/
 #define EXPECTED_SCRIPT_SIG_SIZE 106
 
+/// Largest script of the spent output kept by btc_verify_input_t; fits the
+/// standard output scripts, up to an 80 byte OP_RETURN
+#define BTC_VERIFY_MAX_SCRIPT_SIZE 83
+
 /*****************************************************************************
  * TYPEDEFS
  *****************************************************************************/
 
+/**
+ * @brief Streaming verifier for a raw (previous) transaction
+ * @details The raw transaction is parsed as it is fed and the non-witness
+ * serialization is digested directly into the hasher. Hence, the raw
+ * transaction can be received in chunks of any size and need not be held in
+ * memory. Refer @ref btc_verify_input_init for usage.
+ */
+typedef struct {
+  SHA256_CTX sha_256_ctx;
+  // expected details of the input, taken from btc_sign_txn_input_t
+  uint8_t prev_txn_hash[32];
+  uint32_t prev_output_index;
+  uint64_t value;
+
+  // parser state
+  uint8_t state;
+  uint8_t field[9];
+  uint32_t field_len;
+  uint32_t field_pos;
+  bool segwit;
+  uint64_t input_count;
+  uint64_t items_left;
+  uint64_t witnesses_left;
+  uint64_t output_count;
+  uint64_t output_index;
+
+  bool value_found;
+  uint64_t found_value;
+  uint8_t found_script[BTC_VERIFY_MAX_SCRIPT_SIZE];
+  uint32_t found_script_len;
+
+  // optional record of every output value, see btc_verify_input_record_values
+  uint64_t *values;
+  uint32_t values_size;
+  uint32_t *values_count;
+} btc_verify_input_t;
+
 /*****************************************************************************
  * EXPORTED VARIABLES
  *****************************************************************************/
@@ -33,6 +74,85 @@
  * GLOBAL FUNCTION PROTOTYPES
  *****************************************************************************/
 
+/**
+ * @brief Initializes the streaming verifier of the raw transaction referred by
+ * the input
+ * @details Feed the raw transaction with @ref btc_verify_input_update (in any
+ * number of chunks) and conclude with @ref btc_verify_input_final.
+ *
+ * @param [out] ctx     Reference to the verifier context
+ * @param [in] prev_txn_hash      Expected hash of the raw transaction
+ * @param [in] prev_output_index  Index of the output being spent
+ * @param [in] value              Expected value of the output being spent
+ */
+void btc_verify_input_init(btc_verify_input_t *ctx,
+                           const uint8_t *prev_txn_hash,
+                           uint32_t prev_output_index,
+                           uint64_t value);
+
+/**
+ * @brief Makes the verifier record the value of every output of the raw
+ * transaction, eg. to check later inputs spending other outputs of it
+ * @details Call right after @ref btc_verify_input_init. The record is only
+ * meaningful once @ref btc_verify_input_final succeeds.
+ *
+ * @param ctx Reference to the verifier context
+ * @param [out] values  Storage for the output values, in order
+ * @param values_size   Number of values fitting in values
+ * @param [out] count   Number of outputs of the raw transaction; 0 if they do
+ * not fit in values, in which case nothing is recorded
+ */
+void btc_verify_input_record_values(btc_verify_input_t *ctx,
+                                    uint64_t *values,
+                                    uint32_t values_size,
+                                    uint32_t *count);
+
+/**
+ * @brief Parses & digests the next chunk of the raw transaction
+ *
+ * @param ctx Reference to the verifier context
+ * @param [in] data Next bytes of the raw transaction
+ * @param [in] size Number of bytes in data
+ *
+ * @return bool Indicating if the bytes so far form a well-formed transaction
+ * @retval false If the data is malformed or extends past the locktime
+ */
+bool btc_verify_input_update(btc_verify_input_t *ctx,
+                             const uint8_t *data,
+                             uint32_t size);
+
+/**
+ * @brief Concludes the verification of the fed raw transaction
+ *
+ * @param ctx Reference to the verifier context
+ *
+ * @return int Result of verification, same as @ref btc_verify_input
+ * @retval 4 If the raw transaction is malformed or incomplete
+ */
+int btc_verify_input_final(btc_verify_input_t *ctx);
+
+/**
+ * @brief Concludes the verification of a raw transaction whose spent output
+ * is not known beforehand, eg. the non-witness UTXO of a PSBT input
+ * @details The verifier is expected to be initialized with a value of 0; the
+ * value and the script of the spent output are taken from the raw transaction
+ * and only the hash is verified.
+ *
+ * @param ctx Reference to the verifier context
+ * @param [out] value       Value of the spent output
+ * @param [out] script      Buffer of BTC_VERIFY_MAX_SCRIPT_SIZE bytes for the
+ * script of the spent output
+ * @param [out] script_len  Length of the script
+ *
+ * @return int Result of verification, same as @ref btc_verify_input
+ * @retval 4 If the raw transaction is malformed or incomplete, or the script of
+ * the spent output exceeds BTC_VERIFY_MAX_SCRIPT_SIZE
+ */
+int btc_verify_input_final_utxo(btc_verify_input_t *ctx,
+                                uint64_t *value,
+                                uint8_t *script,
+                                uint16_t *script_len);
+
 /**
  * @brief Verifies the provided input with its related raw transaction byte
  * @details The function verifies if the input details match with the details in
@@ -50,16 +170,38 @@
  * @retval 1 If specified output index (input->prev_output_index) is not present
  * @retval 2 If there is a hash (input->prev_txn_hash) mismatch
  * @retval 3 If there is a value (input->value) mismatch
+ * @retval 4 If the raw transaction is malformed or incomplete
  */
 int btc_verify_input(const uint8_t *raw_txn,
                      uint32_t size,
                      const btc_sign_txn_input_t *input);
 
+/**
+ * @brief Adds an accepted input to the totals of the transaction
+ * @details The script type of the input must be set.
+ *
+ * @param txn_ctx Reference to an instance of btc_txn_context_t
+ * @param input Input accepted
+ */
+void btc_txn_account_input(btc_txn_context_t *txn_ctx,
+                           const btc_txn_input_t *input);
+
+/**
+ * @brief Adds an accepted output to the totals of the transaction
+ *
+ * @param txn_ctx Reference to an instance of btc_txn_context_t
+ * @param output Output accepted
+ */
+void btc_txn_account_output(btc_txn_context_t *txn_ctx,
+                            const btc_sign_txn_output_t *output);
+
 /**
  * @brief Calculates an estimated upper cap on the transaction fee.
  * @details The function calculates the fee according to the assumed upper cap
  * of coin.max_fee per kb. This function is only providing the threshold value
  * of transaction fee above which, user should be prompted with a warning.
+ * The weight is taken from the totals of btc_txn_account_input() and
+ * btc_txn_account_output().
  *
  * @param txn_ctx Instance of btc_txn_context_t
  *
@@ -74,7 +216,9 @@ uint64_t get_transaction_fee_threshold(const btc_txn_context_t *txn_ctx);
  * @details The function calculates transaction fee in its smallest
  * unit/denomination (satoshi). If the case of overspending is observed, then
  * the result UINT64_MAX is stored at the location. In such a case, the value
- * should not be used as this is an errornous transaction.
+ * should not be used as this is an errornous transaction. The values are taken
+ * from the totals of btc_txn_account_input() and btc_txn_account_output(),
+ * which also flag a wrapping sum as an inconsistency.
  *
  * @param [in] utxn_ptr     Immutable reference to btc_txn_context_t instance.
  * @param [out] txn_ctx     Storage for the calculated fee
@@ -105,7 +249,10 @@ void btc_segwit_init_cache(btc_txn_context_t *context);
  * @details The function prepares digest in conformation to the BIP definitions
  * for each of the input type. Currently, the function supports only 2 types of
  * input namely, P2PKH & P2WPKH. The prepared digest can be signed by a valid
- * private key to spend the input.
+ * private key to spend the input. The input type is taken from the
+ * script_type classified when the input was fetched. Digesting P2PKH inputs
+ * in increasing order of index reuses the legacy_cache midstate of the
+ * preceding inputs.
  *
  * @param context Reference to the bitcoin transaction context
  * @param index The index for the input to digest
@@ -116,7 +263,7 @@ void btc_segwit_init_cache(btc_txn_context_t *context);
  * @retval false If the digest was not calculated. This could be because the
  * segwit cache is not filed or the input type is other than P2PKH and P2WPKH.
  */
-bool btc_digest_input(const btc_txn_context_t *context,
+bool btc_digest_input(btc_txn_context_t *context,
                       uint32_t index,
                       uint8_t *digest);
 
@@ -115,6 +115,13 @@ static bool check_which_request(const btc_query_t *query,
  */
 static bool validate_request_data(btc_get_xpubs_request_t *request);
 
+/**
+ * @brief Accessor of the derivation paths for @ref hd_path_sort_order
+ */
+static const uint32_t *get_derivation_path(const void *paths,
+                                           size_t index,
+                                           size_t *path_length);
+
 /**
  * @brief Derives a list of xpubs corresponding to the provided list of
  * derivation paths.
@@ -207,24 +214,39 @@ static bool validate_request_data(btc_get_xpubs_request_t *request) {
   return status;
 }
 
+static const uint32_t *get_derivation_path(const void *paths,
+                                           size_t index,
+                                           size_t *path_length) {
+  const btc_get_xpub_derivation_path_t *path =
+      (const btc_get_xpub_derivation_path_t *)paths + index;
+  *path_length = path->path_count;
+  return path->path;
+}
+
 static bool one_shot_xpub_generate(const btc_get_xpub_derivation_path_t *paths,
                                    const uint8_t *seed,
                                    char xpubs[][XPUB_SIZE],
                                    pb_size_t count) {
-  for (pb_size_t index = 0; index < count; index++) {
-    const btc_get_xpub_derivation_path_t *path = &paths[index];
+  hd_path_cache_t cache = {0};
+  uint16_t order[pb_arraysize(btc_get_xpubs_intiate_request_t,
+                              derivation_paths)] = {0};
+  bool status = true;
+
+  // derive in sorted order so that shared path prefixes are derived once
+  hd_path_cache_init(&cache, SECP256K1_NAME, seed);
+  hd_path_sort_order(paths, count, get_derivation_path, order);
+  for (pb_size_t index = 0; index < count && status; index++) {
+    const btc_get_xpub_derivation_path_t *path = &paths[order[index]];
     uint32_t xpub_ver = 0;
-    if (!btc_get_version(path->path[0], &xpub_ver) ||
-        !btc_generate_xpub(path->path,
-                           path->path_count,
-                           SECP256K1_NAME,
-                           seed,
-                           xpub_ver,
-                           xpubs[index])) {
-      return false;
-    }
+    status = btc_get_version(path->path[0], &xpub_ver) &&
+             btc_generate_xpub_cached(&cache,
+                                      path->path,
+                                      path->path_count,
+                                      xpub_ver,
+                                      xpubs[order[index]]);
   }
-  return true;
+  hd_path_cache_clear(&cache);
+  return status;
 }
 
 static bool send_xpubs(btc_query_t *query,
@@ -81,17 +81,6 @@
  * STATIC FUNCTION PROTOTYPES
  *****************************************************************************/
 
-/**
- * @brief Check if the purpose index is supported by the Dogecoin app.
- *
- * @param purpose_index The purpose index to be checked
- *
- * @return bool Indicates if the provided purpose index is supported
- * @retval true The provided purpose index is supported
- * @retval false The provided purpose index is not supported
- */
-static bool is_purpose_supported(uint32_t purpose_index);
-
 /*****************************************************************************
  * STATIC VARIABLES
  *****************************************************************************/
@@ -116,7 +105,7 @@ const btc_config_t doge_app_config = {
 
     .max_fee = 1200000000000,
 
-    .is_purpose_supported = is_purpose_supported,
+    .supported_purposes = BTC_PURPOSE_FLAG_LEGACY,
 };
 
 static const cy_app_desc_t doge_app_desc = {.id = 5,
@@ -137,13 +126,6 @@ static const cy_app_desc_t doge_app_desc = {.id = 5,
  * STATIC FUNCTIONS
  *****************************************************************************/
 
-static bool is_purpose_supported(uint32_t purpose_index) {
-  if (PURPOSE_LEGACY != purpose_index) {
-    return false;
-  }
-  return true;
-}
-
 /*****************************************************************************
  * GLOBAL FUNCTIONS
  *****************************************************************************/
@@ -81,17 +81,6 @@
  * STATIC FUNCTION PROTOTYPES
  *****************************************************************************/
 
-/**
- * @brief Check if the purpose index is supported by the Litecoin app.
- *
- * @param purpose_index The purpose index to be checked
- *
- * @return bool Indicates if the provided purpose index is supported
- * @retval true The provided purpose index is supported
- * @retval false The provided purpose index is not supported
- */
-static bool is_purpose_supported(uint32_t purpose_index);
-
 /*****************************************************************************
  * STATIC VARIABLES
  *****************************************************************************/
@@ -116,7 +105,8 @@ const btc_config_t ltc_app_config = {
 
     .max_fee = 67000000,
 
-    .is_purpose_supported = is_purpose_supported,
+    .supported_purposes = BTC_PURPOSE_FLAG_LEGACY | BTC_PURPOSE_FLAG_SEGWIT |
+                          BTC_PURPOSE_FLAG_NSEGWIT,
 };
 
 static const cy_app_desc_t ltc_app_desc = {.id = 4,
@@ -137,14 +127,6 @@ static const cy_app_desc_t ltc_app_desc = {.id = 4,
  * STATIC FUNCTIONS
  *****************************************************************************/
 
-static bool is_purpose_supported(uint32_t purpose_index) {
-  if (PURPOSE_LEGACY != purpose_index && PURPOSE_SEGWIT != purpose_index &&
-      PURPOSE_NSEGWIT != purpose_index) {
-    return false;
-  }
-  return true;
-}
-
 /*****************************************************************************
  * GLOBAL FUNCTIONS
  *****************************************************************************/
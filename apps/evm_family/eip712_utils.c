@@ -128,6 +128,82 @@ void fill_string_with_data(const evm_sign_typed_data_node_t *data_node,
   snprintf(output, output_size, "%s: %s", data_node->struct_name, buffer);
 }
 
+static void push_frame(const evm_sign_typed_data_node_t *data_node,
+                       size_t members,
+                       eip712_frame_t *frame) {
+  frame->node = data_node;
+  frame->next_child = 0;
+  frame->members = members;
+  keccak_256_Init(&frame->ctx);
+  if (data_node->type == EVM_EIP_712_DATA_TYPE_STRUCT)
+    keccak_Update(
+        &frame->ctx, data_node->type_hash->bytes, data_node->type_hash->size);
+}
+
+static int absorb_leaf(const evm_sign_typed_data_node_t *data_node,
+                       SHA3_CTX *ctx) {
+  uint8_t encoded[HASH_SIZE] = {0};
+  size_t dummy = 0;
+  int status = encode_data(data_node, encoded, sizeof(encoded), &dummy);
+  if (status == EIP712_OK)
+    keccak_Update(ctx, encoded, sizeof(encoded));
+  return status;
+}
+
+/**
+ * Hashes a struct (hashStruct) or an array (keccak of the concatenated element
+ * encodings) without recursion or heap usage. Each open struct/array owns a
+ * frame whose keccak context absorbs the 32-byte encoding of every child as
+ * soon as it is available; a completed frame is absorbed into its parent.
+ * Not re-entrant as the frames are static; encode_data is only invoked for the
+ * leaf members here.
+ */
+static int hash_node(const evm_sign_typed_data_node_t *data_node,
+                     uint8_t *output) {
+  static eip712_frame_t frames[EIP712_MAX_DEPTH];
+  uint8_t digest[HASH_SIZE] = {0};
+  size_t depth = 0;
+
+  if (data_node->type == EVM_EIP_712_DATA_TYPE_STRUCT &&
+      data_node->type_hash == NULL)
+    return EIP712_INVALID_DATA;
+  push_frame(data_node, data_node->children_count, &frames[depth++]);
+
+  while (depth > 0) {
+    eip712_frame_t *frame = &frames[depth - 1];
+
+    if (frame->next_child < frame->members) {
+      const evm_sign_typed_data_node_t *child =
+          &frame->node->children[frame->next_child++];
+
+      if (child->type == EVM_EIP_712_DATA_TYPE_STRUCT ||
+          child->type == EVM_EIP_712_DATA_TYPE_ARRAY) {
+        if (depth >= EIP712_MAX_DEPTH)
+          return EIP712_MEMORY_LIMIT_EXCEEDED;
+        if (child->type == EVM_EIP_712_DATA_TYPE_STRUCT &&
+            child->type_hash == NULL)
+          return EIP712_INVALID_DATA;
+        push_frame(child, child->children_count, &frames[depth++]);
+        continue;
+      }
+
+      int status = absorb_leaf(child, &frame->ctx);
+      if (status != EIP712_OK)
+        return status;
+      continue;
+    }
+
+    keccak_Final(&frame->ctx, digest);
+    depth--;
+    if (depth == 0)
+      memcpy(output, digest, HASH_SIZE);
+    else
+      keccak_Update(&frames[depth - 1].ctx, digest, sizeof(digest));
+  }
+
+  return EIP712_OK;
+}
+
 int encode_data(const evm_sign_typed_data_node_t *data_node,
                 uint8_t *output,
                 const size_t output_size,
@@ -196,59 +272,32 @@ int encode_data(const evm_sign_typed_data_node_t *data_node,
         *bytes_written += HASH_SIZE;
         break;
       case EVM_EIP_712_DATA_TYPE_ARRAY: {
-        size_t result_size = data_node->children_count * HASH_SIZE;
-        uint8_t *result = malloc(result_size);
-        if (result == NULL)
-          return EIP712_MEMORY_ALLOCATION_FAILED;
-        memzero(result, result_size);
-        int status = EIP712_OK;
-        size_t dummy = 0;
-        for (int i = 0; i < data_node->children_count; i++) {
-          if (data_node->children[i].type == EVM_EIP_712_DATA_TYPE_STRUCT)
-            status =
-                hash_struct(&data_node->children[i], result + i * HASH_SIZE);
-          else
-            status = encode_data(&data_node->children[i],
-                                 result + i * HASH_SIZE,
-                                 HASH_SIZE,
-                                 &dummy);
-          if (status != EIP712_OK) {
-            free(result);
-            return status;
-          }
-        }
-        keccak_256(result, result_size, output);
+        int status = hash_node(data_node, output);
+        if (status != EIP712_OK)
+          return status;
         *bytes_written += HASH_SIZE;
-        free(result);
       } break;
       case EVM_EIP_712_DATA_TYPE_STRUCT: {
         size_t result_size = data_node->children_count * HASH_SIZE;
         if (result_size > output_size)
           return EIP712_MEMORY_LIMIT_EXCEEDED;
-        uint8_t *result = malloc(result_size);
-        if (result == NULL)
-          return EIP712_MEMORY_ALLOCATION_FAILED;
-        memzero(result, result_size);
+        memzero(output, result_size);
         int status = EIP712_OK;
         size_t dummy = 0;
         for (int i = 0; i < data_node->children_count; i++) {
           if (data_node->children[i].type == EVM_EIP_712_DATA_TYPE_STRUCT)
             status =
-                hash_struct(&data_node->children[i], result + i * HASH_SIZE);
+                hash_struct(&data_node->children[i], output + i * HASH_SIZE);
           else
             status = encode_data(&data_node->children[i],
-                                 result + i * HASH_SIZE,
+                                 output + i * HASH_SIZE,
                                  HASH_SIZE,
                                  &dummy);
 
-          if (status != EIP712_OK) {
-            free(result);
+          if (status != EIP712_OK)
             return status;
-          }
         }
-        memcpy(output, result, result_size);
         *bytes_written += result_size;
-        free(result);
       } break;
 
       default:
@@ -262,15 +311,67 @@ int encode_data(const evm_sign_typed_data_node_t *data_node,
 int hash_struct(const evm_sign_typed_data_node_t *data_node, uint8_t *output) {
   if (data_node->type != EVM_EIP_712_DATA_TYPE_STRUCT)
     return EIP712_INVALID_DATA;
-  size_t data_size = HASH_SIZE + (data_node->children_count) * HASH_SIZE;
-  size_t used_size = 0;
-  uint8_t *data = malloc(data_size);
-  memcpy(data, data_node->type_hash->bytes, data_node->type_hash->size);
-  int status = encode_data(data_node,
-                           data + data_node->type_hash->size,
-                           (data_size - data_node->type_hash->size),
-                           &used_size);
-  keccak_256(data, data_size, output);
-  free(data);
-  return status;
+  return hash_node(data_node, output);
+}
+
+void eip712_stream_init(eip712_stream_t *stream) {
+  memzero(stream, sizeof(eip712_stream_t));
+}
+
+int eip712_stream_node(eip712_stream_t *stream,
+                       const evm_sign_typed_data_node_t *data_node,
+                       char *title,
+                       const size_t title_size) {
+  if (stream->complete || data_node->children_count != 0)
+    return EIP712_INVALID_DATA;
+  if (stream->depth == 0 && data_node->type != EVM_EIP_712_DATA_TYPE_STRUCT)
+    return EIP712_INVALID_DATA;
+
+  snprintf(title, title_size, "%s%s", stream->path, data_node->name);
+  if (data_node->type == EVM_EIP_712_DATA_TYPE_STRUCT ||
+      data_node->type == EVM_EIP_712_DATA_TYPE_ARRAY) {
+    if (stream->depth >= EIP712_MAX_DEPTH)
+      return EIP712_MEMORY_LIMIT_EXCEEDED;
+    if (data_node->type == EVM_EIP_712_DATA_TYPE_STRUCT &&
+        data_node->type_hash == NULL)
+      return EIP712_INVALID_DATA;
+
+    // members follow the node; its size holds their count
+    size_t path_len = strnlen(stream->path, sizeof(stream->path));
+    stream->path_len[stream->depth] = path_len;
+    push_frame(data_node, data_node->size, &stream->frames[stream->depth]);
+    stream->frames[stream->depth++].node = NULL;
+    snprintf(stream->path + path_len,
+             sizeof(stream->path) - path_len,
+             "%s.",
+             data_node->name);
+  } else {
+    eip712_frame_t *frame = &stream->frames[stream->depth - 1];
+    int status = absorb_leaf(data_node, &frame->ctx);
+    if (status != EIP712_OK)
+      return status;
+    frame->next_child++;
+  }
+
+  // conclude the structs/arrays whose members are all received
+  while (stream->depth > 0) {
+    eip712_frame_t *frame = &stream->frames[stream->depth - 1];
+    uint8_t digest[HASH_SIZE] = {0};
+    if (frame->next_child < frame->members)
+      break;
+
+    keccak_Final(&frame->ctx, digest);
+    stream->depth--;
+    stream->path[stream->path_len[stream->depth]] = '\0';
+    if (stream->depth == 0) {
+      memcpy(stream->hash, digest, HASH_SIZE);
+      stream->complete = true;
+    } else {
+      frame = &stream->frames[stream->depth - 1];
+      keccak_Update(&frame->ctx, digest, sizeof(digest));
+      frame->next_child++;
+    }
+  }
+
+  return EIP712_OK;
 }
@@ -3,10 +3,13 @@
 #include <evm/core.pb.h>
 
 #include "abi.h"
+#include "sha3.h"
 
 #define BUFFER_SIZE 1024
 #define HASH_SIZE 32
 #define DYNAMIC_BYTES_ID "bytes"
+/// Maximum nesting of structs & arrays that can be hashed
+#define EIP712_MAX_DEPTH 8
 
 typedef enum EIP712_STATUS_CODES {
   EIP712_OK = 0,
@@ -23,6 +26,28 @@ typedef struct queue_node {
   char *prefix;
 } queue_node;
 
+typedef struct eip712_frame {
+  const evm_sign_typed_data_node_t *node;
+  size_t next_child;
+  size_t members;
+  SHA3_CTX ctx;
+} eip712_frame_t;
+
+/**
+ * Incremental hashStruct over a tree received in depth-first order: each node
+ * arrives without its children and the size of a struct/array node holds the
+ * number of members that follow it. Only the open structs/arrays are retained.
+ */
+typedef struct eip712_stream {
+  eip712_frame_t frames[EIP712_MAX_DEPTH];
+  size_t depth;
+  /// display path of the open structs/arrays (e.g. "order.offer.")
+  char path[BUFFER_SIZE];
+  size_t path_len[EIP712_MAX_DEPTH];
+  bool complete;
+  uint8_t hash[HASH_SIZE];
+} eip712_stream_t;
+
 typedef struct queue {
   queue_node *front;
   queue_node *rear;
@@ -53,4 +78,17 @@ int encode_data(const evm_sign_typed_data_node_t *data_node,
                 const size_t output_size,
                 size_t *bytes_written);
 
+void eip712_stream_init(eip712_stream_t *stream);
+
+/**
+ * Absorbs the next node (received in depth-first order) of the struct being
+ * hashed. On success, the display title of the node (path + name) is written
+ * to title; stream->complete is set with stream->hash once the root struct
+ * concludes.
+ */
+int eip712_stream_node(eip712_stream_t *stream,
+                       const evm_sign_typed_data_node_t *data_node,
+                       char *title,
+                       const size_t title_size);
+
 #endif /* EIP712_UTILS */
\ No newline at end of file
@@ -60,7 +60,7 @@
  * INCLUDES
  *****************************************************************************/
 
-#include "eth_app.h"
+#include "evm_chains.h"
 #include "evm_contracts.h"
 
 /*****************************************************************************
@@ -87,2491 +87,2492 @@
  * GLOBAL VARIABLES
  *****************************************************************************/
 
+// entries must be kept in ascending order of the address for binary search
 const erc20_contracts_t eth_contracts[ETH_WHITELISTED_CONTRACTS_COUNT] = {
-    // 0chain
-    {{0xb9, 0xef, 0x77, 0xb,  0x6a, 0x5e, 0x12, 0xe4, 0x59, 0x83,
-      0xc5, 0xd8, 0x5,  0x45, 0x25, 0x8a, 0xa3, 0x8f, 0x3b, 0x78},
-     "ZCN",
-     10},
-    // 0x
-    {{0xe4, 0x1d, 0x24, 0x89, 0x57, 0x1d, 0x32, 0x21, 0x89, 0x24,
-      0x6d, 0xaf, 0xa5, 0xeb, 0xde, 0x1f, 0x46, 0x99, 0xf4, 0x98},
-     "ZRX",
+    // TrueUSD
+    {{0x0,  0x0,  0x0,  0x0,  0x0,  0x8,  0x5d, 0x47, 0x80, 0xb7,
+      0x31, 0x19, 0xb6, 0x44, 0xae, 0x5e, 0xcd, 0x22, 0xb3, 0x76},
+     "TUSD",
      18},
-    // 0xcert
-    {{0x83, 0xe2, 0xbe, 0x8d, 0x11, 0x4f, 0x96, 0x61, 0x22, 0x13,
-      0x84, 0xb3, 0xa5, 0xd,  0x24, 0xb9, 0x6a, 0x56, 0x53, 0xf5},
-     "ZXC",
+    // TrueAUD
+    {{0x0,  0x0,  0x61, 0x0,  0xf7, 0x9,  0x0,  0x10, 0x0, 0x5f,
+      0x1b, 0xd7, 0xae, 0x61, 0x22, 0xc3, 0xc2, 0xcf, 0x0, 0x90},
+     "TAUD",
+     18},
+    // TrueHKD
+    {{0x0, 0x0,  0x85, 0x26, 0x0,  0xce, 0xb0, 0x1, 0xe0, 0x8e,
+      0x0, 0xbc, 0x0,  0x8b, 0xe6, 0x20, 0xd6, 0x0, 0x31, 0xf2},
+     "THKD",
+     18},
+    // AmonD
+    {{0x0,  0x5,  0x9a, 0xe6, 0x9c, 0x16, 0x22, 0xa7, 0x54, 0x2e,
+      0xdc, 0x15, 0xe8, 0xd1, 0x7b, 0x6,  0xf,  0xe3, 0x7,  0xb6},
+     "AMON",
+     18},
+    // Stox
+    {{0x0,  0x6b, 0xea, 0x43, 0xba, 0xa3, 0xf7, 0xa6, 0xf7, 0x65,
+      0xf1, 0x4f, 0x10, 0xa1, 0xa1, 0xb0, 0x83, 0x34, 0xef, 0x45},
+     "STX",
+     18},
+    // VNX Exchange
+    {{0x0,  0xfc, 0x27, 0xc,  0x9c, 0xc1, 0x3e, 0x87, 0x8a, 0xb5,
+      0x36, 0x3d, 0x0,  0x35, 0x4b, 0xeb, 0xf6, 0xf0, 0x5c, 0x15},
+     "VNXLU",
+     18},
+    // Paycent
+    {{0x1,  0x42, 0xc3, 0xb2, 0xfc, 0x51, 0x81, 0x9b, 0x5a, 0xf5,
+      0xdf, 0xc4, 0xaa, 0x52, 0xdf, 0x97, 0x22, 0x79, 0x8,  0x51},
+     "PYN",
+     18},
+    // KingXChain
+    {{0x1,  0x63, 0x96, 0x4,  0x47, 0x9,  0xeb, 0x3e, 0xdc, 0x69,
+      0xc4, 0x4f, 0x4d, 0x5f, 0xa6, 0x99, 0x69, 0x17, 0xe4, 0xe8},
+     "KXC",
      18},
-    // 1World
-    {{0xfd, 0xbc, 0x1a, 0xdc, 0x26, 0xf0, 0xf8, 0xf8, 0x60, 0x6a,
-      0x5d, 0x63, 0xb7, 0xd3, 0xa3, 0xcd, 0x21, 0xc2, 0x2b, 0x23},
-     "1WO",
-     8},
     // 3X Short Bitcoin Token
     {{0x1,  0x6e, 0xe7, 0x37, 0x32, 0x48, 0xa8, 0xb,  0xde, 0x1f,
       0xd6, 0xba, 0xa0, 0x1,  0x31, 0x1d, 0x23, 0x3b, 0x3c, 0xfa},
      "BEAR",
      18},
-    // 4New
-    {{0x24, 0x1b, 0xa6, 0x72, 0x57, 0x4a, 0x78, 0xa3, 0xa6, 0x4,
-      0xcd, 0xd0, 0xa9, 0x44, 0x29, 0xa7, 0x3a, 0x84, 0xa3, 0x24},
-     "KWATT",
-     18},
-    // Aave
-    {{0x7f, 0xc6, 0x65, 0x0,  0xc8, 0x4a, 0x76, 0xad, 0x7e, 0x9c,
-      0x93, 0x43, 0x7b, 0xfc, 0x5a, 0xc3, 0x3e, 0x2d, 0xda, 0xe9},
-     "AAVE",
-     18},
-    // adbank
-    {{0x2b, 0xaa, 0xc9, 0x33, 0xc,  0xf9, 0xac, 0x47, 0x9d, 0x81,
-      0x91, 0x95, 0x79, 0x4d, 0x79, 0xad, 0xc,  0x76, 0x16, 0xe3},
-     "ADB",
-     18},
-    // Adelphoi
-    {{0x66, 0xe,  0x71, 0x48, 0x37, 0x85, 0xf6, 0x61, 0x33, 0x54,
-      0x8b, 0x10, 0xf6, 0x92, 0x6d, 0xc3, 0x32, 0xb0, 0x6e, 0x61},
-     "ADL",
+    // BnkToTheFuture
+    {{0x1, 0xff, 0x50, 0xf8, 0xb7, 0xf7, 0x4e, 0x4f, 0x0,  0x58,
+      0xd, 0x95, 0x96, 0xcd, 0x3d, 0xd,  0x6d, 0x6e, 0x32, 0x6f},
+     "BFT",
      18},
-    // Ambire AdEx
-    {{0xad, 0xe0, 0xc,  0x28, 0x24, 0x4d, 0x5c, 0xe1, 0x7d, 0x72,
-      0xe4, 0x3,  0x30, 0xb1, 0xc3, 0x18, 0xcd, 0x12, 0xb7, 0xc3},
-     "ADX",
+    // PKG
+    {{0x2,  0xf2, 0xd4, 0xa0, 0x4e, 0x6e, 0x1,  0xac, 0xe8, 0x8b,
+      0xd2, 0xcd, 0x63, 0x28, 0x75, 0x54, 0x3b, 0x2e, 0xf5, 0x77},
+     "PKG",
      18},
-    // Aditus
-    {{0x88, 0x10, 0xc6, 0x34, 0x70, 0xd3, 0x86, 0x39, 0x95, 0x4c,
-      0x6b, 0x41, 0xaa, 0xc5, 0x45, 0x84, 0x8c, 0x46, 0x48, 0x4a},
-     "ADI",
+    // PieDAO BTC++
+    {{0x3,  0x27, 0x11, 0x24, 0x23, 0xf3, 0xa6, 0x8e, 0xfd, 0xf1,
+      0xfc, 0xf4, 0x2,  0xf6, 0xc5, 0xcb, 0x9f, 0x7c, 0x33, 0xfd},
+     "BTC++",
      18},
-    // adChain
-    {{0xd0, 0xd6, 0xd6, 0xc5, 0xfe, 0x4a, 0x67, 0x7d, 0x34, 0x3c,
-      0xc4, 0x33, 0x53, 0x6b, 0xb7, 0x17, 0xba, 0xe1, 0x67, 0xdd},
-     "ADT",
-     9},
-    // Advertise Coin
-    {{0xb6, 0xc3, 0xdc, 0x85, 0x78, 0x45, 0xa7, 0x13, 0xd3, 0x53,
-      0x1c, 0xea, 0x5a, 0xc5, 0x46, 0xf6, 0x76, 0x79, 0x92, 0xf4},
-     "ADCO",
-     6},
-    // aelf
-    {{0xbf, 0x21, 0x79, 0x85, 0x9f, 0xc6, 0xd5, 0xbe, 0xe9, 0xbf,
-      0x91, 0x58, 0x63, 0x2d, 0xc5, 0x16, 0x78, 0xa4, 0x10, 0xe},
-     "ELF",
+    // bitJob
+    {{0x3,  0x71, 0xa8, 0x2e, 0x4a, 0x9d, 0xa,  0x43, 0x12, 0xf3,
+      0xee, 0x2a, 0xc9, 0xc6, 0x95, 0x85, 0x12, 0x89, 0x13, 0x72},
+     "STU",
      18},
-    // Aeron
-    {{0xc,  0x37, 0xbc, 0xf4, 0x56, 0xbc, 0x66, 0x1c, 0x14, 0xd5,
-      0x96, 0x68, 0x33, 0x25, 0x62, 0x30, 0x76, 0xd7, 0xe2, 0x83},
-     "ARNX",
+    // Rai Reflex Index
+    {{0x3,  0xab, 0x45, 0x86, 0x34, 0x91, 0xa,  0xad, 0x20, 0xef,
+      0x5f, 0x1c, 0x8e, 0xe9, 0x6f, 0x1d, 0x6a, 0xc5, 0x49, 0x19},
+     "RAI",
      18},
-    // Aeternity
-    {{0x5c, 0xa9, 0xa7, 0x1b, 0x1d, 0x1,  0x84, 0x9c, 0xa, 0x95,
-      0x49, 0xc,  0xc0, 0x5,  0x59, 0x71, 0x7f, 0xcf, 0xd, 0x1d},
-     "AE",
+    // Fire Lotto
+    {{0x4,  0x93, 0x99, 0xa6, 0xb0, 0x48, 0xd5, 0x29, 0x71, 0xf7,
+      0xd1, 0x22, 0xae, 0x21, 0xa1, 0x53, 0x27, 0x22, 0x28, 0x5f},
+     "FLOT",
      18},
-    // Agoras: Currency of Tau
-    {{0x73, 0x88, 0x65, 0x30, 0x1a, 0x9b, 0x7d, 0xd8, 0xd,  0xc3,
-      0x66, 0x6d, 0xd4, 0x8c, 0xf0, 0x34, 0xec, 0x42, 0xbd, 0xda},
-     "AGRS",
+    // Sensitrust
+    {{0x4,  0xe0, 0xaf, 0xa,  0xf1, 0xb7, 0xf0, 0x2,  0x3c, 0x6b,
+      0x12, 0xaf, 0x5a, 0x94, 0xdf, 0x59, 0xb0, 0xe8, 0xcf, 0x59},
+     "SETS",
      18},
+    // Dalecoin
+    {{0x7,  0xd9, 0xe4, 0x9e, 0xa4, 0x2,  0x19, 0x4b, 0xf4, 0x8a,
+      0x82, 0x76, 0xda, 0xfb, 0x16, 0xe4, 0xed, 0x63, 0x33, 0x17},
+     "DALC",
+     8},
     // Agrello
     {{0x7,  0xe3, 0xc7, 0x6,  0x53, 0x54, 0x8b, 0x4,  0xf0, 0xa7,
       0x59, 0x70, 0xc1, 0xf8, 0x1b, 0x4c, 0xbb, 0xfb, 0x60, 0x6f},
      "DLT",
      18},
-    // AidCoin
-    {{0x37, 0xe8, 0x78, 0x9b, 0xb9, 0x99, 0x6c, 0xac, 0x91, 0x56,
-      0xcd, 0x5f, 0x5f, 0xd3, 0x25, 0x99, 0xe6, 0xb9, 0x12, 0x89},
-     "AID",
-     18},
-    // AiLink
-    {{0x42, 0x89, 0xc0, 0x43, 0xa1, 0x23, 0x92, 0xf1, 0x2,  0x73,
-      0x7,  0xfb, 0x58, 0x27, 0x2d, 0x8e, 0xbd, 0x85, 0x39, 0x12},
-     "ALI",
-     18},
-    // AirSwap
-    {{0x27, 0x5,  0x4b, 0x13, 0xb1, 0xb7, 0x98, 0xb3, 0x45, 0xb5,
-      0x91, 0xa4, 0xd2, 0x2e, 0x65, 0x62, 0xd4, 0x7e, 0xa7, 0x5a},
-     "AST",
-     4},
-    // Aleph.im
-    {{0x27, 0x70, 0x2a, 0x26, 0x12, 0x6e, 0xb, 0x37, 0x2,  0xaf,
-      0x63, 0xee, 0x9,  0xac, 0x4d, 0x1a, 0x8, 0x4e, 0xf6, 0x28},
-     "ALEPH",
-     18},
-    // Alpha A
-    {{0xff, 0xc6, 0x3b, 0x91, 0x46, 0x96, 0x7a, 0x1b, 0xa3, 0x30,
-      0x66, 0xfb, 0x5,  0x7e, 0xe3, 0x72, 0x22, 0x21, 0xac, 0xf0},
-     "A",
+    // Edgeless
+    {{0x8,  0x71, 0x1d, 0x3b, 0x2,  0xc8, 0x75, 0x8f, 0x2f, 0xb3,
+      0xab, 0x4e, 0x80, 0x22, 0x84, 0x18, 0xa7, 0xf8, 0xe3, 0x9c},
+     "EDG",
      18},
-    // Alpha Quark
-    {{0x2a, 0x9b, 0xdc, 0xff, 0x37, 0xab, 0x68, 0xb9, 0x5a, 0x53,
-      0x43, 0x5a, 0xdf, 0xd8, 0x89, 0x2e, 0x86, 0x8,  0x4f, 0x93},
-     "AQT",
+    // Cryptobuyer
+    {{0x8,  0xaa, 0xe,  0xd0, 0x4,  0x7,  0x36, 0xdd, 0x28, 0xd4,
+      0xc8, 0xb1, 0x6a, 0xb4, 0x53, 0xb3, 0x68, 0x24, 0x8d, 0x19},
+     "XPT",
      18},
-    // Alta Finance
-    {{0xe0, 0xcc, 0xa8, 0x6b, 0x25, 0x40, 0x5,  0x88, 0x9a, 0xc3,
-      0xa8, 0x1e, 0x73, 0x7f, 0x56, 0xa1, 0x4f, 0x4a, 0x38, 0xf5},
-     "ALTA",
+    // Dentacoin
+    {{0x8,  0xd3, 0x2b, 0xd,  0xa6, 0x3e, 0x2c, 0x3b, 0xcf, 0x80,
+      0x19, 0xc9, 0xc5, 0xd8, 0x49, 0xd7, 0xa9, 0xd7, 0x91, 0xe6},
+     "DCN",
      18},
-    // AMIS
-    {{0x94, 0x9b, 0xed, 0x88, 0x6c, 0x73, 0x9f, 0x1a, 0x32, 0x73,
-      0x62, 0x9b, 0x33, 0x20, 0xdb, 0xc,  0x50, 0x24, 0xc7, 0x19},
-     "AMIS",
-     9},
-    // AMO Coin
-    {{0x38, 0xc8, 0x7a, 0xa8, 0x9b, 0x2b, 0x8c, 0xd9, 0xb9, 0x5b,
-      0x73, 0x6e, 0x1f, 0xa7, 0xb6, 0x12, 0xea, 0x97, 0x21, 0x69},
-     "AMO",
+    // Tierion
+    {{0x8,  0xf5, 0xa9, 0x23, 0x5b, 0x8,  0x17, 0x3b, 0x75, 0x69,
+      0xf8, 0x36, 0x45, 0xd2, 0xc7, 0xfb, 0x55, 0xe8, 0xcc, 0xd8},
+     "TNT",
+     8},
+    // ChronoBase
+    {{0x9,  0x22, 0xf1, 0xd8, 0x8,  0xad, 0xc3, 0xa4, 0x44, 0x4b,
+      0xed, 0x2f, 0x73, 0xfa, 0xc5, 0x3a, 0x1a, 0x2a, 0x58, 0x59},
+     "TIK",
      18},
-    // Amon
-    {{0x73, 0x7f, 0x98, 0xac, 0x8c, 0xa5, 0x9f, 0x2c, 0x68, 0xad,
-      0x65, 0x8e, 0x3c, 0x3d, 0x8c, 0x89, 0x63, 0xe4, 0xa,  0x4c},
-     "AMN",
+    // Lendingblock
+    {{0x9,  0x47, 0xb0, 0xe6, 0xd8, 0x21, 0x37, 0x88, 0x5,  0xc9,
+      0x59, 0x82, 0x91, 0x38, 0x5c, 0xe7, 0xc7, 0x91, 0xa6, 0xb2},
+     "LND",
      18},
-    // AmonD
-    {{0x0,  0x5,  0x9a, 0xe6, 0x9c, 0x16, 0x22, 0xa7, 0x54, 0x2e,
-      0xdc, 0x15, 0xe8, 0xd1, 0x7b, 0x6,  0xf,  0xe3, 0x7,  0xb6},
-     "AMON",
+    // LGO
+    {{0xa,  0x50, 0xc9, 0x3c, 0x76, 0x2f, 0xdd, 0x6e, 0x56, 0xd8,
+      0x62, 0x15, 0xc2, 0x4a, 0xaa, 0xd4, 0x3a, 0xb6, 0x29, 0xaa},
+     "LGO",
+     8},
+    // district0x
+    {{0xa,  0xbd, 0xac, 0xe7, 0xd,  0x37, 0x90, 0x23, 0x5a, 0xf4,
+      0x48, 0xc8, 0x85, 0x47, 0x60, 0x3b, 0x94, 0x56, 0x4,  0xea},
+     "DNT",
      18},
-    // Ampleforth
-    {{0xd4, 0x6b, 0xa6, 0xd9, 0x42, 0x5,  0xd,  0x48, 0x9d, 0xbd,
-      0x93, 0x8a, 0x2c, 0x90, 0x9a, 0x5d, 0x50, 0x39, 0xa1, 0x61},
-     "AMPL",
-     9},
-    // Amp
-    {{0xff, 0x20, 0x81, 0x77, 0x65, 0xcb, 0x7f, 0x73, 0xd4, 0xbd,
-      0xe2, 0xe6, 0x6e, 0x6,  0x7e, 0x58, 0xd1, 0x10, 0x95, 0xc2},
-     "AMP",
+    // MATRYX
+    {{0xa,  0xf4, 0x4e, 0x27, 0x84, 0x63, 0x72, 0x18, 0xdd, 0x1d,
+      0x32, 0xa3, 0x22, 0xd4, 0x4e, 0x60, 0x3a, 0x8f, 0xc,  0x6a},
+     "MTX",
      18},
-    // Antiample
-    {{0xf9, 0x11, 0xa7, 0xec, 0x46, 0xa2, 0xc6, 0xfa, 0x49, 0x19,
-      0x32, 0x12, 0xfe, 0x4a, 0x2a, 0x9b, 0x95, 0x85, 0x1c, 0x27},
-     "XAMP",
-     9},
+    // Polybius
+    {{0xa,  0xff, 0xa0, 0x6e, 0x7f, 0xbe, 0x5b, 0xc9, 0xa7, 0x64,
+      0xc9, 0x79, 0xaa, 0x66, 0xe8, 0x25, 0x6a, 0x63, 0x1f, 0x2},
+     "PLBT",
+     6},
     // API3
     {{0xb,  0x38, 0x21, 0xe,  0xa1, 0x14, 0x11, 0x55, 0x7c, 0x13,
       0x45, 0x7d, 0x4d, 0xa7, 0xdc, 0x6e, 0xa7, 0x31, 0xb8, 0x8a},
      "API3",
      18},
-    // AppCoins
-    {{0x1a, 0x7a, 0x8b, 0xd9, 0x10, 0x6f, 0x2b, 0x8d, 0x97, 0x7e,
-      0x8,  0x58, 0x2d, 0xc7, 0xd2, 0x4c, 0x72, 0x3a, 0xb0, 0xdb},
-     "APPC",
+    // DAEX
+    {{0xb,  0x4b, 0xdc, 0x47, 0x87, 0x91, 0x89, 0x72, 0x74, 0x65,
+      0x2d, 0xc1, 0x5e, 0xf5, 0xc1, 0x35, 0xca, 0xe6, 0x1e, 0x60},
+     "DAX",
      18},
-    // Arcblock
-    {{0xb9, 0x8d, 0x4c, 0x97, 0x42, 0x5d, 0x99, 0x8, 0xe6, 0x6e,
-      0x53, 0xa6, 0xfd, 0xf6, 0x73, 0xac, 0xca, 0xb, 0xe9, 0x86},
-     "ABT",
-     18},
-    // Auctus
-    {{0xc1, 0x2d, 0x9,  0x9b, 0xe3, 0x15, 0x67, 0xad, 0xd4, 0xe4,
-      0xe4, 0xd0, 0xd4, 0x56, 0x91, 0xc3, 0xf5, 0x8f, 0x56, 0x63},
-     "AUC",
-     18},
-    // Audius
-    {{0x18, 0xaa, 0xa7, 0x11, 0x57, 0x5,  0xe8, 0xbe, 0x94, 0xbf,
-      0xfe, 0xbd, 0xe5, 0x7a, 0xf9, 0xbf, 0xc2, 0x65, 0xb9, 0x98},
-     "AUDIO",
+    // SWFTCOIN
+    {{0xb, 0xb2, 0x17, 0xe4, 0xf, 0x8a, 0x5c, 0xb7, 0x9a, 0xdf,
+      0x4, 0xe1, 0xaa, 0xb6, 0xe, 0x5a, 0xbd, 0xd,  0xfc, 0x1e},
+     "SWFTC",
+     8},
+    // yearn.finance
+    {{0xb,  0xc5, 0x29, 0xc0, 0xc,  0x64, 0x1,  0xae, 0xf6, 0xd2,
+      0x20, 0xbe, 0x8c, 0x6e, 0xa1, 0x66, 0x7f, 0x6a, 0xd9, 0x3e},
+     "YFI",
      18},
-    // Augur
-    {{0x22, 0x16, 0x57, 0x77, 0x68, 0x46, 0x89, 0x9,  0x89, 0xa7,
-      0x59, 0xba, 0x29, 0x73, 0xe4, 0x27, 0xdf, 0xf5, 0xc9, 0xbb},
-     "REP",
+    // Aeron
+    {{0xc,  0x37, 0xbc, 0xf4, 0x56, 0xbc, 0x66, 0x1c, 0x14, 0xd5,
+      0x96, 0x68, 0x33, 0x25, 0x62, 0x30, 0x76, 0xd7, 0xe2, 0x83},
+     "ARNX",
      18},
-    // Aurora Chain
-    {{0x9a, 0xb1, 0x65, 0xd7, 0x95, 0x1,  0x9b, 0x6d, 0x8b, 0x3e,
-      0x97, 0x1d, 0xda, 0x91, 0x7,  0x14, 0x21, 0x30, 0x5e, 0x5a},
-     "AOA",
+    // Basic Attention
+    {{0xd,  0x87, 0x75, 0xf6, 0x48, 0x43, 0x6, 0x79, 0xa7, 0x9,
+      0xe9, 0x8d, 0x2b, 0xc,  0xb6, 0x25, 0xd, 0x28, 0x87, 0xef},
+     "BAT",
      18},
     // Aventus
     {{0xd,  0x88, 0xed, 0x6e, 0x74, 0xbb, 0xfd, 0x96, 0xb8, 0x31,
       0x23, 0x16, 0x38, 0xb6, 0x6c, 0x5,  0x57, 0x1e, 0x82, 0x4f},
      "AVT",
      18},
-    // Axie Infinity
-    {{0xbb, 0xe,  0x17, 0xef, 0x65, 0xf8, 0x2a, 0xb0, 0x18, 0xd8,
-      0xed, 0xd7, 0x76, 0xe8, 0xdd, 0x94, 0x3,  0x27, 0xb2, 0x8b},
-     "AXS",
-     18},
-    // Balancer
-    {{0xba, 0x10, 0x0, 0x0,  0x62, 0x5a, 0x37, 0x54, 0x42, 0x39,
-      0x78, 0xa6, 0xc, 0x93, 0x17, 0xc5, 0x8a, 0x42, 0x4e, 0x3d},
-     "BAL",
-     18},
-    // BambooDeFi
-    {{0xf5, 0x68, 0x42, 0xaf, 0x3b, 0x56, 0xfd, 0x72, 0xd1, 0x7c,
-      0xb1, 0x3,  0xf9, 0x2d, 0x2,  0x7b, 0xba, 0x91, 0x2e, 0x89},
-     "BAMBOO",
+    // IQeon
+    {{0xd,  0xb8, 0xd8, 0xb7, 0x6b, 0xc3, 0x61, 0xba, 0xcb, 0xb7,
+      0x2e, 0x2c, 0x49, 0x1e, 0x6,  0x8,  0x5a, 0x97, 0xab, 0x31},
+     "IQN",
      18},
-    // Banca
-    {{0x99, 0x8b, 0x3b, 0x82, 0xbc, 0x9d, 0xba, 0x17, 0x39, 0x90,
-      0xbe, 0x7a, 0xfb, 0x77, 0x27, 0x88, 0xb5, 0xac, 0xb8, 0xbd},
-     "BANCA",
+    // Po.et
+    {{0xe,  0x9,  0x89, 0xb1, 0xf9, 0xb8, 0xa3, 0x89, 0x83, 0xc2,
+      0xba, 0x80, 0x53, 0x26, 0x9c, 0xa6, 0x2e, 0xc9, 0xb1, 0x95},
+     "POE",
+     8},
+    // Abyss
+    {{0xe,  0x8d, 0x6b, 0x47, 0x1e, 0x33, 0x2f, 0x14, 0xe,  0x7d,
+      0x9d, 0xbb, 0x99, 0xe5, 0xe3, 0x82, 0x2f, 0x72, 0x8d, 0xa6},
+     "ABYSS",
      18},
-    // Bancor Network
-    {{0x1f, 0x57, 0x3d, 0x6f, 0xb3, 0xf1, 0x3d, 0x68, 0x9f, 0xf8,
-      0x44, 0xb4, 0xce, 0x37, 0x79, 0x4d, 0x79, 0xa7, 0xff, 0x1c},
-     "BNT",
+    // Cryptopay
+    {{0xe,  0xbb, 0x61, 0x42, 0x4,  0xe4, 0x7c, 0x9,  0xb6, 0xc3,
+      0xfe, 0xb9, 0xaa, 0xec, 0xad, 0x8e, 0xe0, 0x60, 0xe2, 0x3e},
+     "CPAY",
      18},
-    // BankCoin BCash
-    {{0xb5, 0xbb, 0x48, 0x56, 0x7b, 0xfd, 0xb,  0xfe, 0x9e, 0x4b,
-      0x8,  0xef, 0x8b, 0x7f, 0x91, 0x55, 0x6c, 0xc2, 0xa1, 0x12},
-     "BCASH",
+    // Decentraland
+    {{0xf,  0x5d, 0x2f, 0xb2, 0x9f, 0xb7, 0xd3, 0xcf, 0xee, 0x44,
+      0x4a, 0x20, 0x2,  0x98, 0xf4, 0x68, 0x90, 0x8c, 0xc9, 0x42},
+     "MANA",
      18},
-    // Basic Attention
-    {{0xd,  0x87, 0x75, 0xf6, 0x48, 0x43, 0x6, 0x79, 0xa7, 0x9,
-      0xe9, 0x8d, 0x2b, 0xc,  0xb6, 0x25, 0xd, 0x28, 0x87, 0xef},
-     "BAT",
+    // Blockzero Labs
+    {{0xf,  0x7f, 0x96, 0x16, 0x48, 0xae, 0x6d, 0xb4, 0x3c, 0x75,
+      0x66, 0x3a, 0xc7, 0xe5, 0x41, 0x4e, 0xb7, 0x9b, 0x57, 0x4},
+     "XIO",
      18},
+    // XMax
+    {{0xf,  0x8c, 0x45, 0xb8, 0x96, 0x78, 0x4a, 0x1e, 0x40, 0x85,
+      0x26, 0xb9, 0x30, 0x5,  0x19, 0xef, 0x86, 0x60, 0x20, 0x9c},
+     "XMX",
+     8},
     // BitCapitalVendor
     {{0x10, 0x14, 0x61, 0x3e, 0x2b, 0x3c, 0xbc, 0x4d, 0x57, 0x50,
       0x54, 0xd4, 0x98, 0x2e, 0x58, 0xd,  0x9b, 0x99, 0xd7, 0xb1},
      "BCV",
      8},
+    // Genesis Vision
+    {{0x10, 0x3c, 0x3a, 0x20, 0x9d, 0xa5, 0x9d, 0x3e, 0x7c, 0x4a,
+      0x89, 0x30, 0x7e, 0x66, 0x52, 0x1e, 0x8,  0x1c, 0xfd, 0xf0},
+     "GVT",
+     18},
+    // Bloom
+    {{0x10, 0x7c, 0x45, 0x4,  0xcd, 0x79, 0xc5, 0xd2, 0x69, 0x6e,
+      0xa0, 0x3,  0xa,  0x8d, 0xd4, 0xe9, 0x26, 0x1,  0xb8, 0x2e},
+     "BLT",
+     18},
+    // VeraOne
+    {{0x10, 0xbc, 0x51, 0x8c, 0x32, 0xfb, 0xae, 0x5e, 0x38, 0xec,
+      0xb5, 0xa,  0x61, 0x21, 0x60, 0x57, 0x1b, 0xd8, 0x1e, 0x44},
+     "VRO",
+     8},
+    // CENNZnet
+    {{0x11, 0x22, 0xb6, 0xa0, 0xe0, 0xd,  0xce, 0x5,  0x63, 0x8,
+      0x2b, 0x6e, 0x29, 0x53, 0xf3, 0xa9, 0x43, 0x85, 0x5c, 0x1f},
+     "CENNZ",
+     18},
+    // GridPlus [OLD]
+    {{0x12, 0xb1, 0x9d, 0x3e, 0x2c, 0xcc, 0x14, 0xda, 0x4,  0xfa,
+      0xe3, 0x3e, 0x63, 0x65, 0x2c, 0xe4, 0x69, 0xb3, 0xf2, 0xfd},
+     "GRID",
+     12},
+    // Spectre.ai Dividend
+    {{0x12, 0xb3, 0x6,  0xfa, 0x98, 0xf4, 0xcb, 0xb8, 0xd4, 0x45,
+      0x7f, 0xdf, 0xf3, 0xa0, 0xa0, 0xa5, 0x6f, 0x7,  0xcc, 0xdf},
+     "SXDT",
+     18},
+    // BoutsPro
+    {{0x13, 0x9d, 0x93, 0x97, 0x27, 0x4b, 0xb9, 0xe2, 0xc2, 0x9a,
+      0x9a, 0xa8, 0xaa, 0xb,  0x58, 0x74, 0xd3, 0xd,  0x62, 0xe3},
+     "BOUTS",
+     18},
+    // BitKan
+    {{0x14, 0x10, 0x43, 0x4b, 0x3,  0x46, 0xf5, 0xbe, 0x67, 0x8d,
+      0xf,  0xb5, 0x54, 0xe5, 0xc7, 0xab, 0x62, 0xf,  0x8f, 0x4a},
+     "KAN",
+     18},
+    // WeOwn
+    {{0x14, 0x60, 0xa5, 0x80, 0x96, 0xd8, 0xa,  0x50, 0xa2, 0xf1,
+      0xf9, 0x56, 0xdd, 0xa4, 0x97, 0x61, 0x1f, 0xa4, 0xf1, 0x65},
+     "CHX",
+     18},
     // Bethereum
     {{0x14, 0xc9, 0x26, 0xf2, 0x29, 0x0,  0x44, 0xb6, 0x47, 0xe1,
       0xbf, 0x20, 0x72, 0xe6, 0x7b, 0x49, 0x5e, 0xff, 0x19, 0x5},
      "BETHER",
      18},
-    // Bezant
-    {{0xe1, 0xae, 0xe9, 0x84, 0x95, 0x36, 0x5f, 0xc1, 0x79, 0x69,
-      0x9c, 0x1b, 0xb3, 0xe7, 0x61, 0xfa, 0x71, 0x6b, 0xee, 0x62},
-     "BZNT",
+    // Debitum Network
+    {{0x15, 0x12, 0x2,  0xc9, 0xc1, 0x8e, 0x49, 0x56, 0x56, 0xf3,
+      0x72, 0x28, 0x1f, 0x49, 0x3e, 0xb7, 0x69, 0x89, 0x61, 0xd5},
+     "DEB",
      18},
-    // Bidao
-    {{0x25, 0xe1, 0x47, 0x41, 0x70, 0xc4, 0xc0, 0xaa, 0x64, 0xfa,
-      0x98, 0x12, 0x3b, 0xdc, 0x8d, 0xb4, 0x9d, 0x78, 0x2,  0xfa},
-     "BID",
+    // XOVBank
+    {{0x15, 0x3e, 0xd9, 0xcc, 0x1b, 0x79, 0x29, 0x79, 0xd2, 0xbd,
+      0xe0, 0xbb, 0xf4, 0x5c, 0xc2, 0xa7, 0xe4, 0x36, 0xa5, 0xf9},
+     "XOV",
      18},
-    // Bigbom
-    {{0x84, 0xf7, 0xc4, 0x4b, 0x6f, 0xed, 0x10, 0x80, 0xf6, 0x47,
-      0xe3, 0x54, 0xd5, 0x52, 0x59, 0x5b, 0xe2, 0xcc, 0x60, 0x2f},
-     "BBO",
+    // United Traders
+    {{0x16, 0xf8, 0x12, 0xbe, 0x7f, 0xff, 0x2,  0xca, 0xf6, 0x62,
+      0xb8, 0x5d, 0x5d, 0x58, 0xa5, 0xda, 0x65, 0x72, 0xd4, 0xdf},
+     "UTT",
+     8},
+    // OWNDATA
+    {{0x17, 0xb,  0x27, 0x5c, 0xed, 0x8,  0x9f, 0xff, 0xae, 0xbf,
+      0xe9, 0x27, 0xf4, 0x45, 0xa3, 0x50, 0xed, 0x91, 0x60, 0xdc},
+     "OWN",
+     8},
+    // Numeraire
+    {{0x17, 0x76, 0xe1, 0xf2, 0x6f, 0x98, 0xb1, 0xa5, 0xdf, 0x9c,
+      0xd3, 0x47, 0x95, 0x3a, 0x26, 0xdd, 0x3c, 0xb4, 0x66, 0x71},
+     "NMR",
      18},
-    // Binance USD
-    {{0x4f, 0xab, 0xb1, 0x45, 0xd6, 0x46, 0x52, 0xa9, 0x48, 0xd7,
-      0x25, 0x33, 0x2,  0x3f, 0x6e, 0x7a, 0x62, 0x3c, 0x7c, 0x53},
-     "BUSD",
+    // Blox
+    {{0x17, 0x7d, 0x39, 0xac, 0x67, 0x6e, 0xd1, 0xc6, 0x7a, 0x2b,
+      0x26, 0x8a, 0xd7, 0xf1, 0xe5, 0x88, 0x26, 0xe5, 0xb0, 0xaf},
+     "CDT",
      18},
-    // BitCoin One
-    {{0x87, 0xf5, 0xe8, 0xc3, 0x42, 0x52, 0x18, 0x83, 0x7f, 0x3c,
-      0xb6, 0x7d, 0xb9, 0x41, 0xaf, 0xc,  0x1,  0x32, 0x3e, 0x56},
-     "BTCONE",
+    // FuzeX
+    {{0x18, 0x29, 0xaa, 0x4,  0x5e, 0x21, 0xe0, 0xd5, 0x95, 0x80,
+      0x2,  0x4a, 0x95, 0x1d, 0xb4, 0x80, 0x96, 0xe0, 0x17, 0x82},
+     "FXT",
+     18},
+    // Audius
+    {{0x18, 0xaa, 0xa7, 0x11, 0x57, 0x5,  0xe8, 0xbe, 0x94, 0xbf,
+      0xfe, 0xbd, 0xe5, 0x7a, 0xf9, 0xbf, 0xc2, 0x65, 0xb9, 0x98},
+     "AUDIO",
      18},
     // BitDegree
     {{0x19, 0x61, 0xb3, 0x33, 0x19, 0x69, 0xed, 0x52, 0x77, 0x7,
       0x51, 0xfc, 0x71, 0x8e, 0xf5, 0x30, 0x83, 0x8b, 0x6d, 0xee},
      "BDG",
      18},
-    // bitJob
-    {{0x3,  0x71, 0xa8, 0x2e, 0x4a, 0x9d, 0xa,  0x43, 0x12, 0xf3,
-      0xee, 0x2a, 0xc9, 0xc6, 0x95, 0x85, 0x12, 0x89, 0x13, 0x72},
-     "STU",
+    // nDEX
+    {{0x19, 0x66, 0xd7, 0x18, 0xa5, 0x65, 0x56, 0x6e, 0x8e, 0x20,
+      0x27, 0x92, 0x65, 0x8d, 0x7b, 0x5f, 0xf4, 0xec, 0xe4, 0x69},
+     "NDX",
      18},
-    // BitMart
-    {{0x98, 0x6e, 0xe2, 0xb9, 0x44, 0xc4, 0x2d, 0x1,  0x7f, 0x52,
-      0xaf, 0x21, 0xc4, 0xc6, 0x9b, 0x84, 0xdb, 0xea, 0x35, 0xd8},
-     "BMX",
+    // AppCoins
+    {{0x1a, 0x7a, 0x8b, 0xd9, 0x10, 0x6f, 0x2b, 0x8d, 0x97, 0x7e,
+      0x8,  0x58, 0x2d, 0xc7, 0xd2, 0x4c, 0x72, 0x3a, 0xb0, 0xdb},
+     "APPC",
      18},
-    // BitRent
-    {{0x1f, 0xe7, 0xb,  0xe7, 0x34, 0xe4, 0x73, 0xe5, 0x72, 0x1e,
-      0xa5, 0x7c, 0x8b, 0x5b, 0x1,  0xe6, 0xca, 0xa5, 0x26, 0x86},
-     "RNTB",
+    // Blockmason Credit Protocol
+    {{0x1c, 0x44, 0x81, 0x75, 0xd,  0xaa, 0x5f, 0xf5, 0x21, 0xa2,
+      0xa7, 0x49, 0xd,  0x99, 0x81, 0xed, 0x46, 0x46, 0x5d, 0xbd},
+     "BCPT",
      18},
-    // BitScreener
-    {{0xff, 0x2b, 0x33, 0x53, 0xc3, 0x1,  0x5e, 0x9f, 0x1f, 0xbf,
-      0x95, 0xb9, 0xbd, 0xa2, 0x3f, 0x58, 0xaa, 0x7c, 0xe0, 0x7},
-     "BITX",
+    // Faceter
+    {{0x1c, 0xca, 0xa0, 0xf2, 0xa7, 0x21, 0xd,  0x76, 0xe1, 0xfd,
+      0xec, 0x74, 0xd,  0x5f, 0x32, 0x3e, 0x2e, 0x1b, 0x16, 0x72},
+     "FACE",
      18},
-    // BlitzPick
-    {{0x28, 0xde, 0xe0, 0x1d, 0x53, 0xfe, 0xd0, 0xed, 0xf5, 0xf6,
-      0xe3, 0x10, 0xbf, 0x8e, 0xf9, 0x31, 0x15, 0x13, 0xae, 0x40},
-     "XBP",
+    // SPINDLE
+    {{0x1d, 0xea, 0x97, 0x9a, 0xe7, 0x6f, 0x26, 0x7,  0x18, 0x70,
+      0xf8, 0x24, 0x8,  0x8d, 0xa7, 0x89, 0x79, 0xeb, 0x91, 0xc8},
+     "SPD",
      18},
     // BlockCDN
     {{0x1e, 0x79, 0x7c, 0xe9, 0x86, 0xc3, 0xcf, 0xf4, 0x47, 0x2f,
       0x7d, 0x38, 0xd5, 0xc4, 0xab, 0xa5, 0x5d, 0xfe, 0xfe, 0x40},
      "BCDN",
      15},
-    // EvidenZ
-    {{0xac, 0xfa, 0x20, 0x9f, 0xb7, 0x3b, 0xf3, 0xdd, 0x5b, 0xbf,
-      0xb1, 0x10, 0x1b, 0x9b, 0xc9, 0x99, 0xc4, 0x90, 0x62, 0xa5},
-     "BCDT",
+    // Bancor Network
+    {{0x1f, 0x57, 0x3d, 0x6f, 0xb3, 0xf1, 0x3d, 0x68, 0x9f, 0xf8,
+      0x44, 0xb4, 0xce, 0x37, 0x79, 0x4d, 0x79, 0xa7, 0xff, 0x1c},
+     "BNT",
      18},
-    // Blockmason Credit Protocol
-    {{0x1c, 0x44, 0x81, 0x75, 0xd,  0xaa, 0x5f, 0xf5, 0x21, 0xa2,
-      0xa7, 0x49, 0xd,  0x99, 0x81, 0xed, 0x46, 0x46, 0x5d, 0xbd},
-     "BCPT",
+    // Uniswap
+    {{0x1f, 0x98, 0x40, 0xa8, 0x5d, 0x5a, 0xf5, 0xbf, 0x1d, 0x17,
+      0x62, 0xf9, 0x25, 0xbd, 0xad, 0xdc, 0x42, 0x1,  0xf9, 0x84},
+     "UNI",
      18},
-    // Blocksquare
-    {{0x50, 0x9a, 0x38, 0xb7, 0xa1, 0xcc, 0xd,  0xcd, 0x83, 0xaa,
-      0x9d, 0x6,  0x21, 0x46, 0x63, 0xd9, 0xec, 0x7c, 0x7f, 0x4a},
-     "BST",
-     18},
-    // BLOCKv
-    {{0x34, 0xd,  0x2b, 0xde, 0x5e, 0xb2, 0x8c, 0x1e, 0xed, 0x91,
-      0xb2, 0xf7, 0x90, 0x72, 0x3e, 0x3b, 0x16, 0x6,  0x13, 0xb7},
-     "VEE",
-     18},
-    // Bloom
-    {{0x10, 0x7c, 0x45, 0x4,  0xcd, 0x79, 0xc5, 0xd2, 0x69, 0x6e,
-      0xa0, 0x3,  0xa,  0x8d, 0xd4, 0xe9, 0x26, 0x1,  0xb8, 0x2e},
-     "BLT",
+    // BitRent
+    {{0x1f, 0xe7, 0xb,  0xe7, 0x34, 0xe4, 0x73, 0xe5, 0x72, 0x1e,
+      0xa5, 0x7c, 0x8b, 0x5b, 0x1,  0xe6, 0xca, 0xa5, 0x26, 0x86},
+     "RNTB",
      18},
-    // Blox
-    {{0x17, 0x7d, 0x39, 0xac, 0x67, 0x6e, 0xd1, 0xc6, 0x7a, 0x2b,
-      0x26, 0x8a, 0xd7, 0xf1, 0xe5, 0x88, 0x26, 0xe5, 0xb0, 0xaf},
-     "CDT",
+    // CoinLoan
+    {{0x20, 0x1,  0xf2, 0xa0, 0xcf, 0x80, 0x1e, 0xcf, 0xda, 0x62,
+      0x2f, 0x6c, 0x28, 0xfb, 0x6e, 0x10, 0xd8, 0x3,  0xd9, 0x69},
+     "CLT",
+     8},
+    // Zebi
+    {{0x20, 0x8,  0xe3, 0x5,  0x7b, 0xd7, 0x34, 0xe1, 0xa,  0xd1,
+      0x3c, 0x9e, 0xae, 0x45, 0xff, 0x13, 0x2a, 0xbc, 0x17, 0x22},
+     "ZCO",
+     8},
+    // Sapien
+    {{0x20, 0xf7, 0xa3, 0xdd, 0xf2, 0x44, 0xdc, 0x92, 0x99, 0x97,
+      0x5b, 0x4d, 0xa1, 0xc3, 0x9f, 0x8d, 0x5d, 0x75, 0xf0, 0x5a},
+     "SPN",
+     6},
+    // Augur
+    {{0x22, 0x16, 0x57, 0x77, 0x68, 0x46, 0x89, 0x9,  0x89, 0xa7,
+      0x59, 0xba, 0x29, 0x73, 0xe4, 0x27, 0xdf, 0xf5, 0xc9, 0xbb},
+     "REP",
      18},
-    // Blue Protocol
-    {{0x53, 0x9e, 0xfe, 0x69, 0xbc, 0xdd, 0x21, 0xa8, 0x3e, 0xfd,
-      0x91, 0x22, 0x57, 0x1a, 0x64, 0xcc, 0x25, 0xe0, 0x28, 0x2b},
-     "BLUE",
+    // Wrapped Bitcoin
+    {{0x22, 0x60, 0xfa, 0xc5, 0xe5, 0x54, 0x2a, 0x77, 0x3a, 0xa4,
+      0x4f, 0xbc, 0xfe, 0xdf, 0x7c, 0x19, 0x3b, 0xc2, 0xc5, 0x99},
+     "WBTC",
      8},
-    // Bluzelle
-    {{0x57, 0x32, 0x4,  0x6a, 0x88, 0x37, 0x4, 0x40, 0x4f, 0x28,
-      0x4c, 0xe4, 0x1f, 0xfa, 0xdd, 0x5b, 0x0, 0x7f, 0xd6, 0x68},
-     "BLZ",
+    // Global Social Chain
+    {{0x22, 0x8b, 0xa5, 0x14, 0x30, 0x9f, 0xfd, 0xf0, 0x3a, 0x81,
+      0xa2, 0x5,  0xa6, 0xd0, 0x40, 0xe4, 0x29, 0xd6, 0xe8, 0xc},
+     "GSC",
      18},
-    // BMCHAIN
-    {{0xf0, 0x28, 0xad, 0xee, 0x51, 0x53, 0x3b, 0x1b, 0x47, 0xbe,
-      0xaa, 0x89, 0xf,  0xeb, 0x54, 0xa4, 0x57, 0xf5, 0x1e, 0x89},
-     "BMT",
+    // Friendz
+    {{0x23, 0x35, 0x20, 0x36, 0xe9, 0x11, 0xa2, 0x2c, 0xfc, 0x69,
+      0x2b, 0x5e, 0x2e, 0x19, 0x66, 0x92, 0x65, 0x8a, 0xde, 0xd9},
+     "FDZ",
      18},
-    // BnkToTheFuture
-    {{0x1, 0xff, 0x50, 0xf8, 0xb7, 0xf7, 0x4e, 0x4f, 0x0,  0x58,
-      0xd, 0x95, 0x96, 0xcd, 0x3d, 0xd,  0x6d, 0x6e, 0x32, 0x6f},
-     "BFT",
+    // Midas Protocol
+    {{0x23, 0xcc, 0xc4, 0x33, 0x65, 0xd9, 0xdd, 0x38, 0x82, 0xea,
+      0xb8, 0x8f, 0x43, 0xd5, 0x15, 0x20, 0x8f, 0x83, 0x24, 0x30},
+     "MAS",
      18},
-    // Bob's Repair
-    {{0xdf, 0x34, 0x79, 0x11, 0x91, 0xb,  0x6c, 0x9a, 0x42, 0x86,
-      0xba, 0x8e, 0x2e, 0xe5, 0xea, 0x4a, 0x39, 0xeb, 0x21, 0x34},
-     "BOB",
+    // 4New
+    {{0x24, 0x1b, 0xa6, 0x72, 0x57, 0x4a, 0x78, 0xa3, 0xa6, 0x4,
+      0xcd, 0xd0, 0xa9, 0x44, 0x29, 0xa7, 0x3a, 0x84, 0xa3, 0x24},
+     "KWATT",
      18},
-    // Bottos
-    {{0x36, 0x90, 0x5f, 0xc9, 0x32, 0x80, 0xf5, 0x23, 0x62, 0xa1,
-      0xcb, 0xab, 0x15, 0x1f, 0x25, 0xdc, 0x46, 0x74, 0x2f, 0xb5},
-     "BTO",
+    // qiibee foundation
+    {{0x24, 0x67, 0xaa, 0x6b, 0x5a, 0x23, 0x51, 0x41, 0x6f, 0xd4,
+      0xc3, 0xde, 0xf8, 0x46, 0x2d, 0x84, 0x1f, 0xee, 0xec, 0xec},
+     "QBX",
      18},
-    // Bounty0x
-    {{0xd2, 0xd6, 0x15, 0x86, 0x83, 0xae, 0xe4, 0xcc, 0x83, 0x80,
-      0x67, 0x72, 0x72, 0x9,  0xa0, 0xaa, 0xf4, 0x35, 0x9d, 0xe3},
-     "BNTY",
+    // Unikoin Gold
+    {{0x24, 0x69, 0x27, 0x91, 0xbc, 0x44, 0x4c, 0x5c, 0xd0, 0xb8,
+      0x1e, 0x3c, 0xbc, 0xab, 0xa4, 0xb0, 0x4a, 0xcd, 0x1f, 0x3b},
+     "UKG",
      18},
-    // BoutsPro
-    {{0x13, 0x9d, 0x93, 0x97, 0x27, 0x4b, 0xb9, 0xe2, 0xc2, 0x9a,
-      0x9a, 0xa8, 0xaa, 0xb,  0x58, 0x74, 0xd3, 0xd,  0x62, 0xe3},
-     "BOUTS",
+    // Data Transaction XD
+    {{0x24, 0xdc, 0xc8, 0x81, 0xe7, 0xdd, 0x73, 0x5,  0x46, 0x83,
+      0x44, 0x52, 0xf2, 0x18, 0x72, 0xd5, 0xcb, 0x4b, 0x52, 0x93},
+     "XD",
      18},
-    // Bread
-    {{0x55, 0x8e, 0xc3, 0x15, 0x2e, 0x2e, 0xb2, 0x17, 0x49, 0x5,
-      0xcd, 0x19, 0xae, 0xa4, 0xe3, 0x4a, 0x23, 0xde, 0x9a, 0xd6},
-     "BRD",
+    // Iungo
+    {{0x24, 0xdd, 0xff, 0x6d, 0x8b, 0x8a, 0x42, 0xd8, 0x35, 0xaf,
+      0x3b, 0x44, 0xd,  0xe9, 0x1f, 0x33, 0x86, 0x55, 0x4a, 0xa4},
+     "ING",
      18},
-    // BTC Lite
-    {{0x5a, 0xcd, 0x19, 0xb9, 0xc9, 0x1e, 0x59, 0x6b, 0x1f, 0x6,
-      0x2f, 0x18, 0xe3, 0xd0, 0x2d, 0xa7, 0xed, 0x8d, 0x1e, 0x50},
-     "BTCL",
-     8},
-    // BTU Protocol
-    {{0xb6, 0x83, 0xd8, 0x3a, 0x53, 0x2e, 0x2c, 0xb7, 0xdf, 0xa5,
-      0x27, 0x5e, 0xed, 0x36, 0x98, 0x43, 0x63, 0x71, 0xcc, 0x9f},
-     "BTU",
+    // Raiden Network
+    {{0x25, 0x5a, 0xa6, 0xdf, 0x7,  0x54, 0xc,  0xb5, 0xd3, 0xd2,
+      0x97, 0xf0, 0xd0, 0xd4, 0xd8, 0x4c, 0xb5, 0x2b, 0xc8, 0xe6},
+     "RDN",
      18},
-    // CACHE Gold
-    {{0xf5, 0x23, 0x84, 0x62, 0xe7, 0x23, 0x5c, 0x7b, 0x62, 0x81,
-      0x15, 0x67, 0xe6, 0x3d, 0xd1, 0x7d, 0x12, 0xc2, 0xea, 0xa0},
-     "CGT",
-     8},
-    // CargoX
-    {{0xb6, 0xee, 0x96, 0x68, 0x77, 0x1a, 0x79, 0xbe, 0x79, 0x67,
-      0xee, 0x29, 0xa6, 0x3d, 0x41, 0x84, 0xf8, 0x9,  0x71, 0x43},
-     "CXO",
+    // Link Machine Learning
+    {{0x25, 0xb6, 0x32, 0x5f, 0x5b, 0xb1, 0xc1, 0xe0, 0x3c, 0xfb,
+      0xc3, 0xe5, 0x3f, 0x47, 0xe,  0x1f, 0x1c, 0xa0, 0x22, 0xe3},
+     "LML",
      18},
-    // Cartesi
-    {{0x49, 0x16, 0x4, 0xc0, 0xfd, 0xf0, 0x83, 0x47, 0xdd, 0x1f,
-      0xa4, 0xee, 0x6, 0x2a, 0x82, 0x2a, 0x5d, 0xd0, 0x6b, 0x5d},
-     "CTSI",
+    // Bidao
+    {{0x25, 0xe1, 0x47, 0x41, 0x70, 0xc4, 0xc0, 0xaa, 0x64, 0xfa,
+      0x98, 0x12, 0x3b, 0xdc, 0x8d, 0xb4, 0x9d, 0x78, 0x2,  0xfa},
+     "BID",
+     18},
+    // PlayKey
+    {{0x26, 0x4,  0xfa, 0x40, 0x6b, 0xe9, 0x57, 0xe5, 0x42, 0xbe,
+      0xb8, 0x9e, 0x67, 0x54, 0xfc, 0xde, 0x68, 0x15, 0xe8, 0x3f},
+     "PKT",
      18},
     // CBC.network
     {{0x26, 0xdb, 0x54, 0x39, 0xf6, 0x51, 0xca, 0xf4, 0x91, 0xa8,
       0x7d, 0x48, 0x79, 0x9d, 0xa8, 0x1f, 0x19, 0x1b, 0xdb, 0x6b},
      "CBC",
      8},
-    // Ccore
-    {{0x67, 0x9b, 0xad, 0xc5, 0x51, 0x62, 0x6e, 0x1,  0xb2, 0x3c,
-      0xee, 0xce, 0xfb, 0xc9, 0xb8, 0x77, 0xea, 0x18, 0xfc, 0x46},
-     "CCO",
+    // AirSwap
+    {{0x27, 0x5,  0x4b, 0x13, 0xb1, 0xb7, 0x98, 0xb3, 0x45, 0xb5,
+      0x91, 0xa4, 0xd2, 0x2e, 0x65, 0x62, 0xd4, 0x7e, 0xa7, 0x5a},
+     "AST",
+     4},
+    // Aleph.im
+    {{0x27, 0x70, 0x2a, 0x26, 0x12, 0x6e, 0xb, 0x37, 0x2,  0xaf,
+      0x63, 0xee, 0x9,  0xac, 0x4d, 0x1a, 0x8, 0x4e, 0xf6, 0x28},
+     "ALEPH",
      18},
-    // CEEK Smart VR
-    {{0xb0, 0x56, 0xc3, 0x8f, 0x6b, 0x7d, 0xc4, 0x6, 0x43, 0x67,
-      0x40, 0x3e, 0x26, 0x42, 0x4c, 0xd2, 0xc6, 0x6, 0x55, 0xe1},
-     "CEEK",
+    // Wabi
+    {{0x28, 0x6b, 0xda, 0x14, 0x13, 0xa2, 0xdf, 0x81, 0x73, 0x1d,
+      0x49, 0x30, 0xce, 0x2f, 0x86, 0x2a, 0x35, 0xa6, 0x9,  0xfe},
+     "WABI",
      18},
-    // Celer Network
-    {{0x4f, 0x92, 0x54, 0xc8, 0x3e, 0xb5, 0x25, 0xf9, 0xfc, 0xf3,
-      0x46, 0x49, 0xb,  0xbb, 0x3e, 0xd2, 0x8a, 0x81, 0xc6, 0x67},
-     "CELR",
+    // Napoleon X
+    {{0x28, 0xb5, 0xe1, 0x2c, 0xce, 0x51, 0xf1, 0x55, 0x94, 0xb0,
+      0xb9, 0x1d, 0x5b, 0x5a, 0xda, 0xa7, 0xf,  0x68, 0x4a, 0x2},
+     "NPX",
+     2},
+    // Ethereum Gold
+    {{0x28, 0xc8, 0xd0, 0x1f, 0xf6, 0x33, 0xea, 0x9c, 0xd8, 0xfc,
+      0x6a, 0x45, 0x1d, 0x74, 0x57, 0x88, 0x9e, 0x69, 0x8d, 0xe6},
+     "ETG",
      18},
-    // CENNZnet
-    {{0x11, 0x22, 0xb6, 0xa0, 0xe0, 0xd,  0xce, 0x5,  0x63, 0x8,
-      0x2b, 0x6e, 0x29, 0x53, 0xf3, 0xa9, 0x43, 0x85, 0x5c, 0x1f},
-     "CENNZ",
+    // BlitzPick
+    {{0x28, 0xde, 0xe0, 0x1d, 0x53, 0xfe, 0xd0, 0xed, 0xf5, 0xf6,
+      0xe3, 0x10, 0xbf, 0x8e, 0xf9, 0x31, 0x15, 0x13, 0xae, 0x40},
+     "XBP",
      18},
-    // WeOwn
-    {{0x14, 0x60, 0xa5, 0x80, 0x96, 0xd8, 0xa,  0x50, 0xa2, 0xf1,
-      0xf9, 0x56, 0xdd, 0xa4, 0x97, 0x61, 0x1f, 0xa4, 0xf1, 0x65},
-     "CHX",
+    // Smart Valor
+    {{0x29, 0x7e, 0x4e, 0x5e, 0x59, 0xad, 0x72, 0xb1, 0xb0, 0xa2,
+      0xfd, 0x44, 0x69, 0x29, 0xe7, 0x61, 0x17, 0xbe, 0xe,  0xa},
+     "VALOR",
      18},
-    // Chainlink
-    {{0x51, 0x49, 0x10, 0x77, 0x1a, 0xf9, 0xca, 0x65, 0x6a, 0xf8,
-      0x40, 0xdf, 0xf8, 0x3e, 0x82, 0x64, 0xec, 0xf9, 0x86, 0xca},
-     "LINK",
+    // Origin Dollar
+    {{0x2a, 0x8e, 0x1e, 0x67, 0x6e, 0xc2, 0x38, 0xd8, 0xa9, 0x92,
+      0x30, 0x7b, 0x49, 0x5b, 0x45, 0xb3, 0xfe, 0xaa, 0x5e, 0x86},
+     "OUSD",
      18},
-    // Change
-    {{0x7d, 0x4b, 0x8c, 0xce, 0x5,  0x91, 0xc9, 0x4,  0x4a, 0x22,
-      0xee, 0x54, 0x35, 0x33, 0xb7, 0x2e, 0x97, 0x6e, 0x36, 0xc3},
-     "CAG",
+    // Alpha Quark
+    {{0x2a, 0x9b, 0xdc, 0xff, 0x37, 0xab, 0x68, 0xb9, 0x5a, 0x53,
+      0x43, 0x5a, 0xdf, 0xd8, 0x89, 0x2e, 0x86, 0x8,  0x4f, 0x93},
+     "AQT",
      18},
-    // ChronoBase
-    {{0x9,  0x22, 0xf1, 0xd8, 0x8,  0xad, 0xc3, 0xa4, 0x44, 0x4b,
-      0xed, 0x2f, 0x73, 0xfa, 0xc5, 0x3a, 0x1a, 0x2a, 0x58, 0x59},
-     "TIK",
+    // HEX
+    {{0x2b, 0x59, 0x1e, 0x99, 0xaf, 0xe9, 0xf3, 0x2e, 0xaa, 0x62,
+      0x14, 0xf7, 0xb7, 0x62, 0x97, 0x68, 0xc4, 0xe,  0xeb, 0x39},
+     "HEX",
+     8},
+    // adbank
+    {{0x2b, 0xaa, 0xc9, 0x33, 0xc,  0xf9, 0xac, 0x47, 0x9d, 0x81,
+      0x91, 0x95, 0x79, 0x4d, 0x79, 0xad, 0xc,  0x76, 0x16, 0xe3},
+     "ADB",
      18},
-    // Chronologic
-    {{0xe8, 0x14, 0xae, 0xe9, 0x60, 0xa8, 0x52, 0x8,  0xc3, 0xdb,
-      0x54, 0x2c, 0x53, 0xe7, 0xd4, 0xa6, 0xc8, 0xd5, 0xf6, 0xf},
-     "DAY",
+    // SkinCoin
+    {{0x2b, 0xdc, 0xd, 0x42, 0x99, 0x60, 0x17, 0xfc, 0xe2, 0x14,
+      0xb2, 0x16, 0x7, 0xa5, 0x15, 0xda, 0x41, 0xa9, 0xe0, 0xc5},
+     "SKIN",
+     6},
+    // Taklimakan Network
+    {{0x2c, 0x36, 0x20, 0x4a, 0x7, 0x12, 0xa2, 0xa5, 0xe,  0x54,
+      0xa6, 0x2f, 0x7c, 0x4f, 0x1, 0x86, 0x7e, 0x78, 0xcb, 0x53},
+     "TAN",
      18},
-    // Cindicator
-    {{0xd4, 0xc4, 0x35, 0xf5, 0xb0, 0x9f, 0x85, 0x5c, 0x33, 0x17,
-      0xc8, 0x52, 0x4c, 0xb1, 0xf5, 0x86, 0xe4, 0x27, 0x95, 0xfa},
-     "CND",
+    // OST
+    {{0x2c, 0x4e, 0x8f, 0x2d, 0x74, 0x61, 0x13, 0xd0, 0x69, 0x6c,
+      0xe8, 0x9b, 0x35, 0xf0, 0xd8, 0xbf, 0x88, 0xe0, 0xae, 0xca},
+     "OST",
      18},
-    // Civic
-    {{0x41, 0xe5, 0x56, 0x0,  0x54, 0x82, 0x4e, 0xa6, 0xb0, 0x73,
-      0x2e, 0x65, 0x6e, 0x3a, 0xd6, 0x4e, 0x20, 0xe9, 0x4e, 0x45},
-     "CVC",
-     8},
-    // Civilization
-    {{0x37, 0xfe, 0xf,  0x6,  0x7f, 0xa8, 0x8,  0xff, 0xbd, 0xd1,
-      0x28, 0x91, 0xc0, 0x85, 0x85, 0x32, 0xcf, 0xe7, 0x36, 0x1d},
-     "CIV",
+    // Spectre.ai Utility
+    {{0x2c, 0x82, 0xc7, 0x3d, 0x5b, 0x34, 0xaa, 0x1,  0x59, 0x89,
+      0x46, 0x2b, 0x29, 0x48, 0xcd, 0x61, 0x6a, 0x37, 0x64, 0x1f},
+     "SXUT",
      18},
-    // ClearPoll
-    {{0x70, 0x5e, 0xe9, 0x6c, 0x1c, 0x16, 0x8,  0x42, 0xc9, 0x2c,
-      0x1a, 0xec, 0xfc, 0xff, 0xcc, 0xc9, 0xc4, 0x12, 0xe3, 0xd9},
-     "POLL",
+    // Vivid Labs
+    {{0x2c, 0x90, 0x23, 0xbb, 0xc5, 0x72, 0xff, 0x8d, 0xc1, 0x22,
+      0x8c, 0x78, 0x58, 0xa2, 0x80, 0x4,  0x6e, 0xa8, 0xc9, 0xe5},
+     "VID",
      18},
-    // Content Neutrality Network
-    {{0x87, 0x13, 0xd2, 0x66, 0x37, 0xcf, 0x49, 0xe1, 0xb6, 0xb4,
-      0xa7, 0xce, 0x57, 0x10, 0x6a, 0xab, 0xc9, 0x32, 0x53, 0x43},
-     "CNN",
+    // Viberate
+    {{0x2c, 0x97, 0x4b, 0x2d, 0xb,  0xa1, 0x71, 0x6e, 0x64, 0x4c,
+      0x1f, 0xc5, 0x99, 0x82, 0xa8, 0x9d, 0xdd, 0x2f, 0xf7, 0x24},
+     "VIB",
      18},
+    // DMarket
+    {{0x2c, 0xcb, 0xff, 0x3a, 0x4,  0x2c, 0x68, 0x71, 0x6e, 0xd2,
+      0xa2, 0xcb, 0xc,  0x54, 0x4a, 0x9f, 0x1d, 0x19, 0x35, 0xe1},
+     "DMT",
+     8},
+    // Etheroll
+    {{0x2e, 0x7,  0x1d, 0x29, 0x66, 0xaa, 0x7d, 0x8d, 0xec, 0xb1,
+      0x0,  0x58, 0x85, 0xba, 0x19, 0x77, 0xd6, 0x3,  0x8a, 0x65},
+     "DICE",
+     16},
+    // Revain
+    {{0x2e, 0xf5, 0x2e, 0xd7, 0xde, 0x8c, 0x5c, 0xe0, 0x3a, 0x4e,
+      0xf0, 0xef, 0xbe, 0x9b, 0x74, 0x50, 0xf2, 0xd7, 0xed, 0xc9},
+     "REV",
+     6},
+    // LatiumX
+    {{0x2f, 0x85, 0xe5, 0x2,  0xa9, 0x88, 0xaf, 0x76, 0xf7, 0xee,
+      0x6d, 0x83, 0xb7, 0xdb, 0x8d, 0x6c, 0xa,  0x82, 0x3b, 0xf9},
+     "LATX",
+     8},
     // CoinFi
     {{0x31, 0x36, 0xef, 0x85, 0x15, 0x92, 0xac, 0xf4, 0x9c, 0xa4,
       0xc8, 0x25, 0x13, 0x1e, 0x36, 0x41, 0x70, 0xfa, 0x32, 0xb3},
      "COFI",
      18},
-    // AMLT Network
-    {{0xca, 0xe,  0x72, 0x69, 0x60, 0xd,  0x35, 0x3f, 0x70, 0xb1,
-      0x4a, 0xd1, 0x18, 0xa4, 0x95, 0x75, 0x45, 0x5c, 0xf,  0x2f},
-     "AMLT",
+    // Reserve Rights
+    {{0x32, 0x6,  0x23, 0xb8, 0xe4, 0xff, 0x3,  0x37, 0x39, 0x31,
+      0x76, 0x9a, 0x31, 0xfc, 0x52, 0xa4, 0xe7, 0x8b, 0x5d, 0x70},
+     "RSR",
      18},
-    // Coinlancer
-    {{0xe8, 0x1d, 0x72, 0xd1, 0x4b, 0x15, 0x16, 0xe6, 0x8a, 0xc3,
-      0x19, 0xa,  0x46, 0xc9, 0x33, 0x2,  0xcc, 0x8e, 0xd6, 0xf},
-     "CL",
+    // Traxia
+    {{0x32, 0x9,  0xf9, 0x8b, 0xeb, 0xf0, 0x14, 0x9b, 0x76, 0x9c,
+      0xe2, 0x6d, 0x71, 0xf7, 0xae, 0xa8, 0xe4, 0x35, 0xef, 0xea},
+     "TMT",
      18},
-    // CoinLoan
-    {{0x20, 0x1,  0xf2, 0xa0, 0xcf, 0x80, 0x1e, 0xcf, 0xda, 0x62,
-      0x2f, 0x6c, 0x28, 0xfb, 0x6e, 0x10, 0xd8, 0x3,  0xd9, 0x69},
-     "CLT",
-     8},
-    // CoinMerge (ERC20)
-    {{0xc4, 0x8b, 0x48, 0x14, 0xfa, 0xed, 0x1c, 0xcc, 0x88, 0x5d,
-      0xd6, 0xfd, 0xe6, 0x2a, 0x64, 0x74, 0xae, 0xcb, 0xb1, 0x9a},
-     "CMERGE",
+    // Crystal Clear
+    {{0x33, 0x6f, 0x64, 0x6f, 0x87, 0xd9, 0xf6, 0xbc, 0x6e, 0xd4,
+      0x2d, 0xd4, 0x6e, 0x8b, 0x3f, 0xd9, 0xdb, 0xd1, 0x5c, 0x22},
+     "CCT",
      18},
-    // c0x
-    {{0xb3, 0x31, 0x9f, 0x5d, 0x18, 0xbc, 0xd,  0x84, 0xdd, 0x1b,
-      0x48, 0x25, 0xdc, 0xde, 0x5d, 0x5f, 0x72, 0x66, 0xd4, 0x7},
-     "CZRX",
-     8},
-    // cBAT
-    {{0x6c, 0x8c, 0x6b, 0x2,  0xe7, 0xb2, 0xbe, 0x14, 0xd4, 0xfa,
-      0x60, 0x22, 0xdf, 0xd6, 0xd7, 0x59, 0x21, 0xd9, 0xe,  0x4e},
-     "CBAT",
-     8},
-    // cETH
-    {{0x4d, 0xdc, 0x2d, 0x19, 0x39, 0x48, 0x92, 0x6d, 0x2, 0xf9,
-      0xb1, 0xfe, 0x9e, 0x1d, 0xaa, 0x7,  0x18, 0x27, 0xe, 0xd5},
-     "CETH",
+    // BLOCKv
+    {{0x34, 0xd,  0x2b, 0xde, 0x5e, 0xb2, 0x8c, 0x1e, 0xed, 0x91,
+      0xb2, 0xf7, 0x90, 0x72, 0x3e, 0x3b, 0x16, 0x6,  0x13, 0xb7},
+     "VEE",
+     18},
+    // U Network
+    {{0x35, 0x43, 0x63, 0x8e, 0xd4, 0xa9, 0x0,  0x6e, 0x48, 0x40,
+      0xb1, 0x5,  0x94, 0x42, 0x71, 0xbc, 0xea, 0x15, 0x60, 0x5d},
+     "UUU",
+     18},
+    // Dent
+    {{0x35, 0x97, 0xbf, 0xd5, 0x33, 0xa9, 0x9c, 0x9a, 0xa0, 0x83,
+      0x58, 0x7b, 0x7,  0x44, 0x34, 0xe6, 0x1e, 0xb0, 0xa2, 0x58},
+     "DENT",
      8},
-    // Compound
-    {{0xc0, 0xe,  0x94, 0xcb, 0x66, 0x2c, 0x35, 0x20, 0x28, 0x2e,
-      0x6f, 0x57, 0x17, 0x21, 0x40, 0x4,  0xa7, 0xf2, 0x68, 0x88},
-     "COMP",
+    // Bottos
+    {{0x36, 0x90, 0x5f, 0xc9, 0x32, 0x80, 0xf5, 0x23, 0x62, 0xa1,
+      0xcb, 0xab, 0x15, 0x1f, 0x25, 0xdc, 0x46, 0x74, 0x2f, 0xb5},
+     "BTO",
+     18},
+    // AidCoin
+    {{0x37, 0xe8, 0x78, 0x9b, 0xb9, 0x99, 0x6c, 0xac, 0x91, 0x56,
+      0xcd, 0x5f, 0x5f, 0xd3, 0x25, 0x99, 0xe6, 0xb9, 0x12, 0x89},
+     "AID",
+     18},
+    // Civilization
+    {{0x37, 0xfe, 0xf,  0x6,  0x7f, 0xa8, 0x8,  0xff, 0xbd, 0xd1,
+      0x28, 0x91, 0xc0, 0x85, 0x85, 0x32, 0xcf, 0xe7, 0x36, 0x1d},
+     "CIV",
+     18},
+    // AMO Coin
+    {{0x38, 0xc8, 0x7a, 0xa8, 0x9b, 0x2b, 0x8c, 0xd9, 0xb9, 0x5b,
+      0x73, 0x6e, 0x1f, 0xa7, 0xb6, 0x12, 0xea, 0x97, 0x21, 0x69},
+     "AMO",
      18},
     // cUSDC
     {{0x39, 0xaa, 0x39, 0xc0, 0x21, 0xdf, 0xba, 0xe8, 0xfa, 0xc5,
       0x45, 0x93, 0x66, 0x93, 0xac, 0x91, 0x7d, 0x5e, 0x75, 0x63},
      "CUSDC",
      8},
+    // Gameflip
+    {{0x3a, 0x1b, 0xda, 0x28, 0xad, 0xb5, 0xb0, 0xa8, 0x12, 0xa7,
+      0xcf, 0x10, 0xa1, 0x95, 0xc,  0x92, 0xf,  0x79, 0xbc, 0xd3},
+     "FLP",
+     18},
+    // Tokenbox
+    {{0x3a, 0x92, 0xbd, 0x39, 0x6a, 0xef, 0x82, 0xaf, 0x98, 0xeb,
+      0xc0, 0xaa, 0x90, 0x30, 0xd2, 0x5a, 0x23, 0xb1, 0x1c, 0x6b},
+     "TBX",
+     18},
     // ConnectJob
     {{0x3a, 0xbd, 0xff, 0x32, 0xf7, 0x6b, 0x42, 0xe7, 0x63, 0x5b,
       0xdb, 0x7e, 0x42, 0x5f, 0x2,  0x31, 0xa5, 0xf3, 0xab, 0x17},
      "CJT",
      18},
-    // COTI
-    {{0xdd, 0xb3, 0x42, 0x24, 0x97, 0xe6, 0x1e, 0x13, 0x54, 0x3b,
-      0xea, 0x6,  0x98, 0x9c, 0x7,  0x89, 0x11, 0x75, 0x55, 0xc5},
-     "COTI",
+    // Privatix
+    {{0x3a, 0xdf, 0xc4, 0x99, 0x9f, 0x77, 0xd0, 0x4c, 0x83, 0x41,
+      0xba, 0xc5, 0xf3, 0xa7, 0x6f, 0x58, 0xdf, 0xf5, 0xb3, 0x7a},
+     "PRIX",
+     8},
+    // Nifty League
+    {{0x3c, 0x8d, 0x2f, 0xce, 0x49, 0x90, 0x6e, 0x11, 0xe7, 0x1c,
+      0xb1, 0x6f, 0xa0, 0xff, 0xeb, 0x2b, 0x16, 0xc2, 0x96, 0x38},
+     "NFTL",
      18},
-    // CPChain
-    {{0xfa, 0xe4, 0xee, 0x59, 0xcd, 0xd8, 0x6e, 0x3b, 0xe9, 0xe8,
-      0xb9, 0xb,  0x53, 0xaa, 0x86, 0x63, 0x27, 0xd7, 0xc0, 0x90},
-     "CPC",
+    // YOUcash
+    {{0x3d, 0x37, 0x14, 0x13, 0xdd, 0x54, 0x89, 0xf3, 0xa0, 0x4c,
+      0x7,  0xc0, 0xc2, 0xce, 0x36, 0x9c, 0x20, 0x98, 0x6c, 0xeb},
+     "YOUC",
+     10},
+    // Rotharium
+    {{0x3f, 0xd8, 0xf3, 0x9a, 0x96, 0x2e, 0xfd, 0xa0, 0x49, 0x56,
+      0x98, 0x1c, 0x31, 0xab, 0x89, 0xfa, 0xb5, 0xfb, 0x8b, 0xc8},
+     "RTH",
      18},
-    // Creditcoin
-    {{0xa3, 0xee, 0x21, 0xc3, 0x6,  0xa7, 0x0,  0xe6, 0x82, 0xab,
-      0xcd, 0xfe, 0x9b, 0xaa, 0x6a, 0x8,  0xf3, 0x82, 0x4,  0x19},
-     "CTC",
+    // MobileGo
+    {{0x40, 0x39, 0x50, 0x44, 0xac, 0x3c, 0xc,  0x57, 0x5,  0x19,
+      0x6,  0xda, 0x93, 0x8b, 0x54, 0xbd, 0x65, 0x57, 0xf2, 0x12},
+     "MGO",
+     8},
+    // REN
+    {{0x40, 0x8e, 0x41, 0x87, 0x6c, 0xcc, 0xdc, 0xf, 0x92, 0x21,
+      0x6,  0x0,  0xef, 0x50, 0x37, 0x26, 0x56, 0x5, 0x2a, 0x38},
+     "REN",
      18},
-    // CRYCASH
-    {{0xf4, 0x1e, 0x5f, 0xbc, 0x2f, 0x6a, 0xac, 0x20, 0xd, 0xd8,
-      0x61, 0x9e, 0x12, 0x1c, 0xe1, 0xf0, 0x5d, 0x15, 0x0, 0x77},
-     "CRC",
+    // Odyssey
+    {{0x40, 0x92, 0x67, 0x8e, 0x4e, 0x78, 0x23, 0xf,  0x46, 0xa1,
+      0x53, 0x4c, 0xf,  0xbc, 0x8f, 0xa3, 0x97, 0x80, 0x89, 0x2b},
+     "OCN",
      18},
-    // Cryptobuyer
-    {{0x8,  0xaa, 0xe,  0xd0, 0x4,  0x7,  0x36, 0xdd, 0x28, 0xd4,
-      0xc8, 0xb1, 0x6a, 0xb4, 0x53, 0xb3, 0x68, 0x24, 0x8d, 0x19},
-     "XPT",
+    // SALT
+    {{0x41, 0x56, 0xd3, 0x34, 0x2d, 0x5c, 0x38, 0x5a, 0x87, 0xd2,
+      0x64, 0xf9, 0x6,  0x53, 0x73, 0x35, 0x92, 0x0,  0x5,  0x81},
+     "SALT",
+     8},
+    // FUTURAX
+    {{0x41, 0x87, 0x5c, 0x23, 0x32, 0xb0, 0x87, 0x7c, 0xdf, 0xaa,
+      0x69, 0x9b, 0x64, 0x14, 0x2,  0xb7, 0xd4, 0x64, 0x2c, 0x32},
+     "FTXT",
+     8},
+    // Dragonchain
+    {{0x41, 0x9c, 0x4d, 0xb4, 0xb9, 0xe2, 0x5d, 0x6d, 0xb2, 0xad,
+      0x96, 0x91, 0xcc, 0xb8, 0x32, 0xc8, 0xd9, 0xfd, 0xa0, 0x5e},
+     "DRGN",
      18},
-    // CryptoFranc
-    {{0xb4, 0x27, 0x20, 0x71, 0xec, 0xad, 0xd6, 0x9d, 0x93, 0x3a,
-      0xdc, 0xd1, 0x9c, 0xa9, 0x9f, 0xe8, 0x6,  0x64, 0xfc, 0x8},
-     "XCHF",
+    // FUN
+    {{0x41, 0x9d, 0xd,  0x8b, 0xdd, 0x9a, 0xf5, 0xe6, 0x6,  0xae,
+      0x22, 0x32, 0xed, 0x28, 0x5a, 0xff, 0x19, 0xe,  0x71, 0x1b},
+     "FUN",
+     8},
+    // Medicalchain
+    {{0x41, 0xdb, 0xec, 0xc1, 0xcd, 0xc5, 0x51, 0x7c, 0x6f, 0x76,
+      0xf6, 0xa6, 0xe8, 0x36, 0xad, 0xbe, 0xe2, 0x75, 0x4d, 0xe3},
+     "MTN",
      18},
-    // Cryptopay
-    {{0xe,  0xbb, 0x61, 0x42, 0x4,  0xe4, 0x7c, 0x9,  0xb6, 0xc3,
-      0xfe, 0xb9, 0xaa, 0xec, 0xad, 0x8e, 0xe0, 0x60, 0xe2, 0x3e},
-     "CPAY",
+    // Civic
+    {{0x41, 0xe5, 0x56, 0x0,  0x54, 0x82, 0x4e, 0xa6, 0xb0, 0x73,
+      0x2e, 0x65, 0x6e, 0x3a, 0xd6, 0x4e, 0x20, 0xe9, 0x4e, 0x45},
+     "CVC",
+     8},
+    // GoNetwork
+    {{0x42, 0x3b, 0x5f, 0x62, 0xb3, 0x28, 0xd0, 0xd6, 0xd4, 0x48,
+      0x70, 0xf4, 0xee, 0xe3, 0x16, 0xbe, 0xfa, 0xb,  0x2d, 0xf5},
+     "GOT",
      18},
-    // CryptoSoul
-    {{0xbb, 0x1f, 0x24, 0xc0, 0xc1, 0x55, 0x4b, 0x99, 0x90, 0x22,
-      0x2f, 0x3,  0x6b, 0xa,  0xad, 0x6e, 0xe4, 0xca, 0xec, 0x29},
-     "SOUL",
+    // Loom Network (NEW)
+    {{0x42, 0x47, 0x6f, 0x74, 0x42, 0x92, 0x10, 0x7e, 0x34, 0x51,
+      0x9f, 0x9c, 0x35, 0x79, 0x27, 0x7,  0x4e, 0xa3, 0xf7, 0x5d},
+     "LOOM",
      18},
-    // Crystal Clear
-    {{0x33, 0x6f, 0x64, 0x6f, 0x87, 0xd9, 0xf6, 0xbc, 0x6e, 0xd4,
-      0x2d, 0xd4, 0x6e, 0x8b, 0x3f, 0xd9, 0xdb, 0xd1, 0x5c, 0x22},
-     "CCT",
+    // Fortuna
+    {{0x42, 0x70, 0xbb, 0x23, 0x8f, 0x6d, 0xd8, 0xb1, 0xc3, 0xca,
+      0x1,  0xf9, 0x6c, 0xa6, 0x5b, 0x26, 0x47, 0xc0, 0x6d, 0x3c},
+     "FOTA",
      18},
-    // Cube Intelligence
-    {{0x62, 0x2d, 0xff, 0xcc, 0x4e, 0x83, 0xc6, 0x4b, 0xa9, 0x59,
-      0x53, 0xa,  0x5a, 0x55, 0x80, 0x68, 0x7a, 0x57, 0x58, 0x1b},
-     "AUTO",
+    // AiLink
+    {{0x42, 0x89, 0xc0, 0x43, 0xa1, 0x23, 0x92, 0xf1, 0x2,  0x73,
+      0x7,  0xfb, 0x58, 0x27, 0x2d, 0x8e, 0xbd, 0x85, 0x39, 0x12},
+     "ALI",
      18},
-    // CyberMusic
-    {{0x78, 0xc2, 0x92, 0xd1, 0x44, 0x5e, 0x6b, 0x95, 0x58, 0xbf,
-      0x42, 0xe8, 0xbc, 0x36, 0x92, 0x71, 0xde, 0xd0, 0x62, 0xea},
-     "CYMT",
-     8},
-    // CyberVein
-    {{0xbe, 0x42, 0x8c, 0x38, 0x67, 0xf0, 0x5d, 0xea, 0x2a, 0x89,
-      0xfc, 0x76, 0xa1, 0x2,  0xb5, 0x44, 0xea, 0xc7, 0xf7, 0x72},
-     "CVT",
+    // Pickle Finance
+    {{0x42, 0x98, 0x81, 0x67, 0x2b, 0x9a, 0xe4, 0x2b, 0x8e, 0xba,
+      0xe,  0x26, 0xcd, 0x9c, 0x73, 0x71, 0x1b, 0x89, 0x1c, 0xa5},
+     "PICKLE",
      18},
-    // DAEX
-    {{0xb,  0x4b, 0xdc, 0x47, 0x87, 0x91, 0x89, 0x72, 0x74, 0x65,
-      0x2d, 0xc1, 0x5e, 0xf5, 0xc1, 0x35, 0xca, 0xe6, 0x1e, 0x60},
-     "DAX",
+    // SpankChain
+    {{0x42, 0xd6, 0x62, 0x2d, 0xec, 0xe3, 0x94, 0xb5, 0x49, 0x99,
+      0xfb, 0xd7, 0x3d, 0x10, 0x81, 0x23, 0x80, 0x6f, 0x6a, 0x18},
+     "SPANK",
      18},
-    // Dai
-    {{0x6b, 0x17, 0x54, 0x74, 0xe8, 0x90, 0x94, 0xc4, 0x4d, 0xa9,
-      0x8b, 0x95, 0x4e, 0xed, 0xea, 0xc4, 0x95, 0x27, 0x1d, 0xf},
-     "DAI",
+    // dForce
+    {{0x43, 0x1a, 0xd2, 0xff, 0x6a, 0x9c, 0x36, 0x58, 0x5,  0xeb,
+      0xad, 0x47, 0xee, 0x2,  0x11, 0x48, 0xd6, 0xf7, 0xdb, 0xe0},
+     "DF",
      18},
-    // Dalecoin
-    {{0x7,  0xd9, 0xe4, 0x9e, 0xa4, 0x2,  0x19, 0x4b, 0xf4, 0x8a,
-      0x82, 0x76, 0xda, 0xfb, 0x16, 0xe4, 0xed, 0x63, 0x33, 0x17},
-     "DALC",
+    // Opus
+    {{0x43, 0x55, 0xfc, 0x16, 0xf,  0x74, 0x32, 0x8f, 0x9b, 0x38,
+      0x3d, 0xf2, 0xec, 0x58, 0x9b, 0xb3, 0xdf, 0xd8, 0x2b, 0xa0},
+     "OPT",
+     18},
+    // Eltcoin
+    {{0x44, 0x19, 0x7a, 0x4c, 0x44, 0xd6, 0xa0, 0x59, 0x29, 0x7c,
+      0xaf, 0x6b, 0xe4, 0xf7, 0xe1, 0x72, 0xbd, 0x56, 0xca, 0xaf},
+     "ELTCOIN",
      8},
-    // DAOstack
-    {{0x54, 0x3f, 0xf2, 0x27, 0xf6, 0x4a, 0xa1, 0x7e, 0xa1, 0x32,
-      0xbf, 0x98, 0x86, 0xca, 0xb5, 0xdb, 0x55, 0xdc, 0xad, 0xdf},
-     "GEN",
+    // P2P solutions foundation
+    {{0x45, 0x27, 0xa3, 0xb4, 0xa8, 0xa1, 0x50, 0x40, 0x30, 0x90,
+      0xa9, 0x9b, 0x87, 0xef, 0xfc, 0x96, 0xf2, 0x19, 0x50, 0x47},
+     "P2PS",
+     8},
+    // Orchid Protocol
+    {{0x45, 0x75, 0xf4, 0x13, 0x8,  0xec, 0x14, 0x83, 0xf3, 0xd3,
+      0x99, 0xaa, 0x9a, 0x28, 0x26, 0xd7, 0x4d, 0xa1, 0x3d, 0xeb},
+     "OXT",
      18},
-    // DATx
-    {{0xab, 0xbb, 0xb6, 0x44, 0x7b, 0x68, 0xff, 0xd6, 0x14, 0x1d,
-      0xa7, 0x7c, 0x18, 0xc7, 0xb5, 0x87, 0x6e, 0xd6, 0xc5, 0xab},
-     "DATX",
+    // PAX Gold
+    {{0x45, 0x80, 0x48, 0x80, 0xde, 0x22, 0x91, 0x3d, 0xaf, 0xe0,
+      0x9f, 0x49, 0x80, 0x84, 0x8e, 0xce, 0x6e, 0xcb, 0xaf, 0x78},
+     "PAXG",
      18},
-    // DAV Network
-    {{0xd8, 0x2d, 0xf0, 0xab, 0xd3, 0xf5, 0x14, 0x25, 0xeb, 0x15,
-      0xef, 0x75, 0x80, 0xfd, 0xa5, 0x57, 0x27, 0x87, 0x5f, 0x14},
-     "DAV",
+    // Kind Ads
+    {{0x46, 0x18, 0x51, 0x9d, 0xe4, 0xc3, 0x4,  0xf3, 0x44, 0x4f,
+      0xfa, 0x7f, 0x81, 0x2d, 0xdd, 0xc2, 0x97, 0x1c, 0xc6, 0x88},
+     "KIND",
+     8},
+    // KRYLL
+    {{0x46, 0x4e, 0xbe, 0x77, 0xc2, 0x93, 0xe4, 0x73, 0xb4, 0x8c,
+      0xfe, 0x96, 0xdd, 0xcf, 0x88, 0xfc, 0xf7, 0xbf, 0xda, 0xc0},
+     "KRL",
      18},
-    // Debitum Network
-    {{0x15, 0x12, 0x2,  0xc9, 0xc1, 0x8e, 0x49, 0x56, 0x56, 0xf3,
-      0x72, 0x28, 0x1f, 0x49, 0x3e, 0xb7, 0x69, 0x89, 0x61, 0xd5},
-     "DEB",
+    // PlayGame
+    {{0x47, 0xe6, 0x7b, 0xa6, 0x6b, 0x6,  0x99, 0x50, 0xf,  0x18,
+      0xa5, 0x3f, 0x94, 0xe2, 0xb9, 0xdb, 0x3d, 0x47, 0x43, 0x7e},
+     "PXG",
      18},
-    // DecentBet
-    {{0x9b, 0x68, 0xbf, 0xae, 0x21, 0xdf, 0x5a, 0x51, 0x9,  0x31,
-      0xa2, 0x62, 0xce, 0xcf, 0x63, 0xf4, 0x13, 0x38, 0xf2, 0x64},
-     "DBET",
+    // ShowHand
+    {{0x48, 0xc1, 0xb2, 0xf3, 0xef, 0xa8, 0x5f, 0xba, 0xfb, 0x2a,
+      0xb9, 0x51, 0xbf, 0x4b, 0xa8, 0x60, 0xa0, 0x8c, 0xdb, 0xb7},
+     "HAND",
      18},
-    // Decentraland
-    {{0xf,  0x5d, 0x2f, 0xb2, 0x9f, 0xb7, 0xd3, 0xcf, 0xee, 0x44,
-      0x4a, 0x20, 0x2,  0x98, 0xf4, 0x68, 0x90, 0x8c, 0xc9, 0x42},
-     "MANA",
+    // Cartesi
+    {{0x49, 0x16, 0x4, 0xc0, 0xfd, 0xf0, 0x83, 0x47, 0xdd, 0x1f,
+      0xa4, 0xee, 0x6, 0x2a, 0x82, 0x2a, 0x5d, 0xd0, 0x6b, 0x5d},
+     "CTSI",
      18},
-    // Meme
-    {{0xd5, 0x52, 0x5d, 0x39, 0x78, 0x98, 0xe5, 0x50, 0x20, 0x75,
-      0xea, 0x5e, 0x83, 0xd,  0x89, 0x14, 0xf6, 0xf0, 0xaf, 0xfe},
-     "MEME",
-     8},
-    // DeltaChain
-    {{0xde, 0x1e, 0xa, 0xe6, 0x10, 0x1b, 0x46, 0x52, 0xc,  0xf6,
-      0x6f, 0xdc, 0xb, 0x10, 0x59, 0xc5, 0xcc, 0x3d, 0x10, 0x6c},
-     "DELTA",
-     8},
-    // Dent
-    {{0x35, 0x97, 0xbf, 0xd5, 0x33, 0xa9, 0x9c, 0x9a, 0xa0, 0x83,
-      0x58, 0x7b, 0x7,  0x44, 0x34, 0xe6, 0x1e, 0xb0, 0xa2, 0x58},
-     "DENT",
-     8},
-    // Dentacoin
-    {{0x8,  0xd3, 0x2b, 0xd,  0xa6, 0x3e, 0x2c, 0x3b, 0xcf, 0x80,
-      0x19, 0xc9, 0xc5, 0xd8, 0x49, 0xd7, 0xa9, 0xd7, 0x91, 0xe6},
-     "DCN",
+    // FOAM
+    {{0x49, 0x46, 0xfc, 0xea, 0x7c, 0x69, 0x26, 0x6,  0xe8, 0x90,
+      0x80, 0x2,  0xe5, 0x5a, 0x58, 0x2a, 0xf4, 0x4a, 0xc1, 0x21},
+     "FOAM",
      18},
-    // Dether
-    {{0x5a, 0xdc, 0x96, 0x1d, 0x6a, 0xc3, 0xf7, 0x6,  0x2d, 0x2e,
-      0xa4, 0x5f, 0xef, 0xb8, 0xd8, 0x16, 0x7d, 0x44, 0xb1, 0x90},
-     "DTH",
+    // Quant
+    {{0x4a, 0x22, 0xe,  0x60, 0x96, 0xb2, 0x5e, 0xad, 0xb8, 0x83,
+      0x58, 0xcb, 0x44, 0x6,  0x8a, 0x32, 0x48, 0x25, 0x46, 0x75},
+     "QNT",
      18},
-    // Devery
-    {{0x92, 0x31, 0x8,  0xa4, 0x39, 0xc4, 0xe8, 0xc2, 0x31, 0x5c,
-      0x4f, 0x65, 0x21, 0xe5, 0xce, 0x95, 0xb4, 0x4e, 0x9b, 0x4c},
-     "EVE",
+    // Morpheus Labs
+    {{0x4a, 0x52, 0x7d, 0x8f, 0xc1, 0x3c, 0x52, 0x3,  0xab, 0x24,
+      0xba, 0x9,  0x44, 0xf4, 0xcb, 0x14, 0x65, 0x8d, 0x1d, 0xb6},
+     "MITX",
      18},
-    // dForce
-    {{0x43, 0x1a, 0xd2, 0xff, 0x6a, 0x9c, 0x36, 0x58, 0x5,  0xeb,
-      0xad, 0x47, 0xee, 0x2,  0x11, 0x48, 0xd6, 0xf7, 0xdb, 0xe0},
-     "DF",
+    // NAOS Finance
+    {{0x4a, 0x61, 0x5b, 0xb7, 0x16, 0x62, 0x10, 0xcc, 0xe2, 0xe,
+      0x66, 0x42, 0xa6, 0xf8, 0xfb, 0x5d, 0x4d, 0x4,  0x44, 0x96},
+     "NAOS",
+     18},
+    // Sakura Bloom
+    {{0x4a, 0xf3, 0x28, 0xc5, 0x29, 0x21, 0x70, 0x6d, 0xcb, 0x73,
+      0x9f, 0x25, 0x78, 0x62, 0x10, 0x49, 0x91, 0x69, 0xaf, 0xe6},
+     "SKB",
+     8},
+    // WePower
+    {{0x4c, 0xf4, 0x88, 0x38, 0x7f, 0x3,  0x5f, 0xf0, 0x8c, 0x37,
+      0x15, 0x15, 0x56, 0x2c, 0xba, 0x71, 0x2f, 0x90, 0x15, 0xd4},
+     "WPR",
+     18},
+    // Mysterium
+    {{0x4c, 0xf8, 0x9c, 0xa0, 0x6a, 0xd9, 0x97, 0xbc, 0x73, 0x2d,
+      0xc8, 0x76, 0xed, 0x2a, 0x7f, 0x26, 0xa9, 0xe7, 0xf3, 0x61},
+     "MYST",
+     18},
+    // cETH
+    {{0x4d, 0xdc, 0x2d, 0x19, 0x39, 0x48, 0x92, 0x6d, 0x2, 0xf9,
+      0xb1, 0xfe, 0x9e, 0x1d, 0xaa, 0x7,  0x18, 0x27, 0xe, 0xd5},
+     "CETH",
+     8},
+    // Xaurum
+    {{0x4d, 0xf8, 0x12, 0xf6, 0x6,  0x4d, 0xef, 0x1e, 0x5e, 0x2,
+      0x9f, 0x1c, 0xa8, 0x58, 0x77, 0x7c, 0xc9, 0x8d, 0x2d, 0x81},
+     "XAUR",
+     8},
+    // Fantom
+    {{0x4e, 0x15, 0x36, 0x1f, 0xd6, 0xb4, 0xbb, 0x60, 0x9f, 0xa6,
+      0x3c, 0x81, 0xa2, 0xbe, 0x19, 0xd8, 0x73, 0x71, 0x78, 0x70},
+     "FTM",
      18},
-    // DigixDAO
-    {{0xe0, 0xb7, 0x92, 0x7c, 0x4a, 0xf2, 0x37, 0x65, 0xcb, 0x51,
-      0x31, 0x4a, 0xe,  0x5,  0x21, 0xa9, 0x64, 0x5f, 0xe,  0x2a},
-     "DGD",
-     9},
     // Digix Gold
     {{0x4f, 0x3a, 0xfe, 0xc4, 0xe5, 0xa3, 0xf2, 0xa6, 0xa1, 0xa4,
       0x11, 0xde, 0xf7, 0xd7, 0xdf, 0xe5, 0xe,  0xe0, 0x57, 0xbf},
      "DGX",
      9},
+    // Celer Network
+    {{0x4f, 0x92, 0x54, 0xc8, 0x3e, 0xb5, 0x25, 0xf9, 0xfc, 0xf3,
+      0x46, 0x49, 0xb,  0xbb, 0x3e, 0xd2, 0x8a, 0x81, 0xc6, 0x67},
+     "CELR",
+     18},
     // Dirty Finance
     {{0x4f, 0xab, 0x74, 0x7,  0x79, 0xc7, 0x3a, 0xa3, 0x94, 0x5a,
       0x5c, 0xf6, 0x2,  0x5b, 0xf1, 0xb0, 0xe7, 0xf6, 0x34, 0x9c},
      "DIRTY",
      18},
-    // district0x
-    {{0xa,  0xbd, 0xac, 0xe7, 0xd,  0x37, 0x90, 0x23, 0x5a, 0xf4,
-      0x48, 0xc8, 0x85, 0x47, 0x60, 0x3b, 0x94, 0x56, 0x4,  0xea},
-     "DNT",
+    // Binance USD
+    {{0x4f, 0xab, 0xb1, 0x45, 0xd6, 0x46, 0x52, 0xa9, 0x48, 0xd7,
+      0x25, 0x33, 0x2,  0x3f, 0x6e, 0x7a, 0x62, 0x3c, 0x7c, 0x53},
+     "BUSD",
      18},
-    // DMarket
-    {{0x2c, 0xcb, 0xff, 0x3a, 0x4,  0x2c, 0x68, 0x71, 0x6e, 0xd2,
-      0xa2, 0xcb, 0xc,  0x54, 0x4a, 0x9f, 0x1d, 0x19, 0x35, 0xe1},
-     "DMT",
-     8},
-    // DomRaider
-    {{0x9a, 0xf4, 0xf2, 0x69, 0x41, 0x67, 0x7c, 0x70, 0x6c, 0xfe,
-      0xcf, 0x6d, 0x33, 0x79, 0xff, 0x1,  0xbb, 0x85, 0xd5, 0xab},
-     "DRT",
-     8},
-    // Donkey
-    {{0xe4, 0xf6, 0xd4, 0x6c, 0x24, 0x4b, 0xb7, 0xcf, 0x3e, 0x21,
-      0x8c, 0xdf, 0xb5, 0xc3, 0x5c, 0xf9, 0xa4, 0xd9, 0xc9, 0x20},
-     "DONK",
+    // NuCypher
+    {{0x4f, 0xe8, 0x32, 0x13, 0xd5, 0x63, 0x8, 0x33, 0xe,  0xc3,
+      0x2,  0xa8, 0xbd, 0x64, 0x1f, 0x1d, 0x1, 0x13, 0xa4, 0xcc},
+     "NU",
      18},
-    // Dovu
-    {{0xac, 0x32, 0x11, 0xa5, 0x2,  0x54, 0x14, 0xaf, 0x28, 0x66,
-      0xff, 0x9,  0xc2, 0x3f, 0xc1, 0x8b, 0xc9, 0x7e, 0x79, 0xb1},
-     "DOV",
+    // Blocksquare
+    {{0x50, 0x9a, 0x38, 0xb7, 0xa1, 0xcc, 0xd,  0xcd, 0x83, 0xaa,
+      0x9d, 0x6,  0x21, 0x46, 0x63, 0xd9, 0xec, 0x7c, 0x7f, 0x4a},
+     "BST",
      18},
-    // DPRating
-    {{0xe8, 0x66, 0x3a, 0x64, 0xa9, 0x61, 0x69, 0xff, 0x4d, 0x95,
-      0xb4, 0x29, 0x9e, 0x7a, 0xe9, 0xa7, 0x6b, 0x90, 0x5b, 0x31},
-     "RATING",
-     8},
-    // Dragonchain
-    {{0x41, 0x9c, 0x4d, 0xb4, 0xb9, 0xe2, 0x5d, 0x6d, 0xb2, 0xad,
-      0x96, 0x91, 0xcc, 0xb8, 0x32, 0xc8, 0xd9, 0xfd, 0xa0, 0x5e},
-     "DRGN",
+    // indaHash
+    {{0x51, 0x36, 0xc9, 0x8a, 0x80, 0x81, 0x1c, 0x3f, 0x46, 0xbd,
+      0xda, 0x8b, 0x5c, 0x45, 0x55, 0xcf, 0xd9, 0xf8, 0x12, 0xf0},
+     "IDH",
+     6},
+    // Chainlink
+    {{0x51, 0x49, 0x10, 0x77, 0x1a, 0xf9, 0xca, 0x65, 0x6a, 0xf8,
+      0x40, 0xdf, 0xf8, 0x3e, 0x82, 0x64, 0xec, 0xf9, 0x86, 0xca},
+     "LINK",
      18},
-    // easyMine
-    {{0x95, 0x1,  0xbf, 0xc4, 0x88, 0x97, 0xdc, 0xee, 0xad, 0xf7,
-      0x31, 0x13, 0xef, 0x63, 0x5d, 0x2f, 0xf7, 0xee, 0x4b, 0x97},
-     "EMT",
+    // Governor DAO
+    {{0x51, 0x5d, 0x7e, 0x9d, 0x75, 0xe2, 0xb7, 0x6d, 0xb6, 0xf,
+      0x8a, 0x5,  0x1c, 0xd8, 0x90, 0xeb, 0xa2, 0x32, 0x86, 0xbc},
+     "GDAO",
      18},
-    // EchoLink
-    {{0xa6, 0xa8, 0x40, 0xe5, 0xb,  0xca, 0xa5, 0xd,  0xa0, 0x17,
-      0xb9, 0x1a, 0xd,  0x86, 0xb8, 0xb2, 0xd4, 0x11, 0x56, 0xee},
-     "EKO",
+    // Moeda Loyalty Points
+    {{0x51, 0xdb, 0x5a, 0xd3, 0x5c, 0x67, 0x1a, 0x87, 0x20, 0x7d,
+      0x88, 0xfc, 0x11, 0xd5, 0x93, 0xac, 0xc,  0x84, 0x15, 0xbd},
+     "MDA",
      18},
-    // Edgeless
-    {{0x8,  0x71, 0x1d, 0x3b, 0x2,  0xc8, 0x75, 0x8f, 0x2f, 0xb3,
-      0xab, 0x4e, 0x80, 0x22, 0x84, 0x18, 0xa7, 0xf8, 0xe3, 0x9c},
-     "EDG",
+    // pTokens BTC [OLD]
+    {{0x52, 0x28, 0xa2, 0x2e, 0x72, 0xcc, 0xc5, 0x2d, 0x41, 0x5e,
+      0xcf, 0xd1, 0x99, 0xf9, 0x9d, 0x6,  0x65, 0xe7, 0x73, 0x3b},
+     "PBTC",
      18},
-    // EDUCare
-    {{0xba, 0xb1, 0x65, 0xdf, 0x94, 0x55, 0xaa, 0xf,  0x2a, 0xed,
-      0x1f, 0x25, 0x65, 0x52, 0xb,  0x91, 0xdd, 0xad, 0xb4, 0xc8},
-     "EKT",
-     8},
-    // Egretia
-    {{0x8e, 0x1b, 0x44, 0x8e, 0xc7, 0xad, 0xfc, 0x7f, 0xa3, 0x5f,
-      0xc2, 0xe8, 0x85, 0x67, 0x8b, 0xd3, 0x23, 0x17, 0x6e, 0x34},
-     "EGT",
-     18},
-    // Electrify.Asia
-    {{0xd4, 0x9f, 0xf1, 0x36, 0x61, 0x45, 0x13, 0x13, 0xca, 0x15,
-      0x53, 0xfd, 0x69, 0x54, 0xbd, 0x1d, 0x9b, 0x6e, 0x2,  0xb9},
-     "ELEC",
-     18},
-    // Eltcoin
-    {{0x44, 0x19, 0x7a, 0x4c, 0x44, 0xd6, 0xa0, 0x59, 0x29, 0x7c,
-      0xaf, 0x6b, 0xe4, 0xf7, 0xe1, 0x72, 0xbd, 0x56, 0xca, 0xaf},
-     "ELTCOIN",
+    // Blue Protocol
+    {{0x53, 0x9e, 0xfe, 0x69, 0xbc, 0xdd, 0x21, 0xa8, 0x3e, 0xfd,
+      0x91, 0x22, 0x57, 0x1a, 0x64, 0xcc, 0x25, 0xe0, 0x28, 0x2b},
+     "BLUE",
      8},
-    // Elysian
-    {{0xa9, 0x55, 0x92, 0xdc, 0xff, 0xa3, 0xc0, 0x80, 0xb4, 0xb4,
-      0xe,  0x45, 0x9c, 0x5f, 0x56, 0x92, 0xf6, 0x7d, 0xb7, 0xf8},
-     "ELY",
-     18},
-    // EncrypGen
-    {{0xef, 0x63, 0x44, 0xde, 0x1f, 0xcf, 0xc5, 0xf4, 0x8c, 0x30,
-      0x23, 0x4c, 0x16, 0xc1, 0x38, 0x9e, 0x8c, 0xdc, 0x57, 0x2c},
-     "DNA",
-     18},
-    // Endor Protocol
-    {{0xc5, 0x28, 0xc2, 0x8f, 0xec, 0xa,  0x90, 0xc0, 0x83, 0x32,
-      0x8b, 0xc4, 0x5f, 0x58, 0x7e, 0xe2, 0x15, 0x76, 0xa,  0xf},
-     "EDR",
+    // DAOstack
+    {{0x54, 0x3f, 0xf2, 0x27, 0xf6, 0x4a, 0xa1, 0x7e, 0xa1, 0x32,
+      0xbf, 0x98, 0x86, 0xca, 0xb5, 0xdb, 0x55, 0xdc, 0xad, 0xdf},
+     "GEN",
      18},
-    // Enigma
-    {{0xf0, 0xee, 0x6b, 0x27, 0xb7, 0x59, 0xc9, 0x89, 0x3c, 0xe4,
-      0xf0, 0x94, 0xb4, 0x9a, 0xd2, 0x8f, 0xd1, 0x5a, 0x23, 0xe4},
-     "ENG",
-     8},
-    // Enjin Coin
-    {{0xf6, 0x29, 0xcb, 0xd9, 0x4d, 0x37, 0x91, 0xc9, 0x25, 0x1,
-      0x52, 0xbd, 0x8d, 0xfb, 0xdf, 0x38, 0xe,  0x2a, 0x3b, 0x9c},
-     "ENJ",
+    // XYO Network
+    {{0x55, 0x29, 0x6f, 0x69, 0xf4, 0xe, 0xa6, 0xd2, 0xe,  0x47,
+      0x85, 0x33, 0xc1, 0x5a, 0x6b, 0x8, 0xb6, 0x54, 0xe7, 0x58},
+     "XYO",
      18},
-    // eosDAC
-    {{0x7e, 0x9e, 0x43, 0x1a, 0xb,  0x8c, 0x4d, 0x53, 0x2c, 0x74,
-      0x5b, 0x10, 0x43, 0xc7, 0xfa, 0x29, 0xa4, 0x8d, 0x4f, 0xba},
-     "EOSDAC",
+    // Bread
+    {{0x55, 0x8e, 0xc3, 0x15, 0x2e, 0x2e, 0xb2, 0x17, 0x49, 0x5,
+      0xcd, 0x19, 0xae, 0xa4, 0xe3, 0x4a, 0x23, 0xde, 0x9a, 0xd6},
+     "BRD",
      18},
-    // Eristica
-    {{0x92, 0xa5, 0xb0, 0x4d, 0xe,  0xd5, 0xd9, 0x4d, 0x7a, 0x19,
-      0x3d, 0x1d, 0x33, 0x4d, 0x3d, 0x16, 0x99, 0x6f, 0x4e, 0x13},
-     "ERT",
+    // Bluzelle
+    {{0x57, 0x32, 0x4,  0x6a, 0x88, 0x37, 0x4, 0x40, 0x4f, 0x28,
+      0x4c, 0xe4, 0x1f, 0xfa, 0xdd, 0x5b, 0x0, 0x7f, 0xd6, 0x68},
+     "BLZ",
      18},
-    // ETHBNT Relay
-    {{0xb1, 0xcd, 0x6e, 0x41, 0x53, 0xb2, 0xa3, 0x90, 0xcf, 0x0,
-      0xa6, 0x55, 0x6b, 0xf,  0xc1, 0x45, 0x8c, 0x4a, 0x55, 0x33},
-     "ETHBNT",
+    // VeriDocGlobal
+    {{0x57, 0xc7, 0x5e, 0xcc, 0xc8, 0x55, 0x71, 0x36, 0xd3, 0x26,
+      0x19, 0xa1, 0x91, 0xfb, 0xcd, 0xc8, 0x85, 0x60, 0xd7, 0x11},
+     "VDG",
      18},
-    // Ethereum Gold
-    {{0x28, 0xc8, 0xd0, 0x1f, 0xf6, 0x33, 0xea, 0x9c, 0xd8, 0xfc,
-      0x6a, 0x45, 0x1d, 0x74, 0x57, 0x88, 0x9e, 0x69, 0x8d, 0xe6},
-     "ETG",
+    // Livepeer
+    {{0x58, 0xb6, 0xa8, 0xa3, 0x30, 0x23, 0x69, 0xda, 0xec, 0x38,
+      0x33, 0x34, 0x67, 0x24, 0x4,  0xee, 0x73, 0x3a, 0xb2, 0x39},
+     "LPT",
      18},
-    // Etheroll
-    {{0x2e, 0x7,  0x1d, 0x29, 0x66, 0xaa, 0x7d, 0x8d, 0xec, 0xb1,
-      0x0,  0x58, 0x85, 0xba, 0x19, 0x77, 0xd6, 0x3,  0x8a, 0x65},
-     "DICE",
-     16},
-    // Etherparty
-    {{0xea, 0x38, 0xea, 0xa3, 0xc8, 0x6c, 0x8f, 0x9b, 0x75, 0x15,
-      0x33, 0xba, 0x2e, 0x56, 0x2d, 0xeb, 0x9a, 0xcd, 0xed, 0x40},
-     "FUEL",
+    // Power Ledger
+    {{0x59, 0x58, 0x32, 0xf8, 0xfc, 0x6b, 0xf5, 0x9c, 0x85, 0xc5,
+      0x27, 0xfe, 0xc3, 0x74, 0xa,  0x1b, 0x7a, 0x36, 0x12, 0x69},
+     "POWR",
+     6},
+    // Evedo
+    {{0x5a, 0xae, 0xfe, 0x84, 0xe0, 0xfb, 0x3d, 0xd1, 0xf0, 0xfc,
+      0xff, 0x6f, 0xa7, 0x46, 0x81, 0x24, 0x98, 0x6b, 0x91, 0xbd},
+     "EVED",
      18},
-    // Aave [OLD]
-    {{0x80, 0xfb, 0x78, 0x4b, 0x7e, 0xd6, 0x67, 0x30, 0xe8, 0xb1,
-      0xdb, 0xd9, 0x82, 0xa,  0xfd, 0x29, 0x93, 0x1a, 0xab, 0x3},
-     "LEND",
+    // BTC Lite
+    {{0x5a, 0xcd, 0x19, 0xb9, 0xc9, 0x1e, 0x59, 0x6b, 0x1f, 0x6,
+      0x2f, 0x18, 0xe3, 0xd0, 0x2d, 0xa7, 0xed, 0x8d, 0x1e, 0x50},
+     "BTCL",
+     8},
+    // Dether
+    {{0x5a, 0xdc, 0x96, 0x1d, 0x6a, 0xc3, 0xf7, 0x6,  0x2d, 0x2e,
+      0xa4, 0x5f, 0xef, 0xb8, 0xd8, 0x16, 0x7d, 0x44, 0xb1, 0x90},
+     "DTH",
      18},
     // Ethorse
     {{0x5b, 0x7,  0x51, 0x71, 0x3b, 0x25, 0x27, 0xd7, 0xf0, 0x2,
       0xc0, 0xc4, 0xe2, 0xa3, 0x7e, 0x12, 0x19, 0x61, 0xa,  0x6b},
      "HORSE",
      18},
-    // Evedo
-    {{0x5a, 0xae, 0xfe, 0x84, 0xe0, 0xfb, 0x3d, 0xd1, 0xf0, 0xfc,
-      0xff, 0x6f, 0xa7, 0x46, 0x81, 0x24, 0x98, 0x6b, 0x91, 0xbd},
-     "EVED",
+    // MADNetwork
+    {{0x5b, 0x9,  0xa0, 0x37, 0x1c, 0x1d, 0xa4, 0x4a, 0x8e, 0x24,
+      0xd3, 0x6b, 0xf5, 0xde, 0xb1, 0x14, 0x1a, 0x84, 0xd8, 0x75},
+     "MAD",
      18},
-    // Everex
-    {{0xf3, 0xdb, 0x5f, 0xa2, 0xc6, 0x6b, 0x7a, 0xf3, 0xeb, 0xc,
-      0xb,  0x78, 0x25, 0x10, 0x81, 0x6c, 0xbe, 0x48, 0x13, 0xb8},
-     "EVX",
-     4},
-    // Everest
-    {{0xeb, 0xd9, 0xd9, 0x9a, 0x39, 0x82, 0xd5, 0x47, 0xc5, 0xbb,
-      0x4d, 0xb7, 0xe3, 0xb1, 0xf9, 0xf1, 0x4b, 0x67, 0xeb, 0x83},
-     "ID",
+    // Hut34 Entropy
+    {{0x5b, 0xc7, 0xe5, 0xf0, 0xab, 0x8b, 0x2e, 0x10, 0xd2, 0xd0,
+      0xa3, 0xf2, 0x17, 0x39, 0xfc, 0xe6, 0x24, 0x59, 0xae, 0xf3},
+     "ENTRP",
      18},
-    // EXRNchain
-    {{0xe4, 0x69, 0xc4, 0x47, 0x3a, 0xf8, 0x22, 0x17, 0xb3, 0xc,
-      0xf1, 0x7b, 0x10, 0xbc, 0xdb, 0x6c, 0x8c, 0x79, 0x6e, 0x75},
-     "EXRN",
+    // Storiqa
+    {{0x5c, 0x3a, 0x22, 0x85, 0x10, 0xd2, 0x46, 0xb7, 0x8a, 0x37,
+      0x65, 0xc2, 0x2,  0x21, 0xcb, 0xf3, 0x8,  0x2b, 0x44, 0xa4},
+     "STQ",
      18},
-    // Faceter
-    {{0x1c, 0xca, 0xa0, 0xf2, 0xa7, 0x21, 0xd,  0x76, 0xe1, 0xfd,
-      0xec, 0x74, 0xd,  0x5f, 0x32, 0x3e, 0x2e, 0x1b, 0x16, 0x72},
-     "FACE",
+    // Aeternity
+    {{0x5c, 0xa9, 0xa7, 0x1b, 0x1d, 0x1,  0x84, 0x9c, 0xa, 0x95,
+      0x49, 0xc,  0xc0, 0x5,  0x59, 0x71, 0x7f, 0xcf, 0xd, 0x1d},
+     "AE",
      18},
-    // FansTime
-    {{0x94, 0x3e, 0xd8, 0x52, 0xda, 0xdb, 0x5c, 0x39, 0x38, 0xec,
-      0xdc, 0x68, 0x83, 0x71, 0x8d, 0xf8, 0x14, 0x2d, 0xe4, 0xc8},
-     "FTI",
+    // NKN
+    {{0x5c, 0xf0, 0x47, 0x16, 0xba, 0x20, 0x12, 0x7f, 0x1e, 0x22,
+      0x97, 0xad, 0xdc, 0xf4, 0xb5, 0x3,  0x50, 0x0,  0xc9, 0xeb},
+     "NKN",
      18},
-    // Fantom
-    {{0x4e, 0x15, 0x36, 0x1f, 0xd6, 0xb4, 0xbb, 0x60, 0x9f, 0xa6,
-      0x3c, 0x81, 0xa2, 0xbe, 0x19, 0xd8, 0x73, 0x71, 0x78, 0x70},
-     "FTM",
+    // Nebulas
+    {{0x5d, 0x65, 0xd9, 0x71, 0x89, 0x5e, 0xdc, 0x43, 0x8f, 0x46,
+      0x5c, 0x17, 0xdb, 0x69, 0x92, 0x69, 0x8a, 0x52, 0x31, 0x8d},
+     "NAS",
      18},
-    // FinTab
-    {{0xbd, 0x4b, 0x60, 0xa1, 0x38, 0xb3, 0xfc, 0xe3, 0x58, 0x4e,
-      0xa0, 0x1f, 0x50, 0xc0, 0x90, 0x8c, 0x18, 0xf9, 0x67, 0x7a},
-     "FNTB",
-     8},
-    // FintruX
-    {{0xd5, 0x59, 0xf2, 0x2,  0x96, 0xff, 0x48, 0x95, 0xda, 0x39,
-      0xb5, 0xbd, 0x9a, 0xdd, 0x54, 0xb4, 0x42, 0x59, 0x6a, 0x61},
-     "FTX",
+    // POP Network
+    {{0x5d, 0x85, 0x8b, 0xcd, 0x53, 0xe0, 0x85, 0x92, 0x6,  0x20,
+      0x54, 0x92, 0x14, 0xa8, 0xb2, 0x7c, 0xe2, 0xf0, 0x46, 0x70},
+     "POP",
      18},
-    // Fire Lotto
-    {{0x4,  0x93, 0x99, 0xa6, 0xb0, 0x48, 0xd5, 0x29, 0x71, 0xf7,
-      0xd1, 0x22, 0xae, 0x21, 0xa1, 0x53, 0x27, 0x22, 0x28, 0x5f},
-     "FLOT",
+    // Level-Up Coin
+    {{0x5d, 0xbe, 0x29, 0x6f, 0x97, 0xb2, 0x3c, 0x4a, 0x6a, 0xa6,
+      0x18, 0x3d, 0x73, 0xe5, 0x74, 0xd0, 0x2b, 0xa5, 0xc7, 0x19},
+     "LUC",
      18},
-    // Flixxo
-    {{0xf0, 0x4a, 0x8a, 0xc5, 0x53, 0xfc, 0xed, 0xb5, 0xba, 0x99,
-      0xa6, 0x47, 0x99, 0x15, 0x58, 0x26, 0xc1, 0x36, 0xb0, 0xbe},
-     "FLIXX",
+    // LockTrip
+    {{0x5e, 0x33, 0x46, 0x44, 0x40, 0x10, 0x13, 0x53, 0x22, 0x26,
+      0x8a, 0x46, 0x30, 0xd2, 0xed, 0x5f, 0x8d, 0x9,  0x44, 0x6c},
+     "LOC",
      18},
-    // FlypMe
-    {{0x8f, 0x9,  0x21, 0xf3, 0x5,  0x55, 0x62, 0x41, 0x43, 0xd4,
-      0x27, 0xb3, 0x40, 0xb1, 0x15, 0x69, 0x14, 0x88, 0x2c, 0x10},
-     "FYP",
+    // IoT Chain
+    {{0x5e, 0x6b, 0x6d, 0x9a, 0xba, 0xd9, 0x9,  0x3f, 0xdc, 0x86,
+      0x1e, 0xa1, 0x60, 0xe,  0xba, 0x1b, 0x35, 0x5c, 0xd9, 0x40},
+     "ITC",
      18},
-    // FOAM
-    {{0x49, 0x46, 0xfc, 0xea, 0x7c, 0x69, 0x26, 0x6,  0xe8, 0x90,
-      0x80, 0x2,  0xe5, 0x5a, 0x58, 0x2a, 0xf4, 0x4a, 0xc1, 0x21},
-     "FOAM",
+    // iExec RLC
+    {{0x60, 0x7f, 0x4c, 0x5b, 0xb6, 0x72, 0x23, 0xe,  0x86, 0x72,
+      0x8,  0x55, 0x32, 0xf7, 0xe9, 0x1,  0x54, 0x4a, 0x73, 0x75},
+     "RLC",
+     9},
+    // QASH
+    {{0x61, 0x8e, 0x75, 0xac, 0x90, 0xb1, 0x2c, 0x60, 0x49, 0xba,
+      0x3b, 0x27, 0xf5, 0xd5, 0xf8, 0x65, 0x1b, 0x0,  0x37, 0xf6},
+     "QASH",
+     6},
+    // Cube Intelligence
+    {{0x62, 0x2d, 0xff, 0xcc, 0x4e, 0x83, 0xc6, 0x4b, 0xa9, 0x59,
+      0x53, 0xa,  0x5a, 0x55, 0x80, 0x68, 0x7a, 0x57, 0x58, 0x1b},
+     "AUTO",
      18},
-    // Fortuna
-    {{0x42, 0x70, 0xbb, 0x23, 0x8f, 0x6d, 0xd8, 0xb1, 0xc3, 0xca,
-      0x1,  0xf9, 0x6c, 0xa6, 0x5b, 0x26, 0x47, 0xc0, 0x6d, 0x3c},
-     "FOTA",
+    // Smartshare
+    {{0x62, 0x4d, 0x52, 0xb,  0xab, 0x2e, 0x4a, 0xd8, 0x39, 0x35,
+      0xfa, 0x50, 0x3f, 0xb1, 0x30, 0x61, 0x43, 0x74, 0xe8, 0x50},
+     "SSP",
+     4},
+    // GameCredits
+    {{0x63, 0xf8, 0x8a, 0x22, 0x98, 0xa5, 0xc4, 0xae, 0xe3, 0xc2,
+      0x16, 0xaa, 0x6d, 0x92, 0x6b, 0x18, 0x4a, 0x4b, 0x24, 0x37},
+     "GAME",
      18},
-    // Freight Trust Network
-    {{0x79, 0xc5, 0xa1, 0xae, 0x58, 0x63, 0x22, 0xa0, 0x7b, 0xfb,
-      0x60, 0xbe, 0x36, 0xe1, 0xb3, 0x1c, 0xe8, 0xc8, 0x4a, 0x1e},
-     "EDI",
+    // OneLedger
+    {{0x64, 0xa6, 0x4,  0x93, 0xd8, 0x88, 0x72, 0x8c, 0xf4, 0x26,
+      0x16, 0xe0, 0x34, 0xa0, 0xdf, 0xea, 0xe3, 0x8e, 0xfc, 0xf0},
+     "OLT",
      18},
-    // Friendz
-    {{0x23, 0x35, 0x20, 0x36, 0xe9, 0x11, 0xa2, 0x2c, 0xfc, 0x69,
-      0x2b, 0x5e, 0x2e, 0x19, 0x66, 0x92, 0x65, 0x8a, 0xde, 0xd9},
-     "FDZ",
+    // InsurePal
+    {{0x64, 0xcd, 0xf8, 0x19, 0xd3, 0xe7, 0x5a, 0xc8, 0xec, 0x21,
+      0x7b, 0x34, 0x96, 0xd7, 0xce, 0x16, 0x7b, 0xe4, 0x2e, 0x80},
+     "IPL",
      18},
-    // Fundamenta
-    {{0xaa, 0x9d, 0x86, 0x66, 0x66, 0xc2, 0xa3, 0x74, 0x8d, 0x6b,
-      0x23, 0xff, 0x69, 0xe6, 0x3e, 0x52, 0xf0, 0x8d, 0x9a, 0xb4},
-     "FMTA",
-     18},
-    // FUN
-    {{0x41, 0x9d, 0xd,  0x8b, 0xdd, 0x9a, 0xf5, 0xe6, 0x6,  0xae,
-      0x22, 0x32, 0xed, 0x28, 0x5a, 0xff, 0x19, 0xe,  0x71, 0x1b},
-     "FUN",
-     8},
-    // FUTURAX
-    {{0x41, 0x87, 0x5c, 0x23, 0x32, 0xb0, 0x87, 0x7c, 0xdf, 0xaa,
-      0x69, 0x9b, 0x64, 0x14, 0x2,  0xb7, 0xd4, 0x64, 0x2c, 0x32},
-     "FTXT",
-     8},
-    // FuzeX
-    {{0x18, 0x29, 0xaa, 0x4,  0x5e, 0x21, 0xe0, 0xd5, 0x95, 0x80,
-      0x2,  0x4a, 0x95, 0x1d, 0xb4, 0x80, 0x96, 0xe0, 0x17, 0x82},
-     "FXT",
-     18},
-    // Fyooz
-    {{0x6b, 0xff, 0x2f, 0xe2, 0x49, 0x60, 0x1e, 0xd0, 0xdb, 0x3a,
-      0x87, 0x42, 0x4a, 0x2e, 0x92, 0x31, 0x18, 0xbb, 0x3,  0x12},
-     "FYZ",
-     18},
-    // GAMB
-    {{0xa0, 0x0, 0x8f, 0x51, 0xf,  0xe9, 0xee, 0x69, 0x6e, 0x7e,
-      0x32, 0xc, 0x9e, 0x5c, 0xbf, 0x61, 0xe2, 0x77, 0x91, 0xee},
-     "GMB",
-     18},
-    // Game
-    {{0xb7, 0x8,  0x35, 0xd7, 0x82, 0x2e, 0xbb, 0x94, 0x26, 0xb5,
-      0x65, 0x43, 0xe3, 0x91, 0x84, 0x6c, 0x10, 0x7b, 0xd3, 0x2c},
-     "GTC",
-     18},
-    // GameCredits
-    {{0x63, 0xf8, 0x8a, 0x22, 0x98, 0xa5, 0xc4, 0xae, 0xe3, 0xc2,
-      0x16, 0xaa, 0x6d, 0x92, 0x6b, 0x18, 0x4a, 0x4b, 0x24, 0x37},
-     "GAME",
-     18},
-    // Gameflip
-    {{0x3a, 0x1b, 0xda, 0x28, 0xad, 0xb5, 0xb0, 0xa8, 0x12, 0xa7,
-      0xcf, 0x10, 0xa1, 0x95, 0xc,  0x92, 0xf,  0x79, 0xbc, 0xd3},
-     "FLP",
-     18},
-    // GamerCoin
-    {{0x72, 0x8f, 0x30, 0xfa, 0x2f, 0x10, 0x7,  0x42, 0xc7, 0x94,
-      0x9d, 0x19, 0x61, 0x80, 0x4f, 0xa8, 0xe0, 0xb1, 0x38, 0x7d},
-     "GHX",
-     18},
-    // GATENet
-    {{0x9d, 0x76, 0x30, 0xad, 0xf7, 0xab, 0xb,  0xc,  0xb0, 0xa,
-      0xf7, 0x47, 0xdb, 0x76, 0x86, 0x4d, 0xf0, 0xec, 0x82, 0xe4},
-     "GATE",
+    // Adelphoi
+    {{0x66, 0xe,  0x71, 0x48, 0x37, 0x85, 0xf6, 0x61, 0x33, 0x54,
+      0x8b, 0x10, 0xf6, 0x92, 0x6d, 0xc3, 0x32, 0xb0, 0x6e, 0x61},
+     "ADL",
      18},
-    // Gather
-    {{0xeb, 0x98, 0x6d, 0xa9, 0x94, 0xe4, 0xa1, 0x18, 0xd5, 0x95,
-      0x6b, 0x2,  0xd8, 0xb7, 0xc3, 0xc7, 0xce, 0x37, 0x36, 0x74},
-     "GTH",
+    // Wings
+    {{0x66, 0x70, 0x88, 0xb2, 0x12, 0xce, 0x3d, 0x6, 0xa1, 0xb5,
+      0x53, 0xa7, 0x22, 0x1e, 0x1f, 0xd1, 0x90, 0x0, 0xd9, 0xaf},
+     "WINGS",
      18},
-    // Gems
-    {{0xc7, 0xbb, 0xa5, 0xb7, 0x65, 0x58, 0x1e, 0xfb, 0x2c, 0xdd,
-      0x26, 0x79, 0xdb, 0x5b, 0xea, 0x9e, 0xe7, 0x9b, 0x20, 0x1f},
-     "GEM",
+    // Lunch Money
+    {{0x66, 0xfd, 0x97, 0xa7, 0x8d, 0x88, 0x54, 0xfe, 0xc4, 0x45,
+      0xcd, 0x1c, 0x80, 0xa0, 0x78, 0x96, 0xb0, 0xb4, 0x85, 0x1f},
+     "LMY",
      18},
-    // Genaro Network
-    {{0x6e, 0xc8, 0xa2, 0x4c, 0xab, 0xdc, 0x33, 0x9a, 0x6,  0xa1,
-      0x72, 0xf8, 0x22, 0x3e, 0xa5, 0x57, 0x5,  0x5a, 0xda, 0xa5},
-     "GNX",
-     9},
-    // Genesis Vision
-    {{0x10, 0x3c, 0x3a, 0x20, 0x9d, 0xa5, 0x9d, 0x3e, 0x7c, 0x4a,
-      0x89, 0x30, 0x7e, 0x66, 0x52, 0x1e, 0x8,  0x1c, 0xfd, 0xf0},
-     "GVT",
+    // Ubex
+    {{0x67, 0x4,  0xb6, 0x73, 0xc7, 0xd,  0xe9, 0xbf, 0x74, 0xc8,
+      0xfb, 0xa4, 0xb4, 0xbd, 0x74, 0x8f, 0xe,  0x21, 0x90, 0xe1},
+     "UBEX",
      18},
-    // GET Protocol
-    {{0x8a, 0x85, 0x42, 0x88, 0xa5, 0x97, 0x60, 0x36, 0xa7, 0x25,
-      0x87, 0x91, 0x64, 0xca, 0x3e, 0x91, 0xd3, 0xc,  0x6a, 0x1b},
-     "GET",
+    // Smart MFG
+    {{0x67, 0x10, 0xc6, 0x34, 0x32, 0xa2, 0xde, 0x2,  0x95, 0x4f,
+      0xc0, 0xf8, 0x51, 0xdb, 0x7,  0x14, 0x6a, 0x6c, 0x3,  0x12},
+     "MFG",
      18},
-    // Global Game Coin
-    {{0x7f, 0x96, 0x9c, 0x4d, 0x38, 0x8c, 0xa0, 0xae, 0x39, 0xa4,
-      0xfd, 0xdb, 0x1a, 0x6f, 0x89, 0x87, 0x8c, 0xa2, 0xfb, 0xf8},
-     "GGC",
+    // Verify
+    {{0x67, 0x2a, 0x1a, 0xd4, 0xf6, 0x67, 0xfb, 0x18, 0xa3, 0x33,
+      0xaf, 0x13, 0x66, 0x7a, 0xa0, 0xaf, 0x1f, 0x5b, 0x5b, 0xdd},
+     "CRED",
      18},
-    // Gifto
-    {{0xc5, 0xbb, 0xae, 0x50, 0x78, 0x1b, 0xe1, 0x66, 0x93, 0x6,
-      0xb9, 0xe0, 0x1,  0xef, 0xf5, 0x7a, 0x29, 0x57, 0xb0, 0x9d},
-     "GTO",
-     5},
-    // Global Crypto Alliance
-    {{0xbb, 0xe7, 0x61, 0xea, 0x14, 0x47, 0xa2, 0xb,  0x75, 0xaa,
-      0x48, 0x5b, 0x7b, 0xca, 0xd4, 0x83, 0x74, 0x15, 0xd7, 0xd7},
-     "CALL",
+    // Zap
+    {{0x67, 0x81, 0xa0, 0xf8, 0x4c, 0x7e, 0x9e, 0x84, 0x6d, 0xcb,
+      0x84, 0xa9, 0xa5, 0xbd, 0x49, 0x33, 0x30, 0x67, 0xb1, 0x4},
+     "ZAP",
      18},
-    // Global Social Chain
-    {{0x22, 0x8b, 0xa5, 0x14, 0x30, 0x9f, 0xfd, 0xf0, 0x3a, 0x81,
-      0xa2, 0x5,  0xa6, 0xd0, 0x40, 0xe4, 0x29, 0xd6, 0xe8, 0xc},
-     "GSC",
+    // Ccore
+    {{0x67, 0x9b, 0xad, 0xc5, 0x51, 0x62, 0x6e, 0x1,  0xb2, 0x3c,
+      0xee, 0xce, 0xfb, 0xc9, 0xb8, 0x77, 0xea, 0x18, 0xfc, 0x46},
+     "CCO",
      18},
     // Gnosis
     {{0x68, 0x10, 0xe7, 0x76, 0x88, 0xc, 0x2,  0x93, 0x3d, 0x47,
       0xdb, 0x1b, 0x9f, 0xc0, 0x59, 0x8, 0xe5, 0x38, 0x6b, 0x96},
      "GNO",
      18},
-    // Goldmint
-    {{0x83, 0xce, 0xe9, 0xe0, 0x86, 0xa7, 0x7e, 0x49, 0x2e, 0xe0,
-      0xbb, 0x93, 0xc2, 0xb0, 0x43, 0x7a, 0xd6, 0xfd, 0xec, 0xcc},
-     "MNTP",
+    // Signal SIG
+    {{0x68, 0x88, 0xa1, 0x6e, 0xa9, 0x79, 0x2c, 0x15, 0xa4, 0xdc,
+      0xf2, 0xf6, 0xc6, 0x23, 0xd0, 0x55, 0xc8, 0xed, 0xe7, 0x92},
+     "SIG",
      18},
-    // GoNetwork
-    {{0x42, 0x3b, 0x5f, 0x62, 0xb3, 0x28, 0xd0, 0xd6, 0xd4, 0x48,
-      0x70, 0xf4, 0xee, 0xe3, 0x16, 0xbe, 0xfa, 0xb,  0x2d, 0xf5},
-     "GOT",
+    // Sirin Labs
+    {{0x68, 0xd5, 0x7c, 0x9a, 0x1c, 0x35, 0xf6, 0x3e, 0x2c, 0x83,
+      0xee, 0x8e, 0x49, 0xa6, 0x4e, 0x9d, 0x70, 0x52, 0x8d, 0x25},
+     "SRN",
      18},
-    // Governor DAO
-    {{0x51, 0x5d, 0x7e, 0x9d, 0x75, 0xe2, 0xb7, 0x6d, 0xb6, 0xf,
-      0x8a, 0x5,  0x1c, 0xd8, 0x90, 0xeb, 0xa2, 0x32, 0x86, 0xbc},
-     "GDAO",
+    // Rentberry
+    {{0x6a, 0xeb, 0x95, 0xf0, 0x6c, 0xda, 0x84, 0xca, 0x34, 0x5c,
+      0x2d, 0xe0, 0xf3, 0xb7, 0xf9, 0x69, 0x23, 0xa4, 0x4f, 0x4c},
+     "BERRY",
+     14},
+    // Dai
+    {{0x6b, 0x17, 0x54, 0x74, 0xe8, 0x90, 0x94, 0xc4, 0x4d, 0xa9,
+      0x8b, 0x95, 0x4e, 0xed, 0xea, 0xc4, 0x95, 0x27, 0x1d, 0xf},
+     "DAI",
      18},
-    // CVI
-    {{0xee, 0xaa, 0x40, 0xb2, 0x8a, 0x2d, 0x1b, 0xb,  0x8,  0xf6,
-      0xf9, 0x7b, 0xb1, 0xdd, 0x4b, 0x75, 0x31, 0x6c, 0x61, 0x7},
-     "GOVI",
+    // Sushi
+    {{0x6b, 0x35, 0x95, 0x6,  0x87, 0x78, 0xdd, 0x59, 0x2e, 0x39,
+      0xa1, 0x22, 0xf4, 0xf5, 0xa5, 0xcf, 0x9,  0xc9, 0xf,  0xe2},
+     "SUSHI",
      18},
-    // GridPlus [OLD]
-    {{0x12, 0xb1, 0x9d, 0x3e, 0x2c, 0xcc, 0x14, 0xda, 0x4,  0xfa,
-      0xe3, 0x3e, 0x63, 0x65, 0x2c, 0xe4, 0x69, 0xb3, 0xf2, 0xfd},
-     "GRID",
-     12},
-    // GROM
-    {{0xce, 0x59, 0x3a, 0x29, 0x90, 0x59, 0x51, 0xe8, 0xfc, 0x57,
-      0x9b, 0xc0, 0x92, 0xec, 0xa7, 0x25, 0x77, 0xda, 0x57, 0x5c},
-     "GR",
-     6},
-    // GSENetwork
-    {{0xe5, 0x30, 0x44, 0x1f, 0x4f, 0x73, 0xbd, 0xb6, 0xdc, 0x2f,
-      0xa5, 0xaf, 0x7c, 0x3f, 0xc5, 0xfd, 0x55, 0x1e, 0xc8, 0x38},
-     "GSE",
-     4},
-    // Synthetix Network
-    {{0xc0, 0x11, 0xa7, 0x3e, 0xe8, 0x57, 0x6f, 0xb4, 0x6f, 0x5e,
-      0x1c, 0x57, 0x51, 0xca, 0x3b, 0x9f, 0xe0, 0xaf, 0x2a, 0x6f},
-     "SNX",
+    // Million
+    {{0x6b, 0x4c, 0x7a, 0x5e, 0x3f, 0xb,  0x99, 0xfc, 0xd8, 0x3e,
+      0x9c, 0x8,  0x9b, 0xdd, 0xd6, 0xc7, 0xfc, 0xe5, 0xc6, 0x11},
+     "MM",
      18},
-    // HelloGold
-    {{0xba, 0x21, 0x84, 0x52, 0xa,  0x1c, 0xc4, 0x9a, 0x61, 0x59,
-      0xc5, 0x7e, 0x61, 0xe1, 0x84, 0x4e, 0x8,  0x56, 0x15, 0xb6},
-     "HGT",
-     8},
-    // HEX
-    {{0x2b, 0x59, 0x1e, 0x99, 0xaf, 0xe9, 0xf3, 0x2e, 0xaa, 0x62,
-      0x14, 0xf7, 0xb7, 0x62, 0x97, 0x68, 0xc4, 0xe,  0xeb, 0x39},
-     "HEX",
-     8},
-    // Hiveterminal
-    {{0xc0, 0xeb, 0x85, 0x28, 0x5d, 0x83, 0x21, 0x7c, 0xd7, 0xc8,
-      0x91, 0x70, 0x2b, 0xcb, 0xc0, 0xfc, 0x40, 0x1e, 0x2d, 0x9d},
-     "HVN",
-     8},
-    // HollaEx
-    {{0xd3, 0xc6, 0x25, 0xf5, 0x4d, 0xec, 0x64, 0x7d, 0xb8, 0x78,
-      0xd,  0xbb, 0xe0, 0xe8, 0x80, 0xef, 0x21, 0xba, 0x43, 0x29},
-     "XHT",
+    // Fyooz
+    {{0x6b, 0xff, 0x2f, 0xe2, 0x49, 0x60, 0x1e, 0xd0, 0xdb, 0x3a,
+      0x87, 0x42, 0x4a, 0x2e, 0x92, 0x31, 0x18, 0xbb, 0x3,  0x12},
+     "FYZ",
      18},
     // Holo
     {{0x6c, 0x6e, 0xe5, 0xe3, 0x1d, 0x82, 0x8d, 0xe2, 0x41, 0x28,
       0x2b, 0x96, 0x6,  0xc8, 0xe9, 0x8e, 0xa4, 0x85, 0x26, 0xe2},
      "HOT",
      18},
-    // Hub
-    {{0xba, 0x35, 0x8b, 0x6f, 0x5b, 0x4c, 0x2,  0x15, 0x65, 0x4,
-      0x44, 0xb8, 0xc3, 0xd,  0x87, 0xb,  0x55, 0x5,  0xd,  0x2d},
-     "HUB",
-     18},
-    // Humaniq
-    {{0xcb, 0xcc, 0xf,  0x3,  0x6e, 0xd4, 0x78, 0x8f, 0x63, 0xfc,
-      0xf,  0xee, 0x32, 0x87, 0x3d, 0x6a, 0x74, 0x87, 0xb9, 0x8},
-     "HMQ",
+    // cBAT
+    {{0x6c, 0x8c, 0x6b, 0x2,  0xe7, 0xb2, 0xbe, 0x14, 0xd4, 0xfa,
+      0x60, 0x22, 0xdf, 0xd6, 0xd7, 0x59, 0x21, 0xd9, 0xe,  0x4e},
+     "CBAT",
+     8},
+    // Parkgene
+    {{0x6d, 0xd4, 0xe4, 0xaa, 0xd2, 0x9a, 0x40, 0xed, 0xd6, 0xa4,
+      0x9,  0xb9, 0xc1, 0x62, 0x51, 0x86, 0xc9, 0x85, 0x5b, 0x4d},
+     "GENE",
      8},
+    // Genaro Network
+    {{0x6e, 0xc8, 0xa2, 0x4c, 0xab, 0xdc, 0x33, 0x9a, 0x6,  0xa1,
+      0x72, 0xf8, 0x22, 0x3e, 0xa5, 0x57, 0x5,  0x5a, 0xda, 0xa5},
+     "GNX",
+     9},
     // Huobi
     {{0x6f, 0x25, 0x96, 0x37, 0xdc, 0xd7, 0x4c, 0x76, 0x77, 0x81,
       0xe3, 0x7b, 0xc6, 0x13, 0x3c, 0xd6, 0xa6, 0x8a, 0xa1, 0x61},
      "HT",
      18},
-    // Hurify
-    {{0xcd, 0xb7, 0xec, 0xfd, 0x34, 0x3,  0xee, 0xf3, 0x88, 0x2c,
-      0x65, 0xb7, 0x61, 0xef, 0x9b, 0x50, 0x54, 0x89, 0xa,  0x47},
-     "HUR",
+    // Umbrella Network
+    {{0x6f, 0xc1, 0x3e, 0xac, 0xe2, 0x65, 0x90, 0xb8, 0xc,  0xcc,
+      0xab, 0x1b, 0xa5, 0xd5, 0x18, 0x90, 0x57, 0x7d, 0x83, 0xb2},
+     "UMB",
      18},
-    // Hut34 Entropy
-    {{0x5b, 0xc7, 0xe5, 0xf0, 0xab, 0x8b, 0x2e, 0x10, 0xd2, 0xd0,
-      0xa3, 0xf2, 0x17, 0x39, 0xfc, 0xe6, 0x24, 0x59, 0xae, 0xf3},
-     "ENTRP",
+    // Props
+    {{0x6f, 0xe5, 0x6c, 0xb,  0xcd, 0xd4, 0x71, 0x35, 0x90, 0x19,
+      0xfc, 0xbc, 0x48, 0x86, 0x3d, 0x6c, 0x3e, 0x9d, 0x4f, 0x41},
+     "PROPS",
      18},
-    // Hydro Protocol
-    {{0x9a, 0xf8, 0x39, 0x68, 0x7f, 0x6c, 0x94, 0x54, 0x2a, 0xc5,
-      0xec, 0xe2, 0xe3, 0x17, 0xda, 0xae, 0x35, 0x54, 0x93, 0xa1},
-     "HOT",
+    // OAX
+    {{0x70, 0x1c, 0x24, 0x4b, 0x98, 0x8a, 0x51, 0x3c, 0x94, 0x59,
+      0x73, 0xde, 0xfa, 0x5,  0xde, 0x93, 0x3b, 0x23, 0xfe, 0x1d},
+     "OAX",
      18},
-    // iExec RLC
-    {{0x60, 0x7f, 0x4c, 0x5b, 0xb6, 0x72, 0x23, 0xe,  0x86, 0x72,
-      0x8,  0x55, 0x32, 0xf7, 0xe9, 0x1,  0x54, 0x4a, 0x73, 0x75},
-     "RLC",
-     9},
-    // IGT
-    {{0x8a, 0x88, 0xf0, 0x4e, 0xc,  0x90, 0x50, 0x54, 0xd2, 0xf3,
-      0x3b, 0x26, 0xbb, 0x3a, 0x46, 0xd7, 0x9,  0x1a, 0x3,  0x9a},
-     "IG",
-     18},
-    // IHT Real Estate Protocol
-    {{0xed, 0xa8, 0xb0, 0x16, 0xef, 0xa8, 0xb1, 0x16, 0x12, 0x8,
-      0xcf, 0x4,  0x1c, 0xd8, 0x69, 0x72, 0xee, 0xe0, 0xf3, 0x1e},
-     "IHT",
+    // ClearPoll
+    {{0x70, 0x5e, 0xe9, 0x6c, 0x1c, 0x16, 0x8,  0x42, 0xc9, 0x2c,
+      0x1a, 0xec, 0xfc, 0xff, 0xcc, 0xc9, 0xc4, 0x12, 0xe3, 0xd9},
+     "POLL",
      18},
-    // indaHash
-    {{0x51, 0x36, 0xc9, 0x8a, 0x80, 0x81, 0x1c, 0x3f, 0x46, 0xbd,
-      0xda, 0x8b, 0x5c, 0x45, 0x55, 0xcf, 0xd9, 0xf8, 0x12, 0xf0},
-     "IDH",
+    // XSGD
+    {{0x70, 0xe8, 0xde, 0x73, 0xce, 0x53, 0x8d, 0xa2, 0xbe, 0xed,
+      0x35, 0xd1, 0x41, 0x87, 0xf6, 0x95, 0x9a, 0x8e, 0xca, 0x96},
+     "XSGD",
      6},
-    // Indorse
-    {{0xf8, 0xe3, 0x86, 0xed, 0xa8, 0x57, 0x48, 0x4f, 0x5a, 0x12,
-      0xe4, 0xb5, 0xda, 0xa9, 0x98, 0x4e, 0x6,  0xe7, 0x37, 0x5},
-     "IND",
+    // OctoFi
+    {{0x72, 0x40, 0xac, 0x91, 0xf0, 0x12, 0x33, 0xba, 0xaf, 0x8b,
+      0x6,  0x42, 0x48, 0xe8, 0xf,  0xea, 0xa5, 0x91, 0x2b, 0xa3},
+     "OCTO",
      18},
-    // Direct Insurance
-    {{0xf1, 0x49, 0x22, 0x0,  0x1a, 0x2f, 0xb8, 0x54, 0x1a, 0x43,
-      0x39, 0x5,  0x43, 0x7a, 0xe9, 0x54, 0x41, 0x9c, 0x24, 0x39},
-     "DIT",
-     8},
-    // InsurePal
-    {{0x64, 0xcd, 0xf8, 0x19, 0xd3, 0xe7, 0x5a, 0xc8, 0xec, 0x21,
-      0x7b, 0x34, 0x96, 0xd7, 0xce, 0x16, 0x7b, 0xe4, 0x2e, 0x80},
-     "IPL",
+    // GamerCoin
+    {{0x72, 0x8f, 0x30, 0xfa, 0x2f, 0x10, 0x7,  0x42, 0xc7, 0x94,
+      0x9d, 0x19, 0x61, 0x80, 0x4f, 0xa8, 0xe0, 0xb1, 0x38, 0x7d},
+     "GHX",
      18},
-    // iXledger
-    {{0xfc, 0xa4, 0x79, 0x62, 0xd4, 0x5a, 0xdf, 0xdf, 0xd1, 0xab,
-      0x2d, 0x97, 0x23, 0x15, 0xdb, 0x4c, 0xe7, 0xcc, 0xf0, 0x94},
-     "IXT",
-     8},
-    // IoT Chain
-    {{0x5e, 0x6b, 0x6d, 0x9a, 0xba, 0xd9, 0x9,  0x3f, 0xdc, 0x86,
-      0x1e, 0xa1, 0x60, 0xe,  0xba, 0x1b, 0x35, 0x5c, 0xd9, 0x40},
-     "ITC",
+    // Worldcore
+    {{0x72, 0xad, 0xad, 0xb4, 0x47, 0x78, 0x4d, 0xd7, 0xab, 0x1f,
+      0x47, 0x24, 0x67, 0x75, 0xf,  0xc4, 0x85, 0xe4, 0xcb, 0x2d},
+     "WRC",
+     6},
+    // NAGA
+    {{0x72, 0xdd, 0x4b, 0x6b, 0xd8, 0x52, 0xa3, 0xaa, 0x17, 0x2b,
+      0xe4, 0xd6, 0xc5, 0xa6, 0xdb, 0xec, 0x58, 0x8c, 0xf1, 0x31},
+     "NGC",
      18},
-    // IQeon
-    {{0xd,  0xb8, 0xd8, 0xb7, 0x6b, 0xc3, 0x61, 0xba, 0xcb, 0xb7,
-      0x2e, 0x2c, 0x49, 0x1e, 0x6,  0x8,  0x5a, 0x97, 0xab, 0x31},
-     "IQN",
+    // Amon
+    {{0x73, 0x7f, 0x98, 0xac, 0x8c, 0xa5, 0x9f, 0x2c, 0x68, 0xad,
+      0x65, 0x8e, 0x3c, 0x3d, 0x8c, 0x89, 0x63, 0xe4, 0xa,  0x4c},
+     "AMN",
      18},
-    // Iungo
-    {{0x24, 0xdd, 0xff, 0x6d, 0x8b, 0x8a, 0x42, 0xd8, 0x35, 0xaf,
-      0x3b, 0x44, 0xd,  0xe9, 0x1f, 0x33, 0x86, 0x55, 0x4a, 0xa4},
-     "ING",
+    // Agoras: Currency of Tau
+    {{0x73, 0x88, 0x65, 0x30, 0x1a, 0x9b, 0x7d, 0xd8, 0xd,  0xc3,
+      0x66, 0x6d, 0xd4, 0x8c, 0xf0, 0x34, 0xec, 0x42, 0xbd, 0xda},
+     "AGRS",
      18},
     // JasmyCoin
     {{0x74, 0x20, 0xb4, 0xb9, 0xa0, 0x11, 0xc,  0xdc, 0x71, 0xfb,
       0x72, 0x9,  0x8,  0x34, 0xc,  0x3,  0xf9, 0xbc, 0x3,  0xec},
      "JASMY",
      18},
-    // Jobchain
-    {{0xdf, 0xbc, 0x90, 0x50, 0xf5, 0xb0, 0x1d, 0xf5, 0x35, 0x12,
-      0xdc, 0xc3, 0x9b, 0x4f, 0x2b, 0x2b, 0xba, 0xcd, 0x51, 0x7a},
-     "JOB",
-     8},
-    // BitKan
-    {{0x14, 0x10, 0x43, 0x4b, 0x3,  0x46, 0xf5, 0xbe, 0x67, 0x8d,
-      0xf,  0xb5, 0x54, 0xe5, 0xc7, 0xab, 0x62, 0xf,  0x8f, 0x4a},
-     "KAN",
-     18},
-    // Kind Ads
-    {{0x46, 0x18, 0x51, 0x9d, 0xe4, 0xc3, 0x4,  0xf3, 0x44, 0x4f,
-      0xfa, 0x7f, 0x81, 0x2d, 0xdd, 0xc2, 0x97, 0x1c, 0xc6, 0x88},
-     "KIND",
-     8},
-    // KingXChain
-    {{0x1,  0x63, 0x96, 0x4,  0x47, 0x9,  0xeb, 0x3e, 0xdc, 0x69,
-      0xc4, 0x4f, 0x4d, 0x5f, 0xa6, 0x99, 0x69, 0x17, 0xe4, 0xe8},
-     "KXC",
-     18},
-    // Kleros
-    {{0x93, 0xed, 0x3f, 0xbe, 0x21, 0x20, 0x7e, 0xc2, 0xe8, 0xf2,
-      0xd3, 0xc3, 0xde, 0x6e, 0x5,  0x8c, 0xb7, 0x3b, 0xc0, 0x4d},
-     "PNK",
-     18},
-    // KRYLL
-    {{0x46, 0x4e, 0xbe, 0x77, 0xc2, 0x93, 0xe4, 0x73, 0xb4, 0x8c,
-      0xfe, 0x96, 0xdd, 0xcf, 0x88, 0xfc, 0xf7, 0xbf, 0xda, 0xc0},
-     "KRL",
-     18},
-    // Kuende
-    {{0xdf, 0x13, 0x38, 0xfb, 0xaf, 0xe7, 0xaf, 0x17, 0x89, 0x15,
-      0x16, 0x27, 0xb8, 0x86, 0x78, 0x1b, 0xa5, 0x56, 0xef, 0x9a},
-     "KUE",
+    // Status
+    {{0x74, 0x4d, 0x70, 0xfd, 0xbe, 0x2b, 0xa4, 0xcf, 0x95, 0x13,
+      0x16, 0x26, 0x61, 0x4a, 0x17, 0x63, 0xdf, 0x80, 0x5b, 0x9e},
+     "SNT",
      18},
-    // Kyber Network Crystal Legacy
-    {{0xdd, 0x97, 0x4d, 0x5c, 0x2e, 0x29, 0x28, 0xde, 0xa5, 0xf7,
-      0x1b, 0x98, 0x25, 0xb8, 0xb6, 0x46, 0x68, 0x6b, 0xd2, 0x0},
-     "KNCL",
+    // OKB
+    {{0x75, 0x23, 0x1f, 0x58, 0xb4, 0x32, 0x40, 0xc9, 0x71, 0x8d,
+      0xd5, 0x8b, 0x49, 0x67, 0xc5, 0x11, 0x43, 0x42, 0xa8, 0x6c},
+     "OKB",
      18},
-    // Lambda
-    {{0x89, 0x71, 0xf9, 0xfd, 0x71, 0x96, 0xe5, 0xce, 0xe2, 0xc1,
-      0x3,  0x2b, 0x50, 0xf6, 0x56, 0x85, 0x5a, 0xf7, 0xdd, 0x26},
-     "LAMB",
+    // Red
+    {{0x76, 0x96, 0xd,  0xcc, 0xd5, 0xa1, 0xfe, 0x79, 0x9f, 0x7c,
+      0x29, 0xbe, 0x9f, 0x19, 0xce, 0xb4, 0x62, 0x7a, 0xeb, 0x2f},
+     "RED",
      18},
-    // LatiumX
-    {{0x2f, 0x85, 0xe5, 0x2,  0xa9, 0x88, 0xaf, 0x76, 0xf7, 0xee,
-      0x6d, 0x83, 0xb7, 0xdb, 0x8d, 0x6c, 0xa,  0x82, 0x3b, 0xf9},
-     "LATX",
+    // CyberMusic
+    {{0x78, 0xc2, 0x92, 0xd1, 0x44, 0x5e, 0x6b, 0x95, 0x58, 0xbf,
+      0x42, 0xe8, 0xbc, 0x36, 0x92, 0x71, 0xde, 0xd0, 0x62, 0xea},
+     "CYMT",
      8},
-    // LA
-    {{0xe5, 0x3,  0x65, 0xf5, 0xd6, 0x79, 0xcb, 0x98, 0xa1, 0xdd,
-      0x62, 0xd6, 0xf6, 0xe5, 0x8e, 0x59, 0x32, 0x1b, 0xcd, 0xdf},
-     "LA",
+    // Freight Trust Network
+    {{0x79, 0xc5, 0xa1, 0xae, 0x58, 0x63, 0x22, 0xa0, 0x7b, 0xfb,
+      0x60, 0xbe, 0x36, 0xe1, 0xb3, 0x1c, 0xe8, 0xc8, 0x4a, 0x1e},
+     "EDI",
      18},
-    // LGO
-    {{0xa,  0x50, 0xc9, 0x3c, 0x76, 0x2f, 0xdd, 0x6e, 0x56, 0xd8,
-      0x62, 0x15, 0xc2, 0x4a, 0xaa, 0xd4, 0x3a, 0xb6, 0x29, 0xaa},
-     "LGO",
-     8},
-    // Lendingblock
-    {{0x9,  0x47, 0xb0, 0xe6, 0xd8, 0x21, 0x37, 0x88, 0x5,  0xc9,
-      0x59, 0x82, 0x91, 0x38, 0x5c, 0xe7, 0xc7, 0x91, 0xa6, 0xb2},
-     "LND",
+    // Zeusshield
+    {{0x7a, 0x41, 0xe0, 0x51, 0x7a, 0x5e, 0xca, 0x4f, 0xdb, 0xc7,
+      0xfb, 0xeb, 0xa4, 0xd4, 0xc4, 0x7b, 0x9f, 0xf6, 0xdc, 0x63},
+     "ZSC",
      18},
-    // Libra Credit
-    {{0xfe, 0x5f, 0x14, 0x1b, 0xf9, 0x4f, 0xe8, 0x4b, 0xc2, 0x8d,
-      0xed, 0xa,  0xb9, 0x66, 0xc1, 0x6b, 0x17, 0x49, 0x6,  0x57},
-     "LBA",
+    // Santiment Network
+    {{0x7c, 0x5a, 0xc,  0xe9, 0x26, 0x7e, 0xd1, 0x9b, 0x22, 0xf8,
+      0xca, 0xe6, 0x53, 0xf1, 0x98, 0xe3, 0xe8, 0xda, 0xf0, 0x98},
+     "SAN",
      18},
-    // Link Machine Learning
-    {{0x25, 0xb6, 0x32, 0x5f, 0x5b, 0xb1, 0xc1, 0xe0, 0x3c, 0xfb,
-      0xc3, 0xe5, 0x3f, 0x47, 0xe,  0x1f, 0x1c, 0xa0, 0x22, 0xe3},
-     "LML",
+    // Polygon
+    {{0x7d, 0x1a, 0xfa, 0x7b, 0x71, 0x8f, 0xb8, 0x93, 0xdb, 0x30,
+      0xa3, 0xab, 0xc0, 0xcf, 0xc6, 0x8,  0xaa, 0xcf, 0xeb, 0xb0},
+     "MATIC",
      18},
-    // Liquidity Network
-    {{0xd2, 0x9f, 0xb,  0x5b, 0x3f, 0x50, 0xb0, 0x7f, 0xe9, 0xa9,
-      0x51, 0x1f, 0x7d, 0x86, 0xf4, 0xf4, 0xba, 0xc3, 0xf8, 0xc4},
-     "LQD",
+    // Change
+    {{0x7d, 0x4b, 0x8c, 0xce, 0x5,  0x91, 0xc9, 0x4,  0x4a, 0x22,
+      0xee, 0x54, 0x35, 0x33, 0xb7, 0x2e, 0x97, 0x6e, 0x36, 0xc3},
+     "CAG",
      18},
-    // LivenPay
-    {{0xc8, 0xca, 0xc7, 0x67, 0x2f, 0x46, 0x69, 0x68, 0x58, 0x17,
-      0xcf, 0x33, 0x2a, 0x33, 0xeb, 0x24, 0x9f, 0x8,  0x54, 0x75},
-     "LVN",
+    // Victoria VR
+    {{0x7d, 0x51, 0x21, 0x50, 0x51, 0x49, 0x6, 0x5b, 0x56, 0x2c,
+      0x78, 0x9a, 0x1,  0x45, 0xed, 0x75, 0xe, 0x6e, 0x8c, 0xdd},
+     "VR",
      18},
-    // Livepeer
-    {{0x58, 0xb6, 0xa8, 0xa3, 0x30, 0x23, 0x69, 0xda, 0xec, 0x38,
-      0x33, 0x34, 0x67, 0x24, 0x4,  0xee, 0x73, 0x3a, 0xb2, 0x39},
-     "LPT",
+    // eosDAC
+    {{0x7e, 0x9e, 0x43, 0x1a, 0xb,  0x8c, 0x4d, 0x53, 0x2c, 0x74,
+      0x5b, 0x10, 0x43, 0xc7, 0xfa, 0x29, 0xa4, 0x8d, 0x4f, 0xba},
+     "EOSDAC",
      18},
-    // LocalCoinSwap
-    {{0xaa, 0x19, 0x96, 0x1b, 0x6b, 0x85, 0x8d, 0x9f, 0x18, 0xa1,
-      0x15, 0xf2, 0x5a, 0xa1, 0xd9, 0x8a, 0xbc, 0x1f, 0xdb, 0xa8},
-     "LCS",
+    // Global Game Coin
+    {{0x7f, 0x96, 0x9c, 0x4d, 0x38, 0x8c, 0xa0, 0xae, 0x39, 0xa4,
+      0xfd, 0xdb, 0x1a, 0x6f, 0x89, 0x87, 0x8c, 0xa2, 0xfb, 0xf8},
+     "GGC",
      18},
-    // LockTrip
-    {{0x5e, 0x33, 0x46, 0x44, 0x40, 0x10, 0x13, 0x53, 0x22, 0x26,
-      0x8a, 0x46, 0x30, 0xd2, 0xed, 0x5f, 0x8d, 0x9,  0x44, 0x6c},
-     "LOC",
+    // Aave
+    {{0x7f, 0xc6, 0x65, 0x0,  0xc8, 0x4a, 0x76, 0xad, 0x7e, 0x9c,
+      0x93, 0x43, 0x7b, 0xfc, 0x5a, 0xc3, 0x3e, 0x2d, 0xda, 0xe9},
+     "AAVE",
      18},
-    // Locus Chain
-    {{0xc6, 0x45, 0x0,  0xdd, 0x7b, 0xf,  0x17, 0x94, 0x80, 0x7e,
-      0x67, 0x80, 0x2f, 0x8a, 0xbb, 0xf5, 0xf8, 0xff, 0xb0, 0x54},
-     "LOCUS",
+    // Nucleus Vision
+    {{0x80, 0x98, 0x26, 0xcc, 0xea, 0xb6, 0x8c, 0x38, 0x77, 0x26,
+      0xaf, 0x96, 0x27, 0x13, 0xb6, 0x4c, 0xb5, 0xcb, 0x3c, 0xca},
+     "NCASH",
      18},
-    // LooksRare
-    {{0xf4, 0xd2, 0x88, 0x8d, 0x29, 0xd7, 0x22, 0x22, 0x6f, 0xaf,
-      0xa5, 0xd9, 0xb2, 0x4f, 0x91, 0x64, 0xc0, 0x92, 0x42, 0x1e},
-     "LOOKS",
+    // Aave [OLD]
+    {{0x80, 0xfb, 0x78, 0x4b, 0x7e, 0xd6, 0x67, 0x30, 0xe8, 0xb1,
+      0xdb, 0xd9, 0x82, 0xa,  0xfd, 0x29, 0x93, 0x1a, 0xab, 0x3},
+     "LEND",
      18},
-    // Loom Network (NEW)
-    {{0x42, 0x47, 0x6f, 0x74, 0x42, 0x92, 0x10, 0x7e, 0x34, 0x51,
-      0x9f, 0x9c, 0x35, 0x79, 0x27, 0x7,  0x4e, 0xa3, 0xf7, 0x5d},
-     "LOOM",
+    // Measurable Data
+    {{0x81, 0x4e, 0x9,  0x8,  0xb1, 0x2a, 0x99, 0xfe, 0xcf, 0x5b,
+      0xc1, 0x1,  0xbb, 0x5d, 0xb,  0x8b, 0x5c, 0xdf, 0x7d, 0x26},
+     "MDT",
      18},
-    // Loopring
-    {{0xbb, 0xbb, 0xca, 0x6a, 0x90, 0x1c, 0x92, 0x6f, 0x24, 0xb,
-      0x89, 0xea, 0xcb, 0x64, 0x1d, 0x8a, 0xec, 0x7a, 0xea, 0xfd},
-     "LRC",
+    // Origin Protocol
+    {{0x82, 0x7,  0xc1, 0xff, 0xc5, 0xb6, 0x80, 0x4f, 0x60, 0x24,
+      0x32, 0x2c, 0xcf, 0x34, 0xf2, 0x9c, 0x35, 0x41, 0xae, 0x26},
+     "OGN",
      18},
-    // LunaChow
-    {{0xa5, 0xef, 0x74, 0x6,  0x8d, 0x4,  0xba, 0x8,  0x9,  0xb7,
-      0x37, 0x9d, 0xd7, 0x6a, 0xf5, 0xce, 0x34, 0xab, 0x7c, 0x57},
-     "LUCHOW",
+    // RBX
+    {{0x82, 0x54, 0xe2, 0x6e, 0x45, 0x3e, 0xb5, 0xab, 0xd2, 0x9b,
+      0x3c, 0x37, 0xac, 0x9e, 0x8d, 0xa3, 0x2e, 0x5d, 0x32, 0x99},
+     "RBX",
      18},
-    // Lunch Money
-    {{0x66, 0xfd, 0x97, 0xa7, 0x8d, 0x88, 0x54, 0xfe, 0xc4, 0x45,
-      0xcd, 0x1c, 0x80, 0xa0, 0x78, 0x96, 0xb0, 0xb4, 0x85, 0x1f},
-     "LMY",
+    // Remme
+    {{0x83, 0x98, 0x4d, 0x61, 0x42, 0x93, 0x4b, 0xb5, 0x35, 0x79,
+      0x3a, 0x82, 0xad, 0xb0, 0xa4, 0x6e, 0xf0, 0xf6, 0x6b, 0x6d},
+     "REM",
+     4},
+    // Goldmint
+    {{0x83, 0xce, 0xe9, 0xe0, 0x86, 0xa7, 0x7e, 0x49, 0x2e, 0xe0,
+      0xbb, 0x93, 0xc2, 0xb0, 0x43, 0x7a, 0xd6, 0xfd, 0xec, 0xcc},
+     "MNTP",
      18},
-    // Lunyr
-    {{0xfa, 0x5,  0xa7, 0x3f, 0xfe, 0x78, 0xef, 0x8f, 0x1a, 0x73,
-      0x94, 0x73, 0xe4, 0x62, 0xc5, 0x4b, 0xae, 0x65, 0x67, 0xd9},
-     "LUN",
+    // 0xcert
+    {{0x83, 0xe2, 0xbe, 0x8d, 0x11, 0x4f, 0x96, 0x61, 0x22, 0x13,
+      0x84, 0xb3, 0xa5, 0xd,  0x24, 0xb9, 0x6a, 0x56, 0x53, 0xf5},
+     "ZXC",
      18},
-    // MADNetwork
-    {{0x5b, 0x9,  0xa0, 0x37, 0x1c, 0x1d, 0xa4, 0x4a, 0x8e, 0x24,
-      0xd3, 0x6b, 0xf5, 0xde, 0xb1, 0x14, 0x1a, 0x84, 0xd8, 0x75},
-     "MAD",
+    // Unibright
+    {{0x84, 0x0,  0xd9, 0x4a, 0x5c, 0xb0, 0xfa, 0xd,  0x4,  0x1a,
+      0x37, 0x88, 0xe3, 0x95, 0x28, 0x5d, 0x61, 0xc9, 0xee, 0x5e},
+     "UBT",
+     8},
+    // PumaPay
+    {{0x84, 0x6c, 0x66, 0xcf, 0x71, 0xc4, 0x3f, 0x80, 0x40, 0x3b,
+      0x51, 0xfe, 0x39, 0x6,  0xb3, 0x59, 0x9d, 0x63, 0x33, 0x6f},
+     "PMA",
      18},
-    // Maecenas
-    {{0xfe, 0xc0, 0xcf, 0x7f, 0xe0, 0x78, 0xa5, 0x0,  0xab, 0xf1,
-      0x5f, 0x12, 0x84, 0x95, 0x8f, 0x22, 0x4,  0x9c, 0x2c, 0x7e},
-     "ART",
+    // Bigbom
+    {{0x84, 0xf7, 0xc4, 0x4b, 0x6f, 0xed, 0x10, 0x80, 0xf6, 0x47,
+      0xe3, 0x54, 0xd5, 0x52, 0x59, 0x5b, 0xe2, 0xcc, 0x60, 0x2f},
+     "BBO",
      18},
-    // Magic
-    {{0xb0, 0xc7, 0xa3, 0xba, 0x49, 0xc7, 0xa6, 0xea, 0xba, 0x6c,
-      0xd4, 0xa9, 0x6c, 0x55, 0xa1, 0x39, 0x10, 0x70, 0xac, 0x9a},
-     "MAGIC",
+    // Content Neutrality Network
+    {{0x87, 0x13, 0xd2, 0x66, 0x37, 0xcf, 0x49, 0xe1, 0xb6, 0xb4,
+      0xa7, 0xce, 0x57, 0x10, 0x6a, 0xab, 0xc9, 0x32, 0x53, 0x43},
+     "CNN",
      18},
-    // Hifi Finance
-    {{0xdf, 0x2c, 0x72, 0x38, 0x19, 0x8a, 0xd8, 0xb3, 0x89, 0x66,
-      0x65, 0x74, 0xf2, 0xd8, 0xbc, 0x41, 0x1a, 0x4b, 0x74, 0x28},
-     "MFT",
+    // BitCoin One
+    {{0x87, 0xf5, 0xe8, 0xc3, 0x42, 0x52, 0x18, 0x83, 0x7f, 0x3c,
+      0xb6, 0x7d, 0xb9, 0x41, 0xaf, 0xc,  0x1,  0x32, 0x3e, 0x56},
+     "BTCONE",
      18},
-    // Maker
-    {{0x9f, 0x8f, 0x72, 0xaa, 0x93, 0x4,  0xc8, 0xb5, 0x93, 0xd5,
-      0x55, 0xf1, 0x2e, 0xf6, 0x58, 0x9c, 0xc3, 0xa5, 0x79, 0xa2},
-     "MKR",
+    // Aditus
+    {{0x88, 0x10, 0xc6, 0x34, 0x70, 0xd3, 0x86, 0x39, 0x95, 0x4c,
+      0x6b, 0x41, 0xaa, 0xc5, 0x45, 0x84, 0x8c, 0x46, 0x48, 0x4a},
+     "ADI",
      18},
-    // Mandala Exchange
-    {{0x94, 0x7a, 0xeb, 0x2,  0x30, 0x43, 0x91, 0xf8, 0xfb, 0xe5,
-      0xb2, 0x5d, 0x7d, 0x98, 0xd6, 0x49, 0xb5, 0x7b, 0x17, 0x88},
-     "MDX",
+    // Sekuritance
+    {{0x88, 0x71, 0x68, 0x12, 0xc, 0xb8, 0x9f, 0xb0, 0x6f, 0x3e,
+      0x74, 0xdc, 0x4a, 0xf2, 0xd, 0x67, 0xdf, 0x9,  0x77, 0xf6},
+     "SKRT",
      18},
-    // MVL
-    {{0xa8, 0x49, 0xea, 0xae, 0x99, 0x4f, 0xb8, 0x6a, 0xfa, 0x73,
-      0x38, 0x2e, 0x9b, 0xd8, 0x8c, 0x2b, 0x6b, 0x18, 0xdc, 0x71},
-     "MVL",
+    // Lambda
+    {{0x89, 0x71, 0xf9, 0xfd, 0x71, 0x96, 0xe5, 0xce, 0xe2, 0xc1,
+      0x3,  0x2b, 0x50, 0xf6, 0x56, 0x85, 0x5a, 0xf7, 0xdd, 0x26},
+     "LAMB",
      18},
-    // Guppy
-    {{0xf7, 0xb0, 0x98, 0x29, 0x8f, 0x7c, 0x69, 0xfc, 0x14, 0x61,
-      0xb,  0xf7, 0x1d, 0x5e, 0x2,  0xc6, 0x7,  0x92, 0x89, 0x4c},
-     "GUP",
-     3},
-    // Polygon
-    {{0x7d, 0x1a, 0xfa, 0x7b, 0x71, 0x8f, 0xb8, 0x93, 0xdb, 0x30,
-      0xa3, 0xab, 0xc0, 0xcf, 0xc6, 0x8,  0xaa, 0xcf, 0xeb, 0xb0},
-     "MATIC",
+    // Sai
+    {{0x89, 0xd2, 0x4a, 0x6b, 0x4c, 0xcb, 0x1b, 0x6f, 0xaa, 0x26,
+      0x25, 0xfe, 0x56, 0x2b, 0xdd, 0x9a, 0x23, 0x26, 0x3,  0x59},
+     "SAI",
      18},
-    // Matrix AI Network
-    {{0xe2, 0x5b, 0xce, 0xc5, 0xd3, 0x80, 0x1c, 0xe3, 0xa7, 0x94,
-      0x7,  0x9b, 0xf9, 0x4a, 0xdf, 0x1b, 0x8c, 0xcd, 0x80, 0x2d},
-     "MAN",
+    // GET Protocol
+    {{0x8a, 0x85, 0x42, 0x88, 0xa5, 0x97, 0x60, 0x36, 0xa7, 0x25,
+      0x87, 0x91, 0x64, 0xca, 0x3e, 0x91, 0xd3, 0xc,  0x6a, 0x1b},
+     "GET",
      18},
-    // MATRYX
-    {{0xa,  0xf4, 0x4e, 0x27, 0x84, 0x63, 0x72, 0x18, 0xdd, 0x1d,
-      0x32, 0xa3, 0x22, 0xd4, 0x4e, 0x60, 0x3a, 0x8f, 0xc,  0x6a},
-     "MTX",
+    // IGT
+    {{0x8a, 0x88, 0xf0, 0x4e, 0xc,  0x90, 0x50, 0x54, 0xd2, 0xf3,
+      0x3b, 0x26, 0xbb, 0x3a, 0x46, 0xd7, 0x9,  0x1a, 0x3,  0x9a},
+     "IG",
      18},
-    // Measurable Data
-    {{0x81, 0x4e, 0x9,  0x8,  0xb1, 0x2a, 0x99, 0xfe, 0xcf, 0x5b,
-      0xc1, 0x1,  0xbb, 0x5d, 0xb,  0x8b, 0x5c, 0xdf, 0x7d, 0x26},
-     "MDT",
+    // Patientory
+    {{0x8a, 0xe4, 0xbf, 0x2c, 0x33, 0xa8, 0xe6, 0x67, 0xde, 0x34,
+      0xb5, 0x49, 0x38, 0xb0, 0xcc, 0xd0, 0x3e, 0xb8, 0xcc, 0x6},
+     "PTOY",
+     8},
+    // Substratum
+    {{0x8d, 0x75, 0x95, 0x9f, 0x1e, 0x61, 0xec, 0x25, 0x71, 0xaa,
+      0x72, 0x79, 0x82, 0x37, 0x10, 0x1f, 0x8,  0x4d, 0xe6, 0x3a},
+     "SUB",
      18},
-    // Medicalchain
-    {{0x41, 0xdb, 0xec, 0xc1, 0xcd, 0xc5, 0x51, 0x7c, 0x6f, 0x76,
-      0xf6, 0xa6, 0xe8, 0x36, 0xad, 0xbe, 0xe2, 0x75, 0x4d, 0xe3},
-     "MTN",
+    // tBTC
+    {{0x8d, 0xae, 0xba, 0xde, 0x92, 0x2d, 0xf7, 0x35, 0xc3, 0x8c,
+      0x80, 0xc7, 0xeb, 0xd7, 0x8,  0xaf, 0x50, 0x81, 0x5f, 0xaa},
+     "TBTC",
      18},
-    // Enzyme
-    {{0xec, 0x67, 0x0,  0x5c, 0x4e, 0x49, 0x8e, 0xc7, 0xf5, 0x5e,
-      0x9,  0x2b, 0xd1, 0xd3, 0x5c, 0xbc, 0x47, 0xc9, 0x18, 0x92},
-     "MLN",
+    // Egretia
+    {{0x8e, 0x1b, 0x44, 0x8e, 0xc7, 0xad, 0xfc, 0x7f, 0xa3, 0x5f,
+      0xc2, 0xe8, 0x85, 0x67, 0x8b, 0xd3, 0x23, 0x17, 0x6e, 0x34},
+     "EGT",
      18},
-    // mStable Governance: Meta
-    {{0xa3, 0xbe, 0xd4, 0xe1, 0xc7, 0x5d, 0x0,  0xfa, 0x6f, 0x4e,
-      0x5e, 0x69, 0x22, 0xdb, 0x72, 0x61, 0xb5, 0xe9, 0xac, 0xd2},
-     "MTA",
+    // Pax Dollar
+    {{0x8e, 0x87, 0xd, 0x67, 0xf6, 0x60, 0xd9, 0x5d, 0x5b, 0xe5,
+      0x30, 0x38, 0xd, 0xe,  0xc0, 0xbd, 0x38, 0x82, 0x89, 0xe1},
+     "USDP",
      18},
-    // Metal
-    {{0xf4, 0x33, 0x8,  0x93, 0x66, 0x89, 0x9d, 0x83, 0xa9, 0xf2,
-      0x6a, 0x77, 0x3d, 0x59, 0xec, 0x7e, 0xcf, 0x30, 0x35, 0x5e},
-     "MTL",
-     8},
-    // MetaMorph
-    {{0xfe, 0xf3, 0x88, 0x4b, 0x60, 0x3c, 0x33, 0xef, 0x8e, 0xd4,
-      0x18, 0x33, 0x46, 0xe0, 0x93, 0xa1, 0x73, 0xc9, 0x4d, 0xa6},
-     "METM",
+    // FlypMe
+    {{0x8f, 0x9,  0x21, 0xf3, 0x5,  0x55, 0x62, 0x41, 0x43, 0xd4,
+      0x27, 0xb3, 0x40, 0xb1, 0x15, 0x69, 0x14, 0x88, 0x2c, 0x10},
+     "FYP",
      18},
-    // Metronome
-    {{0xa3, 0xd5, 0x8c, 0x4e, 0x56, 0xfe, 0xdc, 0xae, 0x3a, 0x7c,
-      0x43, 0xa7, 0x25, 0xae, 0xe9, 0xa7, 0x1f, 0xe,  0xce, 0x4e},
-     "MET",
+    // Veritaseum
+    {{0x8f, 0x34, 0x70, 0xa7, 0x38, 0x8c, 0x5, 0xee, 0x4e, 0x7a,
+      0xf3, 0xd0, 0x1d, 0x8c, 0x72, 0x2b, 0xf, 0xf5, 0x23, 0x74},
+     "VERI",
      18},
-    // Midas Protocol
-    {{0x23, 0xcc, 0xc4, 0x33, 0x65, 0xd9, 0xdd, 0x38, 0x82, 0xea,
-      0xb8, 0x8f, 0x43, 0xd5, 0x15, 0x20, 0x8f, 0x83, 0x24, 0x30},
-     "MAS",
+    // Request
+    {{0x8f, 0x82, 0x21, 0xaf, 0xbb, 0x33, 0x99, 0x8d, 0x85, 0x84,
+      0xa2, 0xb0, 0x57, 0x49, 0xba, 0x73, 0xc3, 0x7a, 0x93, 0x8a},
+     "REQ",
      18},
-    // Million
-    {{0x6b, 0x4c, 0x7a, 0x5e, 0x3f, 0xb,  0x99, 0xfc, 0xd8, 0x3e,
-      0x9c, 0x8,  0x9b, 0xdd, 0xd6, 0xc7, 0xfc, 0xe5, 0xc6, 0x11},
-     "MM",
+    // X8X
+    {{0x91, 0xd,  0xfc, 0x18, 0xd6, 0xea, 0x3d, 0x6a, 0x71, 0x24,
+      0xa6, 0xf8, 0xb5, 0x45, 0x8f, 0x28, 0x10, 0x60, 0xfa, 0x4c},
+     "X8X",
      18},
-    // Minds
-    {{0xb2, 0x66, 0x31, 0xc6, 0xdd, 0xa0, 0x6a, 0xd8, 0x9b, 0x93,
-      0xc7, 0x14, 0x0,  0xd2, 0x56, 0x92, 0xde, 0x89, 0xc0, 0x68},
-     "MINDS",
+    // Pussy Financial
+    {{0x91, 0x96, 0xe1, 0x8b, 0xc3, 0x49, 0xb1, 0xf6, 0x4b, 0xc0,
+      0x87, 0x84, 0xea, 0xe2, 0x59, 0x52, 0x53, 0x29, 0xa1, 0xad},
+     "PUSSY",
      18},
-    // MobileGo
-    {{0x40, 0x39, 0x50, 0x44, 0xac, 0x3c, 0xc,  0x57, 0x5,  0x19,
-      0x6,  0xda, 0x93, 0x8b, 0x54, 0xbd, 0x65, 0x57, 0xf2, 0x12},
-     "MGO",
-     8},
-    // Moeda Loyalty Points
-    {{0x51, 0xdb, 0x5a, 0xd3, 0x5c, 0x67, 0x1a, 0x87, 0x20, 0x7d,
-      0x88, 0xfc, 0x11, 0xd5, 0x93, 0xac, 0xc,  0x84, 0x15, 0xbd},
-     "MDA",
+    // Yee
+    {{0x92, 0x21, 0x5,  0xfa, 0xd8, 0x15, 0x3f, 0x51, 0x6b, 0xcf,
+      0xb8, 0x29, 0xf5, 0x6d, 0xc0, 0x97, 0xa0, 0xe1, 0xd7, 0x5},
+     "YEE",
      18},
-    // MCO
-    {{0xb6, 0x3b, 0x60, 0x6a, 0xc8, 0x10, 0xa5, 0x2c, 0xca, 0x15,
-      0xe4, 0x4b, 0xb6, 0x30, 0xfd, 0x42, 0xd8, 0xd1, 0xd8, 0x3d},
-     "MCO",
-     8},
-    // Monetha
-    {{0xaf, 0x4d, 0xce, 0x16, 0xda, 0x28, 0x77, 0xf8, 0xc9, 0xe0,
-      0x5,  0x44, 0xc9, 0x3b, 0x62, 0xac, 0x40, 0x63, 0x1f, 0x16},
-     "MTH",
-     5},
-    // Morpheus Labs
-    {{0x4a, 0x52, 0x7d, 0x8f, 0xc1, 0x3c, 0x52, 0x3,  0xab, 0x24,
-      0xba, 0x9,  0x44, 0xf4, 0xcb, 0x14, 0x65, 0x8d, 0x1d, 0xb6},
-     "MITX",
+    // Devery
+    {{0x92, 0x31, 0x8,  0xa4, 0x39, 0xc4, 0xe8, 0xc2, 0x31, 0x5c,
+      0x4f, 0x65, 0x21, 0xe5, 0xce, 0x95, 0xb4, 0x4e, 0x9b, 0x4c},
+     "EVE",
      18},
-    // Mysterium
-    {{0x4c, 0xf8, 0x9c, 0xa0, 0x6a, 0xd9, 0x97, 0xbc, 0x73, 0x2d,
-      0xc8, 0x76, 0xed, 0x2a, 0x7f, 0x26, 0xa9, 0xe7, 0xf3, 0x61},
-     "MYST",
+    // Eristica
+    {{0x92, 0xa5, 0xb0, 0x4d, 0xe,  0xd5, 0xd9, 0x4d, 0x7a, 0x19,
+      0x3d, 0x1d, 0x33, 0x4d, 0x3d, 0x16, 0x99, 0x6f, 0x4e, 0x13},
+     "ERT",
      18},
-    // NAGA
-    {{0x72, 0xdd, 0x4b, 0x6b, 0xd8, 0x52, 0xa3, 0xaa, 0x17, 0x2b,
-      0xe4, 0xd6, 0xc5, 0xa6, 0xdb, 0xec, 0x58, 0x8c, 0xf1, 0x31},
-     "NGC",
+    // U.CASH
+    {{0x92, 0xe5, 0x2a, 0x1a, 0x23, 0x5d, 0x9a, 0x10, 0x3d, 0x97,
+      0x9,  0x1,  0x6,  0x6c, 0xe9, 0x10, 0xaa, 0xce, 0xfd, 0x37},
+     "UCASH",
+     8},
+    // Kleros
+    {{0x93, 0xed, 0x3f, 0xbe, 0x21, 0x20, 0x7e, 0xc2, 0xe8, 0xf2,
+      0xd3, 0xc3, 0xde, 0x6e, 0x5,  0x8c, 0xb7, 0x3b, 0xc0, 0x4d},
+     "PNK",
      18},
-    // NAOS Finance
-    {{0x4a, 0x61, 0x5b, 0xb7, 0x16, 0x62, 0x10, 0xcc, 0xe2, 0xe,
-      0x66, 0x42, 0xa6, 0xf8, 0xfb, 0x5d, 0x4d, 0x4,  0x44, 0x96},
-     "NAOS",
+    // FansTime
+    {{0x94, 0x3e, 0xd8, 0x52, 0xda, 0xdb, 0x5c, 0x39, 0x38, 0xec,
+      0xdc, 0x68, 0x83, 0x71, 0x8d, 0xf8, 0x14, 0x2d, 0xe4, 0xc8},
+     "FTI",
      18},
-    // Napoleon X
-    {{0x28, 0xb5, 0xe1, 0x2c, 0xce, 0x51, 0xf1, 0x55, 0x94, 0xb0,
-      0xb9, 0x1d, 0x5b, 0x5a, 0xda, 0xa7, 0xf,  0x68, 0x4a, 0x2},
-     "NPX",
-     2},
-    // nDEX
-    {{0x19, 0x66, 0xd7, 0x18, 0xa5, 0x65, 0x56, 0x6e, 0x8e, 0x20,
-      0x27, 0x92, 0x65, 0x8d, 0x7b, 0x5f, 0xf4, 0xec, 0xe4, 0x69},
-     "NDX",
-     18},
-    // Nebulas
-    {{0x5d, 0x65, 0xd9, 0x71, 0x89, 0x5e, 0xdc, 0x43, 0x8f, 0x46,
-      0x5c, 0x17, 0xdb, 0x69, 0x92, 0x69, 0x8a, 0x52, 0x31, 0x8d},
-     "NAS",
+    // Mandala Exchange
+    {{0x94, 0x7a, 0xeb, 0x2,  0x30, 0x43, 0x91, 0xf8, 0xfb, 0xe5,
+      0xb2, 0x5d, 0x7d, 0x98, 0xd6, 0x49, 0xb5, 0x7b, 0x17, 0x88},
+     "MDX",
      18},
-    // NEEO
-    {{0xd8, 0x44, 0x62, 0x36, 0xfa, 0x95, 0xb9, 0xb5, 0xf9, 0xfd,
-      0xf,  0x8e, 0x7d, 0xf1, 0xa9, 0x44, 0x82, 0x3c, 0x68, 0x3d},
-     "NEEO",
+    // AMIS
+    {{0x94, 0x9b, 0xed, 0x88, 0x6c, 0x73, 0x9f, 0x1a, 0x32, 0x73,
+      0x62, 0x9b, 0x33, 0x20, 0xdb, 0xc,  0x50, 0x24, 0xc7, 0x19},
+     "AMIS",
+     9},
+    // easyMine
+    {{0x95, 0x1,  0xbf, 0xc4, 0x88, 0x97, 0xdc, 0xee, 0xad, 0xf7,
+      0x31, 0x13, 0xef, 0x63, 0x5d, 0x2f, 0xf7, 0xee, 0x4b, 0x97},
+     "EMT",
      18},
-    // Neos Credits
-    {{0xdb, 0x5c, 0x3c, 0x46, 0xe2, 0x8b, 0x53, 0xa3, 0x9c, 0x25,
-      0x5a, 0xa3, 0x9a, 0x41, 0x1d, 0xd6, 0x4e, 0x5f, 0xed, 0x9c},
-     "NCR",
+    // Shiba Inu
+    {{0x95, 0xad, 0x61, 0xb0, 0xa1, 0x50, 0xd7, 0x92, 0x19, 0xdc,
+      0xf6, 0x4e, 0x1e, 0x6c, 0xc0, 0x1f, 0xb,  0x64, 0xc4, 0xce},
+     "SHIB",
      18},
-    // Neumark
-    {{0xa8, 0x23, 0xe6, 0x72, 0x20, 0x6,  0xaf, 0xe9, 0x9e, 0x91,
-      0xc3, 0xf,  0xf5, 0x29, 0x50, 0x52, 0xfe, 0x6b, 0x8e, 0x32},
-     "NEU",
+    // Ocean Protocol
+    {{0x96, 0x7d, 0xa4, 0x4,  0x8c, 0xd0, 0x7a, 0xb3, 0x78, 0x55,
+      0xc0, 0x90, 0xaa, 0xf3, 0x66, 0xe4, 0xce, 0x1b, 0x9f, 0x48},
+     "OCEAN",
      18},
-    // NEXO
-    {{0xb6, 0x21, 0x32, 0xe3, 0x5a, 0x6c, 0x13, 0xee, 0x1e, 0xe0,
-      0xf8, 0x4d, 0xc5, 0xd4, 0xb,  0xad, 0x8d, 0x81, 0x52, 0x6},
-     "NEXO",
+    // BitMart
+    {{0x98, 0x6e, 0xe2, 0xb9, 0x44, 0xc4, 0x2d, 0x1,  0x7f, 0x52,
+      0xaf, 0x21, 0xc4, 0xc6, 0x9b, 0x84, 0xdb, 0xea, 0x35, 0xd8},
+     "BMX",
      18},
-    // Nifty League
-    {{0x3c, 0x8d, 0x2f, 0xce, 0x49, 0x90, 0x6e, 0x11, 0xe7, 0x1c,
-      0xb1, 0x6f, 0xa0, 0xff, 0xeb, 0x2b, 0x16, 0xc2, 0x96, 0x38},
-     "NFTL",
+    // Thorecash (ERC-20)
+    {{0x99, 0x72, 0xa0, 0xf2, 0x41, 0x94, 0x44, 0x7e, 0x73, 0xa7,
+      0xe8, 0xb6, 0xcd, 0x26, 0xa5, 0x2e, 0x2,  0xdd, 0xfa, 0xd5},
+     "TCH",
      18},
-    // Niobium Coin
-    {{0x9f, 0x19, 0x56, 0x17, 0xfa, 0x8f, 0xba, 0xd9, 0x54, 0xc,
-      0x5d, 0x11, 0x3a, 0x99, 0xa0, 0xa0, 0x17, 0x2a, 0xae, 0xdc},
-     "NBC",
+    // Banca
+    {{0x99, 0x8b, 0x3b, 0x82, 0xbc, 0x9d, 0xba, 0x17, 0x39, 0x90,
+      0xbe, 0x7a, 0xfb, 0x77, 0x27, 0x88, 0xb5, 0xac, 0xb8, 0xbd},
+     "BANCA",
      18},
-    // NKN
-    {{0x5c, 0xf0, 0x47, 0x16, 0xba, 0x20, 0x12, 0x7f, 0x1e, 0x22,
-      0x97, 0xad, 0xdc, 0xf4, 0xb5, 0x3,  0x50, 0x0,  0xc9, 0xeb},
-     "NKN",
+    // Rupiah
+    {{0x99, 0x8f, 0xfe, 0x1e, 0x43, 0xfa, 0xcf, 0xfb, 0x94, 0x1d,
+      0xc3, 0x37, 0xdd, 0x4,  0x68, 0xd5, 0x2b, 0xa5, 0xb4, 0x8a},
+     "IDRT",
+     2},
+    // Polymath
+    {{0x99, 0x92, 0xec, 0x3c, 0xf6, 0xa5, 0x5b, 0x0,  0x97, 0x8c,
+      0xdd, 0xf2, 0xb2, 0x7b, 0xc6, 0x88, 0x2d, 0x88, 0xd1, 0xec},
+     "POLY",
      18},
-    // Nucleus Vision
-    {{0x80, 0x98, 0x26, 0xcc, 0xea, 0xb6, 0x8c, 0x38, 0x77, 0x26,
-      0xaf, 0x96, 0x27, 0x13, 0xb6, 0x4c, 0xb5, 0xcb, 0x3c, 0xca},
-     "NCASH",
+    // Ties.DB
+    {{0x99, 0x99, 0x67, 0xe2, 0xec, 0x8a, 0x74, 0xb7, 0xc8, 0xe9,
+      0xdb, 0x19, 0xe0, 0x39, 0xd9, 0x20, 0xb3, 0x1d, 0x39, 0xd0},
+     "TIE",
      18},
-    // NuCypher
-    {{0x4f, 0xe8, 0x32, 0x13, 0xd5, 0x63, 0x8, 0x33, 0xe,  0xc3,
-      0x2,  0xa8, 0xbd, 0x64, 0x1f, 0x1d, 0x1, 0x13, 0xa4, 0xcc},
-     "NU",
+    // Quantstamp
+    {{0x99, 0xea, 0x4d, 0xb9, 0xee, 0x77, 0xac, 0xd4, 0xb,  0x11,
+      0x9b, 0xd1, 0xdc, 0x4e, 0x33, 0xe1, 0xc0, 0x70, 0xb8, 0xd},
+     "QSP",
      18},
-    // Numeraire
-    {{0x17, 0x76, 0xe1, 0xf2, 0x6f, 0x98, 0xb1, 0xa5, 0xdf, 0x9c,
-      0xd3, 0x47, 0x95, 0x3a, 0x26, 0xdd, 0x3c, 0xb4, 0x66, 0x71},
-     "NMR",
+    // Tokok
+    {{0x9a, 0x49, 0xf0, 0x2e, 0x12, 0x8a, 0x8e, 0x98, 0x9b, 0x44,
+      0x3a, 0x8f, 0x94, 0x84, 0x3c, 0x9,  0x18, 0xbf, 0x45, 0xe7},
+     "TOK",
+     8},
+    // Aurora Chain
+    {{0x9a, 0xb1, 0x65, 0xd7, 0x95, 0x1,  0x9b, 0x6d, 0x8b, 0x3e,
+      0x97, 0x1d, 0xda, 0x91, 0x7,  0x14, 0x21, 0x30, 0x5e, 0x5a},
+     "AOA",
      18},
-    // Ocean Protocol
-    {{0x96, 0x7d, 0xa4, 0x4,  0x8c, 0xd0, 0x7a, 0xb3, 0x78, 0x55,
-      0xc0, 0x90, 0xaa, 0xf3, 0x66, 0xe4, 0xce, 0x1b, 0x9f, 0x48},
-     "OCEAN",
+    // Quadrans
+    {{0x9a, 0xdc, 0x77, 0x10, 0xe9, 0xd1, 0xb2, 0x9d, 0x8a, 0x78,
+      0xc0, 0x4d, 0x52, 0xd3, 0x25, 0x32, 0x29, 0x7c, 0x2e, 0xf3},
+     "QDT",
      18},
-    // OctoFi
-    {{0x72, 0x40, 0xac, 0x91, 0xf0, 0x12, 0x33, 0xba, 0xaf, 0x8b,
-      0x6,  0x42, 0x48, 0xe8, 0xf,  0xea, 0xa5, 0x91, 0x2b, 0xa3},
-     "OCTO",
+    // DomRaider
+    {{0x9a, 0xf4, 0xf2, 0x69, 0x41, 0x67, 0x7c, 0x70, 0x6c, 0xfe,
+      0xcf, 0x6d, 0x33, 0x79, 0xff, 0x1,  0xbb, 0x85, 0xd5, 0xab},
+     "DRT",
+     8},
+    // Hydro Protocol
+    {{0x9a, 0xf8, 0x39, 0x68, 0x7f, 0x6c, 0x94, 0x54, 0x2a, 0xc5,
+      0xec, 0xe2, 0xe3, 0x17, 0xda, 0xae, 0x35, 0x54, 0x93, 0xa1},
+     "HOT",
      18},
-    // ODEM
-    {{0xbf, 0x52, 0xf2, 0xab, 0x39, 0xe2, 0x6e, 0x9,  0x51, 0xd2,
-      0xa0, 0x2b, 0x49, 0xb7, 0x70, 0x2a, 0xbe, 0x30, 0x40, 0x6a},
-     "ODE",
+    // DecentBet
+    {{0x9b, 0x68, 0xbf, 0xae, 0x21, 0xdf, 0x5a, 0x51, 0x9,  0x31,
+      0xa2, 0x62, 0xce, 0xcf, 0x63, 0xf4, 0x13, 0x38, 0xf2, 0x64},
+     "DBET",
      18},
-    // Odyssey
-    {{0x40, 0x92, 0x67, 0x8e, 0x4e, 0x78, 0x23, 0xf,  0x46, 0xa1,
-      0x53, 0x4c, 0xf,  0xbc, 0x8f, 0xa3, 0x97, 0x80, 0x89, 0x2b},
-     "OCN",
+    // GATENet
+    {{0x9d, 0x76, 0x30, 0xad, 0xf7, 0xab, 0xb,  0xc,  0xb0, 0xa,
+      0xf7, 0x47, 0xdb, 0x76, 0x86, 0x4d, 0xf0, 0xec, 0x82, 0xe4},
+     "GATE",
      18},
-    // OKB
-    {{0x75, 0x23, 0x1f, 0x58, 0xb4, 0x32, 0x40, 0xc9, 0x71, 0x8d,
-      0xd5, 0x8b, 0x49, 0x67, 0xc5, 0x11, 0x43, 0x42, 0xa8, 0x6c},
-     "OKB",
+    // PolySwarm
+    {{0x9e, 0x46, 0xa3, 0x8f, 0x5d, 0xaa, 0xbe, 0x86, 0x83, 0xe1,
+      0x7,  0x93, 0xb0, 0x67, 0x49, 0xee, 0xf7, 0xd7, 0x33, 0xd1},
+     "NCT",
      18},
-    // OMG Network
-    {{0xd2, 0x61, 0x14, 0xcd, 0x6e, 0xe2, 0x89, 0xac, 0xcf, 0x82,
-      0x35, 0xc,  0x8d, 0x84, 0x87, 0xfe, 0xdb, 0x8a, 0xc,  0x7},
-     "OMG",
+    // Niobium Coin
+    {{0x9f, 0x19, 0x56, 0x17, 0xfa, 0x8f, 0xba, 0xd9, 0x54, 0xc,
+      0x5d, 0x11, 0x3a, 0x99, 0xa0, 0xa0, 0x17, 0x2a, 0xae, 0xdc},
+     "NBC",
      18},
-    // OneLedger
-    {{0x64, 0xa6, 0x4,  0x93, 0xd8, 0x88, 0x72, 0x8c, 0xf4, 0x26,
-      0x16, 0xe0, 0x34, 0xa0, 0xdf, 0xea, 0xe3, 0x8e, 0xfc, 0xf0},
-     "OLT",
+    // Maker
+    {{0x9f, 0x8f, 0x72, 0xaa, 0x93, 0x4,  0xc8, 0xb5, 0x93, 0xd5,
+      0x55, 0xf1, 0x2e, 0xf6, 0x58, 0x9c, 0xc3, 0xa5, 0x79, 0xa2},
+     "MKR",
      18},
-    // OneRoot Network
-    {{0xff, 0x60, 0x3f, 0x43, 0x94, 0x6a, 0x3a, 0x28, 0xdf, 0x5e,
-      0x6a, 0x73, 0x17, 0x25, 0x55, 0xd8, 0xc8, 0xb0, 0x23, 0x86},
-     "RNT",
+    // GAMB
+    {{0xa0, 0x0, 0x8f, 0x51, 0xf,  0xe9, 0xee, 0x69, 0x6e, 0x7e,
+      0x32, 0xc, 0x9e, 0x5c, 0xbf, 0x61, 0xe2, 0x77, 0x91, 0xee},
+     "GMB",
      18},
-    // OAX
-    {{0x70, 0x1c, 0x24, 0x4b, 0x98, 0x8a, 0x51, 0x3c, 0x94, 0x59,
-      0x73, 0xde, 0xfa, 0x5,  0xde, 0x93, 0x3b, 0x23, 0xfe, 0x1d},
-     "OAX",
+    // USD Coin
+    {{0xa0, 0xb8, 0x69, 0x91, 0xc6, 0x21, 0x8b, 0x36, 0xc1, 0xd1,
+      0x9d, 0x4a, 0x2e, 0x9e, 0xb0, 0xce, 0x36, 0x6,  0xeb, 0x48},
+     "USDC",
+     6},
+    // Swash
+    {{0xa1, 0x30, 0xe3, 0xa3, 0x3a, 0x4d, 0x84, 0xb0, 0x4c, 0x39,
+      0x18, 0xc4, 0xe5, 0x76, 0x22, 0x23, 0xae, 0x25, 0x2f, 0x80},
+     "SWASH",
      18},
-    // Opus
-    {{0x43, 0x55, 0xfc, 0x16, 0xf,  0x74, 0x32, 0x8f, 0x9b, 0x38,
-      0x3d, 0xf2, 0xec, 0x58, 0x9b, 0xb3, 0xdf, 0xd8, 0x2b, 0xa0},
-     "OPT",
+    // Sentinel Chain
+    {{0xa1, 0x3f, 0x7,  0x43, 0x95, 0x1b, 0x4f, 0x6e, 0x3e, 0x3a,
+      0xa0, 0x39, 0xf6, 0x82, 0xe1, 0x72, 0x79, 0xf5, 0x2b, 0xc3},
+     "SENC",
      18},
-    // Orbs
-    {{0xff, 0x56, 0xcc, 0x6b, 0x1e, 0x6d, 0xed, 0x34, 0x7a, 0xa0,
-      0xb7, 0x67, 0x6c, 0x85, 0xab, 0xb,  0x3d, 0x8,  0xb0, 0xfa},
-     "ORBS",
+    // Pundi X [OLD]
+    {{0xa1, 0x5c, 0x7e, 0xbe, 0x1f, 0x7,  0xca, 0xf6, 0xbf, 0xf0,
+      0x97, 0xd8, 0xa5, 0x89, 0xfb, 0x8a, 0xc4, 0x9a, 0xe5, 0xb3},
+     "NPXS",
      18},
-    // Orchid Protocol
-    {{0x45, 0x75, 0xf4, 0x13, 0x8,  0xec, 0x14, 0x83, 0xf3, 0xd3,
-      0x99, 0xaa, 0x9a, 0x28, 0x26, 0xd7, 0x4d, 0xa1, 0x3d, 0xeb},
-     "OXT",
+    // DFI.money
+    {{0xa1, 0xd0, 0xe2, 0x15, 0xa2, 0x3d, 0x70, 0x30, 0x84, 0x2f,
+      0xc6, 0x7c, 0xe5, 0x82, 0xa6, 0xaf, 0xa3, 0xcc, 0xab, 0x83},
+     "YFII",
      18},
-    // Origin Dollar
-    {{0x2a, 0x8e, 0x1e, 0x67, 0x6e, 0xc2, 0x38, 0xd8, 0xa9, 0x92,
-      0x30, 0x7b, 0x49, 0x5b, 0x45, 0xb3, 0xfe, 0xaa, 0x5e, 0x86},
-     "OUSD",
+    // Roobee
+    {{0xa3, 0x1b, 0x17, 0x67, 0xe0, 0x9f, 0x84, 0x2e, 0xcf, 0xd4,
+      0xbc, 0x47, 0x1f, 0xe4, 0x4f, 0x83, 0xe,  0x38, 0x91, 0xaa},
+     "ROOBEE",
      18},
-    // Origin Protocol
-    {{0x82, 0x7,  0xc1, 0xff, 0xc5, 0xb6, 0x80, 0x4f, 0x60, 0x24,
-      0x32, 0x2c, 0xcf, 0x34, 0xf2, 0x9c, 0x35, 0x41, 0xae, 0x26},
-     "OGN",
+    // mStable Governance: Meta
+    {{0xa3, 0xbe, 0xd4, 0xe1, 0xc7, 0x5d, 0x0,  0xfa, 0x6f, 0x4e,
+      0x5e, 0x69, 0x22, 0xdb, 0x72, 0x61, 0xb5, 0xe9, 0xac, 0xd2},
+     "MTA",
      18},
-    // Origin Sport
-    {{0xeb, 0x9a, 0x4b, 0x18, 0x58, 0x16, 0xc3, 0x54, 0xdb, 0x92,
-      0xdb, 0x9,  0xcc, 0x3b, 0x50, 0xbe, 0x60, 0xb9, 0x1,  0xb6},
-     "ORS",
+    // Metronome
+    {{0xa3, 0xd5, 0x8c, 0x4e, 0x56, 0xfe, 0xdc, 0xae, 0x3a, 0x7c,
+      0x43, 0xa7, 0x25, 0xae, 0xe9, 0xa7, 0x1f, 0xe,  0xce, 0x4e},
+     "MET",
      18},
-    // OriginTrail
-    {{0xaa, 0x7a, 0x9c, 0xa8, 0x7d, 0x36, 0x94, 0xb5, 0x75, 0x5f,
-      0x21, 0x3b, 0x5d, 0x4,  0x9,  0x4b, 0x8d, 0xf,  0xa,  0x6f},
-     "TRAC",
+    // Creditcoin
+    {{0xa3, 0xee, 0x21, 0xc3, 0x6,  0xa7, 0x0,  0xe6, 0x82, 0xab,
+      0xcd, 0xfe, 0x9b, 0xaa, 0x6a, 0x8,  0xf3, 0x82, 0x4,  0x19},
+     "CTC",
      18},
-    // OWNDATA
-    {{0x17, 0xb,  0x27, 0x5c, 0xed, 0x8,  0x9f, 0xff, 0xae, 0xbf,
-      0xe9, 0x27, 0xf4, 0x45, 0xa3, 0x50, 0xed, 0x91, 0x60, 0xdc},
-     "OWN",
+    // Sentinel [OLD]
+    {{0xa4, 0x4e, 0x51, 0x37, 0x29, 0x3e, 0x85, 0x5b, 0x1b, 0x7b,
+      0xc7, 0xe2, 0xc6, 0xf8, 0xcd, 0x79, 0x6f, 0xfc, 0xb0, 0x37},
+     "DVPN",
      8},
-    // 0xBitcoin
-    {{0xb6, 0xed, 0x76, 0x44, 0xc6, 0x94, 0x16, 0xd6, 0x7b, 0x52,
-      0x2e, 0x20, 0xbc, 0x29, 0x4a, 0x9a, 0x9b, 0x40, 0x5b, 0x31},
-     "0XBTC",
-     8},
-    // P2P solutions foundation
-    {{0x45, 0x27, 0xa3, 0xb4, 0xa8, 0xa1, 0x50, 0x40, 0x30, 0x90,
-      0xa9, 0x9b, 0x87, 0xef, 0xfc, 0x96, 0xf2, 0x19, 0x50, 0x47},
-     "P2PS",
-     8},
-    // Parkgene
-    {{0x6d, 0xd4, 0xe4, 0xaa, 0xd2, 0x9a, 0x40, 0xed, 0xd6, 0xa4,
-      0x9,  0xb9, 0xc1, 0x62, 0x51, 0x86, 0xc9, 0x85, 0x5b, 0x4d},
-     "GENE",
-     8},
-    // Patientory
-    {{0x8a, 0xe4, 0xbf, 0x2c, 0x33, 0xa8, 0xe6, 0x67, 0xde, 0x34,
-      0xb5, 0x49, 0x38, 0xb0, 0xcc, 0xd0, 0x3e, 0xb8, 0xcc, 0x6},
-     "PTOY",
-     8},
-    // Patron
-    {{0xf3, 0xb3, 0xca, 0xd0, 0x94, 0xb8, 0x93, 0x92, 0xfc, 0xe5,
-      0xfa, 0xfd, 0x40, 0xbc, 0x3,  0xb8, 0xf,  0x2b, 0xc6, 0x24},
-     "PAT",
+    // Stably USD
+    {{0xa4, 0xbd, 0xb1, 0x1d, 0xc0, 0xa2, 0xbe, 0xc8, 0x8d, 0x24,
+      0xa3, 0xaa, 0x1e, 0x6b, 0xb1, 0x72, 0x1,  0x11, 0x2e, 0xbe},
+     "USDS",
+     6},
+    // LunaChow
+    {{0xa5, 0xef, 0x74, 0x6,  0x8d, 0x4,  0xba, 0x8,  0x9,  0xb7,
+      0x37, 0x9d, 0xd7, 0x6a, 0xf5, 0xce, 0x34, 0xab, 0x7c, 0x57},
+     "LUCHOW",
      18},
-    // PAX Gold
-    {{0x45, 0x80, 0x48, 0x80, 0xde, 0x22, 0x91, 0x3d, 0xaf, 0xe0,
-      0x9f, 0x49, 0x80, 0x84, 0x8e, 0xce, 0x6e, 0xcb, 0xaf, 0x78},
-     "PAXG",
+    // EchoLink
+    {{0xa6, 0xa8, 0x40, 0xe5, 0xb,  0xca, 0xa5, 0xd,  0xa0, 0x17,
+      0xb9, 0x1a, 0xd,  0x86, 0xb8, 0xb2, 0xd4, 0x11, 0x56, 0xee},
+     "EKO",
      18},
-    // Pax Dollar
-    {{0x8e, 0x87, 0xd, 0x67, 0xf6, 0x60, 0xd9, 0x5d, 0x5b, 0xe5,
-      0x30, 0x38, 0xd, 0xe,  0xc0, 0xbd, 0x38, 0x82, 0x89, 0xe1},
-     "USDP",
+    // TrueFlip
+    {{0xa7, 0xf9, 0x76, 0xc3, 0x60, 0xeb, 0xbe, 0xd4, 0x46, 0x5c,
+      0x28, 0x55, 0x68, 0x4d, 0x1a, 0xae, 0x52, 0x71, 0xef, 0xa9},
+     "TFL",
+     8},
+    // Neumark
+    {{0xa8, 0x23, 0xe6, 0x72, 0x20, 0x6,  0xaf, 0xe9, 0x9e, 0x91,
+      0xc3, 0xf,  0xf5, 0x29, 0x50, 0x52, 0xfe, 0x6b, 0x8e, 0x32},
+     "NEU",
      18},
-    // Paycent
-    {{0x1,  0x42, 0xc3, 0xb2, 0xfc, 0x51, 0x81, 0x9b, 0x5a, 0xf5,
-      0xdf, 0xc4, 0xaa, 0x52, 0xdf, 0x97, 0x22, 0x79, 0x8,  0x51},
-     "PYN",
+    // MVL
+    {{0xa8, 0x49, 0xea, 0xae, 0x99, 0x4f, 0xb8, 0x6a, 0xfa, 0x73,
+      0x38, 0x2e, 0x9b, 0xd8, 0x8c, 0x2b, 0x6b, 0x18, 0xdc, 0x71},
+     "MVL",
      18},
-    // PayPie
-    {{0xc4, 0x22, 0x9,  0xac, 0xcc, 0x14, 0x2,  0x9c, 0x10, 0x12,
-      0xfb, 0x56, 0x80, 0xd9, 0x5f, 0xbd, 0x60, 0x36, 0xe2, 0xa0},
-     "PPP",
+    // Elysian
+    {{0xa9, 0x55, 0x92, 0xdc, 0xff, 0xa3, 0xc0, 0x80, 0xb4, 0xb4,
+      0xe,  0x45, 0x9c, 0x5f, 0x56, 0x92, 0xf6, 0x7d, 0xb7, 0xf8},
+     "ELY",
      18},
-    // PeerGuess
-    {{0xbd, 0xcf, 0xbf, 0x5c, 0x4d, 0x91, 0xab, 0xc0, 0xbc, 0x97,
-      0x9,  0xc7, 0x28, 0x6d, 0x0,  0x6,  0x3c, 0xe,  0x6f, 0x22},
-     "GUESS",
-     2},
-    // Pickle Finance
-    {{0x42, 0x98, 0x81, 0x67, 0x2b, 0x9a, 0xe4, 0x2b, 0x8e, 0xba,
-      0xe,  0x26, 0xcd, 0x9c, 0x73, 0x71, 0x1b, 0x89, 0x1c, 0xa5},
-     "PICKLE",
+    // Zipper Network
+    {{0xa9, 0xd2, 0x92, 0x7d, 0x3a, 0x4,  0x30, 0x9e, 0x0,  0x8b,
+      0x6a, 0xf6, 0xe2, 0xe2, 0x82, 0xae, 0x29, 0x52, 0xe7, 0xfd},
+     "ZIP",
      18},
-    // PieDAO BTC++
-    {{0x3,  0x27, 0x11, 0x24, 0x23, 0xf3, 0xa6, 0x8e, 0xfd, 0xf1,
-      0xfc, 0xf4, 0x2,  0xf6, 0xc5, 0xcb, 0x9f, 0x7c, 0x33, 0xfd},
-     "BTC++",
+    // LocalCoinSwap
+    {{0xaa, 0x19, 0x96, 0x1b, 0x6b, 0x85, 0x8d, 0x9f, 0x18, 0xa1,
+      0x15, 0xf2, 0x5a, 0xa1, 0xd9, 0x8a, 0xbc, 0x1f, 0xdb, 0xa8},
+     "LCS",
      18},
-    // Pillar
-    {{0xe3, 0x81, 0x85, 0x4,  0xc1, 0xb3, 0x2b, 0xf1, 0x55, 0x7b,
-      0x16, 0xc2, 0x38, 0xb2, 0xe0, 0x1f, 0xd3, 0x14, 0x9c, 0x17},
-     "PLR",
+    // OriginTrail
+    {{0xaa, 0x7a, 0x9c, 0xa8, 0x7d, 0x36, 0x94, 0xb5, 0x75, 0x5f,
+      0x21, 0x3b, 0x5d, 0x4,  0x9,  0x4b, 0x8d, 0xf,  0xa,  0x6f},
+     "TRAC",
      18},
-    // PiplCoin
-    {{0xe6, 0x45, 0x9,  0xf0, 0xbf, 0x7, 0xce, 0x2d, 0x29, 0xa7,
-      0xef, 0x19, 0xa8, 0xa9, 0xbc, 0x6, 0x54, 0x77, 0xc1, 0xb4},
-     "PIPL",
+    // Fundamenta
+    {{0xaa, 0x9d, 0x86, 0x66, 0x66, 0xc2, 0xa3, 0x74, 0x8d, 0x6b,
+      0x23, 0xff, 0x69, 0xe6, 0x3e, 0x52, 0xf0, 0x8d, 0x9a, 0xb4},
+     "FMTA",
+     18},
+    // Monolith
+    {{0xaa, 0xaf, 0x91, 0xd9, 0xb9, 0xd,  0xf8, 0x0,  0xdf, 0x4f,
+      0x55, 0xc2, 0x5,  0xfd, 0x69, 0x89, 0xc9, 0x77, 0xe7, 0x3a},
+     "TKN",
      8},
-    // PKG
-    {{0x2,  0xf2, 0xd4, 0xa0, 0x4e, 0x6e, 0x1,  0xac, 0xe8, 0x8b,
-      0xd2, 0xcd, 0x63, 0x28, 0x75, 0x54, 0x3b, 0x2e, 0xf5, 0x77},
-     "PKG",
+    // UChain
+    {{0xaa, 0xf3, 0x70, 0x55, 0x18, 0x8f, 0xee, 0xe4, 0x86, 0x9d,
+      0xe6, 0x34, 0x64, 0x93, 0x7e, 0x68, 0x3d, 0x61, 0xb2, 0xa1},
+     "UCN",
      18},
-    // Level-Up Coin
-    {{0x5d, 0xbe, 0x29, 0x6f, 0x97, 0xb2, 0x3c, 0x4a, 0x6a, 0xa6,
-      0x18, 0x3d, 0x73, 0xe5, 0x74, 0xd0, 0x2b, 0xa5, 0xc7, 0x19},
-     "LUC",
+    // YAM v2
+    {{0xab, 0xa8, 0xca, 0xc6, 0x86, 0x6b, 0x83, 0xae, 0x4e, 0xec,
+      0x97, 0xdd, 0x7,  0xed, 0x25, 0x42, 0x82, 0xf6, 0xad, 0x8a},
+     "YAMV2",
+     24},
+    // DATx
+    {{0xab, 0xbb, 0xb6, 0x44, 0x7b, 0x68, 0xff, 0xd6, 0x14, 0x1d,
+      0xa7, 0x7c, 0x18, 0xc7, 0xb5, 0x87, 0x6e, 0xd6, 0xc5, 0xab},
+     "DATX",
      18},
-    // PlayGame
-    {{0x47, 0xe6, 0x7b, 0xa6, 0x6b, 0x6,  0x99, 0x50, 0xf,  0x18,
-      0xa5, 0x3f, 0x94, 0xe2, 0xb9, 0xdb, 0x3d, 0x47, 0x43, 0x7e},
-     "PXG",
+    // Dovu
+    {{0xac, 0x32, 0x11, 0xa5, 0x2,  0x54, 0x14, 0xaf, 0x28, 0x66,
+      0xff, 0x9,  0xc2, 0x3f, 0xc1, 0x8b, 0xc9, 0x7e, 0x79, 0xb1},
+     "DOV",
      18},
-    // PlayKey
-    {{0x26, 0x4,  0xfa, 0x40, 0x6b, 0xe9, 0x57, 0xe5, 0x42, 0xbe,
-      0xb8, 0x9e, 0x67, 0x54, 0xfc, 0xde, 0x68, 0x15, 0xe8, 0x3f},
-     "PKT",
+    // EvidenZ
+    {{0xac, 0xfa, 0x20, 0x9f, 0xb7, 0x3b, 0xf3, 0xdd, 0x5b, 0xbf,
+      0xb1, 0x10, 0x1b, 0x9b, 0xc9, 0x99, 0xc4, 0x90, 0x62, 0xa5},
+     "BCDT",
      18},
-    // Pluton
-    {{0xd8, 0x91, 0x2c, 0x10, 0x68, 0x1d, 0x8b, 0x21, 0xfd, 0x37,
-      0x42, 0x24, 0x4f, 0x44, 0x65, 0x8d, 0xba, 0x12, 0x26, 0x4e},
-     "PLU",
+    // Ambire AdEx
+    {{0xad, 0xe0, 0xc,  0x28, 0x24, 0x4d, 0x5c, 0xe1, 0x7d, 0x72,
+      0xe4, 0x3,  0x30, 0xb1, 0xc3, 0x18, 0xcd, 0x12, 0xb7, 0xc3},
+     "ADX",
      18},
-    // Po.et
-    {{0xe,  0x9,  0x89, 0xb1, 0xf9, 0xb8, 0xa3, 0x89, 0x83, 0xc2,
-      0xba, 0x80, 0x53, 0x26, 0x9c, 0xa6, 0x2e, 0xc9, 0xb1, 0x95},
-     "POE",
-     8},
-    // Polybius
-    {{0xa,  0xff, 0xa0, 0x6e, 0x7f, 0xbe, 0x5b, 0xc9, 0xa7, 0x64,
-      0xc9, 0x79, 0xaa, 0x66, 0xe8, 0x25, 0x6a, 0x63, 0x1f, 0x2},
-     "PLBT",
-     6},
-    // Polymath
-    {{0x99, 0x92, 0xec, 0x3c, 0xf6, 0xa5, 0x5b, 0x0,  0x97, 0x8c,
-      0xdd, 0xf2, 0xb2, 0x7b, 0xc6, 0x88, 0x2d, 0x88, 0xd1, 0xec},
-     "POLY",
+    // SingularDTV
+    {{0xae, 0xc2, 0xe8, 0x7e, 0xa,  0x23, 0x52, 0x66, 0xd9, 0xc5,
+      0xad, 0xc9, 0xde, 0xb4, 0xb2, 0xe2, 0x9b, 0x54, 0xd0, 0x9},
+     "SNGLS",
      18},
-    // PolySwarm
-    {{0x9e, 0x46, 0xa3, 0x8f, 0x5d, 0xaa, 0xbe, 0x86, 0x83, 0xe1,
-      0x7,  0x93, 0xb0, 0x67, 0x49, 0xee, 0xf7, 0xd7, 0x33, 0xd1},
-     "NCT",
+    // Monetha
+    {{0xaf, 0x4d, 0xce, 0x16, 0xda, 0x28, 0x77, 0xf8, 0xc9, 0xe0,
+      0x5,  0x44, 0xc9, 0x3b, 0x62, 0xac, 0x40, 0x63, 0x1f, 0x16},
+     "MTH",
+     5},
+    // Transcodium
+    {{0xb0, 0x28, 0x7,  0x43, 0xb4, 0x4b, 0xf7, 0xdb, 0x4b, 0x6b,
+      0xe4, 0x82, 0xb2, 0xba, 0x7b, 0x75, 0xe5, 0xda, 0x9,  0x6c},
+     "TNS",
      18},
-    // POP Network
-    {{0x5d, 0x85, 0x8b, 0xcd, 0x53, 0xe0, 0x85, 0x92, 0x6,  0x20,
-      0x54, 0x92, 0x14, 0xa8, 0xb2, 0x7c, 0xe2, 0xf0, 0x46, 0x70},
-     "POP",
+    // CEEK Smart VR
+    {{0xb0, 0x56, 0xc3, 0x8f, 0x6b, 0x7d, 0xc4, 0x6, 0x43, 0x67,
+      0x40, 0x3e, 0x26, 0x42, 0x4c, 0xd2, 0xc6, 0x6, 0x55, 0xe1},
+     "CEEK",
      18},
-    // Populous
-    {{0xd4, 0xfa, 0x14, 0x60, 0xf5, 0x37, 0xbb, 0x90, 0x85, 0xd2,
-      0x2c, 0x7b, 0xcc, 0xb5, 0xdd, 0x45, 0xe,  0xf2, 0x8e, 0x3a},
-     "PPT",
-     8},
-    // Populous XBRL
-    {{0xc1, 0x48, 0x30, 0xe5, 0x3a, 0xa3, 0x44, 0xe8, 0xc1, 0x46,
-      0x3,  0xa9, 0x12, 0x29, 0xa0, 0xb9, 0x25, 0xb0, 0xb2, 0x62},
-     "PXT",
-     8},
-    // Power Ledger
-    {{0x59, 0x58, 0x32, 0xf8, 0xfc, 0x6b, 0xf5, 0x9c, 0x85, 0xc5,
-      0x27, 0xfe, 0xc3, 0x74, 0xa,  0x1b, 0x7a, 0x36, 0x12, 0x69},
-     "POWR",
-     6},
-    // Privatix
-    {{0x3a, 0xdf, 0xc4, 0x99, 0x9f, 0x77, 0xd0, 0x4c, 0x83, 0x41,
-      0xba, 0xc5, 0xf3, 0xa7, 0x6f, 0x58, 0xdf, 0xf5, 0xb3, 0x7a},
-     "PRIX",
-     8},
-    // Props
-    {{0x6f, 0xe5, 0x6c, 0xb,  0xcd, 0xd4, 0x71, 0x35, 0x90, 0x19,
-      0xfc, 0xbc, 0x48, 0x86, 0x3d, 0x6c, 0x3e, 0x9d, 0x4f, 0x41},
-     "PROPS",
+    // Magic
+    {{0xb0, 0xc7, 0xa3, 0xba, 0x49, 0xc7, 0xa6, 0xea, 0xba, 0x6c,
+      0xd4, 0xa9, 0x6c, 0x55, 0xa1, 0x39, 0x10, 0x70, 0xac, 0x9a},
+     "MAGIC",
      18},
-    // Proton
-    {{0xd7, 0xef, 0xb0, 0xd,  0x12, 0xc2, 0xc1, 0x31, 0x31, 0xfd,
-      0x31, 0x93, 0x36, 0xfd, 0xf9, 0x52, 0x52, 0x5d, 0xa2, 0xaf},
-     "XPR",
-     4},
-    // pTokens BTC [OLD]
-    {{0x52, 0x28, 0xa2, 0x2e, 0x72, 0xcc, 0xc5, 0x2d, 0x41, 0x5e,
-      0xcf, 0xd1, 0x99, 0xf9, 0x9d, 0x6,  0x65, 0xe7, 0x73, 0x3b},
-     "PBTC",
+    // ETHBNT Relay
+    {{0xb1, 0xcd, 0x6e, 0x41, 0x53, 0xb2, 0xa3, 0x90, 0xcf, 0x0,
+      0xa6, 0x55, 0x6b, 0xf,  0xc1, 0x45, 0x8c, 0x4a, 0x55, 0x33},
+     "ETHBNT",
      18},
-    // PumaPay
-    {{0x84, 0x6c, 0x66, 0xcf, 0x71, 0xc4, 0x3f, 0x80, 0x40, 0x3b,
-      0x51, 0xfe, 0x39, 0x6,  0xb3, 0x59, 0x9d, 0x63, 0x33, 0x6f},
-     "PMA",
+    // Minds
+    {{0xb2, 0x66, 0x31, 0xc6, 0xdd, 0xa0, 0x6a, 0xd8, 0x9b, 0x93,
+      0xc7, 0x14, 0x0,  0xd2, 0x56, 0x92, 0xde, 0x89, 0xc0, 0x68},
+     "MINDS",
      18},
-    // Pundi X [OLD]
-    {{0xa1, 0x5c, 0x7e, 0xbe, 0x1f, 0x7,  0xca, 0xf6, 0xbf, 0xf0,
-      0x97, 0xd8, 0xa5, 0x89, 0xfb, 0x8a, 0xc4, 0x9a, 0xe5, 0xb3},
-     "NPXS",
+    // c0x
+    {{0xb3, 0x31, 0x9f, 0x5d, 0x18, 0xbc, 0xd,  0x84, 0xdd, 0x1b,
+      0x48, 0x25, 0xdc, 0xde, 0x5d, 0x5f, 0x72, 0x66, 0xd4, 0x7},
+     "CZRX",
+     8},
+    // CryptoFranc
+    {{0xb4, 0x27, 0x20, 0x71, 0xec, 0xad, 0xd6, 0x9d, 0x93, 0x3a,
+      0xdc, 0xd1, 0x9c, 0xa9, 0x9f, 0xe8, 0x6,  0x64, 0xfc, 0x8},
+     "XCHF",
      18},
-    // Pussy Financial
-    {{0x91, 0x96, 0xe1, 0x8b, 0xc3, 0x49, 0xb1, 0xf6, 0x4b, 0xc0,
-      0x87, 0x84, 0xea, 0xe2, 0x59, 0x52, 0x53, 0x29, 0xa1, 0xad},
-     "PUSSY",
+    // BankCoin BCash
+    {{0xb5, 0xbb, 0x48, 0x56, 0x7b, 0xfd, 0xb,  0xfe, 0x9e, 0x4b,
+      0x8,  0xef, 0x8b, 0x7f, 0x91, 0x55, 0x6c, 0xc2, 0xa1, 0x12},
+     "BCASH",
      18},
-    // QASH
-    {{0x61, 0x8e, 0x75, 0xac, 0x90, 0xb1, 0x2c, 0x60, 0x49, 0xba,
-      0x3b, 0x27, 0xf5, 0xd5, 0xf8, 0x65, 0x1b, 0x0,  0x37, 0xf6},
-     "QASH",
-     6},
-    // qiibee foundation
-    {{0x24, 0x67, 0xaa, 0x6b, 0x5a, 0x23, 0x51, 0x41, 0x6f, 0xd4,
-      0xc3, 0xde, 0xf8, 0x46, 0x2d, 0x84, 0x1f, 0xee, 0xec, 0xec},
-     "QBX",
+    // NEXO
+    {{0xb6, 0x21, 0x32, 0xe3, 0x5a, 0x6c, 0x13, 0xee, 0x1e, 0xe0,
+      0xf8, 0x4d, 0xc5, 0xd4, 0xb,  0xad, 0x8d, 0x81, 0x52, 0x6},
+     "NEXO",
      18},
-    // Quadrans
-    {{0x9a, 0xdc, 0x77, 0x10, 0xe9, 0xd1, 0xb2, 0x9d, 0x8a, 0x78,
-      0xc0, 0x4d, 0x52, 0xd3, 0x25, 0x32, 0x29, 0x7c, 0x2e, 0xf3},
-     "QDT",
+    // MCO
+    {{0xb6, 0x3b, 0x60, 0x6a, 0xc8, 0x10, 0xa5, 0x2c, 0xca, 0x15,
+      0xe4, 0x4b, 0xb6, 0x30, 0xfd, 0x42, 0xd8, 0xd1, 0xd8, 0x3d},
+     "MCO",
+     8},
+    // Storj
+    {{0xb6, 0x4e, 0xf5, 0x1c, 0x88, 0x89, 0x72, 0xc9, 0x8,  0xcf,
+      0xac, 0xf5, 0x9b, 0x47, 0xc1, 0xaf, 0xbc, 0xa,  0xb8, 0xac},
+     "STORJ",
+     8},
+    // BTU Protocol
+    {{0xb6, 0x83, 0xd8, 0x3a, 0x53, 0x2e, 0x2c, 0xb7, 0xdf, 0xa5,
+      0x27, 0x5e, 0xed, 0x36, 0x98, 0x43, 0x63, 0x71, 0xcc, 0x9f},
+     "BTU",
      18},
-    // Quant
-    {{0x4a, 0x22, 0xe,  0x60, 0x96, 0xb2, 0x5e, 0xad, 0xb8, 0x83,
-      0x58, 0xcb, 0x44, 0x6,  0x8a, 0x32, 0x48, 0x25, 0x46, 0x75},
-     "QNT",
+    // Advertise Coin
+    {{0xb6, 0xc3, 0xdc, 0x85, 0x78, 0x45, 0xa7, 0x13, 0xd3, 0x53,
+      0x1c, 0xea, 0x5a, 0xc5, 0x46, 0xf6, 0x76, 0x79, 0x92, 0xf4},
+     "ADCO",
+     6},
+    // 0xBitcoin
+    {{0xb6, 0xed, 0x76, 0x44, 0xc6, 0x94, 0x16, 0xd6, 0x7b, 0x52,
+      0x2e, 0x20, 0xbc, 0x29, 0x4a, 0x9a, 0x9b, 0x40, 0x5b, 0x31},
+     "0XBTC",
+     8},
+    // CargoX
+    {{0xb6, 0xee, 0x96, 0x68, 0x77, 0x1a, 0x79, 0xbe, 0x79, 0x67,
+      0xee, 0x29, 0xa6, 0x3d, 0x41, 0x84, 0xf8, 0x9,  0x71, 0x43},
+     "CXO",
      18},
-    // Quantstamp
-    {{0x99, 0xea, 0x4d, 0xb9, 0xee, 0x77, 0xac, 0xd4, 0xb,  0x11,
-      0x9b, 0xd1, 0xdc, 0x4e, 0x33, 0xe1, 0xc0, 0x70, 0xb8, 0xd},
-     "QSP",
+    // Game
+    {{0xb7, 0x8,  0x35, 0xd7, 0x82, 0x2e, 0xbb, 0x94, 0x26, 0xb5,
+      0x65, 0x43, 0xe3, 0x91, 0x84, 0x6c, 0x10, 0x7b, 0xd3, 0x2c},
+     "GTC",
      18},
-    // QuarkChain
-    {{0xea, 0x26, 0xc4, 0xac, 0x16, 0xd4, 0xa5, 0xa1, 0x6,  0x82,
-      0xb,  0xc8, 0xae, 0xe8, 0x5f, 0xd0, 0xb7, 0xb2, 0xb6, 0x64},
-     "QKC",
+    // TenX
+    {{0xb9, 0x70, 0x48, 0x62, 0x8d, 0xb6, 0xb6, 0x61, 0xd4, 0xc2,
+      0xaa, 0x83, 0x3e, 0x95, 0xdb, 0xe1, 0xa9, 0x5,  0xb2, 0x80},
+     "PAY",
      18},
-    // Receive Access Ecosystem
-    {{0xe5, 0xa3, 0x22, 0x9c, 0xcb, 0x22, 0xb6, 0x48, 0x45, 0x94,
-      0x97, 0x3a, 0x3,  0xa3, 0x85, 0x1d, 0xcd, 0x94, 0x87, 0x56},
-     "RAE",
+    // Arcblock
+    {{0xb9, 0x8d, 0x4c, 0x97, 0x42, 0x5d, 0x99, 0x8, 0xe6, 0x6e,
+      0x53, 0xa6, 0xfd, 0xf6, 0x73, 0xac, 0xca, 0xb, 0xe9, 0x86},
+     "ABT",
      18},
-    // Rai Reflex Index
-    {{0x3,  0xab, 0x45, 0x86, 0x34, 0x91, 0xa,  0xad, 0x20, 0xef,
-      0x5f, 0x1c, 0x8e, 0xe9, 0x6f, 0x1d, 0x6a, 0xc5, 0x49, 0x19},
-     "RAI",
+    // Swarm City
+    {{0xb9, 0xe7, 0xf8, 0x56, 0x8e, 0x8,  0xd5, 0x65, 0x9f, 0x5d,
+      0x29, 0xc4, 0x99, 0x71, 0x73, 0xd8, 0x4c, 0xdf, 0x26, 0x7},
+     "SWT",
      18},
-    // Raiden Network
-    {{0x25, 0x5a, 0xa6, 0xdf, 0x7,  0x54, 0xc,  0xb5, 0xd3, 0xd2,
-      0x97, 0xf0, 0xd0, 0xd4, 0xd8, 0x4c, 0xb5, 0x2b, 0xc8, 0xe6},
-     "RDN",
+    // 0chain
+    {{0xb9, 0xef, 0x77, 0xb,  0x6a, 0x5e, 0x12, 0xe4, 0x59, 0x83,
+      0xc5, 0xd8, 0x5,  0x45, 0x25, 0x8a, 0xa3, 0x8f, 0x3b, 0x78},
+     "ZCN",
+     10},
+    // Balancer
+    {{0xba, 0x10, 0x0, 0x0,  0x62, 0x5a, 0x37, 0x54, 0x42, 0x39,
+      0x78, 0xa6, 0xc, 0x93, 0x17, 0xc5, 0x8a, 0x42, 0x4e, 0x3d},
+     "BAL",
      18},
-    // RBX
-    {{0x82, 0x54, 0xe2, 0x6e, 0x45, 0x3e, 0xb5, 0xab, 0xd2, 0x9b,
-      0x3c, 0x37, 0xac, 0x9e, 0x8d, 0xa3, 0x2e, 0x5d, 0x32, 0x99},
-     "RBX",
+    // HelloGold
+    {{0xba, 0x21, 0x84, 0x52, 0xa,  0x1c, 0xc4, 0x9a, 0x61, 0x59,
+      0xc5, 0x7e, 0x61, 0xe1, 0x84, 0x4e, 0x8,  0x56, 0x15, 0xb6},
+     "HGT",
+     8},
+    // Hub
+    {{0xba, 0x35, 0x8b, 0x6f, 0x5b, 0x4c, 0x2,  0x15, 0x65, 0x4,
+      0x44, 0xb8, 0xc3, 0xd,  0x87, 0xb,  0x55, 0x5,  0xd,  0x2d},
+     "HUB",
      18},
-    // Red
-    {{0x76, 0x96, 0xd,  0xcc, 0xd5, 0xa1, 0xfe, 0x79, 0x9f, 0x7c,
-      0x29, 0xbe, 0x9f, 0x19, 0xce, 0xb4, 0x62, 0x7a, 0xeb, 0x2f},
-     "RED",
+    // SwissBorg
+    {{0xba, 0x9d, 0x41, 0x99, 0xfa, 0xb4, 0xf2, 0x6e, 0xfe, 0x35,
+      0x51, 0xd4, 0x90, 0xe3, 0x82, 0x14, 0x86, 0xf1, 0x35, 0xba},
+     "CHSB",
+     8},
+    // EDUCare
+    {{0xba, 0xb1, 0x65, 0xdf, 0x94, 0x55, 0xaa, 0xf,  0x2a, 0xed,
+      0x1f, 0x25, 0x65, 0x52, 0xb,  0x91, 0xdd, 0xad, 0xb4, 0xc8},
+     "EKT",
+     8},
+    // Axie Infinity
+    {{0xbb, 0xe,  0x17, 0xef, 0x65, 0xf8, 0x2a, 0xb0, 0x18, 0xd8,
+      0xed, 0xd7, 0x76, 0xe8, 0xdd, 0x94, 0x3,  0x27, 0xb2, 0x8b},
+     "AXS",
      18},
-    // Reef
-    {{0xfe, 0x3e, 0x6a, 0x25, 0xe6, 0xb1, 0x92, 0xa4, 0x2a, 0x44,
-      0xec, 0xdd, 0xcd, 0x13, 0x79, 0x64, 0x71, 0x73, 0x5a, 0xcf},
-     "REEF",
+    // CryptoSoul
+    {{0xbb, 0x1f, 0x24, 0xc0, 0xc1, 0x55, 0x4b, 0x99, 0x90, 0x22,
+      0x2f, 0x3,  0x6b, 0xa,  0xad, 0x6e, 0xe4, 0xca, 0xec, 0x29},
+     "SOUL",
      18},
-    // Refereum
-    {{0xd0, 0x92, 0x9d, 0x41, 0x19, 0x54, 0xc4, 0x74, 0x38, 0xdc,
-      0x1d, 0x87, 0x1d, 0xd6, 0x8,  0x1f, 0x5c, 0x5e, 0x14, 0x9c},
-     "RFR",
-     4},
-    // Remme
-    {{0x83, 0x98, 0x4d, 0x61, 0x42, 0x93, 0x4b, 0xb5, 0x35, 0x79,
-      0x3a, 0x82, 0xad, 0xb0, 0xa4, 0x6e, 0xf0, 0xf6, 0x6b, 0x6d},
-     "REM",
-     4},
-    // Rentberry
-    {{0x6a, 0xeb, 0x95, 0xf0, 0x6c, 0xda, 0x84, 0xca, 0x34, 0x5c,
-      0x2d, 0xe0, 0xf3, 0xb7, 0xf9, 0x69, 0x23, 0xa4, 0x4f, 0x4c},
-     "BERRY",
-     14},
-    // REN
-    {{0x40, 0x8e, 0x41, 0x87, 0x6c, 0xcc, 0xdc, 0xf, 0x92, 0x21,
-      0x6,  0x0,  0xef, 0x50, 0x37, 0x26, 0x56, 0x5, 0x2a, 0x38},
-     "REN",
+    // WiBX
+    {{0xbb, 0x97, 0xe3, 0x81, 0xf1, 0xd1, 0xe9, 0x4f, 0xfa, 0x2a,
+      0x58, 0x44, 0xf6, 0x87, 0x5e, 0x61, 0x46, 0x98, 0x10, 0x9},
+     "WBX",
      18},
-    // Request
-    {{0x8f, 0x82, 0x21, 0xaf, 0xbb, 0x33, 0x99, 0x8d, 0x85, 0x84,
-      0xa2, 0xb0, 0x57, 0x49, 0xba, 0x73, 0xc3, 0x7a, 0x93, 0x8a},
-     "REQ",
+    // Loopring
+    {{0xbb, 0xbb, 0xca, 0x6a, 0x90, 0x1c, 0x92, 0x6f, 0x24, 0xb,
+      0x89, 0xea, 0xcb, 0x64, 0x1d, 0x8a, 0xec, 0x7a, 0xea, 0xfd},
+     "LRC",
      18},
-    // Reserve Rights
-    {{0x32, 0x6,  0x23, 0xb8, 0xe4, 0xff, 0x3,  0x37, 0x39, 0x31,
-      0x76, 0x9a, 0x31, 0xfc, 0x52, 0xa4, 0xe7, 0x8b, 0x5d, 0x70},
-     "RSR",
+    // Global Crypto Alliance
+    {{0xbb, 0xe7, 0x61, 0xea, 0x14, 0x47, 0xa2, 0xb,  0x75, 0xaa,
+      0x48, 0x5b, 0x7b, 0xca, 0xd4, 0x83, 0x74, 0x15, 0xd7, 0xd7},
+     "CALL",
      18},
-    // Revain
-    {{0x2e, 0xf5, 0x2e, 0xd7, 0xde, 0x8c, 0x5c, 0xe0, 0x3a, 0x4e,
-      0xf0, 0xef, 0xbe, 0x9b, 0x74, 0x50, 0xf2, 0xd7, 0xed, 0xc9},
-     "REV",
-     6},
-    // Imbrex
-    {{0xf0, 0x5a, 0x93, 0x82, 0xa4, 0xc3, 0xf2, 0x9e, 0x27, 0x84,
-      0x50, 0x27, 0x54, 0x29, 0x3d, 0x88, 0xb8, 0x35, 0x10, 0x9c},
-     "REX",
+    // FinTab
+    {{0xbd, 0x4b, 0x60, 0xa1, 0x38, 0xb3, 0xfc, 0xe3, 0x58, 0x4e,
+      0xa0, 0x1f, 0x50, 0xc0, 0x90, 0x8c, 0x18, 0xf9, 0x67, 0x7a},
+     "FNTB",
+     8},
+    // Snovian.Space
+    {{0xbd, 0xc5, 0xba, 0xc3, 0x9d, 0xbe, 0x13, 0x2b, 0x1e, 0x3,
+      0xe,  0x89, 0x8a, 0xe3, 0x83, 0x0,  0x17, 0xd7, 0xd9, 0x69},
+     "SNOV",
      18},
-    // Ripio Credit Network
-    {{0xf9, 0x70, 0xb8, 0xe3, 0x6e, 0x23, 0xf7, 0xfc, 0x3f, 0xd7,
-      0x52, 0xee, 0xa8, 0x6f, 0x8b, 0xe8, 0xd8, 0x33, 0x75, 0xa6},
-     "RCN",
+    // PeerGuess
+    {{0xbd, 0xcf, 0xbf, 0x5c, 0x4d, 0x91, 0xab, 0xc0, 0xbc, 0x97,
+      0x9,  0xc7, 0x28, 0x6d, 0x0,  0x6,  0x3c, 0xe,  0x6f, 0x22},
+     "GUESS",
+     2},
+    // CyberVein
+    {{0xbe, 0x42, 0x8c, 0x38, 0x67, 0xf0, 0x5d, 0xea, 0x2a, 0x89,
+      0xfc, 0x76, 0xa1, 0x2,  0xb5, 0x44, 0xea, 0xc7, 0xf7, 0x72},
+     "CVT",
      18},
-    // Roobee
-    {{0xa3, 0x1b, 0x17, 0x67, 0xe0, 0x9f, 0x84, 0x2e, 0xcf, 0xd4,
-      0xbc, 0x47, 0x1f, 0xe4, 0x4f, 0x83, 0xe,  0x38, 0x91, 0xaa},
-     "ROOBEE",
+    // aelf
+    {{0xbf, 0x21, 0x79, 0x85, 0x9f, 0xc6, 0xd5, 0xbe, 0xe9, 0xbf,
+      0x91, 0x58, 0x63, 0x2d, 0xc5, 0x16, 0x78, 0xa4, 0x10, 0xe},
+     "ELF",
      18},
-    // Rotharium
-    {{0x3f, 0xd8, 0xf3, 0x9a, 0x96, 0x2e, 0xfd, 0xa0, 0x49, 0x56,
-      0x98, 0x1c, 0x31, 0xab, 0x89, 0xfa, 0xb5, 0xfb, 0x8b, 0xc8},
-     "RTH",
+    // ODEM
+    {{0xbf, 0x52, 0xf2, 0xab, 0x39, 0xe2, 0x6e, 0x9,  0x51, 0xd2,
+      0xa0, 0x2b, 0x49, 0xb7, 0x70, 0x2a, 0xbe, 0x30, 0x40, 0x6a},
+     "ODE",
      18},
-    // Ruff
-    {{0xf2, 0x78, 0xc1, 0xca, 0x96, 0x90, 0x95, 0xff, 0xdd, 0xde,
-      0xd0, 0x20, 0x29, 0xc,  0xf8, 0xb5, 0xc4, 0x24, 0xac, 0xe2},
-     "RUFF",
+    // Compound
+    {{0xc0, 0xe,  0x94, 0xcb, 0x66, 0x2c, 0x35, 0x20, 0x28, 0x2e,
+      0x6f, 0x57, 0x17, 0x21, 0x40, 0x4,  0xa7, 0xf2, 0x68, 0x88},
+     "COMP",
      18},
-    // Rupiah
-    {{0x99, 0x8f, 0xfe, 0x1e, 0x43, 0xfa, 0xcf, 0xfb, 0x94, 0x1d,
-      0xc3, 0x37, 0xdd, 0x4,  0x68, 0xd5, 0x2b, 0xa5, 0xb4, 0x8a},
-     "IDRT",
-     2},
-    // Sai
-    {{0x89, 0xd2, 0x4a, 0x6b, 0x4c, 0xcb, 0x1b, 0x6f, 0xaa, 0x26,
-      0x25, 0xfe, 0x56, 0x2b, 0xdd, 0x9a, 0x23, 0x26, 0x3,  0x59},
-     "SAI",
+    // Synthetix Network
+    {{0xc0, 0x11, 0xa7, 0x3e, 0xe8, 0x57, 0x6f, 0xb4, 0x6f, 0x5e,
+      0x1c, 0x57, 0x51, 0xca, 0x3b, 0x9f, 0xe0, 0xaf, 0x2a, 0x6f},
+     "SNX",
      18},
-    // Sakura Bloom
-    {{0x4a, 0xf3, 0x28, 0xc5, 0x29, 0x21, 0x70, 0x6d, 0xcb, 0x73,
-      0x9f, 0x25, 0x78, 0x62, 0x10, 0x49, 0x91, 0x69, 0xaf, 0xe6},
-     "SKB",
-     8},
-    // SALT
-    {{0x41, 0x56, 0xd3, 0x34, 0x2d, 0x5c, 0x38, 0x5a, 0x87, 0xd2,
-      0x64, 0xf9, 0x6,  0x53, 0x73, 0x35, 0x92, 0x0,  0x5,  0x81},
-     "SALT",
-     8},
-    // Santiment Network
-    {{0x7c, 0x5a, 0xc,  0xe9, 0x26, 0x7e, 0xd1, 0x9b, 0x22, 0xf8,
-      0xca, 0xe6, 0x53, 0xf1, 0x98, 0xe3, 0xe8, 0xda, 0xf0, 0x98},
-     "SAN",
+    // WETH
+    {{0xc0, 0x2a, 0xaa, 0x39, 0xb2, 0x23, 0xfe, 0x8d, 0xa,  0xe,
+      0x5c, 0x4f, 0x27, 0xea, 0xd9, 0x8,  0x3c, 0x75, 0x6c, 0xc2},
+     "WETH",
      18},
-    // Sapien
-    {{0x20, 0xf7, 0xa3, 0xdd, 0xf2, 0x44, 0xdc, 0x92, 0x99, 0x97,
-      0x5b, 0x4d, 0xa1, 0xc3, 0x9f, 0x8d, 0x5d, 0x75, 0xf0, 0x5a},
-     "SPN",
-     6},
-    // Data Transaction XD
-    {{0x24, 0xdc, 0xc8, 0x81, 0xe7, 0xdd, 0x73, 0x5,  0x46, 0x83,
-      0x44, 0x52, 0xf2, 0x18, 0x72, 0xd5, 0xcb, 0x4b, 0x52, 0x93},
-     "XD",
+    // Hiveterminal
+    {{0xc0, 0xeb, 0x85, 0x28, 0x5d, 0x83, 0x21, 0x7c, 0xd7, 0xc8,
+      0x91, 0x70, 0x2b, 0xcb, 0xc0, 0xfc, 0x40, 0x1e, 0x2d, 0x9d},
+     "HVN",
+     8},
+    // Auctus
+    {{0xc1, 0x2d, 0x9,  0x9b, 0xe3, 0x15, 0x67, 0xad, 0xd4, 0xe4,
+      0xe4, 0xd0, 0xd4, 0x56, 0x91, 0xc3, 0xf5, 0x8f, 0x56, 0x63},
+     "AUC",
      18},
-    // Sekuritance
-    {{0x88, 0x71, 0x68, 0x12, 0xc, 0xb8, 0x9f, 0xb0, 0x6f, 0x3e,
-      0x74, 0xdc, 0x4a, 0xf2, 0xd, 0x67, 0xdf, 0x9,  0x77, 0xf6},
-     "SKRT",
+    // Populous XBRL
+    {{0xc1, 0x48, 0x30, 0xe5, 0x3a, 0xa3, 0x44, 0xe8, 0xc1, 0x46,
+      0x3,  0xa9, 0x12, 0x29, 0xa0, 0xb9, 0x25, 0xb0, 0xb2, 0x62},
+     "PXT",
+     8},
+    // PayPie
+    {{0xc4, 0x22, 0x9,  0xac, 0xcc, 0x14, 0x2,  0x9c, 0x10, 0x12,
+      0xfb, 0x56, 0x80, 0xd9, 0x5f, 0xbd, 0x60, 0x36, 0xe2, 0xa0},
+     "PPP",
      18},
-    // Sensitrust
-    {{0x4,  0xe0, 0xaf, 0xa,  0xf1, 0xb7, 0xf0, 0x2,  0x3c, 0x6b,
-      0x12, 0xaf, 0x5a, 0x94, 0xdf, 0x59, 0xb0, 0xe8, 0xcf, 0x59},
-     "SETS",
+    // CoinMerge (ERC20)
+    {{0xc4, 0x8b, 0x48, 0x14, 0xfa, 0xed, 0x1c, 0xcc, 0x88, 0x5d,
+      0xd6, 0xfd, 0xe6, 0x2a, 0x64, 0x74, 0xae, 0xcb, 0xb1, 0x9a},
+     "CMERGE",
      18},
-    // Sentinel Chain
-    {{0xa1, 0x3f, 0x7,  0x43, 0x95, 0x1b, 0x4f, 0x6e, 0x3e, 0x3a,
-      0xa0, 0x39, 0xf6, 0x82, 0xe1, 0x72, 0x79, 0xf5, 0x2b, 0xc3},
-     "SENC",
+    // Endor Protocol
+    {{0xc5, 0x28, 0xc2, 0x8f, 0xec, 0xa,  0x90, 0xc0, 0x83, 0x32,
+      0x8b, 0xc4, 0x5f, 0x58, 0x7e, 0xe2, 0x15, 0x76, 0xa,  0xf},
+     "EDR",
      18},
-    // Sentinel [OLD]
-    {{0xa4, 0x4e, 0x51, 0x37, 0x29, 0x3e, 0x85, 0x5b, 0x1b, 0x7b,
-      0xc7, 0xe2, 0xc6, 0xf8, 0xcd, 0x79, 0x6f, 0xfc, 0xb0, 0x37},
-     "DVPN",
-     8},
-    // Sentinel Protocol
-    {{0xc8, 0x6d, 0x5,  0x48, 0x9,  0x62, 0x34, 0x32, 0x21, 0xc,
-      0x10, 0x7a, 0xf2, 0xe3, 0xf6, 0x19, 0xdc, 0xfb, 0xf6, 0x52},
-     "UPP",
+    // Gifto
+    {{0xc5, 0xbb, 0xae, 0x50, 0x78, 0x1b, 0xe1, 0x66, 0x93, 0x6,
+      0xb9, 0xe0, 0x1,  0xef, 0xf5, 0x7a, 0x29, 0x57, 0xb0, 0x9d},
+     "GTO",
+     5},
+    // Locus Chain
+    {{0xc6, 0x45, 0x0,  0xdd, 0x7b, 0xf,  0x17, 0x94, 0x80, 0x7e,
+      0x67, 0x80, 0x2f, 0x8a, 0xbb, 0xf5, 0xf8, 0xff, 0xb0, 0x54},
+     "LOCUS",
      18},
     // ShapeShift FOX Token
     {{0xc7, 0x70, 0xee, 0xfa, 0xd2, 0x4,  0xb5, 0x18, 0xd,  0xf6,
       0xa1, 0x4e, 0xe1, 0x97, 0xd9, 0x9d, 0x80, 0x8e, 0xe5, 0x2d},
      "FOX",
      18},
-    // Shiba Inu
-    {{0x95, 0xad, 0x61, 0xb0, 0xa1, 0x50, 0xd7, 0x92, 0x19, 0xdc,
-      0xf6, 0x4e, 0x1e, 0x6c, 0xc0, 0x1f, 0xb,  0x64, 0xc4, 0xce},
-     "SHIB",
-     18},
-    // ShipChain
-    {{0xe2, 0x5b, 0xb,  0xba, 0x1,  0xdc, 0x56, 0x30, 0x31, 0x2b,
-      0x6a, 0x21, 0x92, 0x7e, 0x57, 0x80, 0x61, 0xa1, 0x3f, 0x55},
-     "SHIP",
+    // Gems
+    {{0xc7, 0xbb, 0xa5, 0xb7, 0x65, 0x58, 0x1e, 0xfb, 0x2c, 0xdd,
+      0x26, 0x79, 0xdb, 0x5b, 0xea, 0x9e, 0xe7, 0x9b, 0x20, 0x1f},
+     "GEM",
      18},
-    // ShowHand
-    {{0x48, 0xc1, 0xb2, 0xf3, 0xef, 0xa8, 0x5f, 0xba, 0xfb, 0x2a,
-      0xb9, 0x51, 0xbf, 0x4b, 0xa8, 0x60, 0xa0, 0x8c, 0xdb, 0xb7},
-     "HAND",
+    // Sentinel Protocol
+    {{0xc8, 0x6d, 0x5,  0x48, 0x9,  0x62, 0x34, 0x32, 0x21, 0xc,
+      0x10, 0x7a, 0xf2, 0xe3, 0xf6, 0x19, 0xdc, 0xfb, 0xf6, 0x52},
+     "UPP",
      18},
-    // Signal SIG
-    {{0x68, 0x88, 0xa1, 0x6e, 0xa9, 0x79, 0x2c, 0x15, 0xa4, 0xdc,
-      0xf2, 0xf6, 0xc6, 0x23, 0xd0, 0x55, 0xc8, 0xed, 0xe7, 0x92},
-     "SIG",
+    // LivenPay
+    {{0xc8, 0xca, 0xc7, 0x67, 0x2f, 0x46, 0x69, 0x68, 0x58, 0x17,
+      0xcf, 0x33, 0x2a, 0x33, 0xeb, 0x24, 0x9f, 0x8,  0x54, 0x75},
+     "LVN",
      18},
-    // OST
-    {{0x2c, 0x4e, 0x8f, 0x2d, 0x74, 0x61, 0x13, 0xd0, 0x69, 0x6c,
-      0xe8, 0x9b, 0x35, 0xf0, 0xd8, 0xbf, 0x88, 0xe0, 0xae, 0xca},
-     "OST",
+    // The Graph
+    {{0xc9, 0x44, 0xe9, 0xc,  0x64, 0xb2, 0xc0, 0x76, 0x62, 0xa2,
+      0x92, 0xbe, 0x62, 0x44, 0xbd, 0xf0, 0x5c, 0xda, 0x44, 0xa7},
+     "GRT",
      18},
-    // SingularDTV
-    {{0xae, 0xc2, 0xe8, 0x7e, 0xa,  0x23, 0x52, 0x66, 0xd9, 0xc5,
-      0xad, 0xc9, 0xde, 0xb4, 0xb2, 0xe2, 0x9b, 0x54, 0xd0, 0x9},
-     "SNGLS",
+    // AMLT Network
+    {{0xca, 0xe,  0x72, 0x69, 0x60, 0xd,  0x35, 0x3f, 0x70, 0xb1,
+      0x4a, 0xd1, 0x18, 0xa4, 0x95, 0x75, 0x45, 0x5c, 0xf,  0x2f},
+     "AMLT",
      18},
-    // Sirin Labs
-    {{0x68, 0xd5, 0x7c, 0x9a, 0x1c, 0x35, 0xf6, 0x3e, 0x2c, 0x83,
-      0xee, 0x8e, 0x49, 0xa6, 0x4e, 0x9d, 0x70, 0x52, 0x8d, 0x25},
-     "SRN",
+    // Vega Protocol
+    {{0xcb, 0x84, 0xd7, 0x2e, 0x61, 0xe3, 0x83, 0x76, 0x7c, 0x4d,
+      0xfe, 0xb2, 0xd8, 0xff, 0x7f, 0x4f, 0xb8, 0x9a, 0xbc, 0x6e},
+     "VEGA",
      18},
-    // SkinCoin
-    {{0x2b, 0xdc, 0xd, 0x42, 0x99, 0x60, 0x17, 0xfc, 0xe2, 0x14,
-      0xb2, 0x16, 0x7, 0xa5, 0x15, 0xda, 0x41, 0xa9, 0xe0, 0xc5},
-     "SKIN",
+    // WeTrust
+    {{0xcb, 0x94, 0xbe, 0x6f, 0x13, 0xa1, 0x18, 0x2e, 0x4a, 0x4b,
+      0x61, 0x40, 0xcb, 0x7b, 0xf2, 0x2,  0x5d, 0x28, 0xe4, 0x1b},
+     "TRST",
      6},
-    // Smart MFG
-    {{0x67, 0x10, 0xc6, 0x34, 0x32, 0xa2, 0xde, 0x2,  0x95, 0x4f,
-      0xc0, 0xf8, 0x51, 0xdb, 0x7,  0x14, 0x6a, 0x6c, 0x3,  0x12},
-     "MFG",
-     18},
-    // Smartshare
-    {{0x62, 0x4d, 0x52, 0xb,  0xab, 0x2e, 0x4a, 0xd8, 0x39, 0x35,
-      0xfa, 0x50, 0x3f, 0xb1, 0x30, 0x61, 0x43, 0x74, 0xe8, 0x50},
-     "SSP",
-     4},
-    // Smart Valor
-    {{0x29, 0x7e, 0x4e, 0x5e, 0x59, 0xad, 0x72, 0xb1, 0xb0, 0xa2,
-      0xfd, 0x44, 0x69, 0x29, 0xe7, 0x61, 0x17, 0xbe, 0xe,  0xa},
-     "VALOR",
+    // Humaniq
+    {{0xcb, 0xcc, 0xf,  0x3,  0x6e, 0xd4, 0x78, 0x8f, 0x63, 0xfc,
+      0xf,  0xee, 0x32, 0x87, 0x3d, 0x6a, 0x74, 0x87, 0xb9, 0x8},
+     "HMQ",
+     8},
+    // Spacelens
+    {{0xcc, 0x7a, 0xb8, 0xd7, 0x8d, 0xba, 0x18, 0x7d, 0xc9, 0x5b,
+      0xf3, 0xbb, 0x86, 0xe6, 0x5e, 0xc,  0x26, 0xd0, 0x4,  0x1f},
+     "SPACE",
      18},
     // Smooth Love Potion
     {{0xcc, 0x8f, 0xa2, 0x25, 0xd8, 0xb,  0x9c, 0x7d, 0x42, 0xf9,
       0x6e, 0x95, 0x70, 0x15, 0x6c, 0x65, 0xd6, 0xca, 0xaa, 0x25},
      "SLP",
      18},
-    // Snovian.Space
-    {{0xbd, 0xc5, 0xba, 0xc3, 0x9d, 0xbe, 0x13, 0x2b, 0x1e, 0x3,
-      0xe,  0x89, 0x8a, 0xe3, 0x83, 0x0,  0x17, 0xd7, 0xd9, 0x69},
-     "SNOV",
+    // Hurify
+    {{0xcd, 0xb7, 0xec, 0xfd, 0x34, 0x3,  0xee, 0xf3, 0x88, 0x2c,
+      0x65, 0xb7, 0x61, 0xef, 0x9b, 0x50, 0x54, 0x89, 0xa,  0x47},
+     "HUR",
+     18},
+    // GROM
+    {{0xce, 0x59, 0x3a, 0x29, 0x90, 0x59, 0x51, 0xe8, 0xfc, 0x57,
+      0x9b, 0xc0, 0x92, 0xec, 0xa7, 0x25, 0x77, 0xda, 0x57, 0x5c},
+     "GR",
+     6},
+    // Refereum
+    {{0xd0, 0x92, 0x9d, 0x41, 0x19, 0x54, 0xc4, 0x74, 0x38, 0xdc,
+      0x1d, 0x87, 0x1d, 0xd6, 0x8,  0x1f, 0x5c, 0x5e, 0x14, 0x9c},
+     "RFR",
+     4},
+    // adChain
+    {{0xd0, 0xd6, 0xd6, 0xc5, 0xfe, 0x4a, 0x67, 0x7d, 0x34, 0x3c,
+      0xc4, 0x33, 0x53, 0x6b, 0xb7, 0x17, 0xba, 0xe1, 0x67, 0xdd},
+     "ADT",
+     9},
+    // OMG Network
+    {{0xd2, 0x61, 0x14, 0xcd, 0x6e, 0xe2, 0x89, 0xac, 0xcf, 0x82,
+      0x35, 0xc,  0x8d, 0x84, 0x87, 0xfe, 0xdb, 0x8a, 0xc,  0x7},
+     "OMG",
+     18},
+    // Vikky
+    {{0xd2, 0x94, 0x6b, 0xe7, 0x86, 0xf3, 0x5c, 0x3c, 0xc4, 0x2,
+      0xc2, 0x9b, 0x32, 0x36, 0x47, 0xab, 0xda, 0x79, 0x90, 0x71},
+     "VIKKY",
+     8},
+    // Liquidity Network
+    {{0xd2, 0x9f, 0xb,  0x5b, 0x3f, 0x50, 0xb0, 0x7f, 0xe9, 0xa9,
+      0x51, 0x1f, 0x7d, 0x86, 0xf4, 0xf4, 0xba, 0xc3, 0xf8, 0xc4},
+     "LQD",
+     18},
+    // Bounty0x
+    {{0xd2, 0xd6, 0x15, 0x86, 0x83, 0xae, 0xe4, 0xcc, 0x83, 0x80,
+      0x67, 0x72, 0x72, 0x9,  0xa0, 0xaa, 0xf4, 0x35, 0x9d, 0xe3},
+     "BNTY",
+     18},
+    // TOKPIE
+    {{0xd3, 0x16, 0x95, 0xa1, 0xd3, 0x5e, 0x48, 0x92, 0x52, 0xce,
+      0x57, 0xb1, 0x29, 0xfd, 0x4b, 0x1b, 0x5,  0xe6, 0xac, 0xac},
+     "TKP",
      18},
-    // Sociall
-    {{0xd7, 0x63, 0x17, 0x87, 0xb4, 0xdc, 0xc8, 0x7b, 0x12, 0x54,
-      0xcf, 0xd1, 0xe5, 0xce, 0x48, 0xe9, 0x68, 0x23, 0xde, 0xe8},
-     "SCL",
-     8},
     // SoMee.Social [OLD]
     {{0xd3, 0x41, 0xd1, 0x68, 0xe,  0xee, 0xe3, 0x25, 0x5b, 0x8c,
       0x4c, 0x75, 0xbc, 0xce, 0x7e, 0xb5, 0x7f, 0x14, 0x4d, 0xae},
      "ONG",
      18},
-    // Spacelens
-    {{0xcc, 0x7a, 0xb8, 0xd7, 0x8d, 0xba, 0x18, 0x7d, 0xc9, 0x5b,
-      0xf3, 0xbb, 0x86, 0xe6, 0x5e, 0xc,  0x26, 0xd0, 0x4,  0x1f},
-     "SPACE",
-     18},
-    // SpankChain
-    {{0x42, 0xd6, 0x62, 0x2d, 0xec, 0xe3, 0x94, 0xb5, 0x49, 0x99,
-      0xfb, 0xd7, 0x3d, 0x10, 0x81, 0x23, 0x80, 0x6f, 0x6a, 0x18},
-     "SPANK",
-     18},
-    // Spectre.ai Dividend
-    {{0x12, 0xb3, 0x6,  0xfa, 0x98, 0xf4, 0xcb, 0xb8, 0xd4, 0x45,
-      0x7f, 0xdf, 0xf3, 0xa0, 0xa0, 0xa5, 0x6f, 0x7,  0xcc, 0xdf},
-     "SXDT",
-     18},
-    // Spectre.ai Utility
-    {{0x2c, 0x82, 0xc7, 0x3d, 0x5b, 0x34, 0xaa, 0x1,  0x59, 0x89,
-      0x46, 0x2b, 0x29, 0x48, 0xcd, 0x61, 0x6a, 0x37, 0x64, 0x1f},
-     "SXUT",
-     18},
-    // SPINDLE
-    {{0x1d, 0xea, 0x97, 0x9a, 0xe7, 0x6f, 0x26, 0x7,  0x18, 0x70,
-      0xf8, 0x24, 0x8,  0x8d, 0xa7, 0x89, 0x79, 0xeb, 0x91, 0xc8},
-     "SPD",
-     18},
-    // Stably USD
-    {{0xa4, 0xbd, 0xb1, 0x1d, 0xc0, 0xa2, 0xbe, 0xc8, 0x8d, 0x24,
-      0xa3, 0xaa, 0x1e, 0x6b, 0xb1, 0x72, 0x1,  0x11, 0x2e, 0xbe},
-     "USDS",
-     6},
-    // Starbase
-    {{0xf7, 0xa, 0x64, 0x2b, 0xd3, 0x87, 0xf9, 0x43, 0x80, 0xff,
-      0xb9, 0x4, 0x51, 0xc2, 0xc8, 0x1d, 0x4e, 0xb8, 0x2c, 0xbc},
-     "STAR",
+    // HollaEx
+    {{0xd3, 0xc6, 0x25, 0xf5, 0x4d, 0xec, 0x64, 0x7d, 0xb8, 0x78,
+      0xd,  0xbb, 0xe0, 0xe8, 0x80, 0xef, 0x21, 0xba, 0x43, 0x29},
+     "XHT",
      18},
-    // STASIS EURO
-    {{0xdb, 0x25, 0xf2, 0x11, 0xab, 0x5,  0xb1, 0xc9, 0x7d, 0x59,
-      0x55, 0x16, 0xf4, 0x57, 0x94, 0x52, 0x8a, 0x80, 0x7a, 0xd8},
-     "EURS",
-     2},
-    // Status
-    {{0x74, 0x4d, 0x70, 0xfd, 0xbe, 0x2b, 0xa4, 0xcf, 0x95, 0x13,
-      0x16, 0x26, 0x61, 0x4a, 0x17, 0x63, 0xdf, 0x80, 0x5b, 0x9e},
-     "SNT",
+    // Ampleforth
+    {{0xd4, 0x6b, 0xa6, 0xd9, 0x42, 0x5,  0xd,  0x48, 0x9d, 0xbd,
+      0x93, 0x8a, 0x2c, 0x90, 0x9a, 0x5d, 0x50, 0x39, 0xa1, 0x61},
+     "AMPL",
+     9},
+    // Electrify.Asia
+    {{0xd4, 0x9f, 0xf1, 0x36, 0x61, 0x45, 0x13, 0x13, 0xca, 0x15,
+      0x53, 0xfd, 0x69, 0x54, 0xbd, 0x1d, 0x9b, 0x6e, 0x2,  0xb9},
+     "ELEC",
      18},
-    // Storiqa
-    {{0x5c, 0x3a, 0x22, 0x85, 0x10, 0xd2, 0x46, 0xb7, 0x8a, 0x37,
-      0x65, 0xc2, 0x2,  0x21, 0xcb, 0xf3, 0x8,  0x2b, 0x44, 0xa4},
-     "STQ",
+    // Cindicator
+    {{0xd4, 0xc4, 0x35, 0xf5, 0xb0, 0x9f, 0x85, 0x5c, 0x33, 0x17,
+      0xc8, 0x52, 0x4c, 0xb1, 0xf5, 0x86, 0xe4, 0x27, 0x95, 0xfa},
+     "CND",
      18},
-    // Storj
-    {{0xb6, 0x4e, 0xf5, 0x1c, 0x88, 0x89, 0x72, 0xc9, 0x8,  0xcf,
-      0xac, 0xf5, 0x9b, 0x47, 0xc1, 0xaf, 0xbc, 0xa,  0xb8, 0xac},
-     "STORJ",
+    // Populous
+    {{0xd4, 0xfa, 0x14, 0x60, 0xf5, 0x37, 0xbb, 0x90, 0x85, 0xd2,
+      0x2c, 0x7b, 0xcc, 0xb5, 0xdd, 0x45, 0xe,  0xf2, 0x8e, 0x3a},
+     "PPT",
      8},
-    // Stox
-    {{0x0,  0x6b, 0xea, 0x43, 0xba, 0xa3, 0xf7, 0xa6, 0xf7, 0x65,
-      0xf1, 0x4f, 0x10, 0xa1, 0xa1, 0xb0, 0x83, 0x34, 0xef, 0x45},
-     "STX",
-     18},
-    // Substratum
-    {{0x8d, 0x75, 0x95, 0x9f, 0x1e, 0x61, 0xec, 0x25, 0x71, 0xaa,
-      0x72, 0x79, 0x82, 0x37, 0x10, 0x1f, 0x8,  0x4d, 0xe6, 0x3a},
-     "SUB",
-     18},
-    // SunContract
-    {{0xf4, 0x13, 0x41, 0x46, 0xaf, 0x2d, 0x51, 0x1d, 0xd5, 0xea,
-      0x8c, 0xdb, 0x1c, 0x4a, 0xc8, 0x8c, 0x57, 0xd6, 0x4,  0x4},
-     "SNC",
-     18},
-    // Suretly
-    {{0xe1, 0x20, 0xc1, 0xec, 0xbf, 0xdf, 0xea, 0x7f, 0xa,  0x8f,
-      0xe,  0xe3, 0x0,  0x63, 0x49, 0x1e, 0x8c, 0x26, 0xfe, 0xdf},
-     "SUR",
+    // Meme
+    {{0xd5, 0x52, 0x5d, 0x39, 0x78, 0x98, 0xe5, 0x50, 0x20, 0x75,
+      0xea, 0x5e, 0x83, 0xd,  0x89, 0x14, 0xf6, 0xf0, 0xaf, 0xfe},
+     "MEME",
      8},
-    // Sushi
-    {{0x6b, 0x35, 0x95, 0x6,  0x87, 0x78, 0xdd, 0x59, 0x2e, 0x39,
-      0xa1, 0x22, 0xf4, 0xf5, 0xa5, 0xcf, 0x9,  0xc9, 0xf,  0xe2},
-     "SUSHI",
-     18},
-    // Swarm City
-    {{0xb9, 0xe7, 0xf8, 0x56, 0x8e, 0x8,  0xd5, 0x65, 0x9f, 0x5d,
-      0x29, 0xc4, 0x99, 0x71, 0x73, 0xd8, 0x4c, 0xdf, 0x26, 0x7},
-     "SWT",
-     18},
-    // Swash
-    {{0xa1, 0x30, 0xe3, 0xa3, 0x3a, 0x4d, 0x84, 0xb0, 0x4c, 0x39,
-      0x18, 0xc4, 0xe5, 0x76, 0x22, 0x23, 0xae, 0x25, 0x2f, 0x80},
-     "SWASH",
+    // FintruX
+    {{0xd5, 0x59, 0xf2, 0x2,  0x96, 0xff, 0x48, 0x95, 0xda, 0x39,
+      0xb5, 0xbd, 0x9a, 0xdd, 0x54, 0xb4, 0x42, 0x59, 0x6a, 0x61},
+     "FTX",
      18},
-    // SWFTCOIN
-    {{0xb, 0xb2, 0x17, 0xe4, 0xf, 0x8a, 0x5c, 0xb7, 0x9a, 0xdf,
-      0x4, 0xe1, 0xaa, 0xb6, 0xe, 0x5a, 0xbd, 0xd,  0xfc, 0x1e},
-     "SWFTC",
-     8},
-    // SwissBorg
-    {{0xba, 0x9d, 0x41, 0x99, 0xfa, 0xb4, 0xf2, 0x6e, 0xfe, 0x35,
-      0x51, 0xd4, 0x90, 0xe3, 0x82, 0x14, 0x86, 0xf1, 0x35, 0xba},
-     "CHSB",
+    // Sociall
+    {{0xd7, 0x63, 0x17, 0x87, 0xb4, 0xdc, 0xc8, 0x7b, 0x12, 0x54,
+      0xcf, 0xd1, 0xe5, 0xce, 0x48, 0xe9, 0x68, 0x23, 0xde, 0xe8},
+     "SCL",
      8},
-    // Taklimakan Network
-    {{0x2c, 0x36, 0x20, 0x4a, 0x7, 0x12, 0xa2, 0xa5, 0xe,  0x54,
-      0xa6, 0x2f, 0x7c, 0x4f, 0x1, 0x86, 0x7e, 0x78, 0xcb, 0x53},
-     "TAN",
+    // Proton
+    {{0xd7, 0xef, 0xb0, 0xd,  0x12, 0xc2, 0xc1, 0x31, 0x31, 0xfd,
+      0x31, 0x93, 0x36, 0xfd, 0xf9, 0x52, 0x52, 0x5d, 0xa2, 0xaf},
+     "XPR",
+     4},
+    // DAV Network
+    {{0xd8, 0x2d, 0xf0, 0xab, 0xd3, 0xf5, 0x14, 0x25, 0xeb, 0x15,
+      0xef, 0x75, 0x80, 0xfd, 0xa5, 0x57, 0x27, 0x87, 0x5f, 0x14},
+     "DAV",
      18},
-    // tBTC
-    {{0x8d, 0xae, 0xba, 0xde, 0x92, 0x2d, 0xf7, 0x35, 0xc3, 0x8c,
-      0x80, 0xc7, 0xeb, 0xd7, 0x8,  0xaf, 0x50, 0x81, 0x5f, 0xaa},
-     "TBTC",
+    // NEEO
+    {{0xd8, 0x44, 0x62, 0x36, 0xfa, 0x95, 0xb9, 0xb5, 0xf9, 0xfd,
+      0xf,  0x8e, 0x7d, 0xf1, 0xa9, 0x44, 0x82, 0x3c, 0x68, 0x3d},
+     "NEEO",
      18},
-    // TenX
-    {{0xb9, 0x70, 0x48, 0x62, 0x8d, 0xb6, 0xb6, 0x61, 0xd4, 0xc2,
-      0xaa, 0x83, 0x3e, 0x95, 0xdb, 0xe1, 0xa9, 0x5,  0xb2, 0x80},
-     "PAY",
+    // Pluton
+    {{0xd8, 0x91, 0x2c, 0x10, 0x68, 0x1d, 0x8b, 0x21, 0xfd, 0x37,
+      0x42, 0x24, 0x4f, 0x44, 0x65, 0x8d, 0xba, 0x12, 0x26, 0x4e},
+     "PLU",
      18},
     // Tether
     {{0xda, 0xc1, 0x7f, 0x95, 0x8d, 0x2e, 0xe5, 0x23, 0xa2, 0x20,
       0x62, 0x6,  0x99, 0x45, 0x97, 0xc1, 0x3d, 0x83, 0x1e, 0xc7},
      "USDT",
      6},
-    // Abyss
-    {{0xe,  0x8d, 0x6b, 0x47, 0x1e, 0x33, 0x2f, 0x14, 0xe,  0x7d,
-      0x9d, 0xbb, 0x99, 0xe5, 0xe3, 0x82, 0x2f, 0x72, 0x8d, 0xa6},
-     "ABYSS",
+    // STASIS EURO
+    {{0xdb, 0x25, 0xf2, 0x11, 0xab, 0x5,  0xb1, 0xc9, 0x7d, 0x59,
+      0x55, 0x16, 0xf4, 0x57, 0x94, 0x52, 0x8a, 0x80, 0x7a, 0xd8},
+     "EURS",
+     2},
+    // Neos Credits
+    {{0xdb, 0x5c, 0x3c, 0x46, 0xe2, 0x8b, 0x53, 0xa3, 0x9c, 0x25,
+      0x5a, 0xa3, 0x9a, 0x41, 0x1d, 0xd6, 0x4e, 0x5f, 0xed, 0x9c},
+     "NCR",
      18},
-    // The Graph
-    {{0xc9, 0x44, 0xe9, 0xc,  0x64, 0xb2, 0xc0, 0x76, 0x62, 0xa2,
-      0x92, 0xbe, 0x62, 0x44, 0xbd, 0xf0, 0x5c, 0xda, 0x44, 0xa7},
-     "GRT",
+    // Utrust
+    {{0xdc, 0x9a, 0xc3, 0xc2, 0xd, 0x1e, 0xd0, 0xb5, 0x40, 0xdf,
+      0x9b, 0x1f, 0xed, 0xc1, 0x0, 0x39, 0xdf, 0x13, 0xf9, 0x9c},
+     "UTK",
      18},
-    // Thorecash (ERC-20)
-    {{0x99, 0x72, 0xa0, 0xf2, 0x41, 0x94, 0x44, 0x7e, 0x73, 0xa7,
-      0xe8, 0xb6, 0xcd, 0x26, 0xa5, 0x2e, 0x2,  0xdd, 0xfa, 0xd5},
-     "TCH",
+    // Tokenomy
+    {{0xdd, 0x16, 0xec, 0xf,  0x66, 0xe5, 0x4d, 0x45, 0x3e, 0x67,
+      0x56, 0x71, 0x3e, 0x53, 0x33, 0x55, 0x98, 0x90, 0x40, 0xe4},
+     "TEN",
      18},
-    // Tierion
-    {{0x8,  0xf5, 0xa9, 0x23, 0x5b, 0x8,  0x17, 0x3b, 0x75, 0x69,
-      0xf8, 0x36, 0x45, 0xd2, 0xc7, 0xfb, 0x55, 0xe8, 0xcc, 0xd8},
-     "TNT",
+    // Kyber Network Crystal Legacy
+    {{0xdd, 0x97, 0x4d, 0x5c, 0x2e, 0x29, 0x28, 0xde, 0xa5, 0xf7,
+      0x1b, 0x98, 0x25, 0xb8, 0xb6, 0x46, 0x68, 0x6b, 0xd2, 0x0},
+     "KNCL",
+     18},
+    // COTI
+    {{0xdd, 0xb3, 0x42, 0x24, 0x97, 0xe6, 0x1e, 0x13, 0x54, 0x3b,
+      0xea, 0x6,  0x98, 0x9c, 0x7,  0x89, 0x11, 0x75, 0x55, 0xc5},
+     "COTI",
+     18},
+    // DeltaChain
+    {{0xde, 0x1e, 0xa, 0xe6, 0x10, 0x1b, 0x46, 0x52, 0xc,  0xf6,
+      0x6f, 0xdc, 0xb, 0x10, 0x59, 0xc5, 0xcc, 0x3d, 0x10, 0x6c},
+     "DELTA",
      8},
-    // Ties.DB
-    {{0x99, 0x99, 0x67, 0xe2, 0xec, 0x8a, 0x74, 0xb7, 0xc8, 0xe9,
-      0xdb, 0x19, 0xe0, 0x39, 0xd9, 0x20, 0xb3, 0x1d, 0x39, 0xd0},
-     "TIE",
+    // Kuende
+    {{0xdf, 0x13, 0x38, 0xfb, 0xaf, 0xe7, 0xaf, 0x17, 0x89, 0x15,
+      0x16, 0x27, 0xb8, 0x86, 0x78, 0x1b, 0xa5, 0x56, 0xef, 0x9a},
+     "KUE",
      18},
-    // Tokenbox
-    {{0x3a, 0x92, 0xbd, 0x39, 0x6a, 0xef, 0x82, 0xaf, 0x98, 0xeb,
-      0xc0, 0xaa, 0x90, 0x30, 0xd2, 0x5a, 0x23, 0xb1, 0x1c, 0x6b},
-     "TBX",
+    // Hifi Finance
+    {{0xdf, 0x2c, 0x72, 0x38, 0x19, 0x8a, 0xd8, 0xb3, 0x89, 0x66,
+      0x65, 0x74, 0xf2, 0xd8, 0xbc, 0x41, 0x1a, 0x4b, 0x74, 0x28},
+     "MFT",
      18},
-    // Monolith
-    {{0xaa, 0xaf, 0x91, 0xd9, 0xb9, 0xd,  0xf8, 0x0,  0xdf, 0x4f,
-      0x55, 0xc2, 0x5,  0xfd, 0x69, 0x89, 0xc9, 0x77, 0xe7, 0x3a},
-     "TKN",
+    // Bob's Repair
+    {{0xdf, 0x34, 0x79, 0x11, 0x91, 0xb,  0x6c, 0x9a, 0x42, 0x86,
+      0xba, 0x8e, 0x2e, 0xe5, 0xea, 0x4a, 0x39, 0xeb, 0x21, 0x34},
+     "BOB",
+     18},
+    // Jobchain
+    {{0xdf, 0xbc, 0x90, 0x50, 0xf5, 0xb0, 0x1d, 0xf5, 0x35, 0x12,
+      0xdc, 0xc3, 0x9b, 0x4f, 0x2b, 0x2b, 0xba, 0xcd, 0x51, 0x7a},
+     "JOB",
      8},
-    // Tokenomy
-    {{0xdd, 0x16, 0xec, 0xf,  0x66, 0xe5, 0x4d, 0x45, 0x3e, 0x67,
-      0x56, 0x71, 0x3e, 0x53, 0x33, 0x55, 0x98, 0x90, 0x40, 0xe4},
-     "TEN",
+    // DigixDAO
+    {{0xe0, 0xb7, 0x92, 0x7c, 0x4a, 0xf2, 0x37, 0x65, 0xcb, 0x51,
+      0x31, 0x4a, 0xe,  0x5,  0x21, 0xa9, 0x64, 0x5f, 0xe,  0x2a},
+     "DGD",
+     9},
+    // Alta Finance
+    {{0xe0, 0xcc, 0xa8, 0x6b, 0x25, 0x40, 0x5,  0x88, 0x9a, 0xc3,
+      0xa8, 0x1e, 0x73, 0x7f, 0x56, 0xa1, 0x4f, 0x4a, 0x38, 0xf5},
+     "ALTA",
      18},
-    // Tokok
-    {{0x9a, 0x49, 0xf0, 0x2e, 0x12, 0x8a, 0x8e, 0x98, 0x9b, 0x44,
-      0x3a, 0x8f, 0x94, 0x84, 0x3c, 0x9,  0x18, 0xbf, 0x45, 0xe7},
-     "TOK",
+    // Suretly
+    {{0xe1, 0x20, 0xc1, 0xec, 0xbf, 0xdf, 0xea, 0x7f, 0xa,  0x8f,
+      0xe,  0xe3, 0x0,  0x63, 0x49, 0x1e, 0x8c, 0x26, 0xfe, 0xdf},
+     "SUR",
      8},
-    // TOKPIE
-    {{0xd3, 0x16, 0x95, 0xa1, 0xd3, 0x5e, 0x48, 0x92, 0x52, 0xce,
-      0x57, 0xb1, 0x29, 0xfd, 0x4b, 0x1b, 0x5,  0xe6, 0xac, 0xac},
-     "TKP",
+    // Bezant
+    {{0xe1, 0xae, 0xe9, 0x84, 0x95, 0x36, 0x5f, 0xc1, 0x79, 0x69,
+      0x9c, 0x1b, 0xb3, 0xe7, 0x61, 0xfa, 0x71, 0x6b, 0xee, 0x62},
+     "BZNT",
      18},
-    // Transcodium
-    {{0xb0, 0x28, 0x7,  0x43, 0xb4, 0x4b, 0xf7, 0xdb, 0x4b, 0x6b,
-      0xe4, 0x82, 0xb2, 0xba, 0x7b, 0x75, 0xe5, 0xda, 0x9,  0x6c},
-     "TNS",
+    // ShipChain
+    {{0xe2, 0x5b, 0xb,  0xba, 0x1,  0xdc, 0x56, 0x30, 0x31, 0x2b,
+      0x6a, 0x21, 0x92, 0x7e, 0x57, 0x80, 0x61, 0xa1, 0x3f, 0x55},
+     "SHIP",
      18},
-    // Traxia
-    {{0x32, 0x9,  0xf9, 0x8b, 0xeb, 0xf0, 0x14, 0x9b, 0x76, 0x9c,
-      0xe2, 0x6d, 0x71, 0xf7, 0xae, 0xa8, 0xe4, 0x35, 0xef, 0xea},
-     "TMT",
+    // Matrix AI Network
+    {{0xe2, 0x5b, 0xce, 0xc5, 0xd3, 0x80, 0x1c, 0xe3, 0xa7, 0x94,
+      0x7,  0x9b, 0xf9, 0x4a, 0xdf, 0x1b, 0x8c, 0xcd, 0x80, 0x2d},
+     "MAN",
      18},
-    // TrueAUD
-    {{0x0,  0x0,  0x61, 0x0,  0xf7, 0x9,  0x0,  0x10, 0x0, 0x5f,
-      0x1b, 0xd7, 0xae, 0x61, 0x22, 0xc3, 0xc2, 0xcf, 0x0, 0x90},
-     "TAUD",
+    // Pillar
+    {{0xe3, 0x81, 0x85, 0x4,  0xc1, 0xb3, 0x2b, 0xf1, 0x55, 0x7b,
+      0x16, 0xc2, 0x38, 0xb2, 0xe0, 0x1f, 0xd3, 0x14, 0x9c, 0x17},
+     "PLR",
      18},
-    // TrueFlip
-    {{0xa7, 0xf9, 0x76, 0xc3, 0x60, 0xeb, 0xbe, 0xd4, 0x46, 0x5c,
-      0x28, 0x55, 0x68, 0x4d, 0x1a, 0xae, 0x52, 0x71, 0xef, 0xa9},
-     "TFL",
-     8},
-    // Truegame
-    {{0xf8, 0xe0, 0x6e, 0x4e, 0x4a, 0x80, 0x28, 0x7f, 0xdc, 0xa5,
-      0xb0, 0x2d, 0xcc, 0xec, 0xaa, 0x9d, 0x9,  0x54, 0x84, 0xf},
-     "TGAME",
+    // 0x
+    {{0xe4, 0x1d, 0x24, 0x89, 0x57, 0x1d, 0x32, 0x21, 0x89, 0x24,
+      0x6d, 0xaf, 0xa5, 0xeb, 0xde, 0x1f, 0x46, 0x99, 0xf4, 0x98},
+     "ZRX",
      18},
-    // TrueHKD
-    {{0x0, 0x0,  0x85, 0x26, 0x0,  0xce, 0xb0, 0x1, 0xe0, 0x8e,
-      0x0, 0xbc, 0x0,  0x8b, 0xe6, 0x20, 0xd6, 0x0, 0x31, 0xf2},
-     "THKD",
+    // EXRNchain
+    {{0xe4, 0x69, 0xc4, 0x47, 0x3a, 0xf8, 0x22, 0x17, 0xb3, 0xc,
+      0xf1, 0x7b, 0x10, 0xbc, 0xdb, 0x6c, 0x8c, 0x79, 0x6e, 0x75},
+     "EXRN",
      18},
-    // TrueUSD
-    {{0x0,  0x0,  0x0,  0x0,  0x0,  0x8,  0x5d, 0x47, 0x80, 0xb7,
-      0x31, 0x19, 0xb6, 0x44, 0xae, 0x5e, 0xcd, 0x22, 0xb3, 0x76},
-     "TUSD",
+    // Donkey
+    {{0xe4, 0xf6, 0xd4, 0x6c, 0x24, 0x4b, 0xb7, 0xcf, 0x3e, 0x21,
+      0x8c, 0xdf, 0xb5, 0xc3, 0x5c, 0xf9, 0xa4, 0xd9, 0xc9, 0x20},
+     "DONK",
      18},
-    // Ubex
-    {{0x67, 0x4,  0xb6, 0x73, 0xc7, 0xd,  0xe9, 0xbf, 0x74, 0xc8,
-      0xfb, 0xa4, 0xb4, 0xbd, 0x74, 0x8f, 0xe,  0x21, 0x90, 0xe1},
-     "UBEX",
+    // LA
+    {{0xe5, 0x3,  0x65, 0xf5, 0xd6, 0x79, 0xcb, 0x98, 0xa1, 0xdd,
+      0x62, 0xd6, 0xf6, 0xe5, 0x8e, 0x59, 0x32, 0x1b, 0xcd, 0xdf},
+     "LA",
      18},
-    // U.CASH
-    {{0x92, 0xe5, 0x2a, 0x1a, 0x23, 0x5d, 0x9a, 0x10, 0x3d, 0x97,
-      0x9,  0x1,  0x6,  0x6c, 0xe9, 0x10, 0xaa, 0xce, 0xfd, 0x37},
-     "UCASH",
+    // GSENetwork
+    {{0xe5, 0x30, 0x44, 0x1f, 0x4f, 0x73, 0xbd, 0xb6, 0xdc, 0x2f,
+      0xa5, 0xaf, 0x7c, 0x3f, 0xc5, 0xfd, 0x55, 0x1e, 0xc8, 0x38},
+     "GSE",
+     4},
+    // Receive Access Ecosystem
+    {{0xe5, 0xa3, 0x22, 0x9c, 0xcb, 0x22, 0xb6, 0x48, 0x45, 0x94,
+      0x97, 0x3a, 0x3,  0xa3, 0x85, 0x1d, 0xcd, 0x94, 0x87, 0x56},
+     "RAE",
+     18},
+    // PiplCoin
+    {{0xe6, 0x45, 0x9,  0xf0, 0xbf, 0x7, 0xce, 0x2d, 0x29, 0xa7,
+      0xef, 0x19, 0xa8, 0xa9, 0xbc, 0x6, 0x54, 0x77, 0xc1, 0xb4},
+     "PIPL",
      8},
-    // UChain
-    {{0xaa, 0xf3, 0x70, 0x55, 0x18, 0x8f, 0xee, 0xe4, 0x86, 0x9d,
-      0xe6, 0x34, 0x64, 0x93, 0x7e, 0x68, 0x3d, 0x61, 0xb2, 0xa1},
-     "UCN",
+    // ZeusNetwork
+    {{0xe7, 0xe4, 0x27, 0x9b, 0x80, 0xd3, 0x19, 0xed, 0xe2, 0x88,
+      0x98, 0x55, 0x13, 0x5a, 0x22, 0x2,  0x1b, 0xaf, 0x9,  0x7},
+     "ZEUS",
      18},
-    // Umbrella Network
-    {{0x6f, 0xc1, 0x3e, 0xac, 0xe2, 0x65, 0x90, 0xb8, 0xc,  0xcc,
-      0xab, 0x1b, 0xa5, 0xd5, 0x18, 0x90, 0x57, 0x7d, 0x83, 0xb2},
-     "UMB",
+    // Chronologic
+    {{0xe8, 0x14, 0xae, 0xe9, 0x60, 0xa8, 0x52, 0x8,  0xc3, 0xdb,
+      0x54, 0x2c, 0x53, 0xe7, 0xd4, 0xa6, 0xc8, 0xd5, 0xf6, 0xf},
+     "DAY",
      18},
-    // U Network
-    {{0x35, 0x43, 0x63, 0x8e, 0xd4, 0xa9, 0x0,  0x6e, 0x48, 0x40,
-      0xb1, 0x5,  0x94, 0x42, 0x71, 0xbc, 0xea, 0x15, 0x60, 0x5d},
-     "UUU",
+    // Coinlancer
+    {{0xe8, 0x1d, 0x72, 0xd1, 0x4b, 0x15, 0x16, 0xe6, 0x8a, 0xc3,
+      0x19, 0xa,  0x46, 0xc9, 0x33, 0x2,  0xcc, 0x8e, 0xd6, 0xf},
+     "CL",
      18},
-    // Unibright
-    {{0x84, 0x0,  0xd9, 0x4a, 0x5c, 0xb0, 0xfa, 0xd,  0x4,  0x1a,
-      0x37, 0x88, 0xe3, 0x95, 0x28, 0x5d, 0x61, 0xc9, 0xee, 0x5e},
-     "UBT",
+    // DPRating
+    {{0xe8, 0x66, 0x3a, 0x64, 0xa9, 0x61, 0x69, 0xff, 0x4d, 0x95,
+      0xb4, 0x29, 0x9e, 0x7a, 0xe9, 0xa7, 0x6b, 0x90, 0x5b, 0x31},
+     "RATING",
      8},
-    // Unikoin Gold
-    {{0x24, 0x69, 0x27, 0x91, 0xbc, 0x44, 0x4c, 0x5c, 0xd0, 0xb8,
-      0x1e, 0x3c, 0xbc, 0xab, 0xa4, 0xb0, 0x4a, 0xcd, 0x1f, 0x3b},
-     "UKG",
-     18},
-    // Uniswap
-    {{0x1f, 0x98, 0x40, 0xa8, 0x5d, 0x5a, 0xf5, 0xbf, 0x1d, 0x17,
-      0x62, 0xf9, 0x25, 0xbd, 0xad, 0xdc, 0x42, 0x1,  0xf9, 0x84},
-     "UNI",
+    // VIBE
+    {{0xe8, 0xff, 0x5c, 0x9c, 0x75, 0xde, 0xb3, 0x46, 0xac, 0xac,
+      0x49, 0x3c, 0x46, 0x3c, 0x89, 0x50, 0xbe, 0x3,  0xdf, 0xba},
+     "VIBE",
      18},
-    // United Traders
-    {{0x16, 0xf8, 0x12, 0xbe, 0x7f, 0xff, 0x2,  0xca, 0xf6, 0x62,
-      0xb8, 0x5d, 0x5d, 0x58, 0xa5, 0xda, 0x65, 0x72, 0xd4, 0xdf},
-     "UTT",
-     8},
     // Upfiring
     {{0xea, 0x9,  0x7a, 0x2b, 0x1d, 0xb0, 0x6,  0x27, 0xb2, 0xfa,
       0x17, 0x46, 0xa,  0xd2, 0x60, 0xc0, 0x16, 0x1,  0x69, 0x77},
      "UFR",
      18},
-    // Uranus
-    {{0xff, 0x8b, 0xe4, 0xb2, 0x2c, 0xed, 0xc4, 0x40, 0x59, 0x1d,
-      0xcb, 0x1e, 0x64, 0x1e, 0xb2, 0xa0, 0xdd, 0x9d, 0x25, 0xa5},
-     "URAC",
+    // QuarkChain
+    {{0xea, 0x26, 0xc4, 0xac, 0x16, 0xd4, 0xa5, 0xa1, 0x6,  0x82,
+      0xb,  0xc8, 0xae, 0xe8, 0x5f, 0xd0, 0xb7, 0xb2, 0xb6, 0x64},
+     "QKC",
      18},
-    // USD Coin
-    {{0xa0, 0xb8, 0x69, 0x91, 0xc6, 0x21, 0x8b, 0x36, 0xc1, 0xd1,
-      0x9d, 0x4a, 0x2e, 0x9e, 0xb0, 0xce, 0x36, 0x6,  0xeb, 0x48},
-     "USDC",
-     6},
-    // Utrust
-    {{0xdc, 0x9a, 0xc3, 0xc2, 0xd, 0x1e, 0xd0, 0xb5, 0x40, 0xdf,
-      0x9b, 0x1f, 0xed, 0xc1, 0x0, 0x39, 0xdf, 0x13, 0xf9, 0x9c},
-     "UTK",
+    // Etherparty
+    {{0xea, 0x38, 0xea, 0xa3, 0xc8, 0x6c, 0x8f, 0x9b, 0x75, 0x15,
+      0x33, 0xba, 0x2e, 0x56, 0x2d, 0xeb, 0x9a, 0xcd, 0xed, 0x40},
+     "FUEL",
      18},
-    // Vega Protocol
-    {{0xcb, 0x84, 0xd7, 0x2e, 0x61, 0xe3, 0x83, 0x76, 0x7c, 0x4d,
-      0xfe, 0xb2, 0xd8, 0xff, 0x7f, 0x4f, 0xb8, 0x9a, 0xbc, 0x6e},
-     "VEGA",
+    // Gather
+    {{0xeb, 0x98, 0x6d, 0xa9, 0x94, 0xe4, 0xa1, 0x18, 0xd5, 0x95,
+      0x6b, 0x2,  0xd8, 0xb7, 0xc3, 0xc7, 0xce, 0x37, 0x36, 0x74},
+     "GTH",
      18},
-    // VeraOne
-    {{0x10, 0xbc, 0x51, 0x8c, 0x32, 0xfb, 0xae, 0x5e, 0x38, 0xec,
-      0xb5, 0xa,  0x61, 0x21, 0x60, 0x57, 0x1b, 0xd8, 0x1e, 0x44},
-     "VRO",
-     8},
-    // VeriDocGlobal
-    {{0x57, 0xc7, 0x5e, 0xcc, 0xc8, 0x55, 0x71, 0x36, 0xd3, 0x26,
-      0x19, 0xa1, 0x91, 0xfb, 0xcd, 0xc8, 0x85, 0x60, 0xd7, 0x11},
-     "VDG",
+    // Origin Sport
+    {{0xeb, 0x9a, 0x4b, 0x18, 0x58, 0x16, 0xc3, 0x54, 0xdb, 0x92,
+      0xdb, 0x9,  0xcc, 0x3b, 0x50, 0xbe, 0x60, 0xb9, 0x1,  0xb6},
+     "ORS",
      18},
-    // Verify
-    {{0x67, 0x2a, 0x1a, 0xd4, 0xf6, 0x67, 0xfb, 0x18, 0xa3, 0x33,
-      0xaf, 0x13, 0x66, 0x7a, 0xa0, 0xaf, 0x1f, 0x5b, 0x5b, 0xdd},
-     "CRED",
+    // Everest
+    {{0xeb, 0xd9, 0xd9, 0x9a, 0x39, 0x82, 0xd5, 0x47, 0xc5, 0xbb,
+      0x4d, 0xb7, 0xe3, 0xb1, 0xf9, 0xf1, 0x4b, 0x67, 0xeb, 0x83},
+     "ID",
      18},
-    // Veritaseum
-    {{0x8f, 0x34, 0x70, 0xa7, 0x38, 0x8c, 0x5, 0xee, 0x4e, 0x7a,
-      0xf3, 0xd0, 0x1d, 0x8c, 0x72, 0x2b, 0xf, 0xf5, 0x23, 0x74},
-     "VERI",
+    // Enzyme
+    {{0xec, 0x67, 0x0,  0x5c, 0x4e, 0x49, 0x8e, 0xc7, 0xf5, 0x5e,
+      0x9,  0x2b, 0xd1, 0xd3, 0x5c, 0xbc, 0x47, 0xc9, 0x18, 0x92},
+     "MLN",
      18},
-    // VIBE
-    {{0xe8, 0xff, 0x5c, 0x9c, 0x75, 0xde, 0xb3, 0x46, 0xac, 0xac,
-      0x49, 0x3c, 0x46, 0x3c, 0x89, 0x50, 0xbe, 0x3,  0xdf, 0xba},
-     "VIBE",
+    // IHT Real Estate Protocol
+    {{0xed, 0xa8, 0xb0, 0x16, 0xef, 0xa8, 0xb1, 0x16, 0x12, 0x8,
+      0xcf, 0x4,  0x1c, 0xd8, 0x69, 0x72, 0xee, 0xe0, 0xf3, 0x1e},
+     "IHT",
      18},
-    // Viberate
-    {{0x2c, 0x97, 0x4b, 0x2d, 0xb,  0xa1, 0x71, 0x6e, 0x64, 0x4c,
-      0x1f, 0xc5, 0x99, 0x82, 0xa8, 0x9d, 0xdd, 0x2f, 0xf7, 0x24},
-     "VIB",
+    // Zippie
+    {{0xed, 0xd7, 0xc9, 0x4f, 0xd7, 0xb4, 0x97, 0x1b, 0x91, 0x6d,
+      0x15, 0x6,  0x7b, 0xc4, 0x54, 0xb9, 0xe1, 0xba, 0xd9, 0x80},
+     "ZIPT",
      18},
-    // Victoria VR
-    {{0x7d, 0x51, 0x21, 0x50, 0x51, 0x49, 0x6, 0x5b, 0x56, 0x2c,
-      0x78, 0x9a, 0x1,  0x45, 0xed, 0x75, 0xe, 0x6e, 0x8c, 0xdd},
-     "VR",
+    // CVI
+    {{0xee, 0xaa, 0x40, 0xb2, 0x8a, 0x2d, 0x1b, 0xb,  0x8,  0xf6,
+      0xf9, 0x7b, 0xb1, 0xdd, 0x4b, 0x75, 0x31, 0x6c, 0x61, 0x7},
+     "GOVI",
      18},
-    // Vivid Labs
-    {{0x2c, 0x90, 0x23, 0xbb, 0xc5, 0x72, 0xff, 0x8d, 0xc1, 0x22,
-      0x8c, 0x78, 0x58, 0xa2, 0x80, 0x4,  0x6e, 0xa8, 0xc9, 0xe5},
-     "VID",
+    // EncrypGen
+    {{0xef, 0x63, 0x44, 0xde, 0x1f, 0xcf, 0xc5, 0xf4, 0x8c, 0x30,
+      0x23, 0x4c, 0x16, 0xc1, 0x38, 0x9e, 0x8c, 0xdc, 0x57, 0x2c},
+     "DNA",
      18},
-    // Vikky
-    {{0xd2, 0x94, 0x6b, 0xe7, 0x86, 0xf3, 0x5c, 0x3c, 0xc4, 0x2,
-      0xc2, 0x9b, 0x32, 0x36, 0x47, 0xab, 0xda, 0x79, 0x90, 0x71},
-     "VIKKY",
+    // BMCHAIN
+    {{0xf0, 0x28, 0xad, 0xee, 0x51, 0x53, 0x3b, 0x1b, 0x47, 0xbe,
+      0xaa, 0x89, 0xf,  0xeb, 0x54, 0xa4, 0x57, 0xf5, 0x1e, 0x89},
+     "BMT",
+     18},
+    // Flixxo
+    {{0xf0, 0x4a, 0x8a, 0xc5, 0x53, 0xfc, 0xed, 0xb5, 0xba, 0x99,
+      0xa6, 0x47, 0x99, 0x15, 0x58, 0x26, 0xc1, 0x36, 0xb0, 0xbe},
+     "FLIXX",
+     18},
+    // Imbrex
+    {{0xf0, 0x5a, 0x93, 0x82, 0xa4, 0xc3, 0xf2, 0x9e, 0x27, 0x84,
+      0x50, 0x27, 0x54, 0x29, 0x3d, 0x88, 0xb8, 0x35, 0x10, 0x9c},
+     "REX",
+     18},
+    // Enigma
+    {{0xf0, 0xee, 0x6b, 0x27, 0xb7, 0x59, 0xc9, 0x89, 0x3c, 0xe4,
+      0xf0, 0x94, 0xb4, 0x9a, 0xd2, 0x8f, 0xd1, 0x5a, 0x23, 0xe4},
+     "ENG",
      8},
-    // VNX Exchange
-    {{0x0,  0xfc, 0x27, 0xc,  0x9c, 0xc1, 0x3e, 0x87, 0x8a, 0xb5,
-      0x36, 0x3d, 0x0,  0x35, 0x4b, 0xeb, 0xf6, 0xf0, 0x5c, 0x15},
-     "VNXLU",
+    // Direct Insurance
+    {{0xf1, 0x49, 0x22, 0x0,  0x1a, 0x2f, 0xb8, 0x54, 0x1a, 0x43,
+      0x39, 0x5,  0x43, 0x7a, 0xe9, 0x54, 0x41, 0x9c, 0x24, 0x39},
+     "DIT",
+     8},
+    // Ruff
+    {{0xf2, 0x78, 0xc1, 0xca, 0x96, 0x90, 0x95, 0xff, 0xdd, 0xde,
+      0xd0, 0x20, 0x29, 0xc,  0xf8, 0xb5, 0xc4, 0x24, 0xac, 0xe2},
+     "RUFF",
      18},
-    // Wabi
-    {{0x28, 0x6b, 0xda, 0x14, 0x13, 0xa2, 0xdf, 0x81, 0x73, 0x1d,
-      0x49, 0x30, 0xce, 0x2f, 0x86, 0x2a, 0x35, 0xa6, 0x9,  0xfe},
-     "WABI",
+    // Patron
+    {{0xf3, 0xb3, 0xca, 0xd0, 0x94, 0xb8, 0x93, 0x92, 0xfc, 0xe5,
+      0xfa, 0xfd, 0x40, 0xbc, 0x3,  0xb8, 0xf,  0x2b, 0xc6, 0x24},
+     "PAT",
      18},
-    // WePower
-    {{0x4c, 0xf4, 0x88, 0x38, 0x7f, 0x3,  0x5f, 0xf0, 0x8c, 0x37,
-      0x15, 0x15, 0x56, 0x2c, 0xba, 0x71, 0x2f, 0x90, 0x15, 0xd4},
-     "WPR",
+    // Everex
+    {{0xf3, 0xdb, 0x5f, 0xa2, 0xc6, 0x6b, 0x7a, 0xf3, 0xeb, 0xc,
+      0xb,  0x78, 0x25, 0x10, 0x81, 0x6c, 0xbe, 0x48, 0x13, 0xb8},
+     "EVX",
+     4},
+    // SunContract
+    {{0xf4, 0x13, 0x41, 0x46, 0xaf, 0x2d, 0x51, 0x1d, 0xd5, 0xea,
+      0x8c, 0xdb, 0x1c, 0x4a, 0xc8, 0x8c, 0x57, 0xd6, 0x4,  0x4},
+     "SNC",
      18},
-    // WETH
-    {{0xc0, 0x2a, 0xaa, 0x39, 0xb2, 0x23, 0xfe, 0x8d, 0xa,  0xe,
-      0x5c, 0x4f, 0x27, 0xea, 0xd9, 0x8,  0x3c, 0x75, 0x6c, 0xc2},
-     "WETH",
+    // CRYCASH
+    {{0xf4, 0x1e, 0x5f, 0xbc, 0x2f, 0x6a, 0xac, 0x20, 0xd, 0xd8,
+      0x61, 0x9e, 0x12, 0x1c, 0xe1, 0xf0, 0x5d, 0x15, 0x0, 0x77},
+     "CRC",
+     18},
+    // Metal
+    {{0xf4, 0x33, 0x8,  0x93, 0x66, 0x89, 0x9d, 0x83, 0xa9, 0xf2,
+      0x6a, 0x77, 0x3d, 0x59, 0xec, 0x7e, 0xcf, 0x30, 0x35, 0x5e},
+     "MTL",
+     8},
+    // LooksRare
+    {{0xf4, 0xd2, 0x88, 0x8d, 0x29, 0xd7, 0x22, 0x22, 0x6f, 0xaf,
+      0xa5, 0xd9, 0xb2, 0x4f, 0x91, 0x64, 0xc0, 0x92, 0x42, 0x1e},
+     "LOOKS",
      18},
-    // WeTrust
-    {{0xcb, 0x94, 0xbe, 0x6f, 0x13, 0xa1, 0x18, 0x2e, 0x4a, 0x4b,
-      0x61, 0x40, 0xcb, 0x7b, 0xf2, 0x2,  0x5d, 0x28, 0xe4, 0x1b},
-     "TRST",
-     6},
     // WhenHub
     {{0xf4, 0xfe, 0x95, 0x60, 0x38, 0x81, 0xd0, 0xe0, 0x79, 0x54,
       0xfd, 0x76, 0x5,  0xe0, 0xe9, 0xa9, 0x16, 0xe4, 0x2c, 0x44},
      "WHEN",
      18},
-    // WiBX
-    {{0xbb, 0x97, 0xe3, 0x81, 0xf1, 0xd1, 0xe9, 0x4f, 0xfa, 0x2a,
-      0x58, 0x44, 0xf6, 0x87, 0x5e, 0x61, 0x46, 0x98, 0x10, 0x9},
-     "WBX",
+    // CACHE Gold
+    {{0xf5, 0x23, 0x84, 0x62, 0xe7, 0x23, 0x5c, 0x7b, 0x62, 0x81,
+      0x15, 0x67, 0xe6, 0x3d, 0xd1, 0x7d, 0x12, 0xc2, 0xea, 0xa0},
+     "CGT",
+     8},
+    // BambooDeFi
+    {{0xf5, 0x68, 0x42, 0xaf, 0x3b, 0x56, 0xfd, 0x72, 0xd1, 0x7c,
+      0xb1, 0x3,  0xf9, 0x2d, 0x2,  0x7b, 0xba, 0x91, 0x2e, 0x89},
+     "BAMBOO",
      18},
-    // Wings
-    {{0x66, 0x70, 0x88, 0xb2, 0x12, 0xce, 0x3d, 0x6, 0xa1, 0xb5,
-      0x53, 0xa7, 0x22, 0x1e, 0x1f, 0xd1, 0x90, 0x0, 0xd9, 0xaf},
-     "WINGS",
+    // Enjin Coin
+    {{0xf6, 0x29, 0xcb, 0xd9, 0x4d, 0x37, 0x91, 0xc9, 0x25, 0x1,
+      0x52, 0xbd, 0x8d, 0xfb, 0xdf, 0x38, 0xe,  0x2a, 0x3b, 0x9c},
+     "ENJ",
      18},
-    // Worldcore
-    {{0x72, 0xad, 0xad, 0xb4, 0x47, 0x78, 0x4d, 0xd7, 0xab, 0x1f,
-      0x47, 0x24, 0x67, 0x75, 0xf,  0xc4, 0x85, 0xe4, 0xcb, 0x2d},
-     "WRC",
-     6},
-    // Wrapped Bitcoin
-    {{0x22, 0x60, 0xfa, 0xc5, 0xe5, 0x54, 0x2a, 0x77, 0x3a, 0xa4,
-      0x4f, 0xbc, 0xfe, 0xdf, 0x7c, 0x19, 0x3b, 0xc2, 0xc5, 0x99},
-     "WBTC",
-     8},
-    // X8X
-    {{0x91, 0xd,  0xfc, 0x18, 0xd6, 0xea, 0x3d, 0x6a, 0x71, 0x24,
-      0xa6, 0xf8, 0xb5, 0x45, 0x8f, 0x28, 0x10, 0x60, 0xfa, 0x4c},
-     "X8X",
+    // Starbase
+    {{0xf7, 0xa, 0x64, 0x2b, 0xd3, 0x87, 0xf9, 0x43, 0x80, 0xff,
+      0xb9, 0x4, 0x51, 0xc2, 0xc8, 0x1d, 0x4e, 0xb8, 0x2c, 0xbc},
+     "STAR",
      18},
-    // Xaurum
-    {{0x4d, 0xf8, 0x12, 0xf6, 0x6,  0x4d, 0xef, 0x1e, 0x5e, 0x2,
-      0x9f, 0x1c, 0xa8, 0x58, 0x77, 0x7c, 0xc9, 0x8d, 0x2d, 0x81},
-     "XAUR",
-     8},
-    // Blockzero Labs
-    {{0xf,  0x7f, 0x96, 0x16, 0x48, 0xae, 0x6d, 0xb4, 0x3c, 0x75,
-      0x66, 0x3a, 0xc7, 0xe5, 0x41, 0x4e, 0xb7, 0x9b, 0x57, 0x4},
-     "XIO",
+    // Guppy
+    {{0xf7, 0xb0, 0x98, 0x29, 0x8f, 0x7c, 0x69, 0xfc, 0x14, 0x61,
+      0xb,  0xf7, 0x1d, 0x5e, 0x2,  0xc6, 0x7,  0x92, 0x89, 0x4c},
+     "GUP",
+     3},
+    // Truegame
+    {{0xf8, 0xe0, 0x6e, 0x4e, 0x4a, 0x80, 0x28, 0x7f, 0xdc, 0xa5,
+      0xb0, 0x2d, 0xcc, 0xec, 0xaa, 0x9d, 0x9,  0x54, 0x84, 0xf},
+     "TGAME",
      18},
-    // XMax
-    {{0xf,  0x8c, 0x45, 0xb8, 0x96, 0x78, 0x4a, 0x1e, 0x40, 0x85,
-      0x26, 0xb9, 0x30, 0x5,  0x19, 0xef, 0x86, 0x60, 0x20, 0x9c},
-     "XMX",
+    // Indorse
+    {{0xf8, 0xe3, 0x86, 0xed, 0xa8, 0x57, 0x48, 0x4f, 0x5a, 0x12,
+      0xe4, 0xb5, 0xda, 0xa9, 0x98, 0x4e, 0x6,  0xe7, 0x37, 0x5},
+     "IND",
+     18},
+    // Antiample
+    {{0xf9, 0x11, 0xa7, 0xec, 0x46, 0xa2, 0xc6, 0xfa, 0x49, 0x19,
+      0x32, 0x12, 0xfe, 0x4a, 0x2a, 0x9b, 0x95, 0x85, 0x1c, 0x27},
+     "XAMP",
+     9},
+    // Ripio Credit Network
+    {{0xf9, 0x70, 0xb8, 0xe3, 0x6e, 0x23, 0xf7, 0xfc, 0x3f, 0xd7,
+      0x52, 0xee, 0xa8, 0x6f, 0x8b, 0xe8, 0xd8, 0x33, 0x75, 0xa6},
+     "RCN",
+     18},
+    // Lunyr
+    {{0xfa, 0x5,  0xa7, 0x3f, 0xfe, 0x78, 0xef, 0x8f, 0x1a, 0x73,
+      0x94, 0x73, 0xe4, 0x62, 0xc5, 0x4b, 0xae, 0x65, 0x67, 0xd9},
+     "LUN",
+     18},
+    // CPChain
+    {{0xfa, 0xe4, 0xee, 0x59, 0xcd, 0xd8, 0x6e, 0x3b, 0xe9, 0xe8,
+      0xb9, 0xb,  0x53, 0xaa, 0x86, 0x63, 0x27, 0xd7, 0xc0, 0x90},
+     "CPC",
+     18},
+    // iXledger
+    {{0xfc, 0xa4, 0x79, 0x62, 0xd4, 0x5a, 0xdf, 0xdf, 0xd1, 0xab,
+      0x2d, 0x97, 0x23, 0x15, 0xdb, 0x4c, 0xe7, 0xcc, 0xf0, 0x94},
+     "IXT",
      8},
-    // XOVBank
-    {{0x15, 0x3e, 0xd9, 0xcc, 0x1b, 0x79, 0x29, 0x79, 0xd2, 0xbd,
-      0xe0, 0xbb, 0xf4, 0x5c, 0xc2, 0xa7, 0xe4, 0x36, 0xa5, 0xf9},
-     "XOV",
+    // 1World
+    {{0xfd, 0xbc, 0x1a, 0xdc, 0x26, 0xf0, 0xf8, 0xf8, 0x60, 0x6a,
+      0x5d, 0x63, 0xb7, 0xd3, 0xa3, 0xcd, 0x21, 0xc2, 0x2b, 0x23},
+     "1WO",
+     8},
+    // Reef
+    {{0xfe, 0x3e, 0x6a, 0x25, 0xe6, 0xb1, 0x92, 0xa4, 0x2a, 0x44,
+      0xec, 0xdd, 0xcd, 0x13, 0x79, 0x64, 0x71, 0x73, 0x5a, 0xcf},
+     "REEF",
      18},
-    // XSGD
-    {{0x70, 0xe8, 0xde, 0x73, 0xce, 0x53, 0x8d, 0xa2, 0xbe, 0xed,
-      0x35, 0xd1, 0x41, 0x87, 0xf6, 0x95, 0x9a, 0x8e, 0xca, 0x96},
-     "XSGD",
-     6},
-    // XYO Network
-    {{0x55, 0x29, 0x6f, 0x69, 0xf4, 0xe, 0xa6, 0xd2, 0xe,  0x47,
-      0x85, 0x33, 0xc1, 0x5a, 0x6b, 0x8, 0xb6, 0x54, 0xe7, 0x58},
-     "XYO",
+    // Libra Credit
+    {{0xfe, 0x5f, 0x14, 0x1b, 0xf9, 0x4f, 0xe8, 0x4b, 0xc2, 0x8d,
+      0xed, 0xa,  0xb9, 0x66, 0xc1, 0x6b, 0x17, 0x49, 0x6,  0x57},
+     "LBA",
      18},
-    // YAM v2
-    {{0xab, 0xa8, 0xca, 0xc6, 0x86, 0x6b, 0x83, 0xae, 0x4e, 0xec,
-      0x97, 0xdd, 0x7,  0xed, 0x25, 0x42, 0x82, 0xf6, 0xad, 0x8a},
-     "YAMV2",
-     24},
-    // yearn.finance
-    {{0xb,  0xc5, 0x29, 0xc0, 0xc,  0x64, 0x1,  0xae, 0xf6, 0xd2,
-      0x20, 0xbe, 0x8c, 0x6e, 0xa1, 0x66, 0x7f, 0x6a, 0xd9, 0x3e},
-     "YFI",
+    // Maecenas
+    {{0xfe, 0xc0, 0xcf, 0x7f, 0xe0, 0x78, 0xa5, 0x0,  0xab, 0xf1,
+      0x5f, 0x12, 0x84, 0x95, 0x8f, 0x22, 0x4,  0x9c, 0x2c, 0x7e},
+     "ART",
      18},
-    // Yee
-    {{0x92, 0x21, 0x5,  0xfa, 0xd8, 0x15, 0x3f, 0x51, 0x6b, 0xcf,
-      0xb8, 0x29, 0xf5, 0x6d, 0xc0, 0x97, 0xa0, 0xe1, 0xd7, 0x5},
-     "YEE",
+    // MetaMorph
+    {{0xfe, 0xf3, 0x88, 0x4b, 0x60, 0x3c, 0x33, 0xef, 0x8e, 0xd4,
+      0x18, 0x33, 0x46, 0xe0, 0x93, 0xa1, 0x73, 0xc9, 0x4d, 0xa6},
+     "METM",
      18},
-    // DFI.money
-    {{0xa1, 0xd0, 0xe2, 0x15, 0xa2, 0x3d, 0x70, 0x30, 0x84, 0x2f,
-      0xc6, 0x7c, 0xe5, 0x82, 0xa6, 0xaf, 0xa3, 0xcc, 0xab, 0x83},
-     "YFII",
+    // Amp
+    {{0xff, 0x20, 0x81, 0x77, 0x65, 0xcb, 0x7f, 0x73, 0xd4, 0xbd,
+      0xe2, 0xe6, 0x6e, 0x6,  0x7e, 0x58, 0xd1, 0x10, 0x95, 0xc2},
+     "AMP",
      18},
-    // YOUcash
-    {{0x3d, 0x37, 0x14, 0x13, 0xdd, 0x54, 0x89, 0xf3, 0xa0, 0x4c,
-      0x7,  0xc0, 0xc2, 0xce, 0x36, 0x9c, 0x20, 0x98, 0x6c, 0xeb},
-     "YOUC",
-     10},
-    // Zap
-    {{0x67, 0x81, 0xa0, 0xf8, 0x4c, 0x7e, 0x9e, 0x84, 0x6d, 0xcb,
-      0x84, 0xa9, 0xa5, 0xbd, 0x49, 0x33, 0x30, 0x67, 0xb1, 0x4},
-     "ZAP",
+    // BitScreener
+    {{0xff, 0x2b, 0x33, 0x53, 0xc3, 0x1,  0x5e, 0x9f, 0x1f, 0xbf,
+      0x95, 0xb9, 0xbd, 0xa2, 0x3f, 0x58, 0xaa, 0x7c, 0xe0, 0x7},
+     "BITX",
      18},
-    // Zebi
-    {{0x20, 0x8,  0xe3, 0x5,  0x7b, 0xd7, 0x34, 0xe1, 0xa,  0xd1,
-      0x3c, 0x9e, 0xae, 0x45, 0xff, 0x13, 0x2a, 0xbc, 0x17, 0x22},
-     "ZCO",
-     8},
-    // Zeusshield
-    {{0x7a, 0x41, 0xe0, 0x51, 0x7a, 0x5e, 0xca, 0x4f, 0xdb, 0xc7,
-      0xfb, 0xeb, 0xa4, 0xd4, 0xc4, 0x7b, 0x9f, 0xf6, 0xdc, 0x63},
-     "ZSC",
+    // Orbs
+    {{0xff, 0x56, 0xcc, 0x6b, 0x1e, 0x6d, 0xed, 0x34, 0x7a, 0xa0,
+      0xb7, 0x67, 0x6c, 0x85, 0xab, 0xb,  0x3d, 0x8,  0xb0, 0xfa},
+     "ORBS",
      18},
-    // Zipper Network
-    {{0xa9, 0xd2, 0x92, 0x7d, 0x3a, 0x4,  0x30, 0x9e, 0x0,  0x8b,
-      0x6a, 0xf6, 0xe2, 0xe2, 0x82, 0xae, 0x29, 0x52, 0xe7, 0xfd},
-     "ZIP",
+    // OneRoot Network
+    {{0xff, 0x60, 0x3f, 0x43, 0x94, 0x6a, 0x3a, 0x28, 0xdf, 0x5e,
+      0x6a, 0x73, 0x17, 0x25, 0x55, 0xd8, 0xc8, 0xb0, 0x23, 0x86},
+     "RNT",
      18},
-    // Zippie
-    {{0xed, 0xd7, 0xc9, 0x4f, 0xd7, 0xb4, 0x97, 0x1b, 0x91, 0x6d,
-      0x15, 0x6,  0x7b, 0xc4, 0x54, 0xb9, 0xe1, 0xba, 0xd9, 0x80},
-     "ZIPT",
+    // Uranus
+    {{0xff, 0x8b, 0xe4, 0xb2, 0x2c, 0xed, 0xc4, 0x40, 0x59, 0x1d,
+      0xcb, 0x1e, 0x64, 0x1e, 0xb2, 0xa0, 0xdd, 0x9d, 0x25, 0xa5},
+     "URAC",
      18},
-    // ZeusNetwork
-    {{0xe7, 0xe4, 0x27, 0x9b, 0x80, 0xd3, 0x19, 0xed, 0xe2, 0x88,
-      0x98, 0x55, 0x13, 0x5a, 0x22, 0x2,  0x1b, 0xaf, 0x9,  0x7},
-     "ZEUS",
+    // Alpha A
+    {{0xff, 0xc6, 0x3b, 0x91, 0x46, 0x96, 0x7a, 0x1b, 0xa3, 0x30,
+      0x66, 0xfb, 0x5,  0x7e, 0xe3, 0x72, 0x22, 0x21, 0xac, 0xf0},
+     "A",
      18},
 };
 
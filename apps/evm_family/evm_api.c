@@ -68,6 +68,7 @@
 #include "events.h"
 #include "pb_decode.h"
 #include "pb_encode.h"
+#include "session_bench.h"
 
 /*****************************************************************************
  * EXTERN VARIABLES
@@ -169,12 +170,10 @@ void evm_send_error(pb_size_t which_error, uint32_t error_code) {
 }
 
 void evm_send_result(const evm_result_t *result) {
-  // TODO: Eventually 1700 will be replaced by EVM_RESULT_SIZE when all
-  // option files for EVM app are complete
-  uint8_t buffer[1700] = {0};
-  size_t bytes_encoded = 0;
-  ASSERT(encode_evm_result(result, buffer, sizeof(buffer), &bytes_encoded));
-  send_response_to_host(&buffer[0], bytes_encoded);
+  // Encoded straight into the usb buffer, after the core message
+  pb_ostream_t stream = begin_response_to_host();
+  ASSERT(pb_encode(&stream, EVM_RESULT_FIELDS, result));
+  end_response_to_host(&stream);
 }
 
 bool evm_get_query(evm_query_t *query, pb_size_t exp_query_tag) {
@@ -184,6 +183,7 @@ bool evm_get_query(evm_query_t *query, pb_size_t exp_query_tag) {
     return false;
   }
 
+  SESSION_BENCH_ENTER(SESSION_PHASE_PARSING);
   if (!decode_evm_query(
           event.usb_event.p_msg, event.usb_event.msg_size, query)) {
     return false;
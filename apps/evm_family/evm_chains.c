@@ -1,7 +1,7 @@
 /**
- * @file    bsc_app.c
+ * @file    evm_chains.c
  * @author  Cypherock X1 Team
- * @brief   Binance Smart Chain application configuration and helpers
+ * @brief   Table of the EVM chains served by the shared EVM app
  * @copyright Copyright (c) 2023 HODL TECH PTE LTD
  * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
  *target=_blank>https://mitcc.org/</a>
@@ -60,7 +60,7 @@
  * INCLUDES
  *****************************************************************************/
 
-#include "bsc_app.h"
+#include "evm_chains.h"
 
 #include <stddef.h>
 
@@ -78,12 +78,18 @@
  *
  * @see erc20_contracts_t
  */
-extern const erc20_contracts_t bsc_contracts[];
+extern const erc20_contracts_t eth_contracts[];
 
 /*****************************************************************************
  * PRIVATE MACROS AND DEFINES
  *****************************************************************************/
 
+/// Version of the EVM app, shared by all the chains
+#define EVM_APP_VERSION {.major = 1, .minor = 0, .patch = 0}
+
+/// Number of entries in @ref evm_chains
+#define EVM_CHAINS_COUNT (sizeof(evm_chains) / sizeof(evm_chains[0]))
+
 /*****************************************************************************
  * PRIVATE TYPEDEFS
  *****************************************************************************/
@@ -92,43 +98,61 @@ extern const erc20_contracts_t bsc_contracts[];
  * STATIC FUNCTION PROTOTYPES
  *****************************************************************************/
 
-/**
- * @brief Checks if the provided token address is whitelisted and return the
- * matching contract instance.
- *
- * @param address Reference to the buffer containing the token address
- * @param contract Pointer to store the matched contract address instance
- *
- * @return bool Indicating if the provided token address is whitelisted
- * @return true If the address matches to an entry in the whitelist
- * @return false If the address does not match to an entry in the whitelist
- */
-static bool is_token_whitelisted(const uint8_t *address,
-                                 const erc20_contracts_t **contract);
-
 /*****************************************************************************
  * STATIC VARIABLES
  *****************************************************************************/
 
-static const evm_config_t bsc_app_config = {
-    .lunit_name = "BNB",
-    .name = "BNB Smart Chain",
-    .chain_id = 56,
-
-    // whitelisted contracts
-    .is_token_whitelisted = is_token_whitelisted,
+/**
+ * @brief Supported chains, sorted in ascending order of the chain id
+ * @details Adding a chain only needs a new entry with a unique app id.
+ */
+static const evm_chain_t evm_chains[] = {
+    {.desc = {.id = 7,
+              .version = EVM_APP_VERSION,
+              .app = evm_main,
+              .app_config = &evm_chains[0].config},
+     .config = {.lunit_name = "ETH",
+                .name = "Ethereum",
+                .chain_id = 1,
+                .whitelisted_contracts = eth_contracts,
+                .whitelisted_contracts_count =
+                    ETH_WHITELISTED_CONTRACTS_COUNT}},
+    {.desc = {.id = 14,
+              .version = EVM_APP_VERSION,
+              .app = evm_main,
+              .app_config = &evm_chains[1].config},
+     .config = {.lunit_name = "ETH", .name = "Optimism", .chain_id = 10}},
+    {.desc = {.id = 11,
+              .version = EVM_APP_VERSION,
+              .app = evm_main,
+              .app_config = &evm_chains[2].config},
+     .config = {.lunit_name = "BNB",
+                .name = "BNB Smart Chain",
+                .chain_id = 56}},
+    {.desc = {.id = 9,
+              .version = EVM_APP_VERSION,
+              .app = evm_main,
+              .app_config = &evm_chains[3].config},
+     .config = {.lunit_name = "MATIC", .name = "Polygon", .chain_id = 137}},
+    {.desc = {.id = 12,
+              .version = EVM_APP_VERSION,
+              .app = evm_main,
+              .app_config = &evm_chains[4].config},
+     .config = {.lunit_name = "FTM", .name = "Fantom Opera", .chain_id = 250}},
+    {.desc = {.id = 17,
+              .version = EVM_APP_VERSION,
+              .app = evm_main,
+              .app_config = &evm_chains[5].config},
+     .config = {.lunit_name = "ETH", .name = "Arbitrum", .chain_id = 42161}},
+    {.desc = {.id = 13,
+              .version = EVM_APP_VERSION,
+              .app = evm_main,
+              .app_config = &evm_chains[6].config},
+     .config = {.lunit_name = "AVAX",
+                .name = "Avalanche (C-Chain)",
+                .chain_id = 43114}},
 };
 
-static const cy_app_desc_t bsc_app_desc = {.id = 11,
-                                           .version =
-                                               {
-                                                   .major = 1,
-                                                   .minor = 0,
-                                                   .patch = 0,
-                                               },
-                                           .app = evm_main,
-                                           .app_config = &bsc_app_config};
-
 /*****************************************************************************
  * GLOBAL VARIABLES
  *****************************************************************************/
@@ -137,18 +161,31 @@ static const cy_app_desc_t bsc_app_desc = {.id = 11,
  * STATIC FUNCTIONS
  *****************************************************************************/
 
-static bool is_token_whitelisted(const uint8_t *address,
-                                 const erc20_contracts_t **contract) {
-  if (NULL != contract) {
-    *contract = NULL;
-  }
-  return false;
-}
-
 /*****************************************************************************
  * GLOBAL FUNCTIONS
  *****************************************************************************/
 
-const cy_app_desc_t *get_bsc_app_desc() {
-  return &bsc_app_desc;
-}
\ No newline at end of file
+void evm_register_chains() {
+  for (size_t index = 0; index < EVM_CHAINS_COUNT; index++) {
+    registry_add_app(&evm_chains[index].desc);
+  }
+}
+
+const evm_config_t *evm_get_chain(uint64_t chain_id) {
+  size_t low = 0;
+  size_t high = EVM_CHAINS_COUNT;
+
+  while (low < high) {
+    const size_t mid = low + (high - low) / 2;
+    if (chain_id == evm_chains[mid].config.chain_id) {
+      return &evm_chains[mid].config;
+    }
+    if (chain_id < evm_chains[mid].config.chain_id) {
+      high = mid;
+    } else {
+      low = mid + 1;
+    }
+  }
+
+  return NULL;
+}
@@ -1,13 +1,13 @@
 /**
- * @file    eth_app.h
+ * @file    evm_chains.h
  * @author  Cypherock X1 Team
- * @brief   Ethereum application configuration
+ * @brief   Table of the EVM chains served by the shared EVM app
  * @copyright Copyright (c) 2023 HODL TECH PTE LTD
  * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
  * target=_blank>https://mitcc.org/</a>
  */
-#ifndef ETH_APP_H
-#define ETH_APP_H
+#ifndef EVM_CHAINS_H
+#define EVM_CHAINS_H
 
 /*****************************************************************************
  * INCLUDES
@@ -20,13 +20,23 @@
  * MACROS AND DEFINES
  *****************************************************************************/
 
-/// Number of entries in whitelisted contracts list
+/// Number of entries in Ethereum's whitelisted contracts list
 #define ETH_WHITELISTED_CONTRACTS_COUNT 497
 
 /*****************************************************************************
  * TYPEDEFS
  *****************************************************************************/
 
+/**
+ * @brief Entry of the EVM chain table
+ * @details The descriptor registers the chain under its app id with
+ * evm_main() as the entry and config as the app_config.
+ */
+typedef struct {
+  const cy_app_desc_t desc;
+  const evm_config_t config;
+} evm_chain_t;
+
 /*****************************************************************************
  * EXPORTED VARIABLES
  *****************************************************************************/
@@ -36,10 +46,18 @@
  *****************************************************************************/
 
 /**
- * @brief Returns the config for Ethereum chin app descriptor
+ * @brief Registers the app descriptor of every supported EVM chain
+ */
+void evm_register_chains();
+
+/**
+ * @brief Looks up the configuration of an EVM chain by its chain id
+ *
+ * @param chain_id EIP-155 chain id of the chain
  *
- * @return A const reference to cy_app_desc_t
+ * @return const evm_config_t* Reference to the chain configuration
+ * @retval NULL If the chain is not supported
  */
-const cy_app_desc_t *get_eth_app_desc();
+const evm_config_t *evm_get_chain(uint64_t chain_id);
 
-#endif    // ETH_APP_H
+#endif    // EVM_CHAINS_H
@@ -81,73 +81,28 @@
  *****************************************************************************/
 
 /**
- * @brief This function checks if an EVM function tag is supported by the
- * X1 wallet parser. If a known function is found, a UI element of type
- * ui_display_node is created. Also, dpAbiTypeArray is updated to point
- * the argument type list for that function.
+ * @brief Accounts for a page of an argument and shows it if requested.
+ * @details The buffer size needed by the page is accumulated in pPageSize.
+ * The value is stringified into display->buffer only when display is not NULL.
+ * Abi types that are not displayable are skipped.
  *
- * @param functionTag The function tag found in the EVM transaction payload
- * @param dpAbiTypeArray Pointer to start of the argument type array for the
- * identified function.
- * @param displayNode Pointer to storage for ui_display_node
- * @return uint8_t The number of arguments in an identified function.
+ * @param type The static Abi type of the argument
+ * @param pData Pointer to the Abi encoded data of the argument
+ * @param additionalData Number of bytes for Abi_bytes_e, zero otherwise
+ * @param display Sink for the page; NULL to only account for the page
+ * @param pPageSize Storage for the largest buffer size needed so far
+ * @return uint8_t ETH_UTXN_ABI_DECODE_OK on success, error code otherwise
  */
-static uint8_t ETH_DetectFunction(const uint32_t functionTag,
-                                  Abi_Type_e const **const dpAbiTypeArray,
-                                  ui_display_node **displayNode);
+static uint8_t ETH_ShowArgument(Abi_Type_e type,
+                                const uint8_t *pData,
+                                uint32_t additionalData,
+                                const evm_abi_display_t *display,
+                                size_t *pPageSize);
 
 /*****************************************************************************
  * STATIC VARIABLES
  *****************************************************************************/
 
-static const Abi_Type_e EVM_swapDataType[EVM_swap_NUM_ARGS] = {
-    Abi_address_e,
-    Abi_address_e,
-    Abi_address_e,
-    Abi_address_e,
-    Abi_address_e,
-    Abi_uint256_e,
-    Abi_uint256_e,
-    Abi_uint256_e,
-    Abi_bytes_dynamic_e,
-    Abi_bytes_dynamic_e,
-};
-
-static const char *EVM_swap_Title = "Function: swap";
-static const char *EVM_swap_Signature =
-    "swap(address,(address,address,address,address,uint256,uint256,uint256),"
-    "bytes,bytes)";
-
-static const Abi_Type_e EVM_uniswapV3SwapDataType[EVM_uniswapV3Swap_NUM_ARGS] =
-    {Abi_uint256_e, Abi_uint256_e, Abi_uint256_array_dynamic_e};
-
-static const char *EVM_uniswapV3Swap_Title = "Function: uniswapV3Swap";
-static const char *EVM_uniswapV3Swap_Signature =
-    "uniswapV3Swap(uint256,uint256,uint256[])";
-
-static const Abi_Type_e
-    EVM_safeTransferFromDataType[EVM_safeTransferFrom_NUM_ARGS] = {
-        Abi_address_e,
-        Abi_address_e,
-        Abi_uint256_e,
-};
-
-static const char *EVM_safeTransferFrom_Title = "Function: safeTransferFrom";
-static const char *EVM_safeTransferFrom_Signature =
-    "safeTransferFrom(address,address,uint256)";
-
-static const Abi_Type_e EVM_depositDataType[EVM_deposit_NUM_ARGS] = {};
-
-static const char *EVM_deposit_Title = "Function: deposit";
-static const char *EVM_deposit_Signature = "deposit()";
-
-static const Abi_Type_e EVM_transferDataType[EVM_transfer_NUM_ARGS] = {
-    Abi_address_e,
-    Abi_uint256_e,
-};
-static const char *EVM_transfer_Title = "Function: transfer";
-static const char *EVM_transfer_Signature = "transfer(address,uint256)";
-
 /*****************************************************************************
  * GLOBAL VARIABLES
  *****************************************************************************/
@@ -156,78 +111,28 @@ static const char *EVM_transfer_Signature = "transfer(address,uint256)";
  * STATIC FUNCTIONS
  *****************************************************************************/
 
-static uint8_t ETH_DetectFunction(const uint32_t functionTag,
-                                  Abi_Type_e const **const dpAbiTypeArray,
-                                  ui_display_node **displayNode) {
-  if (NULL == dpAbiTypeArray) {
-    return 0;
-  }
-
-  uint8_t numArgsInFunction = 0;
-  const char *EvmFunctionTitle = NULL;
-  const char *EvmFunctionSignature = NULL;
+static uint8_t ETH_ShowArgument(Abi_Type_e type,
+                                const uint8_t *pData,
+                                uint32_t additionalData,
+                                const evm_abi_display_t *display,
+                                size_t *pPageSize) {
+  const size_t size = ABI_StringifySize(type, additionalData);
+  *pPageSize = CY_MAX(*pPageSize, size);
 
-  switch (functionTag) {
-    case EVM_swap_TAG: {
-      numArgsInFunction = EVM_swap_NUM_ARGS;
-      *(dpAbiTypeArray) = &(EVM_swapDataType[0]);
-      EvmFunctionTitle = EVM_swap_Title;
-      EvmFunctionSignature = EVM_swap_Signature;
-      break;
-    }
-    case EVM_uniswapV3Swap_TAG: {
-      numArgsInFunction = EVM_uniswapV3Swap_NUM_ARGS;
-      *(dpAbiTypeArray) = &(EVM_uniswapV3SwapDataType[0]);
-      EvmFunctionTitle = EVM_uniswapV3Swap_Title;
-      EvmFunctionSignature = EVM_uniswapV3Swap_Signature;
-      break;
-    }
-    case EVM_safeTransferFrom_TAG: {
-      numArgsInFunction = EVM_safeTransferFrom_NUM_ARGS;
-      *(dpAbiTypeArray) = &(EVM_safeTransferFromDataType[0]);
-      EvmFunctionTitle = EVM_safeTransferFrom_Title;
-      EvmFunctionSignature = EVM_safeTransferFrom_Signature;
-      break;
-    }
-    case EVM_deposit_TAG: {
-      numArgsInFunction = EVM_deposit_NUM_ARGS;
-      *(dpAbiTypeArray) = &(EVM_depositDataType[0]);
-      EvmFunctionTitle = EVM_deposit_Title;
-      EvmFunctionSignature = EVM_deposit_Signature;
-      break;
-    }
-    case EVM_transfer_TAG: {
-      numArgsInFunction = EVM_transfer_NUM_ARGS;
-      *(dpAbiTypeArray) = &(EVM_transferDataType[0]);
-      EvmFunctionTitle = EVM_transfer_Title;
-      EvmFunctionSignature = EVM_transfer_Signature;
-      break;
-    }
-    default: {
-      break;
-    }
+  if ((NULL == display) || (0 == size)) {
+    return ETH_UTXN_ABI_DECODE_OK;
   }
 
-  /* Add the detected function as part of verification in the UI */
-  if ((NULL != EvmFunctionTitle) && (NULL != EvmFunctionSignature)) {
-    ui_display_node *pAbiDispNode;
-    pAbiDispNode = ui_create_display_node(EvmFunctionTitle,
-                                          strnlen(EvmFunctionTitle, 100),
-                                          EvmFunctionSignature,
-                                          strnlen(EvmFunctionSignature, 100));
-
-    if (*displayNode == NULL) {
-      *displayNode = pAbiDispNode;
-    } else {
-      ui_display_node *temp = *displayNode;
-      while (temp->next != NULL) {
-        temp = temp->next;
-      }
-      temp->next = pAbiDispNode;
-    }
+  const char *title = ABI_Stringify(
+      type, pData, additionalData, display->buffer, display->buffer_size);
+  if (NULL == title) {
+    return ETH_UTXN_BAD_PAYLOAD;
   }
 
-  return numArgsInFunction;
+  if (!display->show(display->ctx, title, display->buffer)) {
+    return ETH_UTXN_ABI_DISPLAY_REJECTED;
+  }
+  return ETH_UTXN_ABI_DECODE_OK;
 }
 
 /*****************************************************************************
@@ -236,12 +141,15 @@ static uint8_t ETH_DetectFunction(const uint32_t functionTag,
 
 uint8_t ETH_ExtractArguments(const uint8_t *pAbiPayload,
                              const uint64_t sizeOfPayload,
-                             ui_display_node **displayNode) {
+                             const evm_abi_display_t *display,
+                             size_t *pPageSize) {
   uint8_t returnCode = ETH_BAD_ARGUMENTS;
+  size_t pageSize = 1;
 
   /* Size of transaction payload must be atleast EVM_FUNC_SIGNATURE_LENGTH */
   if ((NULL == pAbiPayload) || (EVM_FUNC_SIGNATURE_LENGTH > sizeOfPayload) ||
-      (NULL == displayNode)) {
+      ((NULL != display) &&
+       ((NULL == display->show) || (NULL == display->buffer)))) {
     return returnCode;
   }
 
@@ -254,22 +162,28 @@ uint8_t ETH_ExtractArguments(const uint8_t *pAbiPayload,
    * the types of argument corresponding to a function signature
    */
   uint32_t functionTag = U32_READ_BE_ARRAY(pCurrHeadPtr);
-  uint8_t numArgsInFunction = 0;
-  Abi_Type_e const *pArgumentAbiType = NULL;
-
-  numArgsInFunction =
-      ETH_DetectFunction(functionTag, &pArgumentAbiType, displayNode);
+  const evm_function_t *function = evm_lookup_function(functionTag);
 
   /**
-   * If pArgumentAbiType is NULL, that means ETH_DetectFunction did not
-   * detect a supported function
+   * If function is NULL, that means evm_lookup_function did not detect a
+   * supported function
    * Therefore we should return from here
    */
-  if (NULL == pArgumentAbiType) {
+  if (NULL == function) {
     returnCode = ETH_UTXN_FUNCTION_NOT_FOUND;
     return returnCode;
   }
 
+  /* Add the detected function as part of verification in the UI */
+  if ((NULL != display) &&
+      !display->show(display->ctx, function->title, function->signature)) {
+    returnCode = ETH_UTXN_ABI_DISPLAY_REJECTED;
+    return returnCode;
+  }
+
+  const uint8_t numArgsInFunction = function->num_args;
+  Abi_Type_e const *pArgumentAbiType = function->arg_types;
+
   /* Increment pCurrHeadPtr to point to first argument */
   pCurrHeadPtr += EVM_FUNC_SIGNATURE_LENGTH;
 
@@ -296,8 +210,6 @@ uint8_t ETH_ExtractArguments(const uint8_t *pAbiPayload,
       break;
     }
 
-    ui_display_node *pAbiDispNode = NULL;
-
     /* Check if we are reading a dynamic or static element */
     if (Abi_bytes_dynamic_e <= pArgumentAbiType[currArgument]) {
       uint8_t *pDynamicDataPtr = NULL;
@@ -331,37 +243,88 @@ uint8_t ETH_ExtractArguments(const uint8_t *pAbiPayload,
        * uint256 bit data
        */
       if (Abi_bytes_dynamic_e == pArgumentAbiType[currArgument]) {
-        pAbiDispNode =
-            ABI_Stringify(Abi_bytes_e, pDynamicDataPtr, numBytesReturned);
+        returnCode = ETH_ShowArgument(Abi_bytes_e,
+                                      pDynamicDataPtr,
+                                      numBytesReturned,
+                                      display,
+                                      &pageSize);
       } else if (Abi_uint256_array_dynamic_e ==
                  pArgumentAbiType[currArgument]) {
         uint32_t item;
+        returnCode = ETH_UTXN_ABI_DECODE_OK;
         for (item = 0; item < numBytesReturned; item++) {
           uint8_t *pStaticData =
               (uint8_t *)(pDynamicDataPtr + (ABI_ELEMENT_SZ_IN_BYTES * item));
 
-          pAbiDispNode = ABI_Stringify(Abi_uint256_e, pStaticData, 0);
+          returnCode = ETH_ShowArgument(
+              Abi_uint256_e, pStaticData, 0, display, &pageSize);
+          if (ETH_UTXN_ABI_DECODE_OK != returnCode) {
+            break;
+          }
         }
       }
     } else /* Static elements can be stringified straight away */
     {
-      pAbiDispNode =
-          ABI_Stringify(pArgumentAbiType[currArgument], pCurrHeadPtr, 0);
+      returnCode = ETH_ShowArgument(
+          pArgumentAbiType[currArgument], pCurrHeadPtr, 0, display, &pageSize);
     }
 
+    if (ETH_UTXN_ABI_DECODE_OK != returnCode) {
+      break;
+    }
     pCurrHeadPtr += ABI_ELEMENT_SZ_IN_BYTES;
-    returnCode = ETH_UTXN_ABI_DECODE_OK;
+  }
+
+  if (NULL != pPageSize) {
+    *pPageSize = pageSize;
+  }
+  return returnCode;
+}
+
+bool evm_lookup_whitelisted_contract(const erc20_contracts_t *contracts,
+                                     const uint16_t count,
+                                     const uint8_t *address,
+                                     const erc20_contracts_t **contract) {
+  const erc20_contracts_t *match = NULL;
+  uint16_t low = 0;
+  uint16_t high = count;
+
+  while (low < high) {
+    const uint16_t mid = low + (high - low) / 2;
+    const int order =
+        memcmp(address, contracts[mid].address, EVM_ADDRESS_LENGTH);
+    if (0 == order) {
+      match = &contracts[mid];
+      break;
+    }
+    if (0 > order) {
+      high = mid;
+    } else {
+      low = mid + 1;
+    }
+  }
+
+  if (NULL != contract) {
+    *contract = match;
+  }
+  return NULL != match;
+}
+
+const evm_function_t *evm_lookup_function(uint32_t selector) {
+  uint16_t low = 0;
+  uint16_t high = evm_functions_count;
 
-    if (*displayNode == NULL) {
-      *displayNode = pAbiDispNode;
+  while (low < high) {
+    const uint16_t mid = low + (high - low) / 2;
+    if (selector == evm_functions[mid].selector) {
+      return &evm_functions[mid];
+    }
+    if (selector < evm_functions[mid].selector) {
+      high = mid;
     } else {
-      ui_display_node *temp = *displayNode;
-      while (temp->next != NULL) {
-        temp = temp->next;
-      }
-      temp->next = pAbiDispNode;
+      low = mid + 1;
     }
   }
 
-  return returnCode;
+  return NULL;
 }
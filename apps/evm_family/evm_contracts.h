@@ -15,6 +15,7 @@
 
 #include <stdint.h>
 
+#include "abi.h"
 #include "coin_utils.h"
 
 /*****************************************************************************
@@ -30,25 +31,11 @@
 /// Length of Ethereum public addresses in bytes
 #define EVM_ADDRESS_LENGTH 20
 
-/** Refer https://www.4byte.directory/signatures/?bytes4_signature=0x7c025200 */
-#define EVM_swap_TAG (0x12aa3caf)
-#define EVM_swap_NUM_ARGS 10
-
-/** Refer https://www.4byte.directory/signatures/?bytes4_signature=0xe449022e */
-#define EVM_uniswapV3Swap_TAG (0xe449022e)
-#define EVM_uniswapV3Swap_NUM_ARGS 3
-
-/** Refer https://www.4byte.directory/signatures/?bytes4_signature=0x42842e0e */
-#define EVM_safeTransferFrom_TAG (0x42842e0e)
-#define EVM_safeTransferFrom_NUM_ARGS 3
-
-/** Refer https://www.4byte.directory/signatures/?bytes4_signature=0xd0e30db0 */
-#define EVM_deposit_TAG (0xd0e30db0)
-#define EVM_deposit_NUM_ARGS 0
-
-/** Refer https://www.4byte.directory/signatures/?bytes4_signature=0xa9059cbb */
+/**
+ * Refer https://www.4byte.directory/signatures/?bytes4_signature=0xa9059cbb
+ * Functions decoded for clear signing are listed in evm_selectors.json
+ */
 #define EVM_transfer_TAG (0xa9059cbb)
-#define EVM_transfer_NUM_ARGS 2
 
 /**
  * @brief An expected limit on length of Ethereum based ERC20 token symbols.
@@ -63,6 +50,7 @@
 #define ETH_UTXN_BAD_PAYLOAD (0x11)
 #define ETH_UTXN_FUNCTION_NOT_FOUND (0x11)
 #define ETH_BAD_ARGUMENTS (0x22)
+#define ETH_UTXN_ABI_DISPLAY_REJECTED (0x33)
 
 /*****************************************************************************
  * TYPEDEFS
@@ -88,30 +76,109 @@ typedef struct erc20_contracts {
   const uint8_t decimal;
 } erc20_contracts_t;
 
+/**
+ * @brief An EVM contract function that can be decoded for clear signing
+ * @details The table of functions is generated by
+ * utilities/evm/generate-selectors.py from apps/evm_family/evm_selectors.json
+ */
+typedef struct evm_function {
+  /// First 4 bytes of the keccak256 of the function signature
+  const uint32_t selector;
+  /// Title of the function shown on the device
+  const char *title;
+  /// Canonical function signature shown on the device
+  const char *signature;
+  /// ABI type of each argument; NULL if the function takes no argument
+  const Abi_Type_e *arg_types;
+  /// Number of entries in arg_types
+  const uint8_t num_args;
+} evm_function_t;
+
+/**
+ * @brief Sink for the display pages of a decoded contract call
+ * @details Each page is stringified into buffer right before it is shown, so a
+ * single buffer is used for all the pages. Refer @ref ETH_ExtractArguments
+ */
+typedef struct {
+  /// Shows a page to the user; returns false to stop the extraction
+  bool (*show)(void *ctx, const char *title, const char *value);
+  /// Context passed to show
+  void *ctx;
+  /// Storage for the value of the page being shown
+  char *buffer;
+  /// Size of buffer; refer pPageSize of @ref ETH_ExtractArguments
+  size_t buffer_size;
+} evm_abi_display_t;
+
 /*****************************************************************************
  * EXPORTED VARIABLES
  *****************************************************************************/
 
+/// Functions supported for clear signing, sorted in ascending selector order
+extern const evm_function_t evm_functions[];
+/// Number of entries in @ref evm_functions
+extern const uint16_t evm_functions_count;
+
 /*****************************************************************************
  * GLOBAL FUNCTION PROTOTYPES
  *****************************************************************************/
 
 /**
- * @brief This function extracts Abi encoded arguments for EVM functions into UI
- * compatible nodes ui_display_node(s)
+ * @brief This function extracts Abi encoded arguments for EVM functions and
+ * presents them to the user page by page
+ * @details The first page shows the function title with its signature followed
+ * by a page for each argument. When display is NULL, the arguments are only
+ * validated; this allows the caller to size the display buffer before any page
+ * is stringified. The pages are stringified lazily, hence the arguments after
+ * a rejected page are never formatted.
  *
  * @param pAbiPayload Pointer to start of payload of the EVM transaction
- * @param sizeOfUTxn Size of payload of the EVM transaction
- * @param displayNode Pointer to storage for ui_display_node
+ * @param sizeOfPayload Size of payload of the EVM transaction
+ * @param display Sink for the pages; NULL to only validate the arguments
+ * @param pPageSize Optional storage for the buffer size needed by the largest
+ * page
  * @return uint8_t Depicts the status of operation for this function
  * @retval ETH_BAD_ARGUMENTS: If any argument is invalid
  * @retval ETH_UTXN_FUNCTION_NOT_FOUND: If a function NOT supported by X1 wallet
  * is in the EVM tx
  * @retval ETH_UTXN_BAD_PAYLOAD: If a payload contains invalid data
+ * @retval ETH_UTXN_ABI_DISPLAY_REJECTED: If display->show returned false
  * @retval ETH_UTXN_ABI_DECODE_OK: If the arguments are extracted successfully
  */
 uint8_t ETH_ExtractArguments(const uint8_t *pAbiPayload,
                              const uint64_t sizeOfPayload,
-                             ui_display_node **displayNode);
+                             const evm_abi_display_t *display,
+                             size_t *pPageSize);
+
+/**
+ * @brief Looks up the token address in a whitelist of contracts
+ * @details The function performs a binary search; hence the list must be
+ * sorted in ascending order of the contract address.
+ *
+ * @param contracts Reference to the sorted list of whitelisted contracts
+ * @param count Number of entries in the list
+ * @param address Reference to the buffer containing the token address
+ * @param contract Pointer to store the matched contract address instance
+ *
+ * @return bool Indicating if the provided token address is whitelisted
+ * @return true If the address matches to an entry in the whitelist
+ * @return false If the address does not match to an entry in the whitelist
+ */
+bool evm_lookup_whitelisted_contract(const erc20_contracts_t *contracts,
+                                     uint16_t count,
+                                     const uint8_t *address,
+                                     const erc20_contracts_t **contract);
+
+/**
+ * @brief Looks up the function selector in @ref evm_functions
+ * @details The function performs a binary search over the sorted table which
+ * is shared by all the EVM chains.
+ *
+ * @param selector The function selector found in the EVM transaction payload
+ *
+ * @return const evm_function_t* Reference to the matched function
+ * @retval NULL If the function is not supported for clear signing
+ */
+const evm_function_t *evm_lookup_function(uint32_t selector);
 
 #endif    // EVM_CONTRACTS_H
@@ -62,9 +62,14 @@
 
 #include "evm_helpers.h"
 
+#include <string.h>
+
+#include "address.h"
+#include "evm_contracts.h"
 #include "evm_priv.h"
 #include "evm_txn_helpers.h"
 #include "evm_typed_data_helper.h"
+#include "memzero.h"
 
 /*****************************************************************************
  * EXTERN VARIABLES
@@ -78,6 +83,12 @@
  * PRIVATE TYPEDEFS
  *****************************************************************************/
 
+typedef struct {
+  uint8_t address[EVM_ADDRESS_LENGTH];
+  char text[EVM_ADDRESS_STRING_SIZE];
+  bool valid;
+} evm_address_cache_entry_t;
+
 /*****************************************************************************
  * STATIC FUNCTION PROTOTYPES
  *****************************************************************************/
@@ -112,25 +123,14 @@ static inline bool is_bip44_hd_path(const uint32_t *path, uint32_t depth);
  * @return bool Indicates if the provided path uses account as the key
  */
 static inline bool is_account_hd_path(const uint32_t *path, uint32_t depth);
-
-/**
- * @brief This function calculates the digest of ETH sign or Personal sign data
- * using the Keccak-256 algorithm.
- *
- * @param[in] msg_data A pointer to the data that needs to be hashed.
- * @param[in] msg_data_size The size of the message data in bytes.
- * @param[out] digest_out A pointer to a buffer where the computed digest will
- * be stored.
- *
- * @return bool value indicating hash calculation status.
- */
-static bool evm_get_personal_data_digest(uint8_t *msg_data,
-                                         uint32_t msg_data_size,
-                                         uint8_t *digest_out);
 /*****************************************************************************
  * STATIC VARIABLES
  *****************************************************************************/
 
+static evm_address_cache_entry_t address_cache[EVM_ADDRESS_CACHE_SIZE];
+/// Entry replaced by the next miss, in the order the entries were filled
+static uint8_t address_cache_next = 0;
+
 /*****************************************************************************
  * GLOBAL VARIABLES
  *****************************************************************************/
@@ -157,31 +157,6 @@ static inline bool is_account_hd_path(const uint32_t *path, uint32_t depth) {
          0 == path[3] && is_non_hardened(path[4]);
 }
 
-static bool evm_get_personal_data_digest(uint8_t *msg_data,
-                                         uint32_t msg_data_size,
-                                         uint8_t *digest_out) {
-  if (NULL == msg_data || NULL == digest_out || 0 == msg_data_size) {
-    return false;
-  }
-
-  char size_string[256] = {0};
-  uint8_t size_string_size = 0;
-  SHA3_CTX ctx = {0};
-
-  keccak_256_Init(&ctx);
-
-  size_string_size =
-      snprintf(size_string, sizeof(size_string), "%ld", msg_data_size);
-
-  keccak_Update(&ctx,
-                (const uint8_t *)ETH_PERSONAL_SIGN_IDENTIFIER,
-                sizeof(ETH_PERSONAL_SIGN_IDENTIFIER) - 1);
-  keccak_Update(&ctx, (const uint8_t *)size_string, size_string_size);
-  keccak_Update(&ctx, (const uint8_t *)msg_data, msg_data_size);
-
-  keccak_Final(&ctx, digest_out);
-  return true;
-}
 /*****************************************************************************
  * GLOBAL FUNCTIONS
  *****************************************************************************/
@@ -202,6 +177,24 @@ bool evm_derivation_path_guard(const uint32_t *path, uint32_t depth) {
   return false;
 }
 
+void evm_personal_data_digest_init(SHA3_CTX *sha3_ctx,
+                                   uint32_t msg_data_size) {
+  char size_string[11] = {0};
+  uint8_t size_string_size = 0;
+
+  keccak_256_Init(sha3_ctx);
+
+  size_string_size = snprintf(size_string,
+                              sizeof(size_string),
+                              "%lu",
+                              (unsigned long)msg_data_size);
+
+  keccak_Update(sha3_ctx,
+                (const uint8_t *)ETH_PERSONAL_SIGN_IDENTIFIER,
+                sizeof(ETH_PERSONAL_SIGN_IDENTIFIER) - 1);
+  keccak_Update(sha3_ctx, (const uint8_t *)size_string, size_string_size);
+}
+
 bool evm_get_msg_data_digest(const evm_sign_msg_context_t *ctx,
                              uint8_t *digest) {
   bool result = false;
@@ -209,16 +202,51 @@ bool evm_get_msg_data_digest(const evm_sign_msg_context_t *ctx,
   switch (ctx->init.message_type) {
     case EVM_SIGN_MSG_TYPE_ETH_SIGN:
     case EVM_SIGN_MSG_TYPE_PERSONAL_SIGN: {
-      result = evm_get_personal_data_digest(
-          ctx->msg_data, ctx->init.total_msg_size, digest);
+      if (0 == ctx->init.total_msg_size) {
+        break;
+      }
+      // finalize a copy so that the context stays const
+      SHA3_CTX sha3_ctx = ctx->msg_sha3_ctx;
+      keccak_Final(&sha3_ctx, digest);
+      result = true;
     } break;
 
     case EVM_SIGN_MSG_TYPE_SIGN_TYPED_DATA: {
       result = evm_get_typed_struct_data_digest(&(ctx->typed_data), digest);
     } break;
+
+    case EVM_SIGN_MSG_TYPE_SIGN_TYPED_DATA_STREAM: {
+      result = evm_typed_data_stream_digest(ctx->typed_stream, digest);
+    } break;
     default:
       break;
   }
 
   return result;
-}
\ No newline at end of file
+}
+
+void evm_format_address(const uint8_t *address, char *out) {
+  for (uint8_t i = 0; i < EVM_ADDRESS_CACHE_SIZE; i++) {
+    const evm_address_cache_entry_t *entry = &address_cache[i];
+    if (entry->valid &&
+        0 == memcmp(entry->address, address, EVM_ADDRESS_LENGTH)) {
+      memcpy(out, entry->text, EVM_ADDRESS_STRING_SIZE);
+      return;
+    }
+  }
+
+  evm_address_cache_entry_t *entry = &address_cache[address_cache_next];
+  address_cache_next = (address_cache_next + 1) % EVM_ADDRESS_CACHE_SIZE;
+  entry->text[0] = '0';
+  entry->text[1] = 'x';
+  // the chain id only applies to RSKIP-60 checksums, not used by the family
+  ethereum_address_checksum(address, &entry->text[2], false, 0);
+  memcpy(entry->address, address, EVM_ADDRESS_LENGTH);
+  entry->valid = true;
+  memcpy(out, entry->text, EVM_ADDRESS_STRING_SIZE);
+}
+
+void evm_address_cache_clear(void) {
+  memzero(address_cache, sizeof(address_cache));
+  address_cache_next = 0;
+}
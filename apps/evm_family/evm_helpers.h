@@ -32,6 +32,11 @@
 
 #define EVM_DRV_ACCOUNT 0x80000000
 
+/// Size of a 0x-prefixed EIP-55 address with its null terminator
+#define EVM_ADDRESS_STRING_SIZE 43
+/// Number of addresses kept formatted by @ref evm_format_address
+#define EVM_ADDRESS_CACHE_SIZE 4
+
 /*****************************************************************************
  * TYPEDEFS
  *****************************************************************************/
@@ -61,6 +66,18 @@
  */
 bool evm_derivation_path_guard(const uint32_t *path, uint32_t depth);
 
+/**
+ * @brief Starts the digest of ETH sign or personal sign data
+ * @details Absorbs the EIP-191 prefix along with the decimal length of the
+ * message. The message bytes are then absorbed with keccak_Update as they are
+ * received and @ref evm_get_msg_data_digest concludes the digest.
+ *
+ * @param[out] sha3_ctx The Keccak-256 context to initialize
+ * @param[in] msg_data_size The total size of the message data in bytes
+ */
+void evm_personal_data_digest_init(SHA3_CTX *sha3_ctx,
+                                   uint32_t msg_data_size);
+
 /**
  * @brief This function calculates the hash of the message data based on the
  * message type.
@@ -75,4 +92,21 @@ bool evm_derivation_path_guard(const uint32_t *path, uint32_t depth);
  */
 bool evm_get_msg_data_digest(const evm_sign_msg_context_t *ctx,
                              uint8_t *digest);
+
+/**
+ * @brief Formats the address as a 0x-prefixed EIP-55 checksum address
+ * @details The last EVM_ADDRESS_CACHE_SIZE addresses are kept formatted, so
+ * that an address shown on several screens (recipient, contract, arguments
+ * of a clear-signed call) is hashed once. The cache is dropped by
+ * @ref evm_address_cache_clear when the app exits.
+ *
+ * @param[in] address The 20-byte address
+ * @param[out] out Buffer of at least EVM_ADDRESS_STRING_SIZE bytes
+ */
+void evm_format_address(const uint8_t *address, char *out);
+
+/**
+ * @brief Drops the addresses kept by @ref evm_format_address
+ */
+void evm_address_cache_clear(void);
 #endif /* EVM_HELPERS_H */
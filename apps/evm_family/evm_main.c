@@ -62,6 +62,7 @@
 #include "evm_main.h"
 
 #include "evm_context.h"
+#include "evm_helpers.h"
 #include "evm_priv.h"
 #include "status_api.h"
 
@@ -136,6 +137,7 @@ void evm_main(usb_event_t usb_evt, const void *app_config) {
     }
   }
 
+  evm_address_cache_clear();
   g_evm_app = NULL;
   return;
 }
@@ -19,6 +19,7 @@
 #include "events.h"
 #include "evm_api.h"
 #include "evm_context.h"
+#include "sha3.h"
 
 /*****************************************************************************
  * MACROS AND DEFINES
@@ -27,10 +28,11 @@
 #define EVM_TRANSACTION_SIZE_CAP 20480
 
 /**
- * TODO: update the size of msg data same as EVM_TRANSACTION_SIZE_CAP.
- * Constraints : The LVGL buffer cannot handle more than 3Kb data size which
- * puts a limit on how much data can be displayed on the device. Possible fix is
- * to show the long messages in chunks in line with max LVGL buffer size.
+ * Leading bytes of an ETH sign or personal sign message retained for display.
+ * The message itself can be longer as it is digested while it is received.
+ * TODO: The LVGL buffer cannot handle more than 3Kb data size which puts a
+ * limit on how much data can be displayed on the device. Possible fix is to
+ * show the long messages in chunks in line with max LVGL buffer size.
  */
 #define MAX_MSG_DATA_SIZE 3072
 
@@ -53,11 +55,20 @@ typedef struct evm_sign_msg_context {
   /// @brief  Contains initialization data for evm sign msg received from host
   evm_sign_msg_initiate_request_t init;
 
-  /// @brief  Pointer to msg data in raw format, size from init member is
-  /// allocated dynamically with a max size cap of @ref MAX_MSG_DATA_SIZE
+  /// @brief  Pointer to msg data in raw format, allocated dynamically. Holds
+  /// the complete typed data but only the leading @ref MAX_MSG_DATA_SIZE bytes
+  /// of ETH sign or personal sign data
   uint8_t *msg_data;
 
+  /// @brief  Running Keccak-256 of ETH sign or personal sign data, started by
+  /// @ref evm_personal_data_digest_init and updated with each received chunk
+  SHA3_CTX msg_sha3_ctx;
+
   evm_sign_typed_data_struct_t typed_data;
+
+  /// @brief  Allocated only for EVM_SIGN_MSG_TYPE_SIGN_TYPED_DATA_STREAM,
+  /// hashes the typed data nodes as they arrive instead of holding msg_data
+  struct evm_typed_data_stream *typed_stream;
 } evm_sign_msg_context_t;
 
 /*****************************************************************************
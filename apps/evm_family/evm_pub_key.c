@@ -63,7 +63,6 @@
 #include <stddef.h>
 #include <stdint.h>
 
-#include "address.h"
 #include "evm_api.h"
 #include "evm_helpers.h"
 #include "evm_priv.h"
@@ -118,6 +117,13 @@ static bool check_which_request(const evm_query_t *query,
 static bool validate_request_data(evm_get_public_keys_request_t *request,
                                   const pb_size_t which_request);
 
+/**
+ * @brief Accessor of the derivation paths for @ref hd_path_sort_order
+ */
+static const uint32_t *get_derivation_path(const void *paths,
+                                           size_t index,
+                                           size_t *path_length);
+
 /**
  * @details The function provides a public key. It accepts NULL for output
  * parameter and handles accordingly. The function also manages all the terminal
@@ -126,23 +132,44 @@ static bool validate_request_data(evm_get_public_keys_request_t *request,
  * errors/invalid cases are conveyed to the host as unknown_error = 1 because we
  * expect the data validation was success.
  *
- * @param seed Reference to the wallet seed generated from X1 Card
+ * @param cache Reference to the derivation cache of the wallet seed
  * @param path Derivation path of the node to be derived
  * @param path_length Expected length of the provided derivation path
  * @param public_key Storage location for raw uncompressed public key
  *
  * @retval false If derivation failed
  */
-static bool get_public_key(const uint8_t *seed,
+static bool get_public_key(hd_path_cache_t *cache,
                            const uint32_t *path,
                            uint32_t path_length,
                            uint8_t *public_key);
 
+/**
+ * @brief Derives the raw uncompressed public key of a non-hardened child from
+ * the public key of its parent
+ * @details Unlike a private derivation, this needs neither the parent private
+ * key nor a decompression of the resulting compressed public key.
+ *
+ * @param parent Public key of the parent node
+ * @param chain_code Chain code of the parent node
+ * @param index Non-hardened index of the child
+ * @param public_key Storage location for raw uncompressed public key
+ *
+ * @retval false If derivation failed
+ */
+static bool get_child_public_key(const curve_point *parent,
+                                 const uint8_t *chain_code,
+                                 uint32_t index,
+                                 uint8_t *public_key);
+
 /**
  * @brief Derives a list of public key corresponding to the provided list of
  * derivation paths.
  * @details The function expects the size of list for derivation paths and
  * location for storing derived public keys to be a match with provided count.
+ * Paths are derived in sorted order; the parent node is derived once for
+ * consecutive paths which only differ in the last non-hardened index (eg.
+ * m/44'/60'/0'/0/i) and each of these keys is then derived publicly.
  *
  * @param paths Reference to the list of evm_get_public_keys_derivation_path_t
  * @param count Number of derivation paths in the list and consequently,
@@ -278,14 +305,22 @@ static bool validate_request_data(evm_get_public_keys_request_t *request,
   return status;
 }
 
-static bool get_public_key(const uint8_t *seed,
+static const uint32_t *get_derivation_path(const void *paths,
+                                           size_t index,
+                                           size_t *path_length) {
+  const evm_get_public_keys_derivation_path_t *path =
+      (const evm_get_public_keys_derivation_path_t *)paths + index;
+  *path_length = path->path_count;
+  return path->path;
+}
+
+static bool get_public_key(hd_path_cache_t *cache,
                            const uint32_t *path,
                            uint32_t path_length,
                            uint8_t *public_key) {
   HDNode node = {0};
 
-  if (!derive_hdnode_from_path(
-          path, path_length, SECP256K1_NAME, seed, &node)) {
+  if (!hd_path_cache_derive(cache, path, path_length, &node)) {
     // send unknown error; unknown failure reason
     evm_send_error(ERROR_COMMON_ERROR_UNKNOWN_ERROR_TAG, 1);
     memzero(&node, sizeof(HDNode));
@@ -300,18 +335,87 @@ static bool get_public_key(const uint8_t *seed,
   return true;
 }
 
+static bool get_child_public_key(const curve_point *parent,
+                                 const uint8_t *chain_code,
+                                 uint32_t index,
+                                 uint8_t *public_key) {
+  curve_point child = {0};
+
+  if (0 == hdnode_public_ckd_cp(get_curve_by_name(SECP256K1_NAME)->params,
+                                parent,
+                                chain_code,
+                                index,
+                                &child,
+                                NULL)) {
+    // send unknown error; unknown failure reason
+    evm_send_error(ERROR_COMMON_ERROR_UNKNOWN_ERROR_TAG, 1);
+    return false;
+  }
+
+  public_key[0] = 0x04;
+  bn_write_be(&child.x, public_key + 1);
+  bn_write_be(&child.y, public_key + 33);
+  memzero(&child, sizeof(child));
+  return true;
+}
+
 static bool fill_public_keys(const evm_get_public_keys_derivation_path_t *paths,
                              const uint8_t *seed,
                              uint8_t public_keys[][EVM_PUB_KEY_SIZE],
                              pb_size_t count) {
-  for (pb_size_t index = 0; index < count; index++) {
-    const evm_get_public_keys_derivation_path_t *path = &paths[index];
-    if (!get_public_key(
-            seed, path->path, path->path_count, public_keys[index])) {
-      return false;
+  hd_path_cache_t cache = {0};
+  uint16_t order[pb_arraysize(evm_get_public_keys_intiate_request_t,
+                              derivation_paths)] = {0};
+  const evm_get_public_keys_derivation_path_t *parent_of = NULL;
+  curve_point parent = {0};
+  uint8_t chain_code[32] = {0};
+  bool status = true;
+
+  // derive in sorted order so that shared path prefixes are derived once
+  hd_path_cache_init(&cache, SECP256K1_NAME, seed);
+  hd_path_sort_order(paths, count, get_derivation_path, order);
+  for (pb_size_t index = 0; index < count && status; index++) {
+    const evm_get_public_keys_derivation_path_t *current = &paths[order[index]];
+    const pb_size_t depth = current->path_count - 1;
+    uint8_t *public_key = public_keys[order[index]];
+
+    if (!is_non_hardened(current->path[depth])) {
+      status = get_public_key(&cache, current->path, depth + 1, public_key);
+      continue;
     }
+
+    // siblings of the previous path reuse its parent node
+    if (NULL == parent_of || depth + 1 != parent_of->path_count ||
+        0 != memcmp(parent_of->path,
+                    current->path,
+                    depth * sizeof(current->path[0]))) {
+      HDNode node = {0};
+      parent_of = NULL;
+      if (hd_path_cache_derive(&cache, current->path, depth, &node) &&
+          ecdsa_read_pubkey(get_curve_by_name(SECP256K1_NAME)->params,
+                            node.public_key,
+                            &parent)) {
+        memcpy(chain_code, node.chain_code, sizeof(chain_code));
+        parent_of = current;
+      }
+      memzero(&node, sizeof(HDNode));
+
+      if (NULL == parent_of) {
+        // send unknown error; unknown failure reason
+        evm_send_error(ERROR_COMMON_ERROR_UNKNOWN_ERROR_TAG, 1);
+        status = false;
+        break;
+      }
+    }
+
+    status = get_child_public_key(
+        &parent, chain_code, current->path[depth], public_key);
   }
-  return true;
+  hd_path_cache_clear(&cache);
+  memzero(&parent, sizeof(parent));
+  memzero(chain_code, sizeof(chain_code));
+
+  return status;
 }
 
 static bool send_public_keys(evm_query_t *query,
@@ -385,19 +489,13 @@ static bool get_address(const evm_address_format_t format,
     case EVM_HARMONY:
     case EVM_DEFAULT: {
       // check output buffer for enough space
-      if ((EVM_ADDRESS_LENGTH * 2 + 3) > address_size) {
+      if (EVM_ADDRESS_STRING_SIZE > address_size) {
         break;
       }
 
       uint8_t hash[SHA3_256_DIGEST_LENGTH] = {0};
-      address[0] = '0';
-      address[1] = 'x';
-
       keccak_256(&pub_key[1], EVM_PUB_KEY_SIZE - 1, hash);
-      ethereum_address_checksum(&hash[sizeof(hash) - EVM_ADDRESS_LENGTH],
-                                &address[2],
-                                false,
-                                g_evm_app->chain_id);
+      evm_format_address(&hash[sizeof(hash) - EVM_ADDRESS_LENGTH], address);
       status = true;
       break;
     }
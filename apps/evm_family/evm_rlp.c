@@ -0,0 +1,324 @@
+/**
+ * @file    evm_rlp.c
+ * @author  Cypherock X1 Team
+ * @brief   Resumable RLP tokenizer
+ * @copyright Copyright (c) 2023 HODL TECH PTE LTD
+ * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
+ *target=_blank>https://mitcc.org/</a>
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * (c) Copyright 2023 by HODL TECH PTE LTD
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * "Commons Clause" License Condition v1.0
+ *
+ * The Software is provided to you by the Licensor under the License,
+ * as defined below, subject to the following condition.
+ *
+ * Without limiting other conditions in the License, the grant of
+ * rights under the License will not include, and the License does not
+ * grant to you, the right to Sell the Software.
+ *
+ * For purposes of the foregoing, "Sell" means practicing any or all
+ * of the rights granted to you under the License to provide to third
+ * parties, for a fee or other consideration (including without
+ * limitation fees for hosting or consulting/ support services related
+ * to the Software), a product or service whose value derives, entirely
+ * or substantially, from the functionality of the Software. Any license
+ * notice or attribution required by the License must also include
+ * this Commons Clause License Condition notice.
+ *
+ * Software: All X1Wallet associated files.
+ * License: MIT
+ * Licensor: HODL TECH PTE LTD
+ *
+ ******************************************************************************
+ */
+
+/*****************************************************************************
+ * INCLUDES
+ *****************************************************************************/
+
+#include "evm_rlp.h"
+
+#include "memzero.h"
+#include "utils.h"
+
+/*****************************************************************************
+ * EXTERN VARIABLES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * PRIVATE MACROS AND DEFINES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * PRIVATE TYPEDEFS
+ *****************************************************************************/
+
+typedef enum {
+  EVM_RLP_STATE_PREFIX = 0,
+  EVM_RLP_STATE_LENGTH,
+  EVM_RLP_STATE_PAYLOAD,
+  EVM_RLP_STATE_DONE,
+  EVM_RLP_STATE_ERROR,
+} evm_rlp_state_e;
+
+/*****************************************************************************
+ * STATIC FUNCTION PROTOTYPES
+ *****************************************************************************/
+
+/**
+ * @brief Accounts the consumed bytes against each of the open lists
+ *
+ * @param stream Reference to the tokenizer state
+ * @param count Number of bytes consumed
+ *
+ * @return bool Indicating if the bytes fit in the open lists
+ */
+static bool evm_rlp_consume(evm_rlp_stream_t *stream, uint64_t count);
+
+/**
+ * @brief Emits an event for the item at the current depth to the callback
+ *
+ * @param stream Reference to the tokenizer state
+ * @param type Type of the event
+ * @param data Payload bytes for EVM_RLP_EVENT_DATA; NULL otherwise
+ * @param data_len Number of bytes in data
+ *
+ * @return bool Result of the callback
+ */
+static bool evm_rlp_emit(evm_rlp_stream_t *stream,
+                         evm_rlp_event_type_e type,
+                         const uint8_t *data,
+                         size_t data_len);
+
+/**
+ * @brief Handles an item whose prefix (and length) has been consumed
+ *
+ * @param stream Reference to the tokenizer state
+ *
+ * @return bool Indicating if the item is acceptable
+ */
+static bool evm_rlp_begin_item(evm_rlp_stream_t *stream);
+
+/**
+ * @brief Closes the lists which are consumed completely
+ * @details Also moves the tokenizer to the next expected state.
+ *
+ * @param stream Reference to the tokenizer state
+ *
+ * @return bool Result of the callback
+ */
+static bool evm_rlp_close_lists(evm_rlp_stream_t *stream);
+
+/**
+ * @brief Concludes the current string item
+ *
+ * @param stream Reference to the tokenizer state
+ *
+ * @return bool Result of the callback
+ */
+static bool evm_rlp_end_item(evm_rlp_stream_t *stream);
+
+/*****************************************************************************
+ * STATIC VARIABLES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * GLOBAL VARIABLES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * STATIC FUNCTIONS
+ *****************************************************************************/
+
+static bool evm_rlp_consume(evm_rlp_stream_t *stream, uint64_t count) {
+  for (uint8_t level = 0; level < stream->depth; level++) {
+    if (stream->remaining[level] < count) {
+      return false;
+    }
+    stream->remaining[level] -= count;
+  }
+  return true;
+}
+
+static bool evm_rlp_emit(evm_rlp_stream_t *stream,
+                         evm_rlp_event_type_e type,
+                         const uint8_t *data,
+                         size_t data_len) {
+  if (NULL == stream->callback) {
+    return true;
+  }
+
+  const evm_rlp_event_t event = {
+      .type = type,
+      .depth = stream->depth,
+      .index = stream->index[stream->depth],
+      .size = stream->item_size,
+      .data = data,
+      .data_len = data_len,
+      .offset = stream->item_pos,
+  };
+  return stream->callback(stream->ctx, &event);
+}
+
+static bool evm_rlp_begin_item(evm_rlp_stream_t *stream) {
+  stream->item_pos = 0;
+  if (0 < stream->depth &&
+      stream->item_size > stream->remaining[stream->depth - 1]) {
+    return false;
+  }
+
+  if (!stream->is_list) {
+    stream->state = EVM_RLP_STATE_PAYLOAD;
+    if (!evm_rlp_emit(stream, EVM_RLP_EVENT_ITEM, NULL, 0)) {
+      return false;
+    }
+    return (0 == stream->item_size) ? evm_rlp_end_item(stream) : true;
+  }
+
+  if (EVM_RLP_MAX_DEPTH <= stream->depth ||
+      !evm_rlp_emit(stream, EVM_RLP_EVENT_LIST_BEGIN, NULL, 0)) {
+    return false;
+  }
+  stream->remaining[stream->depth] = stream->item_size;
+  stream->depth++;
+  stream->index[stream->depth] = 0;
+  return evm_rlp_close_lists(stream);
+}
+
+static bool evm_rlp_close_lists(evm_rlp_stream_t *stream) {
+  while (0 < stream->depth && 0 == stream->remaining[stream->depth - 1]) {
+    stream->depth--;
+    if (!evm_rlp_emit(stream, EVM_RLP_EVENT_LIST_END, NULL, 0)) {
+      return false;
+    }
+    stream->index[stream->depth]++;
+  }
+
+  stream->state =
+      (0 == stream->depth) ? EVM_RLP_STATE_DONE : EVM_RLP_STATE_PREFIX;
+  return true;
+}
+
+static bool evm_rlp_end_item(evm_rlp_stream_t *stream) {
+  stream->index[stream->depth]++;
+  return evm_rlp_close_lists(stream);
+}
+
+/*****************************************************************************
+ * GLOBAL FUNCTIONS
+ *****************************************************************************/
+
+void evm_rlp_stream_init(evm_rlp_stream_t *stream,
+                         evm_rlp_callback_t callback,
+                         void *ctx) {
+  memzero(stream, sizeof(evm_rlp_stream_t));
+  stream->state = EVM_RLP_STATE_PREFIX;
+  stream->callback = callback;
+  stream->ctx = ctx;
+}
+
+bool evm_rlp_stream_feed(evm_rlp_stream_t *stream,
+                         const uint8_t *data,
+                         size_t size) {
+  size_t offset = 0;
+
+  while (offset < size && EVM_RLP_STATE_ERROR != stream->state) {
+    const uint8_t byte = data[offset];
+    bool status = true;
+
+    switch (stream->state) {
+      case EVM_RLP_STATE_PREFIX:
+        stream->len_bytes = 0;
+        stream->item_size = 0;
+        stream->is_list = (0xc0 <= byte);
+        if (0x7f >= byte) {
+          // single byte is its own payload; consumed as the payload
+          stream->item_size = 1;
+          status = evm_rlp_begin_item(stream);
+          break;
+        }
+
+        offset++;
+        if (!evm_rlp_consume(stream, 1)) {
+          status = false;
+        } else if (0xb7 >= byte) {
+          stream->item_size = byte - 0x80;
+        } else if (0xbf >= byte) {
+          stream->len_bytes = byte - 0xb7;
+        } else if (0xf7 >= byte) {
+          stream->item_size = byte - 0xc0;
+        } else {
+          stream->len_bytes = byte - 0xf7;
+        }
+
+        if (status && 0 < stream->len_bytes) {
+          stream->state = EVM_RLP_STATE_LENGTH;
+        } else if (status) {
+          status = evm_rlp_begin_item(stream);
+        }
+        break;
+
+      case EVM_RLP_STATE_LENGTH:
+        offset++;
+        stream->item_size = (stream->item_size << 8) | byte;
+        status = evm_rlp_consume(stream, 1);
+        if (status && 0 == --stream->len_bytes) {
+          status = evm_rlp_begin_item(stream);
+        }
+        break;
+
+      case EVM_RLP_STATE_PAYLOAD: {
+        const uint64_t count =
+            CY_MIN(size - offset, stream->item_size - stream->item_pos);
+
+        status = evm_rlp_consume(stream, count) &&
+                 evm_rlp_emit(
+                     stream, EVM_RLP_EVENT_DATA, &data[offset], (size_t)count);
+        offset += count;
+        stream->item_pos += count;
+        if (status && stream->item_pos == stream->item_size) {
+          status = evm_rlp_end_item(stream);
+        }
+      } break;
+
+      case EVM_RLP_STATE_DONE:
+      default:
+        // nothing is expected after the top-level item
+        status = false;
+        break;
+    }
+
+    if (!status) {
+      stream->state = EVM_RLP_STATE_ERROR;
+    }
+  }
+  return EVM_RLP_STATE_ERROR != stream->state;
+}
+
+bool evm_rlp_stream_done(const evm_rlp_stream_t *stream) {
+  return EVM_RLP_STATE_DONE == stream->state;
+}
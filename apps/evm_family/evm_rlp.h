@@ -0,0 +1,135 @@
+/**
+ * @file    evm_rlp.h
+ * @author  Cypherock X1 Team
+ * @brief   Resumable RLP tokenizer
+ * @copyright Copyright (c) 2023 HODL TECH PTE LTD
+ * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
+ * target=_blank>https://mitcc.org/</a>
+ */
+#ifndef EVM_RLP_H
+#define EVM_RLP_H
+
+/*****************************************************************************
+ * INCLUDES
+ *****************************************************************************/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*****************************************************************************
+ * MACROS AND DEFINES
+ *****************************************************************************/
+
+/// Maximum nesting of lists (including the outermost) that can be tokenized
+#define EVM_RLP_MAX_DEPTH 4
+
+/*****************************************************************************
+ * TYPEDEFS
+ *****************************************************************************/
+
+typedef enum {
+  /// A string item begins; event.size holds its payload size
+  EVM_RLP_EVENT_ITEM = 0,
+  /// Next payload bytes of the current string item
+  EVM_RLP_EVENT_DATA,
+  /// A list begins; event.size holds its payload size
+  EVM_RLP_EVENT_LIST_BEGIN,
+  /// The list at event.depth & event.index is complete
+  EVM_RLP_EVENT_LIST_END,
+} evm_rlp_event_type_e;
+
+/**
+ * @brief Token emitted by the tokenizer
+ * @details The payload of a string item can be split across any number of
+ * EVM_RLP_EVENT_DATA events depending on how the encoding was fed.
+ */
+typedef struct {
+  evm_rlp_event_type_e type;
+  /// number of lists enclosing the item; 0 for the top-level item
+  uint8_t depth;
+  /// index of the item in its enclosing list
+  uint32_t index;
+  /// payload size of the item (for ITEM & LIST_BEGIN)
+  uint64_t size;
+  /// payload bytes & their offset in the payload of the item (for DATA)
+  const uint8_t *data;
+  size_t data_len;
+  uint64_t offset;
+} evm_rlp_event_t;
+
+/**
+ * @brief Consumer of the tokenizer events
+ *
+ * @return bool Indicating if the tokenizer should continue; returning false
+ * fails the feed with an error
+ */
+typedef bool (*evm_rlp_callback_t)(void *ctx, const evm_rlp_event_t *event);
+
+/**
+ * @brief State of the resumable RLP tokenizer
+ * @details The tokenizer consumes exactly one top-level item which can be fed
+ * in chunks of any size. Nothing other than the state is retained, so the
+ * encoding can be dropped as soon as it is fed.
+ */
+typedef struct {
+  uint8_t state;
+  /// bytes left to read of a long-form length
+  uint8_t len_bytes;
+  bool is_list;
+  /// number of currently open lists
+  uint8_t depth;
+  uint64_t item_size;
+  uint64_t item_pos;
+  /// bytes left in each of the open lists
+  uint64_t remaining[EVM_RLP_MAX_DEPTH];
+  /// index of the next item at each depth
+  uint32_t index[EVM_RLP_MAX_DEPTH + 1];
+  evm_rlp_callback_t callback;
+  void *ctx;
+} evm_rlp_stream_t;
+
+/*****************************************************************************
+ * EXPORTED VARIABLES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * GLOBAL FUNCTION PROTOTYPES
+ *****************************************************************************/
+
+/**
+ * @brief Initializes the tokenizer
+ *
+ * @param [out] stream Reference to the tokenizer state
+ * @param [in] callback Consumer of the emitted events
+ * @param [in] ctx Opaque reference passed to the callback
+ */
+void evm_rlp_stream_init(evm_rlp_stream_t *stream,
+                         evm_rlp_callback_t callback,
+                         void *ctx);
+
+/**
+ * @brief Tokenizes the next chunk of the RLP encoding
+ *
+ * @param stream Reference to the tokenizer state
+ * @param [in] data Next bytes of the encoding
+ * @param [in] size Number of bytes in data
+ *
+ * @return bool Indicating if the bytes so far form a well-formed encoding
+ * @retval false If an item overruns its enclosing list, lists nest deeper than
+ * EVM_RLP_MAX_DEPTH, bytes follow the top-level item or the callback failed
+ */
+bool evm_rlp_stream_feed(evm_rlp_stream_t *stream,
+                         const uint8_t *data,
+                         size_t size);
+
+/**
+ * @brief Checks if the top-level item was consumed completely
+ *
+ * @param stream Reference to the tokenizer state
+ *
+ * @return bool Indicating if the encoding is complete
+ */
+bool evm_rlp_stream_done(const evm_rlp_stream_t *stream);
+
+#endif    // EVM_RLP_H
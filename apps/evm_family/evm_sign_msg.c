@@ -70,9 +70,11 @@
 #include "evm_typed_data_helper.h"
 #include "pb_decode.h"
 #include "reconstruct_wallet_flow.h"
+#include "session_bench.h"
 #include "status_api.h"
 #include "ui_core_confirm.h"
 #include "ui_screens.h"
+#include "utils.h"
 #include "wallet_list.h"
 /*****************************************************************************
  * EXTERN VARIABLES
@@ -81,6 +83,8 @@
 /*****************************************************************************
  * PRIVATE MACROS AND DEFINES
  *****************************************************************************/
+/// Appended to the displayed message when only its leading part was retained
+#define EVM_MSG_TRUNCATION_MARK "..."
 
 /*****************************************************************************
  * PRIVATE TYPEDEFS
@@ -132,6 +136,16 @@ static bool validate_initiate_query(evm_sign_msg_initiate_request_t *init_req);
  */
 static bool handle_initiate_query(evm_query_t *query);
 
+/**
+ * @brief Returns the number of leading message bytes held in msg_data
+ * @details Typed data is decoded as a whole hence retained completely. ETH sign
+ * and personal sign data is digested as it is received and only the part that
+ * is displayed is retained.
+ *
+ * @return uint32_t Size of msg_data excluding the NULL terminator
+ */
+static uint32_t get_msg_retain_size();
+
 /**
  * @brief This function is responsible for retrieving and assembling message
  * data chunks for signing.
@@ -143,6 +157,16 @@ static bool handle_initiate_query(evm_query_t *query);
  */
 static bool get_msg_data(evm_query_t *query);
 
+/**
+ * @brief Displays a node of the typed data stream for user verification
+ *
+ * @param title Title of the node (path & name)
+ * @param value Display string of the node
+ *
+ * @return bool Indicating if the user accepted the node
+ */
+static bool display_typed_data_node(const char *title, const char *value);
+
 /**
  * @brief This function checks the message type and displays the message data
  * for verification.
@@ -202,13 +226,16 @@ static bool check_which_request(const evm_query_t *query,
 }
 
 static bool validate_initiate_query(evm_sign_msg_initiate_request_t *init_req) {
-  uint32_t size_limit = MAX_MSG_DATA_SIZE;
+  // only typed data is retained whole; other messages are digested as they
+  // are received and typed data streams bound each node separately
+  uint32_t size_limit = UINT32_MAX;
 
   switch (init_req->message_type) {
     case EVM_SIGN_MSG_TYPE_SIGN_TYPED_DATA:
       size_limit = MAX_MSG_DATA_TYPED_DATA_SIZE;
     case EVM_SIGN_MSG_TYPE_ETH_SIGN:
     case EVM_SIGN_MSG_TYPE_PERSONAL_SIGN:
+    case EVM_SIGN_MSG_TYPE_SIGN_TYPED_DATA_STREAM:
 
       if (!evm_derivation_path_guard(init_req->derivation_path,
                                      init_req->derivation_path_count)) {
@@ -271,6 +298,13 @@ static bool handle_initiate_query(evm_query_t *query) {
   return true;
 }
 
+static uint32_t get_msg_retain_size() {
+  if (EVM_SIGN_MSG_TYPE_SIGN_TYPED_DATA == sign_msg_ctx.init.message_type) {
+    return sign_msg_ctx.init.total_msg_size;
+  }
+  return CY_MIN(sign_msg_ctx.init.total_msg_size, MAX_MSG_DATA_SIZE);
+}
+
 static bool get_msg_data(evm_query_t *query) {
   evm_result_t response = init_evm_result(EVM_RESULT_SIGN_MSG_TAG);
   uint32_t total_size = sign_msg_ctx.init.total_msg_size;
@@ -279,14 +313,33 @@ static bool get_msg_data(evm_query_t *query) {
   const common_chunk_payload_chunk_t *chunk = &(payload->chunk);
 
   uint32_t size = 0;
+  const uint32_t retain_size = get_msg_retain_size();
+  bool digest_on_arrival = false;
+  evm_typed_data_stream_t *typed_stream = NULL;
+
+  if (EVM_SIGN_MSG_TYPE_SIGN_TYPED_DATA_STREAM ==
+      sign_msg_ctx.init.message_type) {
+    // nodes are verified & hashed on arrival; msg_data is not needed
+    typed_stream = malloc(sizeof(evm_typed_data_stream_t));
+    ASSERT(NULL != typed_stream);
+    evm_typed_data_stream_init(typed_stream, display_typed_data_node);
+    sign_msg_ctx.typed_stream = typed_stream;
+  } else {
+    if (EVM_SIGN_MSG_TYPE_SIGN_TYPED_DATA != sign_msg_ctx.init.message_type) {
+      // digested on arrival; only the displayed part needs to be retained
+      evm_personal_data_digest_init(&sign_msg_ctx.msg_sha3_ctx, total_size);
+      digest_on_arrival = true;
+    }
 
-  /**
-   * Allocate required memory for message size +1. Extra byte is used to add a
-   * NULL character at the end of the msg data in case it'll be used as a string
-   */
-  sign_msg_ctx.msg_data = malloc(sign_msg_ctx.init.total_msg_size + 1);
-  ASSERT(NULL != sign_msg_ctx.msg_data);
-  sign_msg_ctx.msg_data[sign_msg_ctx.init.total_msg_size] = '\0';
+    /**
+     * Allocate required memory for retained size +1. Extra byte is used to add
+     * a NULL character at the end of the msg data in case it'll be used as a
+     * string
+     */
+    sign_msg_ctx.msg_data = malloc(retain_size + 1);
+    ASSERT(NULL != sign_msg_ctx.msg_data);
+    sign_msg_ctx.msg_data[retain_size] = '\0';
+  }
 
   while (1) {
     // Get next data chunk from host
@@ -303,7 +356,24 @@ static bool get_msg_data(evm_query_t *query) {
       return false;
     }
 
-    memcpy(sign_msg_ctx.msg_data + size, chunk->bytes, chunk->size);
+    if (NULL == typed_stream) {
+      if (size < retain_size) {
+        memcpy(sign_msg_ctx.msg_data + size,
+               chunk->bytes,
+               CY_MIN(chunk->size, retain_size - size));
+      }
+      if (digest_on_arrival) {
+        keccak_Update(&sign_msg_ctx.msg_sha3_ctx, chunk->bytes, chunk->size);
+      }
+    } else if (!evm_typed_data_stream_feed(
+                   typed_stream, chunk->bytes, chunk->size)) {
+      // user rejection is already reported by the confirmation screen
+      if (!typed_stream->aborted) {
+        evm_send_error(ERROR_COMMON_ERROR_CORRUPT_DATA_TAG,
+                       ERROR_DATA_FLOW_INVALID_DATA);
+      }
+      return false;
+    }
     size += chunk->size;
 
     // Send chunk ack to host
@@ -343,18 +413,30 @@ static bool get_msg_data(evm_query_t *query) {
   return true;
 }
 
+static bool display_typed_data_node(const char *title, const char *value) {
+  return core_scroll_page(title, value, evm_send_error);
+}
+
 static bool get_user_verification() {
   bool result = false;
+  // only the leading part of ETH sign & personal sign data is retained
+  const uint32_t display_size = get_msg_retain_size();
+  const bool truncated = display_size < sign_msg_ctx.init.total_msg_size;
+
   switch (sign_msg_ctx.init.message_type) {
     case EVM_SIGN_MSG_TYPE_ETH_SIGN: {
-      const size_t array_size = sign_msg_ctx.init.total_msg_size * 2 + 3;
+      const size_t array_size =
+          display_size * 2 + 3 + sizeof(EVM_MSG_TRUNCATION_MARK) - 1;
       char *buffer = malloc(array_size);
       memzero(buffer, array_size);
       snprintf(buffer, array_size, "0x");
-      byte_array_to_hex_string(sign_msg_ctx.msg_data,
-                               sign_msg_ctx.init.total_msg_size,
-                               buffer + 2,
-                               array_size - 2);
+      byte_array_to_hex_string(
+          sign_msg_ctx.msg_data, display_size, buffer + 2, array_size - 2);
+      if (truncated) {
+        strncat(buffer,
+                EVM_MSG_TRUNCATION_MARK,
+                array_size - strnlen(buffer, array_size) - 1);
+      }
       // TODO: Add a limit on size of data per confirmation based on LVGL buffer
       // and split message into multiple confirmations accordingly
       result = core_scroll_page(
@@ -366,7 +448,7 @@ static bool get_user_verification() {
     case EVM_SIGN_MSG_TYPE_PERSONAL_SIGN: {
       // TODO: Add a limit on size of data per confirmation based on LVGL buffer
       // and split message into multiple confirmations accordingly
-      size_t len = 4 * sign_msg_ctx.init.total_msg_size;
+      size_t len = 4 * display_size + sizeof(EVM_MSG_TRUNCATION_MARK);
       char *escaped_str = malloc(len);
       uint8_t status = string_to_escaped_string(
           (const char *)sign_msg_ctx.msg_data, escaped_str, len);
@@ -375,11 +457,21 @@ static bool get_user_verification() {
         result = false;
         break;
       }
+      if (truncated) {
+        strncat(escaped_str,
+                EVM_MSG_TRUNCATION_MARK,
+                len - strnlen(escaped_str, len) - 1);
+      }
       result =
           core_scroll_page(UI_TEXT_VERIFY_MESSAGE, escaped_str, evm_send_error);
       free(escaped_str);
     } break;
 
+    case EVM_SIGN_MSG_TYPE_SIGN_TYPED_DATA_STREAM:
+      // every node was verified as it was received
+      result = (2 == sign_msg_ctx.typed_stream->roots_done);
+      break;
+
     case EVM_SIGN_MSG_TYPE_SIGN_TYPED_DATA: {
       ui_display_node *display_node = NULL;
       evm_init_typed_data_display_node(&display_node,
@@ -414,6 +506,7 @@ static bool get_msg_data_signature(evm_sign_msg_signature_response_t *sig) {
   const uint32_t *hd_path = sign_msg_ctx.init.derivation_path;
   const ecdsa_curve *curve = get_curve_by_name(SECP256K1_NAME)->params;
 
+  SESSION_BENCH_ENTER(SESSION_PHASE_DERIVATION);
   if (!reconstruct_seed(sign_msg_ctx.init.wallet_id, buffer, evm_send_error)) {
     memzero(buffer, sizeof(buffer));
     return status;
@@ -431,14 +524,17 @@ static bool get_msg_data_signature(evm_sign_msg_signature_response_t *sig) {
     evm_send_error(ERROR_COMMON_ERROR_CORRUPT_DATA_TAG,
                    ERROR_DATA_FLOW_INVALID_DATA);
   } else {
-    status = true;
-    if (!evm_get_msg_data_digest(&sign_msg_ctx, buffer) ||
+    SESSION_BENCH_ENTER(SESSION_PHASE_HASHING);
+    status = evm_get_msg_data_digest(&sign_msg_ctx, buffer);
+    SESSION_BENCH_ENTER(SESSION_PHASE_SIGNING);
+    if (!status ||
         (0 != ecdsa_sign_digest(
                   curve, node.private_key, buffer, sig->r, sig->v, NULL))) {
       evm_send_error(ERROR_COMMON_ERROR_UNKNOWN_ERROR_TAG, 1);
       status = false;
     }
   }
+  SESSION_BENCH_ENTER(SESSION_PHASE_OTHER);
   memzero(&node, sizeof(HDNode));
   return status;
 }
@@ -475,11 +571,18 @@ void evm_sign_msg(evm_query_t *query) {
   }
 
   if (NULL != sign_msg_ctx.msg_data) {
-    memzero(sign_msg_ctx.msg_data, sign_msg_ctx.init.total_msg_size);
+    memzero(sign_msg_ctx.msg_data, get_msg_retain_size());
     free(sign_msg_ctx.msg_data);
     sign_msg_ctx.msg_data = NULL;
   }
 
+  if (NULL != sign_msg_ctx.typed_stream) {
+    evm_typed_data_stream_clear(sign_msg_ctx.typed_stream);
+    free(sign_msg_ctx.typed_stream);
+    sign_msg_ctx.typed_stream = NULL;
+  }
+
+  memzero(&sign_msg_ctx.msg_sha3_ctx, sizeof(sign_msg_ctx.msg_sha3_ctx));
   sign_msg_ctx.init.total_msg_size = 0;
 
   /**
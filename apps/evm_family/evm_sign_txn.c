@@ -66,7 +66,9 @@
 #include "evm_priv.h"
 #include "evm_user_verification.h"
 #include "reconstruct_wallet_flow.h"
+#include "session_bench.h"
 #include "status_api.h"
+#include "txn_pool.h"
 #include "ui_core_confirm.h"
 #include "ui_screens.h"
 #include "wallet_list.h"
@@ -144,8 +146,9 @@ STATIC bool handle_initiate_query(const evm_query_t *query);
 /**
  * @brief Fetches complete raw transaction to be signed for verification
  * @details The function will try to fetch the transaction by referring to the
- * declared size in evm_txn_context. The function will store complete
- * transaction into evm_txn_context.transaction.
+ * declared size in evm_txn_context. Each chunk is digested and decoded as it
+ * arrives (refer evm_txn_stream_update) so the complete transaction is never
+ * held in memory.
  *
  * @param query Reference to an instance of evm_query_t for storing the
  * transient transaction chunks.
@@ -234,9 +237,9 @@ static bool validate_request_data(const evm_sign_txn_request_t *request) {
     status = false;
   }
 
-  /* hard limit on the transaction size that can be fetched and kept in RAM.
-   * this limit can be removed once the RLP decoder can operate on running
-   * transaction buffer stream and get user confirmations on the go
+  /* hard limit on the transaction size that can be signed. the transaction is
+   * decoded as a stream and only its leading data is kept in RAM, hence this
+   * limit only bounds the time spent in receiving the transaction
    */
   if (EVM_TRANSACTION_SIZE_CAP < request->initiate.transaction_size) {
     evm_send_error(ERROR_COMMON_ERROR_CORRUPT_DATA_TAG,
@@ -294,8 +297,7 @@ STATIC bool fetch_valid_transaction(evm_query_t *query) {
 
   result.sign_txn.which_response = EVM_SIGN_TXN_RESPONSE_DATA_ACCEPTED_TAG;
   result.sign_txn.data_accepted.has_chunk_ack = true;
-  // allocate memory for storing transaction
-  txn_context->transaction = (uint8_t *)malloc(total_size);
+  evm_txn_stream_init(txn_context);
   while (true) {
     if (!evm_get_query(query, EVM_QUERY_SIGN_TXN_TAG) ||
         !check_which_request(query, EVM_SIGN_TXN_REQUEST_TXN_DATA_TAG)) {
@@ -309,7 +311,11 @@ STATIC bool fetch_valid_transaction(evm_query_t *query) {
       return status;
     }
 
-    memcpy(&txn_context->transaction[size], chunk->bytes, chunk->size);
+    if (!evm_txn_stream_update(txn_context, chunk->bytes, chunk->size)) {
+      evm_send_error(ERROR_COMMON_ERROR_CORRUPT_DATA_TAG,
+                     ERROR_DATA_FLOW_INVALID_DATA);
+      return status;
+    }
     size += chunk->size;
     result.sign_txn.data_accepted.chunk_ack.chunk_index = payload->chunk_index;
     evm_send_result(&result);
@@ -326,8 +332,7 @@ STATIC bool fetch_valid_transaction(evm_query_t *query) {
     return status;
   }
   // decode and verify the received transaction
-  if (0 != evm_decode_unsigned_txn(
-               txn_context->transaction, total_size, txn_context) ||
+  if (0 != evm_txn_stream_final(txn_context) ||
       EVM_TXN_INVALID_DATA == txn_context->txn_type ||
       !evm_validate_unsigned_txn(txn_context)) {
     evm_send_error(ERROR_COMMON_ERROR_CORRUPT_DATA_TAG,
@@ -376,6 +381,7 @@ static bool sign_transaction(evm_sign_txn_signature_response_t *sig) {
   const uint32_t *hd_path = txn_context->init_info.derivation_path;
   const ecdsa_curve *curve = get_curve_by_name(SECP256K1_NAME)->params;
 
+  SESSION_BENCH_ENTER(SESSION_PHASE_DERIVATION);
   if (!reconstruct_seed(
           txn_context->init_info.wallet_id, buffer, evm_send_error)) {
     memzero(buffer, sizeof(buffer));
@@ -392,16 +398,17 @@ static bool sign_transaction(evm_sign_txn_signature_response_t *sig) {
                    ERROR_DATA_FLOW_INVALID_DATA);
   } else {
     status = true;
-    keccak_256(txn_context->transaction,
-               txn_context->init_info.transaction_size,
-               buffer);
+    SESSION_BENCH_ENTER(SESSION_PHASE_HASHING);
+    keccak_Final(&txn_context->sha3_ctx, buffer);
 
+    SESSION_BENCH_ENTER(SESSION_PHASE_SIGNING);
     if (0 != ecdsa_sign_digest(
                  curve, node.private_key, buffer, sig->r, sig->v, NULL)) {
       evm_send_error(ERROR_COMMON_ERROR_UNKNOWN_ERROR_TAG, 1);
       status = false;
     }
   }
+  SESSION_BENCH_ENTER(SESSION_PHASE_OTHER);
   memzero(&node, sizeof(HDNode));
   return status;
 }
@@ -427,8 +434,8 @@ static bool send_signature(evm_query_t *query,
  *****************************************************************************/
 
 void evm_sign_transaction(evm_query_t *query) {
-  txn_context = (evm_txn_context_t *)malloc(sizeof(evm_txn_context_t));
-  memzero(txn_context, sizeof(evm_txn_context_t));
+  txn_context = TXN_POOL_NEW(evm_txn_context_t, 1);
+  ASSERT(NULL != txn_context);
   evm_sign_txn_signature_response_t sig = {0};
 
   if (handle_initiate_query(query) && fetch_valid_transaction(query) &&
@@ -437,11 +444,6 @@ void evm_sign_transaction(evm_query_t *query) {
     delay_scr_init(ui_text_check_cysync, DELAY_TIME);
   }
 
-  if (NULL != txn_context->transaction) {
-    free(txn_context->transaction);
-  }
-  if (NULL != txn_context) {
-    free(txn_context);
-    txn_context = NULL;
-  }
+  txn_pool_release();
+  txn_context = NULL;
 }
\ No newline at end of file
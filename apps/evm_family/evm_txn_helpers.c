@@ -64,6 +64,7 @@
 #include "evm_txn_helpers.h"
 
 #include "evm_priv.h"
+#include "evm_rlp.h"
 #include "int-util.h"
 
 /*****************************************************************************
@@ -78,26 +79,76 @@
  * PRIVATE TYPEDEFS
  *****************************************************************************/
 
+/// Fields of the unsigned transaction list decoded into evm_unsigned_txn
+typedef enum {
+  EVM_TXN_FIELD_NONCE = 0,
+  EVM_TXN_FIELD_GAS_PRICE,
+  EVM_TXN_FIELD_GAS_LIMIT,
+  EVM_TXN_FIELD_TO,
+  EVM_TXN_FIELD_VALUE,
+  EVM_TXN_FIELD_DATA,
+  EVM_TXN_FIELD_CHAIN_ID,
+  /// only digested (e.g. signature placeholders, access list)
+  EVM_TXN_FIELD_SKIP,
+} evm_txn_field_e;
+
+/// Order of the fields in the unsigned transaction list of an envelope
+typedef struct {
+  const uint8_t *fields;
+  /// number of fields that must be present
+  uint8_t count;
+} evm_txn_layout_t;
+
 /*****************************************************************************
  * STATIC FUNCTION PROTOTYPES
  *****************************************************************************/
 
 /**
- * @brief Get the RLP decoded data, length, type.
- * @details
+ * @brief Returns the field layout of the transaction envelope
  *
- * @param [in] seq          Sequence of bytes of RLP encoded data.
- * @param [in] seq_len      Length of RLP decoded data.
- * @param [out] decoded_len  Size of length.
- * @param [out] type         Type of data (LIST or STRING)
+ * @param envelope EIP-2718 transaction type or EVM_TXN_ENVELOPE_LEGACY
  *
- * @return Length of bytes after length.
- * @retval
+ * @return const evm_txn_layout_t* Layout of the unsigned transaction list;
+ * NULL if the envelope is not supported
  */
-static uint64_t get_decode_length(const uint8_t *seq,
-                                  const uint64_t seq_len,
-                                  uint64_t *decoded_len,
-                                  seq_type *type);
+static const evm_txn_layout_t *evm_txn_get_layout(uint8_t envelope);
+
+/**
+ * @brief Returns the storage and capacity for the field
+ *
+ * @param txn_context Reference to the transaction context
+ * @param field The field being decoded
+ * @param [out] capacity Number of bytes that can be stored
+ *
+ * @return uint8_t* Storage for the field; NULL if the field is skipped
+ */
+static uint8_t *evm_txn_field_buffer(evm_txn_context_t *txn_context,
+                                     evm_txn_field_e field,
+                                     uint64_t *capacity);
+
+/**
+ * @brief Validates the size of the field whose payload begins and records the
+ * size wherever required
+ *
+ * @param txn_context Reference to the transaction context
+ * @param field The field being decoded
+ * @param size Payload size of the field
+ *
+ * @return bool Indicating if the field is acceptable
+ */
+static bool evm_txn_begin_field(evm_txn_context_t *txn_context,
+                                evm_txn_field_e field,
+                                uint64_t size);
+
+/**
+ * @brief Consumer of the RLP tokens of the unsigned transaction
+ *
+ * @param ctx Reference to the transaction context
+ * @param event The RLP token
+ *
+ * @return bool Indicating if the token is acceptable
+ */
+static bool evm_txn_rlp_event(void *ctx, const evm_rlp_event_t *event);
 
 /**
  * @brief
@@ -112,6 +163,45 @@ static EVM_TRANSACTION_TYPE evm_decode_transaction_type(
  * STATIC VARIABLES
  *****************************************************************************/
 
+/// [nonce, gasPrice, gasLimit, to, value, data, chainId, r, s] (EIP-155)
+static const uint8_t legacy_fields[] = {EVM_TXN_FIELD_NONCE,
+                                        EVM_TXN_FIELD_GAS_PRICE,
+                                        EVM_TXN_FIELD_GAS_LIMIT,
+                                        EVM_TXN_FIELD_TO,
+                                        EVM_TXN_FIELD_VALUE,
+                                        EVM_TXN_FIELD_DATA,
+                                        EVM_TXN_FIELD_CHAIN_ID};
+
+/// [chainId, nonce, gasPrice, gasLimit, to, value, data, accessList]
+static const uint8_t eip2930_fields[] = {EVM_TXN_FIELD_CHAIN_ID,
+                                         EVM_TXN_FIELD_NONCE,
+                                         EVM_TXN_FIELD_GAS_PRICE,
+                                         EVM_TXN_FIELD_GAS_LIMIT,
+                                         EVM_TXN_FIELD_TO,
+                                         EVM_TXN_FIELD_VALUE,
+                                         EVM_TXN_FIELD_DATA,
+                                         EVM_TXN_FIELD_SKIP};
+
+/**
+ * [chainId, nonce, maxPriorityFeePerGas, maxFeePerGas, gasLimit, to, value,
+ * data, accessList]; maxFeePerGas is decoded as the gas price to bound the fee
+ */
+static const uint8_t eip1559_fields[] = {EVM_TXN_FIELD_CHAIN_ID,
+                                         EVM_TXN_FIELD_NONCE,
+                                         EVM_TXN_FIELD_SKIP,
+                                         EVM_TXN_FIELD_GAS_PRICE,
+                                         EVM_TXN_FIELD_GAS_LIMIT,
+                                         EVM_TXN_FIELD_TO,
+                                         EVM_TXN_FIELD_VALUE,
+                                         EVM_TXN_FIELD_DATA,
+                                         EVM_TXN_FIELD_SKIP};
+
+static const evm_txn_layout_t layouts[] = {
+    [EVM_TXN_ENVELOPE_LEGACY] = {legacy_fields, sizeof(legacy_fields)},
+    [EVM_TXN_ENVELOPE_EIP2930] = {eip2930_fields, sizeof(eip2930_fields)},
+    [EVM_TXN_ENVELOPE_EIP1559] = {eip1559_fields, sizeof(eip1559_fields)},
+};
+
 /*****************************************************************************
  * GLOBAL VARIABLES
  *****************************************************************************/
@@ -120,52 +210,134 @@ static EVM_TRANSACTION_TYPE evm_decode_transaction_type(
  * STATIC FUNCTIONS
  *****************************************************************************/
 
-static uint64_t get_decode_length(const uint8_t *seq,
-                                  const uint64_t seq_len,
-                                  uint64_t *decoded_len,
-                                  seq_type *type) {
-  uint8_t first_byte = *seq;
-  uint64_t item_bytes_len = 0;
-  if (first_byte <= 0x7f) {
-    item_bytes_len = 1;
-    *type = STRING;
-    *decoded_len = 0;
-  } else if (first_byte <= 0xb7 && seq_len > (first_byte - 0x80)) {
-    item_bytes_len = first_byte - 0x80;
-    *type = STRING;
-    *decoded_len = 1;
-  } else if (first_byte <= 0xbf && seq_len > (first_byte - 0xb7)) {
-    uint8_t len = first_byte - 0xb7;
-    uint8_t buffer_len[len];
-    char hex_len[len * 2 + 1];
-    hex_len[len * 2] = '\0';
-    *decoded_len = 1;
-    memcpy(buffer_len, seq + *decoded_len, len);
-    *decoded_len += len;
-    byte_array_to_hex_string(buffer_len, len, hex_len, sizeof(hex_len));
-    item_bytes_len = hex2dec(hex_len);
-    *type = STRING;
-  } else if (first_byte <= 0xf7 && seq_len > (first_byte - 0xc0)) {
-    item_bytes_len = first_byte - 0xc0;
-    *type = LIST;
-    *decoded_len = 1;
-  } else if (first_byte <= 0xff && seq_len > (first_byte - 0xf7)) {
-    uint8_t len = first_byte - 0xf7;
-    uint8_t buffer_len[len];
-    char hex_len[len * 2 + 1];
-    hex_len[len * 2] = '\0';
-
-    *decoded_len = 1;
-    memcpy(buffer_len, seq + *decoded_len, len);
-    *decoded_len += len;
-    byte_array_to_hex_string(buffer_len, len, hex_len, sizeof(hex_len));
-    item_bytes_len = hex2dec(hex_len);
-    *type = LIST;
-  } else {
-    // Intentionally unimplemented...
+static const evm_txn_layout_t *evm_txn_get_layout(uint8_t envelope) {
+  if (sizeof(layouts) / sizeof(layouts[0]) <= envelope) {
+    return NULL;
+  }
+  return &layouts[envelope];
+}
+
+static uint8_t *evm_txn_field_buffer(evm_txn_context_t *txn_context,
+                                     evm_txn_field_e field,
+                                     uint64_t *capacity) {
+  evm_unsigned_txn *utxn_ptr = &txn_context->transaction_info;
+  uint8_t *buffer = NULL;
+  *capacity = 0;
+
+  switch (field) {
+    case EVM_TXN_FIELD_NONCE:
+      buffer = utxn_ptr->nonce;
+      *capacity = sizeof(utxn_ptr->nonce);
+      break;
+    case EVM_TXN_FIELD_GAS_PRICE:
+      buffer = utxn_ptr->gas_price;
+      *capacity = sizeof(utxn_ptr->gas_price);
+      break;
+    case EVM_TXN_FIELD_GAS_LIMIT:
+      buffer = utxn_ptr->gas_limit;
+      *capacity = sizeof(utxn_ptr->gas_limit);
+      break;
+    case EVM_TXN_FIELD_TO:
+      buffer = utxn_ptr->to_address;
+      *capacity = sizeof(utxn_ptr->to_address);
+      break;
+    case EVM_TXN_FIELD_VALUE:
+      buffer = utxn_ptr->value;
+      *capacity = sizeof(utxn_ptr->value);
+      break;
+    case EVM_TXN_FIELD_DATA:
+      buffer = txn_context->data;
+      *capacity = sizeof(txn_context->data);
+      break;
+    case EVM_TXN_FIELD_CHAIN_ID:
+      buffer = utxn_ptr->chain_id;
+      *capacity = sizeof(utxn_ptr->chain_id);
+      break;
+    case EVM_TXN_FIELD_SKIP:
+    default:
+      break;
+  }
+  return buffer;
+}
+
+static bool evm_txn_begin_field(evm_txn_context_t *txn_context,
+                                evm_txn_field_e field,
+                                uint64_t size) {
+  evm_unsigned_txn *utxn_ptr = &txn_context->transaction_info;
+  const uint8_t size_byte = (uint8_t)CY_MAX(1, size);
+  uint64_t capacity = 0;
+
+  if (NULL == evm_txn_field_buffer(txn_context, field, &capacity)) {
+    return true;
   }
 
-  return item_bytes_len;
+  switch (field) {
+    case EVM_TXN_FIELD_NONCE:
+      utxn_ptr->nonce_size[0] = size_byte;
+      break;
+    case EVM_TXN_FIELD_GAS_PRICE:
+      utxn_ptr->gas_price_size[0] = size_byte;
+      break;
+    case EVM_TXN_FIELD_GAS_LIMIT:
+      utxn_ptr->gas_limit_size[0] = size_byte;
+      break;
+    case EVM_TXN_FIELD_VALUE:
+      utxn_ptr->value_size[0] = size_byte;
+      break;
+    case EVM_TXN_FIELD_DATA:
+      // data beyond the retained bytes is only digested
+      utxn_ptr->data_size = size;
+      utxn_ptr->data = txn_context->data;
+      return true;
+    case EVM_TXN_FIELD_CHAIN_ID:
+      utxn_ptr->chain_id_size[0] = size_byte;
+      break;
+    default:
+      break;
+  }
+  return size <= capacity;
+}
+
+static bool evm_txn_rlp_event(void *ctx, const evm_rlp_event_t *event) {
+  evm_txn_context_t *txn_context = (evm_txn_context_t *)ctx;
+  evm_txn_stream_t *stream = &txn_context->stream;
+  const evm_txn_layout_t *layout = evm_txn_get_layout(stream->envelope);
+
+  if (0 == event->depth) {
+    // the unsigned transaction must be a list
+    return EVM_RLP_EVENT_LIST_BEGIN == event->type ||
+           EVM_RLP_EVENT_LIST_END == event->type;
+  }
+  if (1 < event->depth || EVM_RLP_EVENT_LIST_END == event->type) {
+    // contents of skipped fields (e.g. access list entries)
+    return true;
+  }
+
+  const evm_txn_field_e field = (event->index < layout->count)
+                                    ? layout->fields[event->index]
+                                    : EVM_TXN_FIELD_SKIP;
+  stream->field_count = event->index + 1;
+  switch (event->type) {
+    case EVM_RLP_EVENT_LIST_BEGIN:
+      return EVM_TXN_FIELD_SKIP == field;
+
+    case EVM_RLP_EVENT_ITEM:
+      return evm_txn_begin_field(txn_context, field, event->size);
+
+    case EVM_RLP_EVENT_DATA: {
+      uint64_t capacity = 0;
+      uint8_t *buffer = evm_txn_field_buffer(txn_context, field, &capacity);
+      if (NULL != buffer && event->offset < capacity) {
+        memcpy(buffer + event->offset,
+               event->data,
+               CY_MIN(event->data_len, capacity - event->offset));
+      }
+      return true;
+    }
+
+    default:
+      return true;
+  }
 }
 
 static EVM_TRANSACTION_TYPE evm_decode_transaction_type(
@@ -181,19 +353,26 @@ static EVM_TRANSACTION_TYPE evm_decode_transaction_type(
 
   uint32_t function_tag = U32_READ_BE_ARRAY(txn_context->transaction_info.data);
   if (EVM_transfer_TAG == function_tag &&
-      g_evm_app->is_token_whitelisted(txn_context->transaction_info.to_address,
-                                      &txn_context->contract)) {
+      evm_lookup_whitelisted_contract(
+          g_evm_app->whitelisted_contracts,
+          g_evm_app->whitelisted_contracts_count,
+          txn_context->transaction_info.to_address,
+          &txn_context->contract)) {
     return EVM_TXN_TOKEN_TRANSFER_FUNC;
   }
 
-  if (EVM_swap_TAG == function_tag || EVM_uniswapV3Swap_TAG == function_tag ||
-      EVM_safeTransferFrom_TAG == function_tag ||
-      EVM_deposit_TAG == function_tag || EVM_transfer_TAG == function_tag) {
-    // decode the contract data for display
+  if (EVM_TXN_DATA_RETAIN_SIZE < txn_context->transaction_info.data_size) {
+    // arguments are not retained for clear signing
+    return EVM_TXN_UNKNOWN_FUNC_SIG;
+  }
+
+  if (NULL != evm_lookup_function(function_tag)) {
+    // validate the contract data; the pages are shown during verification
     if (ETH_UTXN_ABI_DECODE_OK !=
         ETH_ExtractArguments(txn_context->transaction_info.data,
                              txn_context->transaction_info.data_size,
-                             &txn_context->display_node)) {
+                             NULL,
+                             &txn_context->display_size)) {
       /**
        * this could mean that the parameters to the function (provided in the
        * transaction.data) are invalid. This means either of the following: the
@@ -214,130 +393,62 @@ static EVM_TRANSACTION_TYPE evm_decode_transaction_type(
  * GLOBAL FUNCTIONS
  *****************************************************************************/
 
+void evm_txn_stream_init(evm_txn_context_t *txn_context) {
+  memzero(&txn_context->transaction_info, sizeof(evm_unsigned_txn));
+  memzero(&txn_context->stream, sizeof(evm_txn_stream_t));
+  evm_rlp_stream_init(
+      &txn_context->stream.rlp, evm_txn_rlp_event, (void *)txn_context);
+  keccak_256_Init(&txn_context->sha3_ctx);
+}
+
+bool evm_txn_stream_update(evm_txn_context_t *txn_context,
+                           const uint8_t *data,
+                           size_t size) {
+  evm_txn_stream_t *stream = &txn_context->stream;
+
+  keccak_Update(&txn_context->sha3_ctx, data, size);
+  if (!stream->started && 0 < size) {
+    stream->started = true;
+    // EIP-2718: typed transactions are prefixed with their type (<= 0x7f)
+    if (0x7f >= data[0]) {
+      // type 0 is reserved for the untyped (legacy) transactions
+      stream->envelope =
+          (EVM_TXN_ENVELOPE_LEGACY == data[0]) ? UINT8_MAX : data[0];
+      data++;
+      size--;
+    }
+  }
+
+  if (NULL == evm_txn_get_layout(stream->envelope)) {
+    return false;
+  }
+  return evm_rlp_stream_feed(&stream->rlp, data, size);
+}
+
+int evm_txn_stream_final(evm_txn_context_t *txn_context) {
+  const evm_txn_stream_t *stream = &txn_context->stream;
+  const evm_txn_layout_t *layout = evm_txn_get_layout(stream->envelope);
+  if (NULL == layout || !evm_rlp_stream_done(&stream->rlp) ||
+      layout->count > stream->field_count) {
+    return -1;
+  }
+  txn_context->txn_type = evm_decode_transaction_type(txn_context);
+  return 0;
+}
+
 int evm_decode_unsigned_txn(const uint8_t *evm_utxn_byte_array,
                             size_t byte_array_len,
                             evm_txn_context_t *txn_context) {
   if (evm_utxn_byte_array == NULL || txn_context == NULL) {
     return -1;
   }
-  evm_unsigned_txn *utxn_ptr = &txn_context->transaction_info;
-  memzero(utxn_ptr, sizeof(evm_unsigned_txn));
-
-  seq_type type = NONE;
-  int64_t offset = 0;
-  uint64_t decoded_len = 0;
-  uint64_t item_bytes_len = 0;
-
-  item_bytes_len = get_decode_length(evm_utxn_byte_array + offset,
-                                     byte_array_len - offset,
-                                     &decoded_len,
-                                     &type);
-  offset += decoded_len;
-  if (type != LIST)
-    return -1;
 
-  // nonce
-  item_bytes_len = get_decode_length(evm_utxn_byte_array + offset,
-                                     byte_array_len - offset,
-                                     &decoded_len,
-                                     &type);
-  offset += decoded_len;
-  if (type != STRING)
+  evm_txn_stream_init(txn_context);
+  if (!evm_txn_stream_update(
+          txn_context, evm_utxn_byte_array, byte_array_len)) {
     return -1;
-  utxn_ptr->nonce_size[0] = CY_MAX(1, item_bytes_len);
-  s_memcpy(utxn_ptr->nonce,
-           evm_utxn_byte_array,
-           byte_array_len,
-           item_bytes_len,
-           &offset);
-
-  // gas price
-  item_bytes_len = get_decode_length(evm_utxn_byte_array + offset,
-                                     byte_array_len - offset,
-                                     &decoded_len,
-                                     &type);
-  offset += decoded_len;
-  if (type != STRING)
-    return -1;
-  utxn_ptr->gas_price_size[0] = CY_MAX(1, item_bytes_len);
-  s_memcpy(utxn_ptr->gas_price,
-           evm_utxn_byte_array,
-           byte_array_len,
-           item_bytes_len,
-           &offset);
-
-  // gas limit
-  item_bytes_len = get_decode_length(evm_utxn_byte_array + offset,
-                                     byte_array_len - offset,
-                                     &decoded_len,
-                                     &type);
-  offset += decoded_len;
-  if (type != STRING)
-    return -1;
-  utxn_ptr->gas_limit_size[0] = CY_MAX(1, item_bytes_len);
-  s_memcpy(utxn_ptr->gas_limit,
-           evm_utxn_byte_array,
-           byte_array_len,
-           item_bytes_len,
-           &offset);
-
-  // to address
-  item_bytes_len = get_decode_length(evm_utxn_byte_array + offset,
-                                     byte_array_len - offset,
-                                     &decoded_len,
-                                     &type);
-  offset += decoded_len;
-  if (type != STRING)
-    return -1;
-  s_memcpy(utxn_ptr->to_address,
-           evm_utxn_byte_array,
-           byte_array_len,
-           item_bytes_len,
-           &offset);
-
-  // value
-  item_bytes_len = get_decode_length(evm_utxn_byte_array + offset,
-                                     byte_array_len - offset,
-                                     &decoded_len,
-                                     &type);
-  offset += decoded_len;
-  if (type != STRING)
-    return -1;
-  utxn_ptr->value_size[0] = CY_MAX(1, item_bytes_len);
-  s_memcpy(utxn_ptr->value,
-           evm_utxn_byte_array,
-           byte_array_len,
-           item_bytes_len,
-           &offset);
-
-  // payload
-  item_bytes_len = get_decode_length(evm_utxn_byte_array + offset,
-                                     byte_array_len - offset,
-                                     &decoded_len,
-                                     &type);
-  offset += decoded_len;
-  if (type != STRING)
-    return -1;
-  utxn_ptr->data_size = item_bytes_len;
-  utxn_ptr->data = &evm_utxn_byte_array[offset];
-  offset += (int64_t)item_bytes_len;
-
-  // chain id
-  item_bytes_len = get_decode_length(evm_utxn_byte_array + offset,
-                                     byte_array_len - offset,
-                                     &decoded_len,
-                                     &type);
-  offset += decoded_len;
-  if (type != STRING)
-    return -1;
-  utxn_ptr->chain_id_size[0] = CY_MAX(1, item_bytes_len);
-  s_memcpy(utxn_ptr->chain_id,
-           evm_utxn_byte_array,
-           byte_array_len,
-           item_bytes_len,
-           &offset);
-  txn_context->txn_type = evm_decode_transaction_type(txn_context);
-  return (offset > 0 ? 0 : -1);
+  }
+  return evm_txn_stream_final(txn_context);
 }
 
 bool evm_validate_unsigned_txn(const evm_txn_context_t *txn_context) {
@@ -402,7 +513,6 @@ void eth_get_fee_string(const evm_unsigned_txn *utxn_ptr,
                         uint8_t decimal) {
   uint8_t fee[16] = {0};
   uint64_t txn_fee, carry;
-  char fee_hex_string[33] = {'\0'};
 
   // make sure we do not process over the current capacity (i.e., 8-byte limit
   // for gas limit and price each)
@@ -418,13 +528,8 @@ void eth_get_fee_string(const evm_unsigned_txn *utxn_ptr,
   memcpy(fee + sizeof(txn_fee), &carry, sizeof(carry));
   // outputs 128-bit (16-byte) big-endian representation of fee
   cy_reverse_byte_array(fee, sizeof(fee));
-  byte_array_to_hex_string(
-      fee, sizeof(fee), fee_hex_string, sizeof(fee_hex_string));
-  convert_byte_array_to_decimal_string(sizeof(fee_hex_string) - 1,
-                                       decimal,
-                                       fee_hex_string,
-                                       fee_decimal_string,
-                                       size);
+  byte_array_to_decimal_string(
+      fee, sizeof(fee), decimal, fee_decimal_string, size);
 }
 
 uint8_t evm_get_decimal(const evm_txn_context_t *txn_context) {
@@ -16,6 +16,8 @@
 #include "coin_utils.h"
 #include "evm/sign_txn.pb.h"
 #include "evm_contracts.h"
+#include "evm_rlp.h"
+#include "sha3.h"
 
 /*****************************************************************************
  * MACROS AND DEFINES
@@ -26,6 +28,14 @@
 
 #define ETH_VALUE_SIZE_BYTES (32U)
 
+/// Leading bytes of the transaction data (calldata) retained while streaming
+#define EVM_TXN_DATA_RETAIN_SIZE 4096
+
+/// Transaction envelopes (EIP-2718 transaction types) that can be decoded
+#define EVM_TXN_ENVELOPE_LEGACY 0x00
+#define EVM_TXN_ENVELOPE_EIP2930 0x01
+#define EVM_TXN_ENVELOPE_EIP1559 0x02
+
 /*****************************************************************************
  * TYPEDEFS
  *****************************************************************************/
@@ -83,6 +93,21 @@ typedef struct {
 } evm_unsigned_txn;
 #pragma pack(pop)
 
+/**
+ * @brief State of the streaming decoder of an unsigned transaction
+ * @details The decoder consumes the transaction in chunks of any size. Refer
+ * @ref evm_txn_stream_init for usage.
+ */
+typedef struct {
+  evm_rlp_stream_t rlp;
+  /// EIP-2718 transaction type; EVM_TXN_ENVELOPE_LEGACY if untyped
+  uint8_t envelope;
+  /// set once the first byte of the transaction is received
+  bool started;
+  /// number of items seen in the unsigned transaction list
+  uint32_t field_count;
+} evm_txn_stream_t;
+
 typedef struct {
   /**
    * The structure holds the wallet information of the transaction.
@@ -90,8 +115,17 @@ typedef struct {
    */
   evm_sign_txn_initiate_request_t init_info;
 
-  /// remembers the allocated buffer for holding complete unsigned transaction
-  uint8_t *transaction;
+  /// running keccak-256 over the received unsigned transaction
+  SHA3_CTX sha3_ctx;
+
+  /// decoder state of the unsigned transaction stream
+  evm_txn_stream_t stream;
+
+  /**
+   * leading EVM_TXN_DATA_RETAIN_SIZE bytes of the transaction data; referred
+   * by transaction_info.data
+   */
+  uint8_t data[EVM_TXN_DATA_RETAIN_SIZE];
 
   /// store for decoded unsigned transaction info
   evm_unsigned_txn transaction_info;
@@ -101,8 +135,8 @@ typedef struct {
 
   EVM_TRANSACTION_TYPE txn_type;
 
-  /// pointer to maintain a list of display nodes
-  ui_display_node *display_node;
+  /// buffer size needed to display the pages of the decoded contract call
+  size_t display_size;
 } evm_txn_context_t;
 
 /*****************************************************************************
@@ -113,14 +147,58 @@ typedef struct {
  * GLOBAL FUNCTION PROTOTYPES
  *****************************************************************************/
 
+/**
+ * @brief Initializes the streaming decoder of an unsigned transaction
+ * @details Feed the RLP encoded unsigned transaction with @ref
+ * evm_txn_stream_update (in any number of chunks) and conclude with @ref
+ * evm_txn_stream_final. The fed bytes are absorbed into txn_context->sha3_ctx
+ * so the transaction never needs to be held in memory as a whole. Only the
+ * leading EVM_TXN_DATA_RETAIN_SIZE bytes of the transaction data are retained.
+ * Besides legacy transactions, EIP-2930 & EIP-1559 typed envelopes (prefixed
+ * with their transaction type) are accepted; for EIP-1559, maxFeePerGas is
+ * decoded as the gas price.
+ *
+ * @param [out] txn_context Reference to the transaction context
+ */
+void evm_txn_stream_init(evm_txn_context_t *txn_context);
+
+/**
+ * @brief Digests & decodes the next chunk of the unsigned transaction
+ *
+ * @param txn_context Reference to the transaction context
+ * @param [in] data Next bytes of the unsigned transaction
+ * @param [in] size Number of bytes in data
+ *
+ * @return bool Indicating if the bytes so far form a well-formed transaction
+ * @retval false If a field is malformed, too large, the envelope is not
+ * supported or the data extends past the outer list
+ */
+bool evm_txn_stream_update(evm_txn_context_t *txn_context,
+                           const uint8_t *data,
+                           size_t size);
+
+/**
+ * @brief Concludes decoding of the fed unsigned transaction
+ * @details On success, txn_context->txn_type is decoded from the retained
+ * transaction data.
+ *
+ * @param txn_context Reference to the transaction context
+ *
+ * @return Status of decoding
+ * @retval 0 Success
+ * @retval -1 If the transaction is malformed or incomplete
+ */
+int evm_txn_stream_final(evm_txn_context_t *txn_context);
+
 /**
  * @brief Convert byte array representation of unsigned transaction to
  * evm_unsigned_txn.
- * @details
+ * @details One-shot wrapper over the streaming decoder, refer @ref
+ * evm_txn_stream_init.
  *
  * @param [in] evm_utxn_byte_array  Byte array of unsigned transaction.
  * @param [in] byte_array_len               Length of byte array.
- * @param [out] unsigned_txn_ptr            Pointer to the evm_unsigned_txn
+ * @param [out] txn_context                 Pointer to the evm_txn_context_t
  * instance to store the transaction details.
  *
  * @return Status of conversion
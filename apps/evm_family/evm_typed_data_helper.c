@@ -65,6 +65,7 @@
 #include "coin_utils.h"
 #include "eip712_utils.h"
 #include "evm_priv.h"
+#include "pb_decode.h"
 
 /*****************************************************************************
  * EXTERN VARIABLES
@@ -96,6 +97,17 @@
 static ui_display_node *evm_create_typed_data_display_nodes(
     evm_sign_typed_data_node_t *root,
     ui_display_node **display_node);
+
+/**
+ * @brief Hashes & displays a completely received node of the stream
+ *
+ * @param stream Reference to the stream context
+ * @param node The decoded node
+ *
+ * @return bool Indicating if the node was valid and accepted by the user
+ */
+static bool evm_typed_data_stream_node(evm_typed_data_stream_t *stream,
+                                       const evm_sign_typed_data_node_t *node);
 /*****************************************************************************
  * STATIC VARIABLES
  *****************************************************************************/
@@ -144,6 +156,61 @@ static ui_display_node *evm_create_typed_data_display_nodes(
   return temp;
 }
 
+static bool evm_typed_data_stream_node(evm_typed_data_stream_t *stream,
+                                       const evm_sign_typed_data_node_t *node) {
+  char title[BUFFER_SIZE] = {0};
+  char data[BUFFER_SIZE] = {0};
+  const bool is_composite = (EVM_EIP_712_DATA_TYPE_STRUCT == node->type ||
+                             EVM_EIP_712_DATA_TYPE_ARRAY == node->type);
+
+  if (NULL == node->name || NULL == node->struct_name ||
+      (!is_composite && NULL == node->data) || 2 <= stream->roots_done) {
+    return false;
+  }
+
+  // a new root struct begins; domain is followed by the message
+  if (0 == stream->eip712.depth) {
+    const char *heading = UI_TEXT_EIP712_DOMAIN_TYPE;
+    if (0 == stream->roots_done) {
+      stream->domain_members = node->size;
+    } else {
+      heading = node->struct_name;
+      stream->message_members = node->size;
+      stream->message_is_domain =
+          (0 == strncmp(UI_TEXT_EIP712_DOMAIN_TYPE,
+                        node->struct_name,
+                        sizeof(UI_TEXT_EIP712_DOMAIN_TYPE)));
+    }
+    if (!stream->display(0 == stream->roots_done ? UI_TEXT_VERIFY_DOMAIN
+                                                 : UI_TEXT_VERIFY_MESSAGE,
+                         heading)) {
+      stream->aborted = true;
+      return false;
+    }
+  }
+
+  if (EIP712_OK !=
+      eip712_stream_node(&stream->eip712, node, title, sizeof(title))) {
+    return false;
+  }
+
+  fill_string_with_data(node, data, sizeof(data));
+  if (!stream->display(title, data)) {
+    stream->aborted = true;
+    return false;
+  }
+
+  if (stream->eip712.complete) {
+    memcpy(0 == stream->roots_done ? stream->domain_hash
+                                   : stream->message_hash,
+           stream->eip712.hash,
+           HASH_SIZE);
+    stream->roots_done++;
+    eip712_stream_init(&stream->eip712);
+  }
+  return true;
+}
+
 /*****************************************************************************
  * GLOBAL FUNCTIONS
  *****************************************************************************/
@@ -219,3 +286,104 @@ bool evm_get_typed_struct_data_digest(
 
   return status;
 }
+
+void evm_typed_data_stream_init(evm_typed_data_stream_t *stream,
+                                evm_typed_data_display_t display) {
+  memzero(stream, sizeof(evm_typed_data_stream_t));
+  eip712_stream_init(&stream->eip712);
+  stream->display = display;
+}
+
+bool evm_typed_data_stream_feed(evm_typed_data_stream_t *stream,
+                                const uint8_t *data,
+                                size_t size) {
+  size_t offset = 0;
+
+  while (offset < size) {
+    if (!stream->size_known) {
+      const uint8_t byte = data[offset++];
+      if (28 < stream->size_shift) {
+        return false;
+      }
+      stream->node_size |= (uint32_t)(byte & 0x7f) << stream->size_shift;
+      stream->size_shift += 7;
+      if (byte & 0x80) {
+        continue;
+      }
+
+      if (0 == stream->node_size ||
+          MAX_MSG_DATA_TYPED_DATA_SIZE < stream->node_size) {
+        return false;
+      }
+      stream->node = malloc(stream->node_size);
+      ASSERT(NULL != stream->node);
+      stream->node_pos = 0;
+      stream->size_known = true;
+      continue;
+    }
+
+    const uint32_t count =
+        CY_MIN(size - offset, stream->node_size - stream->node_pos);
+    memcpy(stream->node + stream->node_pos, data + offset, count);
+    stream->node_pos += count;
+    offset += count;
+    if (stream->node_pos < stream->node_size) {
+      continue;
+    }
+
+    evm_sign_typed_data_node_t node = EVM_SIGN_TYPED_DATA_NODE_INIT_ZERO;
+    pb_istream_t istream =
+        pb_istream_from_buffer(stream->node, stream->node_size);
+    // the node is hashed and dropped; keep the arena from growing per node
+    const cy_arena_mark_t mark = cy_arena_mark();
+    bool status =
+        pb_decode(&istream, EVM_SIGN_TYPED_DATA_NODE_FIELDS, &node) &&
+        evm_typed_data_stream_node(stream, &node);
+    pb_release(EVM_SIGN_TYPED_DATA_NODE_FIELDS, &node);
+    cy_arena_reset(mark);
+
+    evm_typed_data_stream_clear(stream);
+    if (!status) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool evm_typed_data_stream_digest(const evm_typed_data_stream_t *stream,
+                                  uint8_t *digest_out) {
+  SHA3_CTX ctx = {0};
+
+  if (NULL == stream || NULL == digest_out || 2 != stream->roots_done ||
+      stream->size_known) {
+    return false;
+  }
+
+  // same composition as evm_get_typed_struct_data_digest
+  keccak_256_Init(&ctx);
+  keccak_Update(&ctx,
+                (const uint8_t *)ETH_SIGN_TYPED_DATA_IDENTIFIER,
+                sizeof(ETH_SIGN_TYPED_DATA_IDENTIFIER) - 1);
+  if (0 < stream->domain_members) {
+    keccak_Update(&ctx, stream->domain_hash, HASH_SIZE);
+    if (0 < stream->message_members) {
+      keccak_Update(&ctx, stream->message_hash, HASH_SIZE);
+    }
+  } else if (!stream->message_is_domain) {
+    return false;
+  }
+  keccak_Final(&ctx, digest_out);
+  return true;
+}
+
+void evm_typed_data_stream_clear(evm_typed_data_stream_t *stream) {
+  if (NULL != stream->node) {
+    memzero(stream->node, stream->node_size);
+    free(stream->node);
+  }
+  stream->node = NULL;
+  stream->node_size = 0;
+  stream->node_pos = 0;
+  stream->size_shift = 0;
+  stream->size_known = false;
+}
@@ -13,6 +13,7 @@
  * INCLUDES
  *****************************************************************************/
 
+#include "eip712_utils.h"
 #include "evm_priv.h"
 
 /*****************************************************************************
@@ -23,6 +24,44 @@
  * TYPEDEFS
  *****************************************************************************/
 
+/**
+ * @brief Presents a node of the typed data to the user
+ *
+ * @return bool Indicating if the user accepted the node
+ */
+typedef bool (*evm_typed_data_display_t)(const char *title, const char *value);
+
+/**
+ * @brief Context for typed data received as a stream of nodes
+ * @details The host sends the domain struct followed by the message struct,
+ * each flattened in depth-first order. Every node is an
+ * evm_sign_typed_data_node_t without children, prefixed with its varint
+ * encoded length; the size of a struct/array node is the count of members
+ * that follow. Each node is hashed & displayed as soon as it arrives, so only
+ * the node being received and the open structs/arrays are held in memory.
+ */
+typedef struct evm_typed_data_stream {
+  eip712_stream_t eip712;
+  uint8_t domain_hash[HASH_SIZE];
+  uint8_t message_hash[HASH_SIZE];
+  /// number of root structs (domain, message) concluded so far
+  uint8_t roots_done;
+  uint32_t domain_members;
+  uint32_t message_members;
+  bool message_is_domain;
+
+  /// varint length prefix & buffer of the node being received
+  uint32_t node_size;
+  uint8_t size_shift;
+  bool size_known;
+  uint8_t *node;
+  uint32_t node_pos;
+
+  evm_typed_data_display_t display;
+  /// set when the user rejected a node (the error is already reported)
+  bool aborted;
+} evm_typed_data_stream_t;
+
 /*****************************************************************************
  * EXPORTED VARIABLES
  *****************************************************************************/
@@ -60,4 +99,48 @@ void evm_init_typed_data_display_node(ui_display_node **node,
 bool evm_get_typed_struct_data_digest(
     const evm_sign_typed_data_struct_t *typed_data,
     uint8_t *digest_out);
+
+/**
+ * @brief Initializes the context for receiving typed data as a node stream
+ *
+ * @param stream Reference to the stream context
+ * @param display Callback to present each node to the user
+ */
+void evm_typed_data_stream_init(evm_typed_data_stream_t *stream,
+                                evm_typed_data_display_t display);
+
+/**
+ * @brief Consumes the next chunk of the node stream
+ * @details Every completely received node is hashed and presented via the
+ * display callback before the function returns.
+ *
+ * @param stream Reference to the stream context
+ * @param data Next bytes of the node stream
+ * @param size Number of bytes in data
+ *
+ * @return bool Indicating if the nodes so far were valid and accepted
+ * @retval false If a node is malformed, the tree is inconsistent or the user
+ * rejected a node (stream->aborted is set in this case)
+ */
+bool evm_typed_data_stream_feed(evm_typed_data_stream_t *stream,
+                                const uint8_t *data,
+                                size_t size);
+
+/**
+ * @brief Calculates the EIP712 digest of the completely received typed data
+ *
+ * @param stream Reference to the stream context
+ * @param digest_out Buffer of 32 bytes to store the digest
+ *
+ * @return bool Indicating if the typed data was complete & valid
+ */
+bool evm_typed_data_stream_digest(const evm_typed_data_stream_t *stream,
+                                  uint8_t *digest_out);
+
+/**
+ * @brief Releases the node being received, if any
+ *
+ * @param stream Reference to the stream context
+ */
+void evm_typed_data_stream_clear(evm_typed_data_stream_t *stream);
 #endif
@@ -62,9 +62,9 @@
 
 #include "evm_user_verification.h"
 
-#include "address.h"
 #include "constant_texts.h"
 #include "evm_api.h"
+#include "evm_helpers.h"
 #include "evm_priv.h"
 #include "ui_core_confirm.h"
 #include "ui_screens.h"
@@ -85,6 +85,17 @@
  * STATIC FUNCTION PROTOTYPES
  *****************************************************************************/
 
+/**
+ * @brief Shows a page of the decoded contract call to the user
+ * @details Used as evm_abi_display_t.show for @ref ETH_ExtractArguments
+ *
+ * @param ctx Unused
+ * @param title Title of the page
+ * @param value Value shown on the page
+ * @return bool Indicating if the user accepted the page
+ */
+static bool show_contract_page(void *ctx, const char *title, const char *value);
+
 /*****************************************************************************
  * STATIC VARIABLES
  *****************************************************************************/
@@ -97,13 +108,19 @@
  * STATIC FUNCTIONS
  *****************************************************************************/
 
+static bool show_contract_page(void *ctx,
+                               const char *title,
+                               const char *value) {
+  return core_scroll_page(title, value, evm_send_error);
+}
+
 /*****************************************************************************
  * GLOBAL FUNCTIONS
  *****************************************************************************/
 
 bool evm_verify_transfer(const evm_txn_context_t *txn_context) {
   bool status = false;
-  char address[43] = "0x";
+  char address[EVM_ADDRESS_STRING_SIZE] = "";
   const uint8_t *to_address = NULL;
   const char *unit = evm_get_asset_symbol(txn_context);
   char value[34] = {'\0'};
@@ -120,8 +137,7 @@ bool evm_verify_transfer(const evm_txn_context_t *txn_context) {
 
   // verify recipient address; TODO: handle harmony address encoding
   eth_get_to_address(txn_context, &to_address);
-  ethereum_address_checksum(
-      to_address, &address[2], false, g_evm_app->chain_id);
+  evm_format_address(to_address, address);
   snprintf(
       display, sizeof(display), UI_TEXT_SEND_PROMPT, unit, g_evm_app->name);
   if (!core_scroll_page(NULL, display, evm_send_error) ||
@@ -155,7 +171,7 @@ bool evm_verify_transfer(const evm_txn_context_t *txn_context) {
 }
 
 bool evm_verify_clear_signing(const evm_txn_context_t *txn_context) {
-  char address[43] = "0x";
+  char address[EVM_ADDRESS_STRING_SIZE] = "";
   const uint8_t *to_address = NULL;
   const char *unit = g_evm_app->lunit_name;
   char fee[34] = "";
@@ -163,8 +179,7 @@ bool evm_verify_clear_signing(const evm_txn_context_t *txn_context) {
 
   // show warning for not-whitelisted contracts; take user consent
   to_address = txn_context->transaction_info.to_address;
-  ethereum_address_checksum(
-      to_address, &address[2], false, g_evm_app->chain_id);
+  evm_format_address(to_address, address);
   delay_scr_init(ui_text_unverified_contract, DELAY_TIME);
 
   if (!core_scroll_page(ui_text_verify_contract, address, evm_send_error)) {
@@ -179,26 +194,36 @@ bool evm_verify_clear_signing(const evm_txn_context_t *txn_context) {
     return false;
   }
 
-  ui_display_node *ui_node = txn_context->display_node;
-  while (NULL != ui_node) {
-    if (!core_scroll_page(ui_node->title, ui_node->value, evm_send_error)) {
-      return false;
-    }
-    ui_node = ui_node->next;
+  // the pages of the contract call are stringified one at a time in buffer
+  char *buffer = malloc(txn_context->display_size);
+  ASSERT(NULL != buffer);
+  const evm_abi_display_t abi_display = {
+      .show = show_contract_page,
+      .ctx = NULL,
+      .buffer = buffer,
+      .buffer_size = txn_context->display_size,
+  };
+  uint8_t result = ETH_ExtractArguments(txn_context->transaction_info.data,
+                                        txn_context->transaction_info.data_size,
+                                        &abi_display,
+                                        NULL);
+  memzero(buffer, txn_context->display_size);
+  free(buffer);
+
+  if (ETH_UTXN_ABI_DECODE_OK == result) {
+    return true;
   }
-  /**
-   * The function ETH_ExtractArguments prepares the list of display nodes
-   * containing presentable strings. The function reserves heap memory for the
-   * list elements. This is the earliest safe point to free the memory.
-   */
-  cy_free();
-  return true;
+  if (ETH_UTXN_ABI_DISPLAY_REJECTED != result) {
+    // the data was validated already while parsing the transaction
+    evm_send_error(ERROR_COMMON_ERROR_UNKNOWN_ERROR_TAG, 1);
+  }
+  return false;
 }
 
 bool evm_verify_blind_signing(const evm_txn_context_t *txn_context) {
   bool status = false;
   const uint8_t *to_address = NULL;
-  char address[43] = "0x";
+  char address[EVM_ADDRESS_STRING_SIZE] = "";
   char path_str[64] = "";
   char fee[34] = "";
   char display[40] = "";
@@ -208,8 +233,7 @@ bool evm_verify_blind_signing(const evm_txn_context_t *txn_context) {
 
   // TODO: decide on handling blind signing via wallet setting
   to_address = txn_context->transaction_info.to_address;
-  ethereum_address_checksum(
-      to_address, &address[2], false, g_evm_app->chain_id);
+  evm_format_address(to_address, address);
   hd_path_array_to_string(hd_path, depth, false, path_str, sizeof(path_str));
   eth_get_fee_string(
       &txn_context->transaction_info, fee, sizeof(fee), ETH_DECIMAL);
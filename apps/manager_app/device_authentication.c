@@ -367,6 +367,10 @@ void device_authentication_flow(manager_query_t *query) {
   /* First state of the device authentication would be SIGN_SERIAL_NUMBER */
   device_auth_state_e state = SIGN_SERIAL_NUM;
 
+  /* The ATECC signs in two consecutive steps; keep it awake while the host
+   * prepares the challenge */
+  atecc_session_hold(true);
+
   while (1) {
     switch (state) {
       case SIGN_SERIAL_NUM: {
@@ -400,5 +404,6 @@ void device_authentication_flow(manager_query_t *query) {
     }
   }
 
+  atecc_session_hold(false);
   return;
 }
@@ -60,13 +60,16 @@
 #include "cryptoauthlib.h"
 #include "curves.h"
 #include "flash_api.h"
+#include "fw_hash.h"
 #include "nist256p1.h"
 #include "sec_flash.h"
 #include "string.h"
+#include "task_scheduler.h"
 #if USE_SIMULATOR == 0
 #include "stm32l4xx_it.h"
 #endif
 
+#include "atca_async.h"
 #include "atca_basic.h"
 #include "device_authentication_api.h"
 
@@ -74,8 +77,11 @@
 #define POSTFIX1_SIZE 7
 #define POSTFIX2_SIZE 23
 #define RANDOM_CHALLENGE_SIZE 32
+#define ATECC_SLEEP_SLICE_MS 5
 
 atecc_data_t atecc_data = {0};
+static bool atecc_session_ready = false;
+static bool atecc_session_held = false;
 
 #if (FIRMWARE_HASH_CALC == 0)
 static const uint8_t firmware_hash[] = {
@@ -83,10 +89,6 @@ static const uint8_t firmware_hash[] = {
     0x94, 0x5e, 0xb2, 0xa9, 0x9c, 0x16, 0x49, 0x70, 0x3e, 0xa6, 0xf7,
     0x6b, 0xf2, 0x59, 0xab, 0xb4, 0xfb, 0x83, 0x8e, 0x01, 0x3e,
 };
-#else
-static void fw_hash_calculate(uint8_t *m_digest) {
-  sha256_Raw((uint8_t *)APPLICATION_ADDRESS_BASE, get_fwSize(), m_digest);
-}
 #endif
 
 static ATCA_STATUS helper_config_to_sign_internal(
@@ -103,55 +105,139 @@ static void helper_get_gendig_hash(atecc_slot_define_t slot,
                                    uint8_t *digest,
                                    uint8_t *postfix);
 
+/**
+ * @brief Background task putting the ATECC to sleep after a burst of commands.
+ * Every command wakes the chip on its own, hence the session stays valid.
+ */
+static bool atecc_sleep_task(uint32_t budget_ms) {
+  if (atca_async_busy())
+    return true;
+  sched_remove_task(atecc_sleep_task);
+  if (atecc_session_ready) {
+    bool usb_irq_enable_on_entry = NVIC_GetEnableIRQ(OTG_FS_IRQn);
+    NVIC_DisableIRQ(OTG_FS_IRQn);
+    atcab_sleep();
+    if (usb_irq_enable_on_entry == true)
+      NVIC_EnableIRQ(OTG_FS_IRQn);
+  }
+  return false;
+}
+
+ATCA_STATUS atecc_session_begin(void) {
+  if (!atecc_session_ready || atecc_data.status != ATCA_SUCCESS) {
+    atecc_session_ready = false;
+    atca_async_flush();
+    bool usb_irq_enable_on_entry = NVIC_GetEnableIRQ(OTG_FS_IRQn);
+    NVIC_DisableIRQ(OTG_FS_IRQn);
+    ATCA_STATUS status = atcab_init(atecc_data.cfg_atecc608a_iface);
+    if (usb_irq_enable_on_entry == true)
+      NVIC_EnableIRQ(OTG_FS_IRQn);
+    if (status != ATCA_SUCCESS) {
+      return status;
+    }
+    atecc_session_ready = true;
+  }
+  if (!atecc_session_held)
+    sched_add_task(atecc_sleep_task, SCHED_PRIO_LOW, ATECC_SLEEP_SLICE_MS);
+  return ATCA_SUCCESS;
+}
+
+void atecc_session_hold(bool hold) {
+  atecc_session_held = hold;
+  if (hold)
+    sched_remove_task(atecc_sleep_task);
+  else if (atecc_session_ready)
+    sched_add_task(atecc_sleep_task, SCHED_PRIO_LOW, ATECC_SLEEP_SLICE_MS);
+}
+
+/**
+ * @brief Records the first failure among the queued ATECC commands
+ */
+static void atecc_async_done(ATCA_STATUS status,
+                             ATCAPacket *packet,
+                             void *ctx) {
+  ATCA_STATUS *result = (ATCA_STATUS *)ctx;
+  if (*result == ATCA_SUCCESS)
+    *result = status;
+}
+
+/**
+ * @brief Runs Nonce, GenDig on the given slot and an internal Sign with the
+ * auth key through the async queue, so that USB is serviced while the chip
+ * executes them.
+ */
+static ATCA_STATUS atecc_sign_slot_digest(atecc_slot_define_t slot,
+                                          uint8_t *signature) {
+  ATCADevice device = atcab_get_device();
+  ATCACommand ca_cmd = device->mCommands;
+  ATCAPacket packets[3] = {0};
+  ATCA_STATUS status = ATCA_SUCCESS;
+
+  packets[0].param1 = NONCE_MODE_PASSTHROUGH;
+  packets[1].param1 = ATCA_ZONE_DATA;
+  packets[1].param2 = slot;
+  packets[2].param1 = SIGN_MODE_INTERNAL;
+  packets[2].param2 = slot_2_auth_key;
+  if ((status = atNonce(ca_cmd, &packets[0])) != ATCA_SUCCESS ||
+      (status = atGenDig(ca_cmd, &packets[1], false)) != ATCA_SUCCESS ||
+      (status = atSign(ca_cmd, &packets[2])) != ATCA_SUCCESS) {
+    return status;
+  }
+
+  for (int i = 0; i < 3 && status == ATCA_SUCCESS; i++) {
+    status =
+        atca_async_execute(device, &packets[i], 0, atecc_async_done, &status);
+  }
+  atca_async_flush();
+
+  if (status == ATCA_SUCCESS) {
+    if (packets[2].rxsize < SIGNATURE_SIZE + ATCA_PACKET_OVERHEAD) {
+      status = ATCA_RX_FAIL;
+    } else {
+      memcpy(signature, &packets[2].data[ATCA_RSP_DATA_IDX], SIGNATURE_SIZE);
+    }
+  }
+  return status;
+}
+
 manager_auth_device_response_t __attribute__((optimize("O0")))
 sign_serial_number(void) {
   manager_auth_device_response_t response =
       MANAGER_AUTH_DEVICE_RESPONSE_INIT_ZERO;
   response.which_response = MANAGER_AUTH_DEVICE_RESPONSE_SERIAL_SIGNATURE_TAG;
 
-  uint8_t nonce[32] = {0};
+  bool usb_irq_enable_on_entry = false;
   uint8_t tempkey_hash[DEVICE_SERIAL_SIZE + POSTFIX2_SIZE] = {0};
   uint8_t final_hash[32] = {0};
   atca_sign_internal_in_out_t sign_internal_param = {0};
 
   atecc_data.retries = DEFAULT_ATECC_RETRIES;
-  bool usb_irq_enable_on_entry = NVIC_GetEnableIRQ(OTG_FS_IRQn);
-  NVIC_DisableIRQ(OTG_FS_IRQn);
   do {
-    OTG_FS_IRQHandler();
-
     if (atecc_data.status != ATCA_SUCCESS)
       LOG_CRITICAL("AUTH SN: %04x, count:%d",
                    atecc_data.status,
                    DEFAULT_ATECC_RETRIES - atecc_data.retries);
 
-    if ((atecc_data.status = atcab_init(atecc_data.cfg_atecc608a_iface)) !=
-        ATCA_SUCCESS) {
-      continue;
-    }
-
-    atecc_data.status = atcab_nonce(nonce);
-    if (atecc_data.status != ATCA_SUCCESS) {
-      continue;
-    }
-
-    atecc_data.status = atcab_gendig(ATCA_ZONE_DATA, slot_8_serial, NULL, 0);
-    if (atecc_data.status != ATCA_SUCCESS) {
+    if ((atecc_data.status = atecc_session_begin()) != ATCA_SUCCESS) {
       continue;
     }
 
-    atecc_data.status = atcab_sign_internal(
-        slot_2_auth_key, false, false, response.serial_signature.signature);
+    atecc_data.status = atecc_sign_slot_digest(
+        slot_8_serial, response.serial_signature.signature);
     if (atecc_data.status != ATCA_SUCCESS) {
       continue;
     }
 
+    usb_irq_enable_on_entry = NVIC_GetEnableIRQ(OTG_FS_IRQn);
+    NVIC_DisableIRQ(OTG_FS_IRQn);
     atecc_data.status = atcab_read_zone(ATCA_ZONE_DATA,
                                         slot_8_serial,
                                         0,
                                         0,
                                         response.serial_signature.serial,
                                         32);
+    if (usb_irq_enable_on_entry == true)
+      NVIC_EnableIRQ(OTG_FS_IRQn);
     if (atecc_data.status != ATCA_SUCCESS) {
       continue;
     }
@@ -179,8 +265,6 @@ sign_serial_number(void) {
       }
     }
   } while (--atecc_data.retries && atecc_data.status != ATCA_SUCCESS);
-  if (usb_irq_enable_on_entry == true)
-    NVIC_EnableIRQ(OTG_FS_IRQn);
 
   memcpy(response.serial_signature.postfix2, &tempkey_hash[32], POSTFIX2_SIZE);
 
@@ -194,54 +278,43 @@ sign_random_challenge(uint8_t *challenge) {
   response.which_response =
       MANAGER_AUTH_DEVICE_RESPONSE_CHALLENGE_SIGNATURE_TAG;
 
-  uint8_t nonce[32] = {0};
+  bool usb_irq_enable_on_entry = false;
   uint8_t io_protection_key[32] = {0};
   uint8_t tempkey_hash[DEVICE_SERIAL_SIZE + POSTFIX2_SIZE] = {0};
   uint8_t final_hash[32] = {0};
   atca_sign_internal_in_out_t sign_internal_param = {0};
   get_io_protection_key(io_protection_key);
 #if (FIRMWARE_HASH_CALC == 1)
-  // generating firmware hash code
+  // digest cached since boot, see fw_hash_start()
   uint8_t firmware_hash[32];
-  fw_hash_calculate(firmware_hash);
+  fw_hash_get(firmware_hash);
 #endif
   for (int i = 0; i < 32; ++i)
     challenge[i] = challenge[i] ^ firmware_hash[i];
 
   atecc_data.retries = DEFAULT_ATECC_RETRIES;
-  bool usb_irq_enable_on_entry = NVIC_GetEnableIRQ(OTG_FS_IRQn);
-  NVIC_DisableIRQ(OTG_FS_IRQn);
   do {
-    OTG_FS_IRQHandler();
-
     if (atecc_data.status != ATCA_SUCCESS)
       LOG_CRITICAL("AERR CH: %04x, count:%d",
                    atecc_data.status,
                    DEFAULT_ATECC_RETRIES - atecc_data.retries);
 
-    if ((atecc_data.status = atcab_init(atecc_data.cfg_atecc608a_iface)) !=
-        ATCA_SUCCESS) {
+    if ((atecc_data.status = atecc_session_begin()) != ATCA_SUCCESS) {
       continue;
     }
 
+    usb_irq_enable_on_entry = NVIC_GetEnableIRQ(OTG_FS_IRQn);
+    NVIC_DisableIRQ(OTG_FS_IRQn);
     atecc_data.status = atcab_write_enc(
         slot_5_challenge, 0, challenge, io_protection_key, slot_6_io_key);
+    if (usb_irq_enable_on_entry == true)
+      NVIC_EnableIRQ(OTG_FS_IRQn);
     if (atecc_data.status != ATCA_SUCCESS) {
       continue;
     }
 
-    atecc_data.status = atcab_nonce(nonce);
-    if (atecc_data.status != ATCA_SUCCESS) {
-      continue;
-    }
-
-    atecc_data.status = atcab_gendig(ATCA_ZONE_DATA, slot_5_challenge, NULL, 0);
-    if (atecc_data.status != ATCA_SUCCESS) {
-      continue;
-    }
-
-    atecc_data.status = atcab_sign_internal(
-        slot_2_auth_key, false, false, response.challenge_signature.signature);
+    atecc_data.status = atecc_sign_slot_digest(
+        slot_5_challenge, response.challenge_signature.signature);
     if (atecc_data.status != ATCA_SUCCESS) {
       continue;
     }
@@ -261,8 +334,12 @@ sign_random_challenge(uint8_t *challenge) {
 
     // overwrite challenge slot to signature generation on same challenge
     memset(challenge, 0, RANDOM_CHALLENGE_SIZE);
+    usb_irq_enable_on_entry = NVIC_GetEnableIRQ(OTG_FS_IRQn);
+    NVIC_DisableIRQ(OTG_FS_IRQn);
     atecc_data.status = atcab_write_enc(
         slot_5_challenge, 0, challenge, io_protection_key, slot_6_io_key);
+    if (usb_irq_enable_on_entry == true)
+      NVIC_EnableIRQ(OTG_FS_IRQn);
     if (atecc_data.status != ATCA_SUCCESS) {
       continue;
     }
@@ -277,8 +354,6 @@ sign_random_challenge(uint8_t *challenge) {
         LOG_ERROR("err xxx33 fault %d verify %d", atecc_data.status, result);
     }
   } while (--atecc_data.retries && atecc_data.status != ATCA_SUCCESS);
-  if (usb_irq_enable_on_entry == true)
-    NVIC_EnableIRQ(OTG_FS_IRQn);
 
   memcpy(
       response.challenge_signature.postfix2, &tempkey_hash[32], POSTFIX2_SIZE);
@@ -85,4 +85,26 @@ manager_auth_device_response_t sign_serial_number(void);
  */
 manager_auth_device_response_t sign_random_challenge(uint8_t *challenge);
 
+/**
+ * @brief Makes the ATECC ready for the next command of the caller
+ * @details The chip is initialised once and kept across operations. It is
+ * initialised again only if the last command recorded in atecc_data.status
+ * failed, so a retry loop recovers the same way as with a fresh atcab_init.
+ * The chip is put to sleep once the flow goes idle.
+ *
+ * @return ATCA_STATUS ATCA_SUCCESS if the chip can take commands
+ */
+ATCA_STATUS atecc_session_begin(void);
+
+/**
+ * @brief Keeps the ATECC awake between the steps of a multi-step exchange
+ * @details While held, the chip is not put to sleep when the flow goes idle
+ * waiting for the next host request, saving a sleep and wake cycle per step.
+ * The chip still falls asleep on its own watchdog if the host is slow. On
+ * release, the sleep is scheduled as after any other command.
+ *
+ * @param hold true to keep the chip awake, false to release it
+ */
+void atecc_session_hold(bool hold);
+
 #endif /* DEVICE_AUTHENTICATION_API_H */
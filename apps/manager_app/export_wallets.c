@@ -125,43 +125,38 @@ static bool check_which_request(const manager_query_t *query,
 }
 
 static void fill_wallet_list(manager_get_wallets_result_response_t *resp) {
-  const char *wallet_list[MAX_WALLETS_ALLOWED] = {0};
-
-  resp->wallet_list_count = get_wallet_list(&wallet_list[0]);
-
   manager_wallet_item_t *list = &resp->wallet_list[0];
+  uint8_t count = 0;
+
+  // Single pass over the wallet slots in RAM, in the order of get_wallet_list()
+  for (uint8_t flash_index = 0; flash_index < MAX_WALLETS_ALLOWED;
+       flash_index++) {
+    wallet_state state = INVALID_WALLET;
+    if (true != wallet_is_filled(flash_index, &state)) {
+      continue;
+    }
 
-  uint8_t index = 0;
-  for (index = 0; index < resp->wallet_list_count; index++) {
-    uint8_t flash_index;
-    get_index_by_name(wallet_list[index], &flash_index);
-
+    manager_wallet_item_t *item = &list[count++];
     snprintf(
-        list[index].name, sizeof(list[index].name), "%s", wallet_list[index]);
-
-    memcpy(list[index].id, get_wallet_id(flash_index), WALLET_ID_SIZE);
-
+        item->name, sizeof(item->name), "%s", get_wallet_name(flash_index));
+    memcpy(item->id, get_wallet_id(flash_index), WALLET_ID_SIZE);
     uint8_t wallet_info = get_wallet_info(flash_index);
-    list[index].has_passphrase = WALLET_IS_PASSPHRASE_SET(wallet_info);
-    list[index].has_pin = WALLET_IS_PIN_SET(wallet_info);
-
-    Flash_Wallet *flash_wallet = NULL;
-    get_flash_wallet_by_name(wallet_list[index], &flash_wallet);
-
-    ASSERT(NULL != flash_wallet);
+    item->has_passphrase = WALLET_IS_PASSPHRASE_SET(wallet_info);
+    item->has_pin = WALLET_IS_PIN_SET(wallet_info);
 
     // Wallet is NOT in usable state if
     // 1. It is in locked state in any of the X1 cards
     // 2. Wallet state in X1 Vault flash is not VALID_WALLET
     // 3. Card state in X1 Vault flash is not 0xF
-    if (flash_wallet->is_wallet_locked || VALID_WALLET != flash_wallet->state ||
-        0x0F != flash_wallet->cards_states) {
-      list[index].is_valid = false;
+    if (is_wallet_locked(flash_index) || VALID_WALLET != state ||
+        0x0F != get_wallet_card_state(flash_index)) {
+      item->is_valid = false;
     } else {
-      list[index].is_valid = true;
+      item->is_valid = true;
     }
   }
 
+  resp->wallet_list_count = count;
   return;
 }
 
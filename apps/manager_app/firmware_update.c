@@ -62,6 +62,8 @@
  *****************************************************************************/
 #include "board.h"
 #include "common_error.h"
+#include "flash_struct.h"
+#include "logger.h"
 #include "manager_api.h"
 #include "sec_flash.h"
 #include "ui_core_confirm.h"
@@ -191,6 +193,8 @@ void manager_confirm_firmware_update(manager_query_t *query) {
   // NOTE: Wait for status pull to desktop (which requests at 200ms)
   instruction_scr_init(ui_text_processing, NULL);
   BSP_DelayMs(500);
+  flash_commit();
+  logger_flush();
   FW_enter_DFU();
   BSP_reset();
 
@@ -62,6 +62,7 @@
 
 #include "application_startup.h"
 #include "atca_status.h"
+#include "boot_profile.h"
 #include "device_authentication_api.h"
 #include "flash_api.h"
 #include "manager_api.h"
@@ -164,5 +165,8 @@ void get_device_info_flow(const manager_query_t *query) {
         init_manager_result(MANAGER_RESULT_GET_DEVICE_INFO_TAG);
     result.get_device_info = get_device_info();
     manager_send_result(&result);
+    // the host asks for the device info on connection, export the boot
+    // timing along with the next log fetch
+    boot_profile_log_report();
   }
 }
\ No newline at end of file
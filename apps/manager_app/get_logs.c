@@ -60,14 +60,20 @@
  * INCLUDES
  *****************************************************************************/
 
+#include "app_registry.h"
 #include "common_error.h"
 #include "flash_api.h"
 #include "manager_api.h"
+#include "mem_diag.h"
 #include "onboarding.h"
 #include "status_api.h"
 #include "ui_core_confirm.h"
 #include "ui_screens.h"
 
+#ifdef DEV_BUILD
+#include "ui_profiler.h"
+#endif
+
 /*****************************************************************************
  * EXTERN VARIABLES
  *****************************************************************************/
@@ -175,6 +181,14 @@ static bool check_logs_export() {
 
 static bool send_logs(manager_query_t *query, manager_result_t *result) {
   size_t log_size = 0;
+  // append the memory high-water marks and the dispatch statistics so that
+  // they are exported as well; each export covers the traffic since the last
+  mem_diag_log_report();
+  registry_log_report();
+  registry_reset_app_stats();
+#ifdef DEV_BUILD
+  ui_profiler_log_report();
+#endif
   set_start_log_read();
 
   while (1) {
@@ -171,10 +171,10 @@ void manager_send_error(pb_size_t which_error, uint32_t error_code) {
 }
 
 void manager_send_result(const manager_result_t *result) {
-  uint8_t buffer[MANAGER_RESULT_SIZE] = {0};
-  size_t bytes_encoded = 0;
-  ASSERT(encode_manager_result(result, buffer, sizeof(buffer), &bytes_encoded));
-  send_response_to_host(&buffer[0], bytes_encoded);
+  // Encoded straight into the usb buffer, after the core message
+  pb_ostream_t stream = begin_response_to_host();
+  ASSERT(pb_encode(&stream, MANAGER_RESULT_FIELDS, result));
+  end_response_to_host(&stream);
 }
 
 bool manager_get_query(manager_query_t *query, pb_size_t exp_query_tag) {
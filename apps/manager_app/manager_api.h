@@ -91,7 +91,8 @@ void manager_send_error(pb_size_t which_error, uint32_t error_code);
  * @details If the encoding is successful, then it sends the corresponding
  * result to the host.
  *
- * The function ASSERTs the result of encode_manager_result internally.
+ * The result is encoded in place in the usb buffer; the function ASSERTs the
+ * encoding internally.
  *
  * @param result The result which needs to be sent to the host.
  */
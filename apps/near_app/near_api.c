@@ -169,12 +169,10 @@ void near_send_error(pb_size_t which_error, uint32_t error_code) {
 }
 
 void near_send_result(const near_result_t *result) {
-  // TODO: Eventually 1700 will be replaced by NEAR_RESULT_SIZE when all
-  // option files for bitcoin app are complete
-  uint8_t buffer[1700] = {0};
-  size_t bytes_encoded = 0;
-  ASSERT(encode_near_result(result, buffer, sizeof(buffer), &bytes_encoded));
-  send_response_to_host(&buffer[0], bytes_encoded);
+  // Encoded straight into the usb buffer, after the core message
+  pb_ostream_t stream = begin_response_to_host();
+  ASSERT(pb_encode(&stream, NEAR_RESULT_FIELDS, result));
+  end_response_to_host(&stream);
 }
 
 bool near_get_query(near_query_t *query, pb_size_t exp_query_tag) {
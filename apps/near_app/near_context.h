@@ -109,6 +109,7 @@ typedef enum near_action {
 
 typedef struct near_key {
   uint8_t key_type;
+  /// 32 bytes for NEAR_CURVE_ED25519 & 64 bytes for NEAR_CURVE_SECP256K1
   const uint8_t *key;
 } near_key;
 
@@ -145,22 +146,29 @@ typedef struct near_transfer {
 
 /// ref: https://nomicon.io/RuntimeSpec/Actions#stakeaction
 typedef struct near_stake {
-  // TODO
+  uint8_t amount[NEAR_DEPOSIT_SIZE_BYTES];
+  near_key public_key;
 } near_stake;
 
 /// ref: https://nomicon.io/RuntimeSpec/Actions#addkeyaction
 typedef struct near_add_key {
-  // TODO
+  near_key public_key;
+  uint8_t full_access;
+  /// contract the key is allowed to call; valid if full_access is zero
+  uint32_t receiver_id_length;
+  const char *receiver_id;
+  uint32_t method_names_count;
 } near_add_key;
 
 /// ref: https://nomicon.io/RuntimeSpec/Actions#deletekeyaction
 typedef struct near_del_key {
-  // TODO
+  near_key public_key;
 } near_del_key;
 
 /// ref: https://nomicon.io/RuntimeSpec/Actions#deleteaccountaction
 typedef struct near_del_acc {
-  // TODO
+  uint32_t beneficiary_id_length;
+  const char *beneficiary_id;
 } near_del_acc;
 
 /// ref: https://nomicon.io/RuntimeSpec/Actions#functioncallaction
@@ -173,6 +181,19 @@ typedef struct near_fn_call {
   uint8_t deposit[NEAR_DEPOSIT_SIZE_BYTES];
 } near_fn_call;
 
+/// A decoded action; the variable length fields refer the transaction bytes
+typedef struct near_action_view {
+  uint8_t type;
+  union {
+    near_transfer transfer;
+    near_fn_call fn_call;
+    near_stake stake;
+    near_add_key add_key;
+    near_del_key del_key;
+    near_del_acc del_acc;
+  } action;
+} near_action_view;
+
 typedef struct near_unsigned_txn {
   uint32_t receiver_id_length;
   uint32_t signer_id_length;
@@ -182,11 +203,9 @@ typedef struct near_unsigned_txn {
   const uint8_t *blockhash;
   uint8_t nonce[NEAR_NONCE_SIZE_BYTES];
   uint32_t action_count;
-  uint8_t actions_type;
-  union {
-    near_transfer transfer;
-    near_fn_call fn_call;
-  } action;
+  /// Borsh encoded actions; decode with near_action_iterator_next()
+  const uint8_t *actions;
+  uint32_t actions_size;
 } near_unsigned_txn;
 
 /*****************************************************************************
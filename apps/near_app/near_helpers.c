@@ -133,16 +133,12 @@ void near_get_new_account_id_from_fn_args(const char *args,
 void get_amount_string(const uint8_t *amount,
                        char *string,
                        size_t size_of_string) {
-  char amount_string[40] = "";
   char amount_decimal_string[40] = "";
-  byte_array_to_hex_string(
-      amount, NEAR_DEPOSIT_SIZE_BYTES, amount_string, sizeof(amount_string));
-
-  convert_byte_array_to_decimal_string(NEAR_DEPOSIT_SIZE_BYTES * 2,
-                                       NEAR_DECIMAL,
-                                       amount_string,
-                                       amount_decimal_string,
-                                       sizeof(amount_decimal_string));
+  byte_array_to_decimal_string(amount,
+                               NEAR_DEPOSIT_SIZE_BYTES,
+                               NEAR_DECIMAL,
+                               amount_decimal_string,
+                               sizeof(amount_decimal_string));
 
   snprintf(string,
            size_of_string,
@@ -168,6 +168,13 @@ static bool send_public_keys(near_query_t *query,
                              const pb_size_t which_request,
                              const pb_size_t which_response);
 
+/**
+ * @brief Accessor of the derivation paths for @ref hd_path_sort_order
+ */
+static const uint32_t *get_derivation_path(const void *paths,
+                                           size_t index,
+                                           size_t *path_length);
+
 /**
  * @details The function provides an ED25519 public key for NEAR. It accepts
  * NULL for output parameter and handles accordingly. The function also manages
@@ -177,14 +184,14 @@ static bool send_public_keys(near_query_t *query,
  * as unknown_error = 1 because we expect the data validation was success.
  * TODO: Make this a common utility function
  *
- * @param seed Reference to the wallet seed generated
+ * @param cache Reference to the derivation cache of the wallet seed
  * @param path Derivation path of the node to be derived
  * @param path_length Expected length of the provided derivation path
  * @param public_key Storage location for raw uncompressed public key
  *
  * @retval false If derivation failed
  */
-static bool get_public_key(const uint8_t *seed,
+static bool get_public_key(hd_path_cache_t *cache,
                            const uint32_t *path,
                            uint32_t path_length,
                            uint8_t *public_key);
@@ -255,21 +262,31 @@ static bool validate_request(const near_get_public_keys_intiate_request_t *req,
   return status;
 }
 
-static bool get_public_key(const uint8_t *seed,
+static const uint32_t *get_derivation_path(const void *paths,
+                                           size_t index,
+                                           size_t *path_length) {
+  const near_get_public_keys_derivation_path_t *path =
+      (const near_get_public_keys_derivation_path_t *)paths + index;
+  *path_length = path->path_count;
+  return path->path;
+}
+
+static bool get_public_key(hd_path_cache_t *cache,
                            const uint32_t *path,
                            uint32_t path_length,
                            uint8_t *public_key) {
   HDNode node = {0};
 
-  if (!derive_hdnode_from_path(path, path_length, ED25519_NAME, seed, &node)) {
+  if (!hd_path_cache_derive(cache, path, path_length, &node)) {
     // send unknown error; unknown failure reason
     near_send_error(ERROR_COMMON_ERROR_UNKNOWN_ERROR_TAG, 1);
     memzero(&node, sizeof(HDNode));
     return false;
   }
 
+  // the cache already filled the public key of the node; skip recomputing it
   if (NULL != public_key) {
-    ed25519_publickey(node.private_key, public_key);
+    memcpy(public_key, node.public_key + 1, sizeof(ed25519_public_key));
   }
 
   memzero(&node, sizeof(HDNode));
@@ -280,15 +297,24 @@ static bool fill_public_keys(const near_get_public_keys_derivation_path_t *path,
                              const uint8_t *seed,
                              uint8_t public_key_list[][NEAR_PUB_KEY_SIZE],
                              pb_size_t count) {
-  for (pb_size_t index = 0; index < count; index++) {
-    const near_get_public_keys_derivation_path_t *current = &path[index];
-    if (!get_public_key(
-            seed, current->path, current->path_count, public_key_list[index])) {
-      return false;
-    }
+  hd_path_cache_t cache = {0};
+  uint16_t order[pb_arraysize(near_get_public_keys_intiate_request_t,
+                              derivation_paths)] = {0};
+  bool status = true;
+
+  // derive in sorted order so that shared path prefixes are derived once
+  hd_path_cache_init(&cache, ED25519_NAME, seed);
+  hd_path_sort_order(path, count, get_derivation_path, order);
+  for (pb_size_t index = 0; index < count && status; index++) {
+    const near_get_public_keys_derivation_path_t *current = &path[order[index]];
+    status = get_public_key(&cache,
+                            current->path,
+                            current->path_count,
+                            public_key_list[order[index]]);
   }
+  hd_path_cache_clear(&cache);
 
-  return true;
+  return status;
 }
 
 static bool send_public_keys(near_query_t *query,
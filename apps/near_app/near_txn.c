@@ -294,23 +294,7 @@ static bool fetch_valid_input(near_query_t *query) {
 
 static bool get_user_verification(void) {
   const near_unsigned_txn *decoded_utxn = &near_txn_context->decoded_txn;
-  bool user_verified = false;
-
-  switch (decoded_utxn->actions_type) {
-    case NEAR_ACTION_TRANSFER: {
-      user_verified = user_verification_transfer(decoded_utxn);
-      break;
-    }
-    case NEAR_ACTION_FUNCTION_CALL: {
-      user_verified = user_verification_function(decoded_utxn);
-      break;
-    }
-    default: {
-      // Parsing will fail if an unsupported action type is identified from
-      // the unsigned transaction. So no need to do anything
-      break;
-    }
-  }
+  const bool user_verified = user_verification_actions(decoded_utxn);
 
   if (user_verified) {
     set_app_flow_status(NEAR_SIGN_TXN_STATUS_VERIFY);
@@ -342,16 +326,16 @@ static bool sign_txn(uint8_t *signature_buffer) {
                           seed,
                           &t_node);
 
-  ed25519_public_key public_key = {0};
-  ed25519_publickey(t_node.private_key, public_key);
-
-  ed25519_sign(
-      digest, sizeof(digest), t_node.private_key, public_key, signature_buffer);
+  // the derivation already filled the public key (prefixed by 0x01)
+  ed25519_sign(digest,
+               sizeof(digest),
+               t_node.private_key,
+               t_node.public_key + 1,
+               signature_buffer);
 
   memzero(digest, sizeof(digest));
   memzero(seed, sizeof(seed));
   memzero(&t_node, sizeof(t_node));
-  memzero(public_key, sizeof(public_key));
 
   return true;
 }
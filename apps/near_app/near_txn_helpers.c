@@ -91,10 +91,122 @@
  * STATIC FUNCTION PROTOTYPES
  *****************************************************************************/
 
+/**
+ * @brief Takes the next size bytes from the cursor
+ *
+ * @param cursor Reference to the read position; advanced past the bytes
+ * @param end End of the readable bytes
+ * @param size Number of bytes to take
+ * @return const uint8_t* Start of the bytes, NULL if out of bounds
+ */
+static const uint8_t *near_take(const uint8_t **cursor,
+                                const uint8_t *end,
+                                uint32_t size);
+
+/**
+ * @brief Reads a Borsh string or byte vector (u32 length followed by bytes)
+ *
+ * @param cursor Reference to the read position; advanced past the field
+ * @param end End of the readable bytes
+ * @param length Storage for the length of the field
+ * @param bytes Storage for the start of the field; refers the read bytes
+ * @return bool Indicating if the field was within bounds
+ */
+static bool near_read_bytes(const uint8_t **cursor,
+                            const uint8_t *end,
+                            uint32_t *length,
+                            const uint8_t **bytes);
+
+/**
+ * @brief Reads a Borsh encoded public key (key type followed by the key)
+ *
+ * @param cursor Reference to the read position; advanced past the key
+ * @param end End of the readable bytes
+ * @param key Storage for the key; refers the read bytes
+ * @return bool Indicating if the key was valid and within bounds
+ */
+static bool near_read_key(const uint8_t **cursor,
+                          const uint8_t *end,
+                          near_key *key);
+
+/**
+ * @brief Reads a little-endian integer and stores it in big-endian order
+ *
+ * @param cursor Reference to the read position; advanced past the integer
+ * @param end End of the readable bytes
+ * @param value Storage for the integer
+ * @param size Size of the integer in bytes
+ * @return bool Indicating if the integer was within bounds
+ */
+static bool near_read_reversed(const uint8_t **cursor,
+                               const uint8_t *end,
+                               uint8_t *value,
+                               uint32_t size);
+
 /*****************************************************************************
  * STATIC FUNCTIONS
  *****************************************************************************/
 
+static const uint8_t *near_take(const uint8_t **cursor,
+                                const uint8_t *end,
+                                uint32_t size) {
+  const uint8_t *start = *cursor;
+  if (start > end || (uint32_t)(end - start) < size) {
+    return NULL;
+  }
+  *cursor += size;
+  return start;
+}
+
+static bool near_read_bytes(const uint8_t **cursor,
+                            const uint8_t *end,
+                            uint32_t *length,
+                            const uint8_t **bytes) {
+  const uint8_t *field = near_take(cursor, end, 4);
+  if (NULL == field) {
+    return false;
+  }
+  *length = U32_READ_LE_ARRAY(field);
+  *bytes = near_take(cursor, end, *length);
+  return NULL != *bytes;
+}
+
+static bool near_read_key(const uint8_t **cursor,
+                          const uint8_t *end,
+                          near_key *key) {
+  const uint8_t *field = near_take(cursor, end, 1);
+  if (NULL == field) {
+    return false;
+  }
+
+  key->key_type = *field;
+  switch (key->key_type) {
+    case NEAR_CURVE_ED25519:
+      key->key = near_take(cursor, end, 32);
+      break;
+    case NEAR_CURVE_SECP256K1:
+      key->key = near_take(cursor, end, 64);
+      break;
+    default:
+      key->key = NULL;
+      break;
+  }
+  return NULL != key->key;
+}
+
+static bool near_read_reversed(const uint8_t **cursor,
+                               const uint8_t *end,
+                               uint8_t *value,
+                               uint32_t size) {
+  const uint8_t *field = near_take(cursor, end, size);
+  if (NULL == field) {
+    return false;
+  }
+  memcpy(value, field, size);
+  cy_reverse_byte_array(value, size);
+  return true;
+}
+
 /*****************************************************************************
  * GLOBAL FUNCTIONS
  *****************************************************************************/
@@ -102,90 +214,177 @@ bool near_parse_transaction(const uint8_t *byte_array,
                             uint16_t byte_array_size,
                             near_unsigned_txn *utxn) {
   if (byte_array == NULL || utxn == NULL)
-    return;
+    return false;
   memzero(utxn, sizeof(near_unsigned_txn));
 
-  uint16_t offset = 0;
-
-  utxn->signer_id_length = U32_READ_LE_ARRAY(byte_array);
-  offset += 4;
-  utxn->signer = (byte_array + offset);
-  offset += utxn->signer_id_length;
-  utxn->signer_key.key_type = byte_array[offset++];
-  utxn->signer_key.key = (byte_array + offset);
-  offset += 32;
-  memcpy(utxn->nonce, byte_array + offset, sizeof(utxn->nonce));
-  offset += 8;
-  utxn->receiver_id_length = U32_READ_LE_ARRAY(byte_array + offset);
-  offset += 4;
-  utxn->receiver = (byte_array + offset);
-  offset += utxn->receiver_id_length;
-  utxn->blockhash = (byte_array + offset);
-  offset += 32;
-  utxn->action_count = U32_READ_LE_ARRAY(byte_array + offset);
-  offset += 4;
-  utxn->actions_type = byte_array[offset++];
-
-  // Currently, our decoder only supports 1 action
-  if (1 < utxn->action_count) {
+  const uint8_t *cursor = byte_array;
+  const uint8_t *end = byte_array + byte_array_size;
+  const uint8_t *field = NULL;
+
+  if (!near_read_bytes(&cursor, end, &utxn->signer_id_length, &utxn->signer) ||
+      !near_read_key(&cursor, end, &utxn->signer_key) ||
+      !near_read_reversed(&cursor, end, utxn->nonce, sizeof(utxn->nonce)) ||
+      !near_read_bytes(
+          &cursor, end, &utxn->receiver_id_length, &utxn->receiver)) {
     return false;
   }
 
-  switch (utxn->actions_type) {
-    case NEAR_ACTION_TRANSFER: {
-      memcpy(utxn->action.transfer.amount,
-             byte_array + offset,
-             sizeof(utxn->action.transfer.amount));
-      cy_reverse_byte_array(utxn->action.transfer.amount,
-                            sizeof(utxn->action.transfer.amount));
+  utxn->blockhash = near_take(&cursor, end, 32);
+  field = near_take(&cursor, end, 4);
+  if (NULL == utxn->blockhash || NULL == field) {
+    return false;
+  }
+  utxn->action_count = U32_READ_LE_ARRAY(field);
+  if (0 == utxn->action_count) {
+    return false;
+  }
+
+  utxn->actions = cursor;
+  utxn->actions_size = end - cursor;
+
+  // Walk all the actions once so that verification only sees valid actions
+  near_action_iterator iterator = {0};
+  near_action_view action = {0};
+  near_action_iterator_init(&iterator, utxn);
+  while (near_action_iterator_next(&iterator, &action)) {
+    // Contract code cannot be presented to the user for verification
+    if (NEAR_ACTION_DEPLOY_CONTRACT == action.type) {
+      return false;
+    }
+  }
+
+  // Bytes after the last action would be signed without being shown
+  return 0 == iterator.remaining && iterator.cursor == end;
+}
+
+void near_action_iterator_init(near_action_iterator *iterator,
+                               const near_unsigned_txn *utxn) {
+  iterator->cursor = utxn->actions;
+  iterator->end = utxn->actions + utxn->actions_size;
+  iterator->remaining = utxn->action_count;
+}
+
+bool near_action_iterator_next(near_action_iterator *iterator,
+                               near_action_view *action) {
+  if (NULL == iterator || NULL == action || 0 == iterator->remaining) {
+    return false;
+  }
+  memzero(action, sizeof(near_action_view));
+
+  const uint8_t *cursor = iterator->cursor;
+  const uint8_t *end = iterator->end;
+  const uint8_t *field = near_take(&cursor, end, 1);
+  uint32_t length = 0;
+  bool status = false;
+
+  if (NULL == field) {
+    return false;
+  }
+  action->type = *field;
+
+  switch (action->type) {
+    case NEAR_ACTION_CREATE_ACCOUNT: {
+      status = true;
+      break;
+    }
+
+    case NEAR_ACTION_DEPLOY_CONTRACT: {
+      // only walked past; the code is not decoded
+      status = near_read_bytes(&cursor, end, &length, &field);
       break;
     }
 
     case NEAR_ACTION_FUNCTION_CALL: {
-      utxn->action.fn_call.method_name_length =
-          U32_READ_LE_ARRAY(byte_array + offset);
-      offset += 4;
-      utxn->action.fn_call.method_name = (char *)(byte_array + offset);
-      offset += utxn->action.fn_call.method_name_length;
-
-      // As of now, we only support signing of create_account method
-      if (0 != strncmp(utxn->action.fn_call.method_name,
-                       ui_text_near_create_account_method,
-                       utxn->action.fn_call.method_name_length)) {
-        return false;
+      near_fn_call *fn_call = &action->action.fn_call;
+      if (!near_read_bytes(
+              &cursor, end, &fn_call->method_name_length, &field)) {
+        break;
       }
+      fn_call->method_name = (const char *)field;
+      status = near_read_bytes(
+                   &cursor, end, &fn_call->args_length, &fn_call->args) &&
+               near_read_reversed(
+                   &cursor, end, fn_call->gas, sizeof(fn_call->gas)) &&
+               near_read_reversed(
+                   &cursor, end, fn_call->deposit, sizeof(fn_call->deposit));
+      break;
+    }
 
-      utxn->action.fn_call.args_length = U32_READ_LE_ARRAY(byte_array + offset);
-      offset += 4;
-      utxn->action.fn_call.args = (byte_array + offset);
-      offset += utxn->action.fn_call.args_length;
-      memcpy(utxn->action.fn_call.gas,
-             byte_array + offset,
-             sizeof(utxn->action.fn_call.gas));
-      cy_reverse_byte_array(utxn->action.fn_call.gas,
-                            sizeof(utxn->action.fn_call.gas));
-      offset += 8;
-      memcpy(utxn->action.fn_call.deposit,
-             byte_array + offset,
-             sizeof(utxn->action.fn_call.deposit));
-      cy_reverse_byte_array(utxn->action.fn_call.deposit,
-                            sizeof(utxn->action.fn_call.deposit));
+    case NEAR_ACTION_TRANSFER: {
+      near_transfer *transfer = &action->action.transfer;
+      status = near_read_reversed(
+          &cursor, end, transfer->amount, sizeof(transfer->amount));
+      break;
+    }
+
+    case NEAR_ACTION_STAKE: {
+      near_stake *stake = &action->action.stake;
+      status = near_read_reversed(
+                   &cursor, end, stake->amount, sizeof(stake->amount)) &&
+               near_read_key(&cursor, end, &stake->public_key);
+      break;
+    }
+
+    case NEAR_ACTION_ADD_KEY: {
+      near_add_key *add_key = &action->action.add_key;
+      // public key, followed by access key nonce & permission
+      if (!near_read_key(&cursor, end, &add_key->public_key) ||
+          NULL == near_take(&cursor, end, NEAR_NONCE_SIZE_BYTES) ||
+          NULL == (field = near_take(&cursor, end, 1))) {
+        break;
+      }
+
+      if (1 == *field) {
+        add_key->full_access = 1;
+        status = true;
+        break;
+      }
+      if (0 != *field || NULL == (field = near_take(&cursor, end, 1))) {
+        break;
+      }
+
+      // function call permission: optional allowance, receiver & methods
+      if ((0 != *field && NULL == near_take(&cursor, end, 16)) ||
+          !near_read_bytes(
+              &cursor, end, &add_key->receiver_id_length, &field)) {
+        break;
+      }
+      add_key->receiver_id = (const char *)field;
+
+      if (NULL == (field = near_take(&cursor, end, 4))) {
+        break;
+      }
+      add_key->method_names_count = U32_READ_LE_ARRAY(field);
+      status = true;
+      for (uint32_t i = 0; status && i < add_key->method_names_count; i++) {
+        status = near_read_bytes(&cursor, end, &length, &field);
+      }
+      break;
+    }
+
+    case NEAR_ACTION_DELETE_KEY: {
+      status = near_read_key(&cursor, end, &action->action.del_key.public_key);
+      break;
+    }
+
+    case NEAR_ACTION_DELETE_ACCOUNT: {
+      near_del_acc *del_acc = &action->action.del_acc;
+      status = near_read_bytes(
+          &cursor, end, &del_acc->beneficiary_id_length, &field);
+      del_acc->beneficiary_id = (const char *)field;
       break;
     }
 
     default: {
-      return false;
       break;
     }
   }
 
-  // Reverse byte order
-  cy_reverse_byte_array(utxn->nonce, sizeof(utxn->nonce));
-
-  // TODO: Offset validation should occur at every read
-  if (offset <= byte_array_size) {
-    return true;
+  if (!status) {
+    return false;
   }
 
-  return false;
+  iterator->cursor = cursor;
+  iterator->remaining--;
+  return true;
 }
@@ -25,6 +25,18 @@
  * TYPEDEFS
  *****************************************************************************/
 
+/**
+ * @brief Cursor over the Borsh encoded actions of a NEAR transaction
+ * @details The actions are decoded in place one at a time; nothing is copied
+ * out of the transaction except the fixed size amounts. Refer
+ * @ref near_action_iterator_init for usage.
+ */
+typedef struct near_action_iterator {
+  const uint8_t *cursor;
+  const uint8_t *end;
+  uint32_t remaining;
+} near_action_iterator;
+
 /*****************************************************************************
  * EXPORTED VARIABLES
  *****************************************************************************/
@@ -35,7 +47,9 @@
 /**
  * @brief Parse byte array of unsigned txn and store decoded information to be
  * used for user confirmation.
- * @details Only a limited number of action types are supported by this decoder.
+ * @details Every action of the transaction is walked once to validate it; the
+ * actions are not stored but can be decoded again with near_action_iterator.
+ * NEAR_ACTION_DEPLOY_CONTRACT is not supported by this decoder.
  *
  * @param byte_array Constant reference to buffer containing the raw unsigned
  * txn
@@ -44,10 +58,31 @@
  * It can be used at a later stage for user verification.
  * @return true If the parsing was successful
  * @return false If the parsing failed - it could be due to an unsupported
- * action type or missing information
+ * action type, missing information or bytes left after the last action
  */
 bool near_parse_transaction(const uint8_t *byte_array,
                             uint16_t byte_array_size,
                             near_unsigned_txn *utxn);
 
+/**
+ * @brief Points the iterator at the first action of the parsed transaction
+ *
+ * @param iterator Reference to the iterator to initialize
+ * @param utxn Transaction populated by near_parse_transaction()
+ */
+void near_action_iterator_init(near_action_iterator *iterator,
+                               const near_unsigned_txn *utxn);
+
+/**
+ * @brief Decodes the next action and moves the iterator past it
+ *
+ * @param iterator Reference to an initialized iterator
+ * @param action Storage for the decoded action
+ * @return true If an action was decoded
+ * @return false If all the actions were decoded or the next action is
+ * malformed; iterator->remaining is non-zero in the later case
+ */
+bool near_action_iterator_next(near_action_iterator *iterator,
+                               near_action_view *action);
+
 #endif /* NEAR_TXN_HELPERS_H */
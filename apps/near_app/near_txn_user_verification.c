@@ -64,11 +64,14 @@
 
 #include <stdint.h>
 
+#include "base58.h"
 #include "constant_texts.h"
 #include "near_api.h"
 #include "near_context.h"
 #include "near_helpers.h"
 #include "near_priv.h"
+#include "near_txn_helpers.h"
+#include "near_txn_user_verification.h"
 #include "ui_core_confirm.h"
 
 /*****************************************************************************
@@ -87,6 +90,48 @@
  * STATIC FUNCTION PROTOTYPES
  *****************************************************************************/
 
+/**
+ * @brief Shows the review prompt naming the action to be verified
+ *
+ * @param action_name Name of the action or method
+ * @param length Number of characters of action_name to show
+ * @return bool Indicating if the user accepted the prompt
+ */
+static bool review_action(const char *action_name, uint32_t length);
+
+/**
+ * @brief Formats the public key as "<curve>:<base58 key>"
+ *
+ * @param key The key to format
+ * @param string Storage for the formatted key
+ * @param size Size of string
+ * @return bool Indicating if the key was formatted
+ */
+static bool get_public_key_string(const near_key *key,
+                                  char *string,
+                                  size_t size);
+
+/**
+ * @brief Performs user verification flow for the actions which carry a public
+ * key, i.e. NEAR_ACTION_STAKE, NEAR_ACTION_ADD_KEY & NEAR_ACTION_DELETE_KEY
+ *
+ * @param action The decoded action
+ * @return bool Indicating if the user accepted the action
+ */
+static bool user_verification_key(const near_action_view *action);
+
+/**
+ * @brief Performs user verification flow for the actions which operate on the
+ * receiver account, i.e. NEAR_ACTION_CREATE_ACCOUNT &
+ * NEAR_ACTION_DELETE_ACCOUNT
+ *
+ * @param decoded_utxn The transaction the action belongs to
+ * @param action The decoded action
+ * @return bool Indicating if the user accepted the action
+ */
+static bool user_verification_account(const near_unsigned_txn *decoded_utxn,
+                                      const near_action_view *action);
+
 /*****************************************************************************
  * STATIC VARIABLES
  *****************************************************************************/
@@ -99,10 +144,124 @@
  * STATIC FUNCTIONS
  *****************************************************************************/
 
+static bool review_action(const char *action_name, uint32_t length) {
+  char name[NEAR_ACC_ID_MAX_LEN + 1] = "";
+  char transaction[100] = "";
+
+  snprintf(name, sizeof(name), "%.*s", (int)length, action_name);
+  snprintf(transaction, sizeof(transaction), UI_TEXT_REVIEW_TXN_PROMPT, name);
+  return core_scroll_page(NULL, transaction, near_send_error);
+}
+
+static bool get_public_key_string(const near_key *key,
+                                  char *string,
+                                  size_t size) {
+  const char *curve = "ed25519:";
+  size_t key_size = 32;
+
+  if (NEAR_CURVE_SECP256K1 == key->key_type) {
+    curve = "secp256k1:";
+    key_size = 64;
+  }
+
+  size_t prefix_length = strnlen(curve, size);
+  size_t b58_size = size - prefix_length;
+  if (prefix_length >= size) {
+    return false;
+  }
+  memcpy(string, curve, prefix_length);
+  return b58enc(&string[prefix_length], &b58_size, key->key, key_size);
+}
+
+static bool user_verification_key(const near_action_view *action) {
+  const near_key *public_key = NULL;
+  const char *action_name = NULL;
+  char key[120] = "";
+  char value[100] = "";
+
+  switch (action->type) {
+    case NEAR_ACTION_STAKE:
+      public_key = &action->action.stake.public_key;
+      action_name = ui_text_near_stake_action_type;
+      break;
+    case NEAR_ACTION_ADD_KEY:
+      public_key = &action->action.add_key.public_key;
+      action_name = ui_text_near_add_key_action_type;
+      break;
+    case NEAR_ACTION_DELETE_KEY:
+    default:
+      public_key = &action->action.del_key.public_key;
+      action_name = ui_text_near_delete_key_action_type;
+      break;
+  }
+
+  if (!get_public_key_string(public_key, key, sizeof(key))) {
+    near_send_error(ERROR_COMMON_ERROR_UNKNOWN_ERROR_TAG, 1);
+    return false;
+  }
+
+  if (!review_action(action_name, strlen(action_name)) ||
+      !core_scroll_page(ui_text_verify_public_key, key, near_send_error)) {
+    return false;
+  }
+
+  if (NEAR_ACTION_STAKE == action->type) {
+    get_amount_string(action->action.stake.amount, value, sizeof(value));
+    return core_confirmation(value, near_send_error);
+  }
+
+  if (NEAR_ACTION_ADD_KEY == action->type) {
+    const near_add_key *add_key = &action->action.add_key;
+    if (add_key->full_access) {
+      snprintf(value, sizeof(value), "%s", ui_text_near_full_access);
+    } else {
+      snprintf(value,
+               sizeof(value),
+               "%.*s",
+               (int)add_key->receiver_id_length,
+               add_key->receiver_id);
+    }
+    return core_scroll_page(ui_text_verify_permission, value, near_send_error);
+  }
+
+  return true;
+}
+
+static bool user_verification_account(const near_unsigned_txn *decoded_utxn,
+                                      const near_action_view *action) {
+  char address[200] = "";
+  char beneficiary[200] = "";
+
+  snprintf(address,
+           sizeof(address),
+           "%.*s",
+           (int)decoded_utxn->receiver_id_length,
+           decoded_utxn->receiver);
+
+  if (NEAR_ACTION_CREATE_ACCOUNT == action->type) {
+    return review_action(ui_text_near_create_account_method,
+                         strlen(ui_text_near_create_account_method)) &&
+           core_scroll_page(
+               ui_text_verify_new_account_id, address, near_send_error);
+  }
+
+  snprintf(beneficiary,
+           sizeof(beneficiary),
+           "%.*s",
+           (int)action->action.del_acc.beneficiary_id_length,
+           action->action.del_acc.beneficiary_id);
+  return review_action(ui_text_near_delete_account_action_type,
+                       strlen(ui_text_near_delete_account_action_type)) &&
+         core_scroll_page(ui_text_verify_address, address, near_send_error) &&
+         core_scroll_page(
+             ui_text_verify_beneficiary, beneficiary, near_send_error);
+}
+
 /*****************************************************************************
  * GLOBAL FUNCTIONS
  *****************************************************************************/
-bool user_verification_transfer(const near_unsigned_txn *decoded_utxn) {
+bool user_verification_transfer(const near_unsigned_txn *decoded_utxn,
+                                const near_action_view *action) {
   char transaction[100] = "";
   char address[200] = "";
   char value[100] = "";
@@ -117,7 +276,7 @@ bool user_verification_transfer(const near_unsigned_txn *decoded_utxn) {
            "%s",
            decoded_utxn->receiver);
 
-  get_amount_string(decoded_utxn->action.transfer.amount, value, sizeof(value));
+  get_amount_string(action->action.transfer.amount, value, sizeof(value));
 
   if (!core_scroll_page(NULL, transaction, near_send_error) ||
       !core_scroll_page(ui_text_verify_address, address, near_send_error) ||
@@ -128,12 +287,32 @@ bool user_verification_transfer(const near_unsigned_txn *decoded_utxn) {
   return true;
 }
 
-bool user_verification_function(const near_unsigned_txn *decoded_utxn) {
+bool user_verification_function(const near_unsigned_txn *decoded_utxn,
+                                const near_action_view *action) {
+  const near_fn_call *fn_call = &action->action.fn_call;
   char transaction[100] = "";
   char address[200] = "";
   char account[200] = "";
   char value[100] = "";
 
+  get_amount_string(fn_call->deposit, value, sizeof(value));
+
+  if (fn_call->method_name_length !=
+          strlen(ui_text_near_create_account_method) ||
+      0 != strncmp(fn_call->method_name,
+                   ui_text_near_create_account_method,
+                   fn_call->method_name_length)) {
+    snprintf(address,
+             sizeof(address),
+             "%.*s",
+             (int)decoded_utxn->receiver_id_length,
+             decoded_utxn->receiver);
+    return review_action(fn_call->method_name, fn_call->method_name_length) &&
+           core_scroll_page(
+               ui_text_verify_contract, address, near_send_error) &&
+           core_confirmation(value, near_send_error);
+  }
+
   snprintf(transaction,
            sizeof(transaction),
            UI_TEXT_REVIEW_TXN_PROMPT,
@@ -145,11 +324,7 @@ bool user_verification_function(const near_unsigned_txn *decoded_utxn) {
            decoded_utxn->signer);
 
   near_get_new_account_id_from_fn_args(
-      (const char *)decoded_utxn->action.fn_call.args,
-      decoded_utxn->action.fn_call.args_length,
-      account);
-
-  get_amount_string(decoded_utxn->action.fn_call.deposit, value, sizeof(value));
+      (const char *)fn_call->args, fn_call->args_length, account);
 
   if (!core_scroll_page(NULL, transaction, near_send_error) ||
       !core_scroll_page(ui_text_verify_create_from, address, near_send_error) ||
@@ -160,4 +335,42 @@ bool user_verification_function(const near_unsigned_txn *decoded_utxn) {
   }
 
   return true;
-}
\ No newline at end of file
+}
+
+bool user_verification_actions(const near_unsigned_txn *decoded_utxn) {
+  near_action_iterator iterator = {0};
+  near_action_view action = {0};
+  bool user_verified = true;
+
+  near_action_iterator_init(&iterator, decoded_utxn);
+  while (user_verified && near_action_iterator_next(&iterator, &action)) {
+    switch (action.type) {
+      case NEAR_ACTION_TRANSFER: {
+        user_verified = user_verification_transfer(decoded_utxn, &action);
+        break;
+      }
+      case NEAR_ACTION_FUNCTION_CALL: {
+        user_verified = user_verification_function(decoded_utxn, &action);
+        break;
+      }
+      case NEAR_ACTION_STAKE:
+      case NEAR_ACTION_ADD_KEY:
+      case NEAR_ACTION_DELETE_KEY: {
+        user_verified = user_verification_key(&action);
+        break;
+      }
+      case NEAR_ACTION_CREATE_ACCOUNT:
+      case NEAR_ACTION_DELETE_ACCOUNT: {
+        user_verified = user_verification_account(decoded_utxn, &action);
+        break;
+      }
+      default: {
+        // Parsing fails for the actions that cannot be verified
+        user_verified = false;
+        break;
+      }
+    }
+  }
+
+  return user_verified && 0 == iterator.remaining;
+}
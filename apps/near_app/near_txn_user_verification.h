@@ -37,22 +37,42 @@
  * USB host
  *
  * @param decoded_utxn
+ * @param action The transfer action decoded from decoded_utxn
  * @return true If the user accepted the transaction and is safe to proceed with
  * signing
  * @return false If the user rejected any step or a P0 event occurred
  */
-bool user_verification_transfer(const near_unsigned_txn *decoded_utxn);
+bool user_verification_transfer(const near_unsigned_txn *decoded_utxn,
+                                const near_action_view *action);
 
 /**
  * @brief Performs user verification flow for the NEAR function action
+ * @details The create_account method of the registrar shows the new account
+ * id; any other method shows the called contract.
  * @note If the user rejects at any step, a rejection message is sent to the
  * USB host
  *
  * @param decoded_utxn
+ * @param action The function call action decoded from decoded_utxn
  * @return true If the user accepted the transaction and is safe to proceed with
  * signing
  * @return false If the user rejected any step or a P0 event occurred
  */
-bool user_verification_function(const near_unsigned_txn *decoded_utxn);
+bool user_verification_function(const near_unsigned_txn *decoded_utxn,
+                                const near_action_view *action);
+
+/**
+ * @brief Performs user verification flow for all the actions of the NEAR
+ * transaction
+ * @details The actions are decoded one at a time with near_action_iterator and
+ * verified in the order of the transaction.
+ * @note If the user rejects at any step, a rejection message is sent to the
+ * USB host
+ *
+ * @param decoded_utxn Transaction populated by near_parse_transaction()
+ * @return true If the user accepted all the actions
+ * @return false If the user rejected any step or a P0 event occurred
+ */
+bool user_verification_actions(const near_unsigned_txn *decoded_utxn);
 
 #endif /* NEAR_TXN_USER_VERIFICATION_H */
@@ -68,6 +68,7 @@
 #include "common_error.h"
 #include "core_api.h"
 #include "events.h"
+#include "session_bench.h"
 
 /*****************************************************************************
  * EXTERN VARIABLES
@@ -169,11 +170,10 @@ void solana_send_error(pb_size_t which_error, uint32_t error_code) {
 }
 
 void solana_send_result(const solana_result_t *result) {
-  // TODO: Set the options file for all
-  uint8_t buffer[1700] = {0};
-  size_t bytes_encoded = 0;
-  ASSERT(encode_solana_result(result, buffer, sizeof(buffer), &bytes_encoded));
-  send_response_to_host(&buffer[0], bytes_encoded);
+  // Encoded straight into the usb buffer, after the core message
+  pb_ostream_t stream = begin_response_to_host();
+  ASSERT(pb_encode(&stream, SOLANA_RESULT_FIELDS, result));
+  end_response_to_host(&stream);
 }
 
 bool solana_get_query(solana_query_t *query, pb_size_t exp_query_tag) {
@@ -183,6 +183,7 @@ bool solana_get_query(solana_query_t *query, pb_size_t exp_query_tag) {
     return false;
   }
 
+  SESSION_BENCH_ENTER(SESSION_PHASE_PARSING);
   if (!decode_solana_query(
           event.usb_event.p_msg, event.usb_event.msg_size, query)) {
     return false;
@@ -92,7 +92,8 @@ void solana_send_error(pb_size_t which_error, uint32_t error_code);
  * @details If the encoding is successful, then it sends the corresponding
  * result to the host.
  *
- * The function ASSERTs the result of encode_solana_result internally.
+ * The result is encoded in place in the usb buffer; the function ASSERTs the
+ * encoding internally.
  *
  * @param result The result which needs to be sent to the host.
  */
@@ -61,10 +61,12 @@
  *****************************************************************************/
 
 #include "reconstruct_wallet_flow.h"
+#include "session_bench.h"
 #include "solana_api.h"
 #include "solana_helpers.h"
 #include "solana_priv.h"
 #include "status_api.h"
+#include "txn_pool.h"
 #include "ui_core_confirm.h"
 #include "ui_screens.h"
 #include "wallet_list.h"
@@ -154,6 +156,18 @@ STATIC bool solana_handle_initiate_query(const solana_query_t *query);
  */
 STATIC bool solana_fetch_valid_transaction(solana_query_t *query);
 
+/**
+ * @brief Converts the lamports into a decimal string in SOL
+ *
+ * @param lamports The amount in lamports
+ * @param amount Storage for the decimal string
+ * @param amount_size Size of amount
+ * @return bool Indicating if the conversion succeeded
+ */
+static bool lamports_to_string(uint64_t lamports,
+                               char *amount,
+                               size_t amount_size);
+
 /**
  * @brief Aggregates user consent for the transaction info
  * @details The function decodes the receiver address along with the
@@ -281,12 +295,19 @@ STATIC bool solana_fetch_valid_transaction(solana_query_t *query) {
   uint32_t size = 0;
   solana_result_t response = init_solana_result(SOLANA_RESULT_SIGN_TXN_TAG);
   uint32_t total_size = solana_txn_context->init_info.transaction_size;
+  uint8_t *transaction = NULL;
   const solana_sign_txn_data_t *txn_data = &query->sign_txn.txn_data;
   const common_chunk_payload_t *payload = &txn_data->chunk_payload;
   const common_chunk_payload_chunk_t *chunk = &txn_data->chunk_payload.chunk;
 
   // allocate memory for storing transaction
-  solana_txn_context->transaction = (uint8_t *)malloc(total_size);
+  transaction = TXN_POOL_NEW(uint8_t, total_size);
+  if (NULL == transaction) {
+    solana_send_error(ERROR_COMMON_ERROR_CORRUPT_DATA_TAG,
+                      ERROR_DATA_FLOW_INVALID_DATA);
+    return false;
+  }
+  solana_txn_context->transaction = transaction;
   while (1) {
     if (!solana_get_query(query, SOLANA_QUERY_SIGN_TXN_TAG) ||
         !check_which_request(query, SOLANA_SIGN_TXN_REQUEST_TXN_DATA_TAG)) {
@@ -301,7 +322,7 @@ STATIC bool solana_fetch_valid_transaction(solana_query_t *query) {
       return false;
     }
 
-    memcpy(&solana_txn_context->transaction[size], chunk->bytes, chunk->size);
+    memcpy(&transaction[size], chunk->bytes, chunk->size);
     size += chunk->size;
     // Send chunk ack to host
     response.sign_txn.which_response =
@@ -325,65 +346,73 @@ STATIC bool solana_fetch_valid_transaction(solana_query_t *query) {
   }
 
   // decode and verify the received transaction
-  if (SOL_OK != solana_byte_array_to_unsigned_txn(
-                    solana_txn_context->transaction,
-                    total_size,
-                    &solana_txn_context->transaction_info) ||
-      SOL_OK !=
-          solana_validate_unsigned_txn(&solana_txn_context->transaction_info)) {
+  solana_unsigned_txn *utxn = &solana_txn_context->transaction_info;
+  if (SOL_OK !=
+          solana_byte_array_to_unsigned_txn(transaction, total_size, utxn) ||
+      SOL_OK != solana_validate_unsigned_txn(utxn)) {
     return false;
   }
 
   return true;
 }
 
-STATIC bool solana_get_user_verification() {
-  char address[45] = {0};
-  size_t address_size = sizeof(address);
-
-  // verify recipient address;
-  if (!b58enc(address,
-              &address_size,
-              solana_txn_context->transaction_info.instruction.program.transfer
-                  .recipient_account,
-              SOLANA_ACCOUNT_ADDRESS_LENGTH)) {
-    solana_send_error(ERROR_COMMON_ERROR_UNKNOWN_ERROR_TAG, 2);
-    return false;
-  }
-
-  if (!core_scroll_page(ui_text_verify_address, address, solana_send_error)) {
-    return false;
-  }
-
-  // verify recipient amount
-  char amount_string[40] = {'\0'}, amount_decimal_string[30] = {'\0'};
-  char display[100] = "";
-
+static bool lamports_to_string(uint64_t lamports,
+                               char *amount,
+                               size_t amount_size) {
+  char amount_string[40] = {'\0'};
   uint8_t be_lamports[8] = {0};
   int i = 8;
   while (i--)
-    be_lamports[i] = solana_txn_context->transaction_info.instruction.program
-                         .transfer.lamports >>
-                     8 * (7 - i);
+    be_lamports[i] = lamports >> 8 * (7 - i);
 
   byte_array_to_hex_string(
       be_lamports, 8, amount_string, sizeof(amount_string));
-  if (!convert_byte_array_to_decimal_string(16,
-                                            solana_get_decimal(),
-                                            amount_string,
-                                            amount_decimal_string,
-                                            sizeof(amount_decimal_string))) {
-    solana_send_error(ERROR_COMMON_ERROR_UNKNOWN_ERROR_TAG, 1);
-    return false;
-  }
+  return convert_byte_array_to_decimal_string(
+      16, solana_get_decimal(), amount_string, amount, amount_size);
+}
 
-  snprintf(display,
-           sizeof(display),
-           UI_TEXT_VERIFY_AMOUNT,
-           amount_decimal_string,
-           SOLANA_LUNIT);
-  if (!core_confirmation(display, solana_send_error)) {
-    return false;
+STATIC bool solana_get_user_verification() {
+  const solana_unsigned_txn *utxn = &solana_txn_context->transaction_info;
+
+  // each instruction is a validated transfer; verify them in order
+  for (uint16_t index = 0; index < utxn->instructions_count; index++) {
+    const solana_transfer_data *transfer =
+        &utxn->instructions[index].program.transfer;
+    char address[45] = {0};
+    size_t address_size = sizeof(address);
+
+    // verify recipient address;
+    if (!b58enc(address,
+                &address_size,
+                transfer->recipient_account,
+                SOLANA_ACCOUNT_ADDRESS_LENGTH)) {
+      solana_send_error(ERROR_COMMON_ERROR_UNKNOWN_ERROR_TAG, 2);
+      return false;
+    }
+
+    if (!core_scroll_page(ui_text_verify_address, address, solana_send_error)) {
+      return false;
+    }
+
+    // verify recipient amount
+    char amount_decimal_string[30] = {'\0'};
+    char display[100] = "";
+
+    if (!lamports_to_string(transfer->lamports,
+                            amount_decimal_string,
+                            sizeof(amount_decimal_string))) {
+      solana_send_error(ERROR_COMMON_ERROR_UNKNOWN_ERROR_TAG, 1);
+      return false;
+    }
+
+    snprintf(display,
+             sizeof(display),
+             UI_TEXT_VERIFY_AMOUNT,
+             amount_decimal_string,
+             SOLANA_LUNIT);
+    if (!core_confirmation(display, solana_send_error)) {
+      return false;
+    }
   }
 
   set_app_flow_status(SOLANA_SIGN_TXN_STATUS_VERIFY);
@@ -396,6 +425,7 @@ STATIC bool fetch_seed(solana_query_t *query, uint8_t *seed_out) {
     return false;
   }
 
+  SESSION_BENCH_ENTER(SESSION_PHASE_DERIVATION);
   if (!reconstruct_seed(solana_txn_context->init_info.wallet_id,
                         seed_out,
                         solana_send_error)) {
@@ -434,17 +464,19 @@ static bool send_signature(solana_query_t *query,
     return false;
 
   // sign updated transaction
+  SESSION_BENCH_ENTER(SESSION_PHASE_DERIVATION);
   if (!derive_hdnode_from_path(hd_path, depth, ED25519_NAME, seed, &hdnode))
     return false;
 
+  SESSION_BENCH_ENTER(SESSION_PHASE_SIGNING);
   ed25519_sign(solana_txn_context->transaction,
                solana_txn_context->init_info.transaction_size,
                hdnode.private_key,
                hdnode.public_key + 1,
                sig->signature);
+  SESSION_BENCH_ENTER(SESSION_PHASE_OTHER);
 
   memzero(&hdnode, sizeof(hdnode));
-  memzero(seed, sizeof(seed));
 
   memcpy(&result.sign_txn.signature,
          sig,
@@ -459,25 +491,20 @@ static bool send_signature(solana_query_t *query,
  *****************************************************************************/
 
 void solana_sign_transaction(solana_query_t *query) {
-  solana_txn_context =
-      (solana_txn_context_t *)malloc(sizeof(solana_txn_context_t));
-  memzero(solana_txn_context, sizeof(solana_txn_context_t));
+  solana_txn_context = TXN_POOL_NEW(solana_txn_context_t, 1);
+  ASSERT(NULL != solana_txn_context);
   solana_sign_txn_signature_response_t sig = {0};
   uint8_t seed[64] = {0};
 
   if (solana_handle_initiate_query(query) &&
-      solana_fetch_valid_transaction(query) && solana_get_user_verification() &&
-      fetch_seed(query, seed) && send_signature(query, seed, &sig)) {
+      solana_fetch_valid_transaction(query) &&
+      solana_get_user_verification() && fetch_seed(query, seed) &&
+      send_signature(query, seed, &sig)) {
     delay_scr_init(ui_text_check_cysync, DELAY_TIME);
   }
 
   memzero(seed, sizeof(seed));
 
-  if (NULL != solana_txn_context->transaction) {
-    free(solana_txn_context->transaction);
-  }
-  if (NULL != solana_txn_context) {
-    free(solana_txn_context);
-    solana_txn_context = NULL;
-  }
+  txn_pool_release();
+  solana_txn_context = NULL;
 }
\ No newline at end of file
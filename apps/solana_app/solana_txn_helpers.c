@@ -81,6 +81,39 @@
  * STATIC FUNCTION PROTOTYPES
  *****************************************************************************/
 
+/**
+ * @brief Decodes the instruction at the offset of the byte array
+ * @details The decoded instruction refers to the byte array instead of holding
+ * a copy of its account indices and data.
+ *
+ * @param [in] byte_array Byte array of unsigned transaction
+ * @param [in] byte_array_size Size of byte array
+ * @param offset Offset of the instruction; updated to the end of instruction
+ * @param [in] utxn The transaction with the account addresses decoded
+ * @param [out] instruction Storage for the decoded instruction
+ *
+ * @return int Status of decoding
+ * @retval SOL_OK if successful
+ */
+static int solana_parse_instruction(uint8_t *byte_array,
+                                    uint16_t byte_array_size,
+                                    uint16_t *offset,
+                                    const solana_unsigned_txn *utxn,
+                                    solana_instruction *instruction);
+
+/**
+ * @brief Checks if the instruction is a system program transfer that can be
+ * signed
+ *
+ * @param utxn The transaction the instruction belongs to
+ * @param instruction The instruction to validate
+ *
+ * @return int Status of validation
+ * @retval SOL_OK if the instruction is a valid transfer
+ */
+static int solana_validate_instruction(const solana_unsigned_txn *utxn,
+                                       const solana_instruction *instruction);
+
 /*****************************************************************************
  * STATIC VARIABLES
  *****************************************************************************/
@@ -93,6 +126,105 @@
  * STATIC FUNCTIONS
  *****************************************************************************/
 
+static int solana_parse_instruction(uint8_t *byte_array,
+                                    uint16_t byte_array_size,
+                                    uint16_t *offset,
+                                    const solana_unsigned_txn *utxn,
+                                    solana_instruction *instruction) {
+  int error = 0;
+
+  if (*offset >= byte_array_size)
+    return SOL_D_READ_SIZE_MISMATCH;
+
+  instruction->program_id_index = *(byte_array + (*offset)++);
+
+  *offset +=
+      get_compact_array_size(byte_array + *offset,
+                             &(instruction->account_addresses_index_count),
+                             &error);
+  if (error != SOL_OK)
+    return error;
+  if (instruction->account_addresses_index_count == 0)
+    return SOL_D_MIN_LENGTH;
+
+  instruction->account_addresses_index = byte_array + *offset;
+  *offset += instruction->account_addresses_index_count;
+  *offset += get_compact_array_size(
+      byte_array + *offset, &(instruction->opaque_data_length), &error);
+  if (error != SOL_OK)
+    return error;
+  if (instruction->opaque_data_length == 0)
+    return SOL_D_MIN_LENGTH;
+
+  instruction->opaque_data = byte_array + *offset;
+  *offset += instruction->opaque_data_length;
+  if (*offset > byte_array_size)
+    return SOL_D_READ_SIZE_MISMATCH;
+
+  if (instruction->opaque_data_length < sizeof(uint32_t))
+    return SOL_OK;
+  uint32_t instruction_enum = U32_READ_LE_ARRAY(instruction->opaque_data);
+
+  uint8_t system_program_id[SOLANA_ACCOUNT_ADDRESS_LENGTH] = {
+      0};    // System instruction address
+  if (instruction->program_id_index < utxn->account_addresses_count &&
+      memcmp(utxn->account_addresses +
+                 instruction->program_id_index * SOLANA_ACCOUNT_ADDRESS_LENGTH,
+             system_program_id,
+             SOLANA_ACCOUNT_ADDRESS_LENGTH) == 0) {
+    switch (instruction_enum) {
+      case SSI_TRANSFER:    // transfer instruction
+        if (instruction->account_addresses_index_count < 2 ||
+            instruction->opaque_data_length < 12)
+          break;
+        instruction->program.transfer.funding_account =
+            utxn->account_addresses +
+            (*(instruction->account_addresses_index + 0) *
+             SOLANA_ACCOUNT_ADDRESS_LENGTH);
+        instruction->program.transfer.recipient_account =
+            utxn->account_addresses +
+            (*(instruction->account_addresses_index + 1) *
+             SOLANA_ACCOUNT_ADDRESS_LENGTH);
+        instruction->program.transfer.lamports =
+            U64_READ_LE_ARRAY(instruction->opaque_data + 4);
+        break;
+
+      default:
+        break;
+    }
+  }
+
+  return SOL_OK;
+}
+
+static int solana_validate_instruction(const solana_unsigned_txn *utxn,
+                                       const solana_instruction *instruction) {
+  if (!(0 < instruction->program_id_index &&
+        instruction->program_id_index < utxn->account_addresses_count))
+    return SOL_V_INDEX_OUT_OF_RANGE;
+
+  uint8_t system_program_id[SOLANA_ACCOUNT_ADDRESS_LENGTH] = {
+      0};    // System instruction address
+  if (memcmp(utxn->account_addresses +
+                 instruction->program_id_index * SOLANA_ACCOUNT_ADDRESS_LENGTH,
+             system_program_id,
+             SOLANA_ACCOUNT_ADDRESS_LENGTH) != 0)
+    return SOL_V_UNSUPPORTED_PROGRAM;
+
+  if (instruction->opaque_data_length < 12 ||
+      U32_READ_LE_ARRAY(instruction->opaque_data) != SSI_TRANSFER)
+    return SOL_V_UNSUPPORTED_INSTRUCTION;
+
+  // transfer instruction refers funding & recipient accounts
+  if (instruction->account_addresses_index_count < 2 ||
+      instruction->account_addresses_index[0] >=
+          utxn->account_addresses_count ||
+      instruction->account_addresses_index[1] >= utxn->account_addresses_count)
+    return SOL_V_INDEX_OUT_OF_RANGE;
+
+  return SOL_OK;
+}
+
 /*****************************************************************************
  * GLOBAL FUNCTIONS
  *****************************************************************************/
@@ -148,63 +280,21 @@ int solana_byte_array_to_unsigned_txn(uint8_t *byte_array,
   utxn->blockhash = byte_array + offset;
   offset += SOLANA_BLOCKHASH_LENGTH;
 
-  // Instructions: Currently expecting count to be only 1. TODO: Handle batch
-  // instructions
+  // Instructions
   offset += get_compact_array_size(
       byte_array + offset, &(utxn->instructions_count), &error);
   if (error != SOL_OK)
     return error;
   if (utxn->instructions_count == 0)
     return SOL_D_MIN_LENGTH;
+  if (utxn->instructions_count > SOLANA_MAX_INSTRUCTIONS)
+    return SOL_V_UNSUPPORTED_INSTRUCTION_COUNT;
 
-  utxn->instruction.program_id_index = *(byte_array + offset++);
-
-  offset +=
-      get_compact_array_size(byte_array + offset,
-                             &(utxn->instruction.account_addresses_index_count),
-                             &error);
-  if (error != SOL_OK)
-    return error;
-  if (utxn->instruction.account_addresses_index_count == 0)
-    return SOL_D_MIN_LENGTH;
-
-  utxn->instruction.account_addresses_index = byte_array + offset;
-  offset += utxn->instruction.account_addresses_index_count;
-  offset += get_compact_array_size(
-      byte_array + offset, &(utxn->instruction.opaque_data_length), &error);
-  if (error != SOL_OK)
-    return error;
-  if (utxn->instruction.opaque_data_length == 0)
-    return SOL_D_MIN_LENGTH;
-
-  utxn->instruction.opaque_data = byte_array + offset;
-  offset += utxn->instruction.opaque_data_length;
-
-  uint32_t instruction_enum = U32_READ_LE_ARRAY(utxn->instruction.opaque_data);
-
-  uint8_t system_program_id[SOLANA_ACCOUNT_ADDRESS_LENGTH] = {
-      0};    // System instruction address
-  if (memcmp(utxn->account_addresses + utxn->instruction.program_id_index *
-                                           SOLANA_ACCOUNT_ADDRESS_LENGTH,
-             system_program_id,
-             SOLANA_ACCOUNT_ADDRESS_LENGTH) == 0) {
-    switch (instruction_enum) {
-      case SSI_TRANSFER:    // transfer instruction
-        utxn->instruction.program.transfer.funding_account =
-            utxn->account_addresses +
-            (*(utxn->instruction.account_addresses_index + 0) *
-             SOLANA_ACCOUNT_ADDRESS_LENGTH);
-        utxn->instruction.program.transfer.recipient_account =
-            utxn->account_addresses +
-            (*(utxn->instruction.account_addresses_index + 1) *
-             SOLANA_ACCOUNT_ADDRESS_LENGTH);
-        utxn->instruction.program.transfer.lamports =
-            U64_READ_LE_ARRAY(utxn->instruction.opaque_data + 4);
-        break;
-
-      default:
-        break;
-    }
+  for (uint16_t i = 0; i < utxn->instructions_count; i++) {
+    error = solana_parse_instruction(
+        byte_array, byte_array_size, &offset, utxn, &utxn->instructions[i]);
+    if (error != SOL_OK)
+      return error;
   }
 
   return ((offset <= byte_array_size) && (offset > 0))
@@ -213,30 +303,14 @@ int solana_byte_array_to_unsigned_txn(uint8_t *byte_array,
 }
 
 int solana_validate_unsigned_txn(const solana_unsigned_txn *utxn) {
-  if (utxn->instructions_count != 1)
+  if (utxn->instructions_count == 0 ||
+      utxn->instructions_count > SOLANA_MAX_INSTRUCTIONS)
     return SOL_V_UNSUPPORTED_INSTRUCTION_COUNT;
 
-  if (!(0 < utxn->instruction.program_id_index &&
-        utxn->instruction.program_id_index < utxn->account_addresses_count))
-    return SOL_V_INDEX_OUT_OF_RANGE;
-
-  uint32_t instruction_enum = U32_READ_LE_ARRAY(utxn->instruction.opaque_data);
-
-  uint8_t system_program_id[SOLANA_ACCOUNT_ADDRESS_LENGTH] = {
-      0};    // System instruction address
-  if (memcmp(utxn->account_addresses + utxn->instruction.program_id_index *
-                                           SOLANA_ACCOUNT_ADDRESS_LENGTH,
-             system_program_id,
-             SOLANA_ACCOUNT_ADDRESS_LENGTH) == 0) {
-    switch (instruction_enum) {
-      case SSI_TRANSFER:    // transfer instruction
-        break;
-      default:
-        return SOL_V_UNSUPPORTED_INSTRUCTION;
-        break;
-    }
-  } else {
-    return SOL_V_UNSUPPORTED_PROGRAM;
+  for (uint16_t i = 0; i < utxn->instructions_count; i++) {
+    int error = solana_validate_instruction(utxn, &utxn->instructions[i]);
+    if (error != SOL_OK)
+      return error;
   }
   return SOL_OK;
 }
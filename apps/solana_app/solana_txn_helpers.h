@@ -28,6 +28,11 @@
 #define SOLANA_ACCOUNT_ADDRESS_LENGTH 32
 #define SOLANA_BLOCKHASH_LENGTH 32
 
+/// Maximum number of instructions decoded from a single transaction
+#ifndef SOLANA_MAX_INSTRUCTIONS
+#define SOLANA_MAX_INSTRUCTIONS 8
+#endif
+
 /*****************************************************************************
  * TYPEDEFS
  *****************************************************************************/
@@ -73,6 +78,7 @@ typedef struct solana_transfer_data {
 
 // Reference :
 // https://docs.solana.com/developing/programming-model/transactions#instruction-format
+// The index & data slices point into the byte array of the transaction
 typedef struct solana_instruction {
   uint8_t program_id_index;
   uint16_t account_addresses_index_count;
@@ -96,9 +102,8 @@ typedef struct solana_unsigned_txn {
 
   uint8_t *blockhash;
 
-  uint16_t
-      instructions_count;    // deserialization only supports single instruction
-  solana_instruction instruction;
+  uint16_t instructions_count;
+  solana_instruction instructions[SOLANA_MAX_INSTRUCTIONS];
 
 } solana_unsigned_txn;
 
@@ -125,7 +130,9 @@ uint16_t get_compact_array_size(const uint8_t *data,
 /**
  * @brief Convert byte array representation of unsigned transaction to
  * solana_unsigned_txn.
- * @details
+ * @details The instructions are decoded in place; the addresses, indices and
+ * data referred by utxn point into byte_array, hence byte_array must outlive
+ * utxn. At most SOLANA_MAX_INSTRUCTIONS instructions are accepted.
  *
  * @param [in] byte_array                   Byte array of unsigned transaction.
  * @param [in] byte_array_size              Size of byte array.
@@ -134,7 +141,9 @@ uint16_t get_compact_array_size(const uint8_t *data,
  *
  * @return Status of conversion
  * @retval 0 if successful
- * @retval -1 if unsuccessful
+ * @retval SOL_V_UNSUPPORTED_INSTRUCTION_COUNT if the instructions are more
+ * than SOLANA_MAX_INSTRUCTIONS
+ * @retval Other error code from SOLANA_ERROR_CODES if unsuccessful
  *
  * @see
  * @since v1.0.0
@@ -147,6 +156,7 @@ int solana_byte_array_to_unsigned_txn(uint8_t *byte_array,
 
 /**
  * @brief Validate the deserialized unsigned transaction
+ * @details Each of the instructions must be a transfer of the system program.
  *
  * @param utxn Pointer to the solana_unsigned_txn instance to validate the
  * transaction
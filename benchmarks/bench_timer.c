@@ -1,7 +1,7 @@
 /**
- * @file    avalanche_app.c
+ * @file    bench_timer.c
  * @author  Cypherock X1 Team
- * @brief   Avalanche application configuration and helpers
+ * @brief   Timer shared by the benchmarks of the device and the simulator
  * @copyright Copyright (c) 2023 HODL TECH PTE LTD
  * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
  *target=_blank>https://mitcc.org/</a>
@@ -56,30 +56,22 @@
  ******************************************************************************
  */
 
+
 /*****************************************************************************
  * INCLUDES
  *****************************************************************************/
+#include "bench_timer.h"
 
-#include "avalanche_app.h"
-
-#include <stddef.h>
-
-#include "evm_main.h"
+#if USE_SIMULATOR == 0
+#include "board.h"
+#else
+#include <time.h>
+#endif
 
 /*****************************************************************************
  * EXTERN VARIABLES
  *****************************************************************************/
 
-/**
- * @brief Whitelisted contracts with respective token symbol
- * @details A map of Ethereum contract addresses with their token symbols. These
- * will enable the device to verify the ERC20 token transaction in a
- * user-friendly manner.
- *
- * @see erc20_contracts_t
- */
-extern const erc20_contracts_t avalanche_contracts[];
-
 /*****************************************************************************
  * PRIVATE MACROS AND DEFINES
  *****************************************************************************/
@@ -92,44 +84,10 @@ extern const erc20_contracts_t avalanche_contracts[];
  * STATIC FUNCTION PROTOTYPES
  *****************************************************************************/
 
-/**
- * @brief Checks if the provided token address is whitelisted and return the
- * matching contract instance.
- *
- * @param address Reference to the buffer containing the token address
- * @param contract Pointer to store the matched contract address instance
- *
- * @return bool Indicating if the provided token address is whitelisted
- * @return true If the address matches to an entry in the whitelist
- * @return false If the address does not match to an entry in the whitelist
- */
-static bool is_token_whitelisted(const uint8_t *address,
-                                 const erc20_contracts_t **contract);
-
 /*****************************************************************************
  * STATIC VARIABLES
  *****************************************************************************/
 
-static const evm_config_t avalanche_app_config = {
-    .lunit_name = "AVAX",
-    .name = "Avalanche (C-Chain)",
-    .chain_id = 43114,
-
-    // whitelisted contracts
-    .is_token_whitelisted = is_token_whitelisted,
-};
-
-static const cy_app_desc_t avalanche_app_desc = {
-    .id = 13,
-    .version =
-        {
-            .major = 1,
-            .minor = 0,
-            .patch = 0,
-        },
-    .app = evm_main,
-    .app_config = &avalanche_app_config};
-
 /*****************************************************************************
  * GLOBAL VARIABLES
  *****************************************************************************/
@@ -138,18 +96,43 @@ static const cy_app_desc_t avalanche_app_desc = {
  * STATIC FUNCTIONS
  *****************************************************************************/
 
-static bool is_token_whitelisted(const uint8_t *address,
-                                 const erc20_contracts_t **contract) {
-  if (NULL != contract) {
-    *contract = NULL;
-  }
-  return false;
-}
-
 /*****************************************************************************
  * GLOBAL FUNCTIONS
  *****************************************************************************/
 
-const cy_app_desc_t *get_avalanche_app_desc() {
-  return &avalanche_app_desc;
-}
\ No newline at end of file
+#if USE_SIMULATOR == 0
+void bench_timer_start(void) {
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+uint64_t bench_timer_stamp(void) {
+  return DWT->CYCCNT;
+}
+
+uint64_t bench_timer_elapsed(uint64_t start) {
+  return (uint32_t)(DWT->CYCCNT - (uint32_t)start);
+}
+
+uint64_t bench_timer_to_ns(uint64_t elapsed) {
+  return elapsed * 1000 / (SystemCoreClock / 1000000);
+}
+#else
+void bench_timer_start(void) {
+}
+
+uint64_t bench_timer_stamp(void) {
+  struct timespec now = {0};
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec;
+}
+
+uint64_t bench_timer_elapsed(uint64_t start) {
+  return bench_timer_stamp() - start;
+}
+
+uint64_t bench_timer_to_ns(uint64_t elapsed) {
+  return elapsed;
+}
+#endif /* USE_SIMULATOR == 0 */
@@ -1,28 +1,23 @@
 /**
- * @file    fantom_app.h
+ * @file    bench_timer.h
  * @author  Cypherock X1 Team
- * @brief   Fantom application configuration
+ * @brief   Timer shared by the benchmarks of the device and the simulator
  * @copyright Copyright (c) 2023 HODL TECH PTE LTD
  * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
  * target=_blank>https://mitcc.org/</a>
  */
-#ifndef FANTOM_APP_H
-#define FANTOM_APP_H
+#ifndef BENCH_TIMER_H
+#define BENCH_TIMER_H
 
 /*****************************************************************************
  * INCLUDES
  *****************************************************************************/
-
-#include "app_registry.h"
-#include "evm_context.h"
+#include <stdint.h>
 
 /*****************************************************************************
  * MACROS AND DEFINES
  *****************************************************************************/
 
-/// Number of entries in whitelisted contracts list
-#define FANTOM_WHITELISTED_CONTRACTS_COUNT 0
-
 /*****************************************************************************
  * TYPEDEFS
  *****************************************************************************/
@@ -36,10 +31,30 @@
  *****************************************************************************/
 
 /**
- * @brief Returns the config for Fantom chin app descriptor
+ * @brief Starts the DWT cycle counter on the device, nothing on the simulator
+ */
+void bench_timer_start(void);
+
+/**
+ * @brief Returns the current time: cycles on the device, nanoseconds of the
+ * monotonic clock on the simulator
+ */
+uint64_t bench_timer_stamp(void);
+
+/**
+ * @brief Returns the time elapsed since the stamp, in the unit of
+ * bench_timer_stamp(). The cycle counter wraps after 53 s at 80 MHz, far
+ * above any benchmark.
+ *
+ * @param start Stamp returned by bench_timer_stamp()
+ */
+uint64_t bench_timer_elapsed(uint64_t start);
+
+/**
+ * @brief Converts an elapsed time of bench_timer_elapsed() to nanoseconds
  *
- * @return A const reference to cy_app_desc_t
+ * @param elapsed Elapsed time, in the unit of bench_timer_stamp()
  */
-const cy_app_desc_t *get_fantom_app_desc();
+uint64_t bench_timer_to_ns(uint64_t elapsed);
 
-#endif    // FANTOM_APP_H
+#endif /* BENCH_TIMER_H */
@@ -0,0 +1,123 @@
+/**
+ * @file    benchmarks_main.c
+ * @author  Cypherock X1 Team
+ * @brief   Entry point of the benchmark build
+ * @copyright Copyright (c) 2023 HODL TECH PTE LTD
+ * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
+ *target=_blank>https://mitcc.org/</a>
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * (c) Copyright 2023 by HODL TECH PTE LTD
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * "Commons Clause" License Condition v1.0
+ *
+ * The Software is provided to you by the Licensor under the License,
+ * as defined below, subject to the following condition.
+ *
+ * Without limiting other conditions in the License, the grant of
+ * rights under the License will not include, and the License does not
+ * grant to you, the right to Sell the Software.
+ *
+ * For purposes of the foregoing, "Sell" means practicing any or all
+ * of the rights granted to you under the License to provide to third
+ * parties, for a fee or other consideration (including without
+ * limitation fees for hosting or consulting/ support services related
+ * to the Software), a product or service whose value derives, entirely
+ * or substantially, from the functionality of the Software. Any license
+ * notice or attribution required by the License must also include
+ * this Commons Clause License Condition notice.
+ *
+ * Software: All X1Wallet associated files.
+ * License: MIT
+ * Licensor: HODL TECH PTE LTD
+ *
+ ******************************************************************************
+ */
+
+
+/*****************************************************************************
+ * INCLUDES
+ *****************************************************************************/
+#define SDL_MAIN_HANDLED /*To fix SDL's "undefined reference to WinMain"       \
+                            issue*/
+#include "application_startup.h"
+#include "crypto_benchmarks.h"
+#include "proto_benchmarks.h"
+
+#if USE_SIMULATOR == 1
+#ifdef _WIN32
+#define main SDL_main
+#endif
+#endif /* USE_SIMULATOR == 1 */
+
+/*****************************************************************************
+ * GLOBAL FUNCTIONS
+ *****************************************************************************/
+
+/**
+ * @brief  The entry point of the benchmark build
+ * This entry point is a parallel entry point to the int main(void) of the
+ * actual firmware. The results are kept in the device logs; flash the main
+ * firmware afterwards to fetch them, or read them over SWV meanwhile.
+ */
+int main(void) {
+  application_init();
+
+  crypto_benchmarks_run(NULL, 0);
+  proto_benchmarks_run(NULL, 0);
+
+#if USE_SIMULATOR == 0
+  while (1) {
+  }
+#endif
+  return 0;
+}
+
+#if USE_SIMULATOR == 0
+/**
+ * @brief  This function is executed in case of error occurrence.
+ * @retval None
+ */
+void Error_Handler(void) {
+  __disable_irq();
+  while (1) {
+  }
+}
+
+/**
+ * @brief Function to transmit data in real-time over SWV channel
+ * @param file unused
+ * @param *ptr string pointer for data to send
+ * @param len  length of data to send
+ *
+ * @ret len of data transmitted
+ */
+int _write(int file, char *ptr, int len) {
+  for (int DataIdx = 0; DataIdx < len; DataIdx++) {
+    ITM_SendChar(*ptr++);
+  }
+  return len;
+}
+#endif /* USE_SIMULATOR == 0 */
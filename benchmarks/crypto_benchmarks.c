@@ -0,0 +1,337 @@
+/**
+ * @file    crypto_benchmarks.c
+ * @author  Cypherock X1 Team
+ * @brief   Timing of the crypto primitives on the device and the simulator
+ * @copyright Copyright (c) 2023 HODL TECH PTE LTD
+ * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
+ *target=_blank>https://mitcc.org/</a>
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * (c) Copyright 2023 by HODL TECH PTE LTD
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * "Commons Clause" License Condition v1.0
+ *
+ * The Software is provided to you by the Licensor under the License,
+ * as defined below, subject to the following condition.
+ *
+ * Without limiting other conditions in the License, the grant of
+ * rights under the License will not include, and the License does not
+ * grant to you, the right to Sell the Software.
+ *
+ * For purposes of the foregoing, "Sell" means practicing any or all
+ * of the rights granted to you under the License to provide to third
+ * parties, for a fee or other consideration (including without
+ * limitation fees for hosting or consulting/ support services related
+ * to the Software), a product or service whose value derives, entirely
+ * or substantially, from the functionality of the Software. Any license
+ * notice or attribution required by the License must also include
+ * this Commons Clause License Condition notice.
+ *
+ * Software: All X1Wallet associated files.
+ * License: MIT
+ * Licensor: HODL TECH PTE LTD
+ *
+ ******************************************************************************
+ */
+
+
+/*****************************************************************************
+ * INCLUDES
+ *****************************************************************************/
+#include "crypto_benchmarks.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "aes/aes.h"
+#include "base58.h"
+#include "bench_timer.h"
+#include "bip32.h"
+#include "curves.h"
+#include "ecdsa.h"
+#include "ed25519.h"
+#include "hasher.h"
+#include "hmac.h"
+#include "logger.h"
+#include "pbkdf2.h"
+#include "secp256k1.h"
+#include "sha2.h"
+#include "sha3.h"
+#include "usb_api_priv.h"
+
+/*****************************************************************************
+ * EXTERN VARIABLES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * PRIVATE MACROS AND DEFINES
+ *****************************************************************************/
+
+/// Bytes processed per iteration by the bulk primitives (AES, CRC)
+#define BENCH_BULK_SIZE 1024
+
+/*****************************************************************************
+ * PRIVATE TYPEDEFS
+ *****************************************************************************/
+
+/**
+ * @brief A primitive of the suite
+ * @details setup (optional) prepares the inputs outside of the timed section;
+ * run executes the primitive once.
+ */
+typedef struct bench_case {
+  const char *name;
+  uint32_t iterations;
+  void (*setup)(void);
+  void (*run)(void);
+} bench_case_t;
+
+/*****************************************************************************
+ * STATIC FUNCTION PROTOTYPES
+ *****************************************************************************/
+
+static void setup_inputs(void);
+static void setup_hdnode(void);
+static void setup_aes(void);
+static void setup_ed25519(void);
+static void run_sha256_transform(void);
+static void run_sha512_transform(void);
+static void run_keccak_256(void);
+static void run_hmac_sha512(void);
+static void run_hash160(void);
+static void run_pbkdf2(void);
+static void run_ecdsa_sign_digest(void);
+static void run_hdnode_private_ckd(void);
+static void run_ed25519_sign(void);
+static void run_ed25519_sign_expanded(void);
+static void run_aes_cbc(void);
+static void run_crc16(void);
+static void run_crc16_bitwise(void);
+static void run_base58(void);
+
+/*****************************************************************************
+ * STATIC VARIABLES
+ *****************************************************************************/
+
+/// Iterations are picked so that each primitive runs for a fraction of a
+/// second on the device
+static const bench_case_t bench_cases[] = {
+    {"sha256_Transform", 2000, setup_inputs, run_sha256_transform},
+    {"sha512_Transform", 1000, setup_inputs, run_sha512_transform},
+    {"keccak_256_64B", 500, setup_inputs, run_keccak_256},
+    {"hmac_sha512_64B", 200, setup_inputs, run_hmac_sha512},
+    {"hash160_33B", 500, setup_inputs, run_hash160},
+    {"pbkdf2_sha512_2048", 1, setup_inputs, run_pbkdf2},
+    {"ecdsa_sign_digest", 5, setup_inputs, run_ecdsa_sign_digest},
+    {"hdnode_private_ckd", 5, setup_hdnode, run_hdnode_private_ckd},
+    {"ed25519_sign_64B", 5, setup_inputs, run_ed25519_sign},
+    {"ed25519_sign_expanded_64B", 5, setup_ed25519, run_ed25519_sign_expanded},
+    {"aes256_cbc_1KB", 50, setup_aes, run_aes_cbc},
+    {"crc16_1KB", 50, setup_inputs, run_crc16},
+    {"crc16_bitwise_1KB", 50, setup_inputs, run_crc16_bitwise},
+    {"base58_encode_32B", 50, setup_inputs, run_base58},
+};
+
+/// Word aligned, the transforms read it as 32/64-bit words
+static uint8_t data[BENCH_BULK_SIZE] __attribute__((aligned(8)));
+static uint8_t out[BENCH_BULK_SIZE];
+static const uint8_t key[32] = {
+    0x1f, 0x3a, 0x5c, 0x7e, 0x91, 0xb3, 0xd5, 0xf7, 0x08, 0x2a, 0x4c,
+    0x6e, 0x80, 0xa2, 0xc4, 0xe6, 0x19, 0x3b, 0x5d, 0x7f, 0x92, 0xb4,
+    0xd6, 0xf8, 0x0a, 0x2c, 0x4e, 0x60, 0x83, 0xa5, 0xc7, 0xe9};
+static ed25519_public_key ed25519_pk;
+static ed25519_expanded_secret_key ed25519_sk;
+static HDNode node;
+static aes_encrypt_ctx aes_ctx;
+/// Collects a byte of each output so that no primitive is optimized out
+static volatile uint8_t sink;
+
+/*****************************************************************************
+ * STATIC FUNCTIONS
+ *****************************************************************************/
+
+static void setup_inputs(void) {
+  for (uint32_t i = 0; i < sizeof(data); i++) {
+    data[i] = (uint8_t)(i * 31 + 7);
+  }
+  ed25519_publickey(key, ed25519_pk);
+}
+
+static void setup_hdnode(void) {
+  setup_inputs();
+  hdnode_from_seed(data, 64, SECP256K1_NAME, &node);
+}
+
+static void setup_aes(void) {
+  setup_inputs();
+  aes_init();
+  aes_encrypt_key256(key, &aes_ctx);
+}
+
+static void setup_ed25519(void) {
+  setup_inputs();
+  ed25519_expand_secret_key(key, ed25519_sk);
+}
+
+static void run_sha256_transform(void) {
+  uint32_t state[8] = {0};
+  sha256_Transform(state, (const uint32_t *)data, state);
+  sink ^= (uint8_t)state[0];
+}
+
+static void run_sha512_transform(void) {
+  uint64_t state[8] = {0};
+  sha512_Transform(state, (const uint64_t *)data, state);
+  sink ^= (uint8_t)state[0];
+}
+
+static void run_keccak_256(void) {
+  keccak_256(data, 64, out);
+  sink ^= out[0];
+}
+
+static void run_hmac_sha512(void) {
+  hmac_sha512(key, sizeof(key), data, 64, out);
+  sink ^= out[0];
+}
+
+static void run_hash160(void) {
+  hasher_Raw(HASHER_SHA2_RIPEMD, data, 33, out);
+  sink ^= out[0];
+}
+
+static void run_pbkdf2(void) {
+  pbkdf2_hmac_sha512(key, sizeof(key), data, 16, 2048, out, 64);
+  sink ^= out[0];
+}
+
+static void run_ecdsa_sign_digest(void) {
+  uint8_t sig[64] = {0};
+  ecdsa_sign_digest(&secp256k1, key, data, sig, NULL, NULL);
+  sink ^= sig[0];
+}
+
+static void run_hdnode_private_ckd(void) {
+  HDNode child = node;
+  hdnode_private_ckd(&child, 0x80000000 | 44);
+  sink ^= child.private_key[0];
+}
+
+static void run_ed25519_sign(void) {
+  ed25519_signature sig = {0};
+  ed25519_sign(data, 64, key, ed25519_pk, sig);
+  sink ^= sig[0];
+}
+
+static void run_ed25519_sign_expanded(void) {
+  ed25519_signature sig = {0};
+  ed25519_sign_expanded(data, 64, ed25519_sk, ed25519_pk, sig);
+  sink ^= sig[0];
+}
+
+static void run_aes_cbc(void) {
+  uint8_t iv[16] = {0};
+  aes_cbc_encrypt(data, out, BENCH_BULK_SIZE, iv, &aes_ctx);
+  sink ^= out[0];
+}
+
+static void run_crc16(void) {
+  sink ^= (uint8_t)comm_crc16(data, BENCH_BULK_SIZE);
+}
+
+static void run_crc16_bitwise(void) {
+  // bit-wise CRC-16/XMODEM (augmented form) replaced by the table of
+  // comm_crc16(), kept as the baseline of crc16_1KB
+  uint32_t crc = 0;
+  for (uint32_t i = 0; i < BENCH_BULK_SIZE + 2; i++) {
+    uint32_t in = (i < BENCH_BULK_SIZE ? data[i] : 0) | 0x100;
+    do {
+      crc <<= 1;
+      in <<= 1;
+      if (in & 0x100) {
+        ++crc;
+      }
+      if (crc & 0x10000) {
+        crc ^= 0x1021;
+      }
+    } while (!(in & 0x10000));
+  }
+  sink ^= (uint8_t)crc;
+}
+
+static void run_base58(void) {
+  char b58[64] = "";
+  size_t b58_size = sizeof(b58);
+  b58enc(b58, &b58_size, data, 32);
+  sink ^= (uint8_t)b58[0];
+}
+
+/*****************************************************************************
+ * GLOBAL FUNCTIONS
+ *****************************************************************************/
+
+uint8_t crypto_benchmarks_run(bench_result_t *results, uint8_t max_results) {
+  const uint8_t count = sizeof(bench_cases) / sizeof(bench_cases[0]);
+
+  bench_timer_start();
+  LOG_CRITICAL(BENCH_TABLE_HEADER);
+  printf(BENCH_TABLE_HEADER "\n");
+
+  for (uint8_t i = 0; i < count; i++) {
+    const bench_case_t *bench = &bench_cases[i];
+    if (NULL != bench->setup) {
+      bench->setup();
+    }
+
+    const uint64_t start = bench_timer_stamp();
+    for (uint32_t n = 0; n < bench->iterations; n++) {
+      bench->run();
+    }
+    const uint64_t elapsed = bench_timer_elapsed(start);
+
+    bench_result_t result = {.name = bench->name,
+                             .iterations = bench->iterations};
+    result.ns_per_op =
+        (uint32_t)(bench_timer_to_ns(elapsed) / bench->iterations);
+#if USE_SIMULATOR == 0
+    result.cycles_per_op = (uint32_t)(elapsed / bench->iterations);
+#endif
+    if (NULL != results && i < max_results) {
+      results[i] = result;
+    }
+
+    LOG_CRITICAL("bench,%s,%lu,%lu,%lu",
+                 result.name,
+                 (unsigned long)result.iterations,
+                 (unsigned long)result.ns_per_op,
+                 (unsigned long)result.cycles_per_op);
+    printf("bench,%s,%lu,%lu,%lu\n",
+           result.name,
+           (unsigned long)result.iterations,
+           (unsigned long)result.ns_per_op,
+           (unsigned long)result.cycles_per_op);
+  }
+  return count;
+}
@@ -0,0 +1,61 @@
+/**
+ * @file    crypto_benchmarks.h
+ * @author  Cypherock X1 Team
+ * @brief   Timing of the crypto primitives on the device and the simulator
+ * @copyright Copyright (c) 2023 HODL TECH PTE LTD
+ * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
+ * target=_blank>https://mitcc.org/</a>
+ */
+#ifndef CRYPTO_BENCHMARKS_H
+#define CRYPTO_BENCHMARKS_H
+
+/*****************************************************************************
+ * INCLUDES
+ *****************************************************************************/
+#include <stdint.h>
+
+/*****************************************************************************
+ * MACROS AND DEFINES
+ *****************************************************************************/
+
+/// Header line of the results table, see crypto_benchmarks_run()
+#define BENCH_TABLE_HEADER "bench,name,iterations,ns_per_op,cycles_per_op"
+
+/*****************************************************************************
+ * TYPEDEFS
+ *****************************************************************************/
+
+/**
+ * @brief Result of a benchmark
+ */
+typedef struct bench_result {
+  const char *name;
+  uint32_t iterations;
+  uint32_t ns_per_op;
+  uint32_t cycles_per_op;    ///< 0 on the simulator
+} bench_result_t;
+
+/*****************************************************************************
+ * EXPORTED VARIABLES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * GLOBAL FUNCTION PROTOTYPES
+ *****************************************************************************/
+
+/**
+ * @brief Times every crypto primitive of the suite and reports the results
+ * @details Each primitive runs a fixed number of iterations on fixed inputs,
+ * timed with the DWT cycle counter on the device and the monotonic clock on
+ * the simulator. The results are written to the device logs and to stdout as
+ * comma separated lines: BENCH_TABLE_HEADER followed by one
+ * "bench,<name>,<iterations>,<ns_per_op>,<cycles_per_op>" line per primitive.
+ *
+ * @param results Optional storage for the results, NULL to only report them
+ * @param max_results Capacity of results
+ *
+ * @return uint8_t Number of primitives benchmarked
+ */
+uint8_t crypto_benchmarks_run(bench_result_t *results, uint8_t max_results);
+
+#endif /* CRYPTO_BENCHMARKS_H */
@@ -0,0 +1,546 @@
+/**
+ * @file    proto_benchmarks.c
+ * @author  Cypherock X1 Team
+ * @brief   Timing and stack use of the protobuf query decoding and result
+ *          encoding of the apps
+ * @copyright Copyright (c) 2023 HODL TECH PTE LTD
+ * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
+ *target=_blank>https://mitcc.org/</a>
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * (c) Copyright 2023 by HODL TECH PTE LTD
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * "Commons Clause" License Condition v1.0
+ *
+ * The Software is provided to you by the Licensor under the License,
+ * as defined below, subject to the following condition.
+ *
+ * Without limiting other conditions in the License, the grant of
+ * rights under the License will not include, and the License does not
+ * grant to you, the right to Sell the Software.
+ *
+ * For purposes of the foregoing, "Sell" means practicing any or all
+ * of the rights granted to you under the License to provide to third
+ * parties, for a fee or other consideration (including without
+ * limitation fees for hosting or consulting/ support services related
+ * to the Software), a product or service whose value derives, entirely
+ * or substantially, from the functionality of the Software. Any license
+ * notice or attribution required by the License must also include
+ * this Commons Clause License Condition notice.
+ *
+ * Software: All X1Wallet associated files.
+ * License: MIT
+ * Licensor: HODL TECH PTE LTD
+ *
+ ******************************************************************************
+ */
+
+
+/*****************************************************************************
+ * INCLUDES
+ *****************************************************************************/
+#include "proto_benchmarks.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "bench_timer.h"
+#include "btc_api.h"
+#include "evm_api.h"
+#include "logger.h"
+#include "manager_api.h"
+#include "near_api.h"
+#include "pb_encode.h"
+#include "solana_api.h"
+
+/*****************************************************************************
+ * EXTERN VARIABLES
+ *****************************************************************************/
+
+#if USE_SIMULATOR == 0
+/// Moves the end of the heap, from the system calls of the HAL
+extern void *_sbrk(ptrdiff_t incr);
+#endif
+
+/*****************************************************************************
+ * PRIVATE MACROS AND DEFINES
+ *****************************************************************************/
+
+/// Iterations of every message; a message takes well under a millisecond to
+/// decode on the device
+#define PROTO_BENCH_ITERATIONS 200
+
+/// Size of the corpus buffer, enough for the largest message of the corpus
+#define PROTO_BENCH_CORPUS_SIZE 1536
+
+/// Size of the chunks of the txn_data queries
+#define PROTO_BENCH_CHUNK_SIZE 1024
+
+/// Size of the prev_txn of the bitcoin input query
+#define PROTO_BENCH_PREV_TXN_SIZE 256
+
+/// Pattern painted over the free stack
+#define PROTO_BENCH_CANARY 0xC5ACCE55
+
+/// Words left unpainted below the frame of the painter, covering its own
+/// locals
+#define PROTO_BENCH_SP_GUARD_WORDS 64
+
+/// Bytes of free stack painted before measuring a call
+#if USE_SIMULATOR == 0
+#define PROTO_BENCH_STACK_WINDOW (8 * 1024)
+#else
+#define PROTO_BENCH_STACK_WINDOW (16 * 1024)
+#endif
+
+/*****************************************************************************
+ * PRIVATE TYPEDEFS
+ *****************************************************************************/
+
+/**
+ * @brief A message of the corpus
+ * @details setup encodes the query into the corpus, or populates the result,
+ * outside of the timed section and sets corpus_size; run decodes or encodes
+ * the message once.
+ */
+typedef struct proto_bench_case {
+  const char *name;
+  bool (*setup)(void);
+  void (*run)(void);
+} proto_bench_case_t;
+
+/*****************************************************************************
+ * STATIC FUNCTION PROTOTYPES
+ *****************************************************************************/
+
+static bool setup_btc_get_public_key(void);
+static bool setup_btc_input(void);
+static bool setup_btc_output(void);
+static bool setup_btc_signature(void);
+static bool setup_evm_initiate(void);
+static bool setup_evm_txn_data(void);
+static bool setup_evm_signature(void);
+static bool setup_solana_txn_data(void);
+static bool setup_solana_signature(void);
+static bool setup_near_txn(void);
+static bool setup_near_signature(void);
+static bool setup_manager_auth_card(void);
+static bool setup_manager_device_info(void);
+static void run_btc_decode(void);
+static void run_btc_encode(void);
+static void run_evm_decode(void);
+static void run_evm_encode(void);
+static void run_solana_decode(void);
+static void run_solana_encode(void);
+static void run_near_decode(void);
+static void run_near_encode(void);
+static void run_manager_decode(void);
+static void run_manager_encode(void);
+
+/*****************************************************************************
+ * STATIC VARIABLES
+ *****************************************************************************/
+
+static const proto_bench_case_t bench_cases[] = {
+    {"btc_get_public_key_query", setup_btc_get_public_key, run_btc_decode},
+    {"btc_input_query", setup_btc_input, run_btc_decode},
+    {"btc_output_query", setup_btc_output, run_btc_decode},
+    {"btc_signature_result", setup_btc_signature, run_btc_encode},
+    {"evm_initiate_query", setup_evm_initiate, run_evm_decode},
+    {"evm_txn_data_query", setup_evm_txn_data, run_evm_decode},
+    {"evm_signature_result", setup_evm_signature, run_evm_encode},
+    {"solana_txn_data_query", setup_solana_txn_data, run_solana_decode},
+    {"solana_signature_result", setup_solana_signature, run_solana_encode},
+    {"near_txn_query", setup_near_txn, run_near_decode},
+    {"near_signature_result", setup_near_signature, run_near_encode},
+    {"manager_auth_card_query", setup_manager_auth_card, run_manager_decode},
+    {"manager_device_info_result",
+     setup_manager_device_info,
+     run_manager_encode},
+};
+
+/// Encoded message: the input of the decode cases, the output of the encode
+/// cases
+static uint8_t corpus[PROTO_BENCH_CORPUS_SIZE];
+static size_t corpus_size = 0;
+static uint8_t prev_txn[PROTO_BENCH_PREV_TXN_SIZE];
+
+/// Only one app is benchmarked at a time; sharing the storage keeps the RAM
+/// of the device build low
+static union {
+  btc_query_t btc;
+  evm_query_t evm;
+  solana_query_t solana;
+  near_query_t near;
+  manager_query_t manager;
+} bench_query;
+
+static union {
+  btc_result_t btc;
+  evm_result_t evm;
+  solana_result_t solana;
+  near_result_t near;
+  manager_result_t manager;
+} bench_result;
+
+/// Collects the status of each call so that none is optimized out
+static volatile bool sink;
+
+/*****************************************************************************
+ * STATIC FUNCTIONS
+ *****************************************************************************/
+
+static void fill_pattern(uint8_t *bytes, size_t size, uint8_t seed) {
+  for (size_t i = 0; i < size; i++) {
+    bytes[i] = (uint8_t)(i * 31 + seed);
+  }
+}
+
+static bool encode_corpus(const pb_msgdesc_t *fields, const void *message) {
+  pb_ostream_t stream = pb_ostream_from_buffer(corpus, sizeof(corpus));
+  const bool status = pb_encode(&stream, fields, message);
+  corpus_size = stream.bytes_written;
+  return status;
+}
+
+static bool encode_prev_txn(pb_ostream_t *stream,
+                            const pb_field_t *field,
+                            void *const *arg) {
+  return pb_encode_tag_for_field(stream, field) &&
+         pb_encode_string(stream, prev_txn, sizeof(prev_txn));
+}
+
+#if USE_SIMULATOR == 0
+/**
+ * @brief Returns the first word above the heap
+ */
+static uint32_t *heap_top(void) {
+  return (uint32_t *)(((uintptr_t)_sbrk(0) + 3) & ~(uintptr_t)3);
+}
+#endif
+
+/**
+ * @brief Returns the peak stack used by a call of run
+ * @details Paints PROTO_BENCH_STACK_WINDOW bytes of free stack below the frame
+ * of this function, calls run and scans up to the deepest overwritten word.
+ * The depth is counted from the frame of this function, so it includes a
+ * small constant for the call itself.
+ */
+static uint32_t __attribute__((noinline)) measure_stack(void (*run)(void)) {
+  uint32_t *frame = (uint32_t *)__builtin_frame_address(0);
+  uint32_t *high = frame - PROTO_BENCH_SP_GUARD_WORDS;
+  uint32_t *low = high - PROTO_BENCH_STACK_WINDOW / sizeof(uint32_t);
+#if USE_SIMULATOR == 0
+  if (low < heap_top()) {
+    low = heap_top();
+  }
+#endif
+
+  for (volatile uint32_t *word = low; word < high; word++) {
+    *word = PROTO_BENCH_CANARY;
+  }
+  run();
+
+  volatile uint32_t *word = low;
+  while (word < high && PROTO_BENCH_CANARY == *word) {
+    word++;
+  }
+  return (uint32_t)((uintptr_t)frame - (uintptr_t)word);
+}
+
+static bool setup_btc_get_public_key(void) {
+  btc_query_t message = {
+      .which_request = BTC_QUERY_GET_PUBLIC_KEY_TAG,
+      .get_public_key = {
+          .which_request = BTC_GET_PUBLIC_KEY_REQUEST_INITIATE_TAG,
+          .initiate = {.derivation_path_count = 5,
+                       .derivation_path = {0x80000054, 0x80000000, 0x80000000,
+                                           0, 12}}}};
+  fill_pattern(message.get_public_key.initiate.wallet_id, 32, 1);
+  return encode_corpus(BTC_QUERY_FIELDS, &message);
+}
+
+static bool setup_btc_input(void) {
+  btc_query_t message = {
+      .which_request = BTC_QUERY_SIGN_TXN_TAG,
+      .sign_txn = {.which_request = BTC_SIGN_TXN_REQUEST_INPUT_TAG,
+                   .input = {.prev_output_index = 1,
+                             .value = 250000,
+                             .sequence = 0xFFFFFFFD,
+                             .change_index = 0,
+                             .address_index = 7,
+                             .script_pub_key = {.size = 22}}}};
+  btc_sign_txn_input_t *input = &message.sign_txn.input;
+  fill_pattern(prev_txn, sizeof(prev_txn), 2);
+  fill_pattern(input->prev_txn_hash, 32, 3);
+  fill_pattern(input->script_pub_key.bytes, 22, 4);
+  input->prev_txn.funcs.encode = encode_prev_txn;
+  return encode_corpus(BTC_QUERY_FIELDS, &message);
+}
+
+static bool setup_btc_output(void) {
+  btc_query_t message = {
+      .which_request = BTC_QUERY_SIGN_TXN_TAG,
+      .sign_txn = {.which_request = BTC_SIGN_TXN_REQUEST_OUTPUT_TAG,
+                   .output = {.value = 120000,
+                              .is_change = false,
+                              .script_pub_key = {.size = 22}}}};
+  fill_pattern(message.sign_txn.output.script_pub_key.bytes, 22, 5);
+  return encode_corpus(BTC_QUERY_FIELDS, &message);
+}
+
+static bool setup_btc_signature(void) {
+  bench_result.btc = init_btc_result(BTC_RESULT_SIGN_TXN_TAG);
+  bench_result.btc.sign_txn.which_response =
+      BTC_SIGN_TXN_RESPONSE_SIGNATURE_TAG;
+  // DER signature with the sighash byte and a compressed public key
+  bench_result.btc.sign_txn.signature.signature.size = 107;
+  fill_pattern(bench_result.btc.sign_txn.signature.signature.bytes, 107, 6);
+  run_btc_encode();
+  return sink;
+}
+
+static bool setup_evm_initiate(void) {
+  evm_query_t message = {
+      .which_request = EVM_QUERY_SIGN_TXN_TAG,
+      .sign_txn = {.which_request = EVM_SIGN_TXN_REQUEST_INITIATE_TAG,
+                   .initiate = {
+                       .chain_id = 1,
+                       .derivation_path_count = 5,
+                       .derivation_path = {0x8000002C, 0x8000003C, 0x80000000,
+                                           0, 0},
+                       .address_format = EVM_DEFAULT,
+                       .transaction_size = PROTO_BENCH_CHUNK_SIZE,
+                   }}};
+  fill_pattern(message.sign_txn.initiate.wallet_id, 32, 7);
+  return encode_corpus(EVM_QUERY_FIELDS, &message);
+}
+
+static bool setup_evm_txn_data(void) {
+  evm_query_t message = {
+      .which_request = EVM_QUERY_SIGN_TXN_TAG,
+      .sign_txn = {.which_request = EVM_SIGN_TXN_REQUEST_TXN_DATA_TAG,
+                   .txn_data = {.has_chunk_payload = true,
+                                .chunk_payload = {
+                                    .chunk = {.size = PROTO_BENCH_CHUNK_SIZE},
+                                    .remaining_size = 0,
+                                    .chunk_index = 0,
+                                    .total_chunks = 1,
+                                }}}};
+  fill_pattern(message.sign_txn.txn_data.chunk_payload.chunk.bytes,
+               PROTO_BENCH_CHUNK_SIZE,
+               8);
+  return encode_corpus(EVM_QUERY_FIELDS, &message);
+}
+
+static bool setup_evm_signature(void) {
+  bench_result.evm = init_evm_result(EVM_RESULT_SIGN_TXN_TAG);
+  bench_result.evm.sign_txn.which_response =
+      EVM_SIGN_TXN_RESPONSE_SIGNATURE_TAG;
+  fill_pattern((uint8_t *)&bench_result.evm.sign_txn.signature,
+               sizeof(bench_result.evm.sign_txn.signature),
+               9);
+  run_evm_encode();
+  return sink;
+}
+
+static bool setup_solana_txn_data(void) {
+  solana_query_t message = {
+      .which_request = SOLANA_QUERY_SIGN_TXN_TAG,
+      .sign_txn = {.which_request = SOLANA_SIGN_TXN_REQUEST_TXN_DATA_TAG,
+                   .txn_data = {.has_chunk_payload = true,
+                                .chunk_payload = {
+                                    .chunk = {.size = PROTO_BENCH_CHUNK_SIZE},
+                                    .remaining_size = 0,
+                                    .chunk_index = 0,
+                                    .total_chunks = 1,
+                                }}}};
+  fill_pattern(message.sign_txn.txn_data.chunk_payload.chunk.bytes,
+               PROTO_BENCH_CHUNK_SIZE,
+               10);
+  return encode_corpus(SOLANA_QUERY_FIELDS, &message);
+}
+
+static bool setup_solana_signature(void) {
+  bench_result.solana = init_solana_result(SOLANA_RESULT_SIGN_TXN_TAG);
+  bench_result.solana.sign_txn.which_response =
+      SOLANA_SIGN_TXN_RESPONSE_SIGNATURE_TAG;
+  fill_pattern(bench_result.solana.sign_txn.signature.signature, 64, 11);
+  run_solana_encode();
+  return sink;
+}
+
+static bool setup_near_txn(void) {
+  // size of a transfer with implicit account ids
+  near_query_t message = {
+      .which_request = NEAR_QUERY_SIGN_TXN_TAG,
+      .sign_txn = {.which_request = NEAR_SIGN_TXN_REQUEST_TXN_TAG,
+                   .txn = {.txn = {.size = 178}}}};
+  fill_pattern(message.sign_txn.txn.txn.bytes, 178, 12);
+  return encode_corpus(NEAR_QUERY_FIELDS, &message);
+}
+
+static bool setup_near_signature(void) {
+  bench_result.near = init_near_result(NEAR_RESULT_SIGN_TXN_TAG);
+  bench_result.near.sign_txn.which_response =
+      NEAR_SIGN_TXN_RESPONSE_SIGNATURE_TAG;
+  fill_pattern(bench_result.near.sign_txn.signature.signature, 64, 13);
+  run_near_encode();
+  return sink;
+}
+
+static bool setup_manager_auth_card(void) {
+  manager_query_t message = {
+      .which_request = MANAGER_QUERY_AUTH_CARD_TAG,
+      .auth_card = {.which_request = MANAGER_AUTH_CARD_REQUEST_CHALLENGE_TAG}};
+  fill_pattern(message.auth_card.challenge.challenge, 32, 14);
+  return encode_corpus(MANAGER_QUERY_FIELDS, &message);
+}
+
+static bool setup_manager_device_info(void) {
+  bench_result.manager =
+      init_manager_result(MANAGER_RESULT_GET_DEVICE_INFO_TAG);
+  manager_get_device_info_response_t *info =
+      &bench_result.manager.get_device_info;
+  info->which_response = MANAGER_GET_DEVICE_INFO_RESPONSE_RESULT_TAG;
+  info->result.has_firmware_version = true;
+  info->result.firmware_version.major = 1;
+  info->result.firmware_version.minor = 2;
+  info->result.firmware_version.patch = 3;
+  info->result.is_authenticated = true;
+  info->result.onboarding_step = MANAGER_ONBOARDING_STEP_COMPLETE;
+  fill_pattern(info->result.device_serial, 32, 15);
+  run_manager_encode();
+  return sink;
+}
+
+static void run_btc_decode(void) {
+  sink = decode_btc_query(corpus, corpus_size, &bench_query.btc);
+}
+
+static void run_btc_encode(void) {
+  sink = encode_btc_result(
+      &bench_result.btc, corpus, sizeof(corpus), &corpus_size);
+}
+
+static void run_evm_decode(void) {
+  sink = decode_evm_query(corpus, corpus_size, &bench_query.evm);
+}
+
+static void run_evm_encode(void) {
+  sink = encode_evm_result(
+      &bench_result.evm, corpus, sizeof(corpus), &corpus_size);
+}
+
+static void run_solana_decode(void) {
+  sink = decode_solana_query(corpus, corpus_size, &bench_query.solana);
+}
+
+static void run_solana_encode(void) {
+  sink = encode_solana_result(
+      &bench_result.solana, corpus, sizeof(corpus), &corpus_size);
+}
+
+static void run_near_decode(void) {
+  sink = decode_near_query(corpus, corpus_size, &bench_query.near);
+}
+
+static void run_near_encode(void) {
+  sink = encode_near_result(
+      &bench_result.near, corpus, sizeof(corpus), &corpus_size);
+}
+
+static void run_manager_decode(void) {
+  sink = decode_manager_query(corpus, corpus_size, &bench_query.manager);
+}
+
+static void run_manager_encode(void) {
+  sink = encode_manager_result(
+      &bench_result.manager, corpus, sizeof(corpus), &corpus_size);
+}
+
+/*****************************************************************************
+ * GLOBAL FUNCTIONS
+ *****************************************************************************/
+
+uint8_t proto_benchmarks_run(proto_bench_result_t *results,
+                             uint8_t max_results) {
+  const uint8_t count = sizeof(bench_cases) / sizeof(bench_cases[0]);
+
+  bench_timer_start();
+  LOG_CRITICAL(PROTO_BENCH_TABLE_HEADER);
+  printf(PROTO_BENCH_TABLE_HEADER "\n");
+
+  for (uint8_t i = 0; i < count; i++) {
+    const proto_bench_case_t *bench = &bench_cases[i];
+    proto_bench_result_t result = {.name = bench->name,
+                                   .iterations = PROTO_BENCH_ITERATIONS};
+    sink = bench->setup();
+    if (sink) {
+      // warm up first, the simulator resolves the symbols of a first call on
+      // the same stack
+      bench->run();
+      result.stack_bytes = measure_stack(bench->run);
+    }
+    if (!sink || 0 == corpus_size) {
+      LOG_CRITICAL("proto,%s,failed", bench->name);
+      printf("proto,%s,failed\n", bench->name);
+      continue;
+    }
+    result.bytes = corpus_size;
+
+    const uint64_t start = bench_timer_stamp();
+    for (uint32_t n = 0; n < PROTO_BENCH_ITERATIONS; n++) {
+      bench->run();
+    }
+    const uint64_t ns = bench_timer_to_ns(bench_timer_elapsed(start));
+    result.ns_per_op = (uint32_t)(ns / PROTO_BENCH_ITERATIONS);
+    result.ps_per_byte =
+        (uint32_t)(ns * 1000 / PROTO_BENCH_ITERATIONS / result.bytes);
+    if (NULL != results && i < max_results) {
+      results[i] = result;
+    }
+
+    LOG_CRITICAL("proto,%s,%lu,%lu,%lu,%lu.%03lu,%lu",
+                 result.name,
+                 (unsigned long)result.bytes,
+                 (unsigned long)result.iterations,
+                 (unsigned long)result.ns_per_op,
+                 (unsigned long)(result.ps_per_byte / 1000),
+                 (unsigned long)(result.ps_per_byte % 1000),
+                 (unsigned long)result.stack_bytes);
+    printf("proto,%s,%lu,%lu,%lu,%lu.%03lu,%lu\n",
+           result.name,
+           (unsigned long)result.bytes,
+           (unsigned long)result.iterations,
+           (unsigned long)result.ns_per_op,
+           (unsigned long)(result.ps_per_byte / 1000),
+           (unsigned long)(result.ps_per_byte % 1000),
+           (unsigned long)result.stack_bytes);
+  }
+  return count;
+}
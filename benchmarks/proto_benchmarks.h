@@ -0,0 +1,71 @@
+/**
+ * @file    proto_benchmarks.h
+ * @author  Cypherock X1 Team
+ * @brief   Timing and stack use of the protobuf query decoding and result
+ *          encoding of the apps
+ * @copyright Copyright (c) 2023 HODL TECH PTE LTD
+ * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
+ * target=_blank>https://mitcc.org/</a>
+ */
+#ifndef PROTO_BENCHMARKS_H
+#define PROTO_BENCHMARKS_H
+
+/*****************************************************************************
+ * INCLUDES
+ *****************************************************************************/
+#include <stdint.h>
+
+/*****************************************************************************
+ * MACROS AND DEFINES
+ *****************************************************************************/
+
+/// Header line of the results table, see proto_benchmarks_run()
+#define PROTO_BENCH_TABLE_HEADER                                               \
+  "proto,name,bytes,iterations,ns_per_op,ns_per_byte,stack_bytes"
+
+/*****************************************************************************
+ * TYPEDEFS
+ *****************************************************************************/
+
+/**
+ * @brief Result of a decode or encode benchmark
+ */
+typedef struct proto_bench_result {
+  const char *name;
+  uint32_t bytes;          ///< Size of the encoded message
+  uint32_t iterations;
+  uint32_t ns_per_op;
+  uint32_t ps_per_byte;    ///< Picoseconds, printed as ns with 3 decimals
+  uint32_t stack_bytes;    ///< Peak stack below the frame of the harness
+} proto_bench_result_t;
+
+/*****************************************************************************
+ * EXPORTED VARIABLES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * GLOBAL FUNCTION PROTOTYPES
+ *****************************************************************************/
+
+/**
+ * @brief Times the query decoding and the result encoding of every app on a
+ * canonical corpus and reports the results
+ * @details Each message of the corpus is encoded once, then decoded with the
+ * decode_<app>_query() of the app, or encoded with encode_<app>_result(), for
+ * a fixed number of iterations. The peak stack of one more call is measured by
+ * painting the free stack below the harness. The results are written to the
+ * device logs and to stdout as comma separated lines: PROTO_BENCH_TABLE_HEADER
+ * followed by one
+ * "proto,<name>,<bytes>,<iterations>,<ns_per_op>,<ns_per_byte>,<stack_bytes>"
+ * line per message, or "proto,<name>,failed" if the message did not encode
+ * or decode.
+ *
+ * @param results Optional storage for the results, NULL to only report them
+ * @param max_results Capacity of results
+ *
+ * @return uint8_t Number of messages benchmarked
+ */
+uint8_t proto_benchmarks_run(proto_bench_result_t *results,
+                             uint8_t max_results);
+
+#endif /* PROTO_BENCHMARKS_H */
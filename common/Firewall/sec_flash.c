@@ -109,6 +109,16 @@ Flash_Perm_Struct flash_perm_instance;
 bool is_flash_perm_instance_loaded = false;
 bool is_sec_flash_ram_instance_loaded = false;
 
+/// Versions read from the secure segment, fixed for the boot
+static uint32_t fw_hardware_version = 0;
+static uint32_t fw_bootloader_version = 0;
+static bool is_fw_versions_cached = false;
+
+/// Number of open batches, refer @ref sec_flash_batch_begin
+static uint8_t sec_flash_batch_depth = 0;
+/// If saves of sec_flash_instance were staged in the open batch
+static bool is_sec_flash_batch_dirty = false;
+
 static void fill_flash_tlv(uint8_t *array,
                            uint16_t *starting_index,
                            uint8_t tag,
@@ -166,12 +176,31 @@ void FW_enter_DFU() {
 #endif
 }
 
+/**
+ * @brief   Reads the versions from the secure segment on the first call
+ * @details The versions do not change till the next boot, hence the call gate
+ * and its interrupt-masked window are entered once per boot rather than on
+ * every log export or device info request.
+ */
+static void FW_cache_versions() {
+  if (is_fw_versions_cached) {
+    return;
+  }
+  fw_hardware_version =
+      firewall_func(SEC_TASK_GET_HARDWARE_VERSION, NULL, 0, 0);
+  fw_bootloader_version =
+      firewall_func(SEC_TASK_GET_BOOTLOADER_VERSION, NULL, 0, 0);
+  is_fw_versions_cached = true;
+}
+
 uint32_t FW_get_hardware_version() {
-  return firewall_func(SEC_TASK_GET_HARDWARE_VERSION, NULL, 0, 0);
+  FW_cache_versions();
+  return fw_hardware_version;
 }
 
 uint32_t FW_get_bootloader_version() {
-  return firewall_func(SEC_TASK_GET_BOOTLOADER_VERSION, NULL, 0, 0);
+  FW_cache_versions();
+  return fw_bootloader_version;
 }
 
 /**
@@ -373,6 +402,12 @@ static void sec_flash_write(uint8_t *src, uint16_t size) {
 }
 
 void sec_flash_struct_save() {
+  if (0 < sec_flash_batch_depth) {
+    is_sec_flash_batch_dirty = true;
+    return;
+  }
+
+  is_sec_flash_batch_dirty = false;
   uint8_t *serialized_flash_instance =
       (uint8_t *)malloc(SEC_FLASH_STRUCT_TLV_SIZE);
   ASSERT(serialized_flash_instance != NULL);
@@ -387,6 +422,7 @@ const Sec_Flash_Struct *get_sec_flash_ram_instance() {
   if (!is_sec_flash_ram_instance_loaded) {
     sec_flash_struct_load();
     is_sec_flash_ram_instance_loaded = true;
+    flash_keystore_index_rebuild();
   }
   return &sec_flash_instance;
 }
@@ -398,9 +434,23 @@ const Sec_Flash_Struct *get_sec_flash_ram_instance() {
  */
 void sec_flash_erase() {
   FW_delete_flash_data(FIREWALL_APPLICATION_DATA_START_ADDR);
+  is_sec_flash_batch_dirty = false;
   is_sec_flash_ram_instance_loaded = false;
 }
 
+void sec_flash_batch_begin() {
+  ASSERT(UINT8_MAX > sec_flash_batch_depth);
+  sec_flash_batch_depth++;
+}
+
+void sec_flash_batch_commit() {
+  ASSERT(0 < sec_flash_batch_depth);
+  sec_flash_batch_depth--;
+  if (0 == sec_flash_batch_depth && is_sec_flash_batch_dirty) {
+    sec_flash_struct_save();
+  }
+}
+
 /**
  * @brief   Load firewall read only data to `flash_perm_instance`
  *
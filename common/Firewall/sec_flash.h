@@ -43,7 +43,10 @@ extern void FW_enter_DFU();
 
 /**
  * @brief returns device hardware version
- * @details Device hardware version is used for hal configuration compatibility
+ * @details Device hardware version is used for hal configuration compatibility.
+ * The first call, from BSP_GPIO_Init() at boot, reads both the hardware and
+ * the bootloader versions through the call gate; later calls return them from
+ * RAM.
  *
  * @since v1.0.0
  */
@@ -51,6 +54,7 @@ extern uint32_t FW_get_hardware_version();
 
 /**
  * @brief returns bootloader version
+ * @details Read once per boot, see @ref FW_get_hardware_version
  *
  * @since v1.0.0
  */
@@ -158,4 +162,23 @@ typedef struct Flash_Perm_Struct {
  */
 void sec_flash_erase();
 
+/**
+ * @brief Opens a batch of secure flash updates
+ * @details Until the matching @ref sec_flash_batch_commit, saves of the
+ * secure flash instance are only staged in RAM. The batch then costs a single
+ * erase & program of the firewall application data. Batches can be nested,
+ * the outermost commit writes to flash.
+ *
+ * @since v1.0.0
+ */
+void sec_flash_batch_begin();
+
+/**
+ * @brief Closes the batch opened by @ref sec_flash_batch_begin and writes the
+ * staged updates to the firewall once the outermost batch is closed
+ *
+ * @since v1.0.0
+ */
+void sec_flash_batch_commit();
+
 #endif /* SECURETASKS_PROTECTED_CODE_H_ */
@@ -121,4 +121,13 @@ void flash_perm_struct_save_ext_keys();
  */
 void sec_flash_struct_save();
 
+/**
+ * @brief Rebuilds the in-RAM summary of the keystore of sec_flash_instance,
+ * used by the pairing checks of flash_api. Call after replacing
+ * sec_flash_instance as a whole, e.g. on load.
+ *
+ * @private
+ */
+void flash_keystore_index_rebuild();
+
 #endif
\ No newline at end of file
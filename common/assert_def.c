@@ -58,10 +58,13 @@
  */
 #include "assert_conf.h"
 
+#include <stdlib.h>
+
 #if USE_SIMULATOR == 0
 
 void assert_handler(uint32_t pc, uint32_t lr) {
   LOG_CRITICAL("ASSERT FAIL pc:%08x lr:%08x", pc, lr);
+  logger_flush();
   WRITE_REG(RTC->BKP1R, 0x01);
   BSP_reset();
 }
@@ -75,6 +78,10 @@ void assert_handler(uint8_t *file, uint8_t *function, uint32_t line) {
   printf("FUNCTION: %s\n", function);
   printf("LINE: %d\n", line);
   printf("============================");
+#ifdef USB_FUZZ
+  // a failed assertion is a finding of the fuzzer
+  abort();
+#endif
 }
 
 #endif
@@ -71,10 +71,66 @@ void fill_flash_tlv(uint8_t *array,
   *starting_index = *starting_index + length;
 }
 
-static uint16_t find_latest_coin_data(
-    const Coin_Specific_Data_Struct *coin_specific_data_key,
-    uint16_t *coin_data_length,
-    uint32_t *coin_data_addr) {
+// Offset of the coin data from the start of its record: coin type and length,
+// wallet id TLV and the tag and length of the coin data
+#define CSD_COIN_DATA_OFFSET (6 + (3 + WALLET_ID_SIZE) + 3)
+
+// Room for the wallets on the device plus the stale records of deleted
+// wallets, which stay in the log until it is purged
+#define CSD_INDEX_MAX_ENTRIES (2 * MAX_UNIQUE_COIN_COUNT * MAX_WALLETS_ALLOWED)
+
+typedef struct {
+  Coin_Type coin_type;
+  uint8_t wallet_id[WALLET_ID_SIZE];
+  uint32_t data_addr;
+  uint16_t data_length;
+} csd_index_entry_t;
+
+// Latest record of each (coin type, wallet id) in the log, so that lookups do
+// not walk the flash. Built on first access, falls back to the walk if the log
+// holds more keys than it can track.
+static struct {
+  bool valid;
+  bool overflow;
+  uint8_t count;
+  uint16_t end_offset;
+  csd_index_entry_t entries[CSD_INDEX_MAX_ENTRIES];
+} csd_index;
+
+static csd_index_entry_t *csd_index_find(Coin_Type coin_type,
+                                         const uint8_t *wallet_id) {
+  for (uint8_t i = 0; i < csd_index.count; i++) {
+    csd_index_entry_t *entry = &csd_index.entries[i];
+    if (entry->coin_type == coin_type &&
+        memcmp(entry->wallet_id, wallet_id, WALLET_ID_SIZE) == 0)
+      return entry;
+  }
+  return NULL;
+}
+
+static void csd_index_record(Coin_Type coin_type,
+                             const uint8_t *wallet_id,
+                             uint32_t data_addr,
+                             uint16_t data_length) {
+  csd_index_entry_t *entry = csd_index_find(coin_type, wallet_id);
+  if (entry == NULL) {
+    if (csd_index.count == CSD_INDEX_MAX_ENTRIES) {
+      csd_index.overflow = true;
+      return;
+    }
+    entry = &csd_index.entries[csd_index.count++];
+    entry->coin_type = coin_type;
+    memcpy(entry->wallet_id, wallet_id, WALLET_ID_SIZE);
+  }
+  entry->data_addr = data_addr;
+  entry->data_length = data_length;
+}
+
+// Walks the log for the latest record of key; with a NULL key, records every
+// record in the index instead. Returns the offset past the last record.
+static uint16_t walk_coin_data(const Coin_Specific_Data_Struct *key,
+                               uint16_t *coin_data_length,
+                               uint32_t *coin_data_addr) {
   uint16_t offset = 0;
   uint8_t type_length[6] = {
       0};    // Will contain the type of the coin and the size of the data
@@ -90,7 +146,7 @@ static uint16_t find_latest_coin_data(
     Coin_Type f_coin_type = U32_READ_LE_ARRAY(type_length);
     uint16_t data_length = U16_READ_LE_ARRAY(type_length + 4);
 
-    if (f_coin_type == coin_specific_data_key->coin_type) {
+    if (key == NULL || f_coin_type == key->coin_type) {
       uint8_t temp[3] = {0};
       read_cmd(FLASH_COIN_SPECIFIC_BASE_ADDRESS + offset,
                (uint32_t *)temp,
@@ -98,20 +154,19 @@ static uint16_t find_latest_coin_data(
       offset += sizeof(temp);
 
       Coin_Specific_Data_Tag f_wallet_id_tag = temp[0];
+      uint16_t f_wallet_id_length = U16_READ_LE_ARRAY(temp + 1);
 
-      if (f_wallet_id_tag != TAG_CSD_WALLET_ID)
+      if (f_wallet_id_tag != TAG_CSD_WALLET_ID ||
+          f_wallet_id_length != WALLET_ID_SIZE)
         break;
 
-      uint16_t f_wallet_id_length = U16_READ_LE_ARRAY(temp + 1);
-      uint8_t f_wallet_id[f_wallet_id_length];
-
+      uint8_t f_wallet_id[WALLET_ID_SIZE];
       read_cmd(FLASH_COIN_SPECIFIC_BASE_ADDRESS + offset,
                (uint32_t *)f_wallet_id,
                f_wallet_id_length);
       offset += f_wallet_id_length;
-      if (memcmp(f_wallet_id,
-                 coin_specific_data_key->wallet_id,
-                 f_wallet_id_length) == 0) {
+      if (key == NULL ||
+          memcmp(f_wallet_id, key->wallet_id, f_wallet_id_length) == 0) {
         read_cmd(FLASH_COIN_SPECIFIC_BASE_ADDRESS + offset,
                  (uint32_t *)temp,
                  sizeof(temp));
@@ -121,9 +176,17 @@ static uint16_t find_latest_coin_data(
         if (f_coin_data_tag != TAG_CSD_COIN_DATA)
           break;
 
-        *coin_data_length = U16_READ_LE_ARRAY(temp + 1);
-        *coin_data_addr = FLASH_COIN_SPECIFIC_BASE_ADDRESS + offset;
-        offset += *coin_data_length;
+        uint16_t f_coin_data_length = U16_READ_LE_ARRAY(temp + 1);
+        if (key == NULL) {
+          csd_index_record(f_coin_type,
+                           f_wallet_id,
+                           FLASH_COIN_SPECIFIC_BASE_ADDRESS + offset,
+                           f_coin_data_length);
+        } else {
+          *coin_data_length = f_coin_data_length;
+          *coin_data_addr = FLASH_COIN_SPECIFIC_BASE_ADDRESS + offset;
+        }
+        offset += f_coin_data_length;
       } else {
         offset += data_length - f_wallet_id_length - 3;
       }
@@ -135,6 +198,51 @@ static uint16_t find_latest_coin_data(
   return offset;
 }
 
+static uint16_t find_latest_coin_data(
+    const Coin_Specific_Data_Struct *coin_specific_data_key,
+    uint16_t *coin_data_length,
+    uint32_t *coin_data_addr) {
+  if (!csd_index.valid) {
+    memzero(&csd_index, sizeof(csd_index));
+    csd_index.end_offset = walk_coin_data(NULL, NULL, NULL);
+    csd_index.valid = true;
+  }
+
+  if (csd_index.overflow) {
+    return walk_coin_data(
+        coin_specific_data_key, coin_data_length, coin_data_addr);
+  }
+
+  const csd_index_entry_t *entry =
+      csd_index_find(coin_specific_data_key->coin_type,
+                     coin_specific_data_key->wallet_id);
+  if (entry != NULL) {
+    *coin_data_length = entry->data_length;
+    *coin_data_addr = entry->data_addr;
+  }
+  return csd_index.end_offset;
+}
+
+// Appends a record prepared by prepare_coin_specific_data_tlv() at offset
+// and keeps the index in step with the log
+static void write_coin_data_tlv(
+    const Coin_Specific_Data_Struct *coin_specific_data,
+    uint16_t coin_data_size,
+    const uint8_t *tlv,
+    uint16_t tlv_size,
+    uint16_t offset) {
+  write_cmd(
+      FLASH_COIN_SPECIFIC_BASE_ADDRESS + offset, (uint32_t *)tlv, tlv_size);
+  if (csd_index.valid && !csd_index.overflow) {
+    csd_index_record(
+        coin_specific_data->coin_type,
+        coin_specific_data->wallet_id,
+        FLASH_COIN_SPECIFIC_BASE_ADDRESS + offset + CSD_COIN_DATA_OFFSET,
+        coin_data_size);
+    csd_index.end_offset = offset + tlv_size;
+  }
+}
+
 static uint16_t prepare_coin_specific_data_tlv(
     const Coin_Specific_Data_Struct *coin_specific_data,
     const uint16_t coin_data_size,
@@ -170,7 +278,9 @@ static uint16_t prepare_coin_specific_data_tlv(
 
 static void purge_coin_specific_data() {
   // Store all the unique data length and address in an array
-  Coin_Type coin_type_arr[MAX_UNIQUE_COIN_COUNT] = {COIN_TYPE_NEAR};
+  // COIN_TYPE_BITCOIN holds the account nodes of the xpub cache
+  Coin_Type coin_type_arr[MAX_UNIQUE_COIN_COUNT] = {COIN_TYPE_NEAR,
+                                                    COIN_TYPE_BITCOIN};
   struct meta_data_t {
     Coin_Specific_Data_Struct data_struct;
     uint16_t data_length;
@@ -233,22 +343,26 @@ static void purge_coin_specific_data() {
                                          meta_data_arr[i].data_length,
                                          tlv,
                                          data_length);
-      write_cmd(
-          FLASH_COIN_SPECIFIC_BASE_ADDRESS + offset, (uint32_t *)tlv, tlv_size);
+      write_coin_data_tlv(&meta_data_arr[i].data_struct,
+                          meta_data_arr[i].data_length,
+                          tlv,
+                          tlv_size,
+                          offset);
 
       free(meta_data_arr[i].data_struct.coin_data);
     }
   }
 }
 
-static int store_coin_data(const uint8_t *tlv_data,
+static int store_coin_data(const Coin_Specific_Data_Struct *coin_specific_data,
+                           uint16_t coin_data_size,
+                           const uint8_t *tlv_data,
                            uint16_t tlv_data_size,
                            uint16_t offset) {
   if ((offset + tlv_data_size) <=
       (FLASH_COIN_SPECIFIC_PAGE_COUNT * FLASH_PAGE_SIZE)) {
-    write_cmd(FLASH_COIN_SPECIFIC_BASE_ADDRESS + offset,
-              (uint32_t *)tlv_data,
-              tlv_data_size);
+    write_coin_data_tlv(
+        coin_specific_data, coin_data_size, tlv_data, tlv_data_size, offset);
   } else {
     purge_coin_specific_data();
     uint16_t coin_data_len = 0;
@@ -257,9 +371,8 @@ static int store_coin_data(const uint8_t *tlv_data,
     offset = find_latest_coin_data(&dummy, &coin_data_len, &coin_data_addr);
     if ((offset + tlv_data_size) <=
         (FLASH_COIN_SPECIFIC_PAGE_COUNT * FLASH_PAGE_SIZE)) {
-      write_cmd(FLASH_COIN_SPECIFIC_BASE_ADDRESS + offset,
-                (uint32_t *)tlv_data,
-                tlv_data_size);
+      write_coin_data_tlv(
+          coin_specific_data, coin_data_size, tlv_data, tlv_data_size, offset);
     } else {
       return CSD_STATUS_NOT_ENOUGH_SPACE;
     }
@@ -272,6 +385,7 @@ static int store_coin_data(const uint8_t *tlv_data,
 void erase_flash_coin_specific_data() {
   erase_cmd(FLASH_COIN_SPECIFIC_BASE_ADDRESS,
             FLASH_COIN_SPECIFIC_PAGE_COUNT * FLASH_PAGE_SIZE);
+  csd_index.valid = false;
 }
 
 int get_coin_data(Coin_Specific_Data_Struct *coin_specific_data,
@@ -299,5 +413,6 @@ int set_coin_data(const Coin_Specific_Data_Struct *coin_specific_data,
 
   uint16_t offset = prepare_coin_specific_data_tlv(
       coin_specific_data, coin_data_size, tlv, data_length);
-  return store_coin_data(tlv, sizeof(tlv), offset);
+  return store_coin_data(
+      coin_specific_data, coin_data_size, tlv, sizeof(tlv), offset);
 }
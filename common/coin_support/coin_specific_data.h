@@ -20,7 +20,7 @@
 #define FLASH_COIN_SPECIFIC_BASE_ADDRESS                                       \
   (1 + FLASH_END - FLASH_PAGE_SIZE * FLASH_COIN_SPECIFIC_PAGE_COUNT)
 #define MAX_COIN_DATA_LENGTH 512
-#define MAX_UNIQUE_COIN_COUNT 1
+#define MAX_UNIQUE_COIN_COUNT 2
 #define GET_NEXT_MULTIPLE_OF_8(x) (((x) + 7) & ~7)
 
 typedef enum Coin_Specific_Data_Tag {
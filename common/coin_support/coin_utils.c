@@ -83,22 +83,302 @@ void s_memcpy(uint8_t *dst,
   *offset += len;
 }
 
+typedef struct {
+  bool filled;
+  uint8_t root;    ///< Index of the seed in hd_session.seeds
+  const char *curve;
+  size_t depth;
+  uint32_t path[HD_PATH_CACHE_MAX_DEPTH];
+  HDNode node;
+} hd_session_entry_t;
+
+/// Cache of hardened prefix nodes of the seeds held by the seed session
+static struct {
+  bool admitted[HD_SESSION_CACHE_SEEDS];
+  uint8_t seeds[HD_SESSION_CACHE_SEEDS][SHA256_DIGEST_LENGTH];
+  uint8_t next_seed;
+  hd_session_entry_t entries[HD_SESSION_CACHE_ENTRIES];
+  uint8_t next_entry;
+  uint32_t hits;
+  uint32_t misses;
+} CONFIDENTIAL hd_session = {0};
+
+/**
+ * @brief Returns the number of leading hardened levels of the path, up to
+ * HD_PATH_CACHE_MAX_DEPTH
+ */
+static size_t hd_hardened_prefix(const uint32_t *path, size_t path_length) {
+  size_t prefix = 0;
+  while (prefix < path_length && prefix < HD_PATH_CACHE_MAX_DEPTH &&
+         0 != (path[prefix] & 0x80000000)) {
+    prefix++;
+  }
+  return prefix;
+}
+
+/**
+ * @brief Returns the index of the admitted seed in hd_session.seeds, -1 if the
+ * seed is not admitted
+ */
+static int hd_session_find_seed(const uint8_t *seed) {
+  uint8_t hash[SHA256_DIGEST_LENGTH] = {0};
+  int root = -1;
+
+  sha256_Raw(seed, 512 / 8, hash);
+  for (int i = 0; i < HD_SESSION_CACHE_SEEDS && 0 > root; i++) {
+    if (hd_session.admitted[i] &&
+        0 == memcmp(hd_session.seeds[i], hash, sizeof(hash))) {
+      root = i;
+    }
+  }
+  memzero(hash, sizeof(hash));
+  return root;
+}
+
+/**
+ * @brief Copies the deepest cached node of the seed on the hardened prefix of
+ * the path
+ *
+ * @return size_t Level of the copied node, 0 if none is cached
+ */
+static size_t hd_session_lookup(int root,
+                                const char *curve,
+                                const uint32_t *path,
+                                size_t prefix,
+                                HDNode *hdnode) {
+  const hd_session_entry_t *found = NULL;
+
+  if (0 > root || 0 == prefix) {
+    return 0;
+  }
+
+  for (int i = 0; i < HD_SESSION_CACHE_ENTRIES; i++) {
+    const hd_session_entry_t *entry = &hd_session.entries[i];
+    if (entry->filled && root == entry->root && curve == entry->curve &&
+        prefix >= entry->depth &&
+        0 == memcmp(entry->path, path, entry->depth * sizeof(uint32_t)) &&
+        (NULL == found || entry->depth > found->depth)) {
+      found = entry;
+    }
+  }
+
+  if (NULL == found) {
+    hd_session.misses++;
+    return 0;
+  }
+  hd_session.hits++;
+  memcpy(hdnode, &found->node, sizeof(HDNode));
+  return found->depth;
+}
+
+/**
+ * @brief Keeps the node at the hardened prefix of the path, replacing the
+ * oldest entry if the cache is full
+ */
+static void hd_session_store(int root,
+                             const char *curve,
+                             const uint32_t *path,
+                             size_t prefix,
+                             const HDNode *hdnode) {
+  if (0 > root || 0 == prefix) {
+    return;
+  }
+
+  hd_session_entry_t *entry = &hd_session.entries[hd_session.next_entry];
+  hd_session.next_entry =
+      (hd_session.next_entry + 1) % HD_SESSION_CACHE_ENTRIES;
+  memzero(entry, sizeof(hd_session_entry_t));
+  entry->root = root;
+  entry->curve = curve;
+  entry->depth = prefix;
+  memcpy(entry->path, path, prefix * sizeof(uint32_t));
+  memcpy(&entry->node, hdnode, sizeof(HDNode));
+  entry->filled = true;
+}
+
 bool derive_hdnode_from_path(const uint32_t *path,
                              const size_t path_length,
                              const char *curve,
                              const uint8_t *seed,
                              HDNode *hdnode) {
-  hdnode_from_seed(seed, 512 / 8, curve, hdnode);
-  for (size_t i = 0; i < path_length; i++) {
+  int root = hd_session_find_seed(seed);
+  size_t prefix = hd_hardened_prefix(path, path_length);
+  size_t level = hd_session_lookup(root, curve, path, prefix, hdnode);
+
+  if (0 == level) {
+    hdnode_from_seed(seed, 512 / 8, curve, hdnode);
+  }
+  for (size_t i = level; i < path_length; i++) {
     if (0 == hdnode_private_ckd(hdnode, path[i])) {
       // hdnode_private_ckd returns 1 when the derivation succeeds
       return false;
     }
+    if (i + 1 == prefix) {
+      hd_session_store(root, curve, path, prefix, hdnode);
+    }
   }
   hdnode_fill_public_key(hdnode);
   return true;
 }
 
+void hd_path_cache_init(hd_path_cache_t *cache,
+                        const char *curve,
+                        const uint8_t *seed) {
+  memzero(cache, sizeof(hd_path_cache_t));
+  cache->curve = curve;
+  cache->seed = seed;
+}
+
+bool hd_path_cache_derive(hd_path_cache_t *cache,
+                          const uint32_t *path,
+                          size_t path_length,
+                          HDNode *hdnode) {
+  if (!cache->master_filled) {
+    hdnode_from_seed(cache->seed, 512 / 8, cache->curve, &cache->nodes[0]);
+    cache->master_filled = true;
+    cache->depth = 0;
+  }
+
+  // find the deepest cached node shared with the requested path
+  size_t common = 0;
+  while (common < cache->depth && common < path_length &&
+         cache->path[common] == path[common]) {
+    common++;
+  }
+
+  int root = hd_session_find_seed(cache->seed);
+  size_t prefix = hd_hardened_prefix(path, path_length);
+  if (common < cache->base) {
+    // the nodes above the one taken from the session cache were not derived
+    common = 0;
+  }
+  if (0 == common) {
+    HDNode node = {0};
+    common = hd_session_lookup(root, cache->curve, path, prefix, &node);
+    if (0 < common) {
+      memcpy(&cache->nodes[common], &node, sizeof(HDNode));
+      memcpy(cache->path, path, common * sizeof(uint32_t));
+    }
+    cache->base = common;
+    memzero(&node, sizeof(HDNode));
+  }
+
+  // extend the cache along the requested path
+  size_t level = common;
+  for (; level < path_length && level < HD_PATH_CACHE_MAX_DEPTH; level++) {
+    memcpy(&cache->nodes[level + 1], &cache->nodes[level], sizeof(HDNode));
+    if (0 == hdnode_private_ckd(&cache->nodes[level + 1], path[level])) {
+      // hdnode_private_ckd returns 1 when the derivation succeeds
+      cache->depth = level;
+      return false;
+    }
+    cache->path[level] = path[level];
+    if (level + 1 == prefix) {
+      hd_session_store(
+          root, cache->curve, path, prefix, &cache->nodes[level + 1]);
+    }
+  }
+  cache->depth = level;
+
+  memcpy(hdnode, &cache->nodes[level], sizeof(HDNode));
+  for (; level < path_length; level++) {
+    if (0 == hdnode_private_ckd(hdnode, path[level])) {
+      return false;
+    }
+  }
+  hdnode_fill_public_key(hdnode);
+  return true;
+}
+
+void hd_path_cache_clear(hd_path_cache_t *cache) {
+  memzero(cache, sizeof(hd_path_cache_t));
+}
+
+void hd_session_cache_admit(const uint8_t *seed) {
+  if (NULL == seed || 0 <= hd_session_find_seed(seed)) {
+    return;
+  }
+
+  uint8_t root = hd_session.next_seed;
+  hd_session.next_seed = (hd_session.next_seed + 1) % HD_SESSION_CACHE_SEEDS;
+  if (hd_session.admitted[root]) {
+    for (int i = 0; i < HD_SESSION_CACHE_ENTRIES; i++) {
+      if (root == hd_session.entries[i].root) {
+        memzero(&hd_session.entries[i], sizeof(hd_session_entry_t));
+      }
+    }
+  }
+  sha256_Raw(seed, 512 / 8, hd_session.seeds[root]);
+  hd_session.admitted[root] = true;
+}
+
+void hd_session_cache_forget(const uint8_t *seed) {
+  int root = (NULL == seed) ? -1 : hd_session_find_seed(seed);
+  if (0 > root) {
+    return;
+  }
+
+  for (int i = 0; i < HD_SESSION_CACHE_ENTRIES; i++) {
+    if (root == hd_session.entries[i].root) {
+      memzero(&hd_session.entries[i], sizeof(hd_session_entry_t));
+    }
+  }
+  memzero(hd_session.seeds[root], sizeof(hd_session.seeds[root]));
+  hd_session.admitted[root] = false;
+}
+
+void hd_session_cache_clear(void) {
+  if (0 < hd_session.hits + hd_session.misses) {
+    LOG_INFO("hd session: %lu hits, %lu misses",
+             (unsigned long)hd_session.hits,
+             (unsigned long)hd_session.misses);
+  }
+  memzero(&hd_session, sizeof(hd_session));
+}
+
+void hd_session_cache_stats(uint32_t *hits, uint32_t *misses) {
+  if (NULL != hits) {
+    *hits = hd_session.hits;
+  }
+  if (NULL != misses) {
+    *misses = hd_session.misses;
+  }
+}
+
+void hd_path_sort_order(const void *paths,
+                        size_t count,
+                        hd_path_getter_t get_path,
+                        uint16_t *order) {
+  for (size_t i = 0; i < count; i++) {
+    order[i] = i;
+  }
+
+  // insertion sort; lists are small and usually already sorted
+  for (size_t i = 1; i < count; i++) {
+    const uint16_t current = order[i];
+    size_t current_len = 0;
+    const uint32_t *current_path = get_path(paths, current, &current_len);
+    size_t j = i;
+    for (; j > 0; j--) {
+      size_t prev_len = 0;
+      const uint32_t *prev_path = get_path(paths, order[j - 1], &prev_len);
+      size_t k = 0;
+      while (k < prev_len && k < current_len &&
+             prev_path[k] == current_path[k]) {
+        k++;
+      }
+      const bool greater = (k < prev_len && k < current_len)
+                               ? prev_path[k] > current_path[k]
+                               : prev_len > current_len;
+      if (!greater) {
+        break;
+      }
+      order[j] = order[j - 1];
+    }
+    order[j] = current;
+  }
+}
+
 ui_display_node *ui_create_display_node(const char *title,
                                         const size_t title_size,
                                         const char *value,
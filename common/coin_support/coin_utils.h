@@ -68,6 +68,14 @@
 /// NON SEGWIT purpose id
 #define NON_SEGWIT 0x8000002C
 
+/// Number of path levels whose intermediate nodes are kept by hd_path_cache_t
+#define HD_PATH_CACHE_MAX_DEPTH 5
+
+/// Number of seeds whose nodes the session derivation cache may keep
+#define HD_SESSION_CACHE_SEEDS 4
+/// Number of hardened prefix nodes kept by the session derivation cache
+#define HD_SESSION_CACHE_ENTRIES 8
+
 typedef enum Coin_Type {
   COIN_TYPE_BITCOIN = 0x01,
   COIN_TYPE_BTC_TEST = 0x02,
@@ -204,6 +212,35 @@ typedef struct ui_display_node {
   struct ui_display_node *next;
 } ui_display_node;
 
+/**
+ * @brief Cache of the intermediate nodes of the most recently derived path
+ * @details nodes[0] holds the master node and nodes[i] holds the node at
+ * path[0..i-1]. Deriving a path sharing a prefix with the cached path
+ * branches from the deepest common node instead of starting from the seed.
+ * The cache holds private keys; it must be cleared with
+ * @ref hd_path_cache_clear once the derivations are done.
+ */
+typedef struct {
+  const char *curve;
+  const uint8_t *seed;
+  bool master_filled;
+  /// Level of a node taken from the session cache; the nodes between the
+  /// master node and it were not derived
+  size_t base;
+  size_t depth;
+  uint32_t path[HD_PATH_CACHE_MAX_DEPTH];
+  HDNode nodes[HD_PATH_CACHE_MAX_DEPTH + 1];
+} hd_path_cache_t;
+
+/**
+ * @brief Accessor for the index-th derivation path of an app specific list
+ * @details Used by @ref hd_path_sort_order to sort lists of different protobuf
+ * types.
+ */
+typedef const uint32_t *(*hd_path_getter_t)(const void *paths,
+                                            size_t index,
+                                            size_t *path_length);
+
 /**
  * @brief Checks if the provided 32-bit value has its MSB set.
  *
@@ -289,6 +326,100 @@ bool derive_hdnode_from_path(const uint32_t *path,
                              const uint8_t *seed,
                              HDNode *hdnode);
 
+/**
+ * @brief Initializes an empty derivation cache for the provided seed & curve
+ *
+ * @param [out] cache   Reference to the cache to initialize
+ * @param [in] curve    Curve name
+ * @param [in] seed     Seed of 64 bytes; must outlive the cache
+ */
+void hd_path_cache_init(hd_path_cache_t *cache,
+                        const char *curve,
+                        const uint8_t *seed);
+
+/**
+ * @brief Same as @ref derive_hdnode_from_path but reuses the nodes of the
+ * common prefix with the previously derived path
+ * @details Paths deeper than HD_PATH_CACHE_MAX_DEPTH are supported; only the
+ * levels beyond the limit are not cached. The public key of the derived node is
+ * filled; for ed25519 nodes it is the 32 byte key after the 0x01 prefix byte.
+ *
+ * @param cache             Reference to an initialized cache
+ * @param [in] path         Path to derive the hdnode.
+ * @param [in] path_length  Length of the path.
+ * @param [out] hdnode      Pointer to the HDNode instance used to store the
+ * derived hdnode.
+ *
+ * @return bool Indicating if the derivation was successful
+ * @retval true If the node derivation succeeded.
+ * @retval false If the node derivation failed.
+ */
+bool hd_path_cache_derive(hd_path_cache_t *cache,
+                          const uint32_t *path,
+                          size_t path_length,
+                          HDNode *hdnode);
+
+/**
+ * @brief Clears the cached nodes
+ *
+ * @param cache Reference to the cache to clear
+ */
+void hd_path_cache_clear(hd_path_cache_t *cache);
+
+/**
+ * @brief Lets the session derivation cache keep the nodes of the seed
+ * @details Until the seed is forgotten, @ref derive_hdnode_from_path and
+ * @ref hd_path_cache_derive keep the node at the hardened prefix of each
+ * derived path (eg. m/84'/0'/0') and start later derivations of the seed from
+ * it. The seed is identified by its SHA256 hash. Admitting more than
+ * HD_SESSION_CACHE_SEEDS seeds forgets the oldest one. The caller owns the
+ * lifetime; the nodes hold private keys and must be wiped with
+ * @ref hd_session_cache_forget or @ref hd_session_cache_clear as soon as the
+ * seed is no longer held.
+ *
+ * @param [in] seed Seed of 64 bytes
+ */
+void hd_session_cache_admit(const uint8_t *seed);
+
+/**
+ * @brief Wipes the nodes of the seed and stops caching them
+ *
+ * @param [in] seed Seed of 64 bytes
+ */
+void hd_session_cache_forget(const uint8_t *seed);
+
+/**
+ * @brief Wipes every cached node and forgets every seed
+ * @details The hit rate since the previous clear is written to the device
+ * logs first, if any derivation went through the cache.
+ */
+void hd_session_cache_clear(void);
+
+/**
+ * @brief Returns the lookups of the session derivation cache since the last
+ * @ref hd_session_cache_clear
+ * @details Only derivations of admitted seeds are counted.
+ *
+ * @param [out] hits    Derivations which started from a cached node
+ * @param [out] misses  Derivations which started from the master node
+ */
+void hd_session_cache_stats(uint32_t *hits, uint32_t *misses);
+
+/**
+ * @brief Computes the lexicographic order of a list of derivation paths
+ * @details Deriving the paths in this order through @ref hd_path_cache_derive
+ * visits every shared prefix only once.
+ *
+ * @param [in] paths    Reference to the app specific list of paths
+ * @param [in] count    Number of paths in the list
+ * @param [in] get_path Accessor for the paths in the list
+ * @param [out] order   Buffer of count entries to store the sorted indices
+ */
+void hd_path_sort_order(const void *paths,
+                        size_t count,
+                        hd_path_getter_t get_path,
+                        uint16_t *order);
+
 void bech32_addr_encode(char *output,
                         char *hrp,
                         uint8_t *address_bytes,
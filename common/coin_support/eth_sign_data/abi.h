@@ -123,7 +123,8 @@ uint8_t Abi_DynamicHelp(Abi_Type_e inputAbiType,
 /**
  * @brief This function converts ABI value based on Abi_Type_e to UTF8 format
  * to be displayed on the LED display for user verification. This function
- * creates and returns a UI node of type ui_display_node.
+ * writes the string into the buffer provided by the caller and returns the
+ * title for the datatype.
  * Important thing to note here is that it only supports static Abi type data.
  * If the Abi data is dynamic, it must be broken down into static data and then
  * stringified.
@@ -134,12 +135,27 @@ uint8_t Abi_DynamicHelp(Abi_Type_e inputAbiType,
  * ->if (inputAbiType == Abi_bytes_e): This depicts number of bytes in the Abi
  * data
  * ->else it is not used
- * @return ui_display_node: This function returns pointer to the UI node which
- * can be displayed by the caller.
+ * @param pValue Buffer to store the UTF8 string
+ * @param valueSize Size of pValue; refer @ref ABI_StringifySize
+ * @return const char*: Title for the datatype of the stringified data. NULL if
+ * the type cannot be displayed or the buffer is too small.
  */
-ui_display_node *ABI_Stringify(Abi_Type_e inputAbiType,
-                               uint8_t *pAbiTypeData,
-                               uint32_t additionalData);
+const char *ABI_Stringify(Abi_Type_e inputAbiType,
+                          const uint8_t *pAbiTypeData,
+                          uint32_t additionalData,
+                          char *pValue,
+                          size_t valueSize);
+
+/**
+ * @brief This function returns the size of buffer needed by
+ * @ref ABI_Stringify for the provided Abi type data.
+ *
+ * @param inputAbiType Type of Abi data to be stringified
+ * @param additionalData Same as additionalData of @ref ABI_Stringify
+ * @return size_t Size of buffer including the NULL terminator. 0 if the type
+ * cannot be displayed.
+ */
+size_t ABI_StringifySize(Abi_Type_e inputAbiType, uint32_t additionalData);
 
 /**
  * @brief This function encodes data to Abi_Type_e inputAbiType. This function
@@ -60,8 +60,8 @@
 #include <stdint.h>
 
 #include "abi.h"
-#include "address.h"
 #include "assert_conf.h"
+#include "evm_helpers.h"
 #include "evm_priv.h"
 #include "utils.h"
 
@@ -195,54 +195,44 @@ uint8_t Abi_DynamicHelp(Abi_Type_e inputAbiType,
   return returnCode;
 }
 
-ui_display_node *ABI_Stringify(Abi_Type_e inputAbiType,
-                               uint8_t *pAbiTypeData,
-                               uint32_t additionalData) {
-  ui_display_node *ui_node = NULL;
+const char *ABI_Stringify(Abi_Type_e inputAbiType,
+                          const uint8_t *pAbiTypeData,
+                          uint32_t additionalData,
+                          char *pValue,
+                          size_t valueSize) {
+  const char *title = NULL;
+
+  if ((NULL == pAbiTypeData) || (NULL == pValue) ||
+      (ABI_StringifySize(inputAbiType, additionalData) > valueSize)) {
+    return title;
+  }
+  memzero(pValue, valueSize);
 
   switch (inputAbiType) {
     case Abi_uint256_e: {
-      char staticBufferInUTF8[200];
+      char staticBufferInUTF8[65];
       memzero(staticBufferInUTF8, sizeof(staticBufferInUTF8));
 
-      byte_array_to_hex_string(pAbiTypeData, 32, &(staticBufferInUTF8[0]), 65);
+      byte_array_to_hex_string(pAbiTypeData,
+                               32,
+                               &(staticBufferInUTF8[0]),
+                               sizeof(staticBufferInUTF8));
 
       convert_byte_array_to_decimal_string(
-          64, 0, &(staticBufferInUTF8[0]), &(staticBufferInUTF8[100]), 100);
-
-      ui_node = ui_create_display_node(
-          "Datatype:uint256\0", 25, &(staticBufferInUTF8[100]), 100);
+          64, 0, &(staticBufferInUTF8[0]), pValue, valueSize);
+      title = "Datatype:uint256";
       break;
     }
     case Abi_address_e: {
-      char staticBufferInUTF8[43] = "0x";
-
       // generating checksum'd address
-      ethereum_address_checksum((pAbiTypeData + Abi_address_e_OFFSET_BE),
-                                &(staticBufferInUTF8[2]),
-                                false,
-                                g_evm_app->chain_id);
-      ui_node = ui_create_display_node("Datatype:address\0",
-                                       25,
-                                       &(staticBufferInUTF8[0]),
-                                       sizeof(staticBufferInUTF8));
+      evm_format_address(pAbiTypeData + Abi_address_e_OFFSET_BE, pValue);
+      title = "Datatype:address";
       break;
     }
     case Abi_bytes_e: {
-      uint32_t numBytesBuffer = (2 * additionalData) + 1;
-
-      char *dynamicBufferInUTF8 = (char *)malloc(numBytesBuffer);
-
-      /* Assert to ensure that malloc did not fail */
-      ASSERT(NULL != dynamicBufferInUTF8);
-      memzero(dynamicBufferInUTF8, numBytesBuffer);
-
-      byte_array_to_hex_string(
-          pAbiTypeData, additionalData, dynamicBufferInUTF8, numBytesBuffer);
-
-      ui_node = ui_create_display_node(
-          "Datatype:bytes\0", 25, dynamicBufferInUTF8, numBytesBuffer);
-      free(dynamicBufferInUTF8);
+      byte_array_to_hex_string(pAbiTypeData, additionalData, pValue, valueSize);
+      title = "Datatype:bytes";
+      break;
     }
     /* Handle all Abi_Type_e to suppress compilation warning */
     case Abi_bytes_dynamic_e:
@@ -252,5 +242,20 @@ ui_display_node *ABI_Stringify(Abi_Type_e inputAbiType,
     }
   }
 
-  return ui_node;
-}
\ No newline at end of file
+  return title;
+}
+
+size_t ABI_StringifySize(Abi_Type_e inputAbiType, uint32_t additionalData) {
+  switch (inputAbiType) {
+    case Abi_uint256_e:
+      // 78 decimal digits at most; same as needed by the conversion
+      return 100;
+    case Abi_address_e:
+      // "0x" followed by 40 hex characters
+      return 43;
+    case Abi_bytes_e:
+      return (2 * (size_t)additionalData) + 1;
+    default:
+      return 0;
+  }
+}
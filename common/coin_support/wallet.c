@@ -122,30 +122,65 @@ bool encrypt_shares() {
   return true;
 }
 
-bool decrypt_shares() {
-  // always consider 4 shares for decryption
+static bool mac_equal(const uint8_t *a, const uint8_t *b, size_t len) {
+  uint8_t diff = 0;
+  for (size_t i = 0; i < len; i++) {
+    diff |= a[i] ^ b[i];
+  }
+  return diff == 0;
+}
+
+bool decrypt_share(uint8_t share_index, bool verify_mac) {
+  if (share_index >= TOTAL_NUMBER_OF_SHARES)
+    return false;
+
+  uint8_t *encryption_data =
+      wallet_shamir_data.share_encryption_data[share_index];
   uint8_t share[BLOCK_SIZE];
-  chacha20poly1305_ctx ctx;
-  for (int i = 0; i < wallet.total_number_of_shares; i++) {
-    rfc7539_init(&ctx,
-                 wallet_credential_data.password_single_hash,
-                 wallet_shamir_data.share_encryption_data[i]);
-    rfc7539_auth(&ctx, wallet_shamir_data.mnemonic_shares[i], BLOCK_SIZE);
-    chacha20poly1305_decrypt(
-        &ctx, wallet_shamir_data.mnemonic_shares[i], share, BLOCK_SIZE);
-    chacha20poly1305_finish(
-        &ctx,
-        (uint8_t *)(wallet_shamir_data.share_encryption_data[i] +
-                    PADDED_NONCE_SIZE));
-    // TODO: Add mac comparison for decryption verification
-    memcpy(wallet_shamir_data.mnemonic_shares[i], share, BLOCK_SIZE);
+  uint8_t mac[WALLET_MAC_SIZE];
+  chacha20poly1305_ctx ctx, stream;
+
+  // encrypt_shares() authenticates the plain share ahead of the cipher text,
+  // so the share is decrypted with a copy of the context before the MAC is
+  // computed on the original one
+  rfc7539_init(
+      &ctx, wallet_credential_data.password_single_hash, encryption_data);
+  memcpy(&stream, &ctx, sizeof(ctx));
+  chacha20poly1305_decrypt(&stream,
+                           wallet_shamir_data.mnemonic_shares[share_index],
+                           share,
+                           BLOCK_SIZE);
+  rfc7539_auth(&ctx, share, BLOCK_SIZE);
+  chacha20poly1305_auth(
+      &ctx, wallet_shamir_data.mnemonic_shares[share_index], BLOCK_SIZE);
+  chacha20poly1305_finish(&ctx, mac);
+
+  bool verified = !verify_mac || mac_equal(mac,
+                                           encryption_data + PADDED_NONCE_SIZE,
+                                           WALLET_MAC_SIZE);
+  if (verified) {
+    memcpy(wallet_shamir_data.mnemonic_shares[share_index], share, BLOCK_SIZE);
+  }
+
+  memzero(share, sizeof(share));
+  memzero(&ctx, sizeof(ctx));
+  memzero(&stream, sizeof(stream));
+  return verified;
+}
+
+bool decrypt_shares(uint8_t share_mask, uint8_t verify_mask) {
+  bool status = true;
+  for (uint8_t i = 0; status && i < TOTAL_NUMBER_OF_SHARES; i++) {
+    if (share_mask & (1 << i)) {
+      status = decrypt_share(i, (verify_mask & (1 << i)) != 0);
+    }
   }
   memzero(wallet_credential_data.password_single_hash,
           sizeof(wallet_credential_data.password_single_hash));
   memzero(wallet_shamir_data.share_encryption_data,
           sizeof(wallet_shamir_data.share_encryption_data));
 
-  return true;
+  return status;
 }
 
 void calculate_checksum(const Wallet *wallet, uint8_t *checksum) {
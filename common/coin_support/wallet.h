@@ -211,22 +211,44 @@ void clear_wallet_data();
  */
 bool encrypt_shares();
 
+/**
+ * @brief Decrypts a share in place using chachapoly
+ * @details With verify_mac, the share is left encrypted if its MAC does not
+ * match. Only the shares of the cards carry their own MAC: the device share is
+ * stored without one. The key and the nonce are kept, so that the other shares
+ * needed can be decrypted.
+ *
+ * @param share_index Index of the share in wallet_shamir_data
+ * @param verify_mac Whether to check the MAC of the share
+ *
+ * @return Success status
+ * @retval true Success
+ * @retval false Invalid index or MAC mismatch
+ *
+ * @see decrypt_shares()
+ * @since v1.0.0
+ */
+bool decrypt_share(uint8_t share_index, bool verify_mac);
+
 /**
  * @brief Decrypt hash of share using chachapoly
- * @details
+ * @details Only the shares in share_mask are decrypted, eg. the threshold of
+ * shares the recovery uses rather than all of them. The key and the nonces are
+ * cleared afterwards, even on failure.
  *
- * @param []
+ * @param share_mask Bit i set to decrypt the share at index i
+ * @param verify_mask Bit i set to verify the MAC of the share at index i
  *
  * @return Success status
  * @retval true Success
- * @retval false Failure
+ * @retval false A share failed its MAC verification
  *
- * @see
+ * @see decrypt_share()
  * @since v1.0.0
  *
  * @note
  */
-bool decrypt_shares();
+bool decrypt_shares(uint8_t share_mask, uint8_t verify_mask);
 
 /**
  * @brief Calculate the checksum for wallet's data stored and retrieved from
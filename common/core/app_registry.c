@@ -66,6 +66,15 @@
 #include <string.h>
 
 #include "assert_conf.h"
+#include "bip32.h"
+#include "board.h"
+#include "logger.h"
+#include "mem_diag.h"
+
+#if USE_SIMULATOR == 1
+// uwTick is clock() on the simulator
+#include <time.h>
+#endif
 
 /*****************************************************************************
  * EXTERN VARIABLES
@@ -75,6 +84,10 @@
  * PRIVATE MACROS AND DEFINES
  *****************************************************************************/
 
+#if REGISTRY_MAX_APPS > 32
+#error "initialized_apps holds at most 32 apps"
+#endif
+
 /*****************************************************************************
  * PRIVATE TYPEDEFS
  *****************************************************************************/
@@ -85,6 +98,12 @@
 
 static const cy_app_desc_t *descriptors[REGISTRY_MAX_APPS] = {0};
 
+/// Bit i is set once the init of app i has run
+static uint32_t initialized_apps = 0;
+
+/// Dispatch counters, the marks of mem_diag are read on demand
+static registry_app_stats_t app_stats[REGISTRY_MAX_APPS] = {0};
+
 /*****************************************************************************
  * GLOBAL VARIABLES
  *****************************************************************************/
@@ -108,23 +127,84 @@ bool registry_add_app(const cy_app_desc_t *app_desc) {
     return status;
   }
 
+  // ensure registry storage does not overflow
+  ASSERT(app_desc->id < REGISTRY_MAX_APPS);
+
   // ensure app-id collision safety among descriptor list
-  if (NULL != registry_get_app_desc(app_desc->id)) {
+  if (NULL != descriptors[app_desc->id]) {
     return status;
   }
 
-  // ensure registry storage does not overflow
-  ASSERT(app_desc->id < REGISTRY_MAX_APPS);
-
   descriptors[app_desc->id] = app_desc;
   status = true;
   return status;
 }
 
 const cy_app_desc_t *registry_get_app_desc(uint32_t app_id) {
-  return descriptors[app_id];
+  // the id comes from the host
+  if (REGISTRY_MAX_APPS <= app_id || NULL == descriptors[app_id]) {
+    return NULL;
+  }
+
+  const cy_app_desc_t *desc = descriptors[app_id];
+  if (0 == (initialized_apps & (1UL << app_id))) {
+    initialized_apps |= 1UL << app_id;
+    if (NULL != desc->init) {
+      desc->init(desc->app_config);
+    }
+  }
+  return desc;
 }
 
 const cy_app_desc_t **registry_get_app_list() {
   return descriptors;
 }
+
+void registry_dispatch(const cy_app_desc_t *desc, usb_event_t usb_evt) {
+  uint32_t start = uwTick;
+  desc->app(usb_evt, desc->app_config);
+  uint32_t elapsed = uwTick - start;
+  // the next app has to opt in to streamed commands on its own
+  usb_stream_set_accepted(false);
+  // the flow is over; drop the key material derived from its nodes
+  hdnode_ckd_hmac_cache_clear();
+
+  registry_app_stats_t *stats = &app_stats[desc->id];
+  stats->invocations++;
+  stats->total_ms += elapsed;
+  if (elapsed > stats->max_ms) {
+    stats->max_ms = elapsed;
+  }
+}
+
+bool registry_get_app_stats(uint32_t app_id, registry_app_stats_t *stats) {
+  if (REGISTRY_MAX_APPS <= app_id || NULL == stats) {
+    return false;
+  }
+
+  mem_diag_stats_t marks = {0};
+  mem_diag_get_app_stats(app_id, &marks);
+  *stats = app_stats[app_id];
+  stats->stack_peak = marks.stack_peak;
+  stats->heap_peak = marks.heap_peak;
+  return true;
+}
+
+void registry_reset_app_stats(void) {
+  memset(app_stats, 0, sizeof(app_stats));
+  mem_diag_reset_app_stats();
+}
+
+void registry_log_report(void) {
+  for (uint32_t app_id = 0; app_id < REGISTRY_MAX_APPS; app_id++) {
+    const registry_app_stats_t *stats = &app_stats[app_id];
+    if (0 == stats->invocations) {
+      continue;
+    }
+    LOG_CRITICAL("app: %lu runs %lu total %lu max %lu",
+                 (unsigned long)app_id,
+                 (unsigned long)stats->invocations,
+                 (unsigned long)stats->total_ms,
+                 (unsigned long)stats->max_ms);
+  }
+}
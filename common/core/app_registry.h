@@ -30,14 +30,33 @@
  *****************************************************************************/
 typedef void (*app_entry)(usb_event_t, const void *);
 
+/**
+ * @brief App-specific setup, given the app_config of the descriptor
+ */
+typedef void (*app_init)(const void *);
+
 typedef struct cy_app_desc {
   const uint32_t id;
   const common_version_t version;
 
   const app_entry app;
   const void *app_config;
+  /// Optional, run once before the first dispatch to the app rather than at
+  /// boot, so that apps unused in a session cost nothing
+  const app_init init;
 } cy_app_desc_t;
 
+/**
+ * @brief Dispatch statistics of an app, see registry_dispatch()
+ */
+typedef struct registry_app_stats {
+  uint32_t invocations;  ///< Dispatches to the app
+  uint32_t total_ms;     ///< Time spent in the app over all dispatches
+  uint32_t max_ms;       ///< Longest dispatch
+  uint32_t stack_peak;   ///< Deepest stack of a flow, from mem_diag
+  uint32_t heap_peak;    ///< Largest heap of a flow, from mem_diag
+} registry_app_stats_t;
+
 /*****************************************************************************
  * EXPORTED VARIABLES
  *****************************************************************************/
@@ -59,12 +78,14 @@ bool registry_add_app(const cy_app_desc_t *app_desc);
 
 /**
  * The function "registry_get_app_desc" returns a pointer to the app descriptor
- * for a given app ID.
+ * for a given app ID, to dispatch to the app. The first lookup of an app runs
+ * its init.
  *
  * @param app_id The app_id parameter is an unsigned 32-bit integer that
  * represents the ID of the application.
  *
- * @return a pointer to a constant structure of type `cy_app_desc_t`.
+ * @return a pointer to a constant structure of type `cy_app_desc_t`, NULL if
+ * no app is registered under app_id.
  */
 const cy_app_desc_t *registry_get_app_desc(uint32_t app_id);
 
@@ -76,4 +97,40 @@ const cy_app_desc_t *registry_get_app_desc(uint32_t app_id);
  * pointer to a `cy_app_desc_t` structure.
  */
 const cy_app_desc_t **registry_get_app_list();
+
+/**
+ * @brief Runs the app of the descriptor on the event, counting the dispatch
+ * and its duration against the app id
+ * @details Any opt-in of the app to streamed commands is dropped once it
+ * returns, see usb_stream_set_accepted(), and so are the BIP32 pad digests
+ * cached by its derivations.
+ *
+ * @param desc Descriptor returned by registry_get_app_desc()
+ * @param usb_evt Event to pass to the app
+ */
+void registry_dispatch(const cy_app_desc_t *desc, usb_event_t usb_evt);
+
+/**
+ * @brief Returns the statistics of the app since boot or the last
+ * registry_reset_app_stats()
+ *
+ * @param app_id Id of the app
+ * @param stats Reference to the storage for the statistics
+ *
+ * @return bool Indicating if the app id is valid
+ */
+bool registry_get_app_stats(uint32_t app_id, registry_app_stats_t *stats);
+
+/**
+ * @brief Clears the statistics of every app, along with the per-app marks of
+ * mem_diag
+ */
+void registry_reset_app_stats(void);
+
+/**
+ * @brief Writes the dispatch statistics of every app that has run to the
+ * device logs, so that they are exported with the next log fetch
+ */
+void registry_log_report(void);
+
 #endif
\ No newline at end of file
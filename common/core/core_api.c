@@ -97,9 +97,20 @@
 static void send_core_msg(core_msg_t *core_msg,
                           const uint8_t *msg,
                           uint32_t msg_size);
+
+/**
+ * The function encodes a `core_msg_t` structure in place in the usb buffer.
+ *
+ * @param core_msg A pointer to the structure to be encoded
+ * @return pb_ostream_t Stream for the app message, right after the core message
+ */
+static pb_ostream_t encode_core_msg_in_place(const core_msg_t *core_msg);
+
 /*****************************************************************************
  * STATIC VARIABLES
  *****************************************************************************/
+/// Size of the core message encoded by encode_core_msg_in_place
+static uint32_t in_place_core_msg_size;
 
 /*****************************************************************************
  * GLOBAL VARIABLES
@@ -119,6 +130,17 @@ static void send_core_msg(core_msg_t *core_msg,
   usb_send_msg(encoded_buffer, stream.bytes_written, msg, msg_size);
 }
 
+static pb_ostream_t encode_core_msg_in_place(const core_msg_t *core_msg) {
+  uint32_t capacity = 0;
+  uint8_t *buffer = usb_get_msg_buffer(&capacity);
+  pb_ostream_t stream = pb_ostream_from_buffer(buffer, capacity);
+  ASSERT(pb_encode(&stream, CORE_MSG_FIELDS, core_msg));
+
+  in_place_core_msg_size = stream.bytes_written;
+  return pb_ostream_from_buffer(buffer + stream.bytes_written,
+                                capacity - stream.bytes_written);
+}
+
 /*****************************************************************************
  * GLOBAL FUNCTIONS
  *****************************************************************************/
@@ -133,6 +155,21 @@ void send_response_to_host(const uint8_t *msg, const uint32_t size) {
   return;
 }
 
+pb_ostream_t begin_response_to_host(void) {
+  core_msg_t core_msg = CORE_MSG_INIT_ZERO;
+  core_msg.which_type = CORE_MSG_CMD_TAG;
+
+  // TODO: Move applet_id management to core
+  core_msg.cmd.applet_id = get_applet_id();
+
+  return encode_core_msg_in_place(&core_msg);
+}
+
+void end_response_to_host(const pb_ostream_t *stream) {
+  ASSERT(NULL != stream);
+  usb_send_msg_in_place(in_place_core_msg_size, stream->bytes_written);
+}
+
 void send_core_error_msg_to_host(uint32_t core_error_type) {
   core_msg_t core_msg = CORE_MSG_INIT_ZERO;
   core_msg.which_type = CORE_MSG_ERROR_TAG;
@@ -16,6 +16,7 @@
 #include <stdint.h>
 
 #include "core.pb.h"
+#include "pb_encode.h"
 
 /*****************************************************************************
  * MACROS AND DEFINES
@@ -44,6 +45,26 @@
  */
 void send_response_to_host(const uint8_t *msg, const uint32_t size);
 
+/**
+ * @brief Starts a response which the application encodes in place, without an
+ * intermediate buffer.
+ * @details The core message is encoded straight into the usb buffer and the
+ * returned stream continues right after it. Encode the application message
+ * through the stream and then call end_response_to_host(). As the usb buffer
+ * still holds the received command, the query must be decoded before.
+ *
+ * @return pb_ostream_t Stream for the application message
+ */
+pb_ostream_t begin_response_to_host(void);
+
+/**
+ * @brief Sends the response encoded through the stream returned by
+ * begin_response_to_host().
+ *
+ * @param stream Stream used to encode the application message
+ */
+void end_response_to_host(const pb_ostream_t *stream);
+
 /**
  * @brief Helper API for core to send core error messages to the USB host.
  *
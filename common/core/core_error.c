@@ -67,6 +67,7 @@
 #include "core_api.h"
 #include "events.h"
 #include "p0_events.h"
+#include "seed_session.h"
 #include "status_api.h"
 #include "ui_screens.h"
 
@@ -173,11 +174,13 @@ void handle_core_errors() {
     }
 
     mark_core_error_screen(ui_text_process_reset_due_to_inactivity, false);
+    seed_session_clear();
     p0_reset_evt();
   }
 
   if (true == evt.abort_evt) {
     usb_clear_event();
+    seed_session_clear();
     p0_reset_evt();
   }
 
@@ -63,23 +63,17 @@
 
 #include "app_registry.h"
 #include "application_startup.h"
-#include "arbitrum_app.h"
-#include "avalanche_app.h"
-#include "bsc_app.h"
 #include "btc_app.h"
 #include "btc_main.h"
 #include "dash_app.h"
 #include "doge_app.h"
-#include "eth_app.h"
+#include "evm_chains.h"
 #include "evm_main.h"
-#include "fantom_app.h"
 #include "ltc_app.h"
 #include "main_menu.h"
 #include "manager_app.h"
 #include "near_main.h"
 #include "onboarding.h"
-#include "optimism_app.h"
-#include "polygon_app.h"
 #include "restricted_app.h"
 #include "solana_main.h"
 
@@ -154,7 +148,7 @@ engine_ctx_t *get_core_flow_ctx(void) {
 
   if (MANAGER_ONBOARDING_STEP_COMPLETE == get_onboarding_step() &&
       DEVICE_AUTHENTICATED == get_auth_state()) {
-    check_invalid_wallets();
+    schedule_startup_checks();
   }
 
   // Finally enable all flows from the user
@@ -168,13 +162,7 @@ void core_init_app_registry() {
   registry_add_app(get_ltc_app_desc());
   registry_add_app(get_doge_app_desc());
   registry_add_app(get_dash_app_desc());
-  registry_add_app(get_eth_app_desc());
   registry_add_app(get_near_app_desc());
-  registry_add_app(get_polygon_app_desc());
   registry_add_app(get_solana_app_desc());
-  registry_add_app(get_bsc_app_desc());
-  registry_add_app(get_fantom_app_desc());
-  registry_add_app(get_avalanche_app_desc());
-  registry_add_app(get_optimism_app_desc());
-  registry_add_app(get_arbitrum_app_desc());
+  evm_register_chains();
 }
\ No newline at end of file
@@ -61,6 +61,12 @@
  *****************************************************************************/
 #include "events.h"
 
+#include "clock_policy.h"
+#include "session_bench.h"
+#include "systick_timer.h"
+#include "task_scheduler.h"
+#include "ui_common.h"
+
 /*****************************************************************************
  * EXTERN VARIABLES
  *****************************************************************************/
@@ -68,6 +74,12 @@
 /*****************************************************************************
  * PRIVATE MACROS AND DEFINES
  *****************************************************************************/
+/**
+ * Upper bound on the sleep between two polls of the event sources. Sources
+ * without an interrupt hook (NFC polling, LVGL tasks) are still serviced at
+ * this interval, well within the LVGL refresh period.
+ */
+#define EVENT_MAX_SLEEP_MS 10
 
 /*****************************************************************************
  * PRIVATE TYPEDEFS
@@ -76,6 +88,8 @@
 /*****************************************************************************
  * STATIC VARIABLES
  *****************************************************************************/
+static volatile bool wakeup_pending = false;
+static volatile bool work_done = false;
 
 /*****************************************************************************
  * GLOBAL VARIABLES
@@ -84,14 +98,53 @@
 /*****************************************************************************
  * STATIC FUNCTION PROTOTYPES
  *****************************************************************************/
+/**
+ * @brief Sleeps until an event source signals a wakeup or max_sleep_ms elapse
+ * @details On hardware, the core is put in sleep with WFI and the 1 ms tick
+ * suppressed (see systick_idle_wait()); any peripheral interrupt, including
+ * the application timer, wakes it up to re-check the wakeup flag. The
+ * sleep is spent at the idle clock level, the caller resumes at the run
+ * level.
+ *
+ * @param max_sleep_ms Maximum time to sleep in milliseconds
+ */
+static void wait_for_wakeup(uint32_t max_sleep_ms);
 
 /*****************************************************************************
  * STATIC FUNCTIONS
  *****************************************************************************/
+static void wait_for_wakeup(uint32_t max_sleep_ms) {
+  const uint32_t start = uwTick;
+  clock_policy_set(CLOCK_LEVEL_IDLE);
+  while (!wakeup_pending && (uwTick - start) < max_sleep_ms) {
+    systick_idle_wait(max_sleep_ms - (uwTick - start), &wakeup_pending);
+  }
+  clock_policy_set(CLOCK_LEVEL_RUN);
+}
 
 /*****************************************************************************
  * GLOBAL FUNCTIONS
  *****************************************************************************/
+void events_signal_wakeup(void) {
+  wakeup_pending = true;
+  sched_preempt();
+}
+
+void events_set_work_done(void) {
+  work_done = true;
+  events_signal_wakeup();
+}
+
+void events_reset_work_done(void) {
+  work_done = false;
+}
+
+bool events_p0_pending(void) {
+  p0_evt_t p0_event = {0};
+  usb_process_rx_packets();
+  return p0_get_evt(&p0_event);
+}
+
 evt_status_t get_events(uint8_t event_config, uint32_t timeout) {
   evt_status_t status = {0};
 
@@ -99,9 +152,18 @@ evt_status_t get_events(uint8_t event_config, uint32_t timeout) {
 
   bool p0_evt_occurred = false;
   bool p1_evt_occurred = false;
+  bool redraw_pending = false;
+
+  SESSION_BENCH_ENTER(EVENT_CONFIG_USB == (event_config & EVENT_CONFIG_USB)
+                          ? SESSION_PHASE_TRANSPORT
+                          : SESSION_PHASE_OTHER);
 
   /* Poll for the selected events, until atleast one event is captured. */
   while (1) {
+    /* Clear before polling so that a wakeup raised meanwhile is not lost */
+    wakeup_pending = false;
+    redraw_pending = false;
+    usb_process_rx_packets();
     p0_evt_occurred = p0_get_evt(&(status.p0_event));
 
     /* As soon as a p0 event is registered, break the loop */
@@ -116,8 +178,18 @@ evt_status_t get_events(uint8_t event_config, uint32_t timeout) {
         p0_ctx_init(timeout);
       }
 
-      lv_task_handler();
+      redraw_pending = ui_task_handler();
       p1_evt_occurred |= ui_get_and_reset_event(&(status.ui_event));
+#ifdef SESSION_BENCH
+      // the benchmark build confirms a screen (choosing its first option) as
+      // soon as it is drawn
+      if (!p1_evt_occurred) {
+        status.ui_event.event_occured = true;
+        status.ui_event.event_type = UI_EVENT_CONFIRM;
+        status.ui_event.list_selection = 1;
+        p1_evt_occurred = true;
+      }
+#endif
     }
 
     if (EVENT_CONFIG_USB == (event_config & EVENT_CONFIG_USB)) {
@@ -129,14 +201,25 @@ evt_status_t get_events(uint8_t event_config, uint32_t timeout) {
       p1_evt_occurred |= nfc_get_event(&(status.nfc_event));
     }
 
-    /* In each loop, provide 50ms delay for things to stabilize, for example USB
-     * interrupts, OLED display, etc */
-    BSP_DelayMs(50);
+    if (EVENT_CONFIG_WORK == (event_config & EVENT_CONFIG_WORK) && work_done) {
+      work_done = false;
+      status.work_done = true;
+      p1_evt_occurred = true;
+    }
 
     /* As soon as an event is registered, break the loop */
     if (p1_evt_occurred) {
       break;
     }
+
+    /* Fill the idle time with background work, bounded so that the sources
+     * are polled again within EVENT_MAX_SLEEP_MS */
+    if (redraw_pending || sched_run_until_idle(EVENT_MAX_SLEEP_MS)) {
+      continue;
+    }
+
+    /* Sleep until an ISR signals a new event or the next poll is due */
+    wait_for_wakeup(EVENT_MAX_SLEEP_MS);
   }
 
   /* Any post cleanup required */
@@ -31,6 +31,7 @@
 #define EVENT_CONFIG_UI __EVENT_CONFIG__(0)
 #define EVENT_CONFIG_USB __EVENT_CONFIG__(1)
 #define EVENT_CONFIG_NFC __EVENT_CONFIG__(2)
+#define EVENT_CONFIG_WORK __EVENT_CONFIG__(3)
 
 /*****************************************************************************
  * TYPEDEFS
@@ -45,6 +46,8 @@ typedef struct {
   ui_event_t ui_event;
   usb_event_t usb_event;
   nfc_event_t nfc_event;
+  bool work_done;    ///< Background work completed, refer @ref
+                     ///< events_set_work_done
 } evt_status_t;
 
 /*****************************************************************************
@@ -54,6 +57,48 @@ typedef struct {
 /*****************************************************************************
  * GLOBAL FUNCTION PROTOTYPES
  *****************************************************************************/
+/**
+ * @brief Wakes up @ref get_events to re-poll the event sources
+ *
+ * @details Event producers (USB packet handler, NFC & joystick interrupts,
+ * p0 timers) should call this after setting their event so that a sleeping
+ * @ref get_events picks the event up immediately instead of at the next poll
+ * interval. Safe to call from interrupt context.
+ */
+void events_signal_wakeup(void);
+
+/**
+ * @brief Reports that the background work of the current flow step completed
+ *
+ * @details Long computations of a flow step run in slices as a scheduler task
+ * (refer @ref sched_add_task), which @ref get_events services while it waits,
+ * so that the UI, USB and aborts keep being handled. The task calls this once
+ * its work is done; @ref get_events then returns with work_done set if
+ * EVENT_CONFIG_WORK is selected. The completion stays pending until it is
+ * returned or reset with @ref events_reset_work_done.
+ */
+void events_set_work_done(void);
+
+/**
+ * @brief Drops a pending completion of background work; call before starting
+ * new work so that the completion of abandoned work is not returned
+ */
+void events_reset_work_done(void);
+
+/**
+ * @brief Cancellation checkpoint for computations that do not return to
+ * @ref get_events for a while
+ *
+ * @details Parses the packets received meanwhile, so that an abort from the
+ * host is registered, and tells if a P0 event is pending. The event is not
+ * reset: the computation stops, returns without reporting an error and the
+ * event is handled as usual by the next @ref get_events and the core. Meant
+ * to be polled every few tens of milliseconds of work.
+ *
+ * @return bool true if the computation should stop
+ */
+bool events_p0_pending(void);
+
 /**
  * @brief Get the events object
  *
@@ -268,6 +268,8 @@ void engine_run(engine_ctx_t *ctx) {
     } else if (true == evt_status.nfc_event.event_occured) {
       ENGINE_RUN_EVENT_CB(
           current_flow->nfc_cb, ctx, flow_data_ptr, evt_status.nfc_event);
+    } else if (true == evt_status.work_done) {
+      ENGINE_RUN_INITIALIZE_CB(current_flow->work_cb, ctx, flow_data_ptr);
     } else {
       /* This case should never arise */
     }
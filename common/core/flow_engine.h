@@ -37,6 +37,7 @@ typedef void (*flow_p0_evt_cb_t)(engine_ctx_t *, p0_evt_t, const void *);
 typedef void (*step_ui_evt_cb_t)(engine_ctx_t *, ui_event_t, const void *);
 typedef void (*step_usb_evt_cb_t)(engine_ctx_t *, usb_event_t, const void *);
 typedef void (*step_nfc_evt_cb_t)(engine_ctx_t *, nfc_event_t, const void *);
+typedef void (*step_work_evt_cb_t)(engine_ctx_t *, const void *);
 
 /**
  * @brief This structure needs to be filled for each step for a flow.
@@ -57,6 +58,12 @@ typedef struct {
   step_nfc_evt_cb_t
       nfc_cb; /**< NFC event callback: this callback will be called by the
                  engine in case an NFC event arise during the current step */
+  step_work_evt_cb_t
+      work_cb; /**< Work event callback: this callback will be called by the
+                  engine once the background work of the current step reports
+                  completion, refer @ref events_set_work_done. The step starts
+                  the work as a scheduler task, hence the engine keeps serving
+                  the other events of the step while the work runs */
   const evt_config_t
       *evt_cfg_ptr;    /**< Event configuration pointer: This pointer must store
                           the configuration related to the events which need to be
@@ -1,7 +1,7 @@
 /**
- * @file    arbitrum_app.c
+ * @file    flow_trace.c
  * @author  Cypherock X1 Team
- * @brief   Arbitrum application configuration and helpers
+ * @brief   Timestamped trace of the flow status transitions of an app flow.
  * @copyright Copyright (c) 2023 HODL TECH PTE LTD
  * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
  *target=_blank>https://mitcc.org/</a>
@@ -59,27 +59,20 @@
 /*****************************************************************************
  * INCLUDES
  *****************************************************************************/
+#include "flow_trace.h"
 
-#include "arbitrum_app.h"
+#include "board.h"
+#include "memzero.h"
 
-#include <stddef.h>
-
-#include "evm_main.h"
+#if USE_SIMULATOR == 1
+// uwTick is clock() on the simulator
+#include <time.h>
+#endif
 
 /*****************************************************************************
  * EXTERN VARIABLES
  *****************************************************************************/
 
-/**
- * @brief Whitelisted contracts with respective token symbol
- * @details A map of Ethereum contract addresses with their token symbols. These
- * will enable the device to verify the ERC20 token transaction in a
- * user-friendly manner.
- *
- * @see erc20_contracts_t
- */
-extern const erc20_contracts_t arbitrum_contracts[];
-
 /*****************************************************************************
  * PRIVATE MACROS AND DEFINES
  *****************************************************************************/
@@ -89,66 +82,59 @@ extern const erc20_contracts_t arbitrum_contracts[];
  *****************************************************************************/
 
 /*****************************************************************************
- * STATIC FUNCTION PROTOTYPES
+ * STATIC VARIABLES
  *****************************************************************************/
-
-/**
- * @brief Checks if the provided token address is whitelisted and return the
- * matching contract instance.
- *
- * @param address Reference to the buffer containing the token address
- * @param contract Pointer to store the matched contract address instance
- *
- * @return bool Indicating if the provided token address is whitelisted
- * @return true If the address matches to an entry in the whitelist
- * @return false If the address does not match to an entry in the whitelist
- */
-static bool is_token_whitelisted(const uint8_t *address,
-                                 const erc20_contracts_t **contract);
+static flow_trace_t trace;
+static uint32_t trace_start;
+static uint16_t last_status;
 
 /*****************************************************************************
- * STATIC VARIABLES
+ * GLOBAL VARIABLES
  *****************************************************************************/
 
-static const evm_config_t arbitrum_app_config = {
-    .lunit_name = "ETH",
-    .name = "Arbitrum",
-    .chain_id = 42161,
-
-    // whitelisted contracts
-    .is_token_whitelisted = is_token_whitelisted,
-};
-
-static const cy_app_desc_t arbitrum_app_desc = {
-    .id = 17,
-    .version =
-        {
-            .major = 1,
-            .minor = 0,
-            .patch = 0,
-        },
-    .app = evm_main,
-    .app_config = &arbitrum_app_config};
 /*****************************************************************************
- * GLOBAL VARIABLES
+ * STATIC FUNCTION PROTOTYPES
  *****************************************************************************/
 
 /*****************************************************************************
  * STATIC FUNCTIONS
  *****************************************************************************/
 
-static bool is_token_whitelisted(const uint8_t *address,
-                                 const erc20_contracts_t **contract) {
-  if (NULL != contract) {
-    *contract = NULL;
-  }
-  return false;
-}
-
 /*****************************************************************************
  * GLOBAL FUNCTIONS
  *****************************************************************************/
+void flow_trace_begin(uint32_t app_id) {
+  memzero(&trace, sizeof(trace));
+  trace.app_id = app_id;
+  trace.active = true;
+  last_status = 0;
+  trace_start = uwTick;
+}
 
-const cy_app_desc_t *get_arbitrum_app_desc() {
-  return &arbitrum_app_desc;
-}
\ No newline at end of file
+void flow_trace_record(uint32_t flow_status) {
+  if (!trace.active || last_status == (uint16_t)flow_status)
+    return;
+
+  last_status = (uint16_t)flow_status;
+  if (FLOW_TRACE_MAX_ENTRIES <= trace.count) {
+    if (UINT8_MAX > trace.dropped)
+      trace.dropped++;
+    return;
+  }
+  trace.entries[trace.count].flow_status = last_status;
+  trace.entries[trace.count].at = uwTick - trace_start;
+  trace.count++;
+}
+
+void flow_trace_end(void) {
+  if (!trace.active)
+    return;
+  trace.duration = uwTick - trace_start;
+  trace.active = false;
+}
+
+const flow_trace_t *flow_trace_get(void) {
+  if (trace.active)
+    trace.duration = uwTick - trace_start;
+  return &trace;
+}
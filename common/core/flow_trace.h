@@ -0,0 +1,89 @@
+/**
+ * @file    flow_trace.h
+ * @author  Cypherock X1 Team
+ * @brief   Timestamped trace of the flow status transitions of an app flow.
+ * @copyright Copyright (c) 2023 HODL TECH PTE LTD
+ * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
+ * target=_blank>https://mitcc.org/</a>
+ */
+#ifndef FLOW_TRACE_H
+#define FLOW_TRACE_H
+
+/*****************************************************************************
+ * INCLUDES
+ *****************************************************************************/
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*****************************************************************************
+ * MACROS AND DEFINES
+ *****************************************************************************/
+
+/// Transitions kept per flow; later transitions are only counted as dropped
+#define FLOW_TRACE_MAX_ENTRIES 24
+
+/*****************************************************************************
+ * TYPEDEFS
+ *****************************************************************************/
+
+/**
+ * @brief A transition of the flow status
+ */
+typedef struct flow_trace_entry {
+  uint16_t flow_status;    ///< Core status in the high, app status in the low
+                           ///< byte, as reported in core_status_t
+  uint32_t at;             ///< uwTick elapsed since the start of the flow
+} flow_trace_entry_t;
+
+/**
+ * @brief Trace of the last app flow started from the host
+ */
+typedef struct flow_trace {
+  uint32_t app_id;
+  uint32_t duration;    ///< uwTick elapsed until the flow returned, or so
+                        ///< far if it is still running
+  bool active;
+  uint8_t count;
+  uint8_t dropped;
+  flow_trace_entry_t entries[FLOW_TRACE_MAX_ENTRIES];
+} flow_trace_t;
+
+/*****************************************************************************
+ * EXPORTED VARIABLES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * GLOBAL FUNCTION PROTOTYPES
+ *****************************************************************************/
+
+/**
+ * @brief Starts a new trace for the flow of the app, discarding the previous
+ *
+ * @param app_id Id of the app from the app registry
+ */
+void flow_trace_begin(uint32_t app_id);
+
+/**
+ * @brief Appends a transition to the trace of the running flow
+ * @details Called by status_api on every update of the flow status. Updates
+ * outside a flow and updates leaving the status unchanged are ignored.
+ *
+ * @param flow_status The flow_status of core_status_t after the update
+ */
+void flow_trace_record(uint32_t flow_status);
+
+/**
+ * @brief Closes the trace of the flow started by flow_trace_begin(), keeping
+ * it until the next flow begins so that the host can fetch it
+ */
+void flow_trace_end(void);
+
+/**
+ * @brief Returns the trace of the running or the last app flow
+ *
+ * @return const flow_trace_t* Reference to the trace
+ */
+const flow_trace_t *flow_trace_get(void);
+
+#endif /* FLOW_TRACE_H */
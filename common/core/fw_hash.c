@@ -0,0 +1,165 @@
+/**
+ * @file    fw_hash.c
+ * @author  Cypherock X1 Team
+ * @brief   SHA-256 of the firmware image, hashed in the idle time after boot.
+ * @copyright Copyright (c) 2023 HODL TECH PTE LTD
+ * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
+ *target=_blank>https://mitcc.org/</a>
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * (c) Copyright 2023 by HODL TECH PTE LTD
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * "Commons Clause" License Condition v1.0
+ *
+ * The Software is provided to you by the Licensor under the License,
+ * as defined below, subject to the following condition.
+ *
+ * Without limiting other conditions in the License, the grant of
+ * rights under the License will not include, and the License does not
+ * grant to you, the right to Sell the Software.
+ *
+ * For purposes of the foregoing, "Sell" means practicing any or all
+ * of the rights granted to you under the License to provide to third
+ * parties, for a fee or other consideration (including without
+ * limitation fees for hosting or consulting/ support services related
+ * to the Software), a product or service whose value derives, entirely
+ * or substantially, from the functionality of the Software. Any license
+ * notice or attribution required by the License must also include
+ * this Commons Clause License Condition notice.
+ *
+ * Software: All X1Wallet associated files.
+ * License: MIT
+ * Licensor: HODL TECH PTE LTD
+ *
+ ******************************************************************************
+ */
+
+
+/*****************************************************************************
+ * INCLUDES
+ *****************************************************************************/
+#include "fw_hash.h"
+
+#include <string.h>
+
+#include "board.h"
+#include "flash_api.h"
+#include "mem_config.h"
+#include "sha2.h"
+#include "task_scheduler.h"
+
+/*****************************************************************************
+ * EXTERN VARIABLES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * PRIVATE MACROS AND DEFINES
+ *****************************************************************************/
+/// Bytes hashed between two checks of the slice budget
+#define FW_HASH_BLOCK_SIZE 2048
+
+/// Slice given to the background hashing
+#define FW_HASH_SLICE_MS 10
+
+/*****************************************************************************
+ * PRIVATE TYPEDEFS
+ *****************************************************************************/
+
+/*****************************************************************************
+ * STATIC FUNCTION PROTOTYPES
+ *****************************************************************************/
+/**
+ * @brief Hashes the image block by block until it is done or the budget is
+ * used up
+ *
+ * @param budget_ms Time in milliseconds available for hashing
+ * @return true If a part of the image is left to hash
+ * @return false If the digest is ready
+ */
+static bool fw_hash_slice(uint32_t budget_ms);
+
+/*****************************************************************************
+ * STATIC VARIABLES
+ *****************************************************************************/
+static SHA256_CTX fw_hash_ctx;
+static uint32_t fw_hash_offset = 0;
+static uint32_t fw_hash_size = 0;
+static uint8_t fw_digest[SHA256_DIGEST_LENGTH] = {0};
+static bool fw_hash_started = false;
+static bool fw_hash_ready = false;
+
+/*****************************************************************************
+ * GLOBAL VARIABLES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * STATIC FUNCTIONS
+ *****************************************************************************/
+static bool fw_hash_slice(uint32_t budget_ms) {
+  const uint32_t start = uwTick;
+
+  while (fw_hash_offset < fw_hash_size) {
+    uint32_t len = fw_hash_size - fw_hash_offset;
+    if (FW_HASH_BLOCK_SIZE < len)
+      len = FW_HASH_BLOCK_SIZE;
+    sha256_Update(&fw_hash_ctx,
+                  (const uint8_t *)(APPLICATION_ADDRESS_BASE + fw_hash_offset),
+                  len);
+    fw_hash_offset += len;
+    if ((uwTick - start) >= budget_ms && fw_hash_offset < fw_hash_size)
+      return true;
+  }
+
+  sha256_Final(&fw_hash_ctx, fw_digest);
+  fw_hash_ready = true;
+  sched_remove_task(fw_hash_slice);
+  return false;
+}
+
+/*****************************************************************************
+ * GLOBAL FUNCTIONS
+ *****************************************************************************/
+void fw_hash_start(void) {
+  if (fw_hash_started)
+    return;
+
+  fw_hash_started = true;
+  fw_hash_offset = 0;
+  fw_hash_size = get_fwSize();
+  sha256_Init(&fw_hash_ctx);
+  // Without a free slot, fw_hash_get() hashes the whole image on demand
+  sched_add_task(fw_hash_slice, SCHED_PRIO_LOW, FW_HASH_SLICE_MS);
+}
+
+bool fw_hash_is_ready(void) {
+  return fw_hash_ready;
+}
+
+void fw_hash_get(uint8_t *digest) {
+  fw_hash_start();
+  if (!fw_hash_ready)
+    fw_hash_slice(UINT32_MAX);
+  memcpy(digest, fw_digest, sizeof(fw_digest));
+}
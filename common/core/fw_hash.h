@@ -1,27 +1,25 @@
 /**
- * @file    avalanche_app.h
+ * @file    fw_hash.h
  * @author  Cypherock X1 Team
- * @brief   Avalanche application configuration
+ * @brief   SHA-256 of the firmware image, hashed in the idle time after boot.
  * @copyright Copyright (c) 2023 HODL TECH PTE LTD
  * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
  * target=_blank>https://mitcc.org/</a>
  */
-#ifndef AVALANCHE_APP_H
-#define AVALANCHE_APP_H
+#ifndef FW_HASH_H
+#define FW_HASH_H
 
 /*****************************************************************************
  * INCLUDES
  *****************************************************************************/
 
-#include "app_registry.h"
-#include "evm_context.h"
+#include <stdbool.h>
+#include <stdint.h>
+
 /*****************************************************************************
  * MACROS AND DEFINES
  *****************************************************************************/
 
-/// Number of entries in whitelisted contracts list
-#define AVALANCHE_WHITELISTED_CONTRACTS_COUNT 0
-
 /*****************************************************************************
  * TYPEDEFS
  *****************************************************************************/
@@ -35,10 +33,26 @@
  *****************************************************************************/
 
 /**
- * @brief Returns the config for Avalanche chin app descriptor
+ * @brief Starts hashing the firmware image in background slices
+ * @details The image (get_fwSize() bytes from APPLICATION_ADDRESS_BASE) is
+ * hashed once per boot and the digest is kept in RAM. An update replaces the
+ * image from the bootloader, hence the next boot hashes it again. Calling it
+ * again is a no-op.
+ */
+void fw_hash_start(void);
+
+/**
+ * @brief Tells if the digest of the image is available without hashing
+ */
+bool fw_hash_is_ready(void);
+
+/**
+ * @brief Returns the SHA-256 digest of the firmware image
+ * @details If the background hashing has not finished yet, the remaining part
+ * of the image is hashed right away, from where the slices stopped.
  *
- * @return A const reference to cy_app_desc_t
+ * @param digest Buffer of SHA256_DIGEST_LENGTH bytes receiving the digest
  */
-const cy_app_desc_t *get_avalanche_app_desc();
+void fw_hash_get(uint8_t *digest);
 
-#endif    // AVALANCHE_APP_H
+#endif /* FW_HASH_H */
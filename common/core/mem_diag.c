@@ -0,0 +1,342 @@
+/**
+ * @file    mem_diag.c
+ * @author  Cypherock X1 Team
+ * @brief   Heap and stack high-water marks of the device and of each app.
+ * @copyright Copyright (c) 2023 HODL TECH PTE LTD
+ * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
+ *target=_blank>https://mitcc.org/</a>
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * (c) Copyright 2023 by HODL TECH PTE LTD
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * "Commons Clause" License Condition v1.0
+ *
+ * The Software is provided to you by the Licensor under the License,
+ * as defined below, subject to the following condition.
+ *
+ * Without limiting other conditions in the License, the grant of
+ * rights under the License will not include, and the License does not
+ * grant to you, the right to Sell the Software.
+ *
+ * For purposes of the foregoing, "Sell" means practicing any or all
+ * of the rights granted to you under the License to provide to third
+ * parties, for a fee or other consideration (including without
+ * limitation fees for hosting or consulting/ support services related
+ * to the Software), a product or service whose value derives, entirely
+ * or substantially, from the functionality of the Software. Any license
+ * notice or attribution required by the License must also include
+ * this Commons Clause License Condition notice.
+ *
+ * Software: All X1Wallet associated files.
+ * License: MIT
+ * Licensor: HODL TECH PTE LTD
+ *
+ ******************************************************************************
+ */
+
+/*****************************************************************************
+ * INCLUDES
+ *****************************************************************************/
+
+#include "mem_diag.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#include "app_registry.h"
+#include "logger.h"
+
+#if USE_SIMULATOR == 0
+#include <malloc.h>
+#endif
+
+/*****************************************************************************
+ * EXTERN VARIABLES
+ *****************************************************************************/
+
+#if USE_SIMULATOR == 0
+/// Top of RAM where the stack starts, from the linker script
+extern uint32_t _estack;
+
+/// Moves the end of the heap, from the system calls of the HAL
+extern void *_sbrk(ptrdiff_t incr);
+#endif
+
+/*****************************************************************************
+ * PRIVATE MACROS AND DEFINES
+ *****************************************************************************/
+
+/// Pattern painted over the free stack
+#define MEM_DIAG_CANARY 0xC5ACCE55
+
+/// Words left unpainted below the frame of the painter
+#define MEM_DIAG_SP_GUARD_WORDS 16
+
+/// Value of flow_app_id while no app flow is running
+#define MEM_DIAG_NO_APP UINT32_MAX
+
+/*****************************************************************************
+ * PRIVATE TYPEDEFS
+ *****************************************************************************/
+
+/*****************************************************************************
+ * STATIC VARIABLES
+ *****************************************************************************/
+
+static uint32_t heap_current = 0;
+static uint32_t flow_heap_peak = 0;
+static uint32_t flow_app_id = MEM_DIAG_NO_APP;
+static mem_diag_stats_t device_stats = {0};
+static mem_diag_stats_t app_stats[REGISTRY_MAX_APPS] = {0};
+
+#if USE_SIMULATOR == 0
+/// Lowest word of the last painting, NULL until mem_diag_init()
+static uint32_t *paint_base = NULL;
+#endif
+
+/*****************************************************************************
+ * GLOBAL VARIABLES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * STATIC FUNCTION PROTOTYPES
+ *****************************************************************************/
+
+/**
+ * @brief Paints the canary from the top of the heap up to just below the
+ * frame of this function
+ */
+static void paint_stack(void);
+
+/**
+ * @brief Returns the deepest stack reached since the last painting
+ * @details Scans up from the lowest painted word that the heap has not grown
+ * over, until the first word which is not the canary.
+ *
+ * @return uint32_t Bytes of stack from the top of RAM, 0 if not painted
+ */
+static uint32_t stack_used(void);
+
+#if USE_SIMULATOR == 0
+/**
+ * @brief Accounts a change of the heap in use and updates the peaks
+ *
+ * @param freed Usable size of the block released, 0 if none
+ * @param taken Usable size of the block acquired, 0 if none
+ */
+static void track_heap(uint32_t freed, uint32_t taken);
+#endif
+
+/**
+ * @brief Raises the marks to at least the given ones
+ */
+static void raise_stats(mem_diag_stats_t *stats,
+                        uint32_t stack_peak,
+                        uint32_t heap_peak);
+
+/*****************************************************************************
+ * STATIC FUNCTIONS
+ *****************************************************************************/
+
+#if USE_SIMULATOR == 0
+/**
+ * @brief Returns the first word above the heap
+ */
+static uint32_t *heap_top(void) {
+  return (uint32_t *)(((uintptr_t)_sbrk(0) + 3) & ~(uintptr_t)3);
+}
+
+static void paint_stack(void) {
+  uint32_t *low = heap_top();
+  uint32_t *high =
+      (uint32_t *)__builtin_frame_address(0) - MEM_DIAG_SP_GUARD_WORDS;
+
+  paint_base = low;
+  for (volatile uint32_t *word = low; word < high; word++) {
+    *word = MEM_DIAG_CANARY;
+  }
+}
+
+static uint32_t stack_used(void) {
+  if (NULL == paint_base) {
+    return 0;
+  }
+
+  uint32_t *top = (uint32_t *)__builtin_frame_address(0);
+  uint32_t *word = heap_top();
+  if (word < paint_base) {
+    word = paint_base;
+  }
+
+  while (word < top && MEM_DIAG_CANARY == *word) {
+    word++;
+  }
+  return (uint32_t)((uintptr_t)&_estack - (uintptr_t)word);
+}
+
+static void track_heap(uint32_t freed, uint32_t taken) {
+  heap_current = heap_current - freed + taken;
+  if (heap_current > flow_heap_peak) {
+    flow_heap_peak = heap_current;
+  }
+  if (heap_current > device_stats.heap_peak) {
+    device_stats.heap_peak = heap_current;
+  }
+}
+#else
+static void paint_stack(void) {
+  // the simulator runs on the host stack
+}
+
+static uint32_t stack_used(void) {
+  return 0;
+}
+#endif /* USE_SIMULATOR == 0 */
+
+static void raise_stats(mem_diag_stats_t *stats,
+                        uint32_t stack_peak,
+                        uint32_t heap_peak) {
+  if (stack_peak > stats->stack_peak) {
+    stats->stack_peak = stack_peak;
+  }
+  if (heap_peak > stats->heap_peak) {
+    stats->heap_peak = heap_peak;
+  }
+}
+
+/*****************************************************************************
+ * GLOBAL FUNCTIONS
+ *****************************************************************************/
+
+#if USE_SIMULATOR == 0
+/* The firmware links with --wrap for these so that every heap operation of the
+ * application passes through here. Allocations made internally by newlib (eg.
+ * stdio buffers) are not seen. */
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t count, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+void __real_free(void *ptr);
+
+void *__wrap_malloc(size_t size) {
+  void *ptr = __real_malloc(size);
+  if (NULL != ptr) {
+    track_heap(0, malloc_usable_size(ptr));
+  }
+  return ptr;
+}
+
+void *__wrap_calloc(size_t count, size_t size) {
+  void *ptr = __real_calloc(count, size);
+  if (NULL != ptr) {
+    track_heap(0, malloc_usable_size(ptr));
+  }
+  return ptr;
+}
+
+void *__wrap_realloc(void *ptr, size_t size) {
+  uint32_t freed = (NULL != ptr) ? malloc_usable_size(ptr) : 0;
+  void *new_ptr = __real_realloc(ptr, size);
+
+  if (NULL != new_ptr) {
+    track_heap(freed, malloc_usable_size(new_ptr));
+  } else if (0 == size) {
+    // realloc(ptr, 0) released the block
+    track_heap(freed, 0);
+  }
+  return new_ptr;
+}
+
+void __wrap_free(void *ptr) {
+  if (NULL != ptr) {
+    track_heap(malloc_usable_size(ptr), 0);
+  }
+  __real_free(ptr);
+}
+#endif /* USE_SIMULATOR == 0 */
+
+void mem_diag_init(void) {
+  paint_stack();
+}
+
+void mem_diag_flow_begin(uint32_t app_id) {
+  // keep what was reached outside of app flows before repainting
+  raise_stats(&device_stats, stack_used(), 0);
+
+  flow_app_id = app_id;
+  flow_heap_peak = heap_current;
+  paint_stack();
+}
+
+void mem_diag_flow_end(void) {
+  uint32_t stack_peak = stack_used();
+
+  raise_stats(&device_stats, stack_peak, 0);
+  if (flow_app_id < REGISTRY_MAX_APPS) {
+    raise_stats(&app_stats[flow_app_id], stack_peak, flow_heap_peak);
+  }
+  flow_app_id = MEM_DIAG_NO_APP;
+}
+
+bool mem_diag_get_app_stats(uint32_t app_id, mem_diag_stats_t *stats) {
+  if (REGISTRY_MAX_APPS <= app_id || NULL == stats) {
+    return false;
+  }
+
+  *stats = app_stats[app_id];
+  return true;
+}
+
+void mem_diag_get_device_stats(mem_diag_stats_t *stats) {
+  if (NULL == stats) {
+    return;
+  }
+
+  raise_stats(&device_stats, stack_used(), 0);
+  *stats = device_stats;
+}
+
+void mem_diag_reset_app_stats(void) {
+  memset(app_stats, 0, sizeof(app_stats));
+}
+
+void mem_diag_log_report(void) {
+  mem_diag_stats_t stats = {0};
+
+  mem_diag_get_device_stats(&stats);
+  LOG_CRITICAL("mem: device stack %lu heap %lu",
+               (unsigned long)stats.stack_peak,
+               (unsigned long)stats.heap_peak);
+
+  for (uint32_t app_id = 0; app_id < REGISTRY_MAX_APPS; app_id++) {
+    stats = app_stats[app_id];
+    if (0 == stats.stack_peak && 0 == stats.heap_peak) {
+      continue;
+    }
+    LOG_CRITICAL("mem: app %lu stack %lu heap %lu",
+                 (unsigned long)app_id,
+                 (unsigned long)stats.stack_peak,
+                 (unsigned long)stats.heap_peak);
+  }
+}
@@ -0,0 +1,96 @@
+/**
+ * @file    mem_diag.h
+ * @author  Cypherock X1 Team
+ * @brief   Heap and stack high-water marks of the device and of each app.
+ * @copyright Copyright (c) 2023 HODL TECH PTE LTD
+ * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
+ * target=_blank>https://mitcc.org/</a>
+ */
+#ifndef MEM_DIAG_H
+#define MEM_DIAG_H
+
+/*****************************************************************************
+ * INCLUDES
+ *****************************************************************************/
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*****************************************************************************
+ * MACROS AND DEFINES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * TYPEDEFS
+ *****************************************************************************/
+
+/**
+ * @brief High-water marks in bytes
+ * @details stack_peak is the deepest stack reached, measured from the top of
+ * RAM. heap_peak is the largest amount of heap in use at once, as seen through
+ * malloc/calloc/realloc/free.
+ */
+typedef struct mem_diag_stats {
+  uint32_t stack_peak;
+  uint32_t heap_peak;
+} mem_diag_stats_t;
+
+/*****************************************************************************
+ * EXPORTED VARIABLES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * GLOBAL FUNCTION PROTOTYPES
+ *****************************************************************************/
+
+/**
+ * @brief Paints the free stack with the canary pattern
+ * @details Call once at boot, as early as possible. Until this is called the
+ * stack marks read as 0.
+ */
+void mem_diag_init(void);
+
+/**
+ * @brief Starts attributing the memory usage to the app
+ * @details Repaints the free stack and restarts the heap peak so that the marks
+ * measured by mem_diag_flow_end() belong to the flow of this app alone.
+ *
+ * @param app_id Id of the app from the app registry
+ */
+void mem_diag_flow_begin(uint32_t app_id);
+
+/**
+ * @brief Records the high-water marks of the flow started by
+ * mem_diag_flow_begin() against its app, keeping the maximum across flows
+ */
+void mem_diag_flow_end(void);
+
+/**
+ * @brief Returns the high-water marks recorded for the app since boot
+ *
+ * @param app_id Id of the app from the app registry
+ * @param stats Reference to the storage for the marks
+ *
+ * @return bool Indicating if the app id is valid
+ */
+bool mem_diag_get_app_stats(uint32_t app_id, mem_diag_stats_t *stats);
+
+/**
+ * @brief Returns the high-water marks of the whole device since boot
+ *
+ * @param stats Reference to the storage for the marks
+ */
+void mem_diag_get_device_stats(mem_diag_stats_t *stats);
+
+/**
+ * @brief Clears the marks of every app; the device marks are kept
+ */
+void mem_diag_reset_app_stats(void);
+
+/**
+ * @brief Writes the device marks and the marks of every app that has run to
+ * the device logs, so that they are exported with the next log fetch
+ */
+void mem_diag_log_report(void);
+
+#endif /* MEM_DIAG_H */
@@ -61,6 +61,7 @@
  *****************************************************************************/
 #include "p0_events.h"
 
+#include "events.h"
 #include "status_api.h"
 #include "systick_timer_priv.h"
 /*****************************************************************************
@@ -204,6 +205,7 @@ void p0_set_inactivity_evt(bool status) {
 
   if (true == status) {
     p0_set_p0_evt_flag(true);
+    events_signal_wakeup();
   }
 
   return;
@@ -214,6 +216,7 @@ void p0_set_abort_evt(bool status) {
 
   if (true == status) {
     p0_set_p0_evt_flag(true);
+    events_signal_wakeup();
   }
 
   return;
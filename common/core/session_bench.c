@@ -1,7 +1,7 @@
 /**
- * @file    fantom_app.c
+ * @file    session_bench.c
  * @author  Cypherock X1 Team
- * @brief   Fantom application configuration and helpers
+ * @brief   Phase timings of the app flows in the session benchmark build.
  * @copyright Copyright (c) 2023 HODL TECH PTE LTD
  * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
  *target=_blank>https://mitcc.org/</a>
@@ -60,26 +60,19 @@
  * INCLUDES
  *****************************************************************************/
 
-#include "fantom_app.h"
+#include "session_bench.h"
 
-#include <stddef.h>
+#ifdef SESSION_BENCH
+#include <stdbool.h>
+#include <stdio.h>
+#include <time.h>
 
-#include "evm_main.h"
+#include "logger.h"
 
 /*****************************************************************************
  * EXTERN VARIABLES
  *****************************************************************************/
 
-/**
- * @brief Whitelisted contracts with respective token symbol
- * @details A map of Ethereum contract addresses with their token symbols. These
- * will enable the device to verify the ERC20 token transaction in a
- * user-friendly manner.
- *
- * @see erc20_contracts_t
- */
-extern const erc20_contracts_t fantom_contracts[];
-
 /*****************************************************************************
  * PRIVATE MACROS AND DEFINES
  *****************************************************************************/
@@ -89,66 +82,96 @@ extern const erc20_contracts_t fantom_contracts[];
  *****************************************************************************/
 
 /*****************************************************************************
- * STATIC FUNCTION PROTOTYPES
+ * STATIC VARIABLES
  *****************************************************************************/
 
-/**
- * @brief Checks if the provided token address is whitelisted and return the
- * matching contract instance.
- *
- * @param address Reference to the buffer containing the token address
- * @param contract Pointer to store the matched contract address instance
- *
- * @return bool Indicating if the provided token address is whitelisted
- * @return true If the address matches to an entry in the whitelist
- * @return false If the address does not match to an entry in the whitelist
- */
-static bool is_token_whitelisted(const uint8_t *address,
-                                 const erc20_contracts_t **contract);
+static uint32_t flow_app_id = 0;
+static uint64_t flow_start_ns = 0;
+static uint64_t phase_start_ns = 0;
+static session_phase_e current_phase = SESSION_PHASE_OTHER;
+static uint64_t phase_ns[SESSION_PHASE_COUNT] = {0};
+static bool header_printed = false;
 
 /*****************************************************************************
- * STATIC VARIABLES
+ * GLOBAL VARIABLES
  *****************************************************************************/
 
-static const evm_config_t fantom_app_config = {
-    .lunit_name = "FTM",
-    .name = "Fantom Opera",
-    .chain_id = 250,
-
-    // whitelisted contracts
-    .is_token_whitelisted = is_token_whitelisted,
-};
-
-static const cy_app_desc_t fantom_app_desc = {.id = 12,
-                                              .version =
-                                                  {
-                                                      .major = 1,
-                                                      .minor = 0,
-                                                      .patch = 0,
-                                                  },
-                                              .app = evm_main,
-                                              .app_config = &fantom_app_config};
-
 /*****************************************************************************
- * GLOBAL VARIABLES
+ * STATIC FUNCTION PROTOTYPES
  *****************************************************************************/
 
+/**
+ * @brief Returns the monotonic time in nanoseconds
+ */
+static uint64_t now_ns(void);
+
 /*****************************************************************************
  * STATIC FUNCTIONS
  *****************************************************************************/
 
-static bool is_token_whitelisted(const uint8_t *address,
-                                 const erc20_contracts_t **contract) {
-  if (NULL != contract) {
-    *contract = NULL;
-  }
-  return false;
+static uint64_t now_ns(void) {
+  struct timespec now = {0};
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec;
 }
 
 /*****************************************************************************
  * GLOBAL FUNCTIONS
  *****************************************************************************/
 
-const cy_app_desc_t *get_fantom_app_desc() {
-  return &fantom_app_desc;
-}
\ No newline at end of file
+void session_bench_flow_begin(uint32_t app_id) {
+  for (int phase = 0; phase < SESSION_PHASE_COUNT; phase++) {
+    phase_ns[phase] = 0;
+  }
+  flow_app_id = app_id;
+  current_phase = SESSION_PHASE_OTHER;
+  flow_start_ns = now_ns();
+  phase_start_ns = flow_start_ns;
+}
+
+void session_bench_enter(session_phase_e phase) {
+  if (SESSION_PHASE_COUNT <= phase) {
+    return;
+  }
+
+  const uint64_t now = now_ns();
+  phase_ns[current_phase] += now - phase_start_ns;
+  phase_start_ns = now;
+  current_phase = phase;
+}
+
+void session_bench_flow_end(void) {
+  unsigned long us[SESSION_PHASE_COUNT] = {0};
+
+  session_bench_enter(SESSION_PHASE_OTHER);
+  for (int phase = 0; phase < SESSION_PHASE_COUNT; phase++) {
+    us[phase] = (unsigned long)(phase_ns[phase] / 1000);
+  }
+  const unsigned long total_us =
+      (unsigned long)((phase_start_ns - flow_start_ns) / 1000);
+
+  LOG_CRITICAL("session,%lu,%lu,%lu,%lu,%lu,%lu,%lu,%lu",
+               (unsigned long)flow_app_id,
+               total_us,
+               us[SESSION_PHASE_TRANSPORT],
+               us[SESSION_PHASE_PARSING],
+               us[SESSION_PHASE_DERIVATION],
+               us[SESSION_PHASE_HASHING],
+               us[SESSION_PHASE_SIGNING],
+               us[SESSION_PHASE_OTHER]);
+  if (!header_printed) {
+    printf(SESSION_BENCH_TABLE_HEADER "\n");
+    header_printed = true;
+  }
+  printf("session,%lu,%lu,%lu,%lu,%lu,%lu,%lu,%lu\n",
+         (unsigned long)flow_app_id,
+         total_us,
+         us[SESSION_PHASE_TRANSPORT],
+         us[SESSION_PHASE_PARSING],
+         us[SESSION_PHASE_DERIVATION],
+         us[SESSION_PHASE_HASHING],
+         us[SESSION_PHASE_SIGNING],
+         us[SESSION_PHASE_OTHER]);
+  fflush(stdout);
+}
+#endif /* SESSION_BENCH */
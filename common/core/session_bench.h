@@ -0,0 +1,93 @@
+/**
+ * @file    session_bench.h
+ * @author  Cypherock X1 Team
+ * @brief   Phase timings of the app flows in the session benchmark build.
+ * @copyright Copyright (c) 2023 HODL TECH PTE LTD
+ * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
+ * target=_blank>https://mitcc.org/</a>
+ */
+#ifndef SESSION_BENCH_H
+#define SESSION_BENCH_H
+
+/*****************************************************************************
+ * INCLUDES
+ *****************************************************************************/
+
+#include <stdint.h>
+
+/*****************************************************************************
+ * MACROS AND DEFINES
+ *****************************************************************************/
+
+/// Mnemonic of the seed the session benchmark build signs with, in place of
+/// the seed reconstructed from the cards
+#define SESSION_BENCH_MNEMONIC                                                 \
+  "abandon abandon abandon abandon abandon abandon abandon abandon abandon "   \
+  "abandon abandon about"
+
+/// Header line of the session reports, see session_bench_flow_end()
+#define SESSION_BENCH_TABLE_HEADER                                             \
+  "session,app_id,total_us,transport_us,parsing_us,derivation_us,hashing_us,"  \
+  "signing_us,other_us"
+
+#ifdef SESSION_BENCH
+#define SESSION_BENCH_ENTER(phase) session_bench_enter(phase)
+#else
+#define SESSION_BENCH_ENTER(phase)                                             \
+  do {                                                                         \
+  } while (0)
+#endif
+
+/*****************************************************************************
+ * TYPEDEFS
+ *****************************************************************************/
+
+/**
+ * @brief Phases the time of an app flow is split into
+ */
+typedef enum {
+  SESSION_PHASE_OTHER = 0,     ///< UI and anything not covered below
+  SESSION_PHASE_TRANSPORT,     ///< Waiting for the next query of the host
+  SESSION_PHASE_PARSING,       ///< Decoding and validating the queries
+  SESSION_PHASE_DERIVATION,    ///< Seed and key derivation
+  SESSION_PHASE_HASHING,       ///< Digests that get signed
+  SESSION_PHASE_SIGNING,       ///< Signature generation
+  SESSION_PHASE_COUNT,
+} session_phase_e;
+
+/*****************************************************************************
+ * EXPORTED VARIABLES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * GLOBAL FUNCTION PROTOTYPES
+ *****************************************************************************/
+
+#ifdef SESSION_BENCH
+/**
+ * @brief Starts timing the flow of the app, in SESSION_PHASE_OTHER
+ *
+ * @param app_id Id of the app from the app registry
+ */
+void session_bench_flow_begin(uint32_t app_id);
+
+/**
+ * @brief Switches the phase the time of the running flow is accounted to
+ * @details The time since the previous switch goes to the previous phase.
+ * Use through SESSION_BENCH_ENTER() so that other builds compile it out.
+ *
+ * @param phase Phase entered
+ */
+void session_bench_enter(session_phase_e phase);
+
+/**
+ * @brief Reports the phase timings of the flow started by
+ * session_bench_flow_begin()
+ * @details Writes one "session,<app_id>,<total_us>,<phase_us>..." line, in the
+ * column order of SESSION_BENCH_TABLE_HEADER, to the device logs and to
+ * stdout. The first report on stdout is preceded by the header line.
+ */
+void session_bench_flow_end(void);
+#endif /* SESSION_BENCH */
+
+#endif /* SESSION_BENCH_H */
@@ -61,6 +61,7 @@
  *****************************************************************************/
 #include "status_api.h"
 
+#include "flow_trace.h"
 #include "usb_api_priv.h"
 
 /*****************************************************************************
@@ -85,6 +86,17 @@
  *****************************************************************************/
 core_status_t core_status = CORE_STATUS_INIT_ZERO;
 
+static uint8_t progress_phase = CORE_PROGRESS_NONE;
+static uint16_t progress_done = 0;
+static uint16_t progress_total = 0;
+
+/// Published copies; the ISR reads one while the main loop fills the other
+static core_status_snapshot_t snapshots[2] = {
+    {.status = CORE_STATUS_INIT_ZERO},
+    {.status = CORE_STATUS_INIT_ZERO},
+};
+static uint8_t live_snapshot = 0;
+
 /*****************************************************************************
  * GLOBAL VARIABLES
  *****************************************************************************/
@@ -93,9 +105,26 @@ core_status_t core_status = CORE_STATUS_INIT_ZERO;
  * STATIC FUNCTION PROTOTYPES
  *****************************************************************************/
 
+/**
+ * @brief Publishes the current status for core_status_get_snapshot()
+ * @details Fills the copy not in use and then switches to it. The ISR always
+ * completes before the main loop resumes, hence it never sees a half-filled
+ * copy.
+ */
+static void core_status_publish(void);
+
 /*****************************************************************************
  * STATIC FUNCTIONS
  *****************************************************************************/
+static void core_status_publish(void) {
+  const uint8_t next = live_snapshot ^ 1;
+
+  snapshots[next].status = core_status;
+  snapshots[next].progress_phase = progress_phase;
+  snapshots[next].progress_done = progress_done;
+  snapshots[next].progress_total = progress_total;
+  __atomic_store_n(&live_snapshot, next, __ATOMIC_RELEASE);
+}
 
 /*****************************************************************************
  * GLOBAL FUNCTIONS
@@ -118,23 +147,35 @@ void core_status_set_idle_state(core_device_idle_state_t idle_state) {
   } else {
     core_status.abort_disabled = true;
   }
+
+  if (CORE_DEVICE_IDLE_STATE_IDLE == core_status.device_idle_state) {
+    progress_phase = CORE_PROGRESS_NONE;
+    progress_done = 0;
+    progress_total = 0;
+  }
+  core_status_publish();
   return;
 }
 
 void set_core_flow_status(uint32_t status) {
   core_status.flow_status &= ~(CORE_STATUS_MASK << CORE_STATUS_SHIFT);
   core_status.flow_status |= ((status & CORE_STATUS_MASK) << CORE_STATUS_SHIFT);
+  flow_trace_record(core_status.flow_status);
+  core_status_publish();
   return;
 }
 
 void set_app_flow_status(uint32_t status) {
   core_status.flow_status &= ~(APP_STATUS_MASK << APP_STATUS_SHIFT);
   core_status.flow_status |= ((status & APP_STATUS_MASK) << APP_STATUS_SHIFT);
+  flow_trace_record(core_status.flow_status);
+  core_status_publish();
   return;
 }
 
 void core_status_set_device_waiting_on(core_device_waiting_on_t waiting_on) {
   core_status.device_waiting_on = waiting_on;
+  core_status_publish();
   return;
 }
 
@@ -148,3 +189,16 @@ bool core_status_get_abort_disabled(void) {
 core_status_t get_core_status(void) {
   return core_status;
 }
+
+void core_status_set_progress(core_progress_phase_e phase,
+                              uint16_t done,
+                              uint16_t total) {
+  progress_phase = phase;
+  progress_done = done;
+  progress_total = total;
+  core_status_publish();
+}
+
+core_status_snapshot_t core_status_get_snapshot(void) {
+  return snapshots[__atomic_load_n(&live_snapshot, __ATOMIC_ACQUIRE)];
+}
@@ -27,6 +27,30 @@
  * TYPEDEFS
  *****************************************************************************/
 
+/**
+ * @brief Long operations reporting their progress to the host
+ * @details The unit of the progress depends on the phase.
+ */
+typedef enum {
+  CORE_PROGRESS_NONE = 0,
+  CORE_PROGRESS_SIGN_INPUTS,    ///< Transaction inputs signed
+  CORE_PROGRESS_POW_UNLOCK,     ///< Seconds of the unlock estimate elapsed
+  CORE_PROGRESS_RECONSTRUCT,    ///< Steps of the wallet reconstruction
+} core_progress_phase_e;
+
+/**
+ * @brief Status published by the flows for the status requests of the host
+ * @details The progress tells how far the long operation of the running flow
+ * is, eg. inputs signed so far out of the inputs of the transaction; phase
+ * CORE_PROGRESS_NONE, 0 of 0 when the flow does not report any.
+ */
+typedef struct core_status_snapshot {
+  core_status_t status;
+  uint8_t progress_phase;
+  uint16_t progress_done;
+  uint16_t progress_total;
+} core_status_snapshot_t;
+
 /*****************************************************************************
  * EXPORTED VARIABLES
  *****************************************************************************/
@@ -92,6 +116,30 @@ bool core_status_get_abort_disabled(void);
  */
 core_status_t get_core_status(void);
 
+/**
+ * @brief Sets the progress of the running flow reported to the host
+ * @details Lets the host adapt its polling rate and timeouts to long
+ * operations. The progress is cleared when the device goes back to idle.
+ *
+ * @param phase Operation in progress
+ * @param done Units completed so far
+ * @param total Units of the operation
+ */
+void core_status_set_progress(core_progress_phase_e phase,
+                              uint16_t done,
+                              uint16_t total);
+
+/**
+ * @brief Returns the status as last published by the flows
+ * @details Every setter of this module publishes the whole status at once,
+ * hence the snapshot is consistent even if read from the USB ISR while the
+ * main loop is in the middle of an update. This lets the ISR answer the
+ * status requests of the host while the main loop is blocked.
+ *
+ * @return core_status_snapshot_t Copy of the published status
+ */
+core_status_snapshot_t core_status_get_snapshot(void);
+
 /**
  * @brief Returns the current active app's applet-id
  *
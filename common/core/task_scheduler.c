@@ -0,0 +1,193 @@
+/**
+ * @file    task_scheduler.c
+ * @author  Cypherock X1 Team
+ * @brief   Cooperative scheduler for background tasks
+ * @copyright Copyright (c) 2023 HODL TECH PTE LTD
+ * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
+ *target=_blank>https://mitcc.org/</a>
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * (c) Copyright 2023 by HODL TECH PTE LTD
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * "Commons Clause" License Condition v1.0
+ *
+ * The Software is provided to you by the Licensor under the License,
+ * as defined below, subject to the following condition.
+ *
+ * Without limiting other conditions in the License, the grant of
+ * rights under the License will not include, and the License does not
+ * grant to you, the right to Sell the Software.
+ *
+ * For purposes of the foregoing, "Sell" means practicing any or all
+ * of the rights granted to you under the License to provide to third
+ * parties, for a fee or other consideration (including without
+ * limitation fees for hosting or consulting/ support services related
+ * to the Software), a product or service whose value derives, entirely
+ * or substantially, from the functionality of the Software. Any license
+ * notice or attribution required by the License must also include
+ * this Commons Clause License Condition notice.
+ *
+ * Software: All X1Wallet associated files.
+ * License: MIT
+ * Licensor: HODL TECH PTE LTD
+ *
+ ******************************************************************************
+ */
+
+/*****************************************************************************
+ * INCLUDES
+ *****************************************************************************/
+#include "task_scheduler.h"
+
+#include <stddef.h>
+
+#include "board.h"
+#include "trace_ring.h"
+
+/*****************************************************************************
+ * EXTERN VARIABLES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * PRIVATE MACROS AND DEFINES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * PRIVATE TYPEDEFS
+ *****************************************************************************/
+typedef struct {
+  sched_task_t task;
+  sched_prio_t prio;
+  uint32_t slice_ms;
+  bool pending;
+} sched_slot_t;
+
+/*****************************************************************************
+ * STATIC VARIABLES
+ *****************************************************************************/
+static sched_slot_t sched_slots[SCHED_MAX_TASKS] = {0};
+static uint8_t rr_index = 0;
+static volatile bool preempt_requested = false;
+
+/*****************************************************************************
+ * GLOBAL VARIABLES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * STATIC FUNCTION PROTOTYPES
+ *****************************************************************************/
+/**
+ * @brief Picks the highest priority slot with pending work, round-robin
+ * amongst slots of the same priority
+ *
+ * @return int8_t Index of the slot or -1 if all slots are idle
+ */
+static int8_t sched_pick_next(void);
+
+/*****************************************************************************
+ * STATIC FUNCTIONS
+ *****************************************************************************/
+static int8_t sched_pick_next(void) {
+  int8_t next = -1;
+  for (uint8_t i = 0; i < SCHED_MAX_TASKS; i++) {
+    const uint8_t index = (rr_index + i) % SCHED_MAX_TASKS;
+    const sched_slot_t *slot = &sched_slots[index];
+    if (NULL == slot->task || !slot->pending)
+      continue;
+    if (-1 == next || slot->prio < sched_slots[next].prio)
+      next = index;
+  }
+  return next;
+}
+
+/*****************************************************************************
+ * GLOBAL FUNCTIONS
+ *****************************************************************************/
+bool sched_add_task(sched_task_t task, sched_prio_t prio, uint32_t slice_ms) {
+  if (NULL == task || SCHED_PRIO_LEVELS <= prio || 0 == slice_ms)
+    return false;
+
+  sched_slot_t *free_slot = NULL;
+  for (uint8_t i = 0; i < SCHED_MAX_TASKS; i++) {
+    if (task == sched_slots[i].task)
+      return true;
+    if (NULL == free_slot && NULL == sched_slots[i].task)
+      free_slot = &sched_slots[i];
+  }
+  if (NULL == free_slot)
+    return false;
+
+  free_slot->task = task;
+  free_slot->prio = prio;
+  free_slot->slice_ms = slice_ms;
+  free_slot->pending = true;
+  return true;
+}
+
+void sched_remove_task(sched_task_t task) {
+  for (uint8_t i = 0; i < SCHED_MAX_TASKS; i++) {
+    if (task == sched_slots[i].task) {
+      sched_slots[i].task = NULL;
+      sched_slots[i].pending = false;
+    }
+  }
+}
+
+bool sched_run_until_idle(uint32_t budget_ms) {
+  const uint32_t start = uwTick;
+  preempt_requested = false;
+
+  for (uint8_t i = 0; i < SCHED_MAX_TASKS; i++) {
+    sched_slots[i].pending = (NULL != sched_slots[i].task);
+  }
+
+  int8_t next = sched_pick_next();
+  while (-1 != next) {
+    const uint32_t elapsed = uwTick - start;
+    if (preempt_requested || elapsed >= budget_ms)
+      return true;
+
+    sched_slot_t *slot = &sched_slots[next];
+    uint32_t slice_ms = budget_ms - elapsed;
+    if (slice_ms > slot->slice_ms)
+      slice_ms = slot->slice_ms;
+
+    // let the next task of the same priority go first on the next pick
+    rr_index = (next + 1) % SCHED_MAX_TASKS;
+    trace_event(TRACE_SCHED_DISPATCH, next);
+    const bool pending = slot->task(slice_ms);
+    trace_event(TRACE_SCHED_RETURN, pending);
+    // the task might have removed itself
+    if (NULL != slot->task)
+      slot->pending = pending;
+
+    next = sched_pick_next();
+  }
+  return false;
+}
+
+void sched_preempt(void) {
+  preempt_requested = true;
+}
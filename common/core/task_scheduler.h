@@ -0,0 +1,95 @@
+/**
+ * @file    task_scheduler.h
+ * @author  Cypherock X1 Team
+ * @brief   Cooperative scheduler for background tasks
+ * @copyright Copyright (c) 2023 HODL TECH PTE LTD
+ * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
+ * target=_blank>https://mitcc.org/</a>
+ */
+#ifndef TASK_SCHEDULER_H
+#define TASK_SCHEDULER_H
+
+/*****************************************************************************
+ * INCLUDES
+ *****************************************************************************/
+#include <stdbool.h>
+#include <stdint.h>
+
+/*****************************************************************************
+ * MACROS AND DEFINES
+ *****************************************************************************/
+#define SCHED_MAX_TASKS 8
+
+/*****************************************************************************
+ * TYPEDEFS
+ *****************************************************************************/
+/**
+ * @brief Priority of a background task. Lower value is served first; tasks of
+ * the same priority are served round-robin.
+ */
+typedef enum {
+  SCHED_PRIO_HIGH = 0,
+  SCHED_PRIO_MID,
+  SCHED_PRIO_LOW,
+  SCHED_PRIO_LEVELS,
+} sched_prio_t;
+
+/**
+ * @brief Background task body, run for one slice
+ *
+ * @param budget_ms Time in milliseconds the task may use in this slice. The
+ * task must return on its own once the budget is used up.
+ * @return true If the task has more work pending
+ * @return false If the task is idle till the next @ref sched_run_until_idle
+ */
+typedef bool (*sched_task_t)(uint32_t budget_ms);
+
+/*****************************************************************************
+ * EXPORTED VARIABLES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * GLOBAL FUNCTION PROTOTYPES
+ *****************************************************************************/
+/**
+ * @brief Registers a background task with the scheduler
+ *
+ * @param task Task body, see @ref sched_task_t
+ * @param prio Priority of the task
+ * @param slice_ms Maximum time in milliseconds given to the task per slice
+ * @return true If the task is registered (or was already registered)
+ * @return false If the parameters are invalid or all SCHED_MAX_TASKS slots are
+ * in use
+ */
+bool sched_add_task(sched_task_t task, sched_prio_t prio, uint32_t slice_ms);
+
+/**
+ * @brief Removes a registered task. Safe to call from within a running task.
+ *
+ * @param task Task body passed to @ref sched_add_task
+ */
+void sched_remove_task(sched_task_t task);
+
+/**
+ * @brief Runs the registered tasks until all of them are idle, the budget is
+ * used up or @ref sched_preempt is called
+ *
+ * @details Each iteration runs one slice of the highest priority task which has
+ * pending work. A slice is never given more than the remaining budget, hence
+ * the caller regains control within budget_ms (given tasks honour their
+ * budget). Every registered task is considered to have pending work at the
+ * start of a call.
+ *
+ * @param budget_ms Total time in milliseconds available for background work
+ * @return true If some task still has pending work
+ * @return false If all tasks are idle
+ */
+bool sched_run_until_idle(uint32_t budget_ms);
+
+/**
+ * @brief Requests the scheduler to return to its caller after the running
+ * slice. Safe to call from interrupt context.
+ */
+void sched_preempt(void);
+
+#endif /* TASK_SCHEDULER_H */
@@ -62,6 +62,36 @@
 
 #include "board.h"
 #include "logger.h"
+#include "trace_ring.h"
+
+/// Wait before retrying an operation the flash controller rejected
+#define FLASH_IF_RETRY_DELAY_MS 10
+
+/**
+ * @brief Checks if the flash at addr holds the data
+ *
+ * @param addr Flash address
+ * @param data Expected data, NULL to check if the region is erased
+ * @param len Length of the region in bytes
+ * @return true If the flash content matches
+ */
+static bool flash_if_holds(uint32_t addr, const uint32_t *data, uint32_t len) {
+#if USE_SIMULATOR == 0
+  const uint32_t *flash = (const uint32_t *)addr;
+  if (NULL != data) {
+    return 0 == memcmp(flash, data, len);
+  }
+  for (uint32_t i = 0; i < len / sizeof(uint32_t); i++) {
+    if (DEFAULT_UINT32_IN_FLASH != flash[i]) {
+      return false;
+    }
+  }
+  return true;
+#else
+  // Simulated flash is a file, there is no controller to reject an operation
+  return true;
+#endif
+}
 
 void read_cmd(const uint32_t addr, uint32_t *source_addr, const uint32_t len) {
   ASSERT(addr != 0);
@@ -76,7 +106,9 @@ void read_cmd(const uint32_t addr, uint32_t *source_addr, const uint32_t len) {
   BSP_NonVolatileRead(addr, source_addr, len);
 }
 
-void write_cmd(const uint32_t addr, const uint32_t *data, const uint32_t len) {
+BSP_Status_t write_cmd(const uint32_t addr,
+                       const uint32_t *data,
+                       const uint32_t len) {
   ASSERT(addr != 0);
   ASSERT(
       (addr >= FLASH_DATA_ADDRESS && addr <= FLASH_DATA_END_ADDRESS) ||
@@ -86,13 +118,22 @@ void write_cmd(const uint32_t addr, const uint32_t *data, const uint32_t len) {
   ASSERT(len != 0);
   ASSERT(data != NULL);
 
-  if (BSP_FlashSectorWrite((uint32_t *)addr, data, len) != BSP_OK) {
-    BSP_DelayMs(10);
+  trace_event(TRACE_FLASH_PROGRAM_BEGIN, addr);
+  // A reported failure may still have programmed the data; retry only if the
+  // flash does not hold it, as programmed cells cannot be programmed again
+  if (BSP_FlashSectorWrite((uint32_t *)addr, data, len) != BSP_OK &&
+      !flash_if_holds(addr, data, len)) {
+    BSP_DelayMs(FLASH_IF_RETRY_DELAY_MS);
     BSP_FlashSectorWrite((uint32_t *)addr, data, len);
   }
+
+  const BSP_Status_t status =
+      flash_if_holds(addr, data, len) ? BSP_OK : BSP_FLASH_CHECK_ERR;
+  trace_event(TRACE_FLASH_PROGRAM_END, status);
+  return status;
 }
 
-void erase_cmd(const uint32_t addr, const uint32_t erase_size) {
+BSP_Status_t erase_cmd(const uint32_t addr, const uint32_t erase_size) {
   uint16_t pages_cnt = erase_size / FLASH_PAGE_SIZE +
                        ((erase_size % FLASH_PAGE_SIZE == 0) ? 0 : 1);
 
@@ -104,8 +145,17 @@ void erase_cmd(const uint32_t addr, const uint32_t erase_size) {
       ((FLASH_END - (8 * FLASH_PAGE_SIZE) < addr) && (addr <= FLASH_END)));
   ASSERT(pages_cnt != 0);
 
-  if (BSP_FlashSectorErase(addr, pages_cnt) != BSP_OK) {
-    BSP_DelayMs(10);
+  trace_event(TRACE_FLASH_ERASE_BEGIN, addr);
+  if (BSP_FlashSectorErase(addr, pages_cnt) != BSP_OK &&
+      !flash_if_holds(addr, NULL, pages_cnt * FLASH_PAGE_SIZE)) {
+    BSP_DelayMs(FLASH_IF_RETRY_DELAY_MS);
     BSP_FlashSectorErase(addr, pages_cnt);
   }
+
+  const BSP_Status_t status =
+      flash_if_holds(addr, NULL, pages_cnt * FLASH_PAGE_SIZE)
+          ? BSP_OK
+          : BSP_FLASH_CHECK_ERR;
+  trace_event(TRACE_FLASH_ERASE_END, status);
+  return status;
 }
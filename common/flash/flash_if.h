@@ -31,15 +31,16 @@
  * @param [in] addr         Start address of the first page to erase
  * @param [in] pages_cnt    Number of pages to erase
  *
- * @return
- * @retval
+ * @return BSP_Status_t Status of the erase, verified on the flash content
+ * @retval BSP_OK If the pages read back erased
+ * @retval BSP_FLASH_CHECK_ERR If the pages are not erased even after a retry
  *
  * @see
  * @since v1.0.0
  *
  * @note
  */
-void erase_cmd(uint32_t addr, uint32_t pages_cnt);
+BSP_Status_t erase_cmd(uint32_t addr, uint32_t pages_cnt);
 
 /**
  * @brief Write specified pages on the persistent memory region
@@ -49,15 +50,16 @@ void erase_cmd(uint32_t addr, uint32_t pages_cnt);
  * @param [in] data     Data that is to be written
  * @param [in] len      Length of data to write
  *
- * @return
- * @retval
+ * @return BSP_Status_t Status of the write, verified on the flash content
+ * @retval BSP_OK If the flash reads back the data
+ * @retval BSP_FLASH_CHECK_ERR If the data is not programmed even after a retry
  *
  * @see
  * @since v1.0.0
  *
  * @note
  */
-void write_cmd(uint32_t addr, const uint32_t *data, uint32_t len);
+BSP_Status_t write_cmd(uint32_t addr, const uint32_t *data, uint32_t len);
 
 /**
  * @brief Read specified pages on the persistent memory region
@@ -58,8 +58,12 @@
  */
 #include "apdu.h"
 
+#include "aes_engine.h"
 #include "app_error.h"
 #include "assert_conf.h"
+#include "flash_config.h"
+#include "memzero.h"
+#include "options.h"
 #include "utils.h"
 
 /**
@@ -67,10 +71,38 @@
  * Wallet Share is Wallet_Share + Chacha Polly Mac + Nonce
  */
 static Card_Data_Health card_data_health = DATA_HEALTH_UNKNOWN;
-static uint8_t session_enc_key[32];
-static uint8_t session_mac_key[32];
 static uint8_t session_iv[16];
 
+/**
+ * Session keys prepared for the AES engine once in init_session_keys instead of
+ * on every APDU packet. Wiped by clear_session_keys.
+ */
+typedef struct {
+  aes_engine_key_t enc;
+  aes_engine_key_t mac;
+} session_key_pair_t;
+
+static CONFIDENTIAL session_key_pair_t session_keys;
+
+/**
+ * Keys of the paired cards prepared in earlier taps, indexed by keystore slot.
+ * A re-tapped card only copies its entry; the entry in use is dropped on any
+ * secure channel failure.
+ */
+static CONFIDENTIAL session_key_pair_t session_key_cache[MAX_KEYSTORE_ENTRY];
+static int8_t session_key_cache_slot = -1;
+
+/**
+ * @brief Drops the cache entry of the keys in use, if any
+ */
+static void invalidate_active_session_keys() {
+  if (0 <= session_key_cache_slot) {
+    aes_engine_clear_key(&session_key_cache[session_key_cache_slot].enc);
+    aes_engine_clear_key(&session_key_cache[session_key_cache_slot].mac);
+  }
+  session_key_cache_slot = -1;
+}
+
 /**
  * Fills array in this format :
  * [TAG][Length][Value] where,
@@ -612,11 +644,51 @@ ISO7816 extract_card_detail_from_apdu(const uint8_t apdu[],
 void init_session_keys(const uint8_t enc_key[32],
                        const uint8_t mac_key[32],
                        const uint8_t iv[16]) {
+  clear_session_keys();
   if (!enc_key || !mac_key)
     return;
 
-  memcpy(session_enc_key, enc_key, 32);
-  memcpy(session_mac_key, mac_key, 32);
+  if (!aes_engine_set_key(&session_keys.enc, enc_key) ||
+      !aes_engine_set_key(&session_keys.mac, mac_key)) {
+    clear_session_keys();
+  }
+}
+
+void init_cached_session_keys(uint8_t slot,
+                              const uint8_t enc_key[32],
+                              const uint8_t mac_key[32]) {
+  if (MAX_KEYSTORE_ENTRY <= slot) {
+    init_session_keys(enc_key, mac_key, NULL);
+    return;
+  }
+
+  session_key_pair_t *entry = &session_key_cache[slot];
+  if (!entry->enc.ready || !entry->mac.ready) {
+    if (!enc_key || !mac_key || !aes_engine_set_key(&entry->enc, enc_key) ||
+        !aes_engine_set_key(&entry->mac, mac_key)) {
+      aes_engine_clear_key(&entry->enc);
+      aes_engine_clear_key(&entry->mac);
+      clear_session_keys();
+      return;
+    }
+  }
+
+  memcpy(&session_keys, entry, sizeof(session_keys));
+  session_key_cache_slot = slot;
+}
+
+void clear_session_keys() {
+  aes_engine_clear_key(&session_keys.enc);
+  aes_engine_clear_key(&session_keys.mac);
+  session_key_cache_slot = -1;
+}
+
+void invalidate_session_key_cache() {
+  clear_session_keys();
+  for (uint8_t slot = 0; slot < MAX_KEYSTORE_ENTRY; slot++) {
+    aes_engine_clear_key(&session_key_cache[slot].enc);
+    aes_engine_clear_key(&session_key_cache[slot].mac);
+  }
 }
 
 int apdu_encrypt_data(uint8_t *InOut_data, uint16_t *data_len) {
@@ -626,33 +698,32 @@ int apdu_encrypt_data(uint8_t *InOut_data, uint16_t *data_len) {
   uint16_t len =
       *data_len + 1;    // plaintext data length + 1 required padding byte
   uint16_t padding_len = (16 - (len % 16)) % 16;
-  uint8_t payload[len + padding_len];
-  aes_encrypt_ctx ctx = {0};
+  uint8_t *payload = InOut_data + 16;
+  uint8_t mac[16] = {0};
 
-  if (aes_encrypt_key256(session_enc_key, &ctx) != EXIT_SUCCESS)
+  if (!session_keys.enc.ready)
     return NFC_SC_ENC_KEY_ERROR;
+  if (!session_keys.mac.ready)
+    return NFC_SC_MAC_KEY_ERROR;
 
-  memcpy(payload, InOut_data, len);
-
+  // The cipher text follows its MAC; it is produced in place after the shift
+  memmove(payload, InOut_data, *data_len);
   payload[len - 1] = 0x80;
   if (padding_len > 0)
     memset(payload + len, 0, padding_len);
-  if (aes_cbc_encrypt(
-          payload, InOut_data + 16, sizeof(payload), session_iv, &ctx) !=
-      EXIT_SUCCESS)
-    return NFC_SC_ENC_ERROR;
 
-  memset(&ctx, 0, sizeof(ctx));
-  memzero(session_iv, sizeof(session_iv));
-
-  if (aes_encrypt_key256(session_mac_key, &ctx) != EXIT_SUCCESS)
-    return NFC_SC_MAC_KEY_ERROR;
-  if (aes_cbc_encrypt(
-          InOut_data + 16, payload, sizeof(payload), session_iv, &ctx) !=
-      EXIT_SUCCESS)
-    return NFC_SC_MAC_ERROR;
-  memcpy(InOut_data, payload + sizeof(payload) - 16, 16);
-  memcpy(session_iv, payload + sizeof(payload) - 16, 16);
+  if (!aes_engine_cbc_encrypt_mac(&session_keys.enc,
+                                  &session_keys.mac,
+                                  payload,
+                                  payload,
+                                  len + padding_len,
+                                  session_iv,
+                                  mac)) {
+    invalidate_active_session_keys();
+    return NFC_SC_ENC_ERROR;
+  }
+  memcpy(InOut_data, mac, sizeof(mac));
+  memcpy(session_iv, mac, sizeof(mac));
 
   *data_len = len + padding_len + 16;
   return 0;
@@ -662,29 +733,38 @@ int apdu_decrypt_data(uint8_t *InOut_data, uint8_t *len) {
   ASSERT(InOut_data != NULL);
   ASSERT(len != NULL);
 
+  // MAC, at least one padded block & the status word
+  if (*len < 16 + 16 + 2)
+    return NFC_SC_MAC_ERROR;
+
   uint16_t data_len = *len - 16 - 2;
-  uint8_t payload[data_len], iv[16] = {0};
-  aes_decrypt_ctx dec_ctx = {0};
-  aes_encrypt_ctx enc_ctx = {0};
+  uint8_t *payload = InOut_data + 16;
+  uint8_t iv[16] = {0}, mac[16] = {0};
 
-  if (aes_encrypt_key256(session_mac_key, &enc_ctx) != EXIT_SUCCESS)
+  if (!session_keys.mac.ready)
     return NFC_SC_MAC_KEY_ERROR;
-  if (aes_cbc_encrypt(
-          InOut_data + 16, payload, sizeof(payload), iv, &enc_ctx) !=
-      EXIT_SUCCESS)
-    return NFC_SC_MAC_ERROR;
-  if (memcmp(payload + data_len - 16, InOut_data, 16) != 0)
-    return NFC_SC_MAC_MISMATCH;
-  if (aes_decrypt_key256(session_enc_key, &dec_ctx) != EXIT_SUCCESS)
+  if (!session_keys.enc.ready)
     return NFC_SC_DEC_KEY_ERROR;
 
   memcpy(iv, session_iv, sizeof(session_iv));
-  memcpy(session_iv, InOut_data, sizeof(session_iv));
-  memcpy(payload, InOut_data + 16, data_len);
-
-  if (aes_cbc_decrypt(payload, InOut_data, data_len, iv, &dec_ctx) !=
-      EXIT_SUCCESS)
+  if (!aes_engine_cbc_decrypt_mac(&session_keys.enc,
+                                  &session_keys.mac,
+                                  payload,
+                                  payload,
+                                  data_len,
+                                  iv,
+                                  mac)) {
+    invalidate_active_session_keys();
     return NFC_SC_DEC_ERROR;
+  }
+  if (memcmp(mac, InOut_data, 16) != 0) {
+    memzero(payload, data_len);
+    invalidate_active_session_keys();
+    return NFC_SC_MAC_MISMATCH;
+  }
+
+  memcpy(session_iv, InOut_data, sizeof(session_iv));
+  memmove(InOut_data, payload, data_len);
   while (InOut_data[data_len - 1] == 0x00)
     data_len--;
   if (InOut_data[data_len - 1] == 0x80)
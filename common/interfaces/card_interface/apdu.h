@@ -465,6 +465,35 @@ void init_session_keys(const uint8_t enc_key[32],
                        const uint8_t mac_key[32],
                        const uint8_t iv[16]);
 
+/**
+ * @brief Initializes the session keys of a paired card from the key cache
+ * @details The keys of each keystore slot are prepared for the AES engine on
+ * the first tap of the card and copied on later taps. The entry in use is
+ * dropped when an APDU fails to encrypt, decrypt or verify, and every entry
+ * is dropped by @ref invalidate_session_key_cache.
+ *
+ * @param slot Keystore index of the card, caching is skipped if out of range
+ * @param enc_key Encryption key of the pairing
+ * @param mac_key MAC key of the pairing
+ */
+void init_cached_session_keys(uint8_t slot,
+                              const uint8_t enc_key[32],
+                              const uint8_t mac_key[32]);
+
+/**
+ * @brief Wipes the session keys and every cached pairing key
+ * @details Must be called whenever a keystore entry is changed or dropped.
+ */
+void invalidate_session_key_cache();
+
+/**
+ * @brief Wipes the session keys prepared for the AES engine
+ * @details The keys are prepared once by @ref init_session_keys and reused for
+ * every packet of the secure channel. They must be cleared when the card
+ * session ends; secure APDUs fail until the keys are initialized again.
+ */
+void clear_session_keys();
+
 /**
  * @brief
  * @details
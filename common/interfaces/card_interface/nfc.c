@@ -56,24 +56,31 @@
  *
  ******************************************************************************
  */
-#include "nfc.h"
+/// Log level of the module, set before logger.h is included
+#define LOG_MODULE_LEVEL LOG_NFC_LEVEL
 
-#include <math.h>
+#include "nfc.h"
 
 #include "app_error.h"
 #include "application_startup.h"
 #include "assert_conf.h"
+#include "chunk_utils.h"
 #include "sys_state.h"
+#include "trace_ring.h"
 #include "utils.h"
 #include "wallet_utilities.h"
 
 #define SEND_PACKET_MAX_LEN 236
 #define RECV_PACKET_MAX_ENC_LEN 242
 #define RECV_PACKET_MAX_LEN 225
+/// Largest Lc of a short C-APDU, bounds a negotiated frame
+#define SEND_PACKET_LIMIT 255
 
 static void (*early_exit_handler)() = NULL;
 static uint8_t nfc_device_key_id[4];
 static bool nfc_secure_comm = true;
+static uint8_t nfc_send_packet_len = SEND_PACKET_MAX_LEN;
+static bool nfc_tap_session = false;
 static uint8_t request_chain_pkt[] = {0x00, 0xCF, 0x00, 0x00};
 
 /**
@@ -96,6 +103,7 @@ uint32_t nfc_diagnose_antenna_hw() {
   uint32_t result = 0;
   uint32_t err;
 
+  nfc_init();
   LOG_ERROR("NFC hw error logging");
 
   // Poll and log different thresholds for NFC antenna self test
@@ -118,10 +126,12 @@ uint32_t nfc_diagnose_antenna_hw() {
 }
 
 uint32_t nfc_diagnose_card_presence() {
+  nfc_init();
   return adafruit_diagnose_card_presence();
 }
 
 void nfc_detect_card_removal() {
+  nfc_init();
 #if DEV_BUILD == 0
   uint32_t err = 0;
   uint8_t err_count = 0;
@@ -144,6 +154,7 @@ ret_code_t nfc_select_card() {
   ret_code_t err_code = STM_ERROR_NULL;    // random error. added to remove
                                            // warning
   nfc_a_tag_info tag_info;
+  nfc_init();
   sys_flow_cntrl_u.bits.nfc_off = false;
   uint32_t system_clock = uwTick;
   while (err_code != STM_SUCCESS && !CY_Read_Reset_Flow()) {
@@ -164,6 +175,9 @@ ret_code_t nfc_select_card() {
 }
 
 void nfc_deselect_card() {
+  nfc_session_end();
+  clear_session_keys();
+  nfc_send_packet_len = SEND_PACKET_MAX_LEN;
   sys_flow_cntrl_u.bits.nfc_off = true;
   adafruit_pn532_release();
   adafruit_pn532_field_off();
@@ -172,6 +186,7 @@ void nfc_deselect_card() {
 
 ret_code_t nfc_wait_for_card(const uint16_t wait_time) {
   nfc_a_tag_info tag_info;
+  nfc_init();
   sys_flow_cntrl_u.bits.nfc_off = false;
   return adafruit_pn532_nfc_a_target_init(&tag_info, wait_time);
 }
@@ -623,18 +638,24 @@ ISO7816 nfc_decrypt_data(const uint8_t name[NAME_SIZE],
   return status_word;
 }
 
-ret_code_t nfc_exchange_apdu(uint8_t *send_apdu,
-                             uint16_t send_len,
-                             uint8_t *recv_apdu,
-                             uint16_t *recv_len) {
+/**
+ * @brief Exchanges the APDU frame by frame, see nfc_exchange_apdu()
+ */
+static ret_code_t nfc_exchange_frames(uint8_t *send_apdu,
+                                      uint16_t send_len,
+                                      uint8_t *recv_apdu,
+                                      uint16_t *recv_len) {
   ASSERT(send_apdu != NULL);
   ASSERT(recv_apdu != NULL);
   ASSERT(recv_len != NULL);
   ASSERT(send_len != 0);
 
-  ret_code_t err_code = adafruit_diagnose_card_presence();
-  if (err_code != 0)
-    return NFC_CARD_ABSENT;
+  ret_code_t err_code = STM_SUCCESS;
+  if (!nfc_tap_session) {
+    err_code = adafruit_diagnose_card_presence();
+    if (err_code != 0)
+      return NFC_CARD_ABSENT;
+  }
 
   uint8_t total_packets = 0, header[5], status[2] = {0};
   uint8_t recv_pkt_len = 236, send_pkt_len;
@@ -654,7 +675,9 @@ ret_code_t nfc_exchange_apdu(uint8_t *send_apdu,
     send_apdu[OFFSET_LC] += sizeof(nfc_device_key_id);
   }
 
-  total_packets = ceil(send_len / (1.0 * SEND_PACKET_MAX_LEN));
+  chunk_info_t framing;
+  chunk_info_init(&framing, send_len, nfc_send_packet_len);
+  total_packets = framing.total_chunks;
   for (int packet = 1; packet <= total_packets;) {
     recv_pkt_len = RECV_PACKET_MAX_ENC_LEN; /* On every request set acceptable
                                                packet length */
@@ -676,9 +699,9 @@ ret_code_t nfc_exchange_apdu(uint8_t *send_apdu,
       memcpy(send_apdu + off - OFFSET_CDATA + 1, header + 1, OFFSET_CDATA - 1);
 
     /** Fix on length of data to be sent in the current packet. @see
-     * SEND_PACKET_MAX_LEN puts an upper limit */
-    if ((send_len - off) > SEND_PACKET_MAX_LEN)
-      send_pkt_len = SEND_PACKET_MAX_LEN;
+     * nfc_send_packet_len puts an upper limit */
+    if ((send_len - off) > nfc_send_packet_len)
+      send_pkt_len = nfc_send_packet_len;
     else
       send_pkt_len = send_len - off;
     send_apdu[off - 1] = send_pkt_len;
@@ -692,13 +715,14 @@ ret_code_t nfc_exchange_apdu(uint8_t *send_apdu,
     /** Verify card's response. */
     if (err_code != STM_SUCCESS) {
       LOG_ERROR("err:%08X\n", err_code);
+      nfc_session_end();
       return err_code;
     }
     if (recv_pkt_len < 2)
       return STM_ERROR_INVALID_LENGTH;
     if (packet == total_packets)
       break;
-    off += SEND_PACKET_MAX_LEN;
+    off += nfc_send_packet_len;
 
     /**
      * Check if card properly handled the current packet and has sufficient
@@ -721,7 +745,7 @@ ret_code_t nfc_exchange_apdu(uint8_t *send_apdu,
   /** Prepare to request next packet from the card */
   *recv_len = recv_pkt_len;
   recv_pkt_len = RECV_PACKET_MAX_ENC_LEN;
-  request_chain_pkt[2] = ceil(*recv_len * 1.0 / RECV_PACKET_MAX_LEN);
+  request_chain_pkt[2] = CY_CEIL_DIV(*recv_len, RECV_PACKET_MAX_LEN);
 
   /** Request all the remaining packets of multi-packet response */
   while (recv_apdu[*recv_len - 2] == 0x61) {
@@ -734,6 +758,7 @@ ret_code_t nfc_exchange_apdu(uint8_t *send_apdu,
     /** Verify card's response */
     if (err_code != STM_SUCCESS) {
       LOG_ERROR("err:%08X\n", err_code);
+      nfc_session_end();
       return err_code;
     }
     if (recv_pkt_len < 2)
@@ -754,11 +779,35 @@ ret_code_t nfc_exchange_apdu(uint8_t *send_apdu,
     request_chain_pkt[2] = *recv_len / RECV_PACKET_MAX_LEN + 1;
   }
 
-  adafruit_pn532_clear_buffers();
+  if (!nfc_tap_session) {
+    adafruit_pn532_clear_buffers();
+  }
   *recv_len = extract_card_data_health(recv_apdu, *recv_len);
   return err_code;
 }
 
+ret_code_t nfc_exchange_apdu(uint8_t *send_apdu,
+                             uint16_t send_len,
+                             uint8_t *recv_apdu,
+                             uint16_t *recv_len) {
+  trace_event(TRACE_NFC_EXCHANGE_BEGIN, send_len);
+  const ret_code_t err_code =
+      nfc_exchange_frames(send_apdu, send_len, recv_apdu, recv_len);
+  trace_event(TRACE_NFC_EXCHANGE_END, err_code);
+  return err_code;
+}
+
+void nfc_session_begin() {
+  nfc_tap_session = true;
+}
+
+void nfc_session_end() {
+  if (nfc_tap_session) {
+    adafruit_pn532_clear_buffers();
+  }
+  nfc_tap_session = false;
+}
+
 void nfc_set_early_exit_handler(void (*handler)()) {
   early_exit_handler = handler;
 }
@@ -767,6 +816,16 @@ void nfc_set_device_key_id(const uint8_t *device_key_id) {
   memcpy(nfc_device_key_id, device_key_id, 4);
 }
 
+void nfc_set_max_packet_len(uint8_t len) {
+  if (0 == len) {
+    len = SEND_PACKET_MAX_LEN;
+  }
+  if (len > SEND_PACKET_LIMIT - OFFSET_CDATA) {
+    len = SEND_PACKET_LIMIT - OFFSET_CDATA;
+  }
+  nfc_send_packet_len = len;
+}
+
 void nfc_set_secure_comm(bool state) {
   nfc_secure_comm = state;
 }
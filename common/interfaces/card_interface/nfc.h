@@ -59,7 +59,9 @@
 
 /**
  * @brief Initialize PN532 module
- * @details
+ * @details The boot defers the bring-up to its first idle time; the entry
+ * points that talk to the PN532 call this first, which returns at once when
+ * the module is already up.
  *
  * @param
  *
@@ -419,6 +421,21 @@ ret_code_t nfc_exchange_apdu(uint8_t send_apdu[],
                              uint8_t recv_apdu[],
                              uint16_t *recv_len);
 
+/**
+ * @brief Starts a tap session on the currently selected card
+ * @details While the session is active, nfc_exchange_apdu() skips the card
+ * presence check before each exchange and defers clearing the PN532 buffers
+ * to nfc_session_end(). A transceive error ends the session so that the next
+ * exchange probes the card again.
+ */
+void nfc_session_begin();
+
+/**
+ * @brief Ends the tap session and clears the PN532 buffers
+ * @details Called by nfc_deselect_card(); safe to call without a session.
+ */
+void nfc_session_end();
+
 /**
  * @brief Set the abort callback function.
  * Aborts the ongoing flow and resets the Flow_level.
@@ -452,6 +469,17 @@ void nfc_set_early_exit_handler(void (*handler)());
  */
 void nfc_set_device_key_id(const uint8_t *device_key_id);
 
+/**
+ * @brief Sets the data length of each C-APDU frame for the selected card
+ * @details Cards which accept frames larger than the default can be sent a
+ * command in fewer exchanges. The length is clamped to the short APDU limit
+ * and reverts to the default on nfc_deselect_card().
+ *
+ * @param [in] len Number of data bytes the card accepts in one frame, 0 for
+ * the default
+ */
+void nfc_set_max_packet_len(uint8_t len);
+
 /**
  * @brief Used to set or reset `nfc_secure_comm` variable
  * @details
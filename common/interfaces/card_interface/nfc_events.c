@@ -57,6 +57,9 @@
  ******************************************************************************
  */
 
+/// Log level of the module, set before logger.h is included
+#define LOG_MODULE_LEVEL LOG_NFC_LEVEL
+
 /*****************************************************************************
  * INCLUDES
  *****************************************************************************/
@@ -66,6 +69,8 @@
 #include "memzero.h"
 #include "nfc_events_priv.h"
 #include "string.h"
+#include "sys_state.h"
+#include "utils.h"
 /*****************************************************************************
  * EXTERN VARIABLES
  *****************************************************************************/
@@ -93,6 +98,8 @@ typedef enum {
 static nfc_task_states_t nfc_state;
 static nfc_event_t nfc_event;
 static uint8_t card_removal_retry_counter = 0;
+static uint32_t card_removal_poll_interval = NFC_REMOVAL_POLL_MIN_MS;
+static uint32_t card_removal_poll_tick = 0;
 
 /*****************************************************************************
  * GLOBAL VARIABLES
@@ -104,6 +111,9 @@ static uint8_t card_removal_retry_counter = 0;
 
 /**
  * @brief   Checks if card has been removed and returns status
+ * @details The interval till the next probe is doubled (up to
+ * NFC_REMOVAL_POLL_MAX_MS) every time the card is found, and falls back to
+ * NFC_REMOVAL_POLL_MIN_MS on a miss so that a removal is confirmed quickly.
  * @arg     retry_count:  No. of consecutive retries for card not detected
  *
  * @return  true if card is not detected for consecutive retries exceeding
@@ -126,8 +136,11 @@ static bool check_card_removed_status(uint8_t retry_count) {
   uint32_t err = adafruit_diagnose_card_presence();
   if (err != PN532_DIAGNOSE_CARD_DETECTED_RESP) {
     card_removal_retry_counter++;
+    card_removal_poll_interval = NFC_REMOVAL_POLL_MIN_MS;
   } else {
     card_removal_retry_counter = 0;
+    card_removal_poll_interval =
+        CY_MIN(card_removal_poll_interval * 2, NFC_REMOVAL_POLL_MAX_MS);
   }
 
   if (card_removal_retry_counter > retry_count) {
@@ -140,6 +153,7 @@ static void nfc_handle_card_select_resp(void) {
   nfc_a_tag_info nfc_tag_info;
   uint32_t card_select_status = pn532_read_nfca_target_init_resp(&nfc_tag_info);
   if (card_select_status == STM_SUCCESS) {
+    sys_flow_cntrl_u.bits.nfc_off = false;
     nfc_set_card_detect_event();
   } else if (card_select_status != NFC_RESP_NOT_READY) {
     nfc_state = NFC_STATE_SET_SELECT_CARD_CMD;
@@ -177,6 +191,7 @@ void nfc_set_card_removed_event(void) {
 }
 
 void nfc_en_select_card_task(void) {
+  nfc_init();
   nfc_state = NFC_STATE_SET_SELECT_CARD_CMD;
 
   // Deselect card before selection, to avoid unexpected issues.
@@ -190,6 +205,8 @@ uint32_t nfc_en_wait_for_card_removal_task(void) {
   if (card_presence_state == PN532_DIAGNOSE_CARD_DETECTED_RESP) {
     nfc_state = NFC_STATE_WAIT_FOR_CARD_REMOVAL;
     card_removal_retry_counter = 0;
+    card_removal_poll_interval = NFC_REMOVAL_POLL_MIN_MS;
+    card_removal_poll_tick = uwTick;
   }
   return card_presence_state;
 }
@@ -211,6 +228,10 @@ void nfc_task_handler(void) {
     } break;
 
     case NFC_STATE_WAIT_FOR_CARD_REMOVAL: {
+      if ((uwTick - card_removal_poll_tick) < card_removal_poll_interval) {
+        break;
+      }
+      card_removal_poll_tick = uwTick;
       if (check_card_removed_status(DEFAULT_CARD_REMOVAL_RETRY_COUNT)) {
         nfc_set_card_removed_event();
       }
@@ -227,7 +248,11 @@ void nfc_task_handler(void) {
 }
 
 void nfc_ctx_destroy(void) {
-  nfc_deselect_card();
+  // A card activated by the select task is kept selected, so the caller can
+  // start exchanging APDUs without a blocking re-selection
+  if (NFC_STATE_CARD_DETECTED != nfc_state) {
+    nfc_deselect_card();
+  }
   nfc_state = NFC_STATE_OFF;
   card_removal_retry_counter = 0;
 }
\ No newline at end of file
@@ -82,6 +82,8 @@ void nfc_task_handler(void);
 
 /**
  * @brief   Resets local variables, states and PN532 state
+ * @details A card detected by the select task is left activated in the PN532
+ * so that APDUs can be exchanged right away; otherwise the card is deselected.
  */
 void nfc_ctx_destroy(void);
 #endif
@@ -19,6 +19,15 @@
 /*****************************************************************************
  * MACROS AND DEFINES
  *****************************************************************************/
+#ifndef NFC_REMOVAL_POLL_MIN_MS
+/// Interval between card presence probes when the card may be leaving
+#define NFC_REMOVAL_POLL_MIN_MS 10
+#endif
+
+#ifndef NFC_REMOVAL_POLL_MAX_MS
+/// Upper bound of the back-off while the card stays in the field
+#define NFC_REMOVAL_POLL_MAX_MS 160
+#endif
 
 /*****************************************************************************
  * TYPEDEFS
@@ -3,7 +3,7 @@
  * @author  Cypherock X1 Team
  * @brief   USB communication interface.
  *          Handles all USB communication operations for the application from
- *the ISR context.
+ *the main loop context.
  * @copyright Copyright (c) 2022-2023 HODL TECH PTE LTD
  * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
  *target=_blank>https://mitcc.org/</a>
@@ -108,8 +108,8 @@ typedef struct comm_raw_payload {
  * GLOBAL VARIABLES
  *****************************************************************************/
 
-uint8_t comm_io_buffer[COMM_BUFFER_SIZE] = {0};
-comm_payload_t comm_payload;
+uint8_t comm_io_buffer[COMM_IO_BUFFER_SLOTS][COMM_BUFFER_SIZE] = {0};
+comm_payload_t comm_payload[COMM_IO_BUFFER_SLOTS];
 
 /*****************************************************************************
  * STATIC FUNCTION PROTOTYPES
@@ -136,17 +136,25 @@ void usb_init() {
 }
 
 uint8_t *get_io_buffer() {
-  return comm_io_buffer;
+  return get_io_buffer_slot(get_comm_status()->live_slot);
+}
+
+uint8_t *get_io_buffer_slot(uint8_t slot) {
+  ASSERT(slot < COMM_IO_BUFFER_SLOTS);
+  return comm_io_buffer[slot];
 }
 
 comm_payload_t *get_comm_payload() {
-  return &comm_payload;
+  return get_comm_payload_slot(get_comm_status()->live_slot);
+}
+
+comm_payload_t *get_comm_payload_slot(uint8_t slot) {
+  ASSERT(slot < COMM_IO_BUFFER_SLOTS);
+  return &comm_payload[slot];
 }
 
 void mark_device_state(cy_app_status_t state, uint8_t flow_status) {
   comm_status_t *comm_status = get_comm_status();
-  uint8_t usb_irq_enable = NVIC_GetEnableIRQ(OTG_FS_IRQn);
-  NVIC_DisableIRQ(OTG_FS_IRQn);
   if (state != CY_UNUSED_STATE) {
     comm_status->app_busy_status = state;
 
@@ -163,8 +171,6 @@ void mark_device_state(cy_app_status_t state, uint8_t flow_status) {
   if (flow_status != 0xFF)
     comm_status->curr_flow_status = flow_status;
   comm_status->abort_disabled = CY_reset_not_allowed();
-  if (usb_irq_enable == true)
-    NVIC_EnableIRQ(OTG_FS_IRQn);
 }
 
 bool is_device_ready() {
@@ -174,9 +180,7 @@ bool is_device_ready() {
 void comm_reject_request(En_command_type_t command_type, uint8_t byte) {
   comm_status_t *comm_status = get_comm_status();
   uint8_t arr[1] = {byte};
-  uint8_t usb_irq_enable = NVIC_GetEnableIRQ(OTG_FS_IRQn);
 
-  NVIC_DisableIRQ(OTG_FS_IRQn);
   // Make sure to set he curr_cmd_state to CMD_STATE_FAILED
   transmit_data_to_app(command_type, arr, 1);
   // Imp: Should be updated after writing to buffer
@@ -185,8 +189,6 @@ void comm_reject_request(En_command_type_t command_type, uint8_t byte) {
   // App state is set to idle here, so new command is allowed from any
   // interfaces
   comm_reset_interface();
-  if (usb_irq_enable == true)
-    NVIC_EnableIRQ(OTG_FS_IRQn);
 }
 
 void usb_send_byte(const uint32_t command_type, const uint8_t byte) {
@@ -200,15 +202,19 @@ void usb_send_data(const uint32_t command_type,
   return;
 }
 
-void usb_send_msg(const uint8_t *core_msg,
-                  uint32_t core_msg_size,
-                  const uint8_t *app_msg,
-                  uint32_t app_msg_size) {
-  uint8_t usb_irq_enable = NVIC_GetEnableIRQ(OTG_FS_IRQn);
+uint8_t *usb_get_msg_buffer(uint32_t *capacity) {
+  if (NULL != capacity) {
+    *capacity = COMM_BUFFER_SIZE - COMM_SZ_RESERVED_SPACE;
+  }
+  return get_io_buffer() + COMM_SZ_RESERVED_SPACE;
+}
+
+void usb_send_msg_in_place(uint32_t core_msg_size, uint32_t app_msg_size) {
+  uint8_t *io_buffer = get_io_buffer();
 
-  NVIC_DisableIRQ(OTG_FS_IRQn);
   usb_clear_event();
   get_comm_status()->curr_cmd_state = CMD_STATE_DONE;
+  comm_stats_track_state();
 
   // catch the buffer overflow situation
   ASSERT((COMM_SZ_RESERVED_SPACE + core_msg_size + app_msg_size) <=
@@ -218,27 +224,36 @@ void usb_send_msg(const uint8_t *core_msg,
   // write stream lengths into payload buffer as follows
   // core_msg_len (2-bytes) : app_msg_len (2-bytes) : core_msg : app_msg
   // write core msg length into payload buffer
-  comm_io_buffer[0] = (core_msg_size >> 8) & 0xFF;
-  comm_io_buffer[1] = core_msg_size & 0xFF;
+  io_buffer[0] = (core_msg_size >> 8) & 0xFF;
+  io_buffer[1] = core_msg_size & 0xFF;
   // write app msg length into payload buffer
-  comm_io_buffer[2] = (app_msg_size >> 8) & 0xFF;
-  comm_io_buffer[3] = app_msg_size & 0xFF;
+  io_buffer[2] = (app_msg_size >> 8) & 0xFF;
+  io_buffer[3] = app_msg_size & 0xFF;
+}
+
+void usb_send_msg(const uint8_t *core_msg,
+                  uint32_t core_msg_size,
+                  const uint8_t *app_msg,
+                  uint32_t app_msg_size) {
+  uint8_t *io_buffer = get_io_buffer();
+
+  // catch the buffer overflow situation
+  ASSERT((COMM_SZ_RESERVED_SPACE + core_msg_size + app_msg_size) <=
+         COMM_BUFFER_SIZE);
 
   if (0 < core_msg_size && NULL != core_msg) {
     // copy core message into payload buffer after COMM_SZ_RESERVED_SPACE
-    memcpy(comm_io_buffer + COMM_SZ_RESERVED_SPACE, core_msg, core_msg_size);
+    memcpy(io_buffer + COMM_SZ_RESERVED_SPACE, core_msg, core_msg_size);
   }
 
   if (0 < app_msg_size && NULL != app_msg) {
     // copy app message into payload buffer after core-msg
     // COMM_SZ_RESERVED_SPACE + core_msg_len
-    memcpy(comm_io_buffer + COMM_SZ_RESERVED_SPACE + core_msg_size,
+    memcpy(io_buffer + COMM_SZ_RESERVED_SPACE + core_msg_size,
            app_msg,
            app_msg_size);
   }
-
-  if (usb_irq_enable == true)
-    NVIC_EnableIRQ(OTG_FS_IRQn);
+  usb_send_msg_in_place(core_msg_size, app_msg_size);
 }
 
 void usb_free_msg_buffer() {
@@ -249,10 +264,64 @@ void usb_free_msg_buffer() {
 
 void usb_set_state_executing() {
   get_comm_status()->curr_cmd_state = CMD_STATE_EXECUTING;
+  comm_stats_track_state();
 }
 
 void usb_reset_state() {
   get_comm_status()->curr_cmd_state = CMD_STATE_NONE;
+  get_comm_status()->stream_active = false;
+}
+
+void usb_stream_set_accepted(bool accept) {
+  get_comm_status()->stream_accepted = accept;
+}
+
+uint32_t usb_stream_get_remaining(void) {
+  const comm_status_t *comm_status = get_comm_status();
+  if (!comm_status->stream_active)
+    return 0;
+  return comm_status->stream_total_length -
+         comm_status->stream_received_length;
+}
+
+usb_stream_status_t usb_stream_pull(const uint8_t **segment, uint16_t *size) {
+  ASSERT(NULL != segment && NULL != size);
+  usb_process_rx_packets();
+  comm_status_t *comm_status = get_comm_status();
+  usb_stream_status_t result = USB_STREAM_END;
+
+  if (comm_status->stream_active) {
+    switch (comm_status->stream_segment_state) {
+      case COMM_STREAM_SEGMENT_HELD:
+        if (comm_status->stream_received_length ==
+            comm_status->stream_total_length) {
+          comm_status->stream_active = false;
+          break;
+        }
+        // release the segment to the host for next upload
+        comm_status->stream_segment_length = 0;
+        comm_status->stream_segment_state = COMM_STREAM_SEGMENT_FILLING;
+        sys_flow_cntrl_u.bits.usb_buffer_free = true;
+        result = USB_STREAM_PENDING;
+        break;
+
+      case COMM_STREAM_SEGMENT_FILLING:
+        result = USB_STREAM_PENDING;
+        break;
+
+      case COMM_STREAM_SEGMENT_READY:
+        comm_status->stream_segment_state = COMM_STREAM_SEGMENT_HELD;
+        *segment = get_io_buffer();
+        *size = comm_status->stream_segment_length;
+        result = USB_STREAM_SEGMENT;
+        break;
+
+      default:
+        result = USB_STREAM_ERROR;
+        break;
+    }
+  }
+  return result;
 }
 
 bool usb_get_msg(En_command_type_t *command_type,
@@ -262,13 +331,14 @@ bool usb_get_msg(En_command_type_t *command_type,
       (msg_len != NULL && msg_data == NULL))
     return false;
   if (is_there_any_msg_from_app()) {
+    const comm_payload_t *payload = get_comm_payload();
     // TODO: Handle hybrid (raw and protobuf together) messages here
     if (command_type)
-      *command_type = U32_READ_BE_ARRAY(comm_payload.raw_data);
+      *command_type = U32_READ_BE_ARRAY(payload->raw_data);
     if (msg_data)
-      *msg_data = comm_payload.raw_data + sizeof(uint32_t);
+      *msg_data = payload->raw_data + sizeof(uint32_t);
     if (msg_len)
-      *msg_len = comm_payload.raw_data_length - sizeof(uint32_t);
+      *msg_len = payload->raw_data_length - sizeof(uint32_t);
     return true;
   }
   return false;
@@ -280,24 +350,38 @@ bool get_usb_msg_by_cmd_type(En_command_type_t command_type,
   if ((msg_len == NULL && msg_data != NULL) ||
       (msg_len != NULL && msg_data == NULL))
     return false;
+  usb_process_rx_packets();
+  const comm_payload_t *payload = get_comm_payload();
   if (is_there_any_msg_from_app() &&
-      U32_READ_BE_ARRAY(comm_payload.raw_data) == command_type) {
+      U32_READ_BE_ARRAY(payload->raw_data) == command_type) {
     // TODO: Handle hybrid (raw and protobuf together) messages here
     if (msg_data)
-      *msg_data = comm_payload.raw_data + sizeof(uint32_t);
+      *msg_data = payload->raw_data + sizeof(uint32_t);
     if (msg_len)
-      *msg_len = comm_payload.raw_data_length - sizeof(uint32_t);
+      *msg_len = payload->raw_data_length - sizeof(uint32_t);
     return true;
   }
   return false;
 }
 
 void comm_set_payload_struct(uint16_t proto_len, uint16_t raw_len) {
-  comm_payload.proto_data_length = proto_len;
-  comm_payload.raw_data_length = raw_len;
-  comm_payload.proto_data =
-      proto_len ? comm_io_buffer + sizeof(uint16_t) * 2 : NULL;
-  comm_payload.raw_data = raw_len ? comm_io_buffer + 2 * sizeof(uint16_t) +
-                                        comm_payload.proto_data_length
-                                  : NULL;
+  comm_set_slot_payload_struct(
+      get_comm_status()->live_slot, proto_len, raw_len);
+}
+
+void comm_set_slot_payload_struct(uint8_t slot,
+                                  uint16_t proto_len,
+                                  uint16_t raw_len) {
+  comm_payload_t *payload = get_comm_payload_slot(slot);
+  uint8_t *io_buffer = get_io_buffer_slot(slot);
+  payload->proto_data_length = proto_len;
+  payload->raw_data_length = raw_len;
+  payload->proto_data = proto_len ? io_buffer + sizeof(uint16_t) * 2 : NULL;
+  payload->raw_data =
+      raw_len ? io_buffer + 2 * sizeof(uint16_t) + payload->proto_data_length
+              : NULL;
+  // cache chunking once instead of on every out packet
+  chunk_info_init(&payload->framing,
+                  COMM_SZ_RESERVED_SPACE + proto_len + raw_len,
+                  COMM_MAX_PAYLOAD_SIZE);
 }
@@ -53,6 +53,17 @@ typedef struct {
   const uint8_t *p_msg;
 } usb_event_t;
 
+/**
+ * @brief Result of pulling the next segment of a streamed message
+ * @see usb_stream_pull()
+ */
+typedef enum usb_stream_status {
+  USB_STREAM_END = 0,        ///< No more data; message fully delivered
+  USB_STREAM_SEGMENT = 1,    ///< Next segment of the message is available
+  USB_STREAM_PENDING = 2,    ///< Host is still uploading the next segment
+  USB_STREAM_ERROR = 3,      ///< Upload of the message failed
+} usb_stream_status_t;
+
 /*****************************************************************************
  * EXPORTED VARIABLES
  *****************************************************************************/
@@ -112,6 +123,15 @@ void usb_clear_event();
  */
 bool usb_get_event(usb_event_t *evt);
 
+/**
+ * @brief Processes the packets received from the host since the last call
+ * @details The USB ISR only frames the incoming packets and queues them; the
+ * protocol (acks, status, command assembly, abort) runs here in the main loop.
+ * get_events() and usb_get_event() call it, call it directly when waiting on
+ * the host outside of them.
+ */
+void usb_process_rx_packets(void);
+
 /**
  * @brief Sends data stream to the host application over usb.
  * @details Allows applications to send data to the host. The functions
@@ -134,6 +154,66 @@ void usb_send_msg(const uint8_t *core_msg,
                   const uint8_t *app_msg,
                   uint32_t app_msg_size);
 
+/**
+ * @brief Returns the part of the usb buffer where a message is to be encoded
+ * for usb_send_msg_in_place().
+ * @details The core msg goes first, immediately followed by the app msg. The
+ * buffer holds the received command until then, so the command must be fully
+ * consumed before encoding the response.
+ *
+ * @param capacity Set to the number of bytes available for both messages,
+ * NULL if not needed
+ * @return uint8_t* Start of the core msg, past the length header
+ */
+uint8_t *usb_get_msg_buffer(uint32_t *capacity);
+
+/**
+ * @brief Sends the messages already encoded in the buffer returned by
+ * usb_get_msg_buffer(); saves the copy done by usb_send_msg().
+ *
+ * @param core_msg_size Size of the core msg at the start of the buffer
+ * @param app_msg_size Size of the app msg following the core msg
+ */
+void usb_send_msg_in_place(uint32_t core_msg_size, uint32_t app_msg_size);
+
+/**
+ * @brief Lets the running app receive commands larger than the usb-comm buffer
+ * @details Such commands are rejected with INVALID_PAYLOAD_LENGTH unless the
+ * app has opted in, since an app not pulling the segments would decode the
+ * first segment as the whole message. An app consuming segments with
+ * usb_stream_pull() opts in before it queries the host. The opt-in is
+ * dropped once the app returns to the core, see registry_dispatch().
+ *
+ * @param accept Whether the app pulls the segments of large commands
+ */
+void usb_stream_set_accepted(bool accept);
+
+/**
+ * @brief Returns the number of bytes of the current message not yet received.
+ * @details A command larger than the usb-comm buffer is delivered as a
+ * sequence of bounded segments. The usb event carries the first segment of the
+ * app message, the remaining segments are fetched with usb_stream_pull(). For
+ * commands which fit in the buffer, or if the app has not opted in with
+ * usb_stream_set_accepted(), this always returns 0.
+ *
+ * @return uint32_t Number of bytes the host is yet to upload
+ */
+uint32_t usb_stream_get_remaining(void);
+
+/**
+ * @brief Pulls the next segment of a streamed message
+ * @details The call releases the segment returned previously (or the first
+ * segment carried by the usb event) so that the host can upload the next one;
+ * the released segment must not be accessed afterwards. The API is
+ * non-blocking; the caller is expected to retry on USB_STREAM_PENDING.
+ *
+ * @param segment Reference to store the start of the next segment
+ * @param size Reference to store the size of the next segment
+ *
+ * @return usb_stream_status_t Status of the stream
+ */
+usb_stream_status_t usb_stream_pull(const uint8_t **segment, uint16_t *size);
+
 // TODO: Update after refactor; remove the following
 void usb_send_data(uint32_t cmd, const uint8_t *data, uint32_t size);
 
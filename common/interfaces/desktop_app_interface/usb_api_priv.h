@@ -15,6 +15,8 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "capacity_config.h"
+#include "chunk_utils.h"
 #include "communication.h"
 #if USE_SIMULATOR == 0
 #include "libusb.h"
@@ -30,8 +32,52 @@
 #define COMM_PKT_MAX_LEN 64
 #define COMM_MAX_PAYLOAD_SIZE (COMM_PKT_MAX_LEN - COMM_HEADER_SIZE)
 
+/// Offsets of the fields in a serialized packet; @see comm_header_t
+#define COMM_HEADER_INDEX 0
+#define COMM_CHECKSUM_INDEX 2
+#define COMM_CHUNK_NO_INDEX 4
+#define COMM_CHUNK_COUNT_INDEX 6
+#define COMM_SEQ_NO_INDEX 8
+#define COMM_PKT_TYPE_INDEX 10
+#define COMM_TIMESTAMP_INDEX 11
+#define COMM_PAYLOAD_LEN_INDEX 15
+#define COMM_PAYLOAD_INDEX 16
+
 #define COMM_SZ_RESERVED_SPACE 4
-#define COMM_BUFFER_SIZE ((size_t)6 * 1024)
+/// Raw bytes of a status packet: ping-pong slot status and flow progress
+#define COMM_STATUS_RAW_SIZE 7
+#define COMM_BUFFER_SIZE ((size_t)CAPACITY_COMM_BUFFER_SIZE)
+
+/// Number of comm_io_buffer slots; with 2 slots the host can pre-load the
+/// next command while the current one executes. Set to 1 to save RAM.
+#ifndef COMM_IO_BUFFER_SLOTS
+#define COMM_IO_BUFFER_SLOTS CAPACITY_COMM_BUFFER_SLOTS
+#endif
+
+#ifndef COMM_CRC_USE_HW
+#define COMM_CRC_USE_HW 0
+#endif
+
+/// Maximum number of cmd chunks a host can stream before waiting for an ACK
+#define COMM_CMD_MAX_WINDOW 32
+/// Maximum number of output chunks pushed in response to one burst request
+#define COMM_OUT_MAX_BURST 32
+
+/// Maximum number of consecutive USB transfers a jumbo frame (one header for
+/// a larger payload) may span, see PKT_TYPE_JUMBO_REQ. Set to 1 to disable
+/// jumbo frames and save the RAM of the frame assembly.
+#ifndef COMM_JUMBO_MAX_TRANSFERS
+#define COMM_JUMBO_MAX_TRANSFERS 4
+#endif
+#define COMM_JUMBO_PKT_MAX_LEN (COMM_JUMBO_MAX_TRANSFERS * COMM_PKT_MAX_LEN)
+#define COMM_JUMBO_MAX_PAYLOAD_SIZE (COMM_JUMBO_PKT_MAX_LEN - COMM_HEADER_SIZE)
+
+/// Time in milliseconds without any packet from the active interface after
+/// which another interface may take it over, provided no command is in
+/// transit. The owner can also give it up at once with PKT_TYPE_RELEASE_REQ.
+#ifndef COMM_INTERFACE_LEASE_MS
+#define COMM_INTERFACE_LEASE_MS 2000
+#endif
 
 /*****************************************************************************
  * TYPEDEFS
@@ -63,6 +109,17 @@ typedef enum comm_cmd_state {
   CMD_STATE_INVALID_REQ = 6,
 } comm_cmd_state_t;
 
+/**
+ * @brief State of the comm_io_buffer segment while streaming a large command
+ * @see usb_stream_pull()
+ */
+typedef enum comm_stream_segment_state {
+  COMM_STREAM_SEGMENT_FILLING = 0,    ///< Host is uploading into the segment
+  COMM_STREAM_SEGMENT_READY = 1,      ///< Segment full; waiting for app pull
+  COMM_STREAM_SEGMENT_HELD = 2,       ///< Segment handed over to the app
+  COMM_STREAM_SEGMENT_ABORTED = 3,    ///< Upload failed; stream is unusable
+} comm_stream_segment_state_t;
+
 /**
  * @brief Communication Header struct
  * @details
@@ -115,6 +172,7 @@ typedef struct comm_payload {
                                ///< cmd payload
   uint8_t *proto_data;    ///< Protobuf serialization data in the cmd payload
   uint8_t *raw_data;      ///< Raw serialization data in the cmd payload
+  chunk_info_t framing;   ///< Packet framing of the complete payload
 } comm_payload_t;
 
 /**
@@ -132,6 +190,26 @@ typedef struct packet {
   comm_libusb__interface_e interface;
 } packet_t;
 
+/**
+ * @brief Transport counters of usb-comm module
+ * @details The counters accumulate from boot (or the last reset requested by
+ * the host with PKT_TYPE_STATS_REQ) and help tune the host side batching.
+ * Times are in milliseconds of uwTick.
+ */
+typedef struct comm_stats {
+  uint32_t packets_in;           ///< Packets with valid checksum received
+  uint32_t packets_out;          ///< Packets transmitted to the host
+  uint32_t bytes_in;             ///< Payload bytes of received packets
+  uint32_t bytes_out;            ///< Payload bytes of transmitted packets
+  uint16_t duplicate_chunks;     ///< Retransmitted cmd chunks ignored
+  uint16_t out_of_order_chunks;  ///< Cmd chunks rejected as out of order
+  uint16_t error_packets;        ///< Error packets sent (incl. checksum)
+  uint32_t receiving_time;       ///< Time spent in CMD_STATE_RECEIVING
+  uint32_t executing_time;       ///< Time spent in CMD_STATE_EXECUTING
+  uint8_t tracked_state;         ///< cmd state seen at last update
+  uint32_t tracked_since;        ///< uwTick when tracked_state was entered
+} comm_stats_t;
+
 typedef struct comm_status {
   // Application info
   uint8_t app_busy_status;
@@ -146,12 +224,42 @@ typedef struct comm_status {
   uint16_t curr_cmd_chunk_no;
   uint16_t curr_cmd_received_length;
 
+  // Ping-pong slot management (not to be sent to host). The live slot holds
+  // the command being executed (and later its output). The spare slot either
+  // holds output of the previous command (CMD_STATE_DONE/CMD_STATE_FAILED),
+  // a pre-loaded command (CMD_STATE_RECEIVING/CMD_STATE_RECEIVED) or nothing
+  // (CMD_STATE_NONE).
+  uint8_t live_slot;
+  uint8_t spare_cmd_state;
+  uint16_t spare_cmd_seq_no;
+  uint16_t spare_cmd_chunk_no;
+  uint16_t spare_cmd_received_length;
+
+  // Streaming of commands larger than comm_io_buffer (not to be sent to host).
+  // Lengths account for the complete command including the stream lengths.
+  // stream_accepted is set by the running app, see usb_stream_set_accepted().
+  bool stream_accepted;
+  bool stream_active;
+  uint8_t stream_segment_state;
+  uint16_t stream_segment_length;
+  uint32_t stream_total_length;
+  uint32_t stream_received_length;
+
+  // Negotiated cmd upload window (not to be sent to host). A window of 0 or 1
+  // means legacy stop-and-wait where every chunk is acknowledged.
+  uint16_t cmd_window_size;
+  comm_libusb__interface_e cmd_window_interface;
+  bool cmd_window_gap_acked;
+
   // Host sync status (not to be sent to host)
   uint32_t host_sync_time;
   uint8_t host_sync_fails;
 
   // Host interface while receiving data and while an application is in progress
   comm_libusb__interface_e active_interface;
+  // uwTick of the last packet from the active interface; refer
+  // COMM_INTERFACE_LEASE_MS
+  uint32_t active_interface_tick;
 } comm_status_t;
 
 /*****************************************************************************
@@ -163,15 +271,29 @@ typedef struct comm_status {
  *****************************************************************************/
 
 /**
- * @brief Returns the reference to internal instance of io_buffer
+ * @brief Returns the reference to the live slot of io_buffer
  */
 uint8_t *get_io_buffer();
 
 /**
- * @brief Returns the reference to internal instance of comm_payload
+ * @brief Returns the reference to the requested slot of io_buffer
+ *
+ * @param slot Index of the slot, less than COMM_IO_BUFFER_SLOTS
+ */
+uint8_t *get_io_buffer_slot(uint8_t slot);
+
+/**
+ * @brief Returns the reference to comm_payload of the live slot
  */
 comm_payload_t *get_comm_payload();
 
+/**
+ * @brief Returns the reference to comm_payload of the requested slot
+ *
+ * @param slot Index of the slot, less than COMM_IO_BUFFER_SLOTS
+ */
+comm_payload_t *get_comm_payload_slot(uint8_t slot);
+
 /**
  * @brief Resets the active interface(to COMM_LIBUSB__UNDEFINED) used to
  * determine which interface is allowed to send new commands. The interface must
@@ -187,6 +309,68 @@ comm_status_t *get_comm_status();
 
 void comm_set_payload_struct(uint16_t proto_len, uint16_t raw_len);
 
+/**
+ * @brief Returns the reference to transport counters of usb-comm module
+ */
+const comm_stats_t *get_comm_stats(void);
+
+/**
+ * @brief Accounts the time spent in the previous cmd state
+ * @details Should be called after each update of comm_status.curr_cmd_state so
+ * that time spent in receiving & executing states is accurate.
+ */
+void comm_stats_track_state(void);
+
+/**
+ * @brief Returns the number of received packets dropped since boot as the rx
+ * ring between the USB ISR and the main loop was full
+ */
+uint32_t comm_rx_overruns(void);
+
+/**
+ * @brief Enables jumbo frames for packets received on the interface
+ * @details Frames of the interface may then carry up to the granted number of
+ * USB transfers under one header; they are assembled by comm_packet_parser().
+ * Jumbo frames of any previously negotiated interface are disabled.
+ *
+ * @param interface Interface which negotiated jumbo frames
+ * @param transfers Requested USB transfers per frame, 1 disables jumbo frames
+ *
+ * @return uint8_t Granted USB transfers per frame
+ */
+uint8_t comm_rx_set_jumbo(comm_libusb__interface_e interface,
+                          uint8_t transfers);
+
+/**
+ * @brief Returns the largest payload accepted in a packet of the interface
+ *
+ * @param interface Interface of the packet
+ */
+uint8_t comm_rx_max_payload(comm_libusb__interface_e interface);
+
+/**
+ * @brief Populates comm_payload of the requested slot from the stream lengths
+ *
+ * @param slot Index of the slot, less than COMM_IO_BUFFER_SLOTS
+ * @param proto_len Length of the protobuf serialized data
+ * @param raw_len Length of the raw serialized data
+ */
+void comm_set_slot_payload_struct(uint8_t slot,
+                                  uint16_t proto_len,
+                                  uint16_t raw_len);
+
+/**
+ * @brief Makes a pre-loaded command of the spare slot live
+ * @details If the live slot is released by the application and the spare slot
+ * holds a completely received command, the slots are swapped and the usb event
+ * for the pre-loaded command is set. The output of the previously live command
+ * stays available to the host from the (now spare) slot until the slot is
+ * reused for the next pre-loaded command.
+ *
+ * @return true if a pre-loaded command was made live, false otherwise
+ */
+bool comm_promote_spare_cmd(void);
+
 /**
  * @brief  Update CRC16 for input byte
  * @details
@@ -202,6 +386,21 @@ void comm_set_payload_struct(uint16_t proto_len, uint16_t raw_len);
  */
 uint16_t update_crc16(uint16_t crc_in, uint8_t byte);
 
+/**
+ * @brief Computes CRC-16/XMODEM over a contiguous buffer
+ * @details The result is identical to feeding each byte of the buffer followed
+ * by two zero bytes to update_crc16() starting from 0. The computation is
+ * table driven; on device builds with COMM_CRC_USE_HW set to 1, the STM32L4
+ * CRC peripheral is used instead, with interrupts masked as both the USB ISR
+ * and the main loop compute CRCs.
+ *
+ * @param data Reference to the buffer
+ * @param length Number of bytes to process
+ *
+ * @return uint16_t CRC of the buffer
+ */
+uint16_t comm_crc16(const uint8_t *data, uint16_t length);
+
 /**
  * @brief Send a packet to the host
  * @details This function aggregates a received packet from the host.
@@ -264,4 +463,19 @@ void comm_process_packet(const packet_t *rx_packet);
 
 void send_error_packet(const packet_t *rx_packet, comm_error_code_t error_code);
 
+/**
+ * @brief Answers a status request straight from the USB ISR
+ * @details Called by the receive path before queueing a valid packet while
+ * no packet is pending for the main loop, so the answer reflects everything
+ * received before it. The status comes from core_status_get_snapshot(), hence
+ * the host can poll without waiting for the main loop, eg. during a PoW or a
+ * card exchange. Only done on the device: the simulator receives on a thread.
+ *
+ * @param rx_packet Reference to the received packet
+ *
+ * @return true If the packet was a status request and is answered
+ * @return false If the packet must be queued for comm_process_packet()
+ */
+bool comm_answer_status_request(const packet_t *rx_packet);
+
 #endif
\ No newline at end of file
@@ -65,10 +65,12 @@
 #include "app_registry.h"
 #include "core.pb.h"
 #include "core_api.h"
+#include "events.h"
 #include "memzero.h"
 #include "pb_decode.h"
 #include "usb_api.h"
 #include "usb_api_priv.h"
+#include "utils.h"
 
 /*****************************************************************************
  * EXTERN VARIABLES
@@ -164,9 +166,12 @@ static core_error_type_t get_core_req_type(usb_core_msg_t msg,
   core_msg_t core_msg_p = CORE_MSG_INIT_ZERO;
   pb_istream_t stream = pb_istream_from_buffer(msg.buffer, msg.size);
   core_error_type_t status = CORE_INVALID_MSG;
+  // the command data decoded in the arena is not needed past this function
+  const cy_arena_mark_t mark = cy_arena_mark();
+  bool decoded = pb_decode(&stream, CORE_MSG_FIELDS, &core_msg_p);
+  cy_arena_reset(mark);
   // invalid buffer ref, 0 size & decode failure are error situation
-  if (false == pb_decode(&stream, CORE_MSG_FIELDS, &core_msg_p) ||
-      NULL == msg.buffer || 0 == msg.size) {
+  if (false == decoded || NULL == msg.buffer || 0 == msg.size) {
     return status;
   }
 
@@ -241,6 +246,7 @@ void usb_set_event(const uint16_t core_msg_size,
 
   core_msg.buffer = core_msg_buffer;
   core_msg.size = core_msg_size;
+  events_signal_wakeup();
 }
 
 bool usb_get_event(usb_event_t *evt) {
@@ -250,6 +256,12 @@ bool usb_get_event(usb_event_t *evt) {
 
   size_t request_type = 0;
   reset_event_obj(evt);
+  usb_process_rx_packets();
+
+  if (!usb_event.flag) {
+    // hand over a command pre-loaded by the host while the previous executed
+    comm_promote_spare_cmd();
+  }
 
   if (usb_event.flag) {
     core_error_type_t status = get_core_req_type(core_msg, &request_type);
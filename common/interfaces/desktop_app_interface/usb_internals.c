@@ -57,24 +57,30 @@
  ******************************************************************************
  */
 
+/// Log level of the module, set before logger.h is included
+#define LOG_MODULE_LEVEL LOG_USB_LEVEL
+
 /*****************************************************************************
  * INCLUDES
  *****************************************************************************/
 #include <core.pb.h>
-#include <math.h>
 #include <pb.h>
 
 #include "board.h"
+#include "events.h"
+#include "flow_trace.h"
 #if USE_SIMULATOR == 0
 #include "libusb.h"
 #else
 #include "sim_usb.h"
 #endif
 #include "logger.h"
+#include "memzero.h"
 #include "p0_events.h"
 #include "pb_encode.h"
 #include "status_api.h"
 #include "sys_state.h"
+#include "trace_ring.h"
 #include "usb_api_priv.h"
 #include "utils.h"
 
@@ -86,25 +92,19 @@
  * PRIVATE MACROS AND DEFINES
  *****************************************************************************/
 
-#define COMM_HEADER_INDEX 0
-#define COMM_CHECKSUM_INDEX 2
-#define COMM_CHUNK_NO_INDEX 4
-#define COMM_CHUNK_COUNT_INDEX 6
-#define COMM_SEQ_NO_INDEX 8
-#define COMM_PKT_TYPE_INDEX 10
-#define COMM_TIMESTAMP_INDEX 11
-#define COMM_PAYLOAD_LEN_INDEX 15
-#define COMM_PAYLOAD_INDEX 16
+/// Trace entries sent per PKT_TYPE_TRACE_ACK, after 12 bytes of trace summary
+#define COMM_TRACE_PAGE_ENTRIES                                                \
+  ((COMM_MAX_PAYLOAD_SIZE - COMM_SZ_RESERVED_SPACE - 12) / 6)
+
+/// Trace ring entries sent per PKT_TYPE_EVENTS_ACK, after the 2 sequence nos
+#define COMM_EVENTS_PAGE_ENTRIES                                               \
+  ((COMM_MAX_PAYLOAD_SIZE - COMM_SZ_RESERVED_SPACE - 8) / 10)
 
 #define comm_get_raw_payload_size(raw_payload)                                 \
   (raw_payload ? (sizeof(uint32_t) + raw_payload->msg_size) : 0)
 #define comm_get_proto_payload_size(proto_payload)                             \
   (proto_payload ? (proto_payload)->size : 0)
 
-/// @details Macro to get the size of the total payload in Cmd Output response.
-#define comm_get_payload_size(payload)                                         \
-  (2 * sizeof(uint16_t) + payload->raw_data_length + payload->proto_data_length)
-
 /*****************************************************************************
  * PRIVATE TYPEDEFS
  *****************************************************************************/
@@ -118,30 +118,106 @@ typedef enum comm_packet_type {
   PKT_TYPE_OUT_RESP = 6,
   PKT_TYPE_ERROR = 7,
   PKT_TYPE_ABORT = 8,
+  PKT_TYPE_CMD_WINDOW_REQ = 9,
+  PKT_TYPE_CMD_WINDOW_ACK = 10,
+  PKT_TYPE_OUT_BURST_REQ = 11,
+  PKT_TYPE_STATS_REQ = 12,
+  PKT_TYPE_STATS_ACK = 13,
+  PKT_TYPE_TRACE_REQ = 14,
+  PKT_TYPE_TRACE_ACK = 15,
+  PKT_TYPE_EVENTS_REQ = 16,
+  PKT_TYPE_EVENTS_ACK = 17,
+  PKT_TYPE_JUMBO_REQ = 18,
+  PKT_TYPE_JUMBO_ACK = 19,
+  PKT_TYPE_RELEASE_REQ = 20,
 } comm_packet_type;
 
 /*****************************************************************************
  * STATIC VARIABLES
  *****************************************************************************/
 
+/// Remainders of (i * x^16) mod 0x1021 used by the CRC-16/XMODEM engine
+static const uint16_t crc16_table[256] = {
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+    0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF,
+    0x1231, 0x0210, 0x3273, 0x2252, 0x52B5, 0x4294, 0x72F7, 0x62D6,
+    0x9339, 0x8318, 0xB37B, 0xA35A, 0xD3BD, 0xC39C, 0xF3FF, 0xE3DE,
+    0x2462, 0x3443, 0x0420, 0x1401, 0x64E6, 0x74C7, 0x44A4, 0x5485,
+    0xA56A, 0xB54B, 0x8528, 0x9509, 0xE5EE, 0xF5CF, 0xC5AC, 0xD58D,
+    0x3653, 0x2672, 0x1611, 0x0630, 0x76D7, 0x66F6, 0x5695, 0x46B4,
+    0xB75B, 0xA77A, 0x9719, 0x8738, 0xF7DF, 0xE7FE, 0xD79D, 0xC7BC,
+    0x48C4, 0x58E5, 0x6886, 0x78A7, 0x0840, 0x1861, 0x2802, 0x3823,
+    0xC9CC, 0xD9ED, 0xE98E, 0xF9AF, 0x8948, 0x9969, 0xA90A, 0xB92B,
+    0x5AF5, 0x4AD4, 0x7AB7, 0x6A96, 0x1A71, 0x0A50, 0x3A33, 0x2A12,
+    0xDBFD, 0xCBDC, 0xFBBF, 0xEB9E, 0x9B79, 0x8B58, 0xBB3B, 0xAB1A,
+    0x6CA6, 0x7C87, 0x4CE4, 0x5CC5, 0x2C22, 0x3C03, 0x0C60, 0x1C41,
+    0xEDAE, 0xFD8F, 0xCDEC, 0xDDCD, 0xAD2A, 0xBD0B, 0x8D68, 0x9D49,
+    0x7E97, 0x6EB6, 0x5ED5, 0x4EF4, 0x3E13, 0x2E32, 0x1E51, 0x0E70,
+    0xFF9F, 0xEFBE, 0xDFDD, 0xCFFC, 0xBF1B, 0xAF3A, 0x9F59, 0x8F78,
+    0x9188, 0x81A9, 0xB1CA, 0xA1EB, 0xD10C, 0xC12D, 0xF14E, 0xE16F,
+    0x1080, 0x00A1, 0x30C2, 0x20E3, 0x5004, 0x4025, 0x7046, 0x6067,
+    0x83B9, 0x9398, 0xA3FB, 0xB3DA, 0xC33D, 0xD31C, 0xE37F, 0xF35E,
+    0x02B1, 0x1290, 0x22F3, 0x32D2, 0x4235, 0x5214, 0x6277, 0x7256,
+    0xB5EA, 0xA5CB, 0x95A8, 0x8589, 0xF56E, 0xE54F, 0xD52C, 0xC50D,
+    0x34E2, 0x24C3, 0x14A0, 0x0481, 0x7466, 0x6447, 0x5424, 0x4405,
+    0xA7DB, 0xB7FA, 0x8799, 0x97B8, 0xE75F, 0xF77E, 0xC71D, 0xD73C,
+    0x26D3, 0x36F2, 0x0691, 0x16B0, 0x6657, 0x7676, 0x4615, 0x5634,
+    0xD94C, 0xC96D, 0xF90E, 0xE92F, 0x99C8, 0x89E9, 0xB98A, 0xA9AB,
+    0x5844, 0x4865, 0x7806, 0x6827, 0x18C0, 0x08E1, 0x3882, 0x28A3,
+    0xCB7D, 0xDB5C, 0xEB3F, 0xFB1E, 0x8BF9, 0x9BD8, 0xABBB, 0xBB9A,
+    0x4A75, 0x5A54, 0x6A37, 0x7A16, 0x0AF1, 0x1AD0, 0x2AB3, 0x3A92,
+    0xFD2E, 0xED0F, 0xDD6C, 0xCD4D, 0xBDAA, 0xAD8B, 0x9DE8, 0x8DC9,
+    0x7C26, 0x6C07, 0x5C64, 0x4C45, 0x3CA2, 0x2C83, 0x1CE0, 0x0CC1,
+    0xEF1F, 0xFF3E, 0xCF5D, 0xDF7C, 0xAF9B, 0xBFBA, 0x8FD9, 0x9FF8,
+    0x6E17, 0x7E36, 0x4E55, 0x5E74, 0x2E93, 0x3EB2, 0x0ED1, 0x1EF0,
+};
+
 /*****************************************************************************
  * GLOBAL VARIABLES
  *****************************************************************************/
 
 comm_status_t comm_status;
+/// Also updated by the USB ISR; see comm_stats_lock()
+comm_stats_t comm_stats;
+
+/// Set while a packet is written, so that the USB ISR does not write over the
+/// main loop; see comm_answer_status_request()
+static volatile bool comm_tx_busy = false;
 
 /*****************************************************************************
  * STATIC FUNCTION PROTOTYPES
  *****************************************************************************/
 
 static comm_error_code_t comm_process_cmd_packet(const packet_t *rx_packet);
+static comm_error_code_t comm_stage_cmd_packet(const packet_t *rx_packet);
+static comm_error_code_t comm_stream_cmd_packet(const packet_t *rx_packet);
+static void comm_stream_start(void);
+static comm_error_code_t comm_get_output_slot(const packet_t *rx_packet,
+                                              uint8_t *slot);
 static comm_error_code_t comm_process_status_packet(const packet_t *rx_packet);
 static comm_error_code_t comm_process_out_req_packet(const packet_t *rx_packet);
 static comm_error_code_t comm_process_abort_packet(const packet_t *rx_packet);
+static comm_error_code_t comm_process_window_packet(const packet_t *rx_packet);
+static comm_error_code_t comm_process_jumbo_packet(const packet_t *rx_packet);
+static comm_error_code_t comm_process_release_packet(
+    const packet_t *rx_packet);
+static bool comm_claim_interface(const packet_t *rx_packet);
+static comm_error_code_t comm_process_stats_packet(const packet_t *rx_packet);
+static comm_error_code_t comm_process_trace_packet(const packet_t *rx_packet);
+static comm_error_code_t comm_process_events_packet(const packet_t *rx_packet);
+static void comm_write_be32(uint8_t *buffer, uint32_t value);
+static comm_error_code_t comm_process_out_burst_packet(
+    const packet_t *rx_packet);
 
 static void send_status_packet(const packet_t *rx_packet);
-static void send_cmd_ack_packet(const packet_t *rx_packet);
-static void send_cmd_output_packet(const packet_t *rx_packet);
+static void send_cmd_ack_packet(const packet_t *rx_packet, uint16_t chunk_no);
+static void send_cmd_output_chunk(const packet_t *rx_packet,
+                                  uint8_t slot,
+                                  uint16_t req_chunk_no);
+static void send_cmd_output_packet(const packet_t *rx_packet, uint8_t slot);
+static void send_window_ack_packet(const packet_t *rx_packet);
+static void send_jumbo_ack_packet(const packet_t *rx_packet,
+                                  uint8_t transfers);
 
 static void comm_write_packet(uint16_t chunk_number,
                               uint16_t total_chunks,
@@ -156,6 +232,64 @@ static inline void comm_reset() {
   comm_status.curr_cmd_received_length = 0;
   comm_status.curr_cmd_state = CMD_STATE_NONE;
   comm_status.curr_cmd_chunk_no = 0;
+  comm_status.cmd_window_gap_acked = false;
+  comm_status.stream_active = false;
+}
+
+/**
+ * @brief Masks interrupts while comm_stats is updated
+ * @details The USB ISR counts the status acks it writes (see
+ * comm_answer_status_request()) in comm_stats; the main loop masks it to
+ * update the same counters. Safe to nest as the previous mask is restored.
+ *
+ * @return uint32_t The mask to pass to comm_stats_unlock()
+ */
+static inline uint32_t comm_stats_lock(void) {
+#if USE_SIMULATOR == 0
+  const uint32_t primask = __get_PRIMASK();
+  __disable_irq();
+  return primask;
+#else
+  // the simulator receives on its own thread, not in an ISR
+  return 0;
+#endif
+}
+
+static inline void comm_stats_unlock(uint32_t primask) {
+#if USE_SIMULATOR == 0
+  __set_PRIMASK(primask);
+#else
+  (void)primask;
+#endif
+}
+
+static inline uint8_t comm_spare_slot() {
+  return (comm_status.live_slot + 1) % COMM_IO_BUFFER_SLOTS;
+}
+
+static inline bool comm_spare_has_cmd() {
+  return COMM_IO_BUFFER_SLOTS > 1 &&
+         (comm_status.spare_cmd_state == CMD_STATE_RECEIVING ||
+          comm_status.spare_cmd_state == CMD_STATE_RECEIVED);
+}
+
+static inline void comm_reset_spare() {
+  comm_status.spare_cmd_state = CMD_STATE_NONE;
+  comm_status.spare_cmd_chunk_no = 0;
+  comm_status.spare_cmd_received_length = 0;
+}
+
+/**
+ * @brief Returns the cmd upload window applicable to the provided packet.
+ * @details The negotiated window applies only to the interface which
+ * negotiated it; packets from any other interface are handled in the legacy
+ * stop-and-wait mode.
+ */
+static inline uint16_t comm_get_cmd_window(const packet_t *rx_packet) {
+  if (comm_status.cmd_window_interface != rx_packet->interface ||
+      comm_status.cmd_window_size < 2)
+    return 1;
+  return comm_status.cmd_window_size;
 }
 
 /*****************************************************************************
@@ -183,38 +317,107 @@ static comm_error_code_t comm_process_status_packet(const packet_t *rx_packet) {
 static comm_error_code_t comm_process_cmd_packet(const packet_t *rx_packet) {
   uint8_t *comm_io_buffer = get_io_buffer();
   comm_payload_t *comm_payload = get_comm_payload();
-  if (!CY_Usb_Buffer_Free())
-    return APP_BUFFER_BLOCKED;
-  if (comm_status.curr_cmd_state == CMD_STATE_EXECUTING)
-    return BUSY_PREVIOUS_CMD;
-
-  // Set active host interface if not set already
-  if (comm_status.active_interface == COMM_LIBUSB__UNDEFINED) {
-    comm_status.active_interface = rx_packet->interface;
-  } else if (comm_status.active_interface != rx_packet->interface) {
-    return APP_BUSY_WITH_OTHER_INTERFACE;
+  if (comm_status.stream_active &&
+      comm_status.curr_cmd_seq_no == rx_packet->header.sequence_no &&
+      rx_packet->header.chunk_number != 1)
+    return comm_stream_cmd_packet(rx_packet);
+
+  const bool live_busy = !CY_Usb_Buffer_Free() ||
+                         comm_status.curr_cmd_state == CMD_STATE_EXECUTING;
+  // A new command while the live slot is busy is pre-loaded into the spare
+  // slot; so are the remaining chunks of a pre-load already in progress
+  const bool pre_load =
+      (COMM_IO_BUFFER_SLOTS > 1 && live_busy &&
+       comm_status.curr_cmd_seq_no != rx_packet->header.sequence_no) ||
+      (comm_spare_has_cmd() &&
+       comm_status.spare_cmd_seq_no == rx_packet->header.sequence_no);
+
+  if (!pre_load) {
+    if (!CY_Usb_Buffer_Free())
+      return APP_BUFFER_BLOCKED;
+    if (comm_status.curr_cmd_state == CMD_STATE_EXECUTING)
+      return BUSY_PREVIOUS_CMD;
   }
 
+  if (!comm_claim_interface(rx_packet))
+    return APP_BUSY_WITH_OTHER_INTERFACE;
+
+  if (pre_load)
+    return comm_stage_cmd_packet(rx_packet);
+
   comm_status.curr_cmd_state = CMD_STATE_RECEIVING;
   if (comm_status.curr_cmd_seq_no != rx_packet->header.sequence_no ||
-      rx_packet->header.chunk_number == 1)
+      rx_packet->header.chunk_number == 1) {
     comm_reset();    // Clear current status and start new command
+    // Host abandoned any pre-loaded command, if it started a new one
+    if (comm_spare_has_cmd())
+      comm_reset_spare();
+  }
 
-  if (comm_status.curr_cmd_chunk_no + 1 < rx_packet->header.chunk_number)
-    return OUT_OF_ORDER_CHUNK;
+  const uint16_t window = comm_get_cmd_window(rx_packet);
+  if (comm_status.curr_cmd_chunk_no + 1 < rx_packet->header.chunk_number) {
+    if (1 == window)
+      return OUT_OF_ORDER_CHUNK;
+    // In windowed mode, report the last in-order chunk once per gap so that
+    // the host can rewind; the rest of the in-flight window is dropped
+    comm_stats.out_of_order_chunks++;
+    if (!comm_status.cmd_window_gap_acked) {
+      comm_status.cmd_window_gap_acked = true;
+      send_cmd_ack_packet(rx_packet, comm_status.curr_cmd_chunk_no);
+    }
+    return NO_ERROR;
+  }
   if (rx_packet->header.chunk_number > rx_packet->header.total_chunks)
     return INVALID_CHUNK_COUNT;
 
   comm_status.curr_cmd_seq_no = rx_packet->header.sequence_no;
-  if (comm_status.curr_cmd_chunk_no + 1 == rx_packet->header.chunk_number) {
+  const bool is_new_chunk =
+      (comm_status.curr_cmd_chunk_no + 1 == rx_packet->header.chunk_number);
+  bool segment_done = false;
+  if (is_new_chunk) {
     // Duplicate packets are ignored; Only packets in expected sequence are
     // appended to buffer
+    if (comm_status.curr_cmd_received_length +
+            rx_packet->header.payload_length >
+        COMM_BUFFER_SIZE) {
+      comm_reset();
+      return INVALID_PAYLOAD_LENGTH;
+    }
+    // The payload references the rx ring of the parser; it is copied from
+    // there to its final offset
     comm_status.curr_cmd_chunk_no = rx_packet->header.chunk_number;
+    comm_status.cmd_window_gap_acked = false;
     memcpy(comm_io_buffer + comm_status.curr_cmd_received_length,
            rx_packet->payload,
            rx_packet->header.payload_length);
     comm_status.curr_cmd_received_length += rx_packet->header.payload_length;
-    if (rx_packet->header.chunk_number == rx_packet->header.total_chunks) {
+    if (1 == comm_status.curr_cmd_chunk_no &&
+        COMM_SZ_RESERVED_SPACE <= comm_status.curr_cmd_received_length) {
+      const uint16_t proto_len = U16_READ_BE_ARRAY(comm_io_buffer);
+      const uint32_t cmd_len = COMM_SZ_RESERVED_SPACE + proto_len +
+                               U16_READ_BE_ARRAY(comm_io_buffer + 2);
+      if (cmd_len > COMM_BUFFER_SIZE) {
+        // Only an app pulling the segments may receive a streamed command.
+        // Core msg must fit in the first segment for the event dispatch
+        if (!comm_status.stream_accepted ||
+            COMM_SZ_RESERVED_SPACE + proto_len >
+                COMM_BUFFER_SIZE - comm_rx_max_payload(rx_packet->interface)) {
+          comm_reset();
+          return INVALID_PAYLOAD_LENGTH;
+        }
+        comm_status.stream_active = true;
+        comm_status.stream_total_length = cmd_len;
+      }
+    }
+    if (comm_status.stream_active &&
+        comm_status.curr_cmd_received_length +
+                comm_rx_max_payload(rx_packet->interface) >
+            COMM_BUFFER_SIZE) {
+      // First segment of a command larger than the buffer is complete
+      comm_stream_start();
+      segment_done = true;
+    } else if (rx_packet->header.chunk_number ==
+               rx_packet->header.total_chunks) {
       // Last chunk received
       if (comm_status.curr_cmd_received_length !=
           (U16_READ_BE_ARRAY(comm_io_buffer) +
@@ -241,7 +444,15 @@ static comm_error_code_t comm_process_cmd_packet(const packet_t *rx_packet) {
                   comm_payload->raw_data_length,
                   comm_payload->raw_data);
   }
-  send_cmd_ack_packet(rx_packet);
+  if (!is_new_chunk)
+    comm_stats.duplicate_chunks++;
+  // Cumulative ACK at window boundaries, at the end of a segment and at the
+  // last chunk. Duplicates are always acknowledged to recover from a lost ACK.
+  if (1 == window || segment_done ||
+      rx_packet->header.chunk_number == rx_packet->header.total_chunks ||
+      !is_new_chunk ||
+      0 == (comm_status.curr_cmd_chunk_no % window))
+    send_cmd_ack_packet(rx_packet, comm_status.curr_cmd_chunk_no);
   LOG_SWV("#ORG#bs=%d, cs=%d, seq=%d, ccn=%d, ccc=%d, rl=%d\n",
           CY_Usb_Buffer_Free(),
           comm_status.curr_cmd_state,
@@ -252,6 +463,162 @@ static comm_error_code_t comm_process_cmd_packet(const packet_t *rx_packet) {
   return NO_ERROR;
 }
 
+/**
+ * @brief Hands over the first segment of a streamed command to the app
+ * @details The core msg is complete in the first segment while the app msg is
+ * truncated at the end of the segment. The rest of the app msg is delivered
+ * through usb_stream_pull().
+ */
+static void comm_stream_start(void) {
+  uint8_t *comm_io_buffer = get_io_buffer();
+  comm_payload_t *comm_payload = get_comm_payload();
+  const uint16_t proto_len = U16_READ_BE_ARRAY(comm_io_buffer);
+
+  comm_status.stream_received_length = comm_status.curr_cmd_received_length;
+  comm_status.stream_segment_length = comm_status.curr_cmd_received_length;
+  comm_status.stream_segment_state = COMM_STREAM_SEGMENT_HELD;
+  sys_flow_cntrl_u.bits.usb_buffer_free = false;
+  comm_set_payload_struct(proto_len,
+                          comm_status.curr_cmd_received_length -
+                              COMM_SZ_RESERVED_SPACE - proto_len);
+  comm_status.curr_cmd_state = CMD_STATE_RECEIVED;
+  usb_set_event(comm_payload->proto_data_length,
+                comm_payload->proto_data,
+                comm_payload->raw_data_length,
+                comm_payload->raw_data);
+}
+
+/**
+ * @details Packet type: PKT_TYPE_CMD <br/>
+ * Receives the following segments of a command larger than comm_io_buffer.
+ * Once a segment is full, further chunks are rejected with APP_BUFFER_BLOCKED
+ * until the app pulls the segment with usb_stream_pull(); the host is expected
+ * to retry the chunk. Chunks are acknowledged individually.
+ */
+static comm_error_code_t comm_stream_cmd_packet(const packet_t *rx_packet) {
+  uint8_t *comm_io_buffer = get_io_buffer();
+  if (comm_status.active_interface != rx_packet->interface)
+    return APP_BUSY_WITH_OTHER_INTERFACE;
+  if (comm_status.curr_cmd_chunk_no + 1 < rx_packet->header.chunk_number)
+    return OUT_OF_ORDER_CHUNK;
+  if (rx_packet->header.chunk_number > rx_packet->header.total_chunks)
+    return INVALID_CHUNK_COUNT;
+
+  if (comm_status.curr_cmd_chunk_no + 1 == rx_packet->header.chunk_number) {
+    if (comm_status.stream_segment_state != COMM_STREAM_SEGMENT_FILLING)
+      return APP_BUFFER_BLOCKED;
+
+    comm_status.stream_received_length += rx_packet->header.payload_length;
+    if (comm_status.stream_received_length >
+            comm_status.stream_total_length ||
+        (rx_packet->header.chunk_number == rx_packet->header.total_chunks &&
+         comm_status.stream_received_length !=
+             comm_status.stream_total_length)) {
+      comm_status.stream_segment_state = COMM_STREAM_SEGMENT_ABORTED;
+      return INVALID_PAYLOAD_LENGTH;
+    }
+    memcpy(comm_io_buffer + comm_status.stream_segment_length,
+           rx_packet->payload,
+           rx_packet->header.payload_length);
+    comm_status.stream_segment_length += rx_packet->header.payload_length;
+    comm_status.curr_cmd_chunk_no = rx_packet->header.chunk_number;
+
+    if (rx_packet->header.chunk_number == rx_packet->header.total_chunks ||
+        comm_status.stream_segment_length +
+                comm_rx_max_payload(rx_packet->interface) >
+            COMM_BUFFER_SIZE) {
+      comm_status.stream_segment_state = COMM_STREAM_SEGMENT_READY;
+      events_signal_wakeup();
+      sys_flow_cntrl_u.bits.usb_buffer_free = false;
+    }
+  } else {
+    comm_stats.duplicate_chunks++;
+  }
+  send_cmd_ack_packet(rx_packet, comm_status.curr_cmd_chunk_no);
+  return NO_ERROR;
+}
+
+/**
+ * @details Packet type: PKT_TYPE_CMD <br/>
+ * Receives a command into the spare slot of comm_io_buffer while the live slot
+ * is busy with execution of the current command. The command is handed over
+ * to the application by comm_promote_spare_cmd() once the live slot is
+ * released. Only one command can be pre-loaded at a time and its chunks are
+ * acknowledged individually.
+ */
+static comm_error_code_t comm_stage_cmd_packet(const packet_t *rx_packet) {
+  uint8_t *buffer = get_io_buffer_slot(comm_spare_slot());
+
+  if (comm_status.spare_cmd_seq_no != rx_packet->header.sequence_no ||
+      rx_packet->header.chunk_number == 1) {
+    if (comm_spare_has_cmd() &&
+        comm_status.spare_cmd_seq_no != rx_packet->header.sequence_no)
+      return BUSY_PREVIOUS_CMD;
+    // Start a new pre-load; this drops the output held in the spare slot
+    comm_reset_spare();
+    comm_status.spare_cmd_seq_no = rx_packet->header.sequence_no;
+  }
+  comm_status.spare_cmd_state = CMD_STATE_RECEIVING;
+
+  if (comm_status.spare_cmd_chunk_no + 1 < rx_packet->header.chunk_number)
+    return OUT_OF_ORDER_CHUNK;
+  if (rx_packet->header.chunk_number > rx_packet->header.total_chunks)
+    return INVALID_CHUNK_COUNT;
+
+  if (comm_status.spare_cmd_chunk_no + 1 == rx_packet->header.chunk_number) {
+    if (comm_status.spare_cmd_received_length +
+            rx_packet->header.payload_length >
+        COMM_BUFFER_SIZE) {
+      comm_reset_spare();
+      return INVALID_PAYLOAD_LENGTH;
+    }
+    comm_status.spare_cmd_chunk_no = rx_packet->header.chunk_number;
+    memcpy(buffer + comm_status.spare_cmd_received_length,
+           rx_packet->payload,
+           rx_packet->header.payload_length);
+    comm_status.spare_cmd_received_length += rx_packet->header.payload_length;
+    if (rx_packet->header.chunk_number == rx_packet->header.total_chunks &&
+        comm_status.spare_cmd_received_length !=
+            (U16_READ_BE_ARRAY(buffer) +
+             U16_READ_BE_ARRAY(buffer + sizeof(uint16_t)) +
+             sizeof(uint16_t) * 2)) {
+      comm_reset_spare();
+      return INVALID_PAYLOAD_LENGTH;
+    }
+  } else {
+    comm_stats.duplicate_chunks++;
+  }
+  if (rx_packet->header.chunk_number == rx_packet->header.total_chunks) {
+    comm_status.spare_cmd_state = CMD_STATE_RECEIVED;
+    // let the event loop promote it without waiting for the next poll
+    events_signal_wakeup();
+  }
+  send_cmd_ack_packet(rx_packet, comm_status.spare_cmd_chunk_no);
+  return NO_ERROR;
+}
+
+/**
+ * @brief Identifies the slot holding output for the sequence of the packet
+ * @details Output of the live command is served from the live slot. With
+ * ping-pong buffering, output of the previous command stays available from the
+ * spare slot until a new command is pre-loaded into it.
+ */
+static comm_error_code_t comm_get_output_slot(const packet_t *rx_packet,
+                                              uint8_t *slot) {
+  if (comm_status.curr_cmd_seq_no == rx_packet->header.sequence_no) {
+    *slot = comm_status.live_slot;
+    return NO_ERROR;
+  }
+  if (COMM_IO_BUFFER_SLOTS > 1 &&
+      comm_status.spare_cmd_seq_no == rx_packet->header.sequence_no &&
+      (comm_status.spare_cmd_state == CMD_STATE_DONE ||
+       comm_status.spare_cmd_state == CMD_STATE_FAILED)) {
+    *slot = comm_spare_slot();
+    return NO_ERROR;
+  }
+  return INVALID_SEQUENCE_NO;
+}
+
 /**
  * @details Packet type: PKT_TYPE_OUT_REQ <br/>
  * Process the cmd output request based on the state of the application. This
@@ -262,25 +629,70 @@ static comm_error_code_t comm_process_cmd_packet(const packet_t *rx_packet) {
  */
 static comm_error_code_t comm_process_out_req_packet(
     const packet_t *rx_packet) {
-  comm_payload_t *comm_payload = get_comm_payload();
-  if (comm_status.curr_cmd_seq_no != rx_packet->header.sequence_no)
+  uint8_t slot = 0;
+  if (NO_ERROR != comm_get_output_slot(rx_packet, &slot))
     return INVALID_SEQUENCE_NO;
+  comm_payload_t *comm_payload = get_comm_payload_slot(slot);
   if (rx_packet->header.chunk_number != 1)
     return INVALID_CHUNK_NO;
   if (rx_packet->header.total_chunks != 1)
     return INVALID_CHUNK_COUNT;
   if (rx_packet->header.payload_length != 6)
     return INVALID_PAYLOAD_LENGTH;
-  if (comm_status.curr_cmd_state != CMD_STATE_DONE &&
+  if (slot == comm_status.live_slot &&
+      comm_status.curr_cmd_state != CMD_STATE_DONE &&
       comm_status.curr_cmd_state != CMD_STATE_FAILED) {
     send_status_packet(rx_packet);
     return NO_ERROR;
   }
-  if ((U16_READ_BE_ARRAY(rx_packet->payload + 4) - 1) * COMM_MAX_PAYLOAD_SIZE >
-      comm_get_payload_size(comm_payload))
+  if (U16_READ_BE_ARRAY(rx_packet->payload + 4) >
+      comm_payload->framing.total_chunks)
     return NO_MORE_CHUNKS;    // Invalid output chunk request
 
-  send_cmd_output_packet(rx_packet);
+  send_cmd_output_packet(rx_packet, slot);
+  return NO_ERROR;
+}
+
+/**
+ * @details Packet type: PKT_TYPE_OUT_BURST_REQ <br/>
+ * Same as PKT_TYPE_OUT_REQ except that the payload carries the first chunk
+ * number (at offset 4) followed by the number of chunks (at offset 6) to be
+ * pushed back-to-back. The count is clamped to COMM_OUT_MAX_BURST and to the
+ * last available chunk. The host acknowledges the range by requesting the
+ * next one (or by starting a new command).
+ */
+static comm_error_code_t comm_process_out_burst_packet(
+    const packet_t *rx_packet) {
+  uint8_t slot = 0;
+  if (NO_ERROR != comm_get_output_slot(rx_packet, &slot))
+    return INVALID_SEQUENCE_NO;
+  comm_payload_t *comm_payload = get_comm_payload_slot(slot);
+  if (rx_packet->header.chunk_number != 1)
+    return INVALID_CHUNK_NO;
+  if (rx_packet->header.total_chunks != 1)
+    return INVALID_CHUNK_COUNT;
+  if (rx_packet->header.payload_length != 8)
+    return INVALID_PAYLOAD_LENGTH;
+  if (slot == comm_status.live_slot &&
+      comm_status.curr_cmd_state != CMD_STATE_DONE &&
+      comm_status.curr_cmd_state != CMD_STATE_FAILED) {
+    send_status_packet(rx_packet);
+    return NO_ERROR;
+  }
+
+  const uint16_t first_chunk = U16_READ_BE_ARRAY(rx_packet->payload + 4);
+  const uint16_t total_chunks = comm_payload->framing.total_chunks;
+  uint16_t count = U16_READ_BE_ARRAY(rx_packet->payload + 6);
+  if (0 == first_chunk || 0 == count)
+    return INVALID_CHUNK_NO;
+  if (first_chunk > total_chunks)
+    return NO_MORE_CHUNKS;    // Invalid output chunk request
+
+  count = CY_MIN(count, COMM_OUT_MAX_BURST);
+  count = CY_MIN(count, total_chunks - first_chunk + 1);
+  for (uint16_t chunk = first_chunk; chunk < first_chunk + count; chunk++) {
+    send_cmd_output_chunk(rx_packet, slot, chunk);
+  }
   return NO_ERROR;
 }
 
@@ -293,6 +705,7 @@ static comm_error_code_t comm_process_abort_packet(const packet_t *rx_packet) {
     return INVALID_PAYLOAD_LENGTH;
   if (true == core_status_get_abort_disabled()) {
     comm_reset();
+    comm_reset_spare();
     CY_Reset_Flow();
     p0_set_abort_evt(true);
     comm_status.curr_cmd_seq_no = rx_packet->header.sequence_no;
@@ -303,6 +716,268 @@ static comm_error_code_t comm_process_abort_packet(const packet_t *rx_packet) {
   return NO_ERROR;
 }
 
+/**
+ * @details Packet type: PKT_TYPE_CMD_WINDOW_REQ <br/>
+ * Negotiate the number of cmd chunks the host can stream before waiting for a
+ * cumulative ACK. The requested window (2-byte, big endian) is clamped to
+ * COMM_CMD_MAX_WINDOW and the granted value is echoed back. A window of 1
+ * restores the legacy stop-and-wait behaviour.
+ */
+static comm_error_code_t comm_process_window_packet(const packet_t *rx_packet) {
+  if (rx_packet->header.chunk_number != 1)
+    return INVALID_CHUNK_NO;
+  if (rx_packet->header.total_chunks != 1)
+    return INVALID_CHUNK_COUNT;
+  if (rx_packet->header.payload_length != sizeof(uint16_t))
+    return INVALID_PAYLOAD_LENGTH;
+
+  uint16_t window = U16_READ_BE_ARRAY(rx_packet->payload);
+  comm_status.cmd_window_size = CY_MAX(1, CY_MIN(window, COMM_CMD_MAX_WINDOW));
+  comm_status.cmd_window_interface = rx_packet->interface;
+  comm_status.cmd_window_gap_acked = false;
+
+  send_window_ack_packet(rx_packet);
+  return NO_ERROR;
+}
+
+/**
+ * @details Packet type: PKT_TYPE_JUMBO_REQ <br/>
+ * Negotiate jumbo frames: one header and checksum covering a cmd chunk which
+ * spans several consecutive 64-byte USB transfers, so that large uploads are
+ * not framed every 48 bytes. The requested number of transfers per frame
+ * (1-byte) is clamped to COMM_JUMBO_MAX_TRANSFERS and the granted value is
+ * echoed back. A value of 1 restores the legacy framing. Only the packets of
+ * the negotiating interface may be jumbo frames; packets to the host are
+ * framed as before.
+ */
+static comm_error_code_t comm_process_jumbo_packet(const packet_t *rx_packet) {
+  if (rx_packet->header.chunk_number != 1)
+    return INVALID_CHUNK_NO;
+  if (rx_packet->header.total_chunks != 1)
+    return INVALID_CHUNK_COUNT;
+  if (rx_packet->header.payload_length != sizeof(uint8_t))
+    return INVALID_PAYLOAD_LENGTH;
+
+  const uint8_t transfers =
+      comm_rx_set_jumbo(rx_packet->interface, rx_packet->payload[0]);
+  send_jumbo_ack_packet(rx_packet, transfers);
+  return NO_ERROR;
+}
+
+/**
+ * @details Packet type: PKT_TYPE_RELEASE_REQ <br/>
+ * The host gives up the ownership of the device so that another interface can
+ * send commands without waiting for the lease to expire. Only the active
+ * interface can release it; the request is answered with the status packet.
+ */
+static comm_error_code_t comm_process_release_packet(
+    const packet_t *rx_packet) {
+  if (rx_packet->header.chunk_number != 1)
+    return INVALID_CHUNK_NO;
+  if (rx_packet->header.total_chunks != 1)
+    return INVALID_CHUNK_COUNT;
+  if (rx_packet->header.payload_length != 0)
+    return INVALID_PAYLOAD_LENGTH;
+  if (comm_status.active_interface == rx_packet->interface)
+    comm_reset_interface();
+  else if (comm_status.active_interface != COMM_LIBUSB__UNDEFINED)
+    return APP_BUSY_WITH_OTHER_INTERFACE;
+
+  send_status_packet(rx_packet);
+  return NO_ERROR;
+}
+
+/**
+ * @brief Makes the interface of the packet the active interface
+ * @details The active interface holds a lease which is renewed by each of its
+ * packets. Another interface takes over once the lease expired, unless a
+ * command of the active interface is still being received, waits to be
+ * executed, is executing or is pre-loaded.
+ *
+ * @return true If the interface of the packet is the active interface
+ * @return false If another interface holds the device
+ */
+static bool comm_claim_interface(const packet_t *rx_packet) {
+  if (comm_status.active_interface != COMM_LIBUSB__UNDEFINED &&
+      comm_status.active_interface != rx_packet->interface) {
+    if (!CY_Usb_Buffer_Free() || comm_spare_has_cmd() ||
+        comm_status.curr_cmd_state == CMD_STATE_RECEIVING ||
+        comm_status.curr_cmd_state == CMD_STATE_EXECUTING ||
+        uwTick - comm_status.active_interface_tick < COMM_INTERFACE_LEASE_MS)
+      return false;
+    LOG_SWV("#ORG#Interface %d takes over from %d\n",
+            rx_packet->interface,
+            comm_status.active_interface);
+  }
+  comm_status.active_interface = rx_packet->interface;
+  comm_status.active_interface_tick = uwTick;
+  return true;
+}
+
+/**
+ * @brief Serializes the value big-endian in the first 4 bytes of the buffer
+ */
+static void comm_write_be32(uint8_t *buffer, uint32_t value) {
+  buffer[0] = (value >> 24) & 0xFF;
+  buffer[1] = (value >> 16) & 0xFF;
+  buffer[2] = (value >> 8) & 0xFF;
+  buffer[3] = value & 0xFF;
+}
+
+/**
+ * @details Packet type: PKT_TYPE_STATS_REQ <br/>
+ * Respond with the transport counters (see comm_stats_t) serialized big-endian
+ * in the raw section of a PKT_TYPE_STATS_ACK packet. A non-zero byte in the
+ * request payload resets the counters after reporting, to start a new session.
+ */
+static comm_error_code_t comm_process_stats_packet(const packet_t *rx_packet) {
+  if (rx_packet->header.chunk_number != 1)
+    return INVALID_CHUNK_NO;
+  if (rx_packet->header.total_chunks != 1)
+    return INVALID_CHUNK_COUNT;
+  if (rx_packet->header.payload_length != 1)
+    return INVALID_PAYLOAD_LENGTH;
+
+  comm_stats_track_state();
+  uint8_t payload[COMM_MAX_PAYLOAD_SIZE] = {0};
+  uint8_t offset = COMM_SZ_RESERVED_SPACE;
+  const uint32_t values[] = {comm_stats.packets_in,
+                             comm_stats.packets_out,
+                             comm_stats.bytes_in,
+                             comm_stats.bytes_out,
+                             comm_stats.duplicate_chunks,
+                             comm_stats.out_of_order_chunks,
+                             comm_stats.error_packets,
+                             comm_stats.receiving_time,
+                             comm_stats.executing_time,
+                             // since boot, not cleared by the reset below
+                             comm_rx_overruns()};
+  for (uint8_t i = 0; i < sizeof(values) / sizeof(values[0]); i++) {
+    comm_write_be32(payload + offset, values[i]);
+    offset += sizeof(uint32_t);
+  }
+  // proto length is 0; raw length follows
+  payload[3] = offset - COMM_SZ_RESERVED_SPACE;
+  comm_write_packet(1,
+                    1,
+                    rx_packet->header.sequence_no,
+                    PKT_TYPE_STATS_ACK,
+                    offset,
+                    payload,
+                    rx_packet->interface);
+
+  if (0 != rx_packet->payload[0]) {
+    const uint32_t primask = comm_stats_lock();
+    memzero(&comm_stats, sizeof(comm_stats));
+    comm_stats.tracked_state = comm_status.curr_cmd_state;
+    comm_stats.tracked_since = uwTick;
+    comm_stats_unlock(primask);
+  }
+  return NO_ERROR;
+}
+
+/**
+ * @details Packet type: PKT_TYPE_TRACE_REQ <br/>
+ * Respond with a page of the flow status trace of the running or the last app
+ * flow (see flow_trace_t) in the raw section of a PKT_TYPE_TRACE_ACK packet:
+ * app id and duration (4 bytes each), active flag, entry count, dropped count
+ * and the index of the first entry of the page, followed by up to
+ * COMM_TRACE_PAGE_ENTRIES entries of flow status (2 bytes) and time (4 bytes),
+ * all big-endian. The request payload holds the index of the first entry.
+ */
+static comm_error_code_t comm_process_trace_packet(const packet_t *rx_packet) {
+  if (rx_packet->header.chunk_number != 1)
+    return INVALID_CHUNK_NO;
+  if (rx_packet->header.total_chunks != 1)
+    return INVALID_CHUNK_COUNT;
+  if (rx_packet->header.payload_length != 1)
+    return INVALID_PAYLOAD_LENGTH;
+
+  const flow_trace_t *trace = flow_trace_get();
+  uint8_t payload[COMM_MAX_PAYLOAD_SIZE] = {0};
+  uint8_t offset = COMM_SZ_RESERVED_SPACE;
+  const uint8_t first = CY_MIN(rx_packet->payload[0], trace->count);
+  const uint8_t last = CY_MIN(first + COMM_TRACE_PAGE_ENTRIES, trace->count);
+
+  comm_write_be32(payload + offset, trace->app_id);
+  offset += sizeof(uint32_t);
+  comm_write_be32(payload + offset, trace->duration);
+  offset += sizeof(uint32_t);
+  payload[offset++] = trace->active;
+  payload[offset++] = trace->count;
+  payload[offset++] = trace->dropped;
+  payload[offset++] = first;
+  for (uint8_t i = first; i < last; i++) {
+    payload[offset++] = trace->entries[i].flow_status >> 8;
+    payload[offset++] = trace->entries[i].flow_status & 0xFF;
+    comm_write_be32(payload + offset, trace->entries[i].at);
+    offset += sizeof(uint32_t);
+  }
+  // proto length is 0; raw length follows
+  payload[3] = offset - COMM_SZ_RESERVED_SPACE;
+  comm_write_packet(1,
+                    1,
+                    rx_packet->header.sequence_no,
+                    PKT_TYPE_TRACE_ACK,
+                    offset,
+                    payload,
+                    rx_packet->interface);
+  return NO_ERROR;
+}
+
+/**
+ * @details Packet type: PKT_TYPE_EVENTS_REQ <br/>
+ * Respond with entries of the trace ring (see trace_entry_t) in the raw
+ * section of a PKT_TYPE_EVENTS_ACK packet: the head of the ring and the
+ * sequence number of the first entry sent (4 bytes each), followed by up to
+ * COMM_EVENTS_PAGE_ENTRIES entries of id (2 bytes), timestamp and argument
+ * (4 bytes each), all big-endian. The request payload holds the sequence
+ * number (4 bytes) to read from; entries already overwritten are skipped.
+ */
+static comm_error_code_t comm_process_events_packet(const packet_t *rx_packet) {
+  if (rx_packet->header.chunk_number != 1)
+    return INVALID_CHUNK_NO;
+  if (rx_packet->header.total_chunks != 1)
+    return INVALID_CHUNK_COUNT;
+  if (rx_packet->header.payload_length != sizeof(uint32_t))
+    return INVALID_PAYLOAD_LENGTH;
+
+  uint8_t payload[COMM_MAX_PAYLOAD_SIZE] = {0};
+  uint8_t offset = COMM_SZ_RESERVED_SPACE;
+  const uint32_t head = trace_ring_head();
+  const uint32_t oldest =
+      head > TRACE_RING_ENTRIES ? head - TRACE_RING_ENTRIES : 0;
+  uint32_t seq = U32_READ_BE_ARRAY(rx_packet->payload);
+  if (seq - oldest > head - oldest)
+    seq = oldest;
+
+  comm_write_be32(payload + offset, head);
+  offset += sizeof(uint32_t);
+  comm_write_be32(payload + offset, seq);
+  offset += sizeof(uint32_t);
+  trace_entry_t entry;
+  for (uint8_t i = 0;
+       i < COMM_EVENTS_PAGE_ENTRIES && trace_ring_read(seq + i, &entry);
+       i++) {
+    payload[offset++] = entry.id >> 8;
+    payload[offset++] = entry.id & 0xFF;
+    comm_write_be32(payload + offset, entry.timestamp);
+    offset += sizeof(uint32_t);
+    comm_write_be32(payload + offset, entry.arg);
+    offset += sizeof(uint32_t);
+  }
+  // proto length is 0; raw length follows
+  payload[3] = offset - COMM_SZ_RESERVED_SPACE;
+  comm_write_packet(1,
+                    1,
+                    rx_packet->header.sequence_no,
+                    PKT_TYPE_EVENTS_ACK,
+                    offset,
+                    payload,
+                    rx_packet->interface);
+  return NO_ERROR;
+}
+
 /**
  * @details Packet type: PKT_TYPE_STATUS_REQ <br/>
  * Respond with the current status of the application. This request will not
@@ -315,13 +990,15 @@ static void send_status_packet(const packet_t *rx_packet) {
   payload[0] = 0x00;
   payload[1] = 0x00;    // proto length
   payload[2] = 0x00;
-  payload[3] = 0x00;    // dummy raw length
+  payload[3] = COMM_STATUS_RAW_SIZE;    // raw length (slot status, progress)
 
-  // reserve space for length of streams
-  core_status_t status = get_core_status();
-  pb_ostream_t stream =
-      pb_ostream_from_buffer(payload + COMM_SZ_RESERVED_SPACE,
-                             sizeof(payload) - COMM_SZ_RESERVED_SPACE);
+  // reserve space for length of streams and the raw data; the snapshot is
+  // consistent even when answered from the USB ISR
+  const core_status_snapshot_t snapshot = core_status_get_snapshot();
+  core_status_t status = snapshot.status;
+  pb_ostream_t stream = pb_ostream_from_buffer(
+      payload + COMM_SZ_RESERVED_SPACE,
+      sizeof(payload) - COMM_SZ_RESERVED_SPACE - COMM_STATUS_RAW_SIZE);
 
   // append the info native to comm module; the app-core cannot provide this
   status.current_cmd_seq = comm_status.curr_cmd_seq_no;
@@ -331,24 +1008,36 @@ static void send_status_packet(const packet_t *rx_packet) {
   ASSERT(pb_encode(&stream, &core_status_t_msg, &status));
   payload[0] = (stream.bytes_written >> 8) & 0xFF;
   payload[1] = (stream.bytes_written) & 0xFF;    // proto length
+  // raw data: index of live slot, state of the spare slot, then the progress
+  // of the flow as big-endian units done and total units, and its phase
+  uint8_t *raw = payload + COMM_SZ_RESERVED_SPACE + stream.bytes_written;
+  raw[0] = comm_status.live_slot;
+  raw[1] = comm_status.spare_cmd_state;
+  raw[2] = (snapshot.progress_done >> 8) & 0xFF;
+  raw[3] = snapshot.progress_done & 0xFF;
+  raw[4] = (snapshot.progress_total >> 8) & 0xFF;
+  raw[5] = snapshot.progress_total & 0xFF;
+  raw[6] = snapshot.progress_phase;
   comm_write_packet(1,
                     1,
                     0xFFFF,
                     PKT_TYPE_STATUS_ACK,
-                    stream.bytes_written + COMM_SZ_RESERVED_SPACE,
+                    stream.bytes_written + COMM_SZ_RESERVED_SPACE +
+                        COMM_STATUS_RAW_SIZE,
                     payload,
                     rx_packet->interface);
 }
 
-static void send_cmd_ack_packet(const packet_t *rx_packet) {
+static void send_cmd_ack_packet(const packet_t *rx_packet,
+                                const uint16_t chunk_no) {
   uint8_t payload[3 * sizeof(uint16_t)] = {0};
   uint8_t offset = 0;
   payload[offset++] = 0x00;
   payload[offset++] = 0x00;    // proto length
   payload[offset++] = 0x00;
   payload[offset++] = 0x02;    // raw length
-  payload[offset++] = (comm_status.curr_cmd_chunk_no >> 8) & 0xFF;
-  payload[offset++] = comm_status.curr_cmd_chunk_no & 0xFF;
+  payload[offset++] = (chunk_no >> 8) & 0xFF;
+  payload[offset++] = chunk_no & 0xFF;
   comm_write_packet(1,
                     1,
                     rx_packet->header.sequence_no,
@@ -358,26 +1047,64 @@ static void send_cmd_ack_packet(const packet_t *rx_packet) {
                     rx_packet->interface);
 }
 
-static void send_cmd_output_packet(const packet_t *rx_packet) {
-  comm_payload_t *comm_payload = get_comm_payload();
-  uint8_t *comm_io_buffer = get_io_buffer();
-  ASSERT(comm_payload->raw_data != NULL || comm_payload->proto_data != NULL);
+static void send_window_ack_packet(const packet_t *rx_packet) {
+  uint8_t payload[3 * sizeof(uint16_t)] = {0};
+  uint8_t offset = 0;
+  payload[offset++] = 0x00;
+  payload[offset++] = 0x00;    // proto length
+  payload[offset++] = 0x00;
+  payload[offset++] = 0x02;    // raw length
+  payload[offset++] = (comm_status.cmd_window_size >> 8) & 0xFF;
+  payload[offset++] = comm_status.cmd_window_size & 0xFF;
+  comm_write_packet(1,
+                    1,
+                    rx_packet->header.sequence_no,
+                    PKT_TYPE_CMD_WINDOW_ACK,
+                    offset,
+                    payload,
+                    rx_packet->interface);
+}
+
+static void send_jumbo_ack_packet(const packet_t *rx_packet,
+                                  const uint8_t transfers) {
+  uint8_t payload[2 * sizeof(uint16_t) + sizeof(uint8_t)] = {0};
+  uint8_t offset = 0;
+  payload[offset++] = 0x00;
+  payload[offset++] = 0x00;    // proto length
+  payload[offset++] = 0x00;
+  payload[offset++] = 0x01;    // raw length
+  payload[offset++] = transfers;
+  comm_write_packet(1,
+                    1,
+                    rx_packet->header.sequence_no,
+                    PKT_TYPE_JUMBO_ACK,
+                    offset,
+                    payload,
+                    rx_packet->interface);
+}
+
+static void send_cmd_output_packet(const packet_t *rx_packet,
+                                   const uint8_t slot) {
   uint16_t req_chunk_no = U16_READ_BE_ARRAY(
       rx_packet->payload +
       4);    // payload already verified in the caller function
-  uint16_t offset = (req_chunk_no - 1) * COMM_MAX_PAYLOAD_SIZE;
-  uint16_t remaining_payload_length =
-      comm_get_payload_size(comm_payload) - offset;
-  uint8_t payload_size =
-      CY_MIN(remaining_payload_length, COMM_MAX_PAYLOAD_SIZE);
-  comm_write_packet(
-      req_chunk_no,
-      ceil(comm_get_payload_size(comm_payload) * 1.0 / COMM_MAX_PAYLOAD_SIZE),
-      rx_packet->header.sequence_no,
-      PKT_TYPE_OUT_RESP,
-      payload_size,
-      comm_io_buffer + offset,
-      rx_packet->interface);
+  send_cmd_output_chunk(rx_packet, slot, req_chunk_no);
+}
+
+static void send_cmd_output_chunk(const packet_t *rx_packet,
+                                  const uint8_t slot,
+                                  const uint16_t req_chunk_no) {
+  comm_payload_t *comm_payload = get_comm_payload_slot(slot);
+  uint8_t *comm_io_buffer = get_io_buffer_slot(slot);
+  ASSERT(comm_payload->raw_data != NULL || comm_payload->proto_data != NULL);
+  const chunk_info_t *framing = &comm_payload->framing;
+  comm_write_packet(req_chunk_no,
+                    framing->total_chunks,
+                    rx_packet->header.sequence_no,
+                    PKT_TYPE_OUT_RESP,
+                    chunk_info_length(framing, req_chunk_no),
+                    comm_io_buffer + chunk_info_offset(framing, req_chunk_no),
+                    rx_packet->interface);
 }
 
 static void comm_write_packet(const uint16_t chunk_number,
@@ -387,9 +1114,10 @@ static void comm_write_packet(const uint16_t chunk_number,
                               const uint8_t payload_size,
                               const uint8_t *payload,
                               comm_libusb__interface_e interface) {
-  uint8_t buffer[COMM_PKT_MAX_LEN] = {0}, index = 4;
-  uint32_t crc = 0;
+  uint8_t buffer[COMM_PKT_MAX_LEN] = {0};
+  uint16_t crc = 0;
 
+  comm_tx_busy = true;
   buffer[COMM_HEADER_INDEX] = COMM_START_OF_HEADER;
   buffer[COMM_HEADER_INDEX + 1] = COMM_START_OF_HEADER;
   buffer[COMM_CHUNK_NO_INDEX] = (chunk_number >> 8) & 0xFF;
@@ -406,11 +1134,12 @@ static void comm_write_packet(const uint16_t chunk_number,
   buffer[COMM_PAYLOAD_LEN_INDEX] = payload_size;
 
   memcpy(buffer + COMM_PAYLOAD_INDEX, payload, payload_size);
-  while (index < payload_size + COMM_HEADER_SIZE) {
-    crc = update_crc16(crc, buffer[index++]);
-  }
-  crc = update_crc16(crc, 0);
-  crc = update_crc16(crc, 0);
+  const uint32_t primask = comm_stats_lock();
+  comm_stats.packets_out++;
+  comm_stats.bytes_out += payload_size;
+  comm_stats_unlock(primask);
+  crc = comm_crc16(buffer + COMM_CHUNK_NO_INDEX,
+                   payload_size + COMM_HEADER_SIZE - COMM_CHUNK_NO_INDEX);
   buffer[COMM_CHECKSUM_INDEX] = (crc >> 8) & 0xFF;
   buffer[COMM_CHECKSUM_INDEX + 1] = crc & 0xFF;
 #if USE_SIMULATOR == 1
@@ -418,11 +1147,30 @@ static void comm_write_packet(const uint16_t chunk_number,
 #else
   lusb_write(buffer, payload_size + COMM_HEADER_SIZE, interface);
 #endif
+  comm_tx_busy = false;
 }
 
 /*****************************************************************************
  * GLOBAL FUNCTIONS
  *****************************************************************************/
+
+bool comm_answer_status_request(const packet_t *rx_packet) {
+#if USE_SIMULATOR == 0
+  if (PKT_TYPE_STATUS_REQ != rx_packet->header.packet_type || comm_tx_busy) {
+    return false;
+  }
+  // an invalid request is queued so that its error is reported as before
+  if (NO_ERROR != comm_process_status_packet(rx_packet))
+    return false;
+  // status polls of a host waiting on the device renew its lease
+  if (comm_status.active_interface == rx_packet->interface)
+    comm_status.active_interface_tick = uwTick;
+  return true;
+#else
+  // the simulator receives on its own thread, not in an ISR
+  return false;
+#endif
+}
 void comm_reset_interface(void) {
   comm_status.active_interface = COMM_LIBUSB__UNDEFINED;
   return;
@@ -432,6 +1180,63 @@ comm_status_t *get_comm_status() {
   return &comm_status;
 }
 
+const comm_stats_t *get_comm_stats(void) {
+  return &comm_stats;
+}
+
+void comm_stats_track_state(void) {
+  if (comm_stats.tracked_state == comm_status.curr_cmd_state)
+    return;
+  const uint32_t elapsed = uwTick - comm_stats.tracked_since;
+  if (CMD_STATE_RECEIVING == comm_stats.tracked_state)
+    comm_stats.receiving_time += elapsed;
+  else if (CMD_STATE_EXECUTING == comm_stats.tracked_state)
+    comm_stats.executing_time += elapsed;
+  comm_stats.tracked_state = comm_status.curr_cmd_state;
+  comm_stats.tracked_since = uwTick;
+}
+
+bool comm_promote_spare_cmd(void) {
+  bool promoted = false;
+
+  if (comm_status.spare_cmd_state == CMD_STATE_RECEIVED &&
+      CY_Usb_Buffer_Free() &&
+      comm_status.curr_cmd_state != CMD_STATE_RECEIVING &&
+      comm_status.curr_cmd_state != CMD_STATE_RECEIVED &&
+      comm_status.curr_cmd_state != CMD_STATE_EXECUTING) {
+    const uint8_t prev_slot = comm_status.live_slot;
+    const uint16_t prev_seq_no = comm_status.curr_cmd_seq_no;
+    const uint8_t prev_state = comm_status.curr_cmd_state;
+
+    // Swap the roles of slots; the previous output remains in the spare slot
+    comm_status.live_slot = comm_spare_slot();
+    comm_status.curr_cmd_seq_no = comm_status.spare_cmd_seq_no;
+    comm_status.curr_cmd_chunk_no = comm_status.spare_cmd_chunk_no;
+    comm_status.curr_cmd_received_length =
+        comm_status.spare_cmd_received_length;
+    comm_status.curr_cmd_state = CMD_STATE_RECEIVED;
+
+    comm_reset_spare();
+    comm_status.spare_cmd_seq_no = prev_seq_no;
+    comm_status.spare_cmd_state = prev_state;
+    if (prev_state != CMD_STATE_DONE && prev_state != CMD_STATE_FAILED)
+      comm_set_slot_payload_struct(prev_slot, 0, 0);
+
+    uint8_t *comm_io_buffer = get_io_buffer();
+    comm_payload_t *comm_payload = get_comm_payload();
+    sys_flow_cntrl_u.bits.usb_buffer_free = false;
+    comm_set_payload_struct(
+        U16_READ_BE_ARRAY(comm_io_buffer),
+        U16_READ_BE_ARRAY(comm_io_buffer + sizeof(uint16_t)));
+    usb_set_event(comm_payload->proto_data_length,
+                  comm_payload->proto_data,
+                  comm_payload->raw_data_length,
+                  comm_payload->raw_data);
+    promoted = true;
+  }
+  return promoted;
+}
+
 void comm_process_packet(const packet_t *rx_packet) {
   static uint8_t temp_type = 0;
   if (temp_type != rx_packet->header.packet_type) {
@@ -439,6 +1244,10 @@ void comm_process_packet(const packet_t *rx_packet) {
     LOG_SWV("#GRN#Received packet: %d\n", rx_packet->header.packet_type);
   }
   comm_error_code_t proc_error = NO_ERROR;
+  comm_stats.packets_in++;
+  comm_stats.bytes_in += rx_packet->header.payload_length;
+  if (comm_status.active_interface == rx_packet->interface)
+    comm_status.active_interface_tick = uwTick;
 #if 0
     // TODO: Define meaning/use-case for timestamp on device's end
     if (comm_status.host_sync_time > rx_packet->header.timestamp) {
@@ -469,10 +1278,41 @@ void comm_process_packet(const packet_t *rx_packet) {
       proc_error = comm_process_abort_packet(rx_packet);
       break;
 
+    case PKT_TYPE_CMD_WINDOW_REQ:
+      proc_error = comm_process_window_packet(rx_packet);
+      break;
+
+    case PKT_TYPE_JUMBO_REQ:
+      proc_error = comm_process_jumbo_packet(rx_packet);
+      break;
+
+    case PKT_TYPE_RELEASE_REQ:
+      proc_error = comm_process_release_packet(rx_packet);
+      break;
+
+    case PKT_TYPE_OUT_BURST_REQ:
+      proc_error = comm_process_out_burst_packet(rx_packet);
+      break;
+
+    case PKT_TYPE_STATS_REQ:
+      proc_error = comm_process_stats_packet(rx_packet);
+      break;
+
+    case PKT_TYPE_TRACE_REQ:
+      proc_error = comm_process_trace_packet(rx_packet);
+      break;
+
+    case PKT_TYPE_EVENTS_REQ:
+      proc_error = comm_process_events_packet(rx_packet);
+      break;
+
     default:
       proc_error = INVALID_PACKET_TYPE;
       break;
   }
+  if (proc_error == OUT_OF_ORDER_CHUNK)
+    comm_stats.out_of_order_chunks++;
+  comm_stats_track_state();
   if (proc_error != NO_ERROR)
     send_error_packet(rx_packet, proc_error);
 }
@@ -480,6 +1320,7 @@ void comm_process_packet(const packet_t *rx_packet) {
 void send_error_packet(const packet_t *rx_packet,
                        const comm_error_code_t error_code) {
   LOG_SWV("#RED#Error: %d\r\n", error_code);
+  comm_stats.error_packets++;
   uint8_t payload[3 * sizeof(uint16_t)] = {0}, offset = 0;
   payload[offset++] = 0x00;
   payload[offset++] = 0x00;    // proto length
@@ -492,19 +1333,36 @@ void send_error_packet(const packet_t *rx_packet,
 }
 
 uint16_t update_crc16(const uint16_t crc_in, const uint8_t byte) {
-  uint32_t crc = crc_in;
-  uint32_t in = byte | 0x100;
-
-  do {
-    crc <<= 1;
-    in <<= 1;
-    if (in & 0x100)
-      ++crc;
-    if (crc & 0x10000)
-      crc ^= 0x1021;
-  }
-
-  while (!(in & 0x10000));
+  // Augmented form: shift the byte into the register and reduce the byte
+  // shifted out using the precomputed remainder. Two trailing zero bytes
+  // complete the CRC; see comm_crc16() for the direct form.
+  return (uint16_t)(crc16_table[crc_in >> 8] ^ (crc_in << 8) ^ byte);
+}
 
-  return crc & 0xffff;
+uint16_t comm_crc16(const uint8_t *data, uint16_t length) {
+#if USE_SIMULATOR == 0 && COMM_CRC_USE_HW == 1
+  // the USB ISR parser and the main loop share the peripheral; a CRC started
+  // by one must not be reset by the other midway
+  const uint32_t primask = __get_PRIMASK();
+  __disable_irq();
+  if (0 == (CRC->CR & CRC_CR_POLYSIZE_0)) {
+    __HAL_RCC_CRC_CLK_ENABLE();
+    CRC->INIT = 0;
+    CRC->POL = 0x1021;
+    CRC->CR = CRC_CR_POLYSIZE_0;    // 16-bit polynomial, no reversal
+  }
+  CRC->CR |= CRC_CR_RESET;
+  while (length--) {
+    *(__IO uint8_t *)&CRC->DR = *data++;
+  }
+  const uint16_t crc = (uint16_t)(CRC->DR & 0xFFFF);
+  __set_PRIMASK(primask);
+  return crc;
+#else
+  uint16_t crc = 0;
+  while (length--) {
+    crc = (uint16_t)(crc16_table[(crc >> 8) ^ *data++] ^ (crc << 8));
+  }
+  return crc;
+#endif
 }
@@ -65,6 +65,10 @@
 #if USE_SIMULATOR == 0
 #include "libusb.h"
 #endif
+#include "board.h"
+#include "events.h"
+#include "trace_ring.h"
+#include "usb_api.h"
 #include "usb_api_priv.h"
 #include "utils.h"
 
@@ -78,6 +82,24 @@
 
 #define COMM_V0_START_OF_HEADER 0xAA
 
+/// Packets queued between the USB ISR and the main loop, a power of 2. The
+/// host streams up to COMM_CMD_MAX_WINDOW cmd chunks before it waits for an
+/// ack, so a full window fits while the main loop catches up
+#ifndef COMM_RX_RING_SLOTS
+#define COMM_RX_RING_SLOTS 32
+#endif
+
+/// Bytes for the payloads of the queued packets, a power of 2. A full window
+/// of plain packets fits; jumbo frames fill it sooner and the ones which do
+/// not fit are dropped like any overrun, to be retried by the host
+#ifndef COMM_RX_PAYLOAD_BYTES
+#define COMM_RX_PAYLOAD_BYTES 2048
+#endif
+
+/// The host sends the USB transfers of a jumbo frame back-to-back; a frame
+/// not completed within this time is dropped as abandoned
+#define COMM_JUMBO_ASSEMBLY_TIMEOUT_MS 20
+
 /*****************************************************************************
  * PRIVATE TYPEDEFS
  *****************************************************************************/
@@ -103,6 +125,17 @@ typedef enum comm_parser_states {
   WAIT4_PKT_PROCESS,     ///< Wait for application to process the packet
 } comm_parser_states;
 
+/// A framed packet; its payload is copied to rx_payloads as the receive
+/// buffer is reused once the ISR returns
+typedef struct comm_rx_entry {
+  comm_header_t header;
+  comm_libusb__interface_e interface;
+  comm_error_code_t error;    ///< NO_ERROR or the framing error to report
+  uint16_t payload_offset;    ///< Offset of the payload in rx_payloads
+  uint8_t payload_size;       ///< Bytes of the payload copied, 0 if none
+  uint32_t payload_end;       ///< rx_payload_head after the payload
+} comm_rx_entry_t;
+
 /*****************************************************************************
  * STATIC VARIABLES
  *****************************************************************************/
@@ -152,6 +185,41 @@ static uint8_t SDK_RESP_PACKET[] = {
     0x90    // Checksum
 };
 
+/* Single producer (USB ISR) single consumer (main loop) ring. Each index is
+ * written by one side only and both run free; the release store of an index
+ * publishes the slot contents to the other side, so no interrupt masking is
+ * needed. The payloads go to a byte ring in the same way; a payload is kept
+ * contiguous and the consumer frees it up to the payload_end of its entry */
+static comm_rx_entry_t rx_ring[COMM_RX_RING_SLOTS];
+static uint32_t rx_ring_head = 0;
+static uint32_t rx_ring_tail = 0;
+static uint8_t rx_payloads[COMM_RX_PAYLOAD_BYTES];
+static uint32_t rx_payload_head = 0;
+static uint32_t rx_payload_tail = 0;
+/// Packets dropped as the ring was full, written by the ISR only
+static uint32_t rx_ring_overruns = 0;
+
+_Static_assert(0 == (COMM_RX_RING_SLOTS & (COMM_RX_RING_SLOTS - 1)),
+               "COMM_RX_RING_SLOTS must be a power of 2");
+_Static_assert(0 == (COMM_RX_PAYLOAD_BYTES & (COMM_RX_PAYLOAD_BYTES - 1)) &&
+                   COMM_JUMBO_MAX_PAYLOAD_SIZE <= COMM_RX_PAYLOAD_BYTES,
+               "COMM_RX_PAYLOAD_BYTES must be a power of 2 fitting a frame");
+_Static_assert(COMM_JUMBO_MAX_PAYLOAD_SIZE <= UINT8_MAX,
+               "Payload length of a jumbo frame must fit the header");
+
+/// Interface which negotiated jumbo frames and the USB transfers granted per
+/// frame; written by the main loop, read by the ISR
+static volatile comm_libusb__interface_e jumbo_interface =
+    COMM_LIBUSB__UNDEFINED;
+static volatile uint8_t jumbo_transfers = 1;
+/// Jumbo frame being assembled from consecutive USB transfers by the ISR
+static uint8_t jumbo_frame[COMM_JUMBO_PKT_MAX_LEN];
+static uint16_t jumbo_frame_length = 0;
+/// Length of the jumbo frame being assembled, 0 if none is in progress
+static uint16_t jumbo_frame_expected = 0;
+/// uwTick when the assembly of the jumbo frame started
+static uint32_t jumbo_frame_tick = 0;
+
 /*****************************************************************************
  * GLOBAL VARIABLES
  *****************************************************************************/
@@ -160,10 +228,161 @@ static uint8_t SDK_RESP_PACKET[] = {
  * STATIC FUNCTION PROTOTYPES
  *****************************************************************************/
 
+/**
+ * @brief Queues a framed packet for usb_process_rx_packets()
+ * @details Called from the USB ISR. The payload is copied to rx_payloads,
+ * taking only its own length. The packet is dropped (and counted) if the main
+ * loop has not caught up; the host recovers it through its retries as the
+ * packet is never acked.
+ *
+ * @param rx_packet Reference to the framed packet
+ * @param error NO_ERROR for a valid packet, else the error to report for it
+ */
+static void comm_rx_push(const packet_t *rx_packet, comm_error_code_t error);
+
+/**
+ * @brief Parses a complete packet directly from the receive buffer
+ * @details When the whole packet (header and payload) is available in the
+ * receive buffer, the header is decoded and the checksum is verified in place
+ * without going through the byte-wise state machine. rx_packet->payload
+ * references the receive buffer; comm_rx_push() copies it to rx_payloads
+ * before the buffer is reused.
+ *
+ * @param data Reference to the start of a probable packet
+ * @param length Number of bytes available from data
+ * @param rx_packet Reference to the packet to populate
+ *
+ * @return uint16_t Number of bytes consumed by the packet, 0 if the packet
+ * cannot be parsed in place (caller should fall back to the state machine).
+ */
+static uint16_t comm_parse_in_place(const uint8_t *data,
+                                    uint16_t length,
+                                    packet_t *rx_packet);
+
+/**
+ * @brief Starts the assembly of a jumbo frame
+ * @details A jumbo frame of the negotiated interface spans consecutive USB
+ * transfers with a single header. If data holds the start of one, the bytes
+ * are kept until comm_packet_parser() receives the rest of the frame.
+ *
+ * @param data Reference to the start of a probable packet
+ * @param length Number of bytes available from data
+ * @param interface Interface of the USB transfer
+ *
+ * @return true If the assembly of a jumbo frame started
+ * @return false If data does not hold the start of a jumbo frame
+ */
+static bool comm_jumbo_start(const uint8_t *data,
+                             uint16_t length,
+                             comm_libusb__interface_e interface);
+
 /*****************************************************************************
  * STATIC FUNCTIONS
  *****************************************************************************/
 
+static void comm_rx_push(const packet_t *rx_packet, comm_error_code_t error) {
+  const uint32_t head = rx_ring_head;
+  if (NO_ERROR == error &&
+      head == __atomic_load_n(&rx_ring_tail, __ATOMIC_ACQUIRE) &&
+      comm_answer_status_request(rx_packet)) {
+    return;
+  }
+
+  const uint8_t size =
+      (NULL == rx_packet->payload)
+          ? 0
+          : CY_MIN(rx_packet->header.payload_length,
+                   COMM_JUMBO_MAX_PAYLOAD_SIZE);
+  uint32_t start = rx_payload_head;
+  const uint32_t room =
+      COMM_RX_PAYLOAD_BYTES - (start & (COMM_RX_PAYLOAD_BYTES - 1));
+  if (room < size) {
+    // skip the end of the byte ring to keep the payload contiguous
+    start += room;
+  }
+
+  if (COMM_RX_RING_SLOTS ==
+          head - __atomic_load_n(&rx_ring_tail, __ATOMIC_ACQUIRE) ||
+      COMM_RX_PAYLOAD_BYTES <
+          start + size -
+              __atomic_load_n(&rx_payload_tail, __ATOMIC_ACQUIRE)) {
+    rx_ring_overruns++;
+    trace_event(TRACE_USB_RX_OVERRUN, rx_ring_overruns);
+    return;
+  }
+
+  comm_rx_entry_t *entry = &rx_ring[head & (COMM_RX_RING_SLOTS - 1)];
+  entry->header = rx_packet->header;
+  entry->interface = rx_packet->interface;
+  entry->error = error;
+  entry->payload_offset = start & (COMM_RX_PAYLOAD_BYTES - 1);
+  entry->payload_size = size;
+  entry->payload_end = start + size;
+  if (0 < size) {
+    memcpy(rx_payloads + entry->payload_offset, rx_packet->payload, size);
+  }
+  rx_payload_head = entry->payload_end;
+  __atomic_store_n(&rx_ring_head, head + 1, __ATOMIC_RELEASE);
+  trace_event(TRACE_USB_RX_PACKET,
+              (uint32_t)rx_packet->header.sequence_no << 16 |
+                  rx_packet->header.packet_type << 8 | (error & 0xFF));
+  events_signal_wakeup();
+}
+
+static uint16_t comm_parse_in_place(const uint8_t *data,
+                                    const uint16_t length,
+                                    packet_t *rx_packet) {
+  if (length < COMM_HEADER_SIZE ||
+      data[COMM_HEADER_INDEX] != COMM_START_OF_HEADER ||
+      data[COMM_HEADER_INDEX + 1] != COMM_START_OF_HEADER)
+    return 0;
+
+  const uint8_t payload_length = data[COMM_PAYLOAD_LEN_INDEX];
+  if (payload_length > comm_rx_max_payload(rx_packet->interface) ||
+      length < COMM_HEADER_SIZE + payload_length)
+    return 0;
+
+  comm_header_t *header = &rx_packet->header;
+  header->start_of_header = U16_READ_BE_ARRAY(data + COMM_HEADER_INDEX);
+  header->checksum = U16_READ_BE_ARRAY(data + COMM_CHECKSUM_INDEX);
+  header->chunk_number = U16_READ_BE_ARRAY(data + COMM_CHUNK_NO_INDEX);
+  header->total_chunks = U16_READ_BE_ARRAY(data + COMM_CHUNK_COUNT_INDEX);
+  header->sequence_no = U16_READ_BE_ARRAY(data + COMM_SEQ_NO_INDEX);
+  header->packet_type = data[COMM_PKT_TYPE_INDEX];
+  header->timestamp = U32_READ_BE_ARRAY(data + COMM_TIMESTAMP_INDEX);
+  header->payload_length = payload_length;
+  rx_packet->payload = payload_length ? data + COMM_PAYLOAD_INDEX : NULL;
+
+  if (comm_crc16(data + COMM_CHUNK_NO_INDEX,
+                 COMM_HEADER_SIZE + payload_length - COMM_CHUNK_NO_INDEX) ==
+      header->checksum) {
+    comm_rx_push(rx_packet, NO_ERROR);
+  } else {
+    comm_rx_push(rx_packet, CHECKSUM_ERROR);
+  }
+  return COMM_HEADER_SIZE + payload_length;
+}
+
+static bool comm_jumbo_start(const uint8_t *data,
+                             const uint16_t length,
+                             comm_libusb__interface_e interface) {
+  if (interface != jumbo_interface || length < COMM_HEADER_SIZE ||
+      data[COMM_HEADER_INDEX] != COMM_START_OF_HEADER ||
+      data[COMM_HEADER_INDEX + 1] != COMM_START_OF_HEADER)
+    return false;
+
+  const uint16_t frame_length = COMM_HEADER_SIZE + data[COMM_PAYLOAD_LEN_INDEX];
+  if (data[COMM_PAYLOAD_LEN_INDEX] > comm_rx_max_payload(interface) ||
+      frame_length <= length)
+    return false;
+
+  memcpy(jumbo_frame, data, length);
+  jumbo_frame_length = length;
+  jumbo_frame_expected = frame_length;
+  jumbo_frame_tick = uwTick;
+  return true;
+}
+
 /*****************************************************************************
  * GLOBAL FUNCTIONS
  *****************************************************************************/
@@ -174,19 +393,49 @@ void comm_packet_parser(const uint8_t *data,
   static comm_parser_states state = WAIT4_SOH1;
   static packet_t rx_packet = {0};
   static uint8_t payload_size = 0;
-  static uint32_t packet_crc = 0;
+  static uint16_t crc_start = 0;
+  int start = 0;
+
+  rx_packet.interface = interface;
 
-  if (memcmp(data, SDK_REQ_PACKET, CY_MIN(sizeof(SDK_REQ_PACKET), length)) == 0)
+  if (0 < jumbo_frame_expected &&
+      COMM_JUMBO_ASSEMBLY_TIMEOUT_MS < uwTick - jumbo_frame_tick)
+    jumbo_frame_expected = 0;
+
+  if (0 < jumbo_frame_expected && interface == jumbo_interface) {
+    // Continuation of a jumbo frame; the frame is checked as a whole
+    start = CY_MIN(length, jumbo_frame_expected - jumbo_frame_length);
+    memcpy(jumbo_frame + jumbo_frame_length, data, start);
+    jumbo_frame_length += start;
+    if (jumbo_frame_length < jumbo_frame_expected)
+      return;
+    jumbo_frame_expected = 0;
+    comm_parse_in_place(jumbo_frame, jumbo_frame_length, &rx_packet);
+    memzero(&rx_packet, sizeof(rx_packet));
+    rx_packet.interface = interface;
+  } else if (memcmp(data,
+                    SDK_REQ_PACKET,
+                    CY_MIN(sizeof(SDK_REQ_PACKET), length)) == 0) {
 #if USE_SIMULATOR == 1
     return SIM_Transmit_FS(SDK_RESP_PACKET, sizeof(SDK_RESP_PACKET));
 #else
     return lusb_write(SDK_RESP_PACKET, sizeof(SDK_RESP_PACKET), interface);
 #endif
+  }
 
-  rx_packet.interface = interface;
-
-  for (int i = 0; i < length; i++) {
+  for (int i = start; i < length; i++) {
     uint8_t byte = data[i];
+    if (state == WAIT4_SOH1) {
+      uint16_t consumed = comm_parse_in_place(&data[i], length - i, &rx_packet);
+      if (0 < consumed) {
+        memzero(&rx_packet, sizeof(rx_packet));
+        rx_packet.interface = interface;
+        i += consumed - 1;
+        continue;
+      }
+      if (comm_jumbo_start(&data[i], length - i, interface))
+        return;
+    }
     switch (state) {
       case WAIT4_SOH1:
         payload_size = 0;
@@ -211,7 +460,8 @@ void comm_packet_parser(const uint8_t *data,
         state = WAIT4_CHUNK_NO1;
         break;
       case WAIT4_CHUNK_NO1:
-        packet_crc = 0;
+        // checksum covers everything from chunk number till end of payload
+        crc_start = i;
         rx_packet.header.chunk_number = byte;
         state = WAIT4_CHUNK_NO2;
         break;
@@ -263,7 +513,7 @@ void comm_packet_parser(const uint8_t *data,
         rx_packet.header.payload_length = byte;
         rx_packet.payload = payload_size ? &data[i + 1] : NULL;
         state = payload_size ? WAIT4_PAYLOAD : WAIT4_PKT_PROCESS;
-        if (byte > COMM_MAX_PAYLOAD_SIZE) {
+        if (byte > comm_rx_max_payload(interface)) {
           state = WAIT4_SOH1;
         }
         break;
@@ -275,16 +525,13 @@ void comm_packet_parser(const uint8_t *data,
         state = WAIT4_SOH1;
         break;
     }
-    packet_crc = update_crc16(packet_crc, byte);
     if (state == WAIT4_PKT_PROCESS) {
-      packet_crc = update_crc16(packet_crc, 0);
-      packet_crc = update_crc16(packet_crc, 0);
-      packet_crc &= 0xFFFF;
-      if (packet_crc == rx_packet.header.checksum) {
-        comm_process_packet(&rx_packet);
+      if (comm_crc16(&data[crc_start], i - crc_start + 1) ==
+          rx_packet.header.checksum) {
+        comm_rx_push(&rx_packet, NO_ERROR);
         memzero(&rx_packet, sizeof(rx_packet));
       } else {
-        send_error_packet(&rx_packet, CHECKSUM_ERROR);
+        comm_rx_push(&rx_packet, CHECKSUM_ERROR);
         memzero(&rx_packet, sizeof(rx_packet));
       }
       state = WAIT4_SOH1;
@@ -292,7 +539,50 @@ void comm_packet_parser(const uint8_t *data,
   }
   if (state != WAIT4_SOH1) {
     state = WAIT4_SOH1;
-    send_error_packet(&rx_packet, INCOMPLETE_PACKET);
+    // the payload is partial; only the header goes with the error
+    rx_packet.payload = NULL;
+    comm_rx_push(&rx_packet, INCOMPLETE_PACKET);
     memzero(&rx_packet, sizeof(rx_packet));
   }
 }
+
+void usb_process_rx_packets(void) {
+  uint32_t tail = rx_ring_tail;
+
+  while (tail != __atomic_load_n(&rx_ring_head, __ATOMIC_ACQUIRE)) {
+    // the slot stays with the consumer until the tail moves past it
+    const comm_rx_entry_t *entry = &rx_ring[tail & (COMM_RX_RING_SLOTS - 1)];
+    const packet_t rx_packet = {
+        .header = entry->header,
+        .payload = (0 < entry->payload_size)
+                       ? rx_payloads + entry->payload_offset
+                       : NULL,
+        .interface = entry->interface};
+
+    if (NO_ERROR == entry->error) {
+      comm_process_packet(&rx_packet);
+    } else {
+      send_error_packet(&rx_packet, entry->error);
+    }
+    __atomic_store_n(&rx_payload_tail, entry->payload_end, __ATOMIC_RELEASE);
+    tail++;
+    __atomic_store_n(&rx_ring_tail, tail, __ATOMIC_RELEASE);
+  }
+}
+
+uint32_t comm_rx_overruns(void) {
+  return __atomic_load_n(&rx_ring_overruns, __ATOMIC_RELAXED);
+}
+
+uint8_t comm_rx_set_jumbo(comm_libusb__interface_e interface,
+                          uint8_t transfers) {
+  jumbo_transfers = CY_MAX(1, CY_MIN(transfers, COMM_JUMBO_MAX_TRANSFERS));
+  jumbo_interface = interface;
+  return jumbo_transfers;
+}
+
+uint8_t comm_rx_max_payload(comm_libusb__interface_e interface) {
+  if (interface != jumbo_interface)
+    return COMM_MAX_PAYLOAD_SIZE;
+  return jumbo_transfers * COMM_PKT_MAX_LEN - COMM_HEADER_SIZE;
+}
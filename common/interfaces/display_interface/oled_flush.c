@@ -0,0 +1,264 @@
+/**
+ * @file    oled_flush.c
+ * @author  Cypherock X1 Team
+ * @brief   LVGL flush path for the 1-bpp page addressed OLED controller
+ * @copyright Copyright (c) 2023 HODL TECH PTE LTD
+ * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
+ *target=_blank>https://mitcc.org/</a>
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * (c) Copyright 2023 by HODL TECH PTE LTD
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * "Commons Clause" License Condition v1.0
+ *
+ * The Software is provided to you by the Licensor under the License,
+ * as defined below, subject to the following condition.
+ *
+ * Without limiting other conditions in the License, the grant of
+ * rights under the License will not include, and the License does not
+ * grant to you, the right to Sell the Software.
+ *
+ * For purposes of the foregoing, "Sell" means practicing any or all
+ * of the rights granted to you under the License to provide to third
+ * parties, for a fee or other consideration (including without
+ * limitation fees for hosting or consulting/ support services related
+ * to the Software), a product or service whose value derives, entirely
+ * or substantially, from the functionality of the Software. Any license
+ * notice or attribution required by the License must also include
+ * this Commons Clause License Condition notice.
+ *
+ * Software: All X1Wallet associated files.
+ * License: MIT
+ * Licensor: HODL TECH PTE LTD
+ *
+ ******************************************************************************
+ */
+
+/*****************************************************************************
+ * INCLUDES
+ *****************************************************************************/
+#include "oled_flush.h"
+
+#include <stdbool.h>
+#include <string.h>
+
+#include "assert_conf.h"
+#include "utils.h"
+
+/*****************************************************************************
+ * EXTERN VARIABLES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * PRIVATE MACROS AND DEFINES
+ *****************************************************************************/
+/// Transfer buffers, one being sent while LVGL's next area is packed in other
+#define OLED_XFER_BUFFERS 2
+#define OLED_XFER_NONE (-1)
+
+/// Low bit of each of the 8 bytes of a word
+#define OLED_BYTE_LSBS 0x0101010101010101ULL
+
+_Static_assert(1 == LV_COLOR_DEPTH && 1 == sizeof(lv_color_t),
+               "The OLED flush expects one byte per 1-bpp pixel");
+_Static_assert(0 == LV_VER_RES_MAX % OLED_PAGE_HEIGHT,
+               "Vertical resolution must be a multiple of the page height");
+
+/*****************************************************************************
+ * PRIVATE TYPEDEFS
+ *****************************************************************************/
+
+/*****************************************************************************
+ * STATIC FUNCTION PROTOTYPES
+ *****************************************************************************/
+
+/**
+ * @brief Packs up to 8 consecutive pixels of a row into the bits of a byte
+ *
+ * @param pixels Reference to the first pixel
+ * @param count Number of pixels to pack, 1 to 8
+ *
+ * @return uint8_t Pixel i in bit i
+ */
+static inline uint8_t pack_row8(const lv_color_t *pixels, uint8_t count);
+
+/**
+ * @brief Transposes the 8x8 bit matrix held in a word
+ * @details On input byte k holds row k with column j in bit j; on output byte
+ * j holds column j with row k in bit k.
+ */
+static inline uint64_t transpose8x8(uint64_t matrix);
+
+/**
+ * @brief Widens the area to whole pages of the controller
+ */
+static void oled_rounder(lv_disp_drv_t *disp_drv, lv_area_t *area);
+
+/**
+ * @brief Packs the area into a free transfer buffer and queues it
+ */
+static void oled_flush(lv_disp_drv_t *disp_drv,
+                       const lv_area_t *area,
+                       lv_color_t *color_p);
+
+/**
+ * @brief Starts the queued transfer, if any, unless one is in flight
+ * @details Called from both the flush and the DMA completion; the queued slot
+ * is claimed with an atomic exchange so that only one of them starts it.
+ */
+static void oled_start_queued(void);
+
+/*****************************************************************************
+ * STATIC VARIABLES
+ *****************************************************************************/
+static oled_write_async_t oled_write_async = NULL;
+
+static uint8_t xfer_data[OLED_XFER_BUFFERS][OLED_FRAME_SIZE];
+static oled_window_t xfer_window[OLED_XFER_BUFFERS];
+static uint16_t xfer_len[OLED_XFER_BUFFERS];
+/// Set while the buffer is queued or being sent, cleared by the completion
+static volatile bool xfer_busy[OLED_XFER_BUFFERS];
+static int8_t xfer_active = OLED_XFER_NONE;
+static int8_t xfer_queued = OLED_XFER_NONE;
+/// Buffer the next flush packs into, used by the flush only
+static uint8_t xfer_next = 0;
+
+/*****************************************************************************
+ * GLOBAL VARIABLES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * STATIC FUNCTIONS
+ *****************************************************************************/
+static inline uint8_t pack_row8(const lv_color_t *pixels, uint8_t count) {
+  uint64_t word = 0;
+  memcpy(&word, pixels, count);
+  // each pixel byte is 0 or 1; the multiply gathers byte i's bit into bit 56+i
+  word &= OLED_BYTE_LSBS;
+  return (uint8_t)((word * 0x0102040810204080ULL) >> 56);
+}
+
+static inline uint64_t transpose8x8(uint64_t matrix) {
+  uint64_t t;
+  t = (matrix ^ (matrix >> 7)) & 0x00AA00AA00AA00AAULL;
+  matrix ^= t ^ (t << 7);
+  t = (matrix ^ (matrix >> 14)) & 0x0000CCCC0000CCCCULL;
+  matrix ^= t ^ (t << 14);
+  t = (matrix ^ (matrix >> 28)) & 0x00000000F0F0F0F0ULL;
+  matrix ^= t ^ (t << 28);
+  return matrix;
+}
+
+static void oled_rounder(lv_disp_drv_t *disp_drv, lv_area_t *area) {
+  (void)disp_drv;
+  area->y1 = area->y1 & ~(OLED_PAGE_HEIGHT - 1);
+  area->y2 = area->y2 | (OLED_PAGE_HEIGHT - 1);
+}
+
+static void oled_flush(lv_disp_drv_t *disp_drv,
+                       const lv_area_t *area,
+                       lv_color_t *color_p) {
+  const uint8_t slot = xfer_next;
+
+  // both buffers in use; the older transfer completes shortly over DMA
+  while (xfer_busy[slot]) {
+  }
+
+  oled_pack_pages(area, color_p, xfer_data[slot]);
+  xfer_window[slot] = (oled_window_t){
+      .col_start = area->x1,
+      .col_end = area->x2,
+      .page_start = area->y1 / OLED_PAGE_HEIGHT,
+      .page_end = area->y2 / OLED_PAGE_HEIGHT,
+  };
+  xfer_len[slot] = lv_area_get_size(area) / OLED_PAGE_HEIGHT;
+  xfer_busy[slot] = true;
+  xfer_next = (slot + 1) % OLED_XFER_BUFFERS;
+
+  __atomic_store_n(&xfer_queued, (int8_t)slot, __ATOMIC_SEQ_CST);
+  if (OLED_XFER_NONE == __atomic_load_n(&xfer_active, __ATOMIC_SEQ_CST)) {
+    oled_start_queued();
+  }
+
+  // the pixels are packed; LVGL may render the next area meanwhile
+  lv_disp_flush_ready(disp_drv);
+}
+
+static void oled_start_queued(void) {
+  const int8_t slot =
+      __atomic_exchange_n(&xfer_queued, OLED_XFER_NONE, __ATOMIC_SEQ_CST);
+  if (OLED_XFER_NONE == slot) {
+    return;
+  }
+
+  __atomic_store_n(&xfer_active, slot, __ATOMIC_SEQ_CST);
+  oled_write_async(&xfer_window[slot], xfer_data[slot], xfer_len[slot]);
+}
+
+/*****************************************************************************
+ * GLOBAL FUNCTIONS
+ *****************************************************************************/
+void oled_flush_init(lv_disp_drv_t *disp_drv, oled_write_async_t write_async) {
+  ASSERT(NULL != disp_drv && NULL != write_async);
+
+  oled_write_async = write_async;
+  disp_drv->rounder_cb = oled_rounder;
+  disp_drv->flush_cb = oled_flush;
+}
+
+void oled_flush_transfer_done(void) {
+  const int8_t slot =
+      __atomic_exchange_n(&xfer_active, OLED_XFER_NONE, __ATOMIC_SEQ_CST);
+  if (OLED_XFER_NONE == slot) {
+    return;
+  }
+
+  xfer_busy[slot] = false;
+  oled_start_queued();
+}
+
+void oled_pack_pages(const lv_area_t *area,
+                     const lv_color_t *color_p,
+                     uint8_t *pages) {
+  const lv_coord_t width = lv_area_get_width(area);
+
+  for (lv_coord_t y = area->y1; y <= area->y2; y += OLED_PAGE_HEIGHT) {
+    const lv_color_t *page = color_p + (y - area->y1) * width;
+
+    for (lv_coord_t x = 0; x < width; x += 8) {
+      const uint8_t count = CY_MIN(8, width - x);
+      uint64_t block = 0;
+
+      for (uint8_t row = 0; row < OLED_PAGE_HEIGHT; row++) {
+        block |= (uint64_t)pack_row8(page + row * width + x, count)
+                 << (8 * row);
+      }
+      block = transpose8x8(block);
+      // byte i of the little-endian word is column x + i
+      memcpy(pages, &block, count);
+      pages += count;
+    }
+  }
+}
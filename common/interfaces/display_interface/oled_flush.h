@@ -0,0 +1,102 @@
+/**
+ * @file    oled_flush.h
+ * @author  Cypherock X1 Team
+ * @brief   LVGL flush path for the 1-bpp page addressed OLED controller
+ * @copyright Copyright (c) 2023 HODL TECH PTE LTD
+ * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
+ * target=_blank>https://mitcc.org/</a>
+ */
+#ifndef OLED_FLUSH_H
+#define OLED_FLUSH_H
+
+/*****************************************************************************
+ * INCLUDES
+ *****************************************************************************/
+#include <stdint.h>
+
+#include "lvgl.h"
+
+/*****************************************************************************
+ * MACROS AND DEFINES
+ *****************************************************************************/
+/// Rows packed in a byte of the controller RAM (one page)
+#define OLED_PAGE_HEIGHT 8
+#define OLED_PAGES (LV_VER_RES_MAX / OLED_PAGE_HEIGHT)
+/// Bytes of the controller RAM, one byte per column of each page
+#define OLED_FRAME_SIZE (LV_HOR_RES_MAX * OLED_PAGES)
+
+/*****************************************************************************
+ * TYPEDEFS
+ *****************************************************************************/
+/**
+ * @brief Window of the controller RAM that a transfer writes, bounds inclusive
+ * @details Maps directly to the column address (0x21) and page address (0x22)
+ * commands of SSD1306 style controllers in horizontal addressing mode.
+ */
+typedef struct oled_window {
+  uint8_t col_start;
+  uint8_t col_end;
+  uint8_t page_start;
+  uint8_t page_end;
+} oled_window_t;
+
+/**
+ * @brief Starts writing the page bytes to the window of the controller
+ * @details Implemented by the board port over SPI/I2C DMA. It must return
+ * without waiting for the transfer and call oled_flush_transfer_done() (from
+ * the DMA completion interrupt) once the last byte is out. The data stays
+ * untouched until then.
+ *
+ * @param window Window to address before the data
+ * @param data Page bytes, page by page, column by column within a page
+ * @param len Number of bytes in data
+ */
+typedef void (*oled_write_async_t)(const oled_window_t *window,
+                                   const uint8_t *data,
+                                   uint16_t len);
+
+/*****************************************************************************
+ * EXPORTED VARIABLES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * GLOBAL FUNCTION PROTOTYPES
+ *****************************************************************************/
+
+/**
+ * @brief Installs the OLED flush path in the display driver
+ * @details Sets the rounder and flush callbacks of the driver. Call before
+ * lv_disp_drv_register(). LVGL only redraws the invalidated area, which the
+ * rounder widens to whole pages; that window alone is packed into one of two
+ * transfer buffers and handed to write_async. LVGL gets its draw buffer back
+ * as soon as it is packed, so the next area renders while the previous one is
+ * still being transferred.
+ *
+ * @param disp_drv Driver being initialized
+ * @param write_async Transfer routine of the board
+ */
+void oled_flush_init(lv_disp_drv_t *disp_drv, oled_write_async_t write_async);
+
+/**
+ * @brief Marks the transfer started through oled_write_async_t as complete
+ * @details Safe to call from interrupt context; starts the queued transfer if
+ * LVGL flushed another area meanwhile.
+ */
+void oled_flush_transfer_done(void);
+
+/**
+ * @brief Packs LVGL 1-bpp pixels into controller page bytes
+ * @details The area must start and end on page boundaries (as ensured by the
+ * rounder of oled_flush_init()). Every byte of the output holds 8 vertically
+ * adjacent pixels of a column, the top one in the least significant bit. The
+ * pixels are transposed 8x8 at a time inside a 64-bit word.
+ *
+ * @param area Area of the pixels, in screen coordinates
+ * @param color_p Pixels of the area, row by row
+ * @param pages Output of (width * height / 8) bytes
+ */
+void oled_pack_pages(const lv_area_t *area,
+                     const lv_color_t *color_p,
+                     uint8_t *pages);
+
+#endif /* OLED_FLUSH_H */
@@ -70,6 +70,115 @@ extern bool is_flash_ram_instance_loaded;
 extern bool is_flash_perm_instance_loaded;
 extern bool is_sec_flash_ram_instance_loaded;
 
+#if MAX_WALLETS_ALLOWED > 32
+#error "wallet_lut bitmaps hold at most 32 wallets"
+#endif
+
+/**
+ * @brief Index over flash_ram_instance.wallets so that lookups by name, id or
+ * rank do not scan and compare every wallet slot.
+ * @details Rebuilt whenever the RAM instance is loaded or erased (refer @ref
+ * flash_wallet_index_rebuild) and updated for a slot on every change to its
+ * state, name, id, card states or lock status.
+ */
+typedef struct {
+  uint32_t filled_map;    ///< bit i is set if wallets[i] is filled
+  uint32_t valid_map;     ///< bit i is set if wallets[i] is usable, refer @ref
+                          ///< get_valid_wallet_count
+  uint32_t name_hash[MAX_WALLETS_ALLOWED];
+  uint32_t id_hash[MAX_WALLETS_ALLOWED];
+} wallet_lut_t;
+
+static wallet_lut_t wallet_lut;
+
+/**
+ * @brief Summary of sec_flash_instance.keystore, read by the menus and by
+ * every card session to check the pairing without scanning the keystore.
+ * @details Rebuilt whenever the RAM instance is loaded (refer @ref
+ * flash_keystore_index_rebuild) and updated for an entry on every change to
+ * its used status.
+ */
+typedef struct {
+  uint8_t paired_map;    ///< bit i is set if keystore[i] may hold a pairing,
+                         ///< refer @ref get_paired_card_index
+  uint8_t used_count;    ///< entries with used status 1, refer @ref
+                         ///< get_keystore_used_count
+} keystore_lut_t;
+
+static keystore_lut_t keystore_lut;
+
+/**
+ * @brief FNV-1a hash of the data, used to skip slots which cannot match
+ */
+static uint32_t wallet_lut_hash(const uint8_t *data, size_t len) {
+  uint32_t hash = 0x811C9DC5;
+  for (size_t i = 0; i < len; i++) {
+    hash = (hash ^ data[i]) * 0x01000193;
+  }
+  return hash;
+}
+
+static uint32_t wallet_lut_name_hash(const char *name) {
+  return wallet_lut_hash((const uint8_t *)name, strnlen(name, NAME_SIZE));
+}
+
+/**
+ * @brief Refreshes the index entry of wallets[index] from the RAM instance
+ */
+static void wallet_lut_update(uint8_t index) {
+  ASSERT(index < MAX_WALLETS_ALLOWED);
+
+  const Flash_Wallet *fwallet = &flash_ram_instance.wallets[index];
+  const uint32_t bit = 1UL << index;
+
+  wallet_lut.filled_map &= ~bit;
+  wallet_lut.valid_map &= ~bit;
+  if (fwallet->state == UNVERIFIED_VALID_WALLET ||
+      fwallet->state == VALID_WALLET || fwallet->state == INVALID_WALLET ||
+      fwallet->state == VALID_WALLET_WITHOUT_DEVICE_SHARE) {
+    wallet_lut.filled_map |= bit;
+  }
+  if (fwallet->state == VALID_WALLET && fwallet->cards_states == 0x0f &&
+      fwallet->is_wallet_locked == 0) {
+    wallet_lut.valid_map |= bit;
+  }
+  wallet_lut.name_hash[index] =
+      wallet_lut_name_hash((const char *)fwallet->wallet_name);
+  wallet_lut.id_hash[index] =
+      wallet_lut_hash(fwallet->wallet_id, WALLET_ID_SIZE);
+}
+
+/**
+ * @brief Returns the index of the filled wallet with the given name
+ *
+ * @return int Index of the wallet, -1 if no filled wallet has the name
+ */
+static int wallet_lut_find_name(const char *name) {
+  const uint32_t hash = wallet_lut_name_hash(name);
+
+  for (uint32_t map = wallet_lut.filled_map; 0 != map; map &= map - 1) {
+    const uint8_t index = __builtin_ctz(map);
+    if (wallet_lut.name_hash[index] == hash &&
+        !strcmp((const char *)flash_ram_instance.wallets[index].wallet_name,
+                name)) {
+      return index;
+    }
+  }
+  return -1;
+}
+
+/**
+ * @brief Returns the position of the (i+1)th set bit of the map
+ *
+ * @return int Position of the bit, -1 if the map has i or less bits set
+ */
+static int wallet_lut_select(uint32_t map, uint8_t i) {
+  for (; 0 != map && 0 < i; i--) {
+    map &= map - 1;
+  }
+  return (0 == map) ? -1 : __builtin_ctz(map);
+}
+
 /**
  * @brief Return true if wallet[index] is filled
  *
@@ -83,15 +192,27 @@ extern bool is_sec_flash_ram_instance_loaded;
 static bool _wallet_is_filled(uint8_t index) {
   ASSERT(index < MAX_WALLETS_ALLOWED);
 
-  if (flash_ram_instance.wallets[index].state == UNVERIFIED_VALID_WALLET ||
-      flash_ram_instance.wallets[index].state == VALID_WALLET ||
-      flash_ram_instance.wallets[index].state == INVALID_WALLET ||
-      flash_ram_instance.wallets[index].state ==
-          VALID_WALLET_WITHOUT_DEVICE_SHARE) {
-    return true;
+  return 0 != (wallet_lut.filled_map & (1UL << index));
+}
+
+void flash_wallet_index_rebuild() {
+  for (uint8_t index = 0; index < MAX_WALLETS_ALLOWED; index++) {
+    wallet_lut_update(index);
   }
+}
 
-  return false;
+void flash_keystore_index_rebuild() {
+  keystore_lut.paired_map = 0;
+  keystore_lut.used_count = 0;
+  for (uint8_t index = 0; index < MAX_KEYSTORE_ENTRY; index++) {
+    const uint8_t used = sec_flash_instance.keystore[index].used;
+    if (used && used != DEFAULT_VALUE_IN_FLASH) {
+      keystore_lut.paired_map |= 1U << index;
+    }
+    if (used == 1) {
+      keystore_lut.used_count++;
+    }
+  }
 }
 
 bool wallet_is_filled(uint8_t index, wallet_state *state_output) {
@@ -161,22 +282,16 @@ int add_wallet_to_flash(const Flash_Wallet *fwallet, uint32_t *index_OUT) {
       fwallet->state != UNVERIFIED_VALID_WALLET &&
       fwallet->state != VALID_WALLET_WITHOUT_DEVICE_SHARE)
     return INVALID_ARGUMENT;
-  int first_empty_index = -1;
-  uint8_t walletIndex = 0;
-  for (; walletIndex < MAX_WALLETS_ALLOWED; walletIndex++) {
-    if (!_wallet_is_filled(walletIndex)) {
-      if (first_empty_index == -1)
-        first_empty_index = (int)walletIndex;
-    } else if (!strcmp((const char *)flash_ram_instance.wallets[walletIndex]
-                           .wallet_name,
-                       (const char *)fwallet->wallet_name)) {
-      return ALREADY_EXISTS;
-    }
-  }
+  if (0 <= wallet_lut_find_name((const char *)fwallet->wallet_name))
+    return ALREADY_EXISTS;
+  int first_empty_index = wallet_lut_select(~wallet_lut.filled_map, 0);
+  if (first_empty_index < 0 || first_empty_index >= MAX_WALLETS_ALLOWED)
+    return MEMORY_OVERFLOW;
   *index_OUT = first_empty_index;
   memcpy(
       &flash_ram_instance.wallets[*index_OUT], fwallet, sizeof(Flash_Wallet));
   flash_ram_instance.wallet_count++;
+  wallet_lut_update(*index_OUT);
   flash_struct_save();
   return SUCCESS_;
 }
@@ -195,18 +310,11 @@ int add_wallet_share_to_sec_flash(const Flash_Wallet *fwallet,
   if (fwallet->state == VALID_WALLET ||
       fwallet->state == UNVERIFIED_VALID_WALLET)
     return INVALID_ARGUMENT;
-  int first_empty_index = -1;
-  uint8_t walletIndex = 0;
-  for (; walletIndex < MAX_WALLETS_ALLOWED; walletIndex++) {
-    if (!_wallet_is_filled(walletIndex)) {
-      if (first_empty_index == -1)
-        first_empty_index = (int)walletIndex;
-    } else if (!strcmp((const char *)flash_ram_instance.wallets[walletIndex]
-                           .wallet_name,
-                       (const char *)fwallet->wallet_name)) {
-      return ALREADY_EXISTS;
-    }
-  }
+  if (0 <= wallet_lut_find_name((const char *)fwallet->wallet_name))
+    return ALREADY_EXISTS;
+  int first_empty_index = wallet_lut_select(~wallet_lut.filled_map, 0);
+  if (first_empty_index < 0 || first_empty_index >= MAX_WALLETS_ALLOWED)
+    return MEMORY_OVERFLOW;
   *index_OUT = first_empty_index;
   memcpy(sec_flash_instance.wallet_share_data[*index_OUT].wallet_id,
          fwallet->wallet_id,
@@ -238,20 +346,13 @@ int put_wallet_flash(const uint8_t index, const Flash_Wallet *wallet) {
   if (name_len == 0 || name_len >= NAME_SIZE)
     return INVALID_ARGUMENT;
 
-  uint8_t walletIndex = 0;
-  for (; walletIndex < MAX_WALLETS_ALLOWED; walletIndex++) {
-    if (walletIndex == index)
-      continue;
-    if (!_wallet_is_filled(walletIndex))
-      continue;
-    if (!strcmp(
-            (const char *)flash_ram_instance.wallets[walletIndex].wallet_name,
-            (const char *)wallet->wallet_name))
-      return ALREADY_EXISTS;
-  }
+  int existing_index = wallet_lut_find_name((const char *)wallet->wallet_name);
+  if (0 <= existing_index && index != existing_index)
+    return ALREADY_EXISTS;
   if (!_wallet_is_filled(index))    // it was not valid earlier but now is
     flash_ram_instance.wallet_count++;
   memcpy(&flash_ram_instance.wallets[index], wallet, sizeof(Flash_Wallet));
+  wallet_lut_update(index);
   flash_struct_save();
   return SUCCESS_;
 }
@@ -279,6 +380,7 @@ int put_wallet_share_sec_flash(const uint8_t index,
          PADDED_NONCE_SIZE);
   sec_flash_struct_save();
   flash_ram_instance.wallets[index].state = VALID_WALLET;
+  wallet_lut_update(index);
   flash_struct_save();
   return SUCCESS_;
 }
@@ -302,6 +404,7 @@ int delete_wallet_from_flash(const uint8_t wallet_index) {
   flash_ram_instance.wallets[wallet_index].state = DEFAULT_VALUE_IN_FLASH;
   flash_ram_instance.wallets[wallet_index].cards_states = 0;
   memset(flash_ram_instance.wallets[wallet_index].wallet_name, 0, NAME_SIZE);
+  wallet_lut_update(wallet_index);
   flash_struct_save();
   return SUCCESS_;
 }
@@ -358,18 +461,11 @@ int get_index_by_name(const char *name, uint8_t *index_OUT) {
   size_t name_len = strnlen(name, NAME_SIZE);
   if (name_len == 0 || name_len >= NAME_SIZE)
     return INVALID_ARGUMENT;
-  uint8_t walletIndex = 0;
-  for (; walletIndex < MAX_WALLETS_ALLOWED; walletIndex++) {
-    if (!_wallet_is_filled(walletIndex))
-      continue;
-    if (!strcmp(
-            (const char *)flash_ram_instance.wallets[walletIndex].wallet_name,
-            name)) {
-      *index_OUT = walletIndex;
-      return SUCCESS_;
-    }
-  }
-  return DOESNT_EXIST;
+  int walletIndex = wallet_lut_find_name(name);
+  if (walletIndex < 0)
+    return DOESNT_EXIST;
+  *index_OUT = walletIndex;
+  return SUCCESS_;
 }
 
 /**
@@ -385,11 +481,11 @@ int get_first_matching_index_by_id(const uint8_t wallet_id[WALLET_ID_SIZE],
   ASSERT(index_OUT != NULL);
 
   get_flash_ram_instance();    // to load
-  uint8_t walletIndex = 0;
-  for (; walletIndex < MAX_WALLETS_ALLOWED; walletIndex++) {
-    if (!_wallet_is_filled(walletIndex))
-      continue;
-    if (!memcmp(flash_ram_instance.wallets[walletIndex].wallet_id,
+  const uint32_t hash = wallet_lut_hash(wallet_id, WALLET_ID_SIZE);
+  for (uint32_t map = wallet_lut.filled_map; 0 != map; map &= map - 1) {
+    const uint8_t walletIndex = __builtin_ctz(map);
+    if (wallet_lut.id_hash[walletIndex] == hash &&
+        !memcmp(flash_ram_instance.wallets[walletIndex].wallet_id,
                 wallet_id,
                 WALLET_ID_SIZE)) {
       *index_OUT = walletIndex;
@@ -413,18 +509,11 @@ int get_ith_valid_wallet_index(const uint8_t i, uint8_t *index_OUT) {
   get_flash_ram_instance();    // to load
   if (i >= flash_ram_instance.wallet_count)
     return INVALID_ARGUMENT;
-  int valids = 0;
-  uint8_t walletIndex = 0;
-  for (; walletIndex < MAX_WALLETS_ALLOWED; walletIndex++) {
-    if (!_wallet_is_filled(walletIndex))
-      continue;
-    if (valids == i) {
-      *index_OUT = walletIndex;
-      return SUCCESS_;
-    }
-    valids++;
-  }
-  return INCONSISTENT_STATE;
+  int walletIndex = wallet_lut_select(wallet_lut.filled_map, i);
+  if (walletIndex < 0)
+    return INCONSISTENT_STATE;
+  *index_OUT = walletIndex;
+  return SUCCESS_;
 }
 
 int get_ith_wallet_to_export(const uint8_t i, uint8_t *index_OUT) {
@@ -479,18 +568,8 @@ int get_ith_wallet_without_share(const uint8_t i, uint8_t *index_OUT) {
  * @return int
  */
 int get_valid_wallet_count() {
-  const Flash_Struct *flash_wallet = get_flash_ram_instance();
-
-  uint8_t walletCount = 0;
-  uint8_t walletIndex = 0;
-
-  for (; walletIndex < MAX_WALLETS_ALLOWED; walletIndex++) {
-    if (flash_wallet->wallets[walletIndex].state == VALID_WALLET &&
-        flash_wallet->wallets[walletIndex].cards_states == 0x0f &&
-        flash_wallet->wallets[walletIndex].is_wallet_locked == 0)
-      walletCount++;
-  }
-  return walletCount;
+  get_flash_ram_instance();    // to load
+  return __builtin_popcount(wallet_lut.valid_map);
 }
 
 /**
@@ -509,18 +588,11 @@ int get_flash_wallet_by_name(const char *name,
   size_t name_len = strnlen(name, NAME_SIZE);
   if (name_len == 0 || name_len >= NAME_SIZE)
     return INVALID_ARGUMENT;
-  uint8_t walletIndex = 0;
-  for (; walletIndex < MAX_WALLETS_ALLOWED; walletIndex++) {
-    if (!_wallet_is_filled(walletIndex))
-      continue;
-    if (!strcmp(
-            (const char *)flash_ram_instance.wallets[walletIndex].wallet_name,
-            name)) {
-      *flash_wallet_OUT = &flash_ram_instance.wallets[walletIndex];
-      return SUCCESS_;
-    }
-  }
-  return DOESNT_EXIST;
+  int walletIndex = wallet_lut_find_name(name);
+  if (walletIndex < 0)
+    return DOESNT_EXIST;
+  *flash_wallet_OUT = &flash_ram_instance.wallets[walletIndex];
+  return SUCCESS_;
 }
 
 /**
@@ -535,31 +607,25 @@ int get_flash_wallet_share_by_name(const char *name, uint8_t *wallet_share) {
   size_t name_len = strnlen(name, NAME_SIZE);
   if (name_len == 0 || name_len >= NAME_SIZE)
     return INVALID_ARGUMENT;
-  uint8_t walletIndex = 0;
-  for (; walletIndex < MAX_WALLETS_ALLOWED; walletIndex++) {
-    if (!_wallet_is_filled(walletIndex))
-      continue;
-    if (!strcmp(
-            (const char *)flash_ram_instance.wallets[walletIndex].wallet_name,
-            name)) {
-      if (is_wallet_share_not_present(walletIndex))
-        return DOESNT_EXIST;
-      for (int i = 0; i < WALLET_ID_SIZE; i++) {
-        if (flash_ram_instance.wallets[walletIndex].wallet_id[i] !=
-            sec_flash_instance.wallet_share_data[walletIndex].wallet_id[i]) {
-          flash_ram_instance.wallets[walletIndex].state =
-              VALID_WALLET_WITHOUT_DEVICE_SHARE;
-          flash_struct_save();
-          return DOESNT_EXIST;
-        }
-      }
-      memcpy(wallet_share,
-             sec_flash_instance.wallet_share_data[walletIndex].wallet_share,
-             BLOCK_SIZE);
-      return SUCCESS_;
+  int walletIndex = wallet_lut_find_name(name);
+  if (walletIndex < 0)
+    return DOESNT_EXIST;
+  if (is_wallet_share_not_present(walletIndex))
+    return DOESNT_EXIST;
+  for (int i = 0; i < WALLET_ID_SIZE; i++) {
+    if (flash_ram_instance.wallets[walletIndex].wallet_id[i] !=
+        sec_flash_instance.wallet_share_data[walletIndex].wallet_id[i]) {
+      flash_ram_instance.wallets[walletIndex].state =
+          VALID_WALLET_WITHOUT_DEVICE_SHARE;
+      wallet_lut_update(walletIndex);
+      flash_struct_save();
+      return DOESNT_EXIST;
     }
   }
-  return DOESNT_EXIST;
+  memcpy(wallet_share,
+         sec_flash_instance.wallet_share_data[walletIndex].wallet_share,
+         BLOCK_SIZE);
+  return SUCCESS_;
 }
 
 int get_flash_wallet_nonce_by_name(const char *name, uint8_t *wallet_nonce) {
@@ -571,31 +637,25 @@ int get_flash_wallet_nonce_by_name(const char *name, uint8_t *wallet_nonce) {
   size_t name_len = strnlen(name, NAME_SIZE);
   if (name_len == 0 || name_len >= NAME_SIZE)
     return INVALID_ARGUMENT;
-  uint8_t walletIndex = 0;
-  for (; walletIndex < MAX_WALLETS_ALLOWED; walletIndex++) {
-    if (!_wallet_is_filled(walletIndex))
-      continue;
-    if (!strcmp(
-            (const char *)flash_ram_instance.wallets[walletIndex].wallet_name,
-            name)) {
-      if (is_wallet_share_not_present(walletIndex))
-        return DOESNT_EXIST;
-      for (int i = 0; i < WALLET_ID_SIZE; i++) {
-        if (flash_ram_instance.wallets[walletIndex].wallet_id[i] !=
-            sec_flash_instance.wallet_share_data[walletIndex].wallet_id[i]) {
-          flash_ram_instance.wallets[walletIndex].state =
-              VALID_WALLET_WITHOUT_DEVICE_SHARE;
-          flash_struct_save();
-          return DOESNT_EXIST;
-        }
-      }
-      memcpy(wallet_nonce,
-             sec_flash_instance.wallet_share_data[walletIndex].wallet_nonce,
-             BLOCK_SIZE);
-      return SUCCESS_;
+  int walletIndex = wallet_lut_find_name(name);
+  if (walletIndex < 0)
+    return DOESNT_EXIST;
+  if (is_wallet_share_not_present(walletIndex))
+    return DOESNT_EXIST;
+  for (int i = 0; i < WALLET_ID_SIZE; i++) {
+    if (flash_ram_instance.wallets[walletIndex].wallet_id[i] !=
+        sec_flash_instance.wallet_share_data[walletIndex].wallet_id[i]) {
+      flash_ram_instance.wallets[walletIndex].state =
+          VALID_WALLET_WITHOUT_DEVICE_SHARE;
+      wallet_lut_update(walletIndex);
+      flash_struct_save();
+      return DOESNT_EXIST;
     }
   }
-  return DOESNT_EXIST;
+  memcpy(wallet_nonce,
+         sec_flash_instance.wallet_share_data[walletIndex].wallet_nonce,
+         BLOCK_SIZE);
+  return SUCCESS_;
 }
 
 /**
@@ -654,6 +714,7 @@ int delete_from_kth_card_flash(const uint8_t index, const uint8_t card_number) {
   RESET_Ith_BIT(flash_ram_instance.wallets[index].cards_states,
                 card_number - 1 + 4);
 
+  wallet_lut_update(index);
   flash_struct_save();
   return SUCCESS_;
 }
@@ -707,6 +768,7 @@ int update_challenge_flash(const char *name,
   pow_get_approx_time_in_secs(target,
                               &flash_wallet->challenge.time_to_unlock_in_secs);
 
+  wallet_lut_update(flash_wallet - flash_ram_instance.wallets);
   flash_struct_save();
 
   return SUCCESS_;
@@ -725,6 +787,7 @@ int set_wallet_locked(const char *wallet_name, uint8_t encoded_card_number) {
   memzero(&(flash_wallet->challenge), sizeof(flash_wallet->challenge));
   flash_wallet->challenge.card_locked = encoded_card_number;
   memset(flash_wallet->challenge.nonce, 0xFF, POW_NONCE_SIZE);
+  wallet_lut_update(flash_wallet - flash_ram_instance.wallets);
   flash_struct_save();
   return SUCCESS;
 }
@@ -810,6 +873,7 @@ int update_wallet_locked_flash(const char *name, const bool is_wallet_locked) {
     memzero(&(flash_wallet->challenge), sizeof(flash_wallet->challenge));
   }
 
+  wallet_lut_update(flash_wallet - flash_ram_instance.wallets);
   flash_struct_save();
 
   return SUCCESS_;
@@ -829,7 +893,7 @@ int update_time_to_unlock_flash(const char *name,
 
   flash_wallet->challenge.time_to_unlock_in_secs = time_to_unlock_in_secs;
 
-  flash_struct_save();
+  flash_struct_save_later();
 
   return SUCCESS_;
 }
@@ -851,7 +915,7 @@ int save_nonce_flash(const char *name,
   memcpy(flash_wallet->challenge.nonce, nonce, POW_NONCE_SIZE);
   flash_wallet->challenge.time_to_unlock_in_secs = time_to_unlock_in_secs;
 
-  flash_struct_save();
+  flash_struct_save_challenge(flash_wallet);
 
   return SUCCESS_;
 }
@@ -869,11 +933,12 @@ int set_wallet_state(const uint8_t wallet_index, const wallet_state new_state) {
       new_state == INVALID_WALLET) {
     // new_state is valid and can be set
     flash_ram_instance.wallets[wallet_index].state = new_state;
+    wallet_lut_update(wallet_index);
   } else {
     return INVALID_ARGUMENT;
   }
 
-  flash_struct_save();
+  flash_struct_save_later();
 
   return SUCCESS_;
 }
@@ -884,6 +949,8 @@ int set_display_rotation(const display_rotation _rotation,
   flash_ram_instance.displayRotation = _rotation;
   if (save_mode == FLASH_SAVE_NOW)
     flash_struct_save();
+  else
+    flash_struct_save_later();
   return SUCCESS_;
 }
 
@@ -893,6 +960,42 @@ int set_enable_passphrase(const passphrase_config enable_passphrase,
   flash_ram_instance.enable_passphrase = enable_passphrase;
   if (save_mode == FLASH_SAVE_NOW)
     flash_struct_save();
+  else
+    flash_struct_save_later();
+  return SUCCESS_;
+}
+
+int set_review_mode(const review_mode_config review_mode,
+                    flash_save_mode save_mode) {
+  get_flash_ram_instance();
+  flash_ram_instance.review_mode = review_mode;
+  if (save_mode == FLASH_SAVE_NOW)
+    flash_struct_save();
+  else
+    flash_struct_save_later();
+  return SUCCESS_;
+}
+
+int set_pow_rate(const Flash_Pow_Rate *pow_rate, flash_save_mode save_mode) {
+  ASSERT(pow_rate != NULL);
+
+  get_flash_ram_instance();
+  memcpy(&flash_ram_instance.pow_rate, pow_rate, sizeof(Flash_Pow_Rate));
+  if (save_mode == FLASH_SAVE_NOW)
+    flash_struct_save();
+  else
+    flash_struct_save_later();
+  return SUCCESS_;
+}
+
+int set_xpub_cache(const xpub_cache_config xpub_cache,
+                   flash_save_mode save_mode) {
+  get_flash_ram_instance();
+  flash_ram_instance.xpub_cache = xpub_cache;
+  if (save_mode == FLASH_SAVE_NOW)
+    flash_struct_save();
+  else
+    flash_struct_save_later();
   return SUCCESS_;
 }
 
@@ -987,8 +1090,7 @@ int get_paired_card_index(const uint8_t *card_key_id) {
 
   get_sec_flash_ram_instance();
   for (int index = 0; index < MAX_KEYSTORE_ENTRY; index++) {
-    if (!sec_flash_instance.keystore[index].used ||
-        sec_flash_instance.keystore[index].used == DEFAULT_VALUE_IN_FLASH)
+    if (0 == (keystore_lut.paired_map & (1U << index)))
       continue;
     if (memcmp(card_key_id,
                sec_flash_instance.keystore[index].key_id,
@@ -1003,6 +1105,7 @@ void invalidate_keystore() {
   for (int index = 0; index < MAX_KEYSTORE_ENTRY; index++) {
     sec_flash_instance.keystore[index].used = 0;
   }
+  flash_keystore_index_rebuild();
   sec_flash_struct_save();
 }
 
@@ -1035,6 +1138,8 @@ int set_logging_config(log_config state, flash_save_mode save_mode) {
   flash_ram_instance.enable_log = state;
   if (save_mode == FLASH_SAVE_NOW)
     flash_struct_save();
+  else
+    flash_struct_save_later();
   return STM_SUCCESS;
 }
 
@@ -1098,6 +1203,21 @@ const passphrase_config get_enable_passphrase() {
   return flash_ram_instance.enable_passphrase;
 }
 
+const review_mode_config get_review_mode() {
+  get_flash_ram_instance();
+  return flash_ram_instance.review_mode;
+}
+
+const Flash_Pow_Rate *get_pow_rate() {
+  get_flash_ram_instance();
+  return &flash_ram_instance.pow_rate;
+}
+
+const xpub_cache_config get_xpub_cache() {
+  get_flash_ram_instance();
+  return flash_ram_instance.xpub_cache;
+}
+
 const wallet_state get_wallet_state(uint8_t wallet_index) {
   get_flash_ram_instance();
   return flash_ram_instance.wallets[wallet_index].state;
@@ -1173,13 +1293,8 @@ const uint8_t get_keystore_used_status(uint8_t keystore_index) {
 }
 
 const uint8_t get_keystore_used_count() {
-  uint8_t paired_card_count = 0;
-  for (uint8_t i = 0; i < MAX_KEYSTORE_ENTRY; i++) {
-    if (get_keystore_used_status(i) == 1) {
-      paired_card_count++;
-    }
-  }
-  return paired_card_count;
+  get_sec_flash_ram_instance();
+  return keystore_lut.used_count;
 }
 
 const uint8_t *get_keystore_pairing_key(uint8_t keystore_index) {
@@ -1242,6 +1357,7 @@ uint8_t set_keystore_used_status(uint8_t keystore_index,
 
   get_sec_flash_ram_instance();
   sec_flash_instance.keystore[keystore_index].used = _used;
+  flash_keystore_index_rebuild();
 
   if (save_mode == FLASH_SAVE_NOW)
     sec_flash_struct_save();
@@ -1254,5 +1370,6 @@ void flash_delete_all_wallets() {
   memzero(&flash_ram_instance.wallets,
           MAX_WALLETS_ALLOWED * sizeof(Flash_Wallet));
   flash_ram_instance.wallet_count = 0;
+  flash_wallet_index_rebuild();
   flash_struct_save();
 }
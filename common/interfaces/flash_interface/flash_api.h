@@ -23,6 +23,10 @@
   (get_enable_passphrase() == PASSPHRASE_DISABLED ||                           \
    get_enable_passphrase() == DEFAULT_VALUE_IN_FLASH)
 
+#define is_summary_review_enabled() (get_review_mode() == REVIEW_MODE_SUMMARY)
+
+#define is_xpub_cache_enabled() (get_xpub_cache() == XPUB_CACHE_ENABLED)
+
 /**
  * @brief This API checks if a wallet exists at a particular index.
  * Optionally, if a wallet exists in that index, this API can return the status
@@ -425,6 +429,33 @@ int set_display_rotation(display_rotation _rotation, flash_save_mode save_mode);
 int set_enable_passphrase(passphrase_config enable_passphrase,
                           flash_save_mode save_mode);
 
+/**
+ * @brief Set the review mode of transactions with many receivers
+ *
+ * @param review_mode REVIEW_MODE_DETAILED, REVIEW_MODE_SUMMARY
+ * @param save_mode Signal to save the changes now or later
+ * @return SUCCESS_ Review mode set successfully
+ */
+int set_review_mode(review_mode_config review_mode, flash_save_mode save_mode);
+
+/**
+ * @brief Set the cached hash rate of the proof of work
+ *
+ * @param pow_rate Hash rate and the configuration it was measured with
+ * @param save_mode Signal to save the changes now or later
+ * @return SUCCESS_ Hash rate set successfully
+ */
+int set_pow_rate(const Flash_Pow_Rate *pow_rate, flash_save_mode save_mode);
+
+/**
+ * @brief Set whether account public nodes are cached in flash
+ *
+ * @param xpub_cache XPUB_CACHE_DISABLED, XPUB_CACHE_ENABLED
+ * @param save_mode Signal to save the changes now or later
+ * @return SUCCESS_ Xpub cache config set successfully
+ */
+int set_xpub_cache(xpub_cache_config xpub_cache, flash_save_mode save_mode);
+
 /**
  * @brief Get the io protection key from flash
  *
@@ -721,6 +752,26 @@ const display_rotation get_display_rotation();
  */
 const passphrase_config get_enable_passphrase();
 
+/**
+ * @brief Get the review mode of transactions with many receivers
+ * @details Reads DEFAULT_VALUE_IN_FLASH until set, which is treated as
+ * REVIEW_MODE_DETAILED
+ */
+const review_mode_config get_review_mode();
+
+/**
+ * @brief Get the cached hash rate of the proof of work
+ * @details Reads DEFAULT_VALUE_IN_FLASH until set
+ */
+const Flash_Pow_Rate *get_pow_rate();
+
+/**
+ * @brief Get whether account public nodes are cached in flash
+ * @details Reads DEFAULT_VALUE_IN_FLASH until set, which is treated as
+ * XPUB_CACHE_DISABLED
+ */
+const xpub_cache_config get_xpub_cache();
+
 /**
  * @brief
  * @details
@@ -0,0 +1,621 @@
+/**
+ * @file    flash_journal.c
+ * @author  Cypherock X1 Team
+ * @brief   Append-only journal of an image stored on flash
+ * @copyright Copyright (c) 2023 HODL TECH PTE LTD
+ * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
+ *target=_blank>https://mitcc.org/</a>
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * (c) Copyright 2023 by HODL TECH PTE LTD
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * "Commons Clause" License Condition v1.0
+ *
+ * The Software is provided to you by the Licensor under the License,
+ * as defined below, subject to the following condition.
+ *
+ * Without limiting other conditions in the License, the grant of
+ * rights under the License will not include, and the License does not
+ * grant to you, the right to Sell the Software.
+ *
+ * For purposes of the foregoing, "Sell" means practicing any or all
+ * of the rights granted to you under the License to provide to third
+ * parties, for a fee or other consideration (including without
+ * limitation fees for hosting or consulting/ support services related
+ * to the Software), a product or service whose value derives, entirely
+ * or substantially, from the functionality of the Software. Any license
+ * notice or attribution required by the License must also include
+ * this Commons Clause License Condition notice.
+ *
+ * Software: All X1Wallet associated files.
+ * License: MIT
+ * Licensor: HODL TECH PTE LTD
+ *
+ ******************************************************************************
+ */
+
+/*****************************************************************************
+ * INCLUDES
+ *****************************************************************************/
+#include "flash_journal.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#include "assert_conf.h"
+#include "board.h"
+#include "flash_if.h"
+
+/*****************************************************************************
+ * EXTERN VARIABLES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * PRIVATE MACROS AND DEFINES
+ *****************************************************************************/
+/// Identifies the last record of a save and the seal (little-endian "FJ")
+#define JOURNAL_RECORD_MAGIC 0x4A46
+
+/// Marks a record which is followed by more records of the same save
+#define JOURNAL_RECORD_CONTINUED 0x4A2B
+
+/// Offset field of the record sealing the snapshot of a bank
+#define JOURNAL_SEAL_OFFSET 0xFFFF
+
+/// Offset of the first delta record in a bank
+#define JOURNAL_RECORDS_OFFSET(journal)                                        \
+  ((journal)->image_size + sizeof(journal_seal_t))
+
+/// Bytes moved between flash and RAM at a time, through an aligned buffer
+#define JOURNAL_CHUNK_SIZE 32
+
+#if USE_SIMULATOR == 1
+/// The simulator flash driver counts lengths in words
+#define JOURNAL_IO_LEN(len) ((len) / sizeof(uint32_t))
+#else
+#define JOURNAL_IO_LEN(len) (len)
+#endif
+
+/*****************************************************************************
+ * PRIVATE TYPEDEFS
+ *****************************************************************************/
+typedef struct {
+  uint16_t magic;
+  uint16_t offset;
+  uint16_t length;
+  uint16_t crc;
+} journal_record_t;
+
+/// Follows the snapshot; the CRC also covers the generation
+typedef struct {
+  journal_record_t record;
+  uint64_t generation;
+} journal_seal_t;
+
+typedef enum {
+  JOURNAL_BANK_INVALID = 0,
+  JOURNAL_BANK_UNSEALED,
+  JOURNAL_BANK_SEALED,
+} journal_bank_state_e;
+
+typedef enum {
+  JOURNAL_RECORD_BLANK = 0,
+  JOURNAL_RECORD_INVALID,
+  JOURNAL_RECORD_VALID,
+} journal_record_state_e;
+
+/*****************************************************************************
+ * STATIC FUNCTION PROTOTYPES
+ *****************************************************************************/
+/**
+ * @brief Updates a CRC-16/CCITT with the given bytes
+ *
+ * @param crc CRC so far, 0xFFFF to start
+ * @param data Bytes to include
+ * @param len Number of bytes
+ * @return uint16_t Updated CRC
+ */
+static uint16_t journal_crc(uint16_t crc, const uint8_t *data, uint32_t len);
+
+/**
+ * @brief Reads flash into RAM; bytes which cannot be read are set to 0xFF
+ *
+ * @param addr Flash address, aligned to FLASH_JOURNAL_ALIGN
+ * @param data Destination in RAM
+ * @param len Number of bytes
+ */
+static void journal_read(uint32_t addr, uint8_t *data, uint32_t len);
+
+/**
+ * @brief Programs RAM contents on erased flash, padding the tail with 0xFF
+ *
+ * @param addr Flash address, aligned to FLASH_JOURNAL_ALIGN
+ * @param data Source bytes
+ * @param len Number of bytes
+ */
+static void journal_program(uint32_t addr, const uint8_t *data, uint32_t len);
+
+/**
+ * @brief Computes the CRC of a record over its header fields and the data on
+ * flash at addr
+ */
+static uint16_t journal_flash_crc(const journal_record_t *record,
+                                  uint32_t addr,
+                                  uint32_t len);
+
+/**
+ * @brief Classifies the snapshot held by the bank
+ *
+ * @param journal Journal being loaded
+ * @param bank Bank to check
+ * @param generation Generation of the snapshot, 0 unless sealed
+ * @return journal_bank_state_e State of the bank
+ */
+static journal_bank_state_e journal_check_bank(const flash_journal_t *journal,
+                                               uint8_t bank,
+                                               uint64_t *generation);
+
+/**
+ * @brief Reads and verifies the record at the offset of the active bank
+ *
+ * @param journal Journal being loaded
+ * @param offset Offset of the record header in the bank
+ * @param record Header of the record
+ * @return journal_record_state_e State of the record
+ */
+static journal_record_state_e journal_read_record(
+    const flash_journal_t *journal,
+    uint32_t offset,
+    journal_record_t *record);
+
+/**
+ * @brief Applies the delta records of the active bank on journal->image and
+ * sets the offset for the next record
+ */
+static void journal_replay(flash_journal_t *journal);
+
+/**
+ * @brief Finds the next byte range, starting at or after from, where image
+ * differs from the persisted image. Ranges apart by less than a record header
+ * are merged.
+ *
+ * @return bool If a range was found
+ */
+static bool journal_next_delta(const flash_journal_t *journal,
+                               const uint8_t *image,
+                               uint16_t from,
+                               uint16_t *start,
+                               uint16_t *len);
+
+/**
+ * @brief Appends a delta record on the active bank and applies it on
+ * journal->image; the caller checks that the bank has room for it
+ *
+ * @param journal Journal to append to
+ * @param offset Offset of the range in the image
+ * @param data New bytes of the range
+ * @param len Length of the range
+ * @param last If the record is the last one of the save
+ */
+static void journal_append(flash_journal_t *journal,
+                           uint16_t offset,
+                           const uint8_t *data,
+                           uint16_t len,
+                           bool last);
+
+/**
+ * @brief Writes the image as a sealed snapshot of the next generation on the
+ * other bank and invalidates the active bank
+ */
+static void journal_compact(flash_journal_t *journal, const uint8_t *image);
+
+/*****************************************************************************
+ * STATIC VARIABLES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * GLOBAL VARIABLES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * STATIC FUNCTIONS
+ *****************************************************************************/
+static uint16_t journal_crc(uint16_t crc, const uint8_t *data, uint32_t len) {
+  for (uint32_t i = 0; i < len; i++) {
+    crc ^= (uint16_t)data[i] << 8;
+    for (uint8_t bit = 0; bit < 8; bit++) {
+      crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : (crc << 1);
+    }
+  }
+  return crc;
+}
+
+static void journal_read(uint32_t addr, uint8_t *data, uint32_t len) {
+#if USE_SIMULATOR == 0
+  // Flash is memory-mapped on the device
+  memcpy(data, (const uint8_t *)addr, len);
+#else
+  uint64_t chunk[JOURNAL_CHUNK_SIZE / sizeof(uint64_t)];
+
+  while (0 < len) {
+    uint32_t size = len < JOURNAL_CHUNK_SIZE ? len : JOURNAL_CHUNK_SIZE;
+    memset(chunk, DEFAULT_VALUE_IN_FLASH, sizeof(chunk));
+    read_cmd(addr,
+             (uint32_t *)chunk,
+             JOURNAL_IO_LEN(FLASH_JOURNAL_ALIGNED(size)));
+    memcpy(data, chunk, size);
+    addr += size;
+    data += size;
+    len -= size;
+  }
+#endif
+}
+
+static void journal_program(uint32_t addr, const uint8_t *data, uint32_t len) {
+  uint64_t chunk[JOURNAL_CHUNK_SIZE / sizeof(uint64_t)];
+
+  while (0 < len) {
+    uint32_t size = len < JOURNAL_CHUNK_SIZE ? len : JOURNAL_CHUNK_SIZE;
+    memset(chunk, DEFAULT_VALUE_IN_FLASH, sizeof(chunk));
+    memcpy(chunk, data, size);
+    write_cmd(addr,
+              (const uint32_t *)chunk,
+              JOURNAL_IO_LEN(FLASH_JOURNAL_ALIGNED(size)));
+    addr += FLASH_JOURNAL_ALIGNED(size);
+    data += size;
+    len -= size;
+  }
+}
+
+static uint16_t journal_flash_crc(const journal_record_t *record,
+                                  uint32_t addr,
+                                  uint32_t len) {
+  uint16_t crc = journal_crc(0xFFFF,
+                             (const uint8_t *)record,
+                             offsetof(journal_record_t, crc));
+
+#if USE_SIMULATOR == 0
+  crc = journal_crc(crc, (const uint8_t *)addr, len);
+#else
+  uint8_t chunk[JOURNAL_CHUNK_SIZE];
+  while (0 < len) {
+    uint32_t size = len < JOURNAL_CHUNK_SIZE ? len : JOURNAL_CHUNK_SIZE;
+    journal_read(addr, chunk, size);
+    crc = journal_crc(crc, chunk, size);
+    addr += size;
+    len -= size;
+  }
+#endif
+  return crc;
+}
+
+static journal_bank_state_e journal_check_bank(const flash_journal_t *journal,
+                                               uint8_t bank,
+                                               uint64_t *generation) {
+  const uint32_t bank_addr = journal->base_addr + bank * journal->bank_size;
+  uint8_t blank[sizeof(journal_seal_t)];
+  journal_seal_t seal = {0};
+
+  *generation = 0;
+  memset(blank, DEFAULT_VALUE_IN_FLASH, sizeof(blank));
+  journal_read(bank_addr, (uint8_t *)&seal.record, sizeof(seal.record));
+  if (0 == memcmp(&seal.record, blank, sizeof(seal.record))) {
+    return JOURNAL_BANK_INVALID;
+  }
+
+  journal_read(bank_addr + journal->image_size, (uint8_t *)&seal, sizeof(seal));
+  if (0 == memcmp(&seal, blank, sizeof(seal))) {
+    return JOURNAL_BANK_UNSEALED;
+  }
+
+  if (JOURNAL_RECORD_MAGIC == seal.record.magic &&
+      JOURNAL_SEAL_OFFSET == seal.record.offset &&
+      journal->image_size == seal.record.length &&
+      seal.record.crc ==
+          journal_crc(
+              journal_flash_crc(&seal.record, bank_addr, journal->image_size),
+              (const uint8_t *)&seal.generation,
+              sizeof(seal.generation))) {
+    *generation = seal.generation;
+    return JOURNAL_BANK_SEALED;
+  }
+  return JOURNAL_BANK_INVALID;
+}
+
+static journal_record_state_e journal_read_record(
+    const flash_journal_t *journal,
+    uint32_t offset,
+    journal_record_t *record) {
+  const uint32_t record_addr =
+      journal->base_addr + journal->bank * journal->bank_size + offset;
+
+  if (journal->bank_size < offset + FLASH_JOURNAL_ALIGN) {
+    return JOURNAL_RECORD_INVALID;
+  }
+
+  journal_read(record_addr, (uint8_t *)record, sizeof(*record));
+  if (DEFAULT_UINT32_IN_FLASH == *(uint32_t *)record &&
+      DEFAULT_UINT32_IN_FLASH == *((uint32_t *)record + 1)) {
+    return JOURNAL_RECORD_BLANK;
+  }
+
+  if ((JOURNAL_RECORD_MAGIC != record->magic &&
+       JOURNAL_RECORD_CONTINUED != record->magic) ||
+      0 == record->length ||
+      journal->image_size < (uint32_t)record->offset + record->length ||
+      journal->bank_size < offset + FLASH_JOURNAL_ALIGN +
+                               FLASH_JOURNAL_ALIGNED(record->length) ||
+      record->crc != journal_flash_crc(record,
+                                       record_addr + FLASH_JOURNAL_ALIGN,
+                                       record->length)) {
+    return JOURNAL_RECORD_INVALID;
+  }
+  return JOURNAL_RECORD_VALID;
+}
+
+static void journal_replay(flash_journal_t *journal) {
+  const uint32_t bank_addr =
+      journal->base_addr + journal->bank * journal->bank_size;
+  uint32_t offset = JOURNAL_RECORDS_OFFSET(journal);
+
+  while (true) {
+    journal_record_t record = {0};
+    journal_record_state_e state = JOURNAL_RECORD_VALID;
+    uint32_t save_end = offset;
+
+    // Records of a save apply only once its last record is found intact
+    do {
+      state = journal_read_record(journal, save_end, &record);
+      if (JOURNAL_RECORD_VALID != state) {
+        break;
+      }
+      save_end += FLASH_JOURNAL_ALIGN + FLASH_JOURNAL_ALIGNED(record.length);
+    } while (JOURNAL_RECORD_CONTINUED == record.magic);
+
+    if (JOURNAL_RECORD_VALID != state) {
+      // Unless the journal simply ends here, the save was torn and the next
+      // save has to compact the journal
+      bool journal_end = (JOURNAL_RECORD_BLANK == state && save_end == offset);
+      journal->write_offset = journal_end ? offset : journal->bank_size;
+      return;
+    }
+
+    while (offset < save_end) {
+      journal_read(bank_addr + offset, (uint8_t *)&record, sizeof(record));
+      journal_read(bank_addr + offset + FLASH_JOURNAL_ALIGN,
+                   journal->image + record.offset,
+                   record.length);
+      offset += FLASH_JOURNAL_ALIGN + FLASH_JOURNAL_ALIGNED(record.length);
+    }
+  }
+}
+
+static bool journal_next_delta(const flash_journal_t *journal,
+                               const uint8_t *image,
+                               uint16_t from,
+                               uint16_t *start,
+                               uint16_t *len) {
+  uint16_t index = from;
+  while (index < journal->image_size && image[index] == journal->image[index]) {
+    index++;
+  }
+  if (index >= journal->image_size) {
+    return false;
+  }
+
+  uint16_t end = index + 1;
+  for (uint16_t scan = end; scan < journal->image_size; scan++) {
+    if (image[scan] != journal->image[scan]) {
+      if (scan - end > FLASH_JOURNAL_ALIGN) {
+        break;
+      }
+      end = scan + 1;
+    }
+  }
+
+  *start = index;
+  *len = end - index;
+  return true;
+}
+
+static void journal_append(flash_journal_t *journal,
+                           uint16_t offset,
+                           const uint8_t *data,
+                           uint16_t len,
+                           bool last) {
+  const uint32_t addr = journal->base_addr +
+                        journal->bank * journal->bank_size +
+                        journal->write_offset;
+  journal_record_t record = {
+      .magic = last ? JOURNAL_RECORD_MAGIC : JOURNAL_RECORD_CONTINUED,
+      .offset = offset,
+      .length = len};
+
+  record.crc = journal_crc(
+      journal_crc(
+          0xFFFF, (const uint8_t *)&record, offsetof(journal_record_t, crc)),
+      data,
+      len);
+
+  journal_program(addr, (const uint8_t *)&record, sizeof(record));
+  journal_program(addr + FLASH_JOURNAL_ALIGN, data, len);
+  journal->write_offset += FLASH_JOURNAL_ALIGN + FLASH_JOURNAL_ALIGNED(len);
+  memcpy(journal->image + offset, data, len);
+}
+
+static void journal_compact(flash_journal_t *journal, const uint8_t *image) {
+  const uint8_t target = journal->bank ^ 1;
+  const uint32_t target_addr = journal->base_addr + target * journal->bank_size;
+  journal_seal_t seal = {.record = {.magic = JOURNAL_RECORD_MAGIC,
+                                    .offset = JOURNAL_SEAL_OFFSET,
+                                    .length = journal->image_size},
+                         .generation = journal->generation + 1};
+
+  erase_cmd(target_addr, journal->bank_size);
+  journal_program(target_addr, image, journal->image_size);
+  seal.record.crc =
+      journal_crc(journal_crc(journal_crc(0xFFFF,
+                                          (const uint8_t *)&seal.record,
+                                          offsetof(journal_record_t, crc)),
+                              image,
+                              journal->image_size),
+                  (const uint8_t *)&seal.generation,
+                  sizeof(seal.generation));
+  journal_program(
+      target_addr + journal->image_size, (const uint8_t *)&seal, sizeof(seal));
+
+  // Blanking the start of the old bank drops its snapshot
+  erase_cmd(journal->base_addr + journal->bank * journal->bank_size,
+            FLASH_PAGE_SIZE);
+
+  if (image != journal->image) {
+    memcpy(journal->image, image, journal->image_size);
+  }
+  journal->bank = target;
+  journal->generation = seal.generation;
+  journal->write_offset = JOURNAL_RECORDS_OFFSET(journal);
+}
+
+/*****************************************************************************
+ * GLOBAL FUNCTIONS
+ *****************************************************************************/
+bool flash_journal_load(flash_journal_t *journal) {
+  ASSERT(NULL != journal && NULL != journal->image);
+  // A bank must hold the snapshot, its seal and at least one delta record
+  ASSERT(JOURNAL_RECORDS_OFFSET(journal) + 2 * FLASH_JOURNAL_ALIGN <=
+         journal->bank_size);
+
+  uint64_t generation[2] = {0};
+  journal_bank_state_e state[2] = {
+      journal_check_bank(journal, 0, &generation[0]),
+      journal_check_bank(journal, 1, &generation[1])};
+
+  journal->loaded = true;
+  if (JOURNAL_BANK_INVALID == state[0] && JOURNAL_BANK_INVALID == state[1]) {
+    memset(journal->image, DEFAULT_VALUE_IN_FLASH, journal->image_size);
+    // The first save compacts the image into the first bank
+    journal->bank = 1;
+    journal->generation = 0;
+    journal->write_offset = journal->bank_size;
+    return false;
+  }
+
+  /* Both banks hold a snapshot only if a compaction was interrupted after
+   * sealing the new bank and before dropping the old one. The new bank also
+   * holds the save which started the compaction, hence the newer generation
+   * is kept. */
+  journal->bank = (JOURNAL_BANK_INVALID != state[1] &&
+                   (JOURNAL_BANK_INVALID == state[0] ||
+                    generation[1] > generation[0]))
+                      ? 1
+                      : 0;
+  journal->generation = generation[journal->bank];
+  if (JOURNAL_BANK_INVALID != state[journal->bank ^ 1]) {
+    erase_cmd(journal->base_addr + (journal->bank ^ 1) * journal->bank_size,
+              FLASH_PAGE_SIZE);
+  }
+
+  journal_read(journal->base_addr + journal->bank * journal->bank_size,
+               journal->image,
+               journal->image_size);
+  journal_replay(journal);
+  return true;
+}
+
+void flash_journal_save(flash_journal_t *journal, const uint8_t *image) {
+  ASSERT(NULL != journal && NULL != image);
+
+  if (!journal->loaded) {
+    flash_journal_load(journal);
+  }
+
+  uint32_t required = 0;
+  uint16_t start = 0, len = 0;
+  for (uint16_t from = 0;
+       journal_next_delta(journal, image, from, &start, &len);
+       from = start + len) {
+    required += FLASH_JOURNAL_ALIGN + FLASH_JOURNAL_ALIGNED(len);
+  }
+
+  if (0 == required) {
+    return;
+  }
+
+  if (journal->bank_size < journal->write_offset + required) {
+    journal_compact(journal, image);
+    return;
+  }
+
+  bool found = journal_next_delta(journal, image, 0, &start, &len);
+  while (found) {
+    uint16_t next_start = 0, next_len = 0;
+    found = journal_next_delta(
+        journal, image, start + len, &next_start, &next_len);
+    journal_append(journal, start, image + start, len, !found);
+    start = next_start;
+    len = next_len;
+  }
+}
+
+void flash_journal_save_range(flash_journal_t *journal,
+                              uint16_t offset,
+                              const uint8_t *data,
+                              uint16_t len) {
+  ASSERT(NULL != journal && NULL != data);
+  ASSERT((uint32_t)offset + len <= journal->image_size);
+
+  if (!journal->loaded) {
+    flash_journal_load(journal);
+  }
+
+  uint16_t first = 0, last = len;
+  while (first < len && data[first] == journal->image[offset + first]) {
+    first++;
+  }
+  if (first == len) {
+    return;
+  }
+  while (data[last - 1] == journal->image[offset + last - 1]) {
+    last--;
+  }
+
+  const uint16_t start = offset + first;
+  len = last - first;
+  if (journal->bank_size < journal->write_offset + FLASH_JOURNAL_ALIGN +
+                               FLASH_JOURNAL_ALIGNED(len)) {
+    // Rare: the range goes out with the whole image into the other bank
+    memcpy(journal->image + start, data + first, len);
+    journal_compact(journal, journal->image);
+    return;
+  }
+  journal_append(journal, start, data + first, len, true);
+}
+
+void flash_journal_erase(flash_journal_t *journal) {
+  ASSERT(NULL != journal);
+
+  erase_cmd(journal->base_addr, 2 * journal->bank_size);
+  journal->loaded = false;
+}
@@ -0,0 +1,105 @@
+/**
+ * @file    flash_journal.h
+ * @author  Cypherock X1 Team
+ * @brief   Append-only journal of an image stored on flash
+ * @copyright Copyright (c) 2023 HODL TECH PTE LTD
+ * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
+ * target=_blank>https://mitcc.org/</a>
+ */
+#ifndef FLASH_JOURNAL_H
+#define FLASH_JOURNAL_H
+
+/*****************************************************************************
+ * INCLUDES
+ *****************************************************************************/
+#include <stdbool.h>
+#include <stdint.h>
+
+/*****************************************************************************
+ * MACROS AND DEFINES
+ *****************************************************************************/
+/// Size of a journal record header, also the programming granularity
+#define FLASH_JOURNAL_ALIGN 8
+
+/// Rounds the size up to the programming granularity of the journal
+#define FLASH_JOURNAL_ALIGNED(x)                                               \
+  (((x) + FLASH_JOURNAL_ALIGN - 1) & ~(FLASH_JOURNAL_ALIGN - 1))
+
+/*****************************************************************************
+ * TYPEDEFS
+ *****************************************************************************/
+/**
+ * @brief Journal keeping an image on two banks of flash pages
+ * @details Each bank starts with a full copy (snapshot) of the image, sealed by
+ * a CRC record carrying the generation of the snapshot, followed by delta
+ * records which overwrite a byte range of the image. A save only programs the
+ * ranges which differ from the persisted image; when the active bank is full,
+ * the image is compacted into the other bank of the next generation and the
+ * old bank is invalidated. Every record carries a CRC, so a save interrupted by
+ * a power loss is discarded as a whole on the next load.
+ *
+ * A bank whose seal slot is blank is accepted as an unsealed snapshot of
+ * generation 0, which is the layout written before the journal was introduced.
+ */
+typedef struct {
+  uint32_t base_addr;    ///< Address of the first bank, page aligned
+  uint32_t bank_size;    ///< Size of each bank, multiple of page size
+  uint16_t image_size;   ///< Size of the image, multiple of FLASH_JOURNAL_ALIGN
+  uint8_t *image;        ///< Persisted image, image_size bytes of RAM
+
+  uint8_t bank;             ///< Bank holding the persisted image
+  uint32_t write_offset;    ///< Offset within the bank for the next record
+  uint64_t generation;      ///< Generation of the snapshot of the bank
+  bool loaded;              ///< If image mirrors the persisted image
+} flash_journal_t;
+
+/*****************************************************************************
+ * EXPORTED VARIABLES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * GLOBAL FUNCTION PROTOTYPES
+ *****************************************************************************/
+/**
+ * @brief Rebuilds the persisted image from flash into journal->image
+ * @details If both banks hold a snapshot, a compaction was interrupted and the
+ * bank of the newer generation is loaded; the stale one is invalidated here.
+ *
+ * @param journal Journal to load
+ *
+ * @return bool Indicating if a persisted image was found
+ * @retval false If neither bank holds a snapshot; image is filled with 0xFF
+ */
+bool flash_journal_load(flash_journal_t *journal);
+
+/**
+ * @brief Persists the image, programming only the bytes which changed
+ *
+ * @param journal Journal to save into
+ * @param image New image of journal->image_size bytes
+ */
+void flash_journal_save(flash_journal_t *journal, const uint8_t *image);
+
+/**
+ * @brief Persists a byte range of the image as a single delta record
+ * @details Unlike flash_journal_save, the caller does not need to build the
+ * whole image; only the bytes of the range which differ are programmed.
+ *
+ * @param journal Journal to save into
+ * @param offset Offset of the range in the image
+ * @param data New bytes of the range
+ * @param len Length of the range
+ */
+void flash_journal_save_range(flash_journal_t *journal,
+                              uint16_t offset,
+                              const uint8_t *data,
+                              uint16_t len);
+
+/**
+ * @brief Erases both banks of the journal
+ *
+ * @param journal Journal to erase
+ */
+void flash_journal_erase(flash_journal_t *journal);
+
+#endif /* FLASH_JOURNAL_H */
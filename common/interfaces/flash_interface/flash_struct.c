@@ -65,11 +65,14 @@
 #include "board.h"
 #include "chacha20poly1305.h"
 #include "flash_if.h"
+#include "flash_journal.h"
 #include "flash_struct_priv.h"
 #include "logger.h"
 #include "memzero.h"
 #include "pow_utilities.h"
 #include "rfc7539.h"
+#include "task_scheduler.h"
+#include "utils.h"
 
 /**
  * @brief Calculates the size of the TLV for memory allocation.
@@ -84,6 +87,7 @@
   (6 + 3 + FAMILY_ID_SIZE + 3 + sizeof(uint32_t) + 3 +                         \
    (MAX_WALLETS_ALLOWED * ((15 * 3) + sizeof(Flash_Wallet))) + 3 +             \
    sizeof(uint8_t) + 3 + sizeof(uint8_t) + 3 + sizeof(uint8_t) + 3 +           \
+   sizeof(uint8_t) + 3 + sizeof(uint8_t) + 3 + sizeof(Flash_Pow_Rate) + 3 +   \
    sizeof(uint8_t))
 
 /// The size of tlv that will be read and written to flash. Since we read/write
@@ -94,6 +98,19 @@
 
 #define FLASH_WRITE_STRUCTURE_SIZE sizeof(Flash_Struct)
 
+/// Slice given to the background task committing deferred saves
+#define FLASH_COMMIT_SLICE_MS 50
+
+/// Size of the image of the serialized structure kept by the journal
+#define FLASH_STRUCT_IMAGE_SIZE FLASH_JOURNAL_ALIGNED(FLASH_STRUCT_TLV_SIZE)
+
+/// Size of the serialized Flash_Pow: its TLV header and five field TLVs
+#define FLASH_POW_TLV_SIZE (3 + 5 * 3 + sizeof(Flash_Pow))
+
+/// Size of each of the two journal banks sharing the data region
+#define FLASH_STRUCT_BANK_SIZE                                                 \
+  ((FLASH_DATA_END_ADDRESS + 1 - FLASH_DATA_ADDRESS) / 2)
+
 /// Tags  for TLV
 typedef enum Flash_tlv_tags {
   TAG_FLASH_STRUCT = 0xAAAAAAAA,
@@ -106,6 +123,9 @@ typedef enum Flash_tlv_tags {
   TAG_FLASH_TOGGLE_PASSPHRASE = 0x07,
   TAG_FLASH_TOGGLE_LOGS = 0x08,
   TAG_FLASH_ONBOARDING_STEP = 0x09,
+  TAG_FLASH_REVIEW_MODE = 0x0A,
+  TAG_FLASH_POW_RATE = 0x0B,
+  TAG_FLASH_XPUB_CACHE = 0x0C,
 
   TAG_FLASH_WALLET = 0x20,
   TAG_FLASH_WALLET_STATE = 0x21,
@@ -129,8 +149,24 @@ typedef enum Flash_tlv_tags {
 Flash_Struct flash_ram_instance;
 bool is_flash_ram_instance_loaded = false;
 
+/// Serialized structure as persisted on flash, maintained by the journal
+static uint8_t flash_struct_image[FLASH_STRUCT_IMAGE_SIZE];
+static flash_journal_t flash_struct_journal = {
+    .base_addr = FLASH_DATA_ADDRESS,
+    .bank_size = FLASH_STRUCT_BANK_SIZE,
+    .image_size = FLASH_STRUCT_IMAGE_SIZE,
+    .image = flash_struct_image,
+};
+
+/// If flash_ram_instance has changes which are not saved to flash yet
+static bool is_flash_ram_instance_dirty = false;
+
 static void deserialize_fs(Flash_Struct *flash_struct, uint8_t *tlv);
 static uint16_t serialize_fs(const Flash_Struct *flash_struct, uint8_t *tlv);
+static void serialize_fs_pow(uint8_t *array,
+                             uint16_t *starting_index,
+                             const Flash_Pow *flash_pow);
+static uint16_t persisted_challenge_offset(uint8_t wallet_index);
 
 /**
  * @brief Load flash struct instance
@@ -138,37 +174,18 @@ static uint16_t serialize_fs(const Flash_Struct *flash_struct, uint8_t *tlv);
  */
 static void flash_struct_load() {
   ASSERT((&flash_ram_instance) != NULL);
-#if USE_SIMULATOR == 1
-  uint32_t serialized_flash_metadata[2];
-  read_cmd(FLASH_DATA_ADDRESS, serialized_flash_metadata, 8);
-#else
-  uint8_t *serialized_flash_metadata = (uint8_t *)FLASH_DATA_ADDRESS;
-#endif
-  uint32_t serialized_flash_struct_tag = serialized_flash_metadata[0] +
-                                         (serialized_flash_metadata[1] << 8) +
-                                         (serialized_flash_metadata[2] << 16) +
-                                         (serialized_flash_metadata[3] << 24);
-  uint16_t serialized_flash_size =
-      serialized_flash_metadata[4] + (serialized_flash_metadata[5] << 8);
-
-  if (serialized_flash_struct_tag == TAG_FLASH_STRUCT &&
-      serialized_flash_size <= FLASH_DATA_SIZE_LIMIT) {
-    // 6 is added to include the TAG_FLASH_STRUCT and length of the serialized
-    // structure
-    uint16_t serialized_flash_size_tagged = serialized_flash_size + 6;
-
-    uint8_t *serialized_flash_instance =
-        (uint8_t *)malloc(serialized_flash_size_tagged);
-    ASSERT(serialized_flash_instance != NULL);
-    read_cmd(FLASH_DATA_ADDRESS,
-             (uint32_t *)serialized_flash_instance,
-             serialized_flash_size_tagged);
-    deserialize_fs(&flash_ram_instance, serialized_flash_instance);
-    free(serialized_flash_instance);
-    serialized_flash_instance = NULL;
+  bool persisted = flash_journal_load(&flash_struct_journal);
+  uint32_t serialized_flash_struct_tag = U32_READ_LE_ARRAY(flash_struct_image);
+  uint16_t serialized_flash_size = U16_READ_LE_ARRAY(flash_struct_image + 4);
+
+  // 6 is added to include the TAG_FLASH_STRUCT and length of the serialized
+  // structure
+  if (persisted && serialized_flash_struct_tag == TAG_FLASH_STRUCT &&
+      serialized_flash_size + 6 <= FLASH_STRUCT_IMAGE_SIZE) {
+    deserialize_fs(&flash_ram_instance, flash_struct_image);
   } else {
     LOG_CRITICAL("xxxa");
-    erase_cmd(FLASH_DATA_ADDRESS, FLASH_STRUCT_TLV_SIZE);
+    flash_journal_erase(&flash_struct_journal);
     memset(&flash_ram_instance,
            DEFAULT_VALUE_IN_FLASH,
            FLASH_WRITE_STRUCTURE_SIZE);
@@ -177,6 +194,7 @@ static void flash_struct_load() {
   if (flash_ram_instance.wallet_count == DEFAULT_UINT32_IN_FLASH) {
     flash_ram_instance.wallet_count = 0;
   }
+  flash_wallet_index_rebuild();
 }
 
 /**
@@ -185,17 +203,58 @@ static void flash_struct_load() {
  */
 void flash_struct_save() {
   ASSERT((&flash_ram_instance) != NULL);
-  uint8_t *serialized_flash_instance = (uint8_t *)malloc(FLASH_STRUCT_TLV_SIZE);
+  uint8_t *serialized_flash_instance =
+      (uint8_t *)malloc(FLASH_STRUCT_IMAGE_SIZE);
   ASSERT(serialized_flash_instance != NULL);
+  // Unused bytes must be stable across saves to not show up as changes
+  memset(serialized_flash_instance, 0, FLASH_STRUCT_IMAGE_SIZE);
   serialize_fs(&flash_ram_instance, serialized_flash_instance);
-  erase_cmd(FLASH_DATA_ADDRESS, FLASH_STRUCT_TLV_SIZE);
-  write_cmd(FLASH_DATA_ADDRESS,
-            (uint32_t *)serialized_flash_instance,
-            FLASH_STRUCT_TLV_SIZE);
+  flash_journal_save(&flash_struct_journal, serialized_flash_instance);
+  is_flash_ram_instance_dirty = false;
   free(serialized_flash_instance);
   serialized_flash_instance = NULL;
 }
 
+void flash_struct_save_challenge(const Flash_Wallet *wallet) {
+  ASSERT(wallet != NULL);
+  uint8_t tlv[FLASH_POW_TLV_SIZE];
+  uint16_t size = 0;
+  uint16_t offset =
+      persisted_challenge_offset(wallet - flash_ram_instance.wallets);
+
+  serialize_fs_pow(tlv, &size, &(wallet->challenge));
+  // Fall back if the persisted layout does not match, e.g. nothing saved yet
+  if (0 == offset || 0 != memcmp(flash_struct_image + offset, tlv, 3)) {
+    flash_struct_save_later();
+    return;
+  }
+  flash_journal_save_range(&flash_struct_journal, offset, tlv, size);
+}
+
+/**
+ * @brief Background task saving the changes deferred by
+ * flash_struct_save_later, runs once the flow waits for the next event
+ */
+static bool flash_commit_task(uint32_t budget_ms) {
+  sched_remove_task(flash_commit_task);
+  flash_commit();
+  return false;
+}
+
+void flash_struct_save_later() {
+  is_flash_ram_instance_dirty = true;
+  if (!sched_add_task(
+          flash_commit_task, SCHED_PRIO_LOW, FLASH_COMMIT_SLICE_MS)) {
+    flash_struct_save();
+  }
+}
+
+void flash_commit() {
+  if (is_flash_ram_instance_dirty) {
+    flash_struct_save();
+  }
+}
+
 /**
  * @brief Get the flash ram instance object
  *
@@ -216,13 +275,15 @@ const Flash_Struct *get_flash_ram_instance() {
  *
  */
 void flash_erase() {
-  erase_cmd(FLASH_DATA_ADDRESS, FLASH_STRUCT_TLV_SIZE);
+  flash_journal_erase(&flash_struct_journal);
+  is_flash_ram_instance_dirty = false;
   memset(
       &flash_ram_instance, DEFAULT_VALUE_IN_FLASH, FLASH_WRITE_STRUCTURE_SIZE);
 
   if (flash_ram_instance.wallet_count == DEFAULT_UINT32_IN_FLASH) {
     flash_ram_instance.wallet_count = 0;
   }
+  flash_wallet_index_rebuild();
   is_flash_ram_instance_loaded = false;
 }
 
@@ -425,12 +486,74 @@ static uint16_t serialize_fs(const Flash_Struct *flash_struct, uint8_t *tlv) {
                  TAG_FLASH_ONBOARDING_STEP,
                  sizeof(flash_struct->onboarding_step),
                  &(flash_struct->onboarding_step));
+  fill_flash_tlv(tlv,
+                 &index,
+                 TAG_FLASH_REVIEW_MODE,
+                 sizeof(flash_struct->review_mode),
+                 &(flash_struct->review_mode));
+  fill_flash_tlv(tlv,
+                 &index,
+                 TAG_FLASH_POW_RATE,
+                 sizeof(flash_struct->pow_rate),
+                 (uint8_t *)(&(flash_struct->pow_rate)));
+  fill_flash_tlv(tlv,
+                 &index,
+                 TAG_FLASH_XPUB_CACHE,
+                 sizeof(flash_struct->xpub_cache),
+                 &(flash_struct->xpub_cache));
   tlv[4] = index - 6;
   tlv[5] = (index - 6) >> 8;
 
   return index;
 }
 
+/**
+ * @brief Finds the serialized challenge of a wallet in the persisted image
+ *
+ * @param wallet_index Index of the wallet in Flash_Struct.wallets
+ * @return uint16_t Offset of the TAG_FLASH_WALLET_CHALLENGE TLV in the image,
+ * 0 if the image does not hold it
+ */
+static uint16_t persisted_challenge_offset(uint8_t wallet_index) {
+  const uint8_t *tlv = flash_struct_image;
+  uint16_t index = 6;
+  uint16_t len = 0;
+
+  if (U32_READ_LE_ARRAY(tlv) != TAG_FLASH_STRUCT ||
+      wallet_index >= MAX_WALLETS_ALLOWED) {
+    return 0;
+  }
+  len = U16_READ_LE_ARRAY(tlv + 4) + 6;
+  if (len > FLASH_STRUCT_IMAGE_SIZE) {
+    return 0;
+  }
+
+  // Top level TLVs, up to the wallet list
+  while (index + 3 <= len && tlv[index] != TAG_FLASH_WALLET_LIST) {
+    index += 3 + U16_READ_LE_ARRAY(tlv + index + 1);
+  }
+  index += 3;
+
+  // Wallet TLVs, up to the requested wallet
+  for (uint8_t i = 0; i < wallet_index && index + 3 <= len; i++) {
+    index += 3 + U16_READ_LE_ARRAY(tlv + index + 1);
+  }
+  if (index + 3 > len || tlv[index] != TAG_FLASH_WALLET) {
+    return 0;
+  }
+  len = index + 3 + U16_READ_LE_ARRAY(tlv + index + 1);
+  index += 3;
+
+  // Fields of the wallet, up to the challenge
+  while (index + 3 <= len && tlv[index] != TAG_FLASH_WALLET_CHALLENGE) {
+    index += 3 + U16_READ_LE_ARRAY(tlv + index + 1);
+  }
+  if (index + FLASH_POW_TLV_SIZE > len) {
+    return 0;
+  }
+  return index;
+}
+
 /**
  * @brief Helper function to extract values of Flash_Pow from TLV.
  *
@@ -605,6 +728,21 @@ static void deserialize_fs(Flash_Struct *flash_struct, uint8_t *tlv) {
         break;
       }
 
+      case TAG_FLASH_REVIEW_MODE: {
+        memcpy(&(flash_struct->review_mode), tlv + index + 2, size);
+        break;
+      }
+
+      case TAG_FLASH_POW_RATE: {
+        memcpy(&(flash_struct->pow_rate), tlv + index + 2, size);
+        break;
+      }
+
+      case TAG_FLASH_XPUB_CACHE: {
+        memcpy(&(flash_struct->xpub_cache), tlv + index + 2, size);
+        break;
+      }
+
       default: {
         break;
       }
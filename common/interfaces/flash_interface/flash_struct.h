@@ -45,6 +45,18 @@ typedef enum passphrase_config {
   PASSPHRASE_ENABLED,
 } passphrase_config;
 
+/// enum to signify how transactions with many receivers are reviewed
+typedef enum review_mode_config {
+  REVIEW_MODE_DETAILED,    ///< Every receiver is shown on its own
+  REVIEW_MODE_SUMMARY,     ///< Large batches are shown as a summary
+} review_mode_config;
+
+/// enum to signify whether account public nodes are cached in flash
+typedef enum xpub_cache_config {
+  XPUB_CACHE_DISABLED,
+  XPUB_CACHE_ENABLED,
+} xpub_cache_config;
+
 /// Different save modes when writing to instance of different flash structs
 typedef enum flash_save_mode {
   FLASH_SAVE_LATER,    ///< Signal to save later
@@ -103,6 +115,20 @@ typedef struct Flash_Wallet {
 } Flash_Wallet;
 #pragma pack(pop)
 
+/**
+ * @brief Cached hash rate of the proof of work
+ * @details Only valid on the firmware and at the core clock it was measured
+ * with; unset (DEFAULT_VALUE_IN_FLASH) on devices upgraded from older
+ * firmware.
+ */
+#pragma pack(push, 1)
+typedef struct Flash_Pow_Rate {
+  uint32_t firmware_version;
+  uint32_t core_clock_hz;
+  uint32_t hashes_per_sec;
+} Flash_Pow_Rate;
+#pragma pack(pop)
+
 /**
  * @brief Struct for storing meta data about device in flash.
  * @details
@@ -123,6 +149,9 @@ typedef struct Flash_Struct {
   uint8_t enable_passphrase;
   uint8_t enable_log;
   uint8_t onboarding_step;
+  uint8_t review_mode;
+  Flash_Pow_Rate pow_rate;
+  uint8_t xpub_cache;
 } Flash_Struct;
 #pragma pack(pop)
 
@@ -150,4 +179,11 @@ void flash_erase();
  */
 void flash_clear_user_data(void);
 
+/**
+ * @brief Saves the changes of deferred setters, if any, to flash
+ * @details Pending changes are saved on their own once the device is idle;
+ * call this before a reset or anything else that may skip the idle time.
+ */
+void flash_commit(void);
+
 #endif
@@ -54,4 +54,36 @@ const Flash_Struct *get_flash_ram_instance();
  */
 void flash_struct_save();
 
+/**
+ * @brief Marks flash_ram_instance as changed and defers the save to flash to
+ * the idle time of the current flow step.
+ * @details Setters called back to back in a flow step then cost a single save.
+ * Use flash_struct_save for changes which must not be lost on a power cut,
+ * e.g. the lock state of a wallet. @ref flash_commit forces pending changes.
+ *
+ * @private
+ */
+void flash_struct_save_later();
+
+/**
+ * @brief Saves only the challenge of the wallet, as one small journal record
+ * @details Meant for the periodic proof of work checkpoints: neither the whole
+ * structure is serialized nor any other pending change is saved. Falls back to
+ * flash_struct_save_later if the persisted image has no matching challenge.
+ *
+ * @param wallet Wallet in flash_ram_instance whose challenge changed
+ *
+ * @private
+ */
+void flash_struct_save_challenge(const Flash_Wallet *wallet);
+
+/**
+ * @brief Rebuilds the in-RAM index of the wallets in flash_ram_instance, used
+ * by the lookups of flash_api. Call after replacing flash_ram_instance.wallets
+ * as a whole, e.g. on load or erase.
+ *
+ * @private
+ */
+void flash_wallet_index_rebuild();
+
 #endif
\ No newline at end of file
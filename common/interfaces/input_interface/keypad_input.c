@@ -0,0 +1,222 @@
+/**
+ * @file    keypad_input.c
+ * @author  Cypherock X1 Team
+ * @brief   Interrupt driven joystick input with timer based debouncing
+ * @copyright Copyright (c) 2023 HODL TECH PTE LTD
+ * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
+ *target=_blank>https://mitcc.org/</a>
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * (c) Copyright 2023 by HODL TECH PTE LTD
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * "Commons Clause" License Condition v1.0
+ *
+ * The Software is provided to you by the Licensor under the License,
+ * as defined below, subject to the following condition.
+ *
+ * Without limiting other conditions in the License, the grant of
+ * rights under the License will not include, and the License does not
+ * grant to you, the right to Sell the Software.
+ *
+ * For purposes of the foregoing, "Sell" means practicing any or all
+ * of the rights granted to you under the License to provide to third
+ * parties, for a fee or other consideration (including without
+ * limitation fees for hosting or consulting/ support services related
+ * to the Software), a product or service whose value derives, entirely
+ * or substantially, from the functionality of the Software. Any license
+ * notice or attribution required by the License must also include
+ * this Commons Clause License Condition notice.
+ *
+ * Software: All X1Wallet associated files.
+ * License: MIT
+ * Licensor: HODL TECH PTE LTD
+ *
+ ******************************************************************************
+ */
+
+/*****************************************************************************
+ * INCLUDES
+ *****************************************************************************/
+#include "keypad_input.h"
+
+#include "assert_conf.h"
+#include "ui_common.h"
+
+/*****************************************************************************
+ * EXTERN VARIABLES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * PRIVATE MACROS AND DEFINES
+ *****************************************************************************/
+/// Key events queued between the timer ISR and LVGL, a power of 2
+#define KEYPAD_QUEUE_SLOTS 8
+
+/*****************************************************************************
+ * PRIVATE TYPEDEFS
+ *****************************************************************************/
+/// A settled transition of the joystick
+typedef struct keypad_event {
+  uint32_t key;    ///< Key numbered as keypad_get_key()
+  bool pressed;
+} keypad_event_t;
+
+/*****************************************************************************
+ * STATIC FUNCTION PROTOTYPES
+ *****************************************************************************/
+
+/**
+ * @brief Queues a key event, dropping it if the queue is full
+ * @details Called from the timer interrupt only (single producer).
+ */
+static void keypad_push(uint32_t key, bool pressed);
+
+/**
+ * @brief LVGL read callback; hands out the queued events in order
+ * @return bool true if more events are queued, so that LVGL reads again
+ */
+static bool keypad_read(lv_indev_drv_t *indev_drv, lv_indev_data_t *data);
+
+/**
+ * @brief Translates the key to the LVGL control character
+ */
+static uint32_t keypad_to_lv_key(uint32_t key);
+
+/*****************************************************************************
+ * STATIC VARIABLES
+ *****************************************************************************/
+static keypad_read_lines_t keypad_read_lines = NULL;
+static keypad_timer_start_t keypad_timer_start = NULL;
+
+static keypad_event_t keypad_queue[KEYPAD_QUEUE_SLOTS];
+static uint32_t keypad_queue_head = 0;
+static uint32_t keypad_queue_tail = 0;
+
+/// Last settled key, written by the timer ISR
+static volatile uint32_t keypad_settled_key = 0;
+/// Last state handed to LVGL
+static lv_indev_data_t keypad_last_data = {.state = LV_INDEV_STATE_REL};
+
+/*****************************************************************************
+ * GLOBAL VARIABLES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * STATIC FUNCTIONS
+ *****************************************************************************/
+static void keypad_push(uint32_t key, bool pressed) {
+  const uint32_t head = keypad_queue_head;
+  if (KEYPAD_QUEUE_SLOTS ==
+      head - __atomic_load_n(&keypad_queue_tail, __ATOMIC_ACQUIRE)) {
+    return;
+  }
+
+  keypad_event_t *event = &keypad_queue[head % KEYPAD_QUEUE_SLOTS];
+  event->key = key;
+  event->pressed = pressed;
+  __atomic_store_n(&keypad_queue_head, head + 1, __ATOMIC_RELEASE);
+}
+
+static bool keypad_read(lv_indev_drv_t *indev_drv, lv_indev_data_t *data) {
+  (void)indev_drv;
+  uint32_t tail = keypad_queue_tail;
+
+  if (tail != __atomic_load_n(&keypad_queue_head, __ATOMIC_ACQUIRE)) {
+    const keypad_event_t *event = &keypad_queue[tail % KEYPAD_QUEUE_SLOTS];
+    keypad_last_data.key = keypad_to_lv_key(event->key);
+    keypad_last_data.state =
+        event->pressed ? LV_INDEV_STATE_PR : LV_INDEV_STATE_REL;
+    tail++;
+    __atomic_store_n(&keypad_queue_tail, tail, __ATOMIC_RELEASE);
+  }
+
+  data->key = keypad_last_data.key;
+  data->state = keypad_last_data.state;
+  return tail != __atomic_load_n(&keypad_queue_head, __ATOMIC_ACQUIRE);
+}
+
+static uint32_t keypad_to_lv_key(uint32_t key) {
+  switch (key) {
+    case 1:
+      return LV_KEY_NEXT;
+    case 2:
+      return LV_KEY_PREV;
+    case 3:
+      return LV_KEY_LEFT;
+    case 4:
+      return LV_KEY_RIGHT;
+    case 5:
+      return LV_KEY_ENTER;
+    default:
+      return 0;
+  }
+}
+
+/*****************************************************************************
+ * GLOBAL FUNCTIONS
+ *****************************************************************************/
+void keypad_input_init(lv_indev_drv_t *indev_drv,
+                       keypad_read_lines_t read_lines,
+                       keypad_timer_start_t timer_start) {
+  ASSERT(NULL != indev_drv && NULL != read_lines && NULL != timer_start);
+
+  keypad_read_lines = read_lines;
+  keypad_timer_start = timer_start;
+  keypad_settled_key = read_lines();
+  keypad_queue_head = keypad_queue_tail = 0;
+  indev_drv->read_cb = keypad_read;
+}
+
+void keypad_input_edge_isr(void) {
+  if (NULL != keypad_timer_start) {
+    keypad_timer_start(KEYPAD_DEBOUNCE_MS);
+  }
+}
+
+void keypad_input_timer_isr(void) {
+  if (NULL == keypad_read_lines) {
+    return;
+  }
+
+  const uint32_t key = keypad_read_lines();
+  const uint32_t settled = keypad_settled_key;
+  if (key == settled) {
+    // the lines bounced back to where they were
+    return;
+  }
+
+  if (0 != settled) {
+    keypad_push(settled, false);
+  }
+  if (0 != key) {
+    keypad_push(key, true);
+  }
+  keypad_settled_key = key;
+  ui_input_edge_isr();
+}
+
+uint32_t keypad_input_get_key(void) {
+  return keypad_settled_key;
+}
@@ -0,0 +1,94 @@
+/**
+ * @file    keypad_input.h
+ * @author  Cypherock X1 Team
+ * @brief   Interrupt driven joystick input with timer based debouncing
+ * @copyright Copyright (c) 2023 HODL TECH PTE LTD
+ * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
+ * target=_blank>https://mitcc.org/</a>
+ */
+#ifndef KEYPAD_INPUT_H
+#define KEYPAD_INPUT_H
+
+/*****************************************************************************
+ * INCLUDES
+ *****************************************************************************/
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "lvgl.h"
+
+/*****************************************************************************
+ * MACROS AND DEFINES
+ *****************************************************************************/
+/// Time the joystick lines must stay quiet after an edge to be sampled
+#define KEYPAD_DEBOUNCE_MS 5
+
+/*****************************************************************************
+ * TYPEDEFS
+ *****************************************************************************/
+/**
+ * @brief Reads the joystick lines
+ * @details Implemented by the board port. Safe to call from interrupt context.
+ *
+ * @return uint32_t The pressed key, numbered as keypad_get_key(): 1 down,
+ * 2 up, 3 left, 4 right, 5 center; 0 if no key is pressed
+ */
+typedef uint32_t (*keypad_read_lines_t)(void);
+
+/**
+ * @brief (Re)starts the one-shot debounce timer
+ * @details Implemented by the board port over a hardware timer. Starting it
+ * while it runs pushes the expiry back; on expiry the timer interrupt calls
+ * keypad_input_timer_isr().
+ *
+ * @param ms Time to expiry in milliseconds
+ */
+typedef void (*keypad_timer_start_t)(uint32_t ms);
+
+/*****************************************************************************
+ * EXPORTED VARIABLES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * GLOBAL FUNCTION PROTOTYPES
+ *****************************************************************************/
+
+/**
+ * @brief Installs the interrupt driven joystick input in the keypad driver
+ * @details Sets the read callback of the driver. Call before
+ * lv_indev_drv_register(). Key presses and releases are queued from the
+ * debounce timer interrupt, so a press released before LVGL reads the keypad
+ * is still delivered, and each queued event wakes the event loop through
+ * ui_input_edge_isr().
+ *
+ * @param indev_drv Keypad driver being initialized
+ * @param read_lines Routine of the board reading the joystick lines
+ * @param timer_start Routine of the board starting the debounce timer
+ */
+void keypad_input_init(lv_indev_drv_t *indev_drv,
+                       keypad_read_lines_t read_lines,
+                       keypad_timer_start_t timer_start);
+
+/**
+ * @brief Reports an edge on any of the joystick lines
+ * @details To be called from the EXTI interrupt of the lines. Restarts the
+ * debounce timer so that the lines are sampled once they settle.
+ */
+void keypad_input_edge_isr(void);
+
+/**
+ * @brief Samples the settled joystick lines
+ * @details To be called from the debounce timer interrupt. Queues a release
+ * and/or a press if the key differs from the last settled one.
+ */
+void keypad_input_timer_isr(void);
+
+/**
+ * @brief Returns the last settled key
+ * @details Backs keypad_get_key() on boards using this driver.
+ *
+ * @return uint32_t The pressed key, 0 if none
+ */
+uint32_t keypad_input_get_key(void);
+
+#endif /* KEYPAD_INPUT_H */
@@ -58,8 +58,23 @@
  */
 #include "ui_common.h"
 
+#include "events.h"
+
+#ifdef DEV_BUILD
+#include "ui_profiler.h"
+#endif
+
+/// Keypad read period while no key is held; edges trigger a read right away
+#define UI_INDEV_IDLE_READ_PERIOD 250
+
 static struct UI *ui;
 
+static bool ui_refresh_on = true;
+static bool ui_fast_read = true;
+/// Set once the board reports edges, before that the keypad is always polled
+static volatile bool ui_edge_source = false;
+static volatile bool ui_edge_pending = false;
+
 const char *ALPHABET = "ABCDEFGHIJKLMNOPQRSTUVWXYZ";
 const char *ALPHA_NUMERIC = "ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789";
 const char *NUMBERS = "0123456789";
@@ -346,6 +361,9 @@ void ui_init(lv_indev_t *kb_indev) {
 
   ui->keyboard = kb_indev;
   ui->theme = DARK;
+#ifdef DEV_BUILD
+  ui_profiler_init(kb_indev);
+#endif
 }
 
 lv_group_t *ui_get_group() {
@@ -360,6 +378,78 @@ lv_indev_t *ui_get_indev() {
   return ui->keyboard;
 }
 
+/**
+ * @brief Tells if the display has anything to draw
+ */
+static bool ui_needs_redraw(void) {
+  const lv_disp_t *disp = lv_disp_get_default();
+  return 0 < disp->inv_p || 0 < lv_anim_count_running();
+}
+
+/**
+ * @brief Turns the display refresh task on or off as per the pending redraw
+ */
+static void ui_update_refresh(void) {
+  const bool needed = ui_needs_redraw();
+  if (needed == ui_refresh_on) {
+    return;
+  }
+
+  lv_task_t *refr_task = lv_disp_get_default()->refr_task;
+  ui_refresh_on = needed;
+  lv_task_set_prio(refr_task, needed ? LV_TASK_PRIO_MID : LV_TASK_PRIO_OFF);
+  if (needed) {
+    lv_task_ready(refr_task);
+  }
+}
+
+/**
+ * @brief Adjusts the keypad read period as per the key state & pending edges
+ */
+static void ui_update_input_polling(void) {
+  if (!ui_edge_source || NULL == ui) {
+    return;
+  }
+
+  lv_task_t *read_task = ui->keyboard->driver.read_task;
+  const bool edge = ui_edge_pending;
+  ui_edge_pending = false;
+  const bool fast =
+      edge || LV_INDEV_STATE_PR == ui->keyboard->proc.state ||
+      LV_INDEV_STATE_PR == ui->keyboard->proc.types.keypad.last_state;
+
+  if (fast != ui_fast_read) {
+    ui_fast_read = fast;
+    lv_task_set_period(
+        read_task, fast ? LV_INDEV_DEF_READ_PERIOD : UI_INDEV_IDLE_READ_PERIOD);
+  }
+  if (edge) {
+    lv_task_ready(read_task);
+  }
+}
+
+bool ui_task_handler(void) {
+  ui_update_refresh();
+  ui_update_input_polling();
+#ifdef DEV_BUILD
+  ui_profiler_handler_begin();
+#endif
+  lv_task_handler();
+#ifdef DEV_BUILD
+  ui_profiler_handler_end();
+#endif
+  return !ui_refresh_on && ui_needs_redraw();
+}
+
+void ui_input_edge_isr(void) {
+#ifdef DEV_BUILD
+  ui_profiler_input_edge();
+#endif
+  ui_edge_source = true;
+  ui_edge_pending = true;
+  events_signal_wakeup();
+}
+
 inline void ui_set_event_over_cb(void (*event_over_cb)()) {
   ui_mark_event_over = event_over_cb;
 }
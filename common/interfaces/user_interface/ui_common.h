@@ -396,4 +396,26 @@ lv_group_t *ui_get_group();
  */
 lv_indev_t *ui_get_indev();
 
+/**
+ * @brief Runs the LVGL tasks, refreshing the display only when needed
+ * @details Replaces a plain lv_task_handler() call in the event loop. The
+ * display refresh task is kept off while nothing is invalidated and no
+ * animation runs, and is made ready as soon as something is. Once the board
+ * reports joystick edges via ui_input_edge_isr(), the keypad is polled at the
+ * LVGL read period only while a key is held or right after an edge, and at
+ * UI_INDEV_IDLE_READ_PERIOD otherwise.
+ *
+ * @return bool true if an area was invalidated during the call, in which case
+ * the caller should call again without sleeping so that it gets drawn
+ */
+bool ui_task_handler(void);
+
+/**
+ * @brief Reports a change of the joystick state
+ * @details To be called from interrupt context once the joystick lines settle
+ * (keypad_input_timer_isr() does); wakes the event loop to read the keypad
+ * right away.
+ */
+void ui_input_edge_isr(void);
+
 #endif
\ No newline at end of file
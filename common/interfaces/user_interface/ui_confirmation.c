@@ -64,26 +64,55 @@
 #include "dev_utils.h"
 #endif
 
+static struct Confirm_Data confirm_data;
+static struct Confirm_Object confirm_obj;
 static struct Confirm_Data *data = NULL;
 static struct Confirm_Object *obj = NULL;
 
-void confirm_scr_init(const char *text) {
-  ASSERT(text != NULL);
+static void confirm_scr_destructor();
 
-  lv_obj_clean(lv_scr_act());
+/**
+ * @brief Tells if the objects of the previous confirm screen are still on the
+ * active screen with nothing else added, so that they can be re-bound
+ */
+static bool confirm_scr_reusable() {
+  return (obj != NULL) && (lv_scr_act() == lv_obj_get_screen(obj->text)) &&
+         (3 == lv_obj_count_children(lv_scr_act()));
+}
 
-  data = malloc(sizeof(struct Confirm_Data));
-  obj = malloc(sizeof(struct Confirm_Object));
+/**
+ * @brief Re-binds the objects of the previous confirm screen to the new text
+ */
+static void confirm_scr_rebind() {
+  ui_paragraph(obj->text, data->text, LV_LABEL_ALIGN_CENTER);
+  lv_btn_set_state(obj->cancel_btn, LV_BTN_STATE_REL);
+  lv_btn_set_state(obj->next_btn, LV_BTN_STATE_REL);
 
-  if (data != NULL) {
-    data->text = (char *)text;
+  confirm_scr_focus_next();
+}
+
+void confirm_scr_init(const char *text) {
+  ASSERT(text != NULL);
+
+  const bool reuse = confirm_scr_reusable();
+  if (!reuse) {
+    lv_obj_clean(lv_scr_act());
+    confirm_scr_destructor();
   }
 
+  data = &confirm_data;
+  obj = &confirm_obj;
+  data->text = (char *)text;
+
 #ifdef DEV_BUILD
   ekp_enqueue(LV_KEY_UP, DEFAULT_DELAY);
   ekp_enqueue(LV_KEY_ENTER, DEFAULT_DELAY);
 #endif
-  confirm_scr_create();
+  if (reuse) {
+    confirm_scr_rebind();
+  } else {
+    confirm_scr_create();
+  }
 }
 
 /**
@@ -103,11 +132,10 @@ void confirm_scr_init(const char *text) {
 static void confirm_scr_destructor() {
   if (data != NULL) {
     memzero(data, sizeof(struct Confirm_Data));
-    free(data);
     data = NULL;
   }
   if (obj != NULL) {
-    free(obj);
+    memzero(obj, sizeof(struct Confirm_Object));
     obj = NULL;
   }
 }
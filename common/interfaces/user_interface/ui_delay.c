@@ -77,11 +77,14 @@ void delay_scr_init(const char message[], const uint32_t delay_in_ms) {
   lv_obj_align(instruction, NULL, LV_ALIGN_CENTER, 0, 0);
   lv_label_set_text(instruction, message);
 
-  lv_task_handler();
+  ui_task_handler();
 
   // Now text should be shown on screen
 
+  // the session benchmark build does not hold the screens
+#ifndef SESSION_BENCH
   BSP_DelayMs(delay_in_ms);
+#endif
 
   /* TODO: Remove callback and refactor api to use time event instead of hard
    * delay */
@@ -66,6 +66,10 @@
 
 #include "memzero.h"
 
+#ifdef DEV_BUILD
+#include "ui_profiler.h"
+#endif
+
 /*****************************************************************************
  * EXTERN VARIABLES
  *****************************************************************************/
@@ -117,18 +121,27 @@ void ui_reset_event() {
 }
 
 void ui_set_confirm_event() {
+#ifdef DEV_BUILD
+  ui_profiler_input_event();
+#endif
   ui_event.event_occured = true;
   ui_event.event_type = UI_EVENT_CONFIRM;
   return;
 }
 
 void ui_set_cancel_event() {
+#ifdef DEV_BUILD
+  ui_profiler_input_event();
+#endif
   ui_event.event_occured = true;
   ui_event.event_type = UI_EVENT_REJECT;
   return;
 }
 
 void ui_set_list_event(uint16_t list_selection) {
+#ifdef DEV_BUILD
+  ui_profiler_input_event();
+#endif
   ui_event.event_occured = true;
   ui_event.event_type = UI_EVENT_LIST_CHOICE;
   ui_event.list_selection = list_selection;
@@ -140,6 +153,9 @@ void ui_set_text_input_event(char *text_ptr) {
     return;
   }
 
+#ifdef DEV_BUILD
+  ui_profiler_input_event();
+#endif
   ui_event.event_occured = true;
   ui_event.event_type = UI_EVENT_TEXT_INPUT;
   ui_event.text_ptr = text_ptr;
@@ -127,13 +127,12 @@ static struct LvObjects *obj = NULL;
 int get_first_index(const char word[3]) {
   ASSERT(word != NULL);
 
-  for (int i = 0; i <= 2047; i++) {
-    if ((word[0] + 32 == mnemonic_get_word(i)[0]) &&
-        (word[1] + 32 == mnemonic_get_word(i)[1])) {
-      return i;
-    }
+  const char prefix[2] = {word[0] + 32, word[1] + 32};
+  int first = 0, last = 0;
+  if (!mnemonic_find_prefix(prefix, sizeof(prefix), &first, &last)) {
+    return -1;
   }
-  return -1;
+  return first;
 }
 
 /**
@@ -146,13 +145,12 @@ int get_first_index(const char word[3]) {
 int get_last_index(const char word[3]) {
   ASSERT(word != NULL);
 
-  for (int i = 2047; i >= 0; --i) {
-    if ((word[0] + 32 == mnemonic_get_word(i)[0]) &&
-        (word[1] + 32 == mnemonic_get_word(i)[1])) {
-      return i;
-    }
+  const char prefix[2] = {word[0] + 32, word[1] + 32};
+  int first = 0, last = 0;
+  if (!mnemonic_find_prefix(prefix, sizeof(prefix), &first, &last)) {
+    return -1;
   }
-  return -1;
+  return last;
 }
 
 /**
@@ -172,16 +170,16 @@ int get_last_index(const char word[3]) {
 static void second_char_init() {
   ASSERT(data != NULL);
 
-  data->second_char_ind = 0;
+  const char prefix = data->text_entered[0] + 32;
+  data->second_char_ind = mnemonic_word_completion_mask(&prefix, 1);
   int16_t low = -1;
   int16_t high = 0;
 
-  for (int i = 0; i <= 2047; i++) {
-    if (data->text_entered[0] + 32 == mnemonic_get_word(i)[0]) {
+  for (int16_t i = 0; i < 26; i++) {
+    if (data->second_char_ind & (1 << i)) {
       if (low < 0)
-        low = mnemonic_get_word(i)[1] - 'a';
-      data->second_char_ind |= 1 << (mnemonic_get_word(i)[1] - 'a');
-      high = mnemonic_get_word(i)[1] - 'a';
+        low = i;
+      high = i;
     }
   }
 
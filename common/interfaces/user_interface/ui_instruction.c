@@ -67,7 +67,7 @@
  * without clearing and redoing the whole operation. For changing text
  * instruction screen is much more efficient.
  *
- * You'll have to call lv_task_handler() manually and delete screen
+ * You'll have to call ui_task_handler() manually and delete screen
  * when not in use unlike delay screen.
  */
 
@@ -98,7 +98,7 @@ void instruction_scr_init(const char *message, const char *heading_text) {
     lv_obj_align(
         instruction, NULL, LV_ALIGN_CENTER, 0, lv_obj_get_height(heading) >> 1);
 
-  lv_task_handler();
+  ui_task_handler();
 }
 
 void instruction_scr_change_text(const char *new_message, bool immediate) {
@@ -113,7 +113,7 @@ void instruction_scr_change_text(const char *new_message, bool immediate) {
     lv_obj_align(
         instruction, NULL, LV_ALIGN_CENTER, 0, lv_obj_get_height(heading) >> 1);
   if (immediate == true) {
-    lv_task_handler();
+    ui_task_handler();
   }
 }
 
@@ -72,6 +72,6 @@ void logo_scr_init(const uint16_t delay_in_ms) {
       .text_align = LV_ALIGN_CENTER};
 
   multi_instruction_with_image_init(&logo_content, 1, 0, false);
-  lv_task_handler();
+  ui_task_handler();
   BSP_DelayMs(delay_in_ms);
 }
\ No newline at end of file
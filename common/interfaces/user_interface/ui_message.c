@@ -66,6 +66,8 @@
 #include "dev_utils.h"
 #endif
 
+static struct Message_Data message_data;
+static struct Message_Object message_obj;
 static struct Message_Data *data = NULL;
 static struct Message_Object *obj = NULL;
 
@@ -85,22 +87,47 @@ static struct Message_Object *obj = NULL;
  */
 static void message_scr_create();
 
-void message_scr_init(const char *message) {
-  ASSERT(message != NULL);
+static void message_scr_destructor();
+
+/**
+ * @brief Tells if the objects of the previous message screen are still on the
+ * active screen with nothing else added, so that they can be re-bound
+ */
+static bool message_scr_reusable() {
+  return (obj != NULL) && (lv_scr_act() == lv_obj_get_screen(obj->message)) &&
+         (2 == lv_obj_count_children(lv_scr_act()));
+}
 
-  lv_obj_clean(lv_scr_act());
+/**
+ * @brief Re-binds the objects of the previous message screen to the new text
+ */
+static void message_scr_rebind() {
+  ui_paragraph(obj->message, data->message, LV_LABEL_ALIGN_CENTER);
+  lv_btn_set_state(obj->next_btn, LV_BTN_STATE_REL);
+  lv_group_focus_obj(obj->next_btn);
+}
 
-  data = malloc(sizeof(struct Message_Data));
-  obj = malloc(sizeof(struct Message_Object));
+void message_scr_init(const char *message) {
+  ASSERT(message != NULL);
 
-  if (data != NULL) {
-    data->message = (char *)message;
+  const bool reuse = message_scr_reusable();
+  if (!reuse) {
+    lv_obj_clean(lv_scr_act());
+    message_scr_destructor();
   }
+
+  data = &message_data;
+  obj = &message_obj;
+  data->message = (char *)message;
 #ifdef DEV_BUILD
   ekp_enqueue(LV_KEY_UP, DEFAULT_DELAY);
   ekp_enqueue(LV_KEY_ENTER, DEFAULT_DELAY);
 #endif
-  message_scr_create();
+  if (reuse) {
+    message_scr_rebind();
+  } else {
+    message_scr_create();
+  }
 }
 
 /**
@@ -120,11 +147,10 @@ void message_scr_init(const char *message) {
 static void message_scr_destructor() {
   if (data != NULL) {
     memzero(data, sizeof(struct Message_Data));
-    free(data);
     data = NULL;
   }
   if (obj != NULL) {
-    free(obj);
+    memzero(obj, sizeof(struct Message_Object));
     obj = NULL;
   }
 }
@@ -0,0 +1,409 @@
+/**
+ * @file    ui_profiler.c
+ * @author  Cypherock X1 Team
+ * @brief   Frame time and input latency histograms of the UI (DEV builds).
+ * @copyright Copyright (c) 2023 HODL TECH PTE LTD
+ * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
+ *target=_blank>https://mitcc.org/</a>
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * (c) Copyright 2023 by HODL TECH PTE LTD
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * "Commons Clause" License Condition v1.0
+ *
+ * The Software is provided to you by the Licensor under the License,
+ * as defined below, subject to the following condition.
+ *
+ * Without limiting other conditions in the License, the grant of
+ * rights under the License will not include, and the License does not
+ * grant to you, the right to Sell the Software.
+ *
+ * For purposes of the foregoing, "Sell" means practicing any or all
+ * of the rights granted to you under the License to provide to third
+ * parties, for a fee or other consideration (including without
+ * limitation fees for hosting or consulting/ support services related
+ * to the Software), a product or service whose value derives, entirely
+ * or substantially, from the functionality of the Software. Any license
+ * notice or attribution required by the License must also include
+ * this Commons Clause License Condition notice.
+ *
+ * Software: All X1Wallet associated files.
+ * License: MIT
+ * Licensor: HODL TECH PTE LTD
+ *
+ ******************************************************************************
+ */
+
+
+/*****************************************************************************
+ * INCLUDES
+ *****************************************************************************/
+
+#ifdef DEV_BUILD
+#include "ui_profiler.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "assert_conf.h"
+#include "logger.h"
+
+#if USE_SIMULATOR == 0
+#include "board.h"
+#else
+#include <time.h>
+#endif
+
+/*****************************************************************************
+ * EXTERN VARIABLES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * PRIVATE MACROS AND DEFINES
+ *****************************************************************************/
+
+/// Refresh period of the simulator overlay
+#define UI_PROFILER_OVERLAY_PERIOD_MS 1000
+
+/*****************************************************************************
+ * PRIVATE TYPEDEFS
+ *****************************************************************************/
+
+/*****************************************************************************
+ * STATIC VARIABLES
+ *****************************************************************************/
+
+static ui_profile_hist_t hists[UI_PROFILE_METRICS] = {0};
+
+static const char *const metric_names[UI_PROFILE_METRICS] = {
+    "handler",
+    "render",
+    "flush",
+    "input",
+};
+
+static void (*orig_flush_cb)(lv_disp_drv_t *,
+                             const lv_area_t *,
+                             lv_color_t *) = NULL;
+static bool (*orig_read_cb)(lv_indev_drv_t *, lv_indev_data_t *) = NULL;
+
+/// State of the lv_task_handler() call in progress
+static uint32_t handler_start = 0;
+static uint32_t handler_flush_us = 0;
+static bool handler_refreshed = false;
+
+/// Start of the pending input latency sample
+static volatile uint32_t input_start = 0;
+static volatile bool input_pending = false;
+/// Set once the board reports key edges; till then the reads are watched
+static volatile bool input_edge_source = false;
+static lv_indev_state_t input_last_state = LV_INDEV_STATE_REL;
+
+#if USE_SIMULATOR == 1
+static lv_obj_t *overlay = NULL;
+#endif
+
+/*****************************************************************************
+ * GLOBAL VARIABLES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * STATIC FUNCTION PROTOTYPES
+ *****************************************************************************/
+
+/**
+ * @brief Returns the current time stamp, in cycles on the device
+ */
+static uint32_t stamp_now(void);
+
+/**
+ * @brief Returns the microseconds elapsed since the time stamp
+ */
+static uint32_t elapsed_us(uint32_t start);
+
+/**
+ * @brief Adds a duration to the histogram of the metric
+ */
+static void hist_add(ui_profile_metric_e metric, uint32_t us);
+
+/**
+ * @brief Returns the upper bound in microseconds of the bucket holding the
+ * given fraction (in percent) of the samples
+ */
+static uint32_t hist_percentile(const ui_profile_hist_t *hist,
+                                uint8_t percent);
+
+/**
+ * @brief Flush callback of the display timing the original one
+ */
+static void profiler_flush(lv_disp_drv_t *disp_drv,
+                           const lv_area_t *area,
+                           lv_color_t *color_p);
+
+/**
+ * @brief Monitor callback of the display, called once a frame is refreshed
+ */
+static void profiler_monitor(lv_disp_drv_t *disp_drv,
+                             uint32_t time,
+                             uint32_t px);
+
+/**
+ * @brief Read callback of the keypad starting a latency sample on every key
+ * change if the board does not report key edges
+ */
+static bool profiler_read(lv_indev_drv_t *indev_drv, lv_indev_data_t *data);
+
+#if USE_SIMULATOR == 1
+/**
+ * @brief Shows the average and the worst time of each metric on the overlay
+ */
+static void overlay_update(lv_task_t *task);
+#endif
+
+/*****************************************************************************
+ * STATIC FUNCTIONS
+ *****************************************************************************/
+
+#if USE_SIMULATOR == 0
+static uint32_t stamp_now(void) {
+  return DWT->CYCCNT;
+}
+
+static uint32_t elapsed_us(uint32_t start) {
+  // the counter wraps after a minute at 80 MHz, far above any sample
+  return (DWT->CYCCNT - start) / (SystemCoreClock / 1000000);
+}
+#else
+static uint32_t stamp_now(void) {
+  struct timespec now = {0};
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint32_t)(now.tv_sec * 1000000 + now.tv_nsec / 1000);
+}
+
+static uint32_t elapsed_us(uint32_t start) {
+  return stamp_now() - start;
+}
+#endif /* USE_SIMULATOR == 0 */
+
+static void hist_add(ui_profile_metric_e metric, uint32_t us) {
+  ui_profile_hist_t *hist = &hists[metric];
+  uint8_t bucket = (0 == us) ? 0 : (uint8_t)(32 - __builtin_clz(us));
+
+  if (UI_PROFILER_BUCKETS <= bucket) {
+    bucket = UI_PROFILER_BUCKETS - 1;
+  }
+  hist->buckets[bucket]++;
+  hist->count++;
+  hist->total_us += us;
+  if (us > hist->max_us) {
+    hist->max_us = us;
+  }
+}
+
+static uint32_t hist_percentile(const ui_profile_hist_t *hist,
+                                uint8_t percent) {
+  const uint64_t rank = ((uint64_t)hist->count * percent + 99) / 100;
+  uint64_t seen = 0;
+
+  for (uint8_t bucket = 0; bucket < UI_PROFILER_BUCKETS - 1; bucket++) {
+    seen += hist->buckets[bucket];
+    if (seen >= rank) {
+      return (0 == bucket) ? 0 : ((uint32_t)1 << bucket) - 1;
+    }
+  }
+  return hist->max_us;
+}
+
+static void profiler_flush(lv_disp_drv_t *disp_drv,
+                           const lv_area_t *area,
+                           lv_color_t *color_p) {
+  const uint32_t start = stamp_now();
+  orig_flush_cb(disp_drv, area, color_p);
+  handler_flush_us += elapsed_us(start);
+}
+
+static void profiler_monitor(lv_disp_drv_t *disp_drv,
+                             uint32_t time,
+                             uint32_t px) {
+  (void)disp_drv;
+  (void)time;
+  (void)px;
+  handler_refreshed = true;
+}
+
+static bool profiler_read(lv_indev_drv_t *indev_drv, lv_indev_data_t *data) {
+  const bool more = orig_read_cb(indev_drv, data);
+
+  if (data->state != input_last_state) {
+    input_last_state = data->state;
+    if (!input_edge_source) {
+      input_start = stamp_now();
+      input_pending = true;
+    }
+  }
+  return more;
+}
+
+#if USE_SIMULATOR == 1
+static void overlay_update(lv_task_t *task) {
+  (void)task;
+  static const char tags[UI_PROFILE_METRICS] = {'h', 'r', 'f', 'i'};
+  char text[64] = "";
+  size_t len = 0;
+
+  for (uint8_t metric = 0; metric < UI_PROFILE_METRICS && len < sizeof(text);
+       metric++) {
+    const ui_profile_hist_t *hist = &hists[metric];
+    const uint32_t avg = (0 == hist->count) ? 0 : hist->total_us / hist->count;
+    len += snprintf(&text[len],
+                    sizeof(text) - len,
+                    "%c%lu/%lu ",
+                    tags[metric],
+                    (unsigned long)(avg / 1000),
+                    (unsigned long)(hist->max_us / 1000));
+  }
+  // only touch the label on a change, a redraw shows up in the metrics too
+  if (0 != strcmp(lv_label_get_text(overlay), text)) {
+    lv_label_set_text(overlay, text);
+  }
+}
+#endif
+
+/*****************************************************************************
+ * GLOBAL FUNCTIONS
+ *****************************************************************************/
+
+void ui_profiler_init(lv_indev_t *keypad) {
+  lv_disp_t *disp = lv_disp_get_default();
+  ASSERT(NULL != disp && NULL != keypad);
+
+#if USE_SIMULATOR == 0
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+
+  if (profiler_flush != disp->driver.flush_cb) {
+    orig_flush_cb = disp->driver.flush_cb;
+    disp->driver.flush_cb = profiler_flush;
+    disp->driver.monitor_cb = profiler_monitor;
+  }
+  if (profiler_read != keypad->driver.read_cb) {
+    orig_read_cb = keypad->driver.read_cb;
+    keypad->driver.read_cb = profiler_read;
+  }
+
+#if USE_SIMULATOR == 1
+  if (NULL == overlay) {
+    overlay = lv_label_create(lv_layer_top(), NULL);
+    lv_label_set_long_mode(overlay, LV_LABEL_LONG_CROP);
+    lv_label_set_body_draw(overlay, true);
+    lv_obj_set_width(overlay, LV_HOR_RES_MAX);
+    lv_label_set_text(overlay, "");
+    lv_obj_align(overlay, NULL, LV_ALIGN_IN_BOTTOM_LEFT, 0, 0);
+    lv_task_create(
+        overlay_update, UI_PROFILER_OVERLAY_PERIOD_MS, LV_TASK_PRIO_LOW, NULL);
+  }
+#endif
+}
+
+void ui_profiler_handler_begin(void) {
+  handler_flush_us = 0;
+  handler_refreshed = false;
+  handler_start = stamp_now();
+}
+
+void ui_profiler_handler_end(void) {
+  const uint32_t handler_us = elapsed_us(handler_start);
+
+  hist_add(UI_PROFILE_TASK_HANDLER, handler_us);
+  if (handler_refreshed) {
+    hist_add(UI_PROFILE_RENDER, handler_us - handler_flush_us);
+    hist_add(UI_PROFILE_FLUSH, handler_flush_us);
+  }
+}
+
+void ui_profiler_input_edge(void) {
+  input_edge_source = true;
+  input_start = stamp_now();
+  input_pending = true;
+}
+
+void ui_profiler_input_event(void) {
+  if (!input_pending) {
+    return;
+  }
+  input_pending = false;
+  hist_add(UI_PROFILE_INPUT, elapsed_us(input_start));
+}
+
+const ui_profile_hist_t *ui_profiler_get(ui_profile_metric_e metric) {
+  if (UI_PROFILE_METRICS <= metric) {
+    return NULL;
+  }
+  return &hists[metric];
+}
+
+void ui_profiler_reset(void) {
+  memset(hists, 0, sizeof(hists));
+}
+
+void ui_profiler_log_report(void) {
+  for (uint8_t metric = 0; metric < UI_PROFILE_METRICS; metric++) {
+    const ui_profile_hist_t *hist = &hists[metric];
+    if (0 == hist->count) {
+      continue;
+    }
+
+    LOG_CRITICAL("ui: %s n %lu avg %lu max %lu p50 %lu p95 %lu us",
+                 metric_names[metric],
+                 (unsigned long)hist->count,
+                 (unsigned long)(hist->total_us / hist->count),
+                 (unsigned long)hist->max_us,
+                 (unsigned long)hist_percentile(hist, 50),
+                 (unsigned long)hist_percentile(hist, 95));
+
+    // counts of the buckets from the first to the last one used
+    uint8_t first = 0, last = UI_PROFILER_BUCKETS - 1;
+    while (0 == hist->buckets[first]) {
+      first++;
+    }
+    while (0 == hist->buckets[last]) {
+      last--;
+    }
+    char counts[96] = "";
+    size_t len = 0;
+    for (uint8_t bucket = first; bucket <= last && len < sizeof(counts);
+         bucket++) {
+      len += snprintf(&counts[len],
+                      sizeof(counts) - len,
+                      " %lu",
+                      (unsigned long)hist->buckets[bucket]);
+    }
+    LOG_CRITICAL(
+        "ui: %s log2 us from %u:%s", metric_names[metric], first, counts);
+  }
+}
+#endif /* DEV_BUILD */
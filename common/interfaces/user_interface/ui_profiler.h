@@ -0,0 +1,119 @@
+/**
+ * @file    ui_profiler.h
+ * @author  Cypherock X1 Team
+ * @brief   Frame time and input latency histograms of the UI (DEV builds).
+ * @copyright Copyright (c) 2023 HODL TECH PTE LTD
+ * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
+ * target=_blank>https://mitcc.org/</a>
+ */
+#ifdef DEV_BUILD
+#ifndef UI_PROFILER_H
+#define UI_PROFILER_H
+
+/*****************************************************************************
+ * INCLUDES
+ *****************************************************************************/
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "lvgl.h"
+
+/*****************************************************************************
+ * MACROS AND DEFINES
+ *****************************************************************************/
+
+/// Buckets of a histogram; bucket 0 counts 0 us, bucket i > 0 counts
+/// [2^(i-1), 2^i) us and the last bucket everything above
+#define UI_PROFILER_BUCKETS 20
+
+/*****************************************************************************
+ * TYPEDEFS
+ *****************************************************************************/
+
+/**
+ * @brief Durations tracked by the profiler
+ */
+typedef enum {
+  UI_PROFILE_TASK_HANDLER = 0, ///< Every call of lv_task_handler()
+  UI_PROFILE_RENDER,    ///< Drawing of a refreshed frame, without the flush
+  UI_PROFILE_FLUSH,     ///< Handing the pixels of a frame to the display
+  UI_PROFILE_INPUT,     ///< From a key edge to the ui_event_t it produced
+  UI_PROFILE_METRICS,
+} ui_profile_metric_e;
+
+/**
+ * @brief Histogram of a duration, in microseconds
+ */
+typedef struct ui_profile_hist {
+  uint32_t count;
+  uint32_t max_us;
+  uint64_t total_us;
+  uint32_t buckets[UI_PROFILER_BUCKETS];
+} ui_profile_hist_t;
+
+/*****************************************************************************
+ * EXPORTED VARIABLES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * GLOBAL FUNCTION PROTOTYPES
+ *****************************************************************************/
+
+/**
+ * @brief Starts the cycle counter and hooks the profiler into LVGL
+ * @details Wraps the flush callback of the default display and the read
+ * callback of the keypad. Call once the display and the keypad are
+ * registered. The simulator also gets an overlay on the top layer showing the
+ * average and the worst time of each metric.
+ *
+ * @param keypad Input device of the joystick
+ */
+void ui_profiler_init(lv_indev_t *keypad);
+
+/**
+ * @brief Marks the start of an lv_task_handler() call
+ */
+void ui_profiler_handler_begin(void);
+
+/**
+ * @brief Records the lv_task_handler() call started by
+ * ui_profiler_handler_begin(), and the render & flush time if it refreshed
+ * the screen
+ */
+void ui_profiler_handler_end(void);
+
+/**
+ * @brief Marks a key edge as the start of an input latency sample. Safe to
+ * call from interrupt context.
+ */
+void ui_profiler_input_edge(void);
+
+/**
+ * @brief Records the latency from the last key edge, if not yet recorded.
+ * Call when a ui_event_t is raised.
+ */
+void ui_profiler_input_event(void);
+
+/**
+ * @brief Returns the histogram of the metric
+ *
+ * @param metric Metric to read
+ *
+ * @return const ui_profile_hist_t* Histogram, NULL for an invalid metric
+ */
+const ui_profile_hist_t *ui_profiler_get(ui_profile_metric_e metric);
+
+/**
+ * @brief Clears all the histograms, eg. before measuring a change
+ */
+void ui_profiler_reset(void);
+
+/**
+ * @brief Writes the histograms to the device logs, so that they are exported
+ * with the next log fetch
+ */
+void ui_profiler_log_report(void);
+
+#endif /* UI_PROFILER_H */
+#endif /* DEV_BUILD */
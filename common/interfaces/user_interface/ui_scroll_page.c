@@ -60,6 +60,7 @@
 
 #include "stdlib.h"
 #include "ui_events_priv.h"
+#include "ui_text_pages.h"
 #ifdef DEV_BUILD
 #include "dev_utils.h"
 #endif
@@ -67,6 +68,17 @@
 scrolling_page_data_t *gp_scrollabe_page_data = NULL;
 scrolling_page_lvgl_t *gp_scrollabe_page_lvgl = NULL;
 
+/* Storage of the screen referred by the pointers above while it is shown. The
+ * LVGL objects outlive a page when the next page re-binds them, see
+ * ui_scrollable_page_reusable() */
+static scrolling_page_data_t scroll_page_data;
+static scrolling_page_lvgl_t scroll_page_lvgl;
+
+/* Pages of the body, laid out once per screen; paging only swaps the static
+ * text of the body label to the page copied in scroll_page_text */
+static ui_text_pages_t scroll_text_pages;
+static char scroll_page_text[UI_TEXT_PAGE_MAX_SIZE];
+
 /**
  * @brief This function increments the current page
  * gp_scrollabe_page_data->curr_page_num
@@ -113,6 +125,36 @@ static void page_update_buttons(void);
  */
 static void page_update_footnote(void);
 
+/**
+ * @brief This function splits the body into pages, shows the first one and
+ * creates or deletes the footnote label as per the number of pages
+ * @details Bodies too long to paginate are rendered whole in the label and
+ * scrolled instead, with the number of pages derived from the rendered height.
+ */
+static void page_update_pagination(void);
+
+/**
+ * @brief This function shows gp_scrollabe_page_data->curr_page_num in the body
+ */
+static void page_show_current(void);
+
+/**
+ * @brief This function tells if the objects of the scrollable page on screen
+ * can be re-bound to a new page instead of cleaning the screen
+ * @details The objects are reused if they are still on the active screen with
+ * nothing else added and the heading is present on both pages or on neither
+ * (the heading decides the height of the page).
+ *
+ * @param p_page_ui_heading Heading of the new page
+ */
+static bool ui_scrollable_page_reusable(const char *p_page_ui_heading);
+
+/**
+ * @brief This function re-binds the objects in gp_scrollabe_page_lvgl to the
+ * contents of gp_scrollabe_page_data and resets the scroll position
+ */
+static void ui_scrollable_page_rebind(void);
+
 /**
  * @brief This function cleans the global memory used by the
  * ui_scrollable_page() and clears the screen
@@ -151,7 +193,7 @@ static void page_arrow_handler(lv_obj_t *pLvglArrowObject,
  * @brief This function populates LVGL objects in gp_scrollabe_page_lvgl
  * variable for a UI screen which is scrollabe, contains left/right arrow
  * buttons and cancel/accept buttons Note: Before calling this function:
- * gp_scrollabe_page_data variable should be malloced and populated with
+ * gp_scrollabe_page_data variable should point to storage populated with
  * appropriate values
  */
 static void ui_scrollable_page_create(void);
@@ -268,16 +310,95 @@ static void page_update_icons(void) {
   return;
 }
 
+static void page_update_pagination(void) {
+  ASSERT((NULL != gp_scrollabe_page_data) && (NULL != gp_scrollabe_page_lvgl));
+
+  lv_obj_t *p_body = gp_scrollabe_page_lvgl->p_ui_body_lvgl;
+  lv_obj_t *p_page = gp_scrollabe_page_lvgl->p_ui_page_lvgl;
+
+  gp_scrollabe_page_data->curr_page_num = 1;
+  lv_obj_set_y(lv_page_get_scrl(p_page), 0);
+  gp_scrollabe_page_data->bool_paginated =
+      ui_text_pages_layout(&scroll_text_pages,
+                           gp_scrollabe_page_data->p_ui_body,
+                           lv_label_get_style(p_body, LV_LABEL_STYLE_MAIN),
+                           lv_obj_get_width(p_body),
+                           lv_obj_get_height(p_page));
+
+  if (gp_scrollabe_page_data->bool_paginated) {
+    gp_scrollabe_page_data->total_page_num = scroll_text_pages.page_count;
+    ui_text_pages_get(&scroll_text_pages, 0, scroll_page_text);
+    lv_label_set_static_text(p_body, scroll_page_text);
+  } else {
+    lv_label_set_text(p_body, gp_scrollabe_page_data->p_ui_body);
+  }
+  lv_obj_align(p_body, p_page, LV_ALIGN_IN_TOP_MID, 0, 0);
+  lv_obj_align(gp_scrollabe_page_lvgl->p_ui_padding_lvgl,
+               p_body,
+               LV_ALIGN_OUT_BOTTOM_MID,
+               0,
+               0);
+
+  if (!gp_scrollabe_page_data->bool_paginated) {
+    /**
+     * Calculate the number of pages/max number of times full scrolling can
+     * take place Total number of scrolls = Total height of content on page /
+     * Height of page We have already padded the content on page with label
+     * paddingLabel and therefore we do not need to consider padding here
+     */
+    int16_t totalPageHeight = (int16_t)lv_page_get_scrl_height(p_page);
+    int16_t currPageHeight = (int16_t)lv_obj_get_height(p_page);
+    ASSERT(0 != currPageHeight);
+    gp_scrollabe_page_data->total_page_num = totalPageHeight / currPageHeight;
+  }
+
+  /**
+   * Label gp_scrollabe_page_lvgl->p_ui_footnote_lvgl holds the text that goes
+   * as part of a footnote on the current screen
+   * Footnote to be shown only if total pages > 1
+   */
+  if (1 < gp_scrollabe_page_data->total_page_num) {
+    if (NULL == gp_scrollabe_page_lvgl->p_ui_footnote_lvgl) {
+      gp_scrollabe_page_lvgl->p_ui_footnote_lvgl =
+          lv_label_create(lv_scr_act(), NULL);
+    }
+  } else if (NULL != gp_scrollabe_page_lvgl->p_ui_footnote_lvgl) {
+    lv_obj_del(gp_scrollabe_page_lvgl->p_ui_footnote_lvgl);
+    gp_scrollabe_page_lvgl->p_ui_footnote_lvgl = NULL;
+  }
+
+  return;
+}
+
+static void page_show_current(void) {
+  ASSERT((NULL != gp_scrollabe_page_data) && (NULL != gp_scrollabe_page_lvgl));
+
+  if (gp_scrollabe_page_data->bool_paginated) {
+    ui_text_pages_get(&scroll_text_pages,
+                      gp_scrollabe_page_data->curr_page_num - 1,
+                      scroll_page_text);
+    lv_label_set_static_text(gp_scrollabe_page_lvgl->p_ui_body_lvgl,
+                             scroll_page_text);
+  } else {
+    lv_obj_set_y(lv_page_get_scrl(gp_scrollabe_page_lvgl->p_ui_page_lvgl),
+                 -(gp_scrollabe_page_data->curr_page_num - 1) *
+                     lv_obj_get_height(gp_scrollabe_page_lvgl->p_ui_page_lvgl));
+  }
+
+  lv_obj_align(
+      gp_scrollabe_page_lvgl->p_ui_body_lvgl, NULL, LV_ALIGN_IN_TOP_MID, 0, 0);
+
+  return;
+}
+
 static void ui_scrollable_destructor(void) {
   if (NULL != gp_scrollabe_page_data) {
     memzero(gp_scrollabe_page_data, sizeof(scrolling_page_data_t));
-    free(gp_scrollabe_page_data);
     gp_scrollabe_page_data = NULL;
   }
 
   if (NULL != gp_scrollabe_page_lvgl) {
     memzero(gp_scrollabe_page_lvgl, sizeof(scrolling_page_lvgl_t));
-    free(gp_scrollabe_page_lvgl);
     gp_scrollabe_page_lvgl = NULL;
   }
 
@@ -387,19 +508,7 @@ static void page_arrow_handler(lv_obj_t *pLvglArrowObject,
           lv_label_set_style(gp_scrollabe_page_lvgl->p_ui_right_arrow_lvgl,
                              LV_LABEL_STYLE_MAIN,
                              &(gp_scrollabe_page_lvgl->ui_arrow_pressed_style));
-
-          lv_obj_t *p_scrollable =
-              lv_page_get_scrl(gp_scrollabe_page_lvgl->p_ui_page_lvgl);
-          lv_coord_t page_y = lv_obj_get_y(p_scrollable);
-          lv_obj_set_y(p_scrollable,
-                       page_y - lv_obj_get_height(
-                                    gp_scrollabe_page_lvgl->p_ui_page_lvgl));
-
-          lv_obj_align(gp_scrollabe_page_lvgl->p_ui_body_lvgl,
-                       NULL,
-                       LV_ALIGN_IN_TOP_MID,
-                       0,
-                       0);
+          page_show_current();
           page_update_icons();
         }
       } else if (LV_KEY_LEFT == keyPressed) {
@@ -407,18 +516,7 @@ static void page_arrow_handler(lv_obj_t *pLvglArrowObject,
           lv_label_set_style(gp_scrollabe_page_lvgl->p_ui_left_arrow_lvgl,
                              LV_LABEL_STYLE_MAIN,
                              &(gp_scrollabe_page_lvgl->ui_arrow_pressed_style));
-          lv_obj_t *p_scrollable =
-              lv_page_get_scrl(gp_scrollabe_page_lvgl->p_ui_page_lvgl);
-          lv_coord_t page_y = lv_obj_get_y(p_scrollable);
-          lv_obj_set_y(p_scrollable,
-                       page_y + lv_obj_get_height(
-                                    gp_scrollabe_page_lvgl->p_ui_page_lvgl));
-
-          lv_obj_align(gp_scrollabe_page_lvgl->p_ui_body_lvgl,
-                       NULL,
-                       LV_ALIGN_IN_TOP_MID,
-                       0,
-                       0);
+          page_show_current();
           page_update_icons();
         }
       } else if (LV_KEY_DOWN == keyPressed) {
@@ -460,9 +558,8 @@ static void page_arrow_handler(lv_obj_t *pLvglArrowObject,
 static void ui_scrollable_page_create(void) {
   ASSERT(NULL != gp_scrollabe_page_data);
 
-  gp_scrollabe_page_lvgl =
-      (scrolling_page_lvgl_t *)malloc(sizeof(scrolling_page_lvgl_t));
-  ASSERT(NULL != gp_scrollabe_page_lvgl);
+  gp_scrollabe_page_lvgl = &scroll_page_lvgl;
+  memzero(gp_scrollabe_page_lvgl, sizeof(scrolling_page_lvgl_t));
 
   lv_coord_t scroll_page_height = 48;
   lv_align_t scroll_page_aligment = LV_ALIGN_IN_TOP_MID;
@@ -526,8 +623,6 @@ static void ui_scrollable_page_create(void) {
       gp_scrollabe_page_lvgl->p_ui_body_lvgl,
       lv_page_get_fit_width(gp_scrollabe_page_lvgl->p_ui_page_lvgl) - 16,
       lv_page_get_fit_height(gp_scrollabe_page_lvgl->p_ui_page_lvgl));
-  lv_label_set_text(gp_scrollabe_page_lvgl->p_ui_body_lvgl,
-                    gp_scrollabe_page_data->p_ui_body);
   lv_label_set_align(gp_scrollabe_page_lvgl->p_ui_body_lvgl,
                      LV_LABEL_ALIGN_CENTER);
   lv_obj_align(gp_scrollabe_page_lvgl->p_ui_body_lvgl,
@@ -549,6 +644,7 @@ static void ui_scrollable_page_create(void) {
    */
   lv_obj_t *paddingLabel =
       lv_label_create(gp_scrollabe_page_lvgl->p_ui_page_lvgl, NULL);
+  gp_scrollabe_page_lvgl->p_ui_padding_lvgl = paddingLabel;
   lv_label_set_long_mode(paddingLabel, LV_LABEL_LONG_BREAK);
   lv_obj_set_size(
       paddingLabel,
@@ -625,20 +721,6 @@ static void ui_scrollable_page_create(void) {
   lv_label_set_body_draw(gp_scrollabe_page_lvgl->p_ui_left_arrow_lvgl, true);
   lv_label_set_body_draw(gp_scrollabe_page_lvgl->p_ui_right_arrow_lvgl, true);
 
-  /**
-   * Calculate the number of pages/max number of times full scrolling can take
-   * place Total number of scrolls = Total height of content on page / Height of
-   * page We have already padded the content on page with label paddingLabel and
-   * therefore we do not need to consider padding here
-   */
-  int16_t totalPageHeight =
-      (int16_t)lv_page_get_scrl_height(gp_scrollabe_page_lvgl->p_ui_page_lvgl);
-  int16_t currPageHeight =
-      (int16_t)lv_obj_get_height(gp_scrollabe_page_lvgl->p_ui_page_lvgl);
-  ASSERT(0 != currPageHeight);
-  gp_scrollabe_page_data->curr_page_num = 1;
-  gp_scrollabe_page_data->total_page_num = totalPageHeight / currPageHeight;
-
   /**
    * Create buttons on the screen for cancellation and confirmation.
    * These buttons will be visible conditionally (if the current page is the
@@ -658,16 +740,8 @@ static void ui_scrollable_page_create(void) {
               gp_scrollabe_page_data->bool_accept_cancel_hidden);
   lv_obj_set_size(gp_scrollabe_page_lvgl->p_ui_accept_btn_lvgl, 16, 16);
 
-  /**
-   * Create a label gp_scrollabe_page_lvgl->p_ui_footnote_lvgl which holds the
-   * text that goes as part of a footnote on the current screen
-   * Footnote to be shown only if total pages > 1
-   */
-  gp_scrollabe_page_lvgl->p_ui_footnote_lvgl = NULL;
-  if (1 < gp_scrollabe_page_data->total_page_num) {
-    gp_scrollabe_page_lvgl->p_ui_footnote_lvgl =
-        lv_label_create(lv_scr_act(), NULL);
-  }
+  /* Split the body into pages and create the footnote if needed */
+  page_update_pagination();
 
   /* Update all icons: Left/right arrows, Accept/Cancel buttons and Footnote */
   page_update_icons();
@@ -675,6 +749,59 @@ static void ui_scrollable_page_create(void) {
   return;
 }
 
+static bool ui_scrollable_page_reusable(const char *p_page_ui_heading) {
+  if ((NULL == gp_scrollabe_page_data) || (NULL == gp_scrollabe_page_lvgl)) {
+    return false;
+  }
+
+  if ((NULL == p_page_ui_heading) !=
+      (NULL == gp_scrollabe_page_data->p_ui_heading)) {
+    return false;
+  }
+
+  /* Page, arrows and buttons; heading and footnote are optional */
+  uint16_t obj_count = 5;
+  if (NULL != gp_scrollabe_page_lvgl->p_ui_header_lvgl) {
+    obj_count++;
+  }
+  if (NULL != gp_scrollabe_page_lvgl->p_ui_footnote_lvgl) {
+    obj_count++;
+  }
+
+  return (lv_scr_act() ==
+          lv_obj_get_screen(gp_scrollabe_page_lvgl->p_ui_page_lvgl)) &&
+         (obj_count == lv_obj_count_children(lv_scr_act()));
+}
+
+static void ui_scrollable_page_rebind(void) {
+  ASSERT((NULL != gp_scrollabe_page_data) && (NULL != gp_scrollabe_page_lvgl));
+
+  if (NULL != gp_scrollabe_page_data->p_ui_heading) {
+    ui_heading(gp_scrollabe_page_lvgl->p_ui_header_lvgl,
+               gp_scrollabe_page_data->p_ui_heading,
+               LV_HOR_RES - 20,
+               LV_LABEL_ALIGN_CENTER);
+  }
+
+  /* Drop the state left by the user's input on the previous page */
+  lv_label_set_style(gp_scrollabe_page_lvgl->p_ui_left_arrow_lvgl,
+                     LV_LABEL_STYLE_MAIN,
+                     &(gp_scrollabe_page_lvgl->ui_arrow_released_style));
+  lv_label_set_style(gp_scrollabe_page_lvgl->p_ui_right_arrow_lvgl,
+                     LV_LABEL_STYLE_MAIN,
+                     &(gp_scrollabe_page_lvgl->ui_arrow_released_style));
+  lv_btn_set_state(gp_scrollabe_page_lvgl->p_ui_cancel_btn_lvgl,
+                   LV_BTN_STATE_REL);
+  lv_btn_set_state(gp_scrollabe_page_lvgl->p_ui_accept_btn_lvgl,
+                   LV_BTN_STATE_REL);
+  lv_group_focus_obj(gp_scrollabe_page_lvgl->p_ui_body_lvgl);
+
+  page_update_pagination();
+  page_update_icons();
+
+  return;
+}
+
 void ui_scrollable_page(const char *p_page_ui_heading,
                         const char *p_page_ui_body,
                         e_scrollable_page_orientation_t page_orientation,
@@ -683,11 +810,13 @@ void ui_scrollable_page(const char *p_page_ui_heading,
     return;
   }
 
-  lv_obj_clean(lv_scr_act());
+  if (!ui_scrollable_page_reusable(p_page_ui_heading)) {
+    lv_obj_clean(lv_scr_act());
+    /* Forget a previous page which is not on the active screen */
+    ui_scrollable_destructor();
+  }
 
-  gp_scrollabe_page_data =
-      (scrolling_page_data_t *)malloc(sizeof(scrolling_page_data_t));
-  ASSERT(NULL != gp_scrollabe_page_data);
+  gp_scrollabe_page_data = &scroll_page_data;
 
   gp_scrollabe_page_data->p_ui_heading = p_page_ui_heading;
   gp_scrollabe_page_data->p_ui_body = p_page_ui_body;
@@ -702,7 +831,11 @@ void ui_scrollable_page(const char *p_page_ui_heading,
   gp_scrollabe_page_data->bool_right_arrow_hidden = true;
   gp_scrollabe_page_data->bool_accept_cancel_hidden = false;
 
-  ui_scrollable_page_create();
+  if (NULL != gp_scrollabe_page_lvgl) {
+    ui_scrollable_page_rebind();
+  } else {
+    ui_scrollable_page_create();
+  }
 
 #ifdef DEV_BUILD
   ekp_enqueue(LV_KEY_UP, DEFAULT_DELAY);
@@ -26,6 +26,7 @@ typedef struct {
   bool bool_right_arrow_hidden;
   bool bool_accept_cancel_visible;
   bool bool_accept_cancel_hidden;
+  bool bool_paginated;
 } scrolling_page_data_t;
 
 typedef struct {
@@ -33,6 +34,7 @@ typedef struct {
   lv_obj_t *p_ui_header_lvgl;
   lv_style_t ui_header_style;
   lv_obj_t *p_ui_body_lvgl;
+  lv_obj_t *p_ui_padding_lvgl;
   lv_obj_t *p_ui_left_arrow_lvgl;
   lv_obj_t *p_ui_right_arrow_lvgl;
   lv_style_t ui_arrow_pressed_style;
@@ -71,6 +73,10 @@ typedef enum {
  * @param bool_cancel_accept_btn_visible If true, then accept and cancel button
  * is visible in every page If false, then accept and cancel button is only
  * visible at the last page
+ *
+ * @note If the screen still shows the objects of the previous scrollable page
+ * (with or without a heading, as for this page), they are re-bound to the new
+ * text instead of being deleted and created again.
  */
 void ui_scrollable_page(const char *p_page_ui_heading,
                         const char *p_page_ui_body,
@@ -1,7 +1,7 @@
 /**
- * @file    eth_app.c
+ * @file    ui_text_pages.c
  * @author  Cypherock X1 Team
- * @brief   Ethereum application configuration and helpers
+ * @brief   Splits a text into screen sized pages using the font metrics
  * @copyright Copyright (c) 2023 HODL TECH PTE LTD
  * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
  *target=_blank>https://mitcc.org/</a>
@@ -59,25 +59,16 @@
 /*****************************************************************************
  * INCLUDES
  *****************************************************************************/
+#include "ui_text_pages.h"
 
-#include "eth_app.h"
+#include <string.h>
 
-#include "evm_main.h"
+#include "assert_conf.h"
 
 /*****************************************************************************
  * EXTERN VARIABLES
  *****************************************************************************/
 
-/**
- * @brief Whitelisted contracts with respective token symbol
- * @details A map of Ethereum contract addresses with their token symbols. These
- * will enable the device to verify the ERC20 token transaction in a
- * user-friendly manner.
- *
- * @see erc20_contracts_t
- */
-extern const erc20_contracts_t eth_contracts[];
-
 /*****************************************************************************
  * PRIVATE MACROS AND DEFINES
  *****************************************************************************/
@@ -90,42 +81,10 @@ extern const erc20_contracts_t eth_contracts[];
  * STATIC FUNCTION PROTOTYPES
  *****************************************************************************/
 
-/**
- * @brief Checks if the provided token address is whitelisted and return the
- * matching contract instance.
- *
- * @param address Reference to the buffer containing the token address
- * @param contract Pointer to store the matched contract address instance
- *
- * @return bool Indicating if the provided token address is whitelisted
- * @return true If the address matches to an entry in the whitelist
- * @return false If the address does not match to an entry in the whitelist
- */
-static bool is_token_whitelisted(const uint8_t *address,
-                                 const erc20_contracts_t **contract);
-
 /*****************************************************************************
  * STATIC VARIABLES
  *****************************************************************************/
 
-static const evm_config_t eth_app_config = {
-    .lunit_name = "ETH",
-    .name = "Ethereum",
-    .chain_id = 1,
-
-    .is_token_whitelisted = is_token_whitelisted,
-};
-
-static const cy_app_desc_t eth_app_desc = {.id = 7,
-                                           .version =
-                                               {
-                                                   .major = 1,
-                                                   .minor = 0,
-                                                   .patch = 0,
-                                               },
-                                           .app = evm_main,
-                                           .app_config = &eth_app_config};
-
 /*****************************************************************************
  * GLOBAL VARIABLES
  *****************************************************************************/
@@ -134,28 +93,79 @@ static const cy_app_desc_t eth_app_desc = {.id = 7,
  * STATIC FUNCTIONS
  *****************************************************************************/
 
-static bool is_token_whitelisted(const uint8_t *address,
-                                 const erc20_contracts_t **contract) {
-  const erc20_contracts_t *match = NULL;
-  bool status = false;
-  for (int16_t i = 0; i < ETH_WHITELISTED_CONTRACTS_COUNT; i++) {
-    if (memcmp(address, eth_contracts[i].address, EVM_ADDRESS_LENGTH) == 0) {
-      match = &eth_contracts[i];
-      status = true;
+/*****************************************************************************
+ * GLOBAL FUNCTIONS
+ *****************************************************************************/
+bool ui_text_pages_layout(ui_text_pages_t *pages,
+                          const char *text,
+                          const lv_style_t *style,
+                          lv_coord_t width,
+                          lv_coord_t height) {
+  ASSERT(NULL != pages && NULL != text && NULL != style);
+
+  const lv_font_t *font = style->text.font;
+  const lv_coord_t line_height =
+      lv_font_get_line_height(font) + style->text.line_space;
+  // the last line of a page needs no line space below it
+  uint16_t lines_per_page = (height + style->text.line_space) / line_height;
+  if (0 == lines_per_page) {
+    lines_per_page = 1;
+  }
+
+  const size_t length = strlen(text);
+  if (UINT16_MAX < length) {
+    return false;
+  }
+
+  pages->text = text;
+  pages->page_count = 0;
+  uint16_t offset = 0;
+  uint16_t line = 0;
+
+  while (offset < length) {
+    if (0 == line % lines_per_page) {
+      if (UI_TEXT_PAGES_MAX == pages->page_count) {
+        return false;
+      }
+      pages->page_start[pages->page_count++] = offset;
+    }
+
+    const uint16_t line_length = lv_txt_get_next_line(
+        &text[offset], font, style->text.letter_space, width, LV_TXT_FLAG_NONE);
+    if (0 == line_length) {
       break;
     }
+    offset += line_length;
+    line++;
   }
 
-  if (NULL != contract) {
-    *contract = match;
+  if (0 == pages->page_count) {
+    pages->page_start[pages->page_count++] = 0;
   }
-  return status;
+  pages->page_start[pages->page_count] = length;
+
+  for (uint16_t page = 0; page < pages->page_count; page++) {
+    if (UI_TEXT_PAGE_MAX_SIZE <=
+        pages->page_start[page + 1] - pages->page_start[page]) {
+      return false;
+    }
+  }
+  return true;
 }
 
-/*****************************************************************************
- * GLOBAL FUNCTIONS
- *****************************************************************************/
+void ui_text_pages_get(const ui_text_pages_t *pages,
+                       uint16_t index,
+                       char *page_text) {
+  ASSERT(NULL != pages && NULL != page_text);
+  ASSERT(index < pages->page_count);
 
-const cy_app_desc_t *get_eth_app_desc() {
-  return &eth_app_desc;
-}
\ No newline at end of file
+  const char *start = &pages->text[pages->page_start[index]];
+  size_t size = pages->page_start[index + 1] - pages->page_start[index];
+
+  // the break ending the page would show as an empty line
+  if (0 < size && '\n' == start[size - 1]) {
+    size--;
+  }
+  memcpy(page_text, start, size);
+  page_text[size] = '\0';
+}
@@ -0,0 +1,83 @@
+/**
+ * @file    ui_text_pages.h
+ * @author  Cypherock X1 Team
+ * @brief   Splits a text into screen sized pages using the font metrics
+ * @copyright Copyright (c) 2023 HODL TECH PTE LTD
+ * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
+ * target=_blank>https://mitcc.org/</a>
+ */
+#ifndef UI_TEXT_PAGES_H
+#define UI_TEXT_PAGES_H
+
+/*****************************************************************************
+ * INCLUDES
+ *****************************************************************************/
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "lvgl.h"
+
+/*****************************************************************************
+ * MACROS AND DEFINES
+ *****************************************************************************/
+/// Pages a text may span; longer texts are not paginated
+#define UI_TEXT_PAGES_MAX 256
+/// Bytes (including the terminator) a single page may take
+#define UI_TEXT_PAGE_MAX_SIZE 256
+
+/*****************************************************************************
+ * TYPEDEFS
+ *****************************************************************************/
+/**
+ * @brief Byte offsets of the pages of a text
+ * @details Page i spans [page_start[i], page_start[i + 1]) of the text.
+ */
+typedef struct ui_text_pages {
+  const char *text;
+  uint16_t page_count;
+  uint16_t page_start[UI_TEXT_PAGES_MAX + 1];
+} ui_text_pages_t;
+
+/*****************************************************************************
+ * EXPORTED VARIABLES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * GLOBAL FUNCTION PROTOTYPES
+ *****************************************************************************/
+
+/**
+ * @brief Splits the text into pages of a label of the given size and style
+ * @details The lines are broken with lv_txt_get_next_line(), the routine a
+ * LV_LABEL_LONG_BREAK label uses, so a page shown on a label of the same
+ * width and style renders the same lines. The text is referenced, not copied,
+ * and must outlive the pages.
+ *
+ * @param pages Reference to the storage for the page offsets
+ * @param text The text to paginate
+ * @param style Style of the label showing the text
+ * @param width Width of the label
+ * @param height Height available for the lines of a page
+ *
+ * @return bool true if the text fits UI_TEXT_PAGES_MAX pages of at most
+ * UI_TEXT_PAGE_MAX_SIZE bytes each, else false
+ */
+bool ui_text_pages_layout(ui_text_pages_t *pages,
+                          const char *text,
+                          const lv_style_t *style,
+                          lv_coord_t width,
+                          lv_coord_t height);
+
+/**
+ * @brief Copies a page of the text, without its trailing line break
+ *
+ * @param pages Reference to the pages laid out with ui_text_pages_layout()
+ * @param index Index of the page, from 0
+ * @param page_text Output buffer of at least UI_TEXT_PAGE_MAX_SIZE bytes
+ */
+void ui_text_pages_get(const ui_text_pages_t *pages,
+                       uint16_t index,
+                       char *page_text);
+
+#endif /* UI_TEXT_PAGES_H */
@@ -0,0 +1,482 @@
+/**
+ * @file    aes_engine.c
+ * @author  Cypherock X1 Team
+ * @brief   AES-256 CBC engine with a compile time selected backend
+ * @copyright Copyright (c) 2023 HODL TECH PTE LTD
+ * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
+ *target=_blank>https://mitcc.org/</a>
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * (c) Copyright 2023 by HODL TECH PTE LTD
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * "Commons Clause" License Condition v1.0
+ *
+ * The Software is provided to you by the Licensor under the License,
+ * as defined below, subject to the following condition.
+ *
+ * Without limiting other conditions in the License, the grant of
+ * rights under the License will not include, and the License does not
+ * grant to you, the right to Sell the Software.
+ *
+ * For purposes of the foregoing, "Sell" means practicing any or all
+ * of the rights granted to you under the License to provide to third
+ * parties, for a fee or other consideration (including without
+ * limitation fees for hosting or consulting/ support services related
+ * to the Software), a product or service whose value derives, entirely
+ * or substantially, from the functionality of the Software. Any license
+ * notice or attribution required by the License must also include
+ * this Commons Clause License Condition notice.
+ *
+ * Software: All X1Wallet associated files.
+ * License: MIT
+ * Licensor: HODL TECH PTE LTD
+ *
+ ******************************************************************************
+ */
+
+/*****************************************************************************
+ * INCLUDES
+ *****************************************************************************/
+#include "aes_engine.h"
+
+#include <string.h>
+
+#include "memzero.h"
+
+#if AES_ENGINE_USE_HW
+#include "board.h"
+#endif
+
+/*****************************************************************************
+ * EXTERN VARIABLES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * PRIVATE MACROS AND DEFINES
+ *****************************************************************************/
+#if AES_ENGINE_USE_HW
+/// Status polls to wait for a block; a block takes well under 100 cycles
+#define AES_ENGINE_HW_POLL_LIMIT 1000
+#define AES_ENGINE_WORDS_PER_BLOCK (AES_ENGINE_BLOCK_SIZE / sizeof(uint32_t))
+
+/// Byte swapped data type; words are fed to the engine as read from memory
+#define AES_ENGINE_HW_DATATYPE AES_CR_DATATYPE_1
+#define AES_ENGINE_HW_MODE_ENCRYPT 0
+#define AES_ENGINE_HW_MODE_KEY_DERIVATION AES_CR_MODE_0
+#define AES_ENGINE_HW_MODE_DECRYPT AES_CR_MODE_1
+#define AES_ENGINE_HW_CHAIN_CBC AES_CR_CHMOD_0
+#endif
+
+/*****************************************************************************
+ * PRIVATE TYPEDEFS
+ *****************************************************************************/
+
+/*****************************************************************************
+ * STATIC FUNCTION PROTOTYPES
+ *****************************************************************************/
+#if AES_ENGINE_USE_HW
+/**
+ * @brief Reads 4 bytes as a big-endian word
+ */
+static uint32_t read_be32(const uint8_t *bytes);
+
+/**
+ * @brief Waits for the computation complete flag of the peripheral and clears
+ * it
+ *
+ * @return true If the computation completed without errors
+ * @return false If the peripheral flagged an error or timed out
+ */
+static bool hw_wait_complete(void);
+
+/**
+ * @brief Loads the key into the peripheral, which must be disabled
+ *
+ * @param key Reference to the prepared engine key
+ */
+static void hw_load_key(const aes_engine_key_t *key);
+
+/**
+ * @brief Loads the initialization vector into the peripheral, which must be
+ * disabled
+ *
+ * @param iv AES_ENGINE_BLOCK_SIZE bytes of the initialization vector
+ */
+static void hw_load_iv(const uint8_t *iv);
+
+/**
+ * @brief Runs the blocks through the enabled peripheral
+ * @details The output is discarded if out is NULL, except for the last block
+ * which is always copied to last_out.
+ *
+ * @return true If every block was processed
+ * @return false If the peripheral failed on any block
+ */
+static bool hw_process_blocks(const uint8_t *in,
+                              uint8_t *out,
+                              uint32_t size,
+                              uint8_t *last_out);
+
+/**
+ * @brief CBC encrypts or decrypts the buffer on the AES peripheral
+ * @details Refer @ref hw_process_blocks for out and last_out.
+ *
+ * @return true If the buffer was processed
+ * @return false If the peripheral failed
+ */
+static bool hw_cbc_crypt(const aes_engine_key_t *key,
+                         const uint8_t *in,
+                         uint8_t *out,
+                         uint32_t size,
+                         const uint8_t *iv,
+                         bool decrypt,
+                         uint8_t *last_out);
+#else
+/**
+ * @brief CBC encrypts or decrypts the buffer while computing the CBC-MAC of the
+ * cipher text, block by block
+ *
+ * @return true If the buffer was processed
+ * @return false If the software implementation failed
+ */
+static bool sw_cbc_mac_crypt(const aes_engine_key_t *key,
+                             const aes_engine_key_t *mac_key,
+                             const uint8_t *in,
+                             uint8_t *out,
+                             uint32_t size,
+                             uint8_t *iv,
+                             uint8_t *mac,
+                             bool decrypt);
+#endif
+
+/**
+ * @brief Checks the arguments common to the CBC APIs
+ */
+static bool is_cbc_request_valid(const aes_engine_key_t *key,
+                                 const uint8_t *in,
+                                 uint8_t *out,
+                                 uint32_t size,
+                                 uint8_t *iv);
+
+/*****************************************************************************
+ * STATIC VARIABLES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * GLOBAL VARIABLES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * STATIC FUNCTIONS
+ *****************************************************************************/
+#if AES_ENGINE_USE_HW
+static uint32_t read_be32(const uint8_t *bytes) {
+  return ((uint32_t)bytes[0] << 24) | ((uint32_t)bytes[1] << 16) |
+         ((uint32_t)bytes[2] << 8) | (uint32_t)bytes[3];
+}
+
+static bool hw_wait_complete(void) {
+  for (uint32_t poll = 0; poll < AES_ENGINE_HW_POLL_LIMIT; poll++) {
+    const uint32_t status = AES->SR;
+    if (0 != (status & (AES_SR_RDERR | AES_SR_WRERR))) {
+      SET_BIT(AES->CR, AES_CR_ERRC);
+      return false;
+    }
+    if (0 != (status & AES_SR_CCF)) {
+      SET_BIT(AES->CR, AES_CR_CCFC);
+      return true;
+    }
+  }
+  return false;
+}
+
+static void hw_load_key(const aes_engine_key_t *key) {
+  AES->KEYR7 = key->key_words[0];
+  AES->KEYR6 = key->key_words[1];
+  AES->KEYR5 = key->key_words[2];
+  AES->KEYR4 = key->key_words[3];
+  AES->KEYR3 = key->key_words[4];
+  AES->KEYR2 = key->key_words[5];
+  AES->KEYR1 = key->key_words[6];
+  AES->KEYR0 = key->key_words[7];
+}
+
+static void hw_load_iv(const uint8_t *iv) {
+  AES->IVR3 = read_be32(iv);
+  AES->IVR2 = read_be32(iv + 4);
+  AES->IVR1 = read_be32(iv + 8);
+  AES->IVR0 = read_be32(iv + 12);
+}
+
+static bool hw_process_blocks(const uint8_t *in,
+                              uint8_t *out,
+                              uint32_t size,
+                              uint8_t *last_out) {
+  uint32_t block[AES_ENGINE_WORDS_PER_BLOCK];
+
+  for (uint32_t offset = 0; offset < size; offset += AES_ENGINE_BLOCK_SIZE) {
+    memcpy(block, in + offset, sizeof(block));
+    for (uint8_t word = 0; word < AES_ENGINE_WORDS_PER_BLOCK; word++) {
+      AES->DINR = block[word];
+    }
+
+    if (!hw_wait_complete()) {
+      memzero(block, sizeof(block));
+      return false;
+    }
+
+    for (uint8_t word = 0; word < AES_ENGINE_WORDS_PER_BLOCK; word++) {
+      block[word] = AES->DOUTR;
+    }
+    if (NULL != out) {
+      memcpy(out + offset, block, sizeof(block));
+    }
+  }
+
+  memcpy(last_out, block, sizeof(block));
+  memzero(block, sizeof(block));
+  return true;
+}
+
+static bool hw_cbc_crypt(const aes_engine_key_t *key,
+                         const uint8_t *in,
+                         uint8_t *out,
+                         uint32_t size,
+                         const uint8_t *iv,
+                         bool decrypt,
+                         uint8_t *last_out) {
+  bool result = true;
+  const uint32_t config =
+      AES_CR_KEYSIZE | AES_ENGINE_HW_CHAIN_CBC | AES_ENGINE_HW_DATATYPE;
+
+  CLEAR_BIT(AES->CR, AES_CR_EN);
+  hw_load_key(key);
+
+  if (decrypt) {
+    // the decryption key schedule is derived in place from the loaded key
+    WRITE_REG(AES->CR, config | AES_ENGINE_HW_MODE_KEY_DERIVATION);
+    SET_BIT(AES->CR, AES_CR_EN);
+    result = hw_wait_complete();
+    CLEAR_BIT(AES->CR, AES_CR_EN);
+  }
+
+  if (result) {
+    WRITE_REG(AES->CR,
+              config | (decrypt ? AES_ENGINE_HW_MODE_DECRYPT
+                                : AES_ENGINE_HW_MODE_ENCRYPT));
+    hw_load_iv(iv);
+    SET_BIT(AES->CR, AES_CR_EN);
+    result = hw_process_blocks(in, out, size, last_out);
+  }
+
+  // wipe the key material from the peripheral
+  CLEAR_BIT(AES->CR, AES_CR_EN);
+  AES->KEYR0 = AES->KEYR1 = AES->KEYR2 = AES->KEYR3 = 0;
+  AES->KEYR4 = AES->KEYR5 = AES->KEYR6 = AES->KEYR7 = 0;
+  return result;
+}
+#else
+static bool sw_cbc_mac_crypt(const aes_engine_key_t *key,
+                             const aes_engine_key_t *mac_key,
+                             const uint8_t *in,
+                             uint8_t *out,
+                             uint32_t size,
+                             uint8_t *iv,
+                             uint8_t *mac,
+                             bool decrypt) {
+  bool result = true;
+  uint8_t cipher[AES_ENGINE_BLOCK_SIZE], block[AES_ENGINE_BLOCK_SIZE];
+
+  for (uint32_t offset = 0; result && offset < size;
+       offset += AES_ENGINE_BLOCK_SIZE) {
+    if (decrypt) {
+      // in may be overwritten by out, hold the cipher block for the chaining
+      memcpy(cipher, in + offset, sizeof(cipher));
+      result = EXIT_SUCCESS == aes_decrypt(cipher, block, &key->dec);
+      for (uint8_t i = 0; i < AES_ENGINE_BLOCK_SIZE; i++) {
+        block[i] ^= iv[i];
+      }
+    } else {
+      for (uint8_t i = 0; i < AES_ENGINE_BLOCK_SIZE; i++) {
+        block[i] = in[offset + i] ^ iv[i];
+      }
+      result = EXIT_SUCCESS == aes_encrypt(block, cipher, &key->enc);
+      memcpy(block, cipher, sizeof(block));
+    }
+    memcpy(out + offset, block, sizeof(block));
+    memcpy(iv, cipher, sizeof(cipher));
+
+    for (uint8_t i = 0; i < AES_ENGINE_BLOCK_SIZE; i++) {
+      mac[i] ^= cipher[i];
+    }
+    result = result && EXIT_SUCCESS == aes_encrypt(mac, mac, &mac_key->enc);
+  }
+
+  memzero(cipher, sizeof(cipher));
+  memzero(block, sizeof(block));
+  return result;
+}
+#endif
+
+static bool is_cbc_request_valid(const aes_engine_key_t *key,
+                                 const uint8_t *in,
+                                 uint8_t *out,
+                                 uint32_t size,
+                                 uint8_t *iv) {
+  return NULL != key && key->ready && NULL != in && NULL != out &&
+         NULL != iv && 0 == (size % AES_ENGINE_BLOCK_SIZE);
+}
+
+/*****************************************************************************
+ * GLOBAL FUNCTIONS
+ *****************************************************************************/
+bool aes_engine_set_key(aes_engine_key_t *key, const uint8_t *key_bytes) {
+  if (NULL == key || NULL == key_bytes) {
+    return false;
+  }
+
+  aes_engine_clear_key(key);
+#if AES_ENGINE_USE_HW
+  SET_BIT(RCC->AHB2ENR, RCC_AHB2ENR_AESEN);
+  // read back to let the clock settle before the first register access
+  (void)READ_BIT(RCC->AHB2ENR, RCC_AHB2ENR_AESEN);
+
+  for (uint8_t word = 0; word < AES_ENGINE_KEY_SIZE / sizeof(uint32_t);
+       word++) {
+    key->key_words[word] = read_be32(key_bytes + word * sizeof(uint32_t));
+  }
+#else
+  if (EXIT_SUCCESS != aes_encrypt_key256(key_bytes, &key->enc) ||
+      EXIT_SUCCESS != aes_decrypt_key256(key_bytes, &key->dec)) {
+    aes_engine_clear_key(key);
+    return false;
+  }
+#endif
+  key->ready = true;
+  return true;
+}
+
+void aes_engine_clear_key(aes_engine_key_t *key) {
+  if (NULL == key) {
+    return;
+  }
+  memzero(key, sizeof(aes_engine_key_t));
+}
+
+bool aes_engine_cbc_encrypt(const aes_engine_key_t *key,
+                            const uint8_t *in,
+                            uint8_t *out,
+                            uint32_t size,
+                            uint8_t *iv) {
+  if (!is_cbc_request_valid(key, in, out, size, iv)) {
+    return false;
+  }
+  if (0 == size) {
+    return true;
+  }
+
+#if AES_ENGINE_USE_HW
+  // chain the next call on the last cipher block, like aes_cbc_encrypt
+  return hw_cbc_crypt(key, in, out, size, iv, false, iv);
+#else
+  return EXIT_SUCCESS == aes_cbc_encrypt(in, out, size, iv, &key->enc);
+#endif
+}
+
+bool aes_engine_cbc_decrypt(const aes_engine_key_t *key,
+                            const uint8_t *in,
+                            uint8_t *out,
+                            uint32_t size,
+                            uint8_t *iv) {
+  if (!is_cbc_request_valid(key, in, out, size, iv)) {
+    return false;
+  }
+  if (0 == size) {
+    return true;
+  }
+
+#if AES_ENGINE_USE_HW
+  // the last cipher block chains the next call; in may be overwritten by out
+  uint8_t next_iv[AES_ENGINE_BLOCK_SIZE], last_out[AES_ENGINE_BLOCK_SIZE];
+  memcpy(next_iv, in + size - AES_ENGINE_BLOCK_SIZE, sizeof(next_iv));
+  if (!hw_cbc_crypt(key, in, out, size, iv, true, last_out)) {
+    return false;
+  }
+  memcpy(iv, next_iv, sizeof(next_iv));
+  memzero(last_out, sizeof(last_out));
+  return true;
+#else
+  return EXIT_SUCCESS == aes_cbc_decrypt(in, out, size, iv, &key->dec);
+#endif
+}
+
+bool aes_engine_cbc_encrypt_mac(const aes_engine_key_t *key,
+                                const aes_engine_key_t *mac_key,
+                                const uint8_t *in,
+                                uint8_t *out,
+                                uint32_t size,
+                                uint8_t *iv,
+                                uint8_t *mac) {
+  if (!is_cbc_request_valid(key, in, out, size, iv) || NULL == mac_key ||
+      !mac_key->ready || NULL == mac) {
+    return false;
+  }
+  if (0 == size) {
+    return true;
+  }
+
+#if AES_ENGINE_USE_HW
+  // the peripheral holds one key at a time; MAC the cipher text where it was
+  // written instead of switching keys for every block
+  return hw_cbc_crypt(key, in, out, size, iv, false, iv) &&
+         hw_cbc_crypt(mac_key, out, NULL, size, mac, false, mac);
+#else
+  return sw_cbc_mac_crypt(key, mac_key, in, out, size, iv, mac, false);
+#endif
+}
+
+bool aes_engine_cbc_decrypt_mac(const aes_engine_key_t *key,
+                                const aes_engine_key_t *mac_key,
+                                const uint8_t *in,
+                                uint8_t *out,
+                                uint32_t size,
+                                uint8_t *iv,
+                                uint8_t *mac) {
+  if (!is_cbc_request_valid(key, in, out, size, iv) || NULL == mac_key ||
+      !mac_key->ready || NULL == mac) {
+    return false;
+  }
+  if (0 == size) {
+    return true;
+  }
+
+#if AES_ENGINE_USE_HW
+  // MAC the cipher text before it is overwritten by an in place decryption
+  return hw_cbc_crypt(mac_key, in, NULL, size, mac, false, mac) &&
+         aes_engine_cbc_decrypt(key, in, out, size, iv);
+#else
+  return sw_cbc_mac_crypt(key, mac_key, in, out, size, iv, mac, true);
+#endif
+}
@@ -0,0 +1,174 @@
+/**
+ * @file    aes_engine.h
+ * @author  Cypherock X1 Team
+ * @brief   AES-256 CBC engine with a compile time selected backend
+ * @copyright Copyright (c) 2023 HODL TECH PTE LTD
+ * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
+ * target=_blank>https://mitcc.org/</a>
+ */
+#ifndef AES_ENGINE_H
+#define AES_ENGINE_H
+
+/*****************************************************************************
+ * INCLUDES
+ *****************************************************************************/
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "aes.h"
+
+/*****************************************************************************
+ * MACROS AND DEFINES
+ *****************************************************************************/
+/// Size of an AES block in bytes
+#define AES_ENGINE_BLOCK_SIZE 16
+/// Size of an AES-256 key in bytes
+#define AES_ENGINE_KEY_SIZE 32
+
+/**
+ * Selects the backend of the engine. The AES peripheral of the STM32L486 is
+ * used on device builds while the simulator uses the software implementation
+ * of common/libraries/crypto/aes.
+ */
+#ifndef AES_ENGINE_USE_HW
+#if USE_SIMULATOR == 0
+#define AES_ENGINE_USE_HW 1
+#else
+#define AES_ENGINE_USE_HW 0
+#endif
+#endif
+
+/*****************************************************************************
+ * TYPEDEFS
+ *****************************************************************************/
+/**
+ * @brief Key prepared for the selected backend by @ref aes_engine_set_key
+ * @details The hardware backend keeps the key words in the order they are
+ * loaded into the key registers, as the peripheral derives the decryption key
+ * itself. The software backend keeps the expanded key schedules.
+ */
+typedef struct {
+  bool ready;
+#if AES_ENGINE_USE_HW
+  uint32_t key_words[AES_ENGINE_KEY_SIZE / sizeof(uint32_t)];
+#else
+  aes_encrypt_ctx enc;
+  aes_decrypt_ctx dec;
+#endif
+} aes_engine_key_t;
+
+/*****************************************************************************
+ * EXPORTED VARIABLES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * GLOBAL FUNCTION PROTOTYPES
+ *****************************************************************************/
+
+/**
+ * @brief Prepares the AES-256 key for use with the engine
+ *
+ * @param [out] key Reference to the engine key to prepare
+ * @param [in] key_bytes AES_ENGINE_KEY_SIZE bytes of the key
+ * @return true If the key is ready for use
+ * @return false If the key could not be prepared
+ */
+bool aes_engine_set_key(aes_engine_key_t *key, const uint8_t *key_bytes);
+
+/**
+ * @brief Wipes the prepared key
+ *
+ * @param key Reference to the engine key to clear
+ */
+void aes_engine_clear_key(aes_engine_key_t *key);
+
+/**
+ * @brief Encrypts the buffer in CBC mode
+ * @details Same as aes_cbc_encrypt of the crypto library: iv is replaced with
+ * the last cipher block so that consecutive calls chain. The input and output
+ * may be the same buffer.
+ *
+ * @param key Reference to a prepared engine key
+ * @param [in] in Plain text; size must be a multiple of AES_ENGINE_BLOCK_SIZE
+ * @param [out] out Buffer of size bytes for the cipher text
+ * @param size Number of bytes to encrypt
+ * @param iv AES_ENGINE_BLOCK_SIZE bytes of the initialization vector
+ * @return true If the buffer was encrypted
+ * @return false If the key is not ready, size is invalid or the engine failed
+ */
+bool aes_engine_cbc_encrypt(const aes_engine_key_t *key,
+                            const uint8_t *in,
+                            uint8_t *out,
+                            uint32_t size,
+                            uint8_t *iv);
+
+/**
+ * @brief Decrypts the buffer in CBC mode
+ * @details Same as aes_cbc_decrypt of the crypto library: iv is replaced with
+ * the last cipher block so that consecutive calls chain. The input and output
+ * may be the same buffer.
+ *
+ * @param key Reference to a prepared engine key
+ * @param [in] in Cipher text; size must be a multiple of AES_ENGINE_BLOCK_SIZE
+ * @param [out] out Buffer of size bytes for the plain text
+ * @param size Number of bytes to decrypt
+ * @param iv AES_ENGINE_BLOCK_SIZE bytes of the initialization vector
+ * @return true If the buffer was decrypted
+ * @return false If the key is not ready, size is invalid or the engine failed
+ */
+bool aes_engine_cbc_decrypt(const aes_engine_key_t *key,
+                            const uint8_t *in,
+                            uint8_t *out,
+                            uint32_t size,
+                            uint8_t *iv);
+
+/**
+ * @brief Encrypts the buffer in CBC mode and computes the CBC-MAC of the
+ * produced cipher text in the same pass
+ * @details Equivalent to @ref aes_engine_cbc_encrypt followed by a CBC
+ * encryption of the cipher text with mac_key, keeping only its last block,
+ * but without a second copy of the cipher text.
+ *
+ * @param key Reference to the prepared encryption key
+ * @param mac_key Reference to the prepared MAC key
+ * @param [in] in Plain text; size must be a multiple of AES_ENGINE_BLOCK_SIZE
+ * @param [out] out Buffer of size bytes for the cipher text, may be in
+ * @param size Number of bytes to encrypt
+ * @param iv Initialization vector of the encryption; replaced for chaining
+ * @param mac Initialization vector of the MAC; replaced with the CBC-MAC
+ * @return true If the buffer was encrypted & authenticated
+ * @return false If a key is not ready, size is invalid or the engine failed
+ */
+bool aes_engine_cbc_encrypt_mac(const aes_engine_key_t *key,
+                                const aes_engine_key_t *mac_key,
+                                const uint8_t *in,
+                                uint8_t *out,
+                                uint32_t size,
+                                uint8_t *iv,
+                                uint8_t *mac);
+
+/**
+ * @brief Decrypts the buffer in CBC mode and computes the CBC-MAC of the
+ * decrypted cipher text in the same pass
+ * @details The caller must compare mac against the expected value and discard
+ * the plain text on a mismatch.
+ *
+ * @param key Reference to the prepared encryption key
+ * @param mac_key Reference to the prepared MAC key
+ * @param [in] in Cipher text; size must be a multiple of AES_ENGINE_BLOCK_SIZE
+ * @param [out] out Buffer of size bytes for the plain text, may be in
+ * @param size Number of bytes to decrypt
+ * @param iv Initialization vector of the decryption; replaced for chaining
+ * @param mac Initialization vector of the MAC; replaced with the CBC-MAC
+ * @return true If the buffer was decrypted & its MAC computed
+ * @return false If a key is not ready, size is invalid or the engine failed
+ */
+bool aes_engine_cbc_decrypt_mac(const aes_engine_key_t *key,
+                                const aes_engine_key_t *mac_key,
+                                const uint8_t *in,
+                                uint8_t *out,
+                                uint32_t size,
+                                uint8_t *iv,
+                                uint8_t *mac);
+
+#endif /* AES_ENGINE_H */
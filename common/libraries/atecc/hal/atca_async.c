@@ -0,0 +1,286 @@
+/**
+ * @file    atca_async.c
+ * @author  Cypherock X1 Team
+ * @brief   Non-blocking execution of ATECC commands from the task scheduler
+ * @copyright Copyright (c) 2023 HODL TECH PTE LTD
+ * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
+ *target=_blank>https://mitcc.org/</a>
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * (c) Copyright 2023 by HODL TECH PTE LTD
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * "Commons Clause" License Condition v1.0
+ *
+ * The Software is provided to you by the Licensor under the License,
+ * as defined below, subject to the following condition.
+ *
+ * Without limiting other conditions in the License, the grant of
+ * rights under the License will not include, and the License does not
+ * grant to you, the right to Sell the Software.
+ *
+ * For purposes of the foregoing, "Sell" means practicing any or all
+ * of the rights granted to you under the License to provide to third
+ * parties, for a fee or other consideration (including without
+ * limitation fees for hosting or consulting/ support services related
+ * to the Software), a product or service whose value derives, entirely
+ * or substantially, from the functionality of the Software. Any license
+ * notice or attribution required by the License must also include
+ * this Commons Clause License Condition notice.
+ *
+ * Software: All X1Wallet associated files.
+ * License: MIT
+ * Licensor: HODL TECH PTE LTD
+ *
+ ******************************************************************************
+ */
+
+/*****************************************************************************
+ * INCLUDES
+ *****************************************************************************/
+#include "atca_async.h"
+
+#include <stddef.h>
+
+#include "atca_execution.h"
+#include "atca_hal.h"
+#include "atca_iface.h"
+#include "board.h"
+#include "task_scheduler.h"
+
+/*****************************************************************************
+ * EXTERN VARIABLES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * PRIVATE MACROS AND DEFINES
+ *****************************************************************************/
+/// Settling time after the wake token, as in atca_execute_command
+#define ATCA_ASYNC_WAKE_MS 10
+/// Interval between two polls for the response
+#define ATCA_ASYNC_POLL_MS 2
+/// Time after which a command without response is given up
+#define ATCA_ASYNC_TIMEOUT_MS 2000
+/// Scheduler slice of the queue task
+#define ATCA_ASYNC_SLICE_MS 5
+
+/// Runs a bus transfer with the USB interrupt masked
+#define ATCA_ASYNC_MASKED(expr)                                                \
+  do {                                                                         \
+    bool usb_irq_enable_on_entry = NVIC_GetEnableIRQ(OTG_FS_IRQn);             \
+    NVIC_DisableIRQ(OTG_FS_IRQn);                                              \
+    expr;                                                                      \
+    if (usb_irq_enable_on_entry == true)                                       \
+      NVIC_EnableIRQ(OTG_FS_IRQn);                                             \
+  } while (0)
+
+/*****************************************************************************
+ * PRIVATE TYPEDEFS
+ *****************************************************************************/
+typedef enum {
+  ATCA_ASYNC_QUEUED = 0,
+  ATCA_ASYNC_WOKEN,
+  ATCA_ASYNC_SENT,
+} atca_async_state_t;
+
+typedef struct {
+  ATCADevice device;
+  ATCAPacket *packet;
+  atca_async_callback_t callback;
+  void *ctx;
+  atca_async_state_t state;
+  uint16_t exec_ms;
+  uint16_t rxsize;
+  /// Time the current wait started at and its length
+  uint32_t since;
+  uint32_t wait_ms;
+  uint32_t sent_at;
+} atca_async_entry_t;
+
+/*****************************************************************************
+ * STATIC VARIABLES
+ *****************************************************************************/
+static atca_async_entry_t atca_async_queue[ATCA_ASYNC_QUEUE_SIZE] = {0};
+static uint8_t atca_async_head = 0;
+static uint8_t atca_async_count = 0;
+
+/*****************************************************************************
+ * GLOBAL VARIABLES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * STATIC FUNCTION PROTOTYPES
+ *****************************************************************************/
+/**
+ * @brief Idles the device, pops the head entry and reports its status
+ */
+static void atca_async_finish(ATCA_STATUS status);
+
+/**
+ * @brief Advances the head entry by one step if its wait is over
+ *
+ * @return true If a step was taken
+ * @return false If the entry is waiting on the device
+ */
+static bool atca_async_step(void);
+
+/**
+ * @brief Scheduler task driving the queue
+ */
+static bool atca_async_task(uint32_t budget_ms);
+
+/*****************************************************************************
+ * STATIC FUNCTIONS
+ *****************************************************************************/
+static void atca_async_finish(ATCA_STATUS status) {
+  atca_async_entry_t entry = atca_async_queue[atca_async_head];
+
+  ATCA_ASYNC_MASKED(atidle(atGetIFace(entry.device)));
+  atca_async_queue[atca_async_head] = (atca_async_entry_t){0};
+  atca_async_head = (atca_async_head + 1) % ATCA_ASYNC_QUEUE_SIZE;
+  atca_async_count--;
+
+  if (NULL != entry.callback)
+    entry.callback(status, entry.packet, entry.ctx);
+}
+
+static bool atca_async_step(void) {
+  atca_async_entry_t *entry = &atca_async_queue[atca_async_head];
+  ATCAIface iface = atGetIFace(entry->device);
+  ATCAPacket *packet = entry->packet;
+  ATCA_STATUS status = ATCA_SUCCESS;
+
+  if (uwTick - entry->since < entry->wait_ms)
+    return false;
+
+  switch (entry->state) {
+    case ATCA_ASYNC_QUEUED:
+      ATCA_ASYNC_MASKED(status = atwake(iface));
+      if (ATCA_SUCCESS != status)
+        break;
+      entry->state = ATCA_ASYNC_WOKEN;
+      entry->since = uwTick;
+      entry->wait_ms = ATCA_ASYNC_WAKE_MS;
+      return true;
+
+    case ATCA_ASYNC_WOKEN:
+      ATCA_ASYNC_MASKED(status =
+                            atsend(iface, (uint8_t *)packet, packet->txsize));
+      if (ATCA_SUCCESS != status)
+        break;
+      entry->state = ATCA_ASYNC_SENT;
+      entry->since = entry->sent_at = uwTick;
+      entry->wait_ms = entry->exec_ms;
+      return true;
+
+    case ATCA_ASYNC_SENT:
+      // the HAL overwrites the expected size on failed reads
+      packet->rxsize = entry->rxsize;
+      ATCA_ASYNC_MASKED(status =
+                            atreceive(iface, packet->data, &packet->rxsize));
+      if (ATCA_SUCCESS != status) {
+        if (uwTick - entry->sent_at >= ATCA_ASYNC_TIMEOUT_MS)
+          break;
+        entry->since = uwTick;
+        entry->wait_ms = ATCA_ASYNC_POLL_MS;
+        return false;
+      }
+      if (packet->rxsize < 4) {
+        status = (packet->rxsize > 0) ? ATCA_RX_FAIL : ATCA_RX_NO_RESPONSE;
+      } else if ((status = atCheckCrc(packet->data)) == ATCA_SUCCESS) {
+        status = isATCAError(packet->data);
+      }
+      break;
+
+    default:
+      status = ATCA_ASSERT_FAILURE;
+      break;
+  }
+
+  atca_async_finish(status);
+  return true;
+}
+
+static bool atca_async_task(uint32_t budget_ms) {
+  const uint32_t start = uwTick;
+
+  while (0 < atca_async_count && uwTick - start < budget_ms) {
+    if (!atca_async_step())
+      return false;
+  }
+
+  if (0 == atca_async_count) {
+    sched_remove_task(atca_async_task);
+    return false;
+  }
+  return true;
+}
+
+/*****************************************************************************
+ * GLOBAL FUNCTIONS
+ *****************************************************************************/
+ATCA_STATUS atca_async_execute(ATCADevice device,
+                               ATCAPacket *packet,
+                               uint16_t exec_ms,
+                               atca_async_callback_t callback,
+                               void *ctx) {
+  if (NULL == device || NULL == packet)
+    return ATCA_BAD_PARAM;
+  if (ATCA_ASYNC_QUEUE_SIZE <= atca_async_count)
+    return ATCA_FUNC_FAIL;
+  if (0 == exec_ms) {
+    ATCACommand ca_cmd = device->mCommands;
+    if (ATCA_SUCCESS != atGetExecTime(packet->opcode, ca_cmd))
+      return ATCA_BAD_OPCODE;
+    exec_ms = ca_cmd->execution_time_msec;
+  }
+  if (!sched_add_task(atca_async_task, SCHED_PRIO_MID, ATCA_ASYNC_SLICE_MS))
+    return ATCA_FUNC_FAIL;
+
+  const uint8_t index =
+      (atca_async_head + atca_async_count) % ATCA_ASYNC_QUEUE_SIZE;
+  atca_async_queue[index] = (atca_async_entry_t){
+      .device = device,
+      .packet = packet,
+      .callback = callback,
+      .ctx = ctx,
+      .state = ATCA_ASYNC_QUEUED,
+      .exec_ms = exec_ms,
+      .rxsize = packet->rxsize,
+  };
+  atca_async_count++;
+  return ATCA_SUCCESS;
+}
+
+bool atca_async_busy(void) {
+  return 0 < atca_async_count;
+}
+
+void atca_async_flush(void) {
+  while (0 < atca_async_count) {
+    if (!atca_async_step())
+      atca_delay_ms(1);
+  }
+  sched_remove_task(atca_async_task);
+}
@@ -0,0 +1,84 @@
+/**
+ * @file    atca_async.h
+ * @author  Cypherock X1 Team
+ * @brief   Non-blocking execution of ATECC commands from the task scheduler
+ * @copyright Copyright (c) 2023 HODL TECH PTE LTD
+ * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
+ * target=_blank>https://mitcc.org/</a>
+ */
+#ifndef ATCA_ASYNC_H
+#define ATCA_ASYNC_H
+
+/*****************************************************************************
+ * INCLUDES
+ *****************************************************************************/
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "atca_command.h"
+#include "atca_device.h"
+#include "atca_status.h"
+
+/*****************************************************************************
+ * MACROS AND DEFINES
+ *****************************************************************************/
+#define ATCA_ASYNC_QUEUE_SIZE 4
+
+/*****************************************************************************
+ * TYPEDEFS
+ *****************************************************************************/
+/**
+ * @brief Called from the scheduler once a queued command is complete
+ *
+ * @param status ATCA_SUCCESS if packet->data holds a valid response
+ * @param packet The packet passed to @ref atca_async_execute
+ * @param ctx The context passed to @ref atca_async_execute
+ */
+typedef void (*atca_async_callback_t)(ATCA_STATUS status,
+                                      ATCAPacket *packet,
+                                      void *ctx);
+
+/*****************************************************************************
+ * EXPORTED VARIABLES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * GLOBAL FUNCTION PROTOTYPES
+ *****************************************************************************/
+/**
+ * @brief Queues a command built by one of the atca_command.c builders
+ * @details The command is sent and its response collected by a background
+ * task: the USB interrupt is only masked for the bus transfers, not while the
+ * chip executes the command. Consecutive queued commands run back to back
+ * and keep TempKey. The packet must stay valid till the callback runs.
+ *
+ * @param device Device to run the command on
+ * @param packet Command packet, receives the response
+ * @param exec_ms Time after which the response is first polled, 0 to use the
+ * typical execution time of the opcode
+ * @param callback Completion callback, may be NULL
+ * @param ctx Passed back to the callback
+ * @return ATCA_SUCCESS If the command is queued
+ * @return ATCA_BAD_PARAM If device or packet is NULL
+ * @return ATCA_BAD_OPCODE If exec_ms is 0 and the opcode is unknown
+ * @return ATCA_FUNC_FAIL If the queue is full
+ */
+ATCA_STATUS atca_async_execute(ATCADevice device,
+                               ATCAPacket *packet,
+                               uint16_t exec_ms,
+                               atca_async_callback_t callback,
+                               void *ctx);
+
+/**
+ * @brief Reports if queued commands are pending
+ */
+bool atca_async_busy(void);
+
+/**
+ * @brief Runs the queued commands to completion, blocking. Must be called
+ * before issuing commands through the blocking atcab_ API or re-initialising
+ * the device.
+ */
+void atca_async_flush(void);
+
+#endif /* ATCA_ASYNC_H */
@@ -144,23 +144,32 @@ int b58check(const void *bin, size_t binsz, HasherType hasher_type,
   return binc[0];
 }
 
+// 58^4, the largest power of 58 for which limb * 256 + carry fits 32 bits
+#define B58_LIMB_BASE 11316496UL
+#define B58_LIMB_DIGITS 4
+
 bool b58enc(char *b58, size_t *b58sz, const void *data, size_t binsz) {
   const uint8_t *bin = data;
-  int carry = 0;
+  uint32_t carry = 0;
   size_t i = 0, j = 0, high = 0, zcount = 0;
-  size_t size = 0;
+  size_t size = 0, limbs = 0;
 
   while (zcount < binsz && !bin[zcount]) ++zcount;
 
+  // The value is accumulated in base 58^4 limbs, hence one division yields
+  // four digits instead of one. The leading limb is spare and stays zero.
   size = (binsz - zcount) * 138 / 100 + 1;
+  limbs = (size + B58_LIMB_DIGITS - 1) / B58_LIMB_DIGITS + 1;
+  size = limbs * B58_LIMB_DIGITS;
+  uint32_t acc[limbs];
   uint8_t buf[size];
-  memzero(buf, size);
+  memzero(acc, sizeof(acc));
 
-  for (i = zcount, high = size - 1; i < binsz; ++i, high = j) {
-    for (carry = bin[i], j = size - 1; (j > high) || carry; --j) {
-      carry += 256 * buf[j];
-      buf[j] = carry % 58;
-      carry /= 58;
+  for (i = zcount, high = limbs - 1; i < binsz; ++i, high = j) {
+    for (carry = bin[i], j = limbs - 1; (j > high) || carry; --j) {
+      carry += acc[j] << 8;
+      acc[j] = carry % B58_LIMB_BASE;
+      carry /= B58_LIMB_BASE;
       if (!j) {
         // Otherwise j wraps to maxint which is > high
         break;
@@ -168,11 +177,21 @@ bool b58enc(char *b58, size_t *b58sz, const void *data, size_t binsz) {
     }
   }
 
+  for (j = 0; j < limbs; ++j) {
+    uint32_t limb = acc[j];
+    for (i = B58_LIMB_DIGITS; i > 0; --i) {
+      buf[j * B58_LIMB_DIGITS + i - 1] = limb % 58;
+      limb /= 58;
+    }
+  }
+  memzero(acc, sizeof(acc));
+
   for (j = 0; j < size && !buf[j]; ++j)
     ;
 
   if (*b58sz <= zcount + size - j) {
     *b58sz = zcount + size - j + 1;
+    memzero(buf, size);
     return false;
   }
 
@@ -180,6 +199,7 @@ bool b58enc(char *b58, size_t *b58sz, const void *data, size_t binsz) {
   for (i = zcount; j < size; ++i, ++j) b58[i] = b58digits_ordered[buf[j]];
   b58[i] = '\0';
   *b58sz = i + 1;
+  memzero(buf, size);
 
   return true;
 }
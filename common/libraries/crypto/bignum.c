@@ -28,6 +28,7 @@
 #include <stdio.h>
 #include <string.h>
 #include "memzero.h"
+#include "options.h"
 
 /* big number library */
 
@@ -366,8 +367,8 @@ void bn_mod(bignum256 *x, const bignum256 *prime) {
 // auxiliary function for multiplication.
 // compute k * x as a 540 bit number in base 2^30 (normalized).
 // assumes that k and x are normalized.
-void bn_multiply_long(const bignum256 *k, const bignum256 *x,
-                      uint32_t res[18]) {
+SRAM2_CODE void bn_multiply_long(const bignum256 *k, const bignum256 *x,
+                                 uint32_t res[18]) {
   int i, j;
   uint64_t temp = 0;
 
@@ -397,8 +398,8 @@ void bn_multiply_long(const bignum256 *k, const bignum256 *x,
 // assumes i >= 8 and i <= 16
 // assumes    res normalized, res < 2^(30(i-7)) * 2 * prime
 // guarantees res normalized, res < 2^(30(i-8)) * 2 * prime
-void bn_multiply_reduce_step(uint32_t res[18], const bignum256 *prime,
-                             uint32_t i) {
+SRAM2_CODE void bn_multiply_reduce_step(uint32_t res[18],
+                                        const bignum256 *prime, uint32_t i) {
   // let k = i-8.
   // on entry:
   //   0 <= res < 2^(30k + 31) * prime
@@ -439,8 +440,8 @@ void bn_multiply_reduce_step(uint32_t res[18], const bignum256 *prime,
 // reduces x = res modulo prime.
 // assumes    res normalized, res < 2^270 * 2 * prime
 // guarantees x partly reduced, i.e., x < 2 * prime
-void bn_multiply_reduce(bignum256 *x, uint32_t res[18],
-                        const bignum256 *prime) {
+SRAM2_CODE void bn_multiply_reduce(bignum256 *x, uint32_t res[18],
+                                   const bignum256 *prime) {
   int i;
   // res = k * x is a normalized number (every limb < 2^30)
   // 0 <= res < 2^270 * 2 * prime.
@@ -454,13 +455,87 @@ void bn_multiply_reduce(bignum256 *x, uint32_t res[18],
   }
 }
 
+#if USE_SECP256K1_FAST_REDUCE
+// the secp256k1 field prime p = 2^256 - 2^32 - 977 in base 2^30
+static const uint32_t secp256k1_prime_val[9] = {
+    0x3ffffc2f, 0x3ffffffb, 0x3fffffff, 0x3fffffff, 0x3fffffff,
+    0x3fffffff, 0x3fffffff, 0x3fffffff, 0xffff};
+
+// auxiliary function for multiplication.
+// folds the bits of res above 2^256 back using
+//   2^256 = 2^32 + 977 = 4 * 2^30 + 977  (mod p)
+// i.e. res := (res mod 2^256) + (res >> 256) * (4 * 2^30 + 977).
+// assumes    res normalized and held in the first limbs digits, 10 <= limbs
+// guarantees res normalized and held in the first limbs digits
+static void bn_secp256k1_fold(uint32_t res[18], int limbs) {
+  // (res >> 256) as limbs - 8 digits in base 2^30
+  const int n = limbs - 8;
+  uint32_t high[10] = {0};
+  int i;
+  for (i = 0; i < n; i++) {
+    high[i] = res[8 + i] >> 16;
+    if (9 + i < limbs) {
+      high[i] |= (res[9 + i] << 14) & 0x3FFFFFFF;
+    }
+  }
+  res[8] &= 0xFFFF;
+  for (i = 9; i < limbs; i++) {
+    res[i] = 0;
+  }
+
+  // no overflow, since every term is below 2^42
+  uint64_t temp = 0;
+  for (i = 0; i < limbs; i++) {
+    temp += res[i];
+    if (i < n) {
+      temp += 977 * (uint64_t)high[i];
+    }
+    if (0 < i && i <= n) {
+      temp += 4 * (uint64_t)high[i - 1];
+    }
+    res[i] = temp & 0x3FFFFFFF;
+    temp >>= 30;
+  }
+  assert(temp == 0);
+  memzero(high, sizeof(high));
+}
+
+// auxiliary function for multiplication.
+// reduces x = res modulo the secp256k1 field prime.
+// assumes    res normalized, res < 2^540
+// guarantees x partly reduced, i.e., x < 2^256 < 2 * prime
+SRAM2_CODE static void bn_secp256k1_reduce(bignum256 *x, uint32_t res[18]) {
+  int i;
+  // res < 2^540 gives res < 2^256 + 2^317 after the first fold, which is
+  // below 2^256 + 2^95 after the second one. The last fold leaves res < 2^256:
+  // it only adds to numbers below 2^95.
+  bn_secp256k1_fold(res, 18);
+  bn_secp256k1_fold(res, 12);
+  bn_secp256k1_fold(res, 10);
+  // store the result
+  for (i = 0; i < 9; i++) {
+    x->val[i] = res[i];
+  }
+}
+#endif
+
 // Compute x := k * x  (mod prime)
 // both inputs must be smaller than 180 * prime.
 // result is partly reduced (0 <= x < 2 * prime)
 // This only works for primes between 2^256-2^224 and 2^256.
-void bn_multiply(const bignum256 *k, bignum256 *x, const bignum256 *prime) {
+SRAM2_CODE void bn_multiply(const bignum256 *k, bignum256 *x,
+                            const bignum256 *prime) {
   uint32_t res[18] = {0};
   bn_multiply_long(k, x, res);
+#if USE_SECP256K1_FAST_REDUCE
+  // the prime is public, comparing it need not be constant time
+  if (memcmp(prime->val, secp256k1_prime_val, sizeof(secp256k1_prime_val)) ==
+      0) {
+    bn_secp256k1_reduce(x, res);
+    memzero(res, sizeof(res));
+    return;
+  }
+#endif
   bn_multiply_reduce(x, res, prime);
   memzero(res, sizeof(res));
 }
@@ -191,6 +191,49 @@ int hdnode_from_seed(const uint8_t *seed, int seed_len, const char *curve,
   return 1;
 }
 
+#if USE_BIP32_HMAC_CACHE
+static CONFIDENTIAL struct {
+  bool set;
+  uint8_t chain_code[32];
+  uint64_t opad_digest[SHA512_DIGEST_LENGTH / sizeof(uint64_t)];
+  uint64_t ipad_digest[SHA512_DIGEST_LENGTH / sizeof(uint64_t)];
+} ckd_hmac_cache;
+#endif
+
+/*
+ * HMAC-SHA512 keyed with the chain code of the parent node. Consecutive
+ * derivations from the same parent reuse the pad digests of the key.
+ */
+static void hdnode_ckd_hmac(const uint8_t *chain_code,
+                            const uint8_t *data,
+                            uint32_t data_len,
+                            uint8_t *I) {
+#if USE_BIP32_HMAC_CACHE
+  if (!ckd_hmac_cache.set ||
+      memcmp(ckd_hmac_cache.chain_code, chain_code, 32) != 0) {
+    hmac_sha512_prepare(chain_code,
+                        32,
+                        ckd_hmac_cache.opad_digest,
+                        ckd_hmac_cache.ipad_digest);
+    memcpy(ckd_hmac_cache.chain_code, chain_code, 32);
+    ckd_hmac_cache.set = true;
+  }
+  hmac_sha512_prepared(ckd_hmac_cache.opad_digest,
+                       ckd_hmac_cache.ipad_digest,
+                       data,
+                       data_len,
+                       I);
+#else
+  hmac_sha512(chain_code, 32, data, data_len, I);
+#endif
+}
+
+void hdnode_ckd_hmac_cache_clear(void) {
+#if USE_BIP32_HMAC_CACHE
+  memzero(&ckd_hmac_cache, sizeof(ckd_hmac_cache));
+#endif
+}
+
 uint32_t hdnode_fingerprint(HDNode *node) {
   uint8_t digest[32] = {0};
   uint32_t fingerprint = 0;
@@ -222,10 +265,7 @@ int hdnode_private_ckd(HDNode *inout, uint32_t i) {
 
   bn_read_be(inout->private_key, &a);
 
-  static CONFIDENTIAL HMAC_SHA512_CTX ctx;
-  hmac_sha512_Init(&ctx, inout->chain_code, 32);
-  hmac_sha512_Update(&ctx, data, sizeof(data));
-  hmac_sha512_Final(&ctx, I);
+  hdnode_ckd_hmac(inout->chain_code, data, sizeof(data), I);
 
   if (inout->curve->params) {
     while (true) {
@@ -248,9 +288,7 @@ int hdnode_private_ckd(HDNode *inout, uint32_t i) {
 
       data[0] = 1;
       memcpy(data + 1, I + 32, 32);
-      hmac_sha512_Init(&ctx, inout->chain_code, 32);
-      hmac_sha512_Update(&ctx, data, sizeof(data));
-      hmac_sha512_Final(&ctx, I);
+      hdnode_ckd_hmac(inout->chain_code, data, sizeof(data), I);
     }
   } else {
     memcpy(inout->private_key, I, 32);
@@ -321,10 +359,7 @@ int hdnode_private_ckd_cardano(HDNode *inout, uint32_t index) {
     memcpy(data + 1, inout->public_key + 1, 32);
   }
 
-  static CONFIDENTIAL HMAC_SHA512_CTX ctx;
-  hmac_sha512_Init(&ctx, inout->chain_code, 32);
-  hmac_sha512_Update(&ctx, data, 1 + keysize + 4);
-  hmac_sha512_Final(&ctx, z);
+  hdnode_ckd_hmac(inout->chain_code, data, 1 + keysize + 4, z);
 
   static CONFIDENTIAL uint8_t zl8[32];
   memzero(zl8, 32);
@@ -345,9 +380,7 @@ int hdnode_private_ckd_cardano(HDNode *inout, uint32_t index) {
   } else {
     data[0] = 3;
   }
-  hmac_sha512_Init(&ctx, inout->chain_code, 32);
-  hmac_sha512_Update(&ctx, data, 1 + keysize + 4);
-  hmac_sha512_Final(&ctx, z);
+  hdnode_ckd_hmac(inout->chain_code, data, 1 + keysize + 4, z);
 
   memcpy(inout->chain_code, z + 32, 32);
   inout->depth++;
@@ -435,7 +468,7 @@ int hdnode_public_ckd_cp(const ecdsa_curve *curve, const curve_point *parent,
   write_be(data + 33, i);
 
   while (true) {
-    hmac_sha512(parent_chain_code, 32, data, sizeof(data), I);
+    hdnode_ckd_hmac(parent_chain_code, data, sizeof(data), I);
     bn_read_be(I, &c);
     if (bn_is_less(&c, &curve->order)) {  // < order
       scalar_multiply(curve, &c, child);  // b = c * G
@@ -95,6 +95,9 @@ int hdnode_private_ckd_cached(HDNode *inout, const uint32_t *i, size_t i_count,
                               uint32_t *fingerprint);
 #endif
 
+// wipes the pad digests kept for the chain code of the last parent node
+void hdnode_ckd_hmac_cache_clear(void);
+
 uint32_t hdnode_fingerprint(HDNode *node);
 
 void hdnode_fill_public_key(HDNode *node);
@@ -134,21 +134,16 @@ int mnemonic_to_entropy(const char *mnemonic, uint8_t *entropy) {
     if (mnemonic[i] != 0) {
       i++;
     }
-    k = 0;
-    for (;;) {
-      if (!wordlist[k]) {  // word not found
-        return 0;
-      }
-      if (strcmp(current_word, wordlist[k]) == 0) {  // word found on index k
-        for (ki = 0; ki < 11; ki++) {
-          if (k & (1 << (10 - ki))) {
-            bits[bi / 8] |= 1 << (7 - (bi % 8));
-          }
-          bi++;
-        }
-        break;
+    int index = mnemonic_find_word(current_word);
+    if (index < 0) {  // word not found
+      return 0;
+    }
+    k = index;
+    for (ki = 0; ki < 11; ki++) {
+      if (k & (1 << (10 - ki))) {
+        bits[bi / 8] |= 1 << (7 - (bi % 8));
       }
-      k++;
+      bi++;
     }
   }
   if (bi != n * 11) {
@@ -183,6 +178,15 @@ void mnemonic_to_seed(const char *mnemonic, const char *passphrase,
                       uint8_t seed[512 / 8],
                       void (*progress_callback)(uint32_t current,
                                                 uint32_t total)) {
+  mnemonic_to_seed_cancellable(mnemonic, passphrase, seed, progress_callback,
+                               NULL);
+}
+
+bool mnemonic_to_seed_cancellable(const char *mnemonic, const char *passphrase,
+                                  uint8_t seed[512 / 8],
+                                  void (*progress_callback)(uint32_t current,
+                                                            uint32_t total),
+                                  bool (*cancel_callback)(void)) {
   int mnemoniclen = strlen(mnemonic);
   int passphraselen = strnlen(passphrase, 256);
 #if USE_BIP39_CACHE
@@ -194,7 +198,7 @@ void mnemonic_to_seed(const char *mnemonic, const char *passphrase,
       if (strcmp(bip39_cache[i].passphrase, passphrase) != 0) continue;
       // found the correct entry
       memcpy(seed, bip39_cache[i].seed, 512 / 8);
-      return;
+      return true;
     }
   }
 #endif
@@ -213,6 +217,13 @@ void mnemonic_to_seed(const char *mnemonic, const char *passphrase,
       progress_callback((i + 1) * BIP39_PBKDF2_ROUNDS / 16,
                         BIP39_PBKDF2_ROUNDS);
     }
+    // checked between the slices, so a cancellation waits 1/16 of the rounds
+    if (cancel_callback && cancel_callback()) {
+      memzero(&pctx, sizeof(pctx));
+      memzero(salt, sizeof(salt));
+      memzero(seed, 512 / 8);
+      return false;
+    }
   }
   pbkdf2_hmac_sha512_Final(&pctx, seed);
   memzero(salt, sizeof(salt));
@@ -226,11 +237,41 @@ void mnemonic_to_seed(const char *mnemonic, const char *passphrase,
     bip39_cache_index = (bip39_cache_index + 1) % BIP39_CACHE_SIZE;
   }
 #endif
+  return true;
+}
+
+// narrows [lo, hi) to the words sharing the first (up to 2) letters of prefix
+static bool prefix_index_range(const char *prefix, int len, int *lo, int *hi) {
+  *lo = 0;
+  *hi = BIP39_WORDS;
+  if (len <= 0) {
+    return true;
+  }
+  for (int i = 0; i < len && i < 2; i++) {
+    if (prefix[i] < 'a' || prefix[i] > 'z') {
+      return false;
+    }
+  }
+
+  int slot = (prefix[0] - 'a') * 26;
+  if (len == 1) {
+    *lo = bip39_prefix_index[slot];
+    *hi = bip39_prefix_index[slot + 26];
+  } else {
+    slot += prefix[1] - 'a';
+    *lo = bip39_prefix_index[slot];
+    *hi = bip39_prefix_index[slot + 1];
+  }
+  return *lo < *hi;
 }
 
 // binary search for finding the word in the wordlist
 int mnemonic_find_word(const char *word) {
-  int lo = 0, hi = BIP39_WORDS - 1;
+  int lo = 0, hi = 0;
+  if (!prefix_index_range(word, strnlen(word, 2), &lo, &hi)) {
+    return -1;
+  }
+  hi--;
   while (lo <= hi) {
     int mid = lo + (hi - lo) / 2;
     int cmp = strcmp(word, wordlist[mid]);
@@ -246,15 +287,53 @@ int mnemonic_find_word(const char *word) {
   return -1;
 }
 
-const char *mnemonic_complete_word(const char *prefix, int len) {
-  // we need to perform linear search,
-  // because we want to return the first match
-  for (const char *const *w = wordlist; *w != 0; w++) {
-    if (strncmp(*w, prefix, len) == 0) {
-      return *w;
+bool mnemonic_find_prefix(const char *prefix, int len, int *first,
+                          int *last) {
+  int lo = 0, hi = 0;
+  if (!prefix_index_range(prefix, len, &lo, &hi)) {
+    return false;
+  }
+
+  if (len > 2) {
+    // lower bound of the words starting with prefix
+    int l = lo, h = hi;
+    while (l < h) {
+      int mid = l + (h - l) / 2;
+      if (strncmp(wordlist[mid], prefix, len) < 0) {
+        l = mid + 1;
+      } else {
+        h = mid;
+      }
+    }
+    lo = l;
+    // upper bound of the words starting with prefix
+    h = hi;
+    while (l < h) {
+      int mid = l + (h - l) / 2;
+      if (strncmp(wordlist[mid], prefix, len) <= 0) {
+        l = mid + 1;
+      } else {
+        h = mid;
+      }
     }
+    hi = l;
   }
-  return NULL;
+
+  if (lo >= hi) {
+    return false;
+  }
+  *first = lo;
+  *last = hi - 1;
+  return true;
+}
+
+const char *mnemonic_complete_word(const char *prefix, int len) {
+  // the first match is the start of the range sharing the prefix
+  int first = 0, last = 0;
+  if (!mnemonic_find_prefix(prefix, len, &first, &last)) {
+    return NULL;
+  }
+  return wordlist[first];
 }
 
 const char *mnemonic_get_word(int index) {
@@ -270,10 +349,13 @@ uint32_t mnemonic_word_completion_mask(const char *prefix, int len) {
     return 0x3ffffff;  // all letters (bits 1-26 set)
   }
   uint32_t res = 0;
-  for (const char *const *w = wordlist; *w != 0; w++) {
-    const char *word = *w;
-    if (strncmp(word, prefix, len) == 0 && word[len] >= 'a' &&
-        word[len] <= 'z') {
+  int first = 0, last = 0;
+  if (!mnemonic_find_prefix(prefix, len, &first, &last)) {
+    return res;
+  }
+  for (int i = first; i <= last; i++) {
+    const char *word = wordlist[i];
+    if (word[len] >= 'a' && word[len] <= 'z') {
       res |= 1 << (word[len] - 'a');
     }
   }
@@ -30,6 +30,12 @@
 #define BIP39_WORDS 2048
 #define BIP39_PBKDF2_ROUNDS 2048
 
+// bip39_prefix_index[26 * a + b] is the index of the first word with a two
+// letter prefix not below (a, b); the last entry is BIP39_WORDS. Generated by
+// utilities/bip39/generate-prefix-index.py
+#define BIP39_PREFIX_INDEX_SIZE (26 * 26 + 1)
+extern const uint16_t bip39_prefix_index[BIP39_PREFIX_INDEX_SIZE];
+
 const char* mnemonic_generate(int strength); // strength in bits
 const char* mnemonic_from_data(const uint8_t* data, int len);
 void mnemonic_clear(void);
@@ -44,9 +50,19 @@ void mnemonic_to_seed(const char* mnemonic, const char* passphrase,
     void (*progress_callback)(uint32_t current,
         uint32_t total));
 
+// as mnemonic_to_seed; cancel_callback is polled between slices of the
+// PBKDF2 rounds and stops the derivation (zeroizing seed) if it returns true
+bool mnemonic_to_seed_cancellable(const char* mnemonic, const char* passphrase,
+    uint8_t seed[512 / 8],
+    void (*progress_callback)(uint32_t current,
+        uint32_t total),
+    bool (*cancel_callback)(void));
+
 int mnemonic_find_word(const char* word);
 const char* mnemonic_complete_word(const char* prefix, int len);
 const char* mnemonic_get_word(int index);
 uint32_t mnemonic_word_completion_mask(const char* prefix, int len);
+// range of indices [first, last] of the words starting with prefix (lowercase)
+bool mnemonic_find_prefix(const char* prefix, int len, int* first, int* last);
 
 #endif
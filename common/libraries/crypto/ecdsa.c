@@ -545,6 +545,9 @@ void scalar_multiply(const ecdsa_curve *curve, const bignum256 *k,
                      curve_point *res) {
   assert(bn_is_less(k, &curve->order));
 
+  // bits per window of the table, w * CP_WINDOWS >= 256
+  const int w = USE_PRECOMPUTED_CP_WINDOW;
+  const uint32_t mask = (1 << w) - 1;
   int i = {0}, j = {0};
   static CONFIDENTIAL bignum256 a;
   uint32_t is_even = (k->val[0] & 1) - 1;
@@ -554,7 +557,7 @@ void scalar_multiply(const ecdsa_curve *curve, const bignum256 *k,
 
   // is_even = 0xffffffff if k is even, 0 otherwise.
 
-  // add 2^256.
+  // add 2^(w*n) with n = CP_WINDOWS.
   // make number odd: subtract curve->order if even
   uint32_t tmp = 1;
   uint32_t is_non_zero = 0;
@@ -565,7 +568,8 @@ void scalar_multiply(const ecdsa_curve *curve, const bignum256 *k,
     tmp >>= 30;
   }
   is_non_zero |= k->val[j];
-  a.val[j] = tmp + 0xffff + k->val[j] - (curve->order.val[j] & is_even);
+  a.val[j] = tmp + ((1 << (w * CP_WINDOWS - 240)) - 1) + k->val[j] -
+             (curve->order.val[j] & is_even);
   assert((a.val[0] & 1) != 0);
 
   // special case 0*G:  just return zero. We don't care about constant time.
@@ -574,44 +578,44 @@ void scalar_multiply(const ecdsa_curve *curve, const bignum256 *k,
     return;
   }
 
-  // Now a = k + 2^256 (mod curve->order) and a is odd.
+  // Now a = k + 2^(w*n) (mod curve->order) and a is odd.
   //
   // The idea is to bring the new a into the form.
-  // sum_{i=0..64} a[i] 16^i,  where |a[i]| < 16 and a[i] is odd.
+  // sum_{i=0..n} a[i] 2^(w*i),  where |a[i]| < 2^w and a[i] is odd.
   // a[0] is odd, since a is odd.  If a[i] would be even, we can
-  // add 1 to it and subtract 16 from a[i-1].  Afterwards,
-  // a[64] = 1, which is the 2^256 that we added before.
+  // add 1 to it and subtract 2^w from a[i-1].  Afterwards,
+  // a[n] = 1, which is the 2^(w*n) that we added before.
   //
-  // Since k = a - 2^256 (mod curve->order), we can compute
-  //   k*G = sum_{i=0..63} a[i] 16^i * G
+  // Since k = a - 2^(w*n) (mod curve->order), we can compute
+  //   k*G = sum_{i=0..n-1} a[i] 2^(w*i) * G
   //
   // We have a big table curve->cp that stores all possible
-  // values of |a[i]| 16^i * G.
-  // curve->cp[i][j] = (2*j+1) * 16^i * G
+  // values of |a[i]| 2^(w*i) * G.
+  // curve->cp[i][j] = (2*j+1) * 2^(w*i) * G
 
-  // now compute  res = sum_{i=0..63} a[i] * 16^i * G step by step.
-  // initial res = |a[0]| * G.  Note that a[0] = a & 0xf if (a&0x10) != 0
-  // and - (16 - (a & 0xf)) otherwise.   We can compute this as
-  //   ((a ^ (((a >> 4) & 1) - 1)) & 0xf) >> 1
+  // now compute  res = sum_{i=0..n-1} a[i] * 2^(w*i) * G step by step.
+  // initial res = |a[0]| * G.  Note that a[0] = a & mask if (a >> w) & 1
+  // and - (2^w - (a & mask)) otherwise.   We can compute this as
+  //   ((a ^ (((a >> w) & 1) - 1)) & mask) >> 1
   // since a is odd.
-  lowbits = a.val[0] & ((1 << 5) - 1);
-  lowbits ^= (lowbits >> 4) - 1;
-  lowbits &= 15;
+  lowbits = a.val[0] & ((1 << (w + 1)) - 1);
+  lowbits ^= (lowbits >> w) - 1;
+  lowbits &= mask;
   curve_to_jacobian(&curve->cp[0][lowbits >> 1], &jres, prime);
-  for (i = 1; i < 64; i++) {
-    // invariant res = sign(a[i-1]) sum_{j=0..i-1} (a[j] * 16^j * G)
+  for (i = 1; i < CP_WINDOWS; i++) {
+    // invariant res = sign(a[i-1]) sum_{j=0..i-1} (a[j] * 2^(w*j) * G)
 
-    // shift a by 4 places.
+    // shift a by w places.
     for (j = 0; j < 8; j++) {
-      a.val[j] = (a.val[j] >> 4) | ((a.val[j + 1] & 0xf) << 26);
+      a.val[j] = (a.val[j] >> w) | ((a.val[j + 1] & mask) << (30 - w));
     }
-    a.val[j] >>= 4;
-    // a = old(a)>>(4*i)
+    a.val[j] >>= w;
+    // a = old(a)>>(w*i)
     // a is even iff sign(a[i-1]) = -1
 
-    lowbits = a.val[0] & ((1 << 5) - 1);
-    lowbits ^= (lowbits >> 4) - 1;
-    lowbits &= 15;
+    lowbits = a.val[0] & ((1 << (w + 1)) - 1);
+    lowbits ^= (lowbits >> w) - 1;
+    lowbits &= mask;
     // negate last result to make signs of this round and the
     // last round equal.
     conditional_negate((lowbits & 1) - 1, &jres.y, prime);
@@ -619,7 +623,7 @@ void scalar_multiply(const ecdsa_curve *curve, const bignum256 *k,
     // add odd factor
     point_jacobian_add(&curve->cp[i][lowbits >> 1], &jres, curve);
   }
-  conditional_negate(((a.val[0] >> 4) & 1) - 1, &jres.y, prime);
+  conditional_negate(((a.val[0] >> w) & 1) - 1, &jres.y, prime);
   jacobian_to_curve(&jres, res, prime);
   memzero(&a, sizeof(a));
   memzero(&jres, sizeof(jres));
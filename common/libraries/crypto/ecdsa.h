@@ -34,6 +34,13 @@ typedef struct {
   bignum256 x, y;
 } curve_point;
 
+#if USE_PRECOMPUTED_CP
+// number of windows and of points per window in the precomputed table
+#define CP_WINDOWS \
+  ((256 + USE_PRECOMPUTED_CP_WINDOW - 1) / USE_PRECOMPUTED_CP_WINDOW)
+#define CP_POINTS (1 << (USE_PRECOMPUTED_CP_WINDOW - 1))
+#endif
+
 typedef struct {
   bignum256 prime;       // prime order of the finite field
   curve_point G;         // initial curve point
@@ -43,7 +50,7 @@ typedef struct {
   bignum256 b;           // coefficient 'b' of the elliptic curve
 
 #if USE_PRECOMPUTED_CP
-  const curve_point cp[64][8];
+  const curve_point cp[CP_WINDOWS][CP_POINTS];
 #endif
 
 } ecdsa_curve;
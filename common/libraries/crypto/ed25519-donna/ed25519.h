@@ -10,6 +10,8 @@ extern "C" {
 typedef unsigned char ed25519_signature[64];
 typedef unsigned char ed25519_public_key[32];
 typedef unsigned char ed25519_secret_key[32];
+/* clamped scalar (0..31) and nonce prefix (32..63) of a secret key */
+typedef unsigned char ed25519_expanded_secret_key[64];
 
 typedef unsigned char curve25519_key[32];
 
@@ -22,6 +24,10 @@ void ed25519_publickey_ext(const ed25519_secret_key sk, const ed25519_secret_key
 
 int ed25519_sign_open(const unsigned char *m, size_t mlen, const ed25519_public_key pk, const ed25519_signature RS);
 void ed25519_sign(const unsigned char *m, size_t mlen, const ed25519_secret_key sk, const ed25519_public_key pk, ed25519_signature RS);
+/* ed25519_sign() split in two: expand the secret key once (one SHA-512) and
+ * sign any number of messages with it. Wipe the expanded key after use. */
+void ed25519_expand_secret_key(const ed25519_secret_key sk, ed25519_expanded_secret_key extsk);
+void ed25519_sign_expanded(const unsigned char *m, size_t mlen, const ed25519_expanded_secret_key extsk, const ed25519_public_key pk, ed25519_signature RS);
 #if USE_CARDANO
 void ed25519_sign_ext(const unsigned char *m, size_t mlen, const ed25519_secret_key sk, const ed25519_secret_key skext, const ed25519_public_key pk, ed25519_signature RS);
 #endif
@@ -21,8 +21,12 @@
  */
 
 #include "hasher.h"
+#include "memzero.h"
 #include "ripemd160.h"
 
+static const uint32_t ripemd160_initial_state[5] = {
+    0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xC3D2E1F0};
+
 void hasher_InitParam(Hasher *hasher, HasherType type, const void *param,
                       uint32_t param_size) {
   hasher->type = type;
@@ -141,7 +145,57 @@ void hasher_Raw(HasherType type, const uint8_t *data, size_t length,
                 uint8_t hash[HASHER_DIGEST_LENGTH]) {
   Hasher hasher = {0};
 
+  if (type == HASHER_SHA2_RIPEMD) {
+    hasher_Hash160(data, length, hash);
+    return;
+  }
+
   hasher_Init(&hasher, type);
   hasher_Update(&hasher, data, length);
   hasher_Final(&hasher, hash);
 }
+
+void hasher_Hash160(const uint8_t *data, size_t length, uint8_t *hash) {
+  uint32_t state[8] = {0};
+  uint32_t block[16] = {0};
+  uint32_t digest[5] = {0};
+
+  if (length <= SHA256_BLOCK_LENGTH - 9) {
+    // a single SHA-256 block: data, 0x80 and the length in bits, as big
+    // endian words
+    for (size_t i = 0; i < length; i++) {
+      block[i / 4] |= (uint32_t)data[i] << (24 - 8 * (i % 4));
+    }
+    block[length / 4] |= (uint32_t)0x80 << (24 - 8 * (length % 4));
+    block[15] = length * 8;
+    sha256_Transform(sha256_initial_hash_value, block, state);
+  } else {
+    uint8_t sha[SHA256_DIGEST_LENGTH] = {0};
+    sha256_Raw(data, length, sha);
+    for (int i = 0; i < 8; i++) {
+      state[i] = (uint32_t)sha[4 * i] << 24 | (uint32_t)sha[4 * i + 1] << 16 |
+                 (uint32_t)sha[4 * i + 2] << 8 | sha[4 * i + 3];
+    }
+    memzero(sha, sizeof(sha));
+  }
+
+  // the SHA-256 digest is a single RIPEMD-160 block too, as little endian
+  // words: the digest, 0x80 and 256 bits
+  memzero(block, sizeof(block));
+  for (int i = 0; i < 8; i++) {
+    block[i] = __builtin_bswap32(state[i]);
+  }
+  block[8] = 0x80;
+  block[14] = 8 * SHA256_DIGEST_LENGTH;
+  ripemd160_Transform(ripemd160_initial_state, block, digest);
+
+  for (int i = 0; i < 5; i++) {
+    hash[4 * i] = digest[i];
+    hash[4 * i + 1] = digest[i] >> 8;
+    hash[4 * i + 2] = digest[i] >> 16;
+    hash[4 * i + 3] = digest[i] >> 24;
+  }
+  memzero(state, sizeof(state));
+  memzero(block, sizeof(block));
+  memzero(digest, sizeof(digest));
+}
@@ -78,5 +78,9 @@ void hasher_Final(Hasher *hasher, uint8_t hash[HASHER_DIGEST_LENGTH]);
 
 void hasher_Raw(HasherType type, const uint8_t *data, size_t length,
                 uint8_t hash[HASHER_DIGEST_LENGTH]);
+// RIPEMD160(SHA256(data)) into the first 20 bytes of hash, without the
+// buffering of the streaming APIs for data of up to 55 bytes (eg. a public
+// key); hasher_Raw(HASHER_SHA2_RIPEMD, ...) uses it
+void hasher_Hash160(const uint8_t *data, size_t length, uint8_t *hash);
 
 #endif
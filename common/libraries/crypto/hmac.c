@@ -174,3 +174,39 @@ void hmac_sha512_prepare(const uint8_t *key, const uint32_t keylen,
   sha512_Transform(sha512_initial_hash_value, key_pad, ipad_digest);
   memzero(key_pad, sizeof(key_pad));
 }
+
+/*
+ * HMAC-SHA512 of msg resumed from the pad digests of hmac_sha512_prepare(),
+ * so that several messages under the same key skip the two key pad blocks.
+ * The outer hash only has the inner digest left to absorb, which is the block
+ * sha512_Transform_digest() is specialised for.
+ */
+void hmac_sha512_prepared(const uint64_t *opad_digest,
+                          const uint64_t *ipad_digest,
+                          const uint8_t *msg,
+                          const uint32_t msglen,
+                          uint8_t *hmac) {
+  static CONFIDENTIAL SHA512_CTX context;
+  static CONFIDENTIAL uint64_t digest[SHA512_DIGEST_LENGTH / sizeof(uint64_t)];
+
+  memcpy(context.state, ipad_digest, sizeof(context.state));
+  memzero(context.buffer, sizeof(context.buffer));
+  context.bitcount[0] = SHA512_BLOCK_LENGTH * 8;
+  context.bitcount[1] = 0;
+  sha512_Update(&context, msg, msglen);
+  sha512_Final(&context, (uint8_t *)digest);
+
+#if BYTE_ORDER == LITTLE_ENDIAN
+  for (int i = 0; i < SHA512_DIGEST_LENGTH / (int)sizeof(uint64_t); i++) {
+    REVERSE64(digest[i], digest[i]);
+  }
+#endif
+  sha512_Transform_digest(opad_digest, digest, digest);
+#if BYTE_ORDER == LITTLE_ENDIAN
+  for (int i = 0; i < SHA512_DIGEST_LENGTH / (int)sizeof(uint64_t); i++) {
+    REVERSE64(digest[i], digest[i]);
+  }
+#endif
+  memcpy(hmac, digest, SHA512_DIGEST_LENGTH);
+  memzero(digest, sizeof(digest));
+}
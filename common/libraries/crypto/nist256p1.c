@@ -53,7 +53,11 @@ const ecdsa_curve nist256p1 = {
     ,
     /* cp */
     {
+#if USE_PRECOMPUTED_CP_WINDOW == 4
 #include "nist256p1.table"
+#else
+#include "nist256p1_cp.table"
+#endif
     }
 #endif
 };
@@ -28,6 +28,17 @@
 #define USE_PRECOMPUTED_CP 1
 #endif
 
+// window in bits of the precomputed curve points. The tables for a window
+// other than 4 are generated by utilities/crypto/generate-cp-tables.py
+#ifndef USE_PRECOMPUTED_CP_WINDOW
+#define USE_PRECOMPUTED_CP_WINDOW 4
+#endif
+
+// use the reduction specific to the secp256k1 field prime in bn_multiply
+#ifndef USE_SECP256K1_FAST_REDUCE
+#define USE_SECP256K1_FAST_REDUCE 1
+#endif
+
 // use fast inverse method
 #ifndef USE_INVERSE_FAST
 #define USE_INVERSE_FAST 1
@@ -43,6 +54,11 @@
 #define USE_RFC6979 1
 #endif
 
+// use the bit-interleaved 32-bit Keccak-f[1600] permutation
+#ifndef SHA3_BIT_INTERLEAVED
+#define SHA3_BIT_INTERLEAVED 1
+#endif
+
 // implement BIP32 caching
 #ifndef USE_BIP32_CACHE
 #define USE_BIP32_CACHE 1
@@ -50,6 +66,12 @@
 #define BIP32_CACHE_MAXDEPTH 8
 #endif
 
+// keep the HMAC-SHA512 pad digests of the last parent chain code, so that
+// deriving several children of one node hashes the key pads only once
+#ifndef USE_BIP32_HMAC_CACHE
+#define USE_BIP32_HMAC_CACHE 1
+#endif
+
 // support constructing BIP32 nodes from ed25519 and curve25519 curves.
 #ifndef USE_BIP32_25519_CURVES
 #define USE_BIP32_25519_CURVES 1
@@ -91,10 +113,29 @@
 #define USE_KECCAK 1
 #endif
 
-// add way how to mark confidential data
+// place hot code and confidential data in the SRAM2 of the device, see
+// STM32L486RGTX_FLASH.ld; code runs from there without wait states and
+// without contending with data accesses, and SRAM2 is zeroed at every reset
+#if defined(USE_SIMULATOR) && USE_SIMULATOR == 0
+#ifndef SRAM2_CODE
+#define SRAM2_CODE __attribute__((section(".sram2_text"), noinline))
+#endif
+#ifndef SRAM2_BSS
+#define SRAM2_BSS __attribute__((section(".sram2_bss")))
+#endif
+#else
+#ifndef SRAM2_CODE
+#define SRAM2_CODE
+#endif
+#ifndef SRAM2_BSS
+#define SRAM2_BSS
+#endif
+#endif
+
+// add way how to mark confidential data; only zero-initialized static
+// storage may be marked as SRAM2 is not loaded from flash
 #ifndef CONFIDENTIAL
-// TODO: Add attribute keep confidential variables in SRAM2 CHI-2141
-#define CONFIDENTIAL
+#define CONFIDENTIAL SRAM2_BSS
 #endif
 
 #endif
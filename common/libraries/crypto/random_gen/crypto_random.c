@@ -2,9 +2,26 @@
 #include <stdlib.h>
 #include "logger.h"
 #include "app_error.h"
+#include "memzero.h"
+#include "options.h"
+#include "task_scheduler.h"
+
+/// Number of 32 bit words kept ready for the next requests
+#define CRYPTO_RANDOM_POOL_WORDS 16
+/// Slice given to the background refill of the pool
+#define CRYPTO_RANDOM_REFILL_SLICE_MS 1
 
 static bool begun = false;
 
+/// Words drawn ahead of time; pool[0] to pool[pool_count - 1] are unused
+static CONFIDENTIAL uint32_t pool[CRYPTO_RANDOM_POOL_WORDS];
+static uint8_t pool_count = 0;
+/// Last word returned by the hardware, for the repetition test
+static CONFIDENTIAL uint32_t last_word;
+static bool last_word_valid = false;
+
+static bool crypto_random_refill_task(uint32_t budget_ms);
+
 uint32_t crypto_random_begin()
 {
 	BSP_RNG_Init();
@@ -13,23 +30,80 @@ uint32_t crypto_random_begin()
 
 void crypto_random_end()
 {
+	// the words drawn ahead would end up in keys & nonces; do not keep them
+	sched_remove_task(crypto_random_refill_task);
+	memzero(pool, sizeof(pool));
+	pool_count = 0;
+	memzero(&last_word, sizeof(last_word));
+	last_word_valid = false;
 	BSP_RNG_End();
 }
 
+/**
+ * @brief Draws one word from the hardware RNG and runs the continuous health
+ * test on it: a word repeating the previous one means the source is stuck,
+ * which is otherwise a ~2^-32 event.
+ */
+static bool crypto_random_draw(uint32_t* word)
+{
+	uint32_t rng_status = BSP_RNG_Generate(word);
+	if (rng_status != 0) {
+		LOG_ERROR("err:%08X\n", RNG_MCU_ERROR_BASE | rng_status);
+		return false;
+	}
+	if (last_word_valid && *word == last_word) {
+		last_word_valid = false;
+		LOG_ERROR("err:%08X\n", RNG_HEALTH_TEST_ERROR);
+		return false;
+	}
+	last_word = *word;
+	last_word_valid = true;
+	return true;
+}
+
+/**
+ * @brief Background task topping up the pool once the flow is idle, so the
+ * next request rarely waits on the hardware
+ */
+static bool crypto_random_refill_task(uint32_t budget_ms)
+{
+	sched_remove_task(crypto_random_refill_task);
+	while (pool_count < CRYPTO_RANDOM_POOL_WORDS) {
+		if (!crypto_random_draw(&pool[pool_count])) {
+			break;
+		}
+		pool_count++;
+	}
+	return false;
+}
+
 bool crypto_random_generate(uint8_t* buf, uint16_t bufsize)
 {
-	uint32_t random_32bit;
-	uint16_t i=0;
-	uint32_t rng_status;
-	do{
-		if(rng_status = BSP_RNG_Generate(&random_32bit) != 0){
-			LOG_ERROR("err:%08X\n", RNG_MCU_ERROR_BASE | rng_status);
-			return false;
+	uint32_t random_32bit = 0;
+	uint16_t i = 0;
+	bool status = true;
+
+	while (i < bufsize) {
+		if (pool_count > 0) {
+			random_32bit = pool[--pool_count];
+			pool[pool_count] = 0;
+		} else if (!crypto_random_draw(&random_32bit)) {
+			status = false;
+			break;
 		}
-//TODO: Utilize complete 32 bit random from MCU
-		buf[i++]=random_32bit%256;
-	}while(i<bufsize);
-	return true;
+		// every byte of the word is used
+		for (uint8_t j = 0; j < sizeof(random_32bit) && i < bufsize; j++) {
+			buf[i++] = random_32bit >> (8 * j);
+		}
+	}
+	memzero(&random_32bit, sizeof(random_32bit));
+
+	if (pool_count < CRYPTO_RANDOM_POOL_WORDS) {
+		sched_add_task(crypto_random_refill_task,
+		               SCHED_PRIO_LOW,
+		               CRYPTO_RANDOM_REFILL_SLICE_MS);
+	}
+	return status;
 }
 
 /**
@@ -74,7 +74,7 @@ void ripemd160_Init(RIPEMD160_CTX *ctx)
  */
 void ripemd160_process( RIPEMD160_CTX *ctx, const uint8_t data[RIPEMD160_BLOCK_LENGTH] )
 {
-    uint32_t A = 0, B = 0, C = 0, D = 0, E = 0, Ap = 0, Bp = 0, Cp = 0, Dp = 0, Ep = 0, X[16] = {0};
+    uint32_t X[16] = {0};
 
     GET_UINT32_LE( X[ 0], data,  0 );
     GET_UINT32_LE( X[ 1], data,  4 );
@@ -93,11 +93,21 @@ void ripemd160_process( RIPEMD160_CTX *ctx, const uint8_t data[RIPEMD160_BLOCK_L
     GET_UINT32_LE( X[14], data, 56 );
     GET_UINT32_LE( X[15], data, 60 );
 
-    A = Ap = ctx->state[0];
-    B = Bp = ctx->state[1];
-    C = Cp = ctx->state[2];
-    D = Dp = ctx->state[3];
-    E = Ep = ctx->state[4];
+    ripemd160_Transform( ctx->state, X, ctx->state );
+}
+
+/*
+ * Compress one block given as little endian words; state_out may be state_in
+ */
+void ripemd160_Transform( const uint32_t state_in[5], const uint32_t X[16], uint32_t state_out[5] )
+{
+    uint32_t A = 0, B = 0, C = 0, D = 0, E = 0, Ap = 0, Bp = 0, Cp = 0, Dp = 0, Ep = 0;
+
+    A = Ap = state_in[0];
+    B = Bp = state_in[1];
+    C = Cp = state_in[2];
+    D = Dp = state_in[3];
+    E = Ep = state_in[4];
 
 #define F1( x, y, z )   ( x ^ y ^ z )
 #define F2( x, y, z )   ( ( x & y ) | ( ~x & z ) )
@@ -241,12 +251,12 @@ void ripemd160_process( RIPEMD160_CTX *ctx, const uint8_t data[RIPEMD160_BLOCK_L
 #undef Fp
 #undef Kp
 
-    C             = ctx->state[1] + C + Dp;
-    ctx->state[1] = ctx->state[2] + D + Ep;
-    ctx->state[2] = ctx->state[3] + E + Ap;
-    ctx->state[3] = ctx->state[4] + A + Bp;
-    ctx->state[4] = ctx->state[0] + B + Cp;
-    ctx->state[0] = C;
+    C            = state_in[1] + C + Dp;
+    state_out[1] = state_in[2] + D + Ep;
+    state_out[2] = state_in[3] + E + Ap;
+    state_out[3] = state_in[4] + A + Bp;
+    state_out[4] = state_in[0] + B + Cp;
+    state_out[0] = C;
 }
 #endif /* !MBEDTLS_RIPEMD160_PROCESS_ALT */
 
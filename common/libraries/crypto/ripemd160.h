@@ -13,6 +13,9 @@ typedef struct _RIPEMD160_CTX {
 } RIPEMD160_CTX;
 
 void ripemd160_Init(RIPEMD160_CTX *ctx);
+// Compresses a block of 16 little endian words; state_out may be state_in
+void ripemd160_Transform(const uint32_t state_in[5], const uint32_t data[16],
+                         uint32_t state_out[5]);
 void ripemd160_Update(RIPEMD160_CTX *ctx, const uint8_t *input, uint32_t ilen);
 void ripemd160_Final(RIPEMD160_CTX *ctx,
                      uint8_t output[RIPEMD160_DIGEST_LENGTH]);
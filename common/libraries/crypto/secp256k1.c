@@ -51,7 +51,11 @@ const ecdsa_curve secp256k1 = {
     ,
     /* cp */
     {
+#if USE_PRECOMPUTED_CP_WINDOW == 4
 #include "secp256k1.table"
+#else
+#include "secp256k1_cp.table"
+#endif
     }
 #endif
 };
@@ -57,6 +57,13 @@ int segwit_addr_encode(char *output, const char *hrp, int ver,
 int segwit_addr_decode(int *ver, uint8_t *prog, size_t *prog_len,
                        const char *hrp, const char *addr);
 
+/** Advance a Bech32 checksum by one 5-bit value
+ *
+ *  In: pre: Checksum so far; the caller XORs the next value into the result.
+ *  Returns the checksum shifted by one 5-bit position and reduced.
+ */
+uint32_t bech32_polymod_step(uint32_t pre);
+
 /** Encode a Bech32 string
  *
  *  Out: output:  Pointer to a buffer of size strlen(hrp) + data_len + 8 that
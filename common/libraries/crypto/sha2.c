@@ -32,6 +32,7 @@
 #include <stdint.h>
 #include "sha2.h"
 #include "memzero.h"
+#include "options.h"
 
 /*
  * ASSERT NOTE:
@@ -51,7 +52,17 @@
  *
  *   #define SHA2_UNROLL_TRANSFORM
  *
+ * SHA-256 is the hottest digest of the firmware, hence its transform is fully
+ * unrolled (all 64 rounds with a constant message schedule index) unless
+ * SHA256_UNROLL_TRANSFORM is defined to 0. The same goes for the SHA-512
+ * transform behind BIP-32 derivation and SHA512_UNROLL_TRANSFORM.
  */
+#ifndef SHA256_UNROLL_TRANSFORM
+#define SHA256_UNROLL_TRANSFORM 1
+#endif
+#ifndef SHA512_UNROLL_TRANSFORM
+#define SHA512_UNROLL_TRANSFORM 1
+#endif
 
 
 /*** SHA-256/384/512 Machine Architecture Definitions *****************/
@@ -676,33 +687,52 @@ void sha256_Init(SHA256_CTX* context) {
 	context->bitcount = 0;
 }
 
-#ifdef SHA2_UNROLL_TRANSFORM
+#if defined(SHA2_UNROLL_TRANSFORM) || SHA256_UNROLL_TRANSFORM
 
-/* Unrolled SHA-256 round macros: */
+/* Unrolled SHA-256 round macros, i is the (constant) round number: */
 
-#define ROUND256_0_TO_15(a,b,c,d,e,f,g,h)	\
+#define ROUND256_0_TO_15(a,b,c,d,e,f,g,h,i)	\
 	T1 = (h) + Sigma1_256(e) + Ch((e), (f), (g)) + \
-	     K256[j] + (W256[j] = *data++); \
+	     K256[i] + (W256[i] = data[i]); \
 	(d) += T1; \
-	(h) = T1 + Sigma0_256(a) + Maj((a), (b), (c)); \
-	j++
+	(h) = T1 + Sigma0_256(a) + Maj((a), (b), (c))
 
-#define ROUND256(a,b,c,d,e,f,g,h)	\
-	s0 = W256[(j+1)&0x0f]; \
+#define ROUND256(a,b,c,d,e,f,g,h,i)	\
+	s0 = W256[((i)+1)&0x0f]; \
 	s0 = sigma0_256(s0); \
-	s1 = W256[(j+14)&0x0f]; \
+	s1 = W256[((i)+14)&0x0f]; \
 	s1 = sigma1_256(s1); \
-	T1 = (h) + Sigma1_256(e) + Ch((e), (f), (g)) + K256[j] + \
-	     (W256[j&0x0f] += s1 + W256[(j+9)&0x0f] + s0); \
+	T1 = (h) + Sigma1_256(e) + Ch((e), (f), (g)) + K256[i] + \
+	     (W256[(i)&0x0f] += s1 + W256[((i)+9)&0x0f] + s0); \
 	(d) += T1; \
-	(h) = T1 + Sigma0_256(a) + Maj((a), (b), (c)); \
-	j++
-
-void sha256_Transform(const sha2_word32* state_in, const sha2_word32* data, sha2_word32* state_out) {
+	(h) = T1 + Sigma0_256(a) + Maj((a), (b), (c))
+
+/* Eight rounds starting at round i, the registers rotate back in place: */
+
+#define ROUNDS256_0_TO_15(i)	\
+	ROUND256_0_TO_15(a,b,c,d,e,f,g,h,(i)); \
+	ROUND256_0_TO_15(h,a,b,c,d,e,f,g,(i)+1); \
+	ROUND256_0_TO_15(g,h,a,b,c,d,e,f,(i)+2); \
+	ROUND256_0_TO_15(f,g,h,a,b,c,d,e,(i)+3); \
+	ROUND256_0_TO_15(e,f,g,h,a,b,c,d,(i)+4); \
+	ROUND256_0_TO_15(d,e,f,g,h,a,b,c,(i)+5); \
+	ROUND256_0_TO_15(c,d,e,f,g,h,a,b,(i)+6); \
+	ROUND256_0_TO_15(b,c,d,e,f,g,h,a,(i)+7)
+
+#define ROUNDS256(i)	\
+	ROUND256(a,b,c,d,e,f,g,h,(i)); \
+	ROUND256(h,a,b,c,d,e,f,g,(i)+1); \
+	ROUND256(g,h,a,b,c,d,e,f,(i)+2); \
+	ROUND256(f,g,h,a,b,c,d,e,(i)+3); \
+	ROUND256(e,f,g,h,a,b,c,d,(i)+4); \
+	ROUND256(d,e,f,g,h,a,b,c,(i)+5); \
+	ROUND256(c,d,e,f,g,h,a,b,(i)+6); \
+	ROUND256(b,c,d,e,f,g,h,a,(i)+7)
+
+SRAM2_CODE void sha256_Transform(const sha2_word32* state_in, const sha2_word32* data, sha2_word32* state_out) {
 	sha2_word32	a = 0, b = 0, c = 0, d = 0, e = 0, f = 0, g = 0, h = 0, s0 = 0, s1 = 0;
 	sha2_word32	T1 = 0;
 	sha2_word32 W256[16] = {0};
-	int		j = 0;
 
 	/* Initialize registers with the prev. intermediate value */
 	a = state_in[0];
@@ -714,30 +744,17 @@ void sha256_Transform(const sha2_word32* state_in, const sha2_word32* data, sha2
 	g = state_in[6];
 	h = state_in[7];
 
-	j = 0;
-	do {
-		/* Rounds 0 to 15 (unrolled): */
-		ROUND256_0_TO_15(a,b,c,d,e,f,g,h);
-		ROUND256_0_TO_15(h,a,b,c,d,e,f,g);
-		ROUND256_0_TO_15(g,h,a,b,c,d,e,f);
-		ROUND256_0_TO_15(f,g,h,a,b,c,d,e);
-		ROUND256_0_TO_15(e,f,g,h,a,b,c,d);
-		ROUND256_0_TO_15(d,e,f,g,h,a,b,c);
-		ROUND256_0_TO_15(c,d,e,f,g,h,a,b);
-		ROUND256_0_TO_15(b,c,d,e,f,g,h,a);
-	} while (j < 16);
+	/* Rounds 0 to 15: */
+	ROUNDS256_0_TO_15(0);
+	ROUNDS256_0_TO_15(8);
 
 	/* Now for the remaining rounds to 64: */
-	do {
-		ROUND256(a,b,c,d,e,f,g,h);
-		ROUND256(h,a,b,c,d,e,f,g);
-		ROUND256(g,h,a,b,c,d,e,f);
-		ROUND256(f,g,h,a,b,c,d,e);
-		ROUND256(e,f,g,h,a,b,c,d);
-		ROUND256(d,e,f,g,h,a,b,c);
-		ROUND256(c,d,e,f,g,h,a,b);
-		ROUND256(b,c,d,e,f,g,h,a);
-	} while (j < 64);
+	ROUNDS256(16);
+	ROUNDS256(24);
+	ROUNDS256(32);
+	ROUNDS256(40);
+	ROUNDS256(48);
+	ROUNDS256(56);
 
 	/* Compute the current intermediate hash value */
 	state_out[0] = state_in[0] + a;
@@ -753,9 +770,9 @@ void sha256_Transform(const sha2_word32* state_in, const sha2_word32* data, sha2
 	a = b = c = d = e = f = g = h = T1 = 0;
 }
 
-#else /* SHA2_UNROLL_TRANSFORM */
+#else /* SHA2_UNROLL_TRANSFORM || SHA256_UNROLL_TRANSFORM */
 
-void sha256_Transform(const sha2_word32* state_in, const sha2_word32* data, sha2_word32* state_out) {
+SRAM2_CODE void sha256_Transform(const sha2_word32* state_in, const sha2_word32* data, sha2_word32* state_out) {
 	sha2_word32	a = 0, b = 0, c = 0, d = 0, e = 0, f = 0, g = 0, h = 0, s0 = 0, s1 = 0;
 	sha2_word32	T1 = 0, T2 = 0 , W256[16] = {0};
 	int		j = 0;
@@ -824,7 +841,7 @@ void sha256_Transform(const sha2_word32* state_in, const sha2_word32* data, sha2
 	a = b = c = d = e = f = g = h = T1 = T2 = 0;
 }
 
-#endif /* SHA2_UNROLL_TRANSFORM */
+#endif /* SHA2_UNROLL_TRANSFORM || SHA256_UNROLL_TRANSFORM */
 
 void sha256_Update(SHA256_CTX* context, const sha2_byte *data, size_t len) {
 	unsigned int	freespace = 0, usedspace = 0;
@@ -965,6 +982,203 @@ void sha256_Raw(const sha2_byte* data, size_t len, uint8_t digest[SHA256_DIGEST_
 	sha256_Final(&context, digest);
 }
 
+int sha256_CloneMid(const SHA256_CTX* context, SHA256_MID* mid) {
+	/* A midstate only exists at a block boundary */
+	if ((context->bitcount >> 3) % SHA256_BLOCK_LENGTH != 0) {
+		return 0;
+	}
+	MEMCPY_BCOPY(mid->state, context->state, sizeof(mid->state));
+	mid->bitcount = context->bitcount;
+	return 1;
+}
+
+void sha256_FromMid(SHA256_CTX* context, const SHA256_MID* mid) {
+	MEMCPY_BCOPY(context->state, mid->state, sizeof(context->state));
+	memzero(context->buffer, SHA256_BLOCK_LENGTH);
+	context->bitcount = mid->bitcount;
+}
+
+/*** SHA-256 proof of work: ******************************************/
+/* K256[i] + W[i] of the padding block of a 64-byte message, which is the
+ * second block hashed by the proof of work */
+static const sha2_word32 sha256_pow_pad_kw[64] = {
+	0xc28a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5,
+	0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+	0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+	0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf374,
+	0x649b69c1, 0xf0fe4786, 0x0fe1edc6, 0x240cf254,
+	0x4fe9346f, 0x6cc984be, 0x61b9411e, 0x16f988fa,
+	0xf2c65152, 0xa88e5a6d, 0xb019fc65, 0xb9d99ec7,
+	0x9a1231c3, 0xe70eeaa0, 0xfdb1232b, 0xc7353eb0,
+	0x3069bad5, 0xcb976d5f, 0x5a0f118f, 0xdc1eeefd,
+	0x0a35b689, 0xde0b7a04, 0x58f4ca9d, 0xe15d5b16,
+	0x007f3e86, 0x37088980, 0xa507ea32, 0x6fab9537,
+	0x17406110, 0x0d8cd6f1, 0xcdaa3b6d, 0xc0bbbe37,
+	0x83613bda, 0xdb48a363, 0x0b02e931, 0x6fd15ca7,
+	0x521afaca, 0x31338431, 0x6ed41a95, 0x6d437890,
+	0xc39c91f2, 0x9eccabbd, 0xb5c9a0e6, 0x532fb63c,
+	0xd2c741c6, 0x07237ea3, 0xa4954b68, 0x4c191d76,
+};
+
+#define POW_ROUND256(a,b,c,d,e,f,g,h,kw)	\
+	T1 = (h) + Sigma1_256(e) + Ch((e), (f), (g)) + (kw); \
+	(d) += T1; \
+	(h) = T1 + Sigma0_256(a) + Maj((a), (b), (c))
+
+/* Eight rounds starting at round i, KW(i) gives K256[i] + W[i]: */
+#define POW_ROUNDS256(KW, i)	\
+	POW_ROUND256(a,b,c,d,e,f,g,h,KW((i))); \
+	POW_ROUND256(h,a,b,c,d,e,f,g,KW((i)+1)); \
+	POW_ROUND256(g,h,a,b,c,d,e,f,KW((i)+2)); \
+	POW_ROUND256(f,g,h,a,b,c,d,e,KW((i)+3)); \
+	POW_ROUND256(e,f,g,h,a,b,c,d,KW((i)+4)); \
+	POW_ROUND256(d,e,f,g,h,a,b,c,KW((i)+5)); \
+	POW_ROUND256(c,d,e,f,g,h,a,b,KW((i)+6)); \
+	POW_ROUND256(b,c,d,e,f,g,h,a,KW((i)+7))
+
+#define POW_KW_MESSAGE(i)	(K256[i] + W256[i])
+#define POW_KW_SCHEDULE(i)	(K256[i] + (W256[(i)&0x0f] += \
+	sigma1_256(W256[((i)+14)&0x0f]) + W256[((i)+9)&0x0f] + \
+	sigma0_256(W256[((i)+1)&0x0f])))
+#define POW_KW_PADDING(i)	(sha256_pow_pad_kw[i])
+
+static sha2_word32 sha256_pow_read_be(const sha2_byte* bytes) {
+	return ((sha2_word32)bytes[0] << 24) | ((sha2_word32)bytes[1] << 16) |
+	       ((sha2_word32)bytes[2] << 8) | (sha2_word32)bytes[3];
+}
+
+/* Runs rounds 0 to 14 of the first block, which do not see the last nonce
+ * word, the one which changes on nearly every increment */
+static void sha256_pow_prepare(SHA256_POW* pow) {
+	sha2_word32	a = 0, b = 0, c = 0, d = 0, e = 0, f = 0, g = 0, h = 0;
+	sha2_word32	T1 = 0;
+	sha2_word32	W256[16] = {0};
+	int i = 0;
+
+	for (i = 0; i < 8; i++) {
+		W256[i] = pow->prefix[i];
+		W256[8 + i] = pow->nonce[i];
+	}
+	a = sha256_initial_hash_value[0];
+	b = sha256_initial_hash_value[1];
+	c = sha256_initial_hash_value[2];
+	d = sha256_initial_hash_value[3];
+	e = sha256_initial_hash_value[4];
+	f = sha256_initial_hash_value[5];
+	g = sha256_initial_hash_value[6];
+	h = sha256_initial_hash_value[7];
+	POW_ROUNDS256(POW_KW_MESSAGE, 0);
+	POW_ROUND256(a,b,c,d,e,f,g,h,POW_KW_MESSAGE(8));
+	POW_ROUND256(h,a,b,c,d,e,f,g,POW_KW_MESSAGE(9));
+	POW_ROUND256(g,h,a,b,c,d,e,f,POW_KW_MESSAGE(10));
+	POW_ROUND256(f,g,h,a,b,c,d,e,POW_KW_MESSAGE(11));
+	POW_ROUND256(e,f,g,h,a,b,c,d,POW_KW_MESSAGE(12));
+	POW_ROUND256(d,e,f,g,h,a,b,c,POW_KW_MESSAGE(13));
+	POW_ROUND256(c,d,e,f,g,h,a,b,POW_KW_MESSAGE(14));
+
+	/* Registers in the order round 15 expects them */
+	pow->state[0] = b;
+	pow->state[1] = c;
+	pow->state[2] = d;
+	pow->state[3] = e;
+	pow->state[4] = f;
+	pow->state[5] = g;
+	pow->state[6] = h;
+	pow->state[7] = a;
+
+	a = b = c = d = e = f = g = h = T1 = 0;
+}
+
+void sha256_pow_init(SHA256_POW* pow, const sha2_byte prefix[32], const sha2_byte nonce[32]) {
+	int i = 0;
+	for (i = 0; i < 8; i++) {
+		pow->prefix[i] = sha256_pow_read_be(&prefix[4 * i]);
+		pow->nonce[i] = sha256_pow_read_be(&nonce[4 * i]);
+	}
+	sha256_pow_prepare(pow);
+}
+
+int sha256_pow_search(SHA256_POW* pow, const sha2_word32 target[8], size_t count) {
+	sha2_word32	a = 0, b = 0, c = 0, d = 0, e = 0, f = 0, g = 0, h = 0;
+	sha2_word32	T1 = 0;
+	sha2_word32	W256[16] = {0};
+	sha2_word32	mid[8] = {0};
+	int i = 0;
+
+	for (; count > 0; count--) {
+		/* First block: prefix || nonce, resumed after round 14 */
+		for (i = 0; i < 8; i++) {
+			W256[i] = pow->prefix[i];
+			W256[8 + i] = pow->nonce[i];
+		}
+		b = pow->state[0];
+		c = pow->state[1];
+		d = pow->state[2];
+		e = pow->state[3];
+		f = pow->state[4];
+		g = pow->state[5];
+		h = pow->state[6];
+		a = pow->state[7];
+		POW_ROUND256(b,c,d,e,f,g,h,a,POW_KW_MESSAGE(15));
+		POW_ROUNDS256(POW_KW_SCHEDULE, 16);
+		POW_ROUNDS256(POW_KW_SCHEDULE, 24);
+		POW_ROUNDS256(POW_KW_SCHEDULE, 32);
+		POW_ROUNDS256(POW_KW_SCHEDULE, 40);
+		POW_ROUNDS256(POW_KW_SCHEDULE, 48);
+		POW_ROUNDS256(POW_KW_SCHEDULE, 56);
+		mid[0] = a += sha256_initial_hash_value[0];
+		mid[1] = b += sha256_initial_hash_value[1];
+		mid[2] = c += sha256_initial_hash_value[2];
+		mid[3] = d += sha256_initial_hash_value[3];
+		mid[4] = e += sha256_initial_hash_value[4];
+		mid[5] = f += sha256_initial_hash_value[5];
+		mid[6] = g += sha256_initial_hash_value[6];
+		mid[7] = h += sha256_initial_hash_value[7];
+
+		/* Second block: constant padding with a precomputed schedule */
+		POW_ROUNDS256(POW_KW_PADDING, 0);
+		POW_ROUNDS256(POW_KW_PADDING, 8);
+		POW_ROUNDS256(POW_KW_PADDING, 16);
+		POW_ROUNDS256(POW_KW_PADDING, 24);
+		POW_ROUNDS256(POW_KW_PADDING, 32);
+		POW_ROUNDS256(POW_KW_PADDING, 40);
+		POW_ROUNDS256(POW_KW_PADDING, 48);
+		POW_ROUNDS256(POW_KW_PADDING, 56);
+		pow->digest[0] = mid[0] + a;
+		pow->digest[1] = mid[1] + b;
+		pow->digest[2] = mid[2] + c;
+		pow->digest[3] = mid[3] + d;
+		pow->digest[4] = mid[4] + e;
+		pow->digest[5] = mid[5] + f;
+		pow->digest[6] = mid[6] + g;
+		pow->digest[7] = mid[7] + h;
+
+		/* Big endian compare, nearly always decided by the first word */
+		for (i = 0; i < 8 && pow->digest[i] == target[i]; i++);
+		if (i < 8 && pow->digest[i] < target[i]) {
+			return 1;
+		}
+
+		if (++pow->nonce[7] == 0) {
+			for (i = 6; i >= 0 && ++pow->nonce[i] == 0; i--);
+			sha256_pow_prepare(pow);
+		}
+	}
+	return 0;
+}
+
+void sha256_pow_get(const SHA256_POW* pow, sha2_byte nonce[32], sha2_byte digest[SHA256_DIGEST_LENGTH]) {
+	int i = 0;
+	for (i = 0; i < 32; i++) {
+		if (nonce) {
+			nonce[i] = (sha2_byte)(pow->nonce[i / 4] >> (24 - 8 * (i % 4)));
+		}
+		if (digest) {
+			digest[i] = (sha2_byte)(pow->digest[i / 4] >> (24 - 8 * (i % 4)));
+		}
+	}
+}
+
 char* sha256_Data(const sha2_byte* data, size_t len, char digest[SHA256_DIGEST_STRING_LENGTH]) {
 	SHA256_CTX	context = {0};
 
@@ -984,31 +1198,51 @@ void sha512_Init(SHA512_CTX* context) {
 	context->bitcount[0] = context->bitcount[1] =  0;
 }
 
-#ifdef SHA2_UNROLL_TRANSFORM
+#if defined(SHA2_UNROLL_TRANSFORM) || SHA512_UNROLL_TRANSFORM
 
-/* Unrolled SHA-512 round macros: */
-#define ROUND512_0_TO_15(a,b,c,d,e,f,g,h)	\
+/* Unrolled SHA-512 round macros, i is the (constant) round number: */
+
+#define ROUND512_0_TO_15(a,b,c,d,e,f,g,h,i)	\
 	T1 = (h) + Sigma1_512(e) + Ch((e), (f), (g)) + \
-             K512[j] + (W512[j] = *data++); \
+	     K512[i] + (W512[i] = data[i]); \
 	(d) += T1; \
-	(h) = T1 + Sigma0_512(a) + Maj((a), (b), (c)); \
-	j++
+	(h) = T1 + Sigma0_512(a) + Maj((a), (b), (c))
 
-#define ROUND512(a,b,c,d,e,f,g,h)	\
-	s0 = W512[(j+1)&0x0f]; \
+#define ROUND512(a,b,c,d,e,f,g,h,i)	\
+	s0 = W512[((i)+1)&0x0f]; \
 	s0 = sigma0_512(s0); \
-	s1 = W512[(j+14)&0x0f]; \
+	s1 = W512[((i)+14)&0x0f]; \
 	s1 = sigma1_512(s1); \
-	T1 = (h) + Sigma1_512(e) + Ch((e), (f), (g)) + K512[j] + \
-             (W512[j&0x0f] += s1 + W512[(j+9)&0x0f] + s0); \
+	T1 = (h) + Sigma1_512(e) + Ch((e), (f), (g)) + K512[i] + \
+	     (W512[(i)&0x0f] += s1 + W512[((i)+9)&0x0f] + s0); \
 	(d) += T1; \
-	(h) = T1 + Sigma0_512(a) + Maj((a), (b), (c)); \
-	j++
+	(h) = T1 + Sigma0_512(a) + Maj((a), (b), (c))
+
+/* Eight rounds starting at round i, the registers rotate back in place: */
+
+#define ROUNDS512_0_TO_15(i)	\
+	ROUND512_0_TO_15(a,b,c,d,e,f,g,h,(i)); \
+	ROUND512_0_TO_15(h,a,b,c,d,e,f,g,(i)+1); \
+	ROUND512_0_TO_15(g,h,a,b,c,d,e,f,(i)+2); \
+	ROUND512_0_TO_15(f,g,h,a,b,c,d,e,(i)+3); \
+	ROUND512_0_TO_15(e,f,g,h,a,b,c,d,(i)+4); \
+	ROUND512_0_TO_15(d,e,f,g,h,a,b,c,(i)+5); \
+	ROUND512_0_TO_15(c,d,e,f,g,h,a,b,(i)+6); \
+	ROUND512_0_TO_15(b,c,d,e,f,g,h,a,(i)+7)
+
+#define ROUNDS512(i)	\
+	ROUND512(a,b,c,d,e,f,g,h,(i)); \
+	ROUND512(h,a,b,c,d,e,f,g,(i)+1); \
+	ROUND512(g,h,a,b,c,d,e,f,(i)+2); \
+	ROUND512(f,g,h,a,b,c,d,e,(i)+3); \
+	ROUND512(e,f,g,h,a,b,c,d,(i)+4); \
+	ROUND512(d,e,f,g,h,a,b,c,(i)+5); \
+	ROUND512(c,d,e,f,g,h,a,b,(i)+6); \
+	ROUND512(b,c,d,e,f,g,h,a,(i)+7)
 
 void sha512_Transform(const sha2_word64* state_in, const sha2_word64* data, sha2_word64* state_out) {
 	sha2_word64	a = 0, b = 0, c = 0, d = 0, e = 0, f = 0, g = 0, h = 0, s0 = 0, s1 = 0;
 	sha2_word64	T1 = 0, W512[16] = {0};
-	int		j = 0;
 
 	/* Initialize registers with the prev. intermediate value */
 	a = state_in[0];
@@ -1020,29 +1254,19 @@ void sha512_Transform(const sha2_word64* state_in, const sha2_word64* data, sha2
 	g = state_in[6];
 	h = state_in[7];
 
-	j = 0;
-	do {
-		ROUND512_0_TO_15(a,b,c,d,e,f,g,h);
-		ROUND512_0_TO_15(h,a,b,c,d,e,f,g);
-		ROUND512_0_TO_15(g,h,a,b,c,d,e,f);
-		ROUND512_0_TO_15(f,g,h,a,b,c,d,e);
-		ROUND512_0_TO_15(e,f,g,h,a,b,c,d);
-		ROUND512_0_TO_15(d,e,f,g,h,a,b,c);
-		ROUND512_0_TO_15(c,d,e,f,g,h,a,b);
-		ROUND512_0_TO_15(b,c,d,e,f,g,h,a);
-	} while (j < 16);
+	/* Rounds 0 to 15: */
+	ROUNDS512_0_TO_15(0);
+	ROUNDS512_0_TO_15(8);
 
 	/* Now for the remaining rounds up to 79: */
-	do {
-		ROUND512(a,b,c,d,e,f,g,h);
-		ROUND512(h,a,b,c,d,e,f,g);
-		ROUND512(g,h,a,b,c,d,e,f);
-		ROUND512(f,g,h,a,b,c,d,e);
-		ROUND512(e,f,g,h,a,b,c,d);
-		ROUND512(d,e,f,g,h,a,b,c);
-		ROUND512(c,d,e,f,g,h,a,b);
-		ROUND512(b,c,d,e,f,g,h,a);
-	} while (j < 80);
+	ROUNDS512(16);
+	ROUNDS512(24);
+	ROUNDS512(32);
+	ROUNDS512(40);
+	ROUNDS512(48);
+	ROUNDS512(56);
+	ROUNDS512(64);
+	ROUNDS512(72);
 
 	/* Compute the current intermediate hash value */
 	state_out[0] = state_in[0] + a;
@@ -1058,7 +1282,7 @@ void sha512_Transform(const sha2_word64* state_in, const sha2_word64* data, sha2
 	a = b = c = d = e = f = g = h = T1 = 0;
 }
 
-#else /* SHA2_UNROLL_TRANSFORM */
+#else /* SHA2_UNROLL_TRANSFORM || SHA512_UNROLL_TRANSFORM */
 
 void sha512_Transform(const sha2_word64* state_in, const sha2_word64* data, sha2_word64* state_out) {
 	sha2_word64	a = 0, b = 0, c = 0, d = 0, e = 0, f = 0, g = 0, h = 0, s0 = 0, s1 = 0;
@@ -1129,7 +1353,113 @@ void sha512_Transform(const sha2_word64* state_in, const sha2_word64* data, sha2
 	a = b = c = d = e = f = g = h = T1 = T2 = 0;
 }
 
-#endif /* SHA2_UNROLL_TRANSFORM */
+#endif /* SHA2_UNROLL_TRANSFORM || SHA512_UNROLL_TRANSFORM */
+
+/*
+ * Round macro of sha512_Transform_digest(): the round constant and the
+ * message word are taken from K512[j + i] and W512[i]; the working variables
+ * are renamed instead of shifted.
+ */
+#define ROUND512_DIGEST(a,b,c,d,e,f,g,h,i)	\
+	T1 = (h) + Sigma1_512(e) + Ch((e), (f), (g)) + K512[j + (i)] + \
+	     W512[(i)]; \
+	(d) += T1; \
+	(h) = T1 + Sigma0_512(a) + Maj((a), (b), (c))
+
+#define ROUNDS512_DIGEST_16(a,b,c,d,e,f,g,h)	\
+	ROUND512_DIGEST(a,b,c,d,e,f,g,h,0); \
+	ROUND512_DIGEST(h,a,b,c,d,e,f,g,1); \
+	ROUND512_DIGEST(g,h,a,b,c,d,e,f,2); \
+	ROUND512_DIGEST(f,g,h,a,b,c,d,e,3); \
+	ROUND512_DIGEST(e,f,g,h,a,b,c,d,4); \
+	ROUND512_DIGEST(d,e,f,g,h,a,b,c,5); \
+	ROUND512_DIGEST(c,d,e,f,g,h,a,b,6); \
+	ROUND512_DIGEST(b,c,d,e,f,g,h,a,7); \
+	ROUND512_DIGEST(a,b,c,d,e,f,g,h,8); \
+	ROUND512_DIGEST(h,a,b,c,d,e,f,g,9); \
+	ROUND512_DIGEST(g,h,a,b,c,d,e,f,10); \
+	ROUND512_DIGEST(f,g,h,a,b,c,d,e,11); \
+	ROUND512_DIGEST(e,f,g,h,a,b,c,d,12); \
+	ROUND512_DIGEST(d,e,f,g,h,a,b,c,13); \
+	ROUND512_DIGEST(c,d,e,f,g,h,a,b,14); \
+	ROUND512_DIGEST(b,c,d,e,f,g,h,a,15)
+
+/*
+ * Same as sha512_Transform() for the last block of a 192 byte message whose
+ * final 64 bytes are the (native word order) digest passed in "digest"; i.e.
+ * the block is the digest followed by the fixed padding for 1536 bits. This is
+ * the block hashed by each inner and outer HMAC-SHA512 step of PBKDF2. Only
+ * the 8 digest words are read, the message schedule terms of the zero padding
+ * words are skipped and all rounds are unrolled.
+ */
+void sha512_Transform_digest(const sha2_word64* state_in, const sha2_word64* digest, sha2_word64* state_out) {
+	sha2_word64	a = 0, b = 0, c = 0, d = 0, e = 0, f = 0, g = 0, h = 0;
+	sha2_word64	T1 = 0, W512[16] = {0};
+	const sha2_word64 pad = 0x8000000000000000ULL, bits = 1536;
+	int		i = 0, j = 0;
+
+	for (i = 0; i < 8; i++) {
+		W512[i] = digest[i];
+	}
+	W512[8] = pad;
+	W512[15] = bits;
+
+	/* Initialize registers with the prev. intermediate value */
+	a = state_in[0];
+	b = state_in[1];
+	c = state_in[2];
+	d = state_in[3];
+	e = state_in[4];
+	f = state_in[5];
+	g = state_in[6];
+	h = state_in[7];
+
+	ROUNDS512_DIGEST_16(a,b,c,d,e,f,g,h);
+
+	/* Rounds 16 to 31; W512[9] to W512[14] of the block are zero */
+	W512[0] += sigma0_512(W512[1]);
+	W512[1] += sigma0_512(W512[2]) + sigma1_512(bits);
+	W512[2] += sigma0_512(W512[3]) + sigma1_512(W512[0]);
+	W512[3] += sigma0_512(W512[4]) + sigma1_512(W512[1]);
+	W512[4] += sigma0_512(W512[5]) + sigma1_512(W512[2]);
+	W512[5] += sigma0_512(W512[6]) + sigma1_512(W512[3]);
+	W512[6] += sigma0_512(W512[7]) + sigma1_512(W512[4]) + bits;
+	W512[7] += sigma0_512(pad) + sigma1_512(W512[5]) + W512[0];
+	W512[8] = pad + sigma1_512(W512[6]) + W512[1];
+	W512[9] = sigma1_512(W512[7]) + W512[2];
+	W512[10] = sigma1_512(W512[8]) + W512[3];
+	W512[11] = sigma1_512(W512[9]) + W512[4];
+	W512[12] = sigma1_512(W512[10]) + W512[5];
+	W512[13] = sigma1_512(W512[11]) + W512[6];
+	W512[14] = sigma0_512(bits) + sigma1_512(W512[12]) + W512[7];
+	W512[15] = bits + sigma0_512(W512[0]) + sigma1_512(W512[13]) + W512[8];
+	j = 16;
+	ROUNDS512_DIGEST_16(a,b,c,d,e,f,g,h);
+
+	/* Rounds 32 to 79 */
+	for (j = 32; j < 80; j += 16) {
+		for (i = 0; i < 16; i++) {
+			W512[i] += sigma1_512(W512[(i + 14) & 0x0f]) +
+			           W512[(i + 9) & 0x0f] +
+			           sigma0_512(W512[(i + 1) & 0x0f]);
+		}
+		ROUNDS512_DIGEST_16(a,b,c,d,e,f,g,h);
+	}
+
+	/* Compute the current intermediate hash value */
+	state_out[0] = state_in[0] + a;
+	state_out[1] = state_in[1] + b;
+	state_out[2] = state_in[2] + c;
+	state_out[3] = state_in[3] + d;
+	state_out[4] = state_in[4] + e;
+	state_out[5] = state_in[5] + f;
+	state_out[6] = state_in[6] + g;
+	state_out[7] = state_in[7] + h;
+
+	/* Clean up */
+	a = b = c = d = e = f = g = h = T1 = 0;
+	memzero(W512, sizeof(W512));
+}
 
 void sha512_Update(SHA512_CTX* context, const sha2_byte *data, size_t len) {
 	unsigned int	freespace = 0, usedspace = 0;
@@ -54,6 +54,21 @@ typedef struct _SHA256_CTX {
 	uint64_t	bitcount;
 	uint32_t	buffer[SHA256_BLOCK_LENGTH/sizeof(uint32_t)];
 } SHA256_CTX;
+/* Hash state of a SHA-256 computation at a block boundary, which is enough to
+ * resume it: refer sha256_CloneMid & sha256_FromMid */
+typedef struct _SHA256_MID {
+	uint32_t	state[8];
+	uint64_t	bitcount;
+} SHA256_MID;
+/* Searches nonces for sha256(prefix || nonce) below a target, with the
+ * 32-byte prefix fixed: refer sha256_pow_init & sha256_pow_search */
+typedef struct _SHA256_POW {
+	uint32_t	prefix[8];
+	/* registers after the rounds which do not see the last nonce word */
+	uint32_t	state[8];
+	uint32_t	nonce[8];
+	uint32_t	digest[8];
+} SHA256_POW;
 typedef struct _SHA512_CTX {
 	uint64_t	state[8];
 	uint64_t	bitcount[2];
@@ -103,9 +118,22 @@ void sha256_Update(SHA256_CTX*, const uint8_t*, size_t);
 void sha256_Final(SHA256_CTX*, uint8_t[SHA256_DIGEST_LENGTH]);
 char* sha256_End(SHA256_CTX*, char[SHA256_DIGEST_STRING_LENGTH]);
 void sha256_Raw(const uint8_t*, size_t, uint8_t[SHA256_DIGEST_LENGTH]);
+/* Saves the midstate of the context if whole blocks have been digested so
+ * far; returns 1 on success and 0 if bytes are pending in the buffer */
+int sha256_CloneMid(const SHA256_CTX*, SHA256_MID*);
+/* Resumes the context from a midstate saved by sha256_CloneMid */
+void sha256_FromMid(SHA256_CTX*, const SHA256_MID*);
 char* sha256_Data(const uint8_t*, size_t, char[SHA256_DIGEST_STRING_LENGTH]);
+void sha256_pow_init(SHA256_POW*, const uint8_t[32], const uint8_t[32]);
+/* Hashes up to count nonces, incrementing the nonce as a big endian number
+ * after each miss; returns 1 with the nonce and digest left in the context
+ * if sha256(prefix || nonce) < target (big endian words), 0 otherwise */
+int sha256_pow_search(SHA256_POW*, const uint32_t[8], size_t);
+/* Gets the current nonce and the last digest as bytes, either may be NULL */
+void sha256_pow_get(const SHA256_POW*, uint8_t[32], uint8_t[SHA256_DIGEST_LENGTH]);
 
 void sha512_Transform(const uint64_t* state_in, const uint64_t* data, uint64_t* state_out);
+void sha512_Transform_digest(const uint64_t* state_in, const uint64_t* digest, uint64_t* state_out);
 void sha512_Init(SHA512_CTX*);
 void sha512_Update(SHA512_CTX*, const uint8_t*, size_t);
 void sha512_Final(SHA512_CTX*, uint8_t[SHA512_DIGEST_LENGTH]);
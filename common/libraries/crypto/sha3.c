@@ -32,15 +32,17 @@
 /* constants */
 #define NumberOfRounds 24
 
-/* SHA3 (Keccak) constants for 24 rounds */
-static uint64_t keccak_round_constants[NumberOfRounds] = {
-	I64(0x0000000000000001), I64(0x0000000000008082), I64(0x800000000000808A), I64(0x8000000080008000),
-	I64(0x000000000000808B), I64(0x0000000080000001), I64(0x8000000080008081), I64(0x8000000000008009),
-	I64(0x000000000000008A), I64(0x0000000000000088), I64(0x0000000080008009), I64(0x000000008000000A),
-	I64(0x000000008000808B), I64(0x800000000000008B), I64(0x8000000000008089), I64(0x8000000000008003),
-	I64(0x8000000000008002), I64(0x8000000000000080), I64(0x000000000000800A), I64(0x800000008000000A),
-	I64(0x8000000080008081), I64(0x8000000000008080), I64(0x0000000080000001), I64(0x8000000080008008)
-};
+#if SHA3_BIT_INTERLEAVED
+/*
+ * The 32-bit implementation keeps every 64-bit lane as two words, one with
+ * the even bits and one with the odd bits, so that a 64-bit rotation becomes
+ * two 32-bit rotations. Lanes in SHA3_COMPLEMENTED_LANES are stored inverted,
+ * which turns most of the NOTs of chi() into ORs.
+ */
+#define ROL32(dword, n) ((dword) << (n) ^ ((dword) >> (32 - (n))))
+#define SHA3_COMPLEMENTED_LANES \
+	((1UL << 1) | (1UL << 2) | (1UL << 8) | (1UL << 12) | (1UL << 17) | (1UL << 20))
+#endif
 
 /* Initializing a sha3 context for given number of output bits */
 static void keccak_Init(SHA3_CTX *ctx, unsigned bits)
@@ -51,6 +53,13 @@ static void keccak_Init(SHA3_CTX *ctx, unsigned bits)
 	memzero(ctx, sizeof(SHA3_CTX));
 	ctx->block_size = rate / 8;
 	assert(rate <= 1600 && (rate % 64) == 0);
+#if SHA3_BIT_INTERLEAVED
+	for (unsigned i = 0; i < sha3_max_permutation_size; i++) {
+		if ((SHA3_COMPLEMENTED_LANES >> i) & 1) {
+			ctx->hash[2 * i] = ctx->hash[2 * i + 1] = 0xFFFFFFFFUL;
+		}
+	}
+#endif
 }
 
 /**
@@ -93,6 +102,240 @@ void sha3_512_Init(SHA3_CTX *ctx)
 	keccak_Init(ctx, 512);
 }
 
+#if SHA3_BIT_INTERLEAVED
+/* Round constants, as even-bit and odd-bit words */
+static const uint32_t keccak_round_constants[2 * NumberOfRounds] = {
+	0x00000001, 0x00000000, 0x00000000, 0x00000089, 0x00000000, 0x8000008B,
+	0x00000000, 0x80008080, 0x00000001, 0x0000008B, 0x00000001, 0x00008000,
+	0x00000001, 0x80008088, 0x00000001, 0x80000082, 0x00000000, 0x0000000B,
+	0x00000000, 0x0000000A, 0x00000001, 0x00008082, 0x00000000, 0x00008003,
+	0x00000001, 0x0000808B, 0x00000001, 0x8000000B, 0x00000001, 0x8000008A,
+	0x00000001, 0x80000081, 0x00000000, 0x80000081, 0x00000000, 0x80000008,
+	0x00000000, 0x00000083, 0x00000000, 0x80008003, 0x00000001, 0x80008088,
+	0x00000000, 0x80000088, 0x00000001, 0x00008000, 0x00000000, 0x80008082,
+};
+
+/* One round from S into T, on bit-interleaved and lane-complemented state */
+static inline void keccak_round(const uint32_t *S, uint32_t *T, int round)
+{
+	uint32_t B[5], C[10], D[10];
+
+	C[0] = S[0] ^ S[10] ^ S[20] ^ S[30] ^ S[40];
+	C[2] = S[2] ^ S[12] ^ S[22] ^ S[32] ^ S[42];
+	C[4] = S[4] ^ S[14] ^ S[24] ^ S[34] ^ S[44];
+	C[6] = S[6] ^ S[16] ^ S[26] ^ S[36] ^ S[46];
+	C[8] = S[8] ^ S[18] ^ S[28] ^ S[38] ^ S[48];
+	C[1] = S[1] ^ S[11] ^ S[21] ^ S[31] ^ S[41];
+	C[3] = S[3] ^ S[13] ^ S[23] ^ S[33] ^ S[43];
+	C[5] = S[5] ^ S[15] ^ S[25] ^ S[35] ^ S[45];
+	C[7] = S[7] ^ S[17] ^ S[27] ^ S[37] ^ S[47];
+	C[9] = S[9] ^ S[19] ^ S[29] ^ S[39] ^ S[49];
+	D[0] = C[8] ^ ROL32(C[3], 1);
+	D[1] = C[9] ^ C[2];
+	D[2] = C[0] ^ ROL32(C[5], 1);
+	D[3] = C[1] ^ C[4];
+	D[4] = C[2] ^ ROL32(C[7], 1);
+	D[5] = C[3] ^ C[6];
+	D[6] = C[4] ^ ROL32(C[9], 1);
+	D[7] = C[5] ^ C[8];
+	D[8] = C[6] ^ ROL32(C[1], 1);
+	D[9] = C[7] ^ C[0];
+	B[0] = S[0] ^ D[0];
+	B[1] = ROL32(S[12] ^ D[2], 22);
+	B[2] = ROL32(S[25] ^ D[5], 22);
+	B[3] = ROL32(S[37] ^ D[7], 11);
+	B[4] = ROL32(S[48] ^ D[8], 7);
+	T[0] = B[0] ^ (B[1] | B[2]);
+	T[2] = B[1] ^ (~B[2] | B[3]);
+	T[4] = B[2] ^ (B[3] & B[4]);
+	T[6] = B[3] ^ (B[4] | B[0]);
+	T[8] = B[4] ^ (B[0] & B[1]);
+	B[0] = S[1] ^ D[1];
+	B[1] = ROL32(S[13] ^ D[3], 22);
+	B[2] = ROL32(S[24] ^ D[4], 21);
+	B[3] = ROL32(S[36] ^ D[6], 10);
+	B[4] = ROL32(S[49] ^ D[9], 7);
+	T[1] = B[0] ^ (B[1] | B[2]);
+	T[3] = B[1] ^ (~B[2] | B[3]);
+	T[5] = B[2] ^ (B[3] & B[4]);
+	T[7] = B[3] ^ (B[4] | B[0]);
+	T[9] = B[4] ^ (B[0] & B[1]);
+	B[0] = ROL32(S[6] ^ D[6], 14);
+	B[1] = ROL32(S[18] ^ D[8], 10);
+	B[2] = ROL32(S[21] ^ D[1], 2);
+	B[3] = ROL32(S[33] ^ D[3], 23);
+	B[4] = ROL32(S[45] ^ D[5], 31);
+	T[10] = B[0] ^ (B[1] | B[2]);
+	T[12] = B[1] ^ (B[2] & B[3]);
+	T[14] = B[2] ^ (B[3] | ~B[4]);
+	T[16] = B[3] ^ (B[4] | B[0]);
+	T[18] = B[4] ^ (B[0] & B[1]);
+	B[0] = ROL32(S[7] ^ D[7], 14);
+	B[1] = ROL32(S[19] ^ D[9], 10);
+	B[2] = ROL32(S[20] ^ D[0], 1);
+	B[3] = ROL32(S[32] ^ D[2], 22);
+	B[4] = ROL32(S[44] ^ D[4], 30);
+	T[11] = B[0] ^ (B[1] | B[2]);
+	T[13] = B[1] ^ (B[2] & B[3]);
+	T[15] = B[2] ^ (B[3] | ~B[4]);
+	T[17] = B[3] ^ (B[4] | B[0]);
+	T[19] = B[4] ^ (B[0] & B[1]);
+	B[0] = ROL32(S[3] ^ D[3], 1);
+	B[1] = ROL32(S[14] ^ D[4], 3);
+	B[2] = ROL32(S[27] ^ D[7], 13);
+	B[3] = ROL32(S[38] ^ D[8], 4);
+	B[4] = ROL32(S[40] ^ D[0], 9);
+	T[20] = B[0] ^ (B[1] | B[2]);
+	T[22] = B[1] ^ (B[2] & B[3]);
+	T[24] = B[2] ^ (~B[3] & B[4]);
+	T[26] = ~B[3] ^ (B[4] | B[0]);
+	T[28] = B[4] ^ (B[0] & B[1]);
+	B[0] = S[2] ^ D[2];
+	B[1] = ROL32(S[15] ^ D[5], 3);
+	B[2] = ROL32(S[26] ^ D[6], 12);
+	B[3] = ROL32(S[39] ^ D[9], 4);
+	B[4] = ROL32(S[41] ^ D[1], 9);
+	T[21] = B[0] ^ (B[1] | B[2]);
+	T[23] = B[1] ^ (B[2] & B[3]);
+	T[25] = B[2] ^ (~B[3] & B[4]);
+	T[27] = ~B[3] ^ (B[4] | B[0]);
+	T[29] = B[4] ^ (B[0] & B[1]);
+	B[0] = ROL32(S[9] ^ D[9], 14);
+	B[1] = ROL32(S[10] ^ D[0], 18);
+	B[2] = ROL32(S[22] ^ D[2], 5);
+	B[3] = ROL32(S[35] ^ D[5], 8);
+	B[4] = ROL32(S[46] ^ D[6], 28);
+	T[30] = B[0] ^ (B[1] & B[2]);
+	T[32] = B[1] ^ (B[2] | B[3]);
+	T[34] = B[2] ^ (~B[3] | B[4]);
+	T[36] = ~B[3] ^ (B[4] & B[0]);
+	T[38] = B[4] ^ (B[0] | B[1]);
+	B[0] = ROL32(S[8] ^ D[8], 13);
+	B[1] = ROL32(S[11] ^ D[1], 18);
+	B[2] = ROL32(S[23] ^ D[3], 5);
+	B[3] = ROL32(S[34] ^ D[4], 7);
+	B[4] = ROL32(S[47] ^ D[7], 28);
+	T[31] = B[0] ^ (B[1] & B[2]);
+	T[33] = B[1] ^ (B[2] | B[3]);
+	T[35] = B[2] ^ (~B[3] | B[4]);
+	T[37] = ~B[3] ^ (B[4] & B[0]);
+	T[39] = B[4] ^ (B[0] | B[1]);
+	B[0] = ROL32(S[4] ^ D[4], 31);
+	B[1] = ROL32(S[17] ^ D[7], 28);
+	B[2] = ROL32(S[29] ^ D[9], 20);
+	B[3] = ROL32(S[31] ^ D[1], 21);
+	B[4] = ROL32(S[42] ^ D[2], 1);
+	T[40] = B[0] ^ (~B[1] & B[2]);
+	T[42] = ~B[1] ^ (B[2] | B[3]);
+	T[44] = B[2] ^ (B[3] & B[4]);
+	T[46] = B[3] ^ (B[4] | B[0]);
+	T[48] = B[4] ^ (B[0] & B[1]);
+	B[0] = ROL32(S[5] ^ D[5], 31);
+	B[1] = ROL32(S[16] ^ D[6], 27);
+	B[2] = ROL32(S[28] ^ D[8], 19);
+	B[3] = ROL32(S[30] ^ D[0], 20);
+	B[4] = ROL32(S[43] ^ D[3], 1);
+	T[41] = B[0] ^ (~B[1] & B[2]);
+	T[43] = ~B[1] ^ (B[2] | B[3]);
+	T[45] = B[2] ^ (B[3] & B[4]);
+	T[47] = B[3] ^ (B[4] | B[0]);
+	T[49] = B[4] ^ (B[0] & B[1]);
+	T[0] ^= keccak_round_constants[2 * round];
+	T[1] ^= keccak_round_constants[2 * round + 1];
+}
+
+SRAM2_CODE static void sha3_permutation(uint32_t *state)
+{
+	uint32_t E[2 * sha3_max_permutation_size];
+	int round = 0;
+	for (round = 0; round < NumberOfRounds; round += 2) {
+		keccak_round(state, E, round);
+		keccak_round(E, state, round + 1);
+	}
+	memzero(E, sizeof(E));
+}
+
+/* Splits a lane into its even and odd bits and XORs them into the state */
+static inline void sha3_absorb_lane(uint32_t *lane, uint64_t value)
+{
+	uint32_t low = (uint32_t)value, high = (uint32_t)(value >> 32), t = 0;
+
+	t = (low ^ (low >> 1)) & 0x22222222UL;  low ^= t ^ (t << 1);
+	t = (low ^ (low >> 2)) & 0x0C0C0C0CUL;  low ^= t ^ (t << 2);
+	t = (low ^ (low >> 4)) & 0x00F000F0UL;  low ^= t ^ (t << 4);
+	t = (low ^ (low >> 8)) & 0x0000FF00UL;  low ^= t ^ (t << 8);
+	t = (high ^ (high >> 1)) & 0x22222222UL;  high ^= t ^ (t << 1);
+	t = (high ^ (high >> 2)) & 0x0C0C0C0CUL;  high ^= t ^ (t << 2);
+	t = (high ^ (high >> 4)) & 0x00F000F0UL;  high ^= t ^ (t << 4);
+	t = (high ^ (high >> 8)) & 0x0000FF00UL;  high ^= t ^ (t << 8);
+
+	lane[0] ^= (low & 0x0000FFFFUL) | (high << 16);
+	lane[1] ^= (low >> 16) | (high & 0xFFFF0000UL);
+}
+
+/* Inverse of sha3_absorb_lane(), also undoing the lane complementing */
+static inline uint64_t sha3_squeeze_lane(const uint32_t *lane, unsigned index)
+{
+	uint32_t even = lane[0], odd = lane[1], low = 0, high = 0, t = 0;
+
+	if ((SHA3_COMPLEMENTED_LANES >> index) & 1) {
+		even = ~even;
+		odd = ~odd;
+	}
+	low = (even & 0x0000FFFFUL) | (odd << 16);
+	high = (even >> 16) | (odd & 0xFFFF0000UL);
+
+	t = (low ^ (low >> 8)) & 0x0000FF00UL;  low ^= t ^ (t << 8);
+	t = (low ^ (low >> 4)) & 0x00F000F0UL;  low ^= t ^ (t << 4);
+	t = (low ^ (low >> 2)) & 0x0C0C0C0CUL;  low ^= t ^ (t << 2);
+	t = (low ^ (low >> 1)) & 0x22222222UL;  low ^= t ^ (t << 1);
+	t = (high ^ (high >> 8)) & 0x0000FF00UL;  high ^= t ^ (t << 8);
+	t = (high ^ (high >> 4)) & 0x00F000F0UL;  high ^= t ^ (t << 4);
+	t = (high ^ (high >> 2)) & 0x0C0C0C0CUL;  high ^= t ^ (t << 2);
+	t = (high ^ (high >> 1)) & 0x22222222UL;  high ^= t ^ (t << 1);
+
+	return (uint64_t)high << 32 | low;
+}
+
+/**
+ * The core transformation. Process the specified block of data.
+ *
+ * @param hash the algorithm state
+ * @param block the message block to process
+ * @param block_size the size of the processed block in bytes
+ */
+static void sha3_process_block(uint32_t hash[2 * sha3_max_permutation_size], const uint64_t *block, size_t block_size)
+{
+	size_t i = 0;
+	for (i = 0; i < block_size / 8; i++) {
+		sha3_absorb_lane(&hash[2 * i], le2me_64(block[i]));
+	}
+	/* make a permutation of the hash */
+	sha3_permutation(hash);
+}
+
+/* Writes the first length bytes of the state */
+static void sha3_squeeze(const SHA3_CTX *ctx, unsigned char *result, size_t length)
+{
+	uint64_t lanes[sha3_max_permutation_size] = {0};
+	unsigned i = 0;
+	for (i = 0; i * 8 < length; i++) {
+		lanes[i] = sha3_squeeze_lane(&ctx->hash[2 * i], i);
+	}
+	me64_to_le_str(result, lanes, length);
+	memzero(lanes, sizeof(lanes));
+}
+#else
+/* SHA3 (Keccak) constants for 24 rounds */
+static uint64_t keccak_round_constants[NumberOfRounds] = {
+	I64(0x0000000000000001), I64(0x0000000000008082), I64(0x800000000000808A), I64(0x8000000080008000),
+	I64(0x000000000000808B), I64(0x0000000080000001), I64(0x8000000080008081), I64(0x8000000000008009),
+	I64(0x000000000000008A), I64(0x0000000000000088), I64(0x0000000080008009), I64(0x000000008000000A),
+	I64(0x000000008000808B), I64(0x800000000000008B), I64(0x8000000000008089), I64(0x8000000000008003),
+	I64(0x8000000000008002), I64(0x8000000000000080), I64(0x000000000000800A), I64(0x800000008000000A),
+	I64(0x8000000080008081), I64(0x8000000000008080), I64(0x0000000080000001), I64(0x8000000080008008)
+};
+
 /* Keccak theta() transformation */
 static void keccak_theta(uint64_t *A)
 {
@@ -163,7 +406,7 @@ static void keccak_chi(uint64_t *A)
 	}
 }
 
-static void sha3_permutation(uint64_t *state)
+SRAM2_CODE static void sha3_permutation(uint64_t *state)
 {
 	int round = 0;
 	for (round = 0; round < NumberOfRounds; round++)
@@ -257,6 +500,13 @@ static void sha3_process_block(uint64_t hash[25], const uint64_t *block, size_t
 	sha3_permutation(hash);
 }
 
+/* Writes the first length bytes of the state */
+static void sha3_squeeze(const SHA3_CTX *ctx, unsigned char *result, size_t length)
+{
+	me64_to_le_str(result, ctx->hash, length);
+}
+#endif /* SHA3_BIT_INTERLEAVED */
+
 #define SHA3_FINALIZED 0x80000000
 
 /**
@@ -330,7 +580,7 @@ void sha3_Final(SHA3_CTX *ctx, unsigned char* result)
 	}
 
 	assert(block_size > digest_length);
-	if (result) me64_to_le_str(result, ctx->hash, digest_length);
+	if (result) sha3_squeeze(ctx, result, digest_length);
 	memzero(ctx, sizeof(SHA3_CTX));
 }
 
@@ -359,7 +609,7 @@ void keccak_Final(SHA3_CTX *ctx, unsigned char* result)
 	}
 
 	assert(block_size > digest_length);
-	if (result) me64_to_le_str(result, ctx->hash, digest_length);
+	if (result) sha3_squeeze(ctx, result, digest_length);
 	memzero(ctx, sizeof(SHA3_CTX));
 }
 
@@ -50,7 +50,12 @@ extern "C" {
 typedef struct SHA3_CTX
 {
 	/* 1600 bits algorithm hashing state */
+#if SHA3_BIT_INTERLEAVED
+	/* even-bit and odd-bit words of each lane, refer sha3.c */
+	uint32_t hash[2 * sha3_max_permutation_size];
+#else
 	uint64_t hash[sha3_max_permutation_size];
+#endif
 	/* 1536-bit buffer for leftovers */
 	uint64_t message[sha3_max_rate_in_qwords];
 	/* count of bytes in the message[] buffer */
@@ -62,9 +62,16 @@
 #include "pow.h"
 
 #include "application_startup.h"
+#include "bignum.h"
 #include "board.h"
+#include "clock_policy.h"
+#include "flash_api.h"
 #include "lvgl.h"
 #include "pow_utilities.h"
+#include "status_api.h"
+#include "task_scheduler.h"
+#include "ui_common.h"
+#include "utils.h"
 
 /*****************************************************************************
  * EXTERN VARIABLES
@@ -74,7 +81,19 @@ extern Wallet wallet;
 /*****************************************************************************
  * PRIVATE MACROS AND DEFINES
  *****************************************************************************/
-#define SECS_TO_HASHES(sec) ((sec)*pow_hash_rate)
+/// Time given to hashing per scheduler slice
+#define POW_SLICE_MS 20
+/// Hashes computed between two checks of the slice budget
+#define POW_HASHES_PER_TIME_CHECK 64
+/// Background budget per call of proof_of_work_task, between UI refreshes
+#define POW_LOOP_BUDGET_MS 100
+/// Shortest window over which an achieved hash rate is trusted
+#define POW_MIN_RATE_WINDOW_MS 1000
+/// Hashes timed to measure the hash rate
+#define POW_CALIBRATION_HASHES 8192
+/// The cached hash rate is refreshed when the achieved rate differs from it by
+/// more than cached >> POW_RATE_DRIFT_SHIFT (12.5%)
+#define POW_RATE_DRIFT_SHIFT 3
 
 /*****************************************************************************
  * PRIVATE TYPEDEFS
@@ -93,7 +112,9 @@ extern Wallet wallet;
  *
  * 2. Update the approx time left to unlock in flash
  * The approx time to unlock is calculated when the challenge is fetched from
- * card. This timer decreases its value.
+ * card. It is converted back to hashes at the previous rate, reduced by the
+ * hashes actually computed since the last save and converted to time again at
+ * the rate achieved over that window.
  *
  * @param p_context Used by app_timer module
  *
@@ -120,12 +141,39 @@ static void pow_save_data_to_flash();
 static void pow_timer_handler(lv_task_t *task);
 
 /**
- * The function checks if a hash value is smaller than a target value.
+ * @brief Reports the seconds of the unlock estimate elapsed to the host
  *
- * @return a boolean value, which indicates whether the hash stored in the flash
- * wallet is smaller than the target hash.
+ * @param secs_left Seconds left to unlock, as estimated now
  */
-static bool hash_smaller_than_target();
+static void pow_report_progress(uint32_t secs_left);
+
+/**
+ * @brief Scheduler task which hashes nonces until the target is met or the
+ * budget is used up
+ *
+ * @param budget_ms Time in milliseconds available for hashing
+ * @return true If the target is not met yet
+ * @return false If the target is met and the task is stopped
+ */
+static bool pow_hash_slice(uint32_t budget_ms);
+
+/**
+ * @brief Fills the configuration a hash rate is valid for
+ *
+ * @param key Reference to the storage; hashes_per_sec is left untouched
+ */
+static void pow_rate_key(Flash_Pow_Rate *key);
+
+/**
+ * @brief Times the hashing kernel and sets pow_hash_rate
+ */
+static void pow_measure_hash_rate();
+
+/**
+ * @brief Caches pow_hash_rate in flash, unless the cache already holds a
+ * close enough rate for this configuration
+ */
+static void pow_cache_hash_rate();
 
 /*****************************************************************************
  * STATIC VARIABLES
@@ -135,15 +183,20 @@ static bool hash_smaller_than_target();
  */
 static uint8_t nonce[POW_NONCE_SIZE], hash[SHA256_SIZE];
 static bool pow_started;
-static SHA256_CTX sha2;
+static bool pow_solved;
+static SHA256_POW pow_ctx;
+static uint32_t pow_target[SHA256_SIZE / sizeof(uint32_t)];
 static Flash_Wallet *flash_wallet;    // Pointer to wallet which the device is
                                       // currently trying to unlock
 static lv_task_t *pow_update_flash_task = NULL;
+static uint64_t pow_hashes_done;    // Hashes computed since the last save
+static uint32_t pow_window_start;    // uwTick at the last save
+static uint16_t pow_progress_total;    // Unlock estimate at start, in seconds
 
 /*****************************************************************************
  * GLOBAL VARIABLES
  *****************************************************************************/
-size_t pow_hash_rate = 1;
+size_t pow_hash_rate = 0;
 
 /*****************************************************************************
  * STATIC FUNCTIONS
@@ -157,16 +210,32 @@ static void pow_save_data_to_flash() {
   // every call
   static char new_text[MAX_NUM_OF_CHARS_IN_A_SLIDE];
   static uint32_t new_time_to_unlock_in_secs;
+  const uint32_t window_ms = uwTick - pow_window_start;
+  const uint32_t old_time = flash_wallet->challenge.time_to_unlock_in_secs;
+  uint64_t hashes_left = (uint64_t)old_time * pow_hash_rate;
+
+  // Rate achieved in wall-clock time, including UI and other tasks
+  if (window_ms >= POW_MIN_RATE_WINDOW_MS && pow_hashes_done != 0) {
+    pow_hash_rate = (size_t)(pow_hashes_done * 1000 / window_ms);
+    if (pow_hash_rate == 0) {
+      pow_hash_rate = 1;
+    }
+  }
 
-  new_time_to_unlock_in_secs = flash_wallet->challenge.time_to_unlock_in_secs -
-                               (uint32_t)(POW_TIMER_MS / 1000);
-
-  if (new_time_to_unlock_in_secs >
-      flash_wallet->challenge.time_to_unlock_in_secs) {
-    // This means time has become negative
+  if (old_time == UINT32_MAX) {
+    // Estimate was saturated; it can not be brought down by measured work
+    new_time_to_unlock_in_secs = UINT32_MAX;
+  } else if (hashes_left <= pow_hashes_done) {
     new_time_to_unlock_in_secs = 0;
+  } else {
+    hashes_left = (hashes_left - pow_hashes_done) / pow_hash_rate;
+    new_time_to_unlock_in_secs = (uint32_t)CY_MIN(hashes_left, UINT32_MAX - 1);
   }
+  pow_hashes_done = 0;
+  pow_window_start = uwTick;
+  pow_report_progress(new_time_to_unlock_in_secs);
 
+  sha256_pow_get(&pow_ctx, nonce, NULL);
   save_nonce_flash(
       (char *)flash_wallet->wallet_name, nonce, new_time_to_unlock_in_secs);
   convert_secs_to_time(
@@ -179,8 +248,66 @@ static void pow_timer_handler(lv_task_t *task) {
   pow_save_data_to_flash();
 }
 
-static bool hash_smaller_than_target() {
-  return memcmp(flash_wallet->challenge.target, hash, SHA256_SIZE) > 0;
+static void pow_report_progress(uint32_t secs_left) {
+  const uint16_t left = (uint16_t)CY_MIN(secs_left, pow_progress_total);
+  core_status_set_progress(
+      CORE_PROGRESS_POW_UNLOCK, pow_progress_total - left, pow_progress_total);
+}
+
+static bool pow_hash_slice(uint32_t budget_ms) {
+  const uint32_t start = uwTick;
+
+  while ((uwTick - start) < budget_ms) {
+    // If target value found, update result and exit the flow
+    const int found =
+        sha256_pow_search(&pow_ctx, pow_target, POW_HASHES_PER_TIME_CHECK);
+    pow_hashes_done += POW_HASHES_PER_TIME_CHECK;
+    if (found) {
+      sha256_pow_get(&pow_ctx, nonce, hash);
+      pow_solved = true;
+      stop_proof_of_work_task();
+      pow_report_progress(0);
+      return false;
+    }
+  }
+  return true;
+}
+
+static void pow_rate_key(Flash_Pow_Rate *key) {
+  key->firmware_version = get_fwVer();
+  // the hash rate is that of the run level, whatever the current clock
+  key->core_clock_hz = clock_policy_run_hz();
+}
+
+static void pow_measure_hash_rate() {
+  const uint8_t bytes_1[POW_RAND_NUMBER_SIZE] = {0};
+  const uint32_t no_target[SHA256_SIZE / sizeof(uint32_t)] = {0};
+  SHA256_POW bench = {0};
+  size_t start_time = uwTick;
+  // time the same kernel as the unlock; nothing is below a zero target
+  sha256_pow_init(&bench, bytes_1, bytes_1);
+  sha256_pow_search(&bench, no_target, POW_CALIBRATION_HASHES);
+  size_t duration = CY_MAX(uwTick - start_time, 1);
+  pow_hash_rate = (POW_CALIBRATION_HASHES * 1000 / duration);
+}
+
+static void pow_cache_hash_rate() {
+  const Flash_Pow_Rate *cached = get_pow_rate();
+  Flash_Pow_Rate pow_rate = {0};
+
+  pow_rate_key(&pow_rate);
+  pow_rate.hashes_per_sec = pow_hash_rate;
+  if (cached->firmware_version == pow_rate.firmware_version &&
+      cached->core_clock_hz == pow_rate.core_clock_hz) {
+    const uint32_t old_rate = cached->hashes_per_sec;
+    const uint32_t new_rate = pow_rate.hashes_per_sec;
+    const uint32_t drift =
+        old_rate > new_rate ? old_rate - new_rate : new_rate - old_rate;
+    if (drift <= (old_rate >> POW_RATE_DRIFT_SHIFT)) {
+      return;
+    }
+  }
+  set_pow_rate(&pow_rate, FLASH_SAVE_LATER);
 }
 
 /*****************************************************************************
@@ -188,16 +315,25 @@ static bool hash_smaller_than_target() {
  *****************************************************************************/
 
 void pow_init_hash_rate() {
-  uint8_t bytes_1[64] = {0};
-  size_t start_time = uwTick, hashes = 8192;
-  for (size_t i = 0; i < hashes; i++) {
-    sha256_Raw(bytes_1, sizeof(bytes_1), bytes_1);
+  const Flash_Pow_Rate *cached = get_pow_rate();
+  Flash_Pow_Rate key = {0};
+
+  pow_rate_key(&key);
+  pow_hash_rate = 0;
+  if (cached->firmware_version == key.firmware_version &&
+      cached->core_clock_hz == key.core_clock_hz &&
+      0 != cached->hashes_per_sec &&
+      DEFAULT_UINT32_IN_FLASH != cached->hashes_per_sec) {
+    pow_hash_rate = cached->hashes_per_sec;
   }
-  size_t duration = uwTick - start_time;
-  pow_hash_rate = (hashes * 1000 / duration);
+}
 
-  // Adjust for 5% margin of error due to 50ms hard delay in the main event loop
-  pow_hash_rate = (pow_hash_rate * 95 / 100);
+size_t pow_get_hash_rate() {
+  if (0 == pow_hash_rate) {
+    pow_measure_hash_rate();
+    pow_cache_hash_rate();
+  }
+  return pow_hash_rate;
 }
 
 void start_proof_of_work_task(const char *name) {
@@ -206,9 +342,21 @@ void start_proof_of_work_task(const char *name) {
 
   // Set nonce = nonce in flash
   memcpy(nonce, flash_wallet->challenge.nonce, POW_NONCE_SIZE);
+  // the time left is tracked in hashes at this rate
+  pow_get_hash_rate();
   pow_started = true;
-
-  sha256_Init(&sha2);
+  pow_solved = false;
+  pow_hashes_done = 0;
+  pow_window_start = uwTick;
+  pow_progress_total =
+      (uint16_t)CY_MIN(flash_wallet->challenge.time_to_unlock_in_secs, 0xFFFF);
+  pow_report_progress(pow_progress_total);
+
+  sha256_pow_init(&pow_ctx, flash_wallet->challenge.random_number, nonce);
+  for (size_t i = 0; i < sizeof(pow_target) / sizeof(pow_target[0]); i++) {
+    pow_target[i] = read_be(&flash_wallet->challenge.target[4 * i]);
+  }
+  sched_add_task(pow_hash_slice, SCHED_PRIO_LOW, POW_SLICE_MS);
   pow_update_flash_task =
       lv_task_create(pow_timer_handler, POW_TIMER_MS, LV_TASK_PRIO_MID, NULL);
 
@@ -229,43 +377,30 @@ void stop_proof_of_work_task() {
   lv_task_set_prio(pow_update_flash_task, LV_TASK_PRIO_OFF);
   lv_task_del(pow_update_flash_task);
   pow_update_flash_task = NULL;
+  sched_remove_task(pow_hash_slice);
   pow_save_data_to_flash();
+  // keep the rate achieved while unlocking for the next estimates
+  pow_cache_hash_rate();
   pow_started = false;
 }
 
 bool proof_of_work_task() {
-  if (!pow_started) {
+  if (!pow_started && !pow_solved) {
     return false;
   }
 
-  bool result = false;
-
   /**
-   * @brief LV task handler is required to update the display and run the task
+   * @brief UI task handler is required to update the display and run the task
    * which calls pow_timer_handler.
    */
-  lv_task_handler();
-
-  // The counter will run for x secs if limit = SECS_TO_HASHES(x)
-  uint16_t limit = SECS_TO_HASHES(1);
-
-  for (uint16_t counter = 0; counter < limit; counter++) {
-    sha256_Init(&sha2);
-    sha256_Update(
-        &sha2, flash_wallet->challenge.random_number, POW_RAND_NUMBER_SIZE);
-    sha256_Update(&sha2, nonce, POW_NONCE_SIZE);
-    sha256_Final(&sha2, hash);
+  ui_task_handler();
 
-    // If target value found, update result and exit the flow
-    if (hash_smaller_than_target()) {
-      result = true;
-      stop_proof_of_work_task();
-      break;
-    }
-
-    increment_byte_array(nonce, POW_NONCE_SIZE);
-  }
+  // Hashing runs as a background task; also picks a solution found while the
+  // scheduler was driven by get_events
+  sched_run_until_idle(POW_LOOP_BUDGET_MS);
 
+  const bool result = pow_solved;
+  pow_solved = false;
   return result;
 }
 
@@ -74,21 +74,31 @@
  * GLOBAL FUNCTION PROTOTYPES
  *****************************************************************************/
 /**
- * This is in hashes per second adjusted with 5% delay (50ms delay in each event
- * loop) b/w each hash. Recorded hash rate is approx 7775 hashes per second in
- * internal tests.
+ * Hashes per second, 0 until known. Loaded by pow_init_hash_rate() from the
+ * rate cached in flash, measured by pow_get_hash_rate() on first use otherwise,
+ * and replaced while unlocking by the rate achieved in wall-clock time between
+ * two saves of the nonce. Read it through pow_get_hash_rate().
  */
 extern size_t pow_hash_rate;
 
 /**
- * @brief Initializes the application with hash rate capacity of the device.
- * @details This function must be called when the application is started. It is
- * necessary that the hash rate is initialized before the proof of work is
- * started. The best way to do this is to call this function during the
- * application start up.
+ * @brief Loads the hash rate cached in flash
+ * @details Call during the application start up, once the flash is loaded.
+ * The cache is only used if it was measured by the same firmware at the same
+ * core clock; otherwise the rate is measured the first time it is needed, so
+ * that the boot does not pay for the benchmark.
  */
 void pow_init_hash_rate();
 
+/**
+ * @brief Returns the hash rate of the device, measuring it if not known yet
+ * @details The measurement hashes for about a hundred milliseconds and is
+ * cached in flash with a deferred save.
+ *
+ * @return size_t Hashes per second, never 0
+ */
+size_t pow_get_hash_rate();
+
 /**
  * @brief This function is called from controller to start
  * proof of work task when wallet name is clicked and
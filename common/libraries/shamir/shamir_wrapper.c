@@ -56,8 +56,10 @@
  *
  ******************************************************************************
  */
+#include "chacha_drbg.h"
 #include "crypto_random.h"
 #include "logger.h"
+#include "memzero.h"
 #include "string.h"
 #include "utils.h"
 #include "wallet.h"
@@ -121,10 +123,45 @@ static uint8_t galois_diff(const uint8_t a, const uint8_t b) {
 }
 
 static uint8_t galois_mul(const uint8_t a, const uint8_t b) {
-  if (a == 0 || b == 0)
-    return 0;
-  uint8_t ans_log = ((uint16_t)galois_log[a] + (uint16_t)galois_log[b]) % 255;
-  return galois_exp[ans_log];
+  // shift & add over x^8 + x^4 + x^3 + x + 1 using masks instead of branches
+  // or table lookups, so the timing is independent of the (secret) operands
+  uint8_t x = a, y = b, product = 0;
+  for (uint8_t i = 0; i < 8; i++) {
+    product ^= (uint8_t)(-(y & 1)) & x;
+    y >>= 1;
+    x = (uint8_t)(x << 1) ^ ((uint8_t)(-(x >> 7)) & 0x1b);
+  }
+  return product;
+}
+
+/**
+ * Multiplies each of the 4 bytes packed in word by scalar, ie. galois_mul() on
+ * 4 lanes at once. The lanes are independent, so the byte order of the word
+ * does not matter as long as it is stored back the way it was loaded.
+ */
+static uint32_t galois_mul_word(const uint32_t word, const uint8_t scalar) {
+  uint32_t x = word, product = 0;
+  uint8_t y = scalar;
+  for (uint8_t i = 0; i < 8; i++) {
+    product ^= (uint32_t)(-(y & 1)) & x;
+    y >>= 1;
+    x = ((x & 0x7f7f7f7f) << 1) ^ (((x >> 7) & 0x01010101) * 0x1b);
+  }
+  return product;
+}
+
+static uint8_t word_len(const uint8_t bytes_left) {
+  return bytes_left < sizeof(uint32_t) ? bytes_left : sizeof(uint32_t);
+}
+
+static uint32_t load_word(const uint8_t *bytes, const uint8_t len) {
+  uint32_t word = 0;
+  memcpy(&word, bytes, len);
+  return word;
+}
+
+static void store_word(uint8_t *bytes, const uint32_t word, const uint8_t len) {
+  memcpy(bytes, &word, len);
 }
 
 static uint8_t galois_div(const uint8_t a, const uint8_t b) {
@@ -139,6 +176,43 @@ static uint8_t galois_pow(const uint8_t a, const uint16_t p) {
   return galois_exp[ans_log];
 }
 
+/**
+ * Lagrange basis at x = 0 for every pair of the 5 share x-coordinates.
+ * lagrange_weight[a - 1][b - 1] = b / (a + b) is the weight of the share at
+ * x = a when it is interpolated with the share at x = b. As the field has
+ * characteristic 2, the weights of a pair sum to 1.
+ */
+static const uint8_t
+    lagrange_weight[TOTAL_NUMBER_OF_SHARES][TOTAL_NUMBER_OF_SHARES] = {
+        {0, 247, 140, 83, 202},
+        {246, 0, 3, 247, 184},
+        {141, 2, 0, 105, 140},
+        {82, 246, 104, 0, 5},
+        {203, 185, 141, 4, 0},
+};
+
+static bool is_lagrange_pair(const uint8_t x_a, const uint8_t x_b) {
+  return (1 <= x_a && x_a <= TOTAL_NUMBER_OF_SHARES) &&
+         (1 <= x_b && x_b <= TOTAL_NUMBER_OF_SHARES) && (x_a != x_b);
+}
+
+static void interpolate_pair(const uint8_t number_of_bytes,
+                             const uint8_t share_a[number_of_bytes],
+                             const uint8_t x_a,
+                             const uint8_t share_b[number_of_bytes],
+                             const uint8_t x_b,
+                             uint8_t secret_OUT[number_of_bytes]) {
+  const uint8_t weight_a = lagrange_weight[x_a - 1][x_b - 1];
+  const uint8_t weight_b = lagrange_weight[x_b - 1][x_a - 1];
+  for (uint8_t j = 0; j < number_of_bytes; j += sizeof(uint32_t)) {
+    const uint8_t len = word_len(number_of_bytes - j);
+    store_word(secret_OUT + j,
+               galois_mul_word(load_word(share_a + j, len), weight_a) ^
+                   galois_mul_word(load_word(share_b + j, len), weight_b),
+               len);
+  }
+}
+
 /***********************************************/
 
 int GetOneRandomByte() {
@@ -147,12 +221,18 @@ int GetOneRandomByte() {
   return random_byte;
 }
 
-static void FillRandomVectorInARange(const uint16_t arr_size,
+static void FillRandomVectorInARange(CHACHA_DRBG_CTX *drbg,
+                                     const uint16_t arr_size,
                                      uint8_t arr[arr_size],
                                      uint8_t l,
                                      uint8_t h) {
+  for (uint16_t offset = 0; offset < arr_size; offset += UINT8_MAX) {
+    const uint16_t left = arr_size - offset;
+    chacha_drbg_generate(
+        drbg, arr + offset, left < UINT8_MAX ? left : UINT8_MAX);
+  }
   for (uint16_t i = 0; i < arr_size; i++) {
-    arr[i] = (GetOneRandomByte() % (h - l + 1)) + l;
+    arr[i] = (arr[i] % (h - l + 1)) + l;
   }
 }
 
@@ -173,17 +253,39 @@ void convert_to_shares(const uint8_t secret_len,
                        const uint8_t total_number_of_shares,
                        const uint8_t threshold_number_of_shares,
                        uint8_t shares_OUT[total_number_of_shares][secret_len]) {
-  for (uint8_t j = 0; j < secret_len; j++) {
-    uint8_t coeffs[threshold_number_of_shares - 1];
-    FillRandomVectorInARange(threshold_number_of_shares - 1, coeffs, 1, 255);
+  // The DRBG is seeded once from the MCU and ATECC entropy, so that the
+  // coefficients of every byte are drawn in bulk rather than going down to
+  // the ATECC for each byte of the secret
+  const uint8_t degree = threshold_number_of_shares - 1;
+  uint8_t seed[CHACHA_DRBG_SEED_LENGTH];
+  uint8_t coeffs[degree][secret_len];
+  uint32_t coeff_words[degree];
+  CHACHA_DRBG_CTX drbg;
+  random_generate(seed, sizeof(seed));
+  chacha_drbg_init(&drbg, seed);
+  memzero(seed, sizeof(seed));
+  FillRandomVectorInARange(&drbg, sizeof(coeffs), (uint8_t *)coeffs, 1, 255);
+  memzero(&drbg, sizeof(drbg));
+
+  // 4 bytes of the secret at a time: the coefficients are loaded once and
+  // every share is evaluated from them, with Horner's rule
+  // coeff[0]*x^n + ... + coeff[n-1]*x = (((coeff[0])*x + coeff[1])*x ...)*x
+  for (uint8_t j = 0; j < secret_len; j += sizeof(uint32_t)) {
+    const uint8_t len = word_len(secret_len - j);
+    const uint32_t secret_word = load_word(secret + j, len);
+    for (uint8_t k = 0; k < degree; k++) {
+      coeff_words[k] = load_word(coeffs[k] + j, len);
+    }
     for (uint8_t i = 0; i < total_number_of_shares; i++) {
-      shares_OUT[i][j] = galois_add(
-          secret[j],
-          eval(threshold_number_of_shares - 1,
-               coeffs,
-               i + 1));    // galois_add(galois_mul(m, i+1), secret[j]);
+      uint32_t acc = 0;
+      for (uint8_t k = 0; k < degree; k++) {
+        acc = galois_mul_word(acc ^ coeff_words[k], i + 1);
+      }
+      store_word(shares_OUT[i] + j, secret_word ^ acc, len);
     }
   }
+  memzero(coeffs, sizeof(coeffs));
+  memzero(coeff_words, sizeof(coeff_words));
 }
 
 void recover_share_from_shares(
@@ -212,10 +314,41 @@ void recover_secret_from_shares(
     const uint8_t shares[num_shares][number_of_bytes],
     const uint8_t x_coords[num_shares],
     uint8_t secret_OUT[number_of_bytes]) {
+  if (MINIMUM_NO_OF_SHARES == num_shares &&
+      is_lagrange_pair(x_coords[0], x_coords[1])) {
+    interpolate_pair(number_of_bytes,
+                     shares[0],
+                     x_coords[0],
+                     shares[1],
+                     x_coords[1],
+                     secret_OUT);
+    return;
+  }
+
   recover_share_from_shares(
       number_of_bytes, num_shares, shares, x_coords, secret_OUT, 0);
 }
 
+bool recover_secret_from_device_share(
+    const uint8_t number_of_bytes,
+    const uint8_t card_share[number_of_bytes],
+    const uint8_t card_x_coord,
+    const uint8_t device_share[number_of_bytes],
+    uint8_t secret_OUT[number_of_bytes]) {
+  const uint8_t device_x_coord = TOTAL_NUMBER_OF_SHARES;
+  if (!is_lagrange_pair(card_x_coord, device_x_coord)) {
+    return false;
+  }
+
+  interpolate_pair(number_of_bytes,
+                   card_share,
+                   card_x_coord,
+                   device_share,
+                   device_x_coord,
+                   secret_OUT);
+  return true;
+}
+
 int verify_shares_NC2(
     const uint8_t number_of_shares,
     const uint8_t secret_size,
@@ -238,17 +371,28 @@ int verify_shares_NC2(
   }
 
   for (int i = 0; i < combinations; i++) {
-    memcpy(two_shares[0], recovered_shamir_data_ver[pairs[i][0]], secret_size);
-    memcpy(two_shares[1], recovered_shamir_data_ver[pairs[i][1]], secret_size);
-
     two_x_coords[0] = x_coords[pairs[i][0]];
     two_x_coords[1] = x_coords[pairs[i][1]];
 
-    recover_secret_from_shares(secret_size,
-                               MINIMUM_NO_OF_SHARES,
-                               two_shares,
-                               two_x_coords,
-                               secret_calculated);
+    if (is_lagrange_pair(two_x_coords[0], two_x_coords[1])) {
+      // interpolate in place rather than copying the pair out
+      interpolate_pair(secret_size,
+                       recovered_shamir_data_ver[pairs[i][0]],
+                       two_x_coords[0],
+                       recovered_shamir_data_ver[pairs[i][1]],
+                       two_x_coords[1],
+                       secret_calculated);
+    } else {
+      memcpy(
+          two_shares[0], recovered_shamir_data_ver[pairs[i][0]], secret_size);
+      memcpy(
+          two_shares[1], recovered_shamir_data_ver[pairs[i][1]], secret_size);
+      recover_secret_from_shares(secret_size,
+                                 MINIMUM_NO_OF_SHARES,
+                                 two_shares,
+                                 two_x_coords,
+                                 secret_calculated);
+    }
     // TODO: Restructure if statements to return 0 by default
     if (i == 0) {
       memcpy(secret, secret_calculated, BLOCK_SIZE);
@@ -12,7 +12,12 @@
 #ifndef SHAMIR_WRAPPER_H
 #define SHAMIR_WRAPPER_H
 
+#include <stdbool.h>
 #include <stdint.h>
+
+/// x-coordinate of the share stored in the device flash
+#define DEVICE_SHARE_X_COORD 5
+
 /**
  * @brief
  * @details size of shares_OUT must be
@@ -82,6 +87,28 @@ void recover_share_from_shares(
     uint8_t share_OUT[number_of_bytes],
     uint8_t out_x_cor);
 
+/**
+ * @brief Recovers the secret from a card share and the device-resident share
+ * @details The device always holds the share at x = DEVICE_SHARE_X_COORD, so
+ * the Lagrange coefficients of every (card, device) pair are precomputed. This
+ * saves the per byte divisions of @ref recover_secret_from_shares.
+ *
+ * @param number_of_bytes Size of each share and of secret_OUT
+ * @param card_share Share read from the card
+ * @param card_x_coord x-coordinate of the card share, from 1 to 4
+ * @param device_share Share stored in the device flash
+ * @param secret_OUT Buffer to hold the recovered secret
+ *
+ * @return bool Indicating if the secret was recovered
+ * @retval false If card_x_coord is not a valid card x-coordinate
+ */
+bool recover_secret_from_device_share(
+    uint8_t number_of_bytes,
+    const uint8_t card_share[number_of_bytes],
+    uint8_t card_x_coord,
+    const uint8_t device_share[number_of_bytes],
+    uint8_t secret_OUT[number_of_bytes]);
+
 /**
  * @brief
  * @details
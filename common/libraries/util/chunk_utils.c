@@ -1,7 +1,7 @@
 /**
- * @file    polygon_app.c
+ * @file    chunk_utils.c
  * @author  Cypherock X1 Team
- * @brief   Polygon application configuration and helpers
+ * @brief   Integer helpers for splitting a message into transport chunks
  * @copyright Copyright (c) 2023 HODL TECH PTE LTD
  * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
  *target=_blank>https://mitcc.org/</a>
@@ -59,27 +59,16 @@
 /*****************************************************************************
  * INCLUDES
  *****************************************************************************/
-
-#include "polygon_app.h"
+#include "chunk_utils.h"
 
 #include <stddef.h>
 
-#include "evm_main.h"
+#include "assert_conf.h"
 
 /*****************************************************************************
  * EXTERN VARIABLES
  *****************************************************************************/
 
-/**
- * @brief Whitelisted contracts with respective token symbol
- * @details A map of Ethereum contract addresses with their token symbols. These
- * will enable the device to verify the ERC20 token transaction in a
- * user-friendly manner.
- *
- * @see erc20_contracts_t
- */
-extern const erc20_contracts_t polygon_contracts[];
-
 /*****************************************************************************
  * PRIVATE MACROS AND DEFINES
  *****************************************************************************/
@@ -92,44 +81,10 @@ extern const erc20_contracts_t polygon_contracts[];
  * STATIC FUNCTION PROTOTYPES
  *****************************************************************************/
 
-/**
- * @brief Checks if the provided token address is whitelisted and return the
- * matching contract instance.
- *
- * @param address Reference to the buffer containing the token address
- * @param contract Pointer to store the matched contract address instance
- *
- * @return bool Indicating if the provided token address is whitelisted
- * @return true If the address matches to an entry in the whitelist
- * @return false If the address does not match to an entry in the whitelist
- */
-static bool is_token_whitelisted(const uint8_t *address,
-                                 const erc20_contracts_t **contract);
-
 /*****************************************************************************
  * STATIC VARIABLES
  *****************************************************************************/
 
-static const evm_config_t polygon_app_config = {
-    .lunit_name = "MATIC",
-    .name = "Polygon",
-    .chain_id = 137,
-
-    // whitelisted contracts
-    .is_token_whitelisted = is_token_whitelisted,
-};
-
-static const cy_app_desc_t polygon_app_desc = {
-    .id = 9,
-    .version =
-        {
-            .major = 1,
-            .minor = 0,
-            .patch = 0,
-        },
-    .app = evm_main,
-    .app_config = &polygon_app_config};
-
 /*****************************************************************************
  * GLOBAL VARIABLES
  *****************************************************************************/
@@ -138,18 +93,33 @@ static const cy_app_desc_t polygon_app_desc = {
  * STATIC FUNCTIONS
  *****************************************************************************/
 
-static bool is_token_whitelisted(const uint8_t *address,
-                                 const erc20_contracts_t **contract) {
-  if (NULL != contract) {
-    *contract = NULL;
-  }
-  return false;
-}
-
 /*****************************************************************************
  * GLOBAL FUNCTIONS
  *****************************************************************************/
 
-const cy_app_desc_t *get_polygon_app_desc() {
-  return &polygon_app_desc;
-}
\ No newline at end of file
+void chunk_info_init(chunk_info_t *info,
+                     uint16_t total_length,
+                     uint16_t chunk_size) {
+  ASSERT(NULL != info && 0 != chunk_size);
+
+  info->total_length = total_length;
+  info->chunk_size = chunk_size;
+  info->total_chunks =
+      0 == total_length ? 1 : CY_CEIL_DIV((uint32_t)total_length, chunk_size);
+}
+
+uint16_t chunk_info_offset(const chunk_info_t *info, uint16_t chunk_no) {
+  if (0 == chunk_no) {
+    return 0;
+  }
+  return (uint16_t)((chunk_no - 1) * (uint32_t)info->chunk_size);
+}
+
+uint16_t chunk_info_length(const chunk_info_t *info, uint16_t chunk_no) {
+  if (0 == chunk_no || chunk_no > info->total_chunks) {
+    return 0;
+  }
+  uint16_t offset = chunk_info_offset(info, chunk_no);
+  uint16_t remaining = info->total_length - offset;
+  return remaining < info->chunk_size ? remaining : info->chunk_size;
+}
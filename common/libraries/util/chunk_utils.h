@@ -0,0 +1,78 @@
+/**
+ * @file    chunk_utils.h
+ * @author  Cypherock X1 Team
+ * @brief   Integer helpers for splitting a message into transport chunks
+ * @copyright Copyright (c) 2023 HODL TECH PTE LTD
+ * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
+ * target=_blank>https://mitcc.org/</a>
+ */
+#ifndef CHUNK_UTILS_H
+#define CHUNK_UTILS_H
+
+/*****************************************************************************
+ * INCLUDES
+ *****************************************************************************/
+#include <stdint.h>
+
+/*****************************************************************************
+ * MACROS AND DEFINES
+ *****************************************************************************/
+
+/// Integer ceiling of a / b for non-negative values
+#define CY_CEIL_DIV(a, b) (((a) + (b)-1) / (b))
+
+/*****************************************************************************
+ * TYPEDEFS
+ *****************************************************************************/
+
+/**
+ * @brief Framing details of a message split into fixed size chunks
+ * @details Computed once per message so that per-chunk packet preparation only
+ * needs integer multiplication and comparison.
+ */
+typedef struct chunk_info {
+  uint16_t total_length;    ///< Length of the complete message
+  uint16_t chunk_size;      ///< Maximum length of one chunk
+  uint16_t total_chunks;    ///< Number of chunks; at least 1
+} chunk_info_t;
+
+/*****************************************************************************
+ * EXPORTED VARIABLES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * GLOBAL FUNCTION PROTOTYPES
+ *****************************************************************************/
+
+/**
+ * @brief Computes framing details for a message
+ *
+ * @param info Reference to the instance to populate
+ * @param total_length Length of the complete message
+ * @param chunk_size Maximum length of one chunk; must be non-zero
+ */
+void chunk_info_init(chunk_info_t *info,
+                     uint16_t total_length,
+                     uint16_t chunk_size);
+
+/**
+ * @brief Returns offset of the chunk within the message
+ *
+ * @param info Reference to the framing details
+ * @param chunk_no 1-based index of the chunk
+ *
+ * @return uint16_t Offset of the first byte of the chunk
+ */
+uint16_t chunk_info_offset(const chunk_info_t *info, uint16_t chunk_no);
+
+/**
+ * @brief Returns length of the chunk
+ *
+ * @param info Reference to the framing details
+ * @param chunk_no 1-based index of the chunk
+ *
+ * @return uint16_t Length of the chunk, 0 if chunk_no is out of range
+ */
+uint16_t chunk_info_length(const chunk_info_t *info, uint16_t chunk_no);
+
+#endif /* CHUNK_UTILS_H */
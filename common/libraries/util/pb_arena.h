@@ -0,0 +1,61 @@
+/**
+ * @file    pb_arena.h
+ * @author  Cypherock X1 Team
+ * @brief   System header of nanopb, routing its allocations to the arena
+ * @copyright Copyright (c) 2023 HODL TECH PTE LTD
+ * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
+ * target=_blank>https://mitcc.org/</a>
+ */
+#ifndef PB_ARENA_H
+#define PB_ARENA_H
+
+/*****************************************************************************
+ * INCLUDES
+ *****************************************************************************/
+
+// Headers nanopb expects in place of its defaults, see PB_SYSTEM_HEADER
+#include <limits.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*****************************************************************************
+ * MACROS AND DEFINES
+ *****************************************************************************/
+
+/// FT_POINTER fields are decoded into the arena of cy_malloc()
+#define pb_realloc(ptr, size) cy_pb_realloc(ptr, size)
+/// The arena is released as a whole, hence pb_release() only forgets pointers
+#define pb_free(ptr) ((void)(ptr))
+
+/*****************************************************************************
+ * TYPEDEFS
+ *****************************************************************************/
+
+/*****************************************************************************
+ * EXPORTED VARIABLES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * GLOBAL FUNCTION PROTOTYPES
+ *****************************************************************************/
+
+/**
+ * @brief Allocates or grows a field decoded by nanopb in the arena
+ * @details Each block keeps its size in front of it. A block at the top of
+ * the arena grows in place, which is the common case of a repeated field
+ * decoded one item at a time; any other block is copied to a new one and
+ * the old copy is zeroized. Nothing is freed before the arena is reset with
+ * cy_free() or cy_arena_reset(), which the host interface does once the app
+ * returns.
+ *
+ * @param ptr Block to grow, NULL to allocate one
+ * @param size Size needed in bytes
+ *
+ * @return void* Block of size bytes, the bytes past the old size are zero
+ */
+void *cy_pb_realloc(void *ptr, size_t size);
+
+#endif /* PB_ARENA_H */
@@ -0,0 +1,66 @@
+/**
+ * @file    txn_pool.h
+ * @author  Cypherock X1 Team
+ * @brief   Statically reserved memory for the context of a signing flow
+ * @copyright Copyright (c) 2023 HODL TECH PTE LTD
+ * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
+ * target=_blank>https://mitcc.org/</a>
+ */
+#ifndef TXN_POOL_H
+#define TXN_POOL_H
+
+/*****************************************************************************
+ * INCLUDES
+ *****************************************************************************/
+#include <stddef.h>
+#include <stdint.h>
+
+#include "capacity_config.h"
+
+/*****************************************************************************
+ * MACROS AND DEFINES
+ *****************************************************************************/
+/// Bytes reserved for the context of the signing flow in progress; the
+/// capacity profile sizes it for the largest BTC transaction it accepts
+#ifndef TXN_POOL_SIZE
+#define TXN_POOL_SIZE CAPACITY_TXN_POOL_SIZE
+#endif
+
+/// Allocates count zeroed objects of the type from the pool, NULL if full
+#define TXN_POOL_NEW(type, count)                                              \
+  ((type *)txn_pool_alloc(sizeof(type), (count)))
+
+/*****************************************************************************
+ * TYPEDEFS
+ *****************************************************************************/
+
+/*****************************************************************************
+ * EXPORTED VARIABLES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * GLOBAL FUNCTION PROTOTYPES
+ *****************************************************************************/
+
+/**
+ * @brief Allocates an array from the pool shared by the signing flows
+ * @details Only one signing flow runs at a time; it allocates its context and
+ * the buffers sized from the metadata here, and releases all of them at once
+ * with txn_pool_release() when the flow ends. The memory is reserved at build
+ * time, so a flow either fits or is rejected up front. Prefer TXN_POOL_NEW.
+ *
+ * @param size Size of an element
+ * @param count Number of elements
+ *
+ * @return void* Zeroed memory aligned to 8 bytes, NULL if the pool cannot fit
+ * the array
+ */
+void *txn_pool_alloc(size_t size, size_t count);
+
+/**
+ * @brief Zeroizes everything allocated from the pool and makes it available
+ * for the next signing flow
+ */
+void txn_pool_release(void);
+
+#endif /* TXN_POOL_H */
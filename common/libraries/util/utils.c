@@ -63,6 +63,7 @@
 #include <string.h>
 
 #include "assert_conf.h"
+#include "atca_async.h"
 #include "bip32.h"
 #include "bip39.h"
 #include "crypto_random.h"
@@ -72,61 +73,111 @@
 #include "logger.h"
 #include "lv_font.h"
 #include "lv_txt.h"
+#include "pb_arena.h"
 #include "sha2.h"
 #include "wallet.h"
 
+/// Alignment of the blocks handed out by cy_malloc
+#define CY_ARENA_ALIGN 8
+#define CY_ARENA_ALIGNED(x) (((x) + CY_ARENA_ALIGN - 1) & ~(CY_ARENA_ALIGN - 1))
+
 /**
- * @brief struct for
- * @details
+ * @brief Header of a heap block, used by cy_malloc once the arena is full
+ * @details The header and the memory handed out are a single allocation.
  *
- * @see
+ * @see cy_malloc(), cy_arena_reset()
  * @since v1.0.0
- *
- * @note
  */
-typedef struct {
-  void *mem;
+typedef struct cy_heap_block {
+  struct cy_heap_block *next;
   size_t mem_size;
-} memory_list_t;
+} cy_heap_block_t;
 
-/**
- * @brief struct for
- * @details
- *
- * @see
- * @since v1.0.0
- *
- * @note
- */
-typedef struct cy_linked_list {
-  struct cy_linked_list *next;
-  memory_list_t mem_entry;
-} cy_linked_list_t;
+#define CY_HEAP_BLOCK_HEADER_SIZE CY_ARENA_ALIGNED(sizeof(cy_heap_block_t))
+/// Size kept in front of the blocks of cy_pb_realloc
+#define CY_PB_BLOCK_HEADER_SIZE CY_ARENA_ALIGNED(sizeof(size_t))
 
-static cy_linked_list_t *memory_list = NULL;
+/// Region cy_malloc bumps through; every byte above cy_arena_top is zero
+static uint64_t cy_arena[CY_ARENA_SIZE / sizeof(uint64_t)];
+static size_t cy_arena_top = 0;
+/// Heap blocks allocated after the arena ran out, latest first
+static cy_heap_block_t *cy_heap_blocks = NULL;
+static size_t cy_heap_block_count = 0;
 
 void *cy_malloc(size_t mem_size) {
-  cy_linked_list_t *new_entry =
-      (cy_linked_list_t *)malloc(sizeof(cy_linked_list_t));
-  new_entry->mem_entry.mem = malloc(mem_size);
-  ASSERT(new_entry != NULL && new_entry->mem_entry.mem != NULL);
-
-  new_entry->next = memory_list;
-  new_entry->mem_entry.mem_size = mem_size;
-  memory_list = new_entry;
-  memzero(new_entry->mem_entry.mem, mem_size);
-  return new_entry->mem_entry.mem;
+  if (mem_size <= CY_ARENA_SIZE - cy_arena_top) {
+    // Already zero; the arena is zeroized on reset
+    void *mem = (uint8_t *)cy_arena + cy_arena_top;
+    cy_arena_top += CY_ARENA_ALIGNED(mem_size);
+    return mem;
+  }
+
+  cy_heap_block_t *block =
+      (cy_heap_block_t *)malloc(CY_HEAP_BLOCK_HEADER_SIZE + mem_size);
+  ASSERT(block != NULL);
+
+  block->next = cy_heap_blocks;
+  block->mem_size = mem_size;
+  cy_heap_blocks = block;
+  cy_heap_block_count++;
+  memzero((uint8_t *)block + CY_HEAP_BLOCK_HEADER_SIZE, mem_size);
+  return (uint8_t *)block + CY_HEAP_BLOCK_HEADER_SIZE;
+}
+
+cy_arena_mark_t cy_arena_mark() {
+  cy_arena_mark_t mark = {.top = cy_arena_top,
+                          .heap_blocks = cy_heap_block_count};
+  return mark;
+}
+
+void cy_arena_reset(cy_arena_mark_t mark) {
+  ASSERT(mark.top <= cy_arena_top && mark.heap_blocks <= cy_heap_block_count);
+
+  memzero((uint8_t *)cy_arena + mark.top, cy_arena_top - mark.top);
+  cy_arena_top = mark.top;
+
+  while (cy_heap_block_count > mark.heap_blocks) {
+    cy_heap_block_t *block = cy_heap_blocks;
+    cy_heap_blocks = block->next;
+    cy_heap_block_count--;
+    memzero(block, CY_HEAP_BLOCK_HEADER_SIZE + block->mem_size);
+    free(block);
+  }
 }
 
 void cy_free() {
-  cy_linked_list_t *temp = memory_list;
-  while ((temp = memory_list) != NULL) {
-    memzero(temp->mem_entry.mem, temp->mem_entry.mem_size);
-    free(temp->mem_entry.mem);
-    memory_list = memory_list->next;
-    memzero(temp, sizeof(cy_linked_list_t));
-    free(temp);
+  const cy_arena_mark_t start = {.top = 0, .heap_blocks = 0};
+  cy_arena_reset(start);
+}
+
+void *cy_pb_realloc(void *ptr, size_t size) {
+  if (NULL == ptr) {
+    uint8_t *block = cy_malloc(CY_PB_BLOCK_HEADER_SIZE + size);
+    *(size_t *)block = size;
+    return block + CY_PB_BLOCK_HEADER_SIZE;
   }
+
+  uint8_t *block = (uint8_t *)ptr - CY_PB_BLOCK_HEADER_SIZE;
+  const size_t old_size = *(size_t *)block;
+  if (size <= old_size) {
+    return ptr;
+  }
+
+  const size_t old_end = CY_ARENA_ALIGNED(CY_PB_BLOCK_HEADER_SIZE + old_size);
+  const size_t new_end = CY_ARENA_ALIGNED(CY_PB_BLOCK_HEADER_SIZE + size);
+  uint8_t *arena = (uint8_t *)cy_arena;
+  if (block >= arena && block + old_end == arena + cy_arena_top &&
+      new_end - old_end <= CY_ARENA_SIZE - cy_arena_top) {
+    // Last block of the arena; the bytes above the top are already zero
+    cy_arena_top += new_end - old_end;
+    *(size_t *)block = size;
+    return ptr;
+  }
+
+  uint8_t *moved = cy_pb_realloc(NULL, size);
+  memcpy(moved, ptr, old_size);
+  memzero(ptr, old_size);
+  return moved;
 }
 
 int is_zero(const uint8_t *bytes, const uint8_t len) {
@@ -306,30 +357,53 @@ void get_firmaware_version(uint16_t pid,
   }
 }
 
+/**
+ * @brief Records the status of a queued ATECC command
+ */
+static void random_atecc_done(ATCA_STATUS status,
+                              ATCAPacket *packet,
+                              void *ctx) {
+  *(ATCA_STATUS *)ctx = status;
+}
+
 // TODO: Update len return size to 16 bit
 void random_generate(uint8_t *arr, int len) {
-  ASSERT(len <= 32);
+  ASSERT(0 <= len && len <= UINT16_MAX);
 
   ASSERT(crypto_random_generate(arr, len) == true);
 
-  // using atecc
-  uint8_t temp[32] = {0};
-  atecc_data.retries = DEFAULT_ATECC_RETRIES;
-
-  bool usb_irq_enable_on_entry = NVIC_GetEnableIRQ(OTG_FS_IRQn);
-  NVIC_DisableIRQ(OTG_FS_IRQn);
-  do {
-    atecc_data.status = atcab_init(atecc_data.cfg_atecc608a_iface);
-    atecc_data.status = atcab_random(temp);
-  } while (atecc_data.status != ATCA_SUCCESS && --atecc_data.retries);
-  if (usb_irq_enable_on_entry == true)
-    NVIC_EnableIRQ(OTG_FS_IRQn);
-
-  ASSERT((atecc_data.status == ATCA_SUCCESS) && (!is_zero(temp, sizeof(temp))));
-
-  for (int i = 0; i < len; ++i) {
-    arr[i] ^= temp[i];
+  // using atecc, which returns 32 bytes per call
+  ATCAPacket packet = {0};
+  for (int offset = 0; offset < len; offset += RANDOM_NUM_SIZE) {
+    atecc_data.retries = DEFAULT_ATECC_RETRIES;
+
+    // the command runs through the async queue, hence USB is serviced while
+    // the chip generates the number
+    do {
+      if ((atecc_data.status = atecc_session_begin()) != ATCA_SUCCESS)
+        continue;
+      memzero(&packet, sizeof(packet));
+      packet.param1 = RANDOM_SEED_UPDATE;
+      packet.param2 = 0x0000;
+      if ((atecc_data.status = atRandom(atcab_get_device()->mCommands,
+                                        &packet)) != ATCA_SUCCESS)
+        continue;
+      atecc_data.status = atca_async_execute(
+          atcab_get_device(), &packet, 0, random_atecc_done, &atecc_data.status);
+      atca_async_flush();
+      if (atecc_data.status == ATCA_SUCCESS &&
+          packet.data[ATCA_COUNT_IDX] != RANDOM_RSP_SIZE)
+        atecc_data.status = ATCA_RX_FAIL;
+    } while (atecc_data.status != ATCA_SUCCESS && --atecc_data.retries);
+
+    ASSERT((atecc_data.status == ATCA_SUCCESS) &&
+           (!is_zero(&packet.data[ATCA_RSP_DATA_IDX], RANDOM_NUM_SIZE)));
+
+    for (int i = 0; i < RANDOM_NUM_SIZE && offset + i < len; ++i) {
+      arr[offset + i] ^= packet.data[ATCA_RSP_DATA_IDX + i];
+    }
   }
+  memzero(&packet, sizeof(packet));
 }
 
 uint8_t get_floating_precision(uint64_t num, uint64_t den) {
@@ -521,57 +595,126 @@ bool convert_byte_array_to_decimal_string(
     char *amount_string,
     char *amount_decimal_string,
     const size_t amount_decimal_string_size) {
-  uint8_t decimal_val_s[32 * 3] = {0};
-  if (sizeof(decimal_val_s) / sizeof(decimal_val_s[0]) > UINT8_MAX) {
+  uint8_t bytes[UINT8_MAX / 2 + 1] = {0};
+  const uint8_t size = (len + 1) / 2;
+
+  // an odd number of digits leaves the high nibble of the first byte empty
+  for (uint8_t i = 0; i < len; i++) {
+    const uint8_t nibble = len - 1 - i;
+    bytes[size - 1 - nibble / 2] |= hexchartoint(amount_string[i])
+                                    << (4 * (nibble % 2));
+  }
+
+  if (!byte_array_to_decimal_string(bytes,
+                                    size,
+                                    decimal,
+                                    amount_decimal_string,
+                                    amount_decimal_string_size)) {
     LOG_ERROR("0xxx#");
     return false;
   }
-  const uint8_t dec_val_len =
-      sizeof(decimal_val_s) /
-      sizeof(decimal_val_s[0]);    // logbase10(2pow256) roughly equals 78
-  convertbase16tobase10(len, amount_string, decimal_val_s, dec_val_len);
 
-  int i = 0, j = dec_val_len - 1;
-  bool pre_dec_digit = false, post_dec_digit = false;
-  uint8_t point_index = dec_val_len - decimal;
+  LOG_INFO("amt %s %d:%d", amount_string, decimal, len);
+  return true;
+}
 
-  uint8_t offset = 0;
-  while (i <= j) {
-    if (i == point_index && post_dec_digit) {
-      if (!pre_dec_digit) {
-        offset += snprintf(amount_decimal_string + offset,
-                           (amount_decimal_string_size)-offset,
-                           "0");
-      }
-      offset += snprintf(amount_decimal_string + offset,
-                         (amount_decimal_string_size)-offset,
-                         ".");
-    }
-    if (j >= point_index) {
-      if (!decimal_val_s[j] && !post_dec_digit) {
-        j--;
-      } else if (decimal_val_s[j]) {
-        post_dec_digit = true;
-      }
+bool byte_array_to_decimal_string(const uint8_t *bytes,
+                                  size_t size,
+                                  uint8_t decimal,
+                                  char *out,
+                                  size_t out_size) {
+  // 9 digits per 10^9 chunk, 97 digits for 320 bits
+  uint32_t limbs[UTIL_DECIMAL_MAX_BYTES / 4] = {0};
+  uint32_t chunks[UTIL_DECIMAL_MAX_BYTES * 241 / 900 + 1] = {0};
+  char digits[sizeof(chunks) / sizeof(chunks[0]) * 9 + 1] = "";
+
+  if (NULL == bytes || NULL == out || 0 == out_size) {
+    return false;
+  }
+
+  while (0 < size && 0 == bytes[0]) {
+    bytes++;
+    size--;
+  }
+  if (UTIL_DECIMAL_MAX_BYTES < size) {
+    return false;
+  }
+
+  // little-endian 32-bit limbs
+  uint8_t limb_count = (size + 3) / 4;
+  for (size_t i = 0; i < size; i++) {
+    limbs[i / 4] |= (uint32_t)bytes[size - 1 - i] << (8 * (i % 4));
+  }
+
+  uint8_t chunk_count = 0;
+  do {
+    uint64_t remainder = 0;
+    for (int8_t limb = limb_count - 1; limb >= 0; limb--) {
+      const uint64_t dividend = (remainder << 32) | limbs[limb];
+      limbs[limb] = (uint32_t)(dividend / 1000000000);
+      remainder = dividend % 1000000000;
     }
-    if (decimal_val_s[i] || i == point_index) {
-      pre_dec_digit = true;
+    chunks[chunk_count++] = (uint32_t)remainder;
+    while (0 < limb_count && 0 == limbs[limb_count - 1]) {
+      limb_count--;
     }
-    if (pre_dec_digit || decimal_val_s[i]) {
-      // attach non zero leading value detected or decimal digits till j(should
-      // be the last non zero decimal digit index).
-      offset += snprintf(amount_decimal_string + offset,
-                         (amount_decimal_string_size)-offset,
-                         "%d",
-                         decimal_val_s[i]);
+  } while (0 < limb_count);
+
+  // the most significant chunk has no leading zeros, the others are padded
+  size_t digit_count = 0;
+  uint32_t chunk = chunks[chunk_count - 1];
+  do {
+    digits[digit_count++] = '0' + chunk % 10;
+    chunk /= 10;
+  } while (0 != chunk);
+  for (size_t i = 0, j = digit_count - 1; i < j; i++, j--) {
+    const char digit = digits[i];
+    digits[i] = digits[j];
+    digits[j] = digit;
+  }
+  for (int8_t i = chunk_count - 2; i >= 0; i--) {
+    chunk = chunks[i];
+    for (int8_t place = 8; place >= 0; place--) {
+      digits[digit_count + place] = '0' + chunk % 10;
+      chunk /= 10;
     }
-    i++;
+    digit_count += 9;
   }
-  if (!post_dec_digit && !pre_dec_digit) {
-    snprintf(amount_decimal_string, (amount_decimal_string_size)-1, "0");
+
+  if (1 == digit_count && '0' == digits[0]) {
+    return (size_t)snprintf(out, out_size, "0") < out_size;
+  }
+
+  // digits which belong to the integer part, the rest form the fraction
+  const size_t integer_count = digit_count > decimal ? digit_count - decimal : 0;
+  size_t trailing_zeros = 0;
+  while (trailing_zeros < digit_count - integer_count &&
+         '0' == digits[digit_count - 1 - trailing_zeros]) {
+    trailing_zeros++;
+  }
+  const size_t fraction_count = decimal - trailing_zeros;
+  const size_t length = (0 == integer_count ? 1 : integer_count) +
+                        (0 == fraction_count ? 0 : 1 + fraction_count);
+  if (length >= out_size) {
+    return false;
   }
 
-  LOG_INFO("amt %s %d:%d", amount_string, decimal, i);
+  size_t offset = 0;
+  if (0 == integer_count) {
+    out[offset++] = '0';
+  }
+  memcpy(&out[offset], digits, integer_count);
+  offset += integer_count;
+  if (0 < fraction_count) {
+    out[offset++] = '.';
+    for (size_t zero = digit_count; zero < decimal; zero++) {
+      out[offset++] = '0';
+    }
+    const size_t significant = digit_count - integer_count - trailing_zeros;
+    memcpy(&out[offset], &digits[integer_count], significant);
+    offset += significant;
+  }
+  out[offset] = '\0';
   return true;
 }
 
@@ -25,6 +25,7 @@
 #pragma once
 #include <inttypes.h>
 
+#include "capacity_config.h"
 #include "wallet.h"
 
 /// Convert bit array of size 4 to uint32
@@ -52,10 +53,18 @@
 #define U32_SWAP_ENDIANNESS(x)                                                 \
   ((x) << 24 | ((x)&0xff00) << 8 | ((x)&0xff0000) >> 8 | (x) >> 24)
 /// Find maximum of two values
+/// Size of the RAM region cy_malloc() serves before falling back to the heap
+#ifndef CY_ARENA_SIZE
+#define CY_ARENA_SIZE CAPACITY_ARENA_SIZE
+#endif
+
 #define CY_MAX(a, b) ((a) > (b) ? (a) : (b))
 /// Find minimum of two values
 #define CY_MIN(a, b) ((a) < (b) ? (a) : (b))
 
+/// Largest value (in bytes) byte_array_to_decimal_string() formats; 320 bits
+#define UTIL_DECIMAL_MAX_BYTES 40
+
 #define UTIL_INVALID_ARGUMENTS (0x11)
 #define UTIL_OUT_OF_BOUNDS (0x22)
 #define UTIL_IN_BOUNDS (0xAA)
@@ -97,36 +106,52 @@ typedef enum FUNC_RETURN_CODES {
 } FUNC_RETURN_CODES;
 
 /**
- * @brief Allocates memory via malloc and makes an entry for each allocation
- * into its global list of memory allocation.
- * @details
+ * @brief Position in the allocations of cy_malloc(), see cy_arena_mark()
+ */
+typedef struct {
+  size_t top;            ///< Bytes of the arena in use
+  size_t heap_blocks;    ///< Heap blocks allocated after the arena was full
+} cy_arena_mark_t;
+
+/**
+ * @brief Allocates zeroed memory from the arena, a fixed RAM region which is
+ * released as a whole.
+ * @details Allocation is a bump of the arena top. Once the arena is full, the
+ * memory comes from the heap and is tracked to be released along with the
+ * arena. The memory cannot be freed individually; see cy_free() and
+ * cy_arena_reset().
  *
- * @param [in, out]  mem
- * @param [in]       mem_size
+ * @param [in]       mem_size Number of bytes needed
  *
- * @return
- * @retval
+ * @return void* Zeroed memory, aligned to 8 bytes
  *
- * @see
+ * @see cy_free(), cy_arena_mark(), cy_arena_reset()
  * @since v1.0.0
- *
- * @note
  */
 void *cy_malloc(size_t mem_size);
 
 /**
- * @brief Free entire list of dynamic allocations.
- * @details
+ * @brief Returns the current top of the arena, to release everything
+ * allocated after it with cy_arena_reset().
  *
- * @param
+ * @return cy_arena_mark_t Position to reset to
+ */
+cy_arena_mark_t cy_arena_mark();
+
+/**
+ * @brief Zeroizes and releases everything allocated with cy_malloc() after the
+ * mark was taken.
  *
- * @return
- * @retval
+ * @param mark Value returned by cy_arena_mark()
+ */
+void cy_arena_reset(cy_arena_mark_t mark);
+
+/**
+ * @brief Zeroizes and releases everything allocated with cy_malloc().
+ * @details Equivalent to a reset to an empty arena.
  *
- * @see
+ * @see cy_arena_reset()
  * @since v1.0.0
- *
- * @note
  */
 void cy_free();
 
@@ -306,8 +331,9 @@ void get_firmaware_version(uint16_t pid,
                            char message[]);
 
 /**
- * @brief Genrate random 32 byte using BSP and atecc random generator function's
- * @details
+ * @brief Genrate random bytes using BSP and atecc random generator function's
+ * @details The MCU output is XOR-ed with the atecc output, fetched 32 bytes at
+ * a time.
  *
  * @param arr
  * @param len
@@ -432,6 +458,29 @@ bool convert_byte_array_to_decimal_string(
     char *amount_decimal_string,
     const size_t amount_decimal_string_size);
 
+/**
+ * @brief Formats a big-endian unsigned integer as a decimal amount
+ * @details The value is divided by 10^decimal. The trailing zeros of the
+ * fraction are dropped along with the decimal point for whole amounts; a zero
+ * value formats as "0" and an amount below 1 gets a leading "0". The digits
+ * are produced 9 at a time by dividing 32-bit limbs by 10^9.
+ *
+ * @param bytes Big-endian value, at most UTIL_DECIMAL_MAX_BYTES significant
+ * bytes
+ * @param size Number of bytes in bytes
+ * @param decimal Number of decimal places of the amount
+ * @param out Output buffer for the NUL terminated string
+ * @param out_size Size of the output buffer
+ *
+ * @return bool Indicating if the amount was formatted
+ * @retval false If the value is too large or the buffer is too small
+ */
+bool byte_array_to_decimal_string(const uint8_t *bytes,
+                                  size_t size,
+                                  uint8_t decimal,
+                                  char *out,
+                                  size_t out_size);
+
 /**
  * @brief Checks if reading n bytes from a memory chunk of m bytes is safe or
  * not
@@ -70,14 +70,51 @@
 #include "communication.h"
 #include "flash_api.h"
 #include "flash_struct.h"
+#include "task_scheduler.h"
+
+/// Size of the RAM buffer holding log entries till they are programmed
+#define LOG_PENDING_SIZE 1024
+
+/// Maximum log entries held in the RAM buffer, each takes at least 8 bytes
+#define LOG_PENDING_ENTRIES (LOG_PENDING_SIZE / sizeof(uint64_t))
+
+/// Slice given to the background task flushing log entries
+#define LOG_FLUSH_SLICE_MS 50
+
+#if LOG_BINARY_FORMAT == 1
+/**
+ * Binary log record, decoded by utilities/logger/decode-logs.py
+ *  [0]      LOG_RECORD_MARKER, never part of text entries
+ *  [1]      Length of the record including padding
+ *  [2..3]   Log count (little-endian, as are all fields)
+ *  [4..7]   Tick in milliseconds
+ *  [8..11]  Address of the format string in the firmware image, 0 if the
+ *           format is not in flash and instead packed as the first argument
+ *  [12..]   Arguments in order of the format: integers as 4 bytes (8 for ll),
+ *           floating point as 8 bytes, strings as a length byte followed by
+ *           the characters. Arguments which do not fit are dropped.
+ *  '\n'     Terminator, followed by spaces up to 8-byte alignment
+ */
+#define LOG_RECORD_MARKER 0xB1
+#define LOG_RECORD_HEADER_SIZE 12
+#endif
 
 extern const char *GIT_REV;
 extern const char *GIT_TAG;
 extern const char *GIT_BRANCH;
 
+/// Runtime level of the logs, see logger_set_level()
+uint8_t log_runtime_level = LOG_LEVEL_SWV;
+
 /// Stores log details
 static logger_data_s_t sg_log_data;
 
+/// Formatted log entries not yet on flash, aligned for programming
+static uint64_t log_pending[LOG_PENDING_SIZE / sizeof(uint64_t)];
+static uint16_t log_pending_len;
+static uint8_t log_pending_entry_len[LOG_PENDING_ENTRIES];
+static uint8_t log_pending_count;
+
 /**
  * @brief Move to the next page and adds spaces to fill gap
  * @details
@@ -94,16 +131,150 @@ static logger_data_s_t sg_log_data;
  */
 static void logger_switch_page(void);
 
+/**
+ * @brief Background task programming the buffered log entries, runs once the
+ * flow waits for the next event
+ */
+static bool logger_flush_task(uint32_t budget_ms);
+
+#if LOG_BINARY_FORMAT == 1
+/**
+ * @brief Appends bytes to a binary log record, keeping a byte for the
+ * terminator
+ *
+ * @return bool If the bytes fit in the record
+ */
+static bool logger_pack(uint8_t *record,
+                        uint8_t *len,
+                        const void *data,
+                        uint8_t size);
+
+/**
+ * @brief Appends a string argument, truncated to the space left
+ *
+ * @return bool If any space was left for the string
+ */
+static bool logger_pack_string(uint8_t *record, uint8_t *len, const char *str);
+
+/**
+ * @brief Packs a binary log record of the format and its arguments
+ *
+ * @param record Buffer of LOG_MAX_SIZE bytes
+ * @param fmt printf style format
+ * @param args Arguments of the format
+ * @return uint8_t Length of the record up to the terminator, without padding
+ */
+static uint8_t logger_pack_record(uint8_t *record,
+                                  const char *fmt,
+                                  va_list args);
+#endif
+
+static bool logger_flush_task(uint32_t budget_ms) {
+  sched_remove_task(logger_flush_task);
+  logger_flush();
+  return false;
+}
+
+#if LOG_BINARY_FORMAT == 1
+static bool logger_pack(uint8_t *record,
+                        uint8_t *len,
+                        const void *data,
+                        uint8_t size) {
+  if ((LOG_MAX_SIZE - 1) < (*len + size)) {
+    return false;
+  }
+  memcpy(record + *len, data, size);
+  *len += size;
+  return true;
+}
+
+static bool logger_pack_string(uint8_t *record, uint8_t *len, const char *str) {
+  if ((LOG_MAX_SIZE - 1) <= (*len + 1)) {
+    return false;
+  }
+  uint8_t size = strnlen(str, (LOG_MAX_SIZE - 2) - *len);
+  record[(*len)++] = size;
+  return logger_pack(record, len, str, size);
+}
+
+static uint8_t logger_pack_record(uint8_t *record,
+                                  const char *fmt,
+                                  va_list args) {
+  uint32_t fmt_id = (uint32_t)fmt;
+  uint32_t tick = uwTick;
+  uint8_t len = 0;
+  bool fits = true;
+
+  record[0] = LOG_RECORD_MARKER;
+  record[1] = 0;
+  memcpy(record + 2, &sg_log_data.log_count, sizeof(uint16_t));
+  memcpy(record + 4, &tick, sizeof(tick));
+  if (FLASH_BASE > fmt_id || FLASH_END < fmt_id) {
+    // A format built at runtime, the decoder can not look it up
+    fmt_id = 0;
+  }
+  memcpy(record + 8, &fmt_id, sizeof(fmt_id));
+  len = LOG_RECORD_HEADER_SIZE;
+  if (0 == fmt_id) {
+    fits = logger_pack_string(record, &len, fmt);
+  }
+
+  for (const char *c = fmt; fits && '\0' != *c; c++) {
+    if ('%' != *c || '%' == *(++c)) {
+      continue;
+    }
+
+    uint8_t long_count = 0;
+    for (; '\0' != *c && NULL != strchr("-+ #0123456789.*hlzjtL", *c); c++) {
+      if ('*' == *c) {
+        int32_t width = va_arg(args, int32_t);
+        fits = logger_pack(record, &len, &width, sizeof(width));
+      }
+      long_count += ('l' == *c) ? 1 : 0;
+    }
+
+    if ('\0' == *c) {
+      break;
+    } else if ('s' == *c) {
+      const char *str = va_arg(args, const char *);
+      fits = logger_pack_string(record, &len, NULL == str ? "(null)" : str);
+    } else if (NULL != strchr("fFeEgGaA", *c)) {
+      double value = va_arg(args, double);
+      fits = logger_pack(record, &len, &value, sizeof(value));
+    } else if (2 <= long_count) {
+      uint64_t value = va_arg(args, uint64_t);
+      fits = logger_pack(record, &len, &value, sizeof(value));
+    } else {
+      uint32_t value = va_arg(args, uint32_t);
+      fits = logger_pack(record, &len, &value, sizeof(value));
+    }
+  }
+
+  record[len++] = '\n';
+  return len;
+}
+#endif
+
 void logger(char *fmt, ...) {
   ASSERT(fmt != NULL);
 
-  char temp_str1[LOG_MAX_SIZE];
-  char temp_str2[LOG_MAX_SIZE];
   int16_t n;
   uint8_t cnt2;
   va_list args;
 
   if (sg_log_data.initialized == true) {
+    if ((sizeof(log_pending) - log_pending_len) < LOG_MAX_SIZE ||
+        LOG_PENDING_ENTRIES == log_pending_count) {
+      logger_flush();
+    }
+
+    char *temp_str2 = (char *)log_pending + log_pending_len;
+#if LOG_BINARY_FORMAT == 1
+    va_start(args, fmt);
+    n = logger_pack_record((uint8_t *)temp_str2, fmt, args);
+    va_end(args);
+#else
+    char temp_str1[LOG_MAX_SIZE];
     memset(temp_str1, 0, LOG_MAX_SIZE);
     memset(temp_str2, 0, LOG_MAX_SIZE);
     va_start(args, fmt);
@@ -112,6 +283,11 @@ void logger(char *fmt, ...) {
 
     n = snprintf(
         temp_str2, LOG_MAX_SIZE, "%d. %s\n", sg_log_data.log_count, temp_str1);
+    if (n >= LOG_MAX_SIZE) {
+      // Truncated, keep the terminating null out of the log
+      n = LOG_MAX_SIZE - 1;
+    }
+#endif
     cnt2 = n % sizeof(uint64_t);
     cnt2 = cnt2 == 0
                ? 0
@@ -120,28 +296,65 @@ void logger(char *fmt, ...) {
     for (uint8_t cnt1 = 0; cnt1 < cnt2; cnt1++) {
       temp_str2[n + cnt1] = ' ';
     }
+#if LOG_BINARY_FORMAT == 1
+    temp_str2[1] = n + cnt2;
+#endif
 
-    /*Here check if enough space is available in current page*/
-    if ((sg_log_data.next_write_loc + n + cnt2) >=
-        (((sg_log_data.page_index + 1) * LOG_PAGE_SIZE) + LOG_SECTION_START)) {
-      logger_switch_page();
+    log_pending_entry_len[log_pending_count++] = n + cnt2;
+    log_pending_len += (n + cnt2);
+    sg_log_data.log_count++;
+
+    // The idle loop of get_events() programs the entries in one go
+    if (!sched_add_task(
+            logger_flush_task, SCHED_PRIO_LOW, LOG_FLUSH_SLICE_MS)) {
+      logger_flush();
     }
+  }
+}
 
-    write_cmd(sg_log_data.next_write_loc, (uint32_t *)temp_str2, n + cnt2);
-    sg_log_data.next_write_loc += (n + cnt2);
-    sg_log_data.log_count++;
+void logger_set_level(uint8_t level) {
+  log_runtime_level = level;
+}
+
+void logger_flush(void) {
+  uint16_t offset = 0;
+  uint8_t entry = 0;
+
+  while (entry < log_pending_count) {
+    const uint32_t page_end =
+        ((sg_log_data.page_index + 1) * LOG_PAGE_SIZE) + LOG_SECTION_START;
+    uint16_t run = 0;
 
-    /*Here is the page is completely filled.
-    Putting this check so if at anypoint device reset when current page was
-    full, we should be able to fine atleast 1 next page with space to write*/
-    if ((sg_log_data.next_write_loc) >=
-        (((sg_log_data.page_index + 1) * LOG_PAGE_SIZE) + LOG_SECTION_START)) {
+    /*Here collect the entries which fit in the current page*/
+    while (entry < log_pending_count &&
+           (sg_log_data.next_write_loc + run + log_pending_entry_len[entry]) <
+               page_end) {
+      run += log_pending_entry_len[entry++];
+    }
+
+    if (0 < run) {
+      write_cmd(sg_log_data.next_write_loc,
+                (uint32_t *)((uint8_t *)log_pending + offset),
+                run);
+      sg_log_data.next_write_loc += run;
+      offset += run;
+    }
+
+    /*Here the next entry does not fit, so move on to the next page. The page
+    is never filled completely, so if at anypoint device reset we should be
+    able to find atleast 1 next page with space to write*/
+    if (entry < log_pending_count) {
       logger_switch_page();
     }
   }
+
+  log_pending_len = 0;
+  log_pending_count = 0;
 }
 
 void logger_reset_flash(void) {
+  log_pending_len = 0;
+  log_pending_count = 0;
   erase_cmd(LOG_SECTION_START, LOG_MAX_PAGES * FLASH_PAGE_SIZE);
   sg_log_data.page_index = 0;
   sg_log_data.next_write_loc = LOG_SECTION_START;
@@ -242,77 +455,91 @@ void logger_task(uint8_t *data, size_t *size) {
          sg_log_data.total_page_read);
   uint16_t cnt = 0;
   uint16_t packet_len = 0;
+  uint16_t filled = 0;
   void *addr_loc = NULL;
   uint8_t next_loc_found = false;
   const char *start_of_log = "startofpacket\r\n";
   const char *end_of_log = "endofpacket\r\n";
 
-  switch (sg_log_data.read_sm_e) {
-    case LOG_READ_INIT:
-      sg_log_data.read_sm_e = LOG_READ_ONGOING;
-
-      for (cnt = sg_log_data.page_index + 1; cnt != sg_log_data.page_index;
-           cnt = CYCLIC_INCREMENT(cnt, LOG_MAX_PAGES)) {
-        addr_loc = (void *)(LOG_SECTION_START + (cnt * LOG_PAGE_SIZE));
-        if (*(uint64_t *)addr_loc == 0x2020202020202020) {
-          sg_log_data.read_page_index = cnt;
-          next_loc_found = true;
-          break;
-        }
+  *size = 0;
+  if (LOG_READ_INIT == sg_log_data.read_sm_e) {
+    logger_flush();
+    sg_log_data.read_sm_e = LOG_READ_ONGOING;
+
+    for (cnt = CYCLIC_INCREMENT(sg_log_data.page_index, LOG_MAX_PAGES);
+         cnt != sg_log_data.page_index;
+         cnt = CYCLIC_INCREMENT(cnt, LOG_MAX_PAGES)) {
+      addr_loc = (void *)(LOG_SECTION_START + (cnt * LOG_PAGE_SIZE));
+      if (*(uint64_t *)addr_loc == 0x2020202020202020) {
+        sg_log_data.read_page_index = cnt;
+        next_loc_found = true;
+        break;
       }
+    }
 
-      if (next_loc_found == false)
-        sg_log_data.read_page_index = sg_log_data.page_index;
-
-      sg_log_data.total_page_read = 0;
-      sg_log_data.initialized = false;
-      char extended_start_of_log[MAXIMUM_DATA_SIZE] = {'\0'};
-      snprintf(extended_start_of_log,
-               MAXIMUM_DATA_SIZE - 1,
-               "\r\n%s%s Bl:%lX\r\n",
-               start_of_log,
-               GIT_REV,
-               FW_get_bootloader_version());
-      memcpy(data, extended_start_of_log, MAXIMUM_DATA_SIZE);
-      *size = MAXIMUM_DATA_SIZE;
+    if (next_loc_found == false)
+      sg_log_data.read_page_index = sg_log_data.page_index;
+
+    sg_log_data.total_page_read = 0;
+    sg_log_data.read_offset = 0;
+    sg_log_data.initialized = false;
+    char extended_start_of_log[MAXIMUM_DATA_SIZE] = {'\0'};
+    snprintf(extended_start_of_log,
+             MAXIMUM_DATA_SIZE - 1,
+             "\r\n%s%s Bl:%lX\r\n",
+             start_of_log,
+             GIT_REV,
+             FW_get_bootloader_version());
+    memcpy(data, extended_start_of_log, MAXIMUM_DATA_SIZE);
+    filled = MAXIMUM_DATA_SIZE;
+  }
+
+  /* The logs are sent as a stream: every chunk is filled upto LOG_PAGE_SIZE
+   * with the start of log, the pages (read straight from flash) and the end of
+   * log, which saves round trips with the host */
+  while (LOG_READ_ONGOING == sg_log_data.read_sm_e && LOG_PAGE_SIZE > filled) {
+    const uint8_t *page_read_location =
+        (const uint8_t *)(LOG_SECTION_START +
+                          sg_log_data.read_page_index * LOG_PAGE_SIZE);
+    packet_len = LOG_PAGE_SIZE;
+    if (sg_log_data.page_index == sg_log_data.read_page_index) {
+      packet_len = sg_log_data.next_write_loc - (uint32_t)page_read_location;
+    }
+    if (sg_log_data.total_page_read == LOG_MAX_PAGES) {
+      sg_log_data.read_sm_e = LOG_READ_END;
       break;
+    }
+
+    uint16_t len = packet_len - sg_log_data.read_offset;
+    if (len > LOG_PAGE_SIZE - filled) {
+      len = LOG_PAGE_SIZE - filled;
+    }
+    memcpy(data + filled, page_read_location + sg_log_data.read_offset, len);
+    filled += len;
+    sg_log_data.read_offset += len;
 
-    case LOG_READ_ONGOING:
-      packet_len = LOG_PAGE_SIZE;
+    if (sg_log_data.read_offset == packet_len) {
+      sg_log_data.read_offset = 0;
+      sg_log_data.total_page_read += 1;
       if (sg_log_data.page_index == sg_log_data.read_page_index) {
-        packet_len =
-            sg_log_data.next_write_loc -
-            (LOG_SECTION_START + sg_log_data.read_page_index * LOG_PAGE_SIZE);
-        sg_log_data.read_sm_e = LOG_READ_END;
-      }
-      if (packet_len == 0 || sg_log_data.total_page_read == LOG_MAX_PAGES) {
         sg_log_data.read_sm_e = LOG_READ_END;
-        break;
-      }
-      if (packet_len > 0) {
-        uint8_t *page_read_location =
-            (uint8_t *)(LOG_SECTION_START +
-                        sg_log_data.read_page_index * LOG_PAGE_SIZE);
-        memcpy(data, page_read_location, packet_len);
-        *size = packet_len;
       }
       sg_log_data.read_page_index =
           CYCLIC_INCREMENT(sg_log_data.read_page_index, LOG_MAX_PAGES);
-      sg_log_data.total_page_read += 1;
-      break;
-
-    case LOG_READ_END:
-      sg_log_data.read_sm_e = LOG_READ_FINISH;
-      memcpy(data, end_of_log, strlen(end_of_log));
-      *size = strlen(end_of_log);
-      sg_log_data.initialized = true;
-      break;
+    }
+  }
 
-    default:
-      sg_log_data.read_sm_e = LOG_READ_FINISH;
-      sg_log_data.initialized = true;
-      break;
+  if (LOG_READ_END == sg_log_data.read_sm_e &&
+      strlen(end_of_log) <= (size_t)(LOG_PAGE_SIZE - filled)) {
+    memcpy(data + filled, end_of_log, strlen(end_of_log));
+    filled += strlen(end_of_log);
+    sg_log_data.read_sm_e = LOG_READ_FINISH;
+    sg_log_data.initialized = true;
+  } else if (LOG_READ_FINISH == sg_log_data.read_sm_e) {
+    sg_log_data.initialized = true;
   }
+
+  *size = filled;
 #endif
 }
 
@@ -20,6 +20,11 @@
 
 /// Defines max size of log
 #define LOG_MAX_SIZE (128)
+
+/// Log compact binary records instead of text; set by the BINARY_LOGS option
+#ifndef LOG_BINARY_FORMAT
+#define LOG_BINARY_FORMAT 0
+#endif
 /// Size of log sent to desktop
 #define LOG_SENT_MAX_SIZE (32)
 /// Start address of log
@@ -52,6 +57,7 @@ typedef struct {
   uint8_t read_page_index;
   log_read_e_t read_sm_e;
   uint8_t total_page_read;
+  uint16_t read_offset;
 } logger_data_s_t;
 
 /**
@@ -62,27 +68,56 @@ typedef struct {
  */
 void logger(char *fmt, ...);
 
-/// Main logger method
-#if USE_SIMULATOR == 0
+/**
+ * @brief Programs the log entries buffered in RAM to flash
+ * @details logger() buffers the formatted entries and programs them from the
+ * idle time of the flow. Call this before a reset so that the last entries
+ * are not lost.
+ */
+void logger_flush(void);
 
-#ifndef RELEASE_BUILD
-#define LOG_SWV printf
-#define LOG_INFO logger
-#else
-#define LOG_SWV(...)
-#define LOG_INFO(...)
-#endif
+/**
+ * @brief Sets the runtime level of the logs
+ * @details Entries are kept only up to the lower of the runtime level and the
+ * compile-time level of their module; the runtime level cannot enable entries
+ * compiled out.
+ *
+ * @param level One of LOG_LEVEL_NONE to LOG_LEVEL_SWV
+ */
+void logger_set_level(uint8_t level);
 
-#define LOG_CRITICAL logger
-#define LOG_ERROR logger
+/// Level of the module, see LOG_DEFAULT_LEVEL in logger_config.h
+#ifndef LOG_MODULE_LEVEL
+#define LOG_MODULE_LEVEL LOG_DEFAULT_LEVEL
+#endif
 
-#else
+/// Runtime level, entries compiled in but above it are dropped; defaults to
+/// LOG_LEVEL_SWV
+extern uint8_t log_runtime_level;
 
-#define LOG_SWV printf
-#define LOG_INFO printf
-#define LOG_ERROR printf
-#define LOG_CRITICAL printf
+/**
+ * Calls log_fn if the level is within the level of the module and the runtime
+ * level. The first check is constant, so that entries above the level of the
+ * module are dropped by the compiler along with their arguments.
+ */
+#define LOG_AT_LEVEL(level, log_fn, ...)                                       \
+  do {                                                                         \
+    if ((LOG_MODULE_LEVEL) >= (level) && log_runtime_level >= (level)) {       \
+      log_fn(__VA_ARGS__);                                                     \
+    }                                                                          \
+  } while (0)
 
+/// Main logger method
+#if USE_SIMULATOR == 0
+#define LOG_SWV(...) LOG_AT_LEVEL(LOG_LEVEL_SWV, printf, __VA_ARGS__)
+#define LOG_INFO(...) LOG_AT_LEVEL(LOG_LEVEL_INFO, logger, __VA_ARGS__)
+#define LOG_ERROR(...) LOG_AT_LEVEL(LOG_LEVEL_ERROR, logger, __VA_ARGS__)
+#define LOG_CRITICAL(...) LOG_AT_LEVEL(LOG_LEVEL_CRITICAL, logger, __VA_ARGS__)
+#else
+#define LOG_SWV(...) LOG_AT_LEVEL(LOG_LEVEL_SWV, printf, __VA_ARGS__)
+#define LOG_INFO(...) LOG_AT_LEVEL(LOG_LEVEL_INFO, printf, __VA_ARGS__)
+#define LOG_ERROR(...) LOG_AT_LEVEL(LOG_LEVEL_ERROR, printf, __VA_ARGS__)
+#define LOG_CRITICAL(...) LOG_AT_LEVEL(LOG_LEVEL_CRITICAL, printf, __VA_ARGS__)
 #endif
 
 /// Increments the passed var within the limits of the passed max
@@ -91,9 +126,11 @@ void logger(char *fmt, ...);
 /**
  * @brief Task to read logs from flash to provided buffer in RAM.
  * @details The function internally maintains states to manage transferring logs
- * in chunks of 2kB. The function sends a 'start of log' packet when export
- * starts and 'end of log' packet when all the logs have been sent. The
- * application should handle usb events after each chunk transfer is complete
+ * in chunks of 2kB. The logs are streamed as 'start of log', the log pages
+ * and 'end of log'; every chunk except the last is filled completely, hence a
+ * chunk may end within a page. The read status is LOG_READ_FINISH after the
+ * last chunk. The application should handle usb events after each chunk
+ * transfer is complete
  * so that next chunk request from host is served by calling this function
  * repeatedly on every usb event.
  *
@@ -25,4 +25,41 @@
 #define DEBUG_TO_TERMINAL (1)
 #define DEBUG_TO_APP (1)
 
+/// Log levels; a level keeps the entries of every level up to its own
+#define LOG_LEVEL_NONE 0
+#define LOG_LEVEL_CRITICAL 1    ///< LOG_CRITICAL, to the flash logs
+#define LOG_LEVEL_ERROR 2       ///< LOG_ERROR, to the flash logs
+#define LOG_LEVEL_INFO 3        ///< LOG_INFO, to the flash logs
+#define LOG_LEVEL_SWV 4         ///< LOG_SWV, printf on the SWO trace
+
+/**
+ * Level of the modules not setting LOG_MODULE_LEVEL. Entries above the level
+ * of the module compile to nothing, arguments included. The SWO trace is only
+ * read with a debugger attached, hence production firmware stops at
+ * LOG_LEVEL_INFO and keeps the flash logs as they were.
+ */
+#ifndef LOG_DEFAULT_LEVEL
+#if defined(RELEASE_BUILD)
+#define LOG_DEFAULT_LEVEL LOG_LEVEL_ERROR
+#elif defined(DEV_BUILD) || USE_SIMULATOR == 1
+#define LOG_DEFAULT_LEVEL LOG_LEVEL_SWV
+#else
+#define LOG_DEFAULT_LEVEL LOG_LEVEL_INFO
+#endif
+#endif
+
+/**
+ * Levels of the modules on hot paths. A module uses one by defining
+ * LOG_MODULE_LEVEL before its first include, eg.
+ * #define LOG_MODULE_LEVEL LOG_USB_LEVEL
+ */
+/// USB packet handling, partly from the USB interrupt
+#ifndef LOG_USB_LEVEL
+#define LOG_USB_LEVEL LOG_DEFAULT_LEVEL
+#endif
+/// NFC exchanges with the X1 cards
+#ifndef LOG_NFC_LEVEL
+#define LOG_NFC_LEVEL LOG_DEFAULT_LEVEL
+#endif
+
 #endif    // LOGGER_CONFIG_H
\ No newline at end of file
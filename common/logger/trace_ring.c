@@ -0,0 +1,140 @@
+/**
+ * @file    trace_ring.c
+ * @author  Cypherock X1 Team
+ * @brief   Always-on binary trace of the hot-path events.
+ * @copyright Copyright (c) 2023 HODL TECH PTE LTD
+ * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
+ *target=_blank>https://mitcc.org/</a>
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * (c) Copyright 2023 by HODL TECH PTE LTD
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * "Commons Clause" License Condition v1.0
+ *
+ * The Software is provided to you by the Licensor under the License,
+ * as defined below, subject to the following condition.
+ *
+ * Without limiting other conditions in the License, the grant of
+ * rights under the License will not include, and the License does not
+ * grant to you, the right to Sell the Software.
+ *
+ * For purposes of the foregoing, "Sell" means practicing any or all
+ * of the rights granted to you under the License to provide to third
+ * parties, for a fee or other consideration (including without
+ * limitation fees for hosting or consulting/ support services related
+ * to the Software), a product or service whose value derives, entirely
+ * or substantially, from the functionality of the Software. Any license
+ * notice or attribution required by the License must also include
+ * this Commons Clause License Condition notice.
+ *
+ * Software: All X1Wallet associated files.
+ * License: MIT
+ * Licensor: HODL TECH PTE LTD
+ *
+ ******************************************************************************
+ */
+
+/*****************************************************************************
+ * INCLUDES
+ *****************************************************************************/
+#include "trace_ring.h"
+
+#include "board.h"
+
+#if USE_SIMULATOR == 1
+#include <time.h>
+#endif
+
+/*****************************************************************************
+ * EXTERN VARIABLES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * PRIVATE MACROS AND DEFINES
+ *****************************************************************************/
+
+#if (TRACE_RING_ENTRIES & (TRACE_RING_ENTRIES - 1)) != 0
+#error TRACE_RING_ENTRIES must be a power of 2
+#endif
+
+/*****************************************************************************
+ * PRIVATE TYPEDEFS
+ *****************************************************************************/
+
+/*****************************************************************************
+ * STATIC VARIABLES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * GLOBAL VARIABLES
+ *****************************************************************************/
+// not static, so that a debugger finds them with any symbol lookup
+trace_entry_t trace_ring[TRACE_RING_ENTRIES];
+uint32_t trace_head;
+
+/*****************************************************************************
+ * STATIC FUNCTION PROTOTYPES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * STATIC FUNCTIONS
+ *****************************************************************************/
+
+/*****************************************************************************
+ * GLOBAL FUNCTIONS
+ *****************************************************************************/
+void trace_ring_init(void) {
+#if USE_SIMULATOR == 0
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+}
+
+void trace_event(trace_event_e id, uint32_t arg) {
+  const uint32_t seq = __atomic_fetch_add(&trace_head, 1, __ATOMIC_RELAXED);
+  trace_entry_t *entry = &trace_ring[seq & (TRACE_RING_ENTRIES - 1)];
+
+#if USE_SIMULATOR == 0
+  entry->timestamp = DWT->CYCCNT;
+  entry->id = id | (0 != __get_IPSR() ? TRACE_FROM_ISR : 0);
+#else
+  entry->timestamp = clock();
+  entry->id = id;
+#endif
+  entry->arg = arg;
+}
+
+uint32_t trace_ring_head(void) {
+  return __atomic_load_n(&trace_head, __ATOMIC_ACQUIRE);
+}
+
+bool trace_ring_read(uint32_t seq, trace_entry_t *entry) {
+  const uint32_t head = trace_ring_head();
+  if (head - seq > TRACE_RING_ENTRIES || seq == head)
+    return false;
+
+  *entry = trace_ring[seq & (TRACE_RING_ENTRIES - 1)];
+  return true;
+}
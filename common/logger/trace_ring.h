@@ -0,0 +1,105 @@
+/**
+ * @file    trace_ring.h
+ * @author  Cypherock X1 Team
+ * @brief   Always-on binary trace of the hot-path events.
+ * @copyright Copyright (c) 2023 HODL TECH PTE LTD
+ * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
+ * target=_blank>https://mitcc.org/</a>
+ */
+#ifndef TRACE_RING_H
+#define TRACE_RING_H
+
+/*****************************************************************************
+ * INCLUDES
+ *****************************************************************************/
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*****************************************************************************
+ * MACROS AND DEFINES
+ *****************************************************************************/
+
+/// Entries kept by the ring; the oldest entry is overwritten by a new one
+#define TRACE_RING_ENTRIES 128
+
+/// Set in trace_entry_t.id when the event was traced from an interrupt
+#define TRACE_FROM_ISR 0x8000
+
+/*****************************************************************************
+ * TYPEDEFS
+ *****************************************************************************/
+
+/**
+ * @brief Events traced by the ring, the argument is given for each event
+ */
+typedef enum {
+  TRACE_USB_RX_PACKET = 1,    ///< (sequence << 16) | (type << 8) | error
+  TRACE_USB_RX_OVERRUN,       ///< Overruns of the packet ring since boot
+  TRACE_NFC_EXCHANGE_BEGIN,   ///< Length of the command APDU
+  TRACE_NFC_EXCHANGE_END,     ///< ret_code_t of the exchange
+  TRACE_FLASH_PROGRAM_BEGIN,  ///< Flash address
+  TRACE_FLASH_PROGRAM_END,    ///< BSP_Status_t of the operation
+  TRACE_FLASH_ERASE_BEGIN,    ///< Flash address
+  TRACE_FLASH_ERASE_END,      ///< BSP_Status_t of the operation
+  TRACE_SCHED_DISPATCH,       ///< Slot of the task
+  TRACE_SCHED_RETURN,         ///< Whether the task has pending work
+  TRACE_BOOT_STAGE,           ///< boot_stage_e which just ended
+} trace_event_e;
+
+/**
+ * @brief An entry of the ring
+ */
+typedef struct trace_entry {
+  uint32_t timestamp;    ///< DWT cycles on the device, clock() on simulator
+  uint32_t arg;
+  uint16_t id;    ///< trace_event_e, with TRACE_FROM_ISR
+} trace_entry_t;
+
+/*****************************************************************************
+ * EXPORTED VARIABLES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * GLOBAL FUNCTION PROTOTYPES
+ *****************************************************************************/
+
+/**
+ * @brief Starts the cycle counter used for the timestamps
+ * @details Call once at boot. The counter wraps after 53 s at 80 MHz, the
+ * entries are ordered by their sequence number instead.
+ */
+void trace_ring_init(void);
+
+/**
+ * @brief Appends an event to the ring
+ * @details Safe to call from interrupt context; the slot is reserved with an
+ * atomic increment, so that nested writers never share an entry.
+ *
+ * @param id Event to trace
+ * @param arg Argument of the event
+ */
+void trace_event(trace_event_e id, uint32_t arg);
+
+/**
+ * @brief Returns the sequence number the next event will get, ie. the count
+ * of events traced since boot
+ */
+uint32_t trace_ring_head(void);
+
+/**
+ * @brief Reads the entry with the sequence number, if still in the ring
+ * @details The entries from trace_ring_head() - TRACE_RING_ENTRIES up to
+ * trace_ring_head() - 1 are available. An entry being overwritten while it is
+ * read may be torn; read again if the head moved past seq + TRACE_RING_ENTRIES
+ * meanwhile. With a debugger attached, the ring can also be read directly
+ * from the trace_ring and trace_head symbols.
+ *
+ * @param seq Sequence number of the entry
+ * @param entry Reference to the storage for the entry
+ *
+ * @return bool Indicating if the entry is still in the ring
+ */
+bool trace_ring_read(uint32_t seq, trace_entry_t *entry);
+
+#endif /* TRACE_RING_H */
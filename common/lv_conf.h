@@ -17,6 +17,8 @@
 
 #include <stdint.h>
 
+#include "capacity_config.h"
+
 /*====================
    Graphical settings
  *====================*/
@@ -55,8 +57,15 @@
 #define LV_ANTIALIAS        0
 
 /* Default display refresh period.
- * Can be changed in the display driver (`lv_disp_drv_t`).*/
+ * Can be changed in the display driver (`lv_disp_drv_t`).
+ * ui_task_handler() pauses the refresh while nothing is invalidated, so this
+ * only paces the frames of animations.*/
+#ifdef SIM_HEADLESS
+/* The headless simulator renders to memory at no cost, frames need not wait */
+#define LV_DISP_DEF_REFR_PERIOD      1       /*[ms]*/
+#else
 #define LV_DISP_DEF_REFR_PERIOD      30      /*[ms]*/
+#endif
 
 /* Dot Per Inch: used to initialize default sizes.
  * E.g. a button with width = LV_DPI / 2 -> half inch wide
@@ -82,7 +91,7 @@ typedef int16_t lv_coord_t;
 
 #if LV_MEM_CUSTOM == 0
 /* Size of the memory used by `lv_mem_alloc` in bytes (>= 2kB)*/
-#  define LV_MEM_SIZE    (6U * 1024U)
+#  define LV_MEM_SIZE    ((uint32_t)CAPACITY_UI_HEAP_SIZE)
 
 /* Complier prefix for a big array declaration */
 #  define LV_MEM_ATTR
@@ -212,10 +221,15 @@ typedef void * lv_img_decoder_user_data_t;
 
 /* 1: use a custom tick source.
  * It removes the need to manually update the tick with `lv_tick_inc`) */
+#ifdef SIM_HEADLESS
+/* The headless simulator runs LVGL on its virtual time */
+#define LV_TICK_CUSTOM     1
+#else
 #define LV_TICK_CUSTOM     0
+#endif
 #if LV_TICK_CUSTOM == 1
-#define LV_TICK_CUSTOM_INCLUDE  "something.h"       /*Header for the sys time function*/
-#define LV_TICK_CUSTOM_SYS_TIME_EXPR (millis())     /*Expression evaluating to current systime in ms*/
+#define LV_TICK_CUSTOM_INCLUDE  "sim_headless.h"       /*Header for the sys time function*/
+#define LV_TICK_CUSTOM_SYS_TIME_EXPR (sim_headless_tick_ms())     /*Expression evaluating to current systime in ms*/
 #endif   /*LV_TICK_CUSTOM*/
 
 typedef void * lv_disp_drv_user_data_t;             /*Type of user data in the display driver*/
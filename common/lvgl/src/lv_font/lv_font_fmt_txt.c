@@ -11,6 +11,7 @@
 #include "../lv_misc/lv_types.h"
 #include "../lv_misc/lv_log.h"
 #include "../lv_misc/lv_utils.h"
+#include <string.h>
 
 /*********************
  *      DEFINES
@@ -24,6 +25,8 @@
  *  STATIC PROTOTYPES
  **********************/
 static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter);
+static const uint8_t * decompress_glyph_1bpp(const uint8_t * code, uint32_t code_size,
+                                             const lv_font_fmt_txt_glyph_dsc_t * gdsc);
 static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t gid_right);
 static int32_t unicode_list_compare(const void * ref, const void * element);
 static int32_t kern_pair_8_compare(const void * ref, const void * element);
@@ -32,6 +35,8 @@ static int32_t kern_pair_16_compare(const void * ref, const void * element);
 /**********************
  *  STATIC VARIABLES
  **********************/
+/*The last decompressed glyph; drawn before the next one is fetched*/
+static uint8_t glyph_bitmap_buf[LV_FONT_FMT_TXT_RLE_BITMAP_MAX];
 
 /**********************
  * GLOBAL PROTOTYPES
@@ -58,8 +63,15 @@ const uint8_t * lv_font_get_bitmap_fmt_txt(const lv_font_t * font, uint32_t unic
     if(!gid) return false;
 
     const lv_font_fmt_txt_glyph_dsc_t * gdsc = &fdsc->glyph_dsc[gid];
+    const uint8_t * bitmap = &fdsc->glyph_bitmap[gdsc->bitmap_index];
 
-    if(gdsc) return &fdsc->glyph_bitmap[gdsc->bitmap_index];
+    if(fdsc->bitmap_format == LV_FONT_FMT_TXT_COMPRESSED && fdsc->bpp == 1) {
+        /*Compressed fonts end with an extra glyph dsc marking the end of the last glyph*/
+        uint32_t code_size = gdsc[1].bitmap_index - gdsc->bitmap_index;
+        return decompress_glyph_1bpp(bitmap, code_size, gdsc);
+    }
+
+    if(gdsc) return bitmap;
 
     /*If not returned earlier then the letter is not found in this font*/
     return NULL;
@@ -107,6 +119,52 @@ bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t *
  *   STATIC FUNCTIONS
  **********************/
 
+/**
+ * Decode a glyph of a 1 bpp font compressed by `utilities/fonts/compress-font.py`.
+ * The code is a list of 2 bit runs: 0..2 zeros followed by a one, or 3 zeros. The
+ * decoded bits are the XOR of every row of the glyph with the row above it.
+ * @param code the compressed glyph
+ * @param code_size size of the compressed glyph in bytes
+ * @param gdsc descriptor of the glyph
+ * @return pointer to the plain bitmap of the glyph, valid until the next call
+ */
+static const uint8_t * decompress_glyph_1bpp(const uint8_t * code, uint32_t code_size,
+                                             const lv_font_fmt_txt_glyph_dsc_t * gdsc)
+{
+    uint32_t bit_num = (uint32_t)gdsc->box_w * gdsc->box_h;
+    uint32_t byte_num = (bit_num + 7) >> 3;
+
+    if(byte_num > LV_FONT_FMT_TXT_RLE_BITMAP_MAX) return NULL;
+
+    /*Glyphs which did not get smaller are stored plain*/
+    if(code_size == byte_num) return code;
+
+    memset(glyph_bitmap_buf, 0, byte_num);
+
+    uint32_t pos = 0;
+    uint32_t i;
+    for(i = 0; i < code_size && pos < bit_num; i++) {
+        int8_t shift;
+        for(shift = 6; shift >= 0; shift -= 2) {
+            uint8_t run = (code[i] >> shift) & 0x3;
+            pos += run;
+            if(run == 3) continue;
+            if(pos < bit_num) glyph_bitmap_buf[pos >> 3] |= 0x80 >> (pos & 0x7);
+            pos++;
+        }
+    }
+
+    /*Undo the XOR with the row above*/
+    for(pos = gdsc->box_w; pos < bit_num; pos++) {
+        uint32_t above = pos - gdsc->box_w;
+        if(glyph_bitmap_buf[above >> 3] & (0x80 >> (above & 0x7))) {
+            glyph_bitmap_buf[pos >> 3] ^= 0x80 >> (pos & 0x7);
+        }
+    }
+
+    return glyph_bitmap_buf;
+}
+
 static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter)
 {
     if(letter == '\0') return 0;
@@ -27,6 +27,9 @@ extern "C" {
 /*********************
  *      DEFINES
  *********************/
+/*Largest glyph (in bytes of plain bitmap) of a compressed 1 bpp font.
+ *Must match BITMAP_MAX of utilities/fonts/compress-font.py*/
+#define LV_FONT_FMT_TXT_RLE_BITMAP_MAX  32
 
 /**********************
  *      TYPEDEFS
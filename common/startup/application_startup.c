@@ -69,20 +69,27 @@
  */
 #include "application_startup.h"
 
+#include "boot_profile.h"
+#include "clock_policy.h"
 #include "core_error.h"
 #include "core_flow_init.h"
 #include "cryptoauthlib.h"
 #include "device_authentication_api.h"
 #include "flash_api.h"
 #include "flash_if.h"
+#include "fw_hash.h"
 #include "logger.h"
 #include "lv_port_disp.h"
 #include "lv_port_indev.h"
+#include "mem_diag.h"
+#include "memzero.h"
 #include "nfc.h"
 #include "pow.h"
 #include "sec_flash.h"
 #include "sys_state.h"
 #include "systick_timer.h"
+#include "task_scheduler.h"
+#include "trace_ring.h"
 #include "ui_screens.h"
 
 #ifdef DEV_BUILD
@@ -102,13 +109,17 @@
 #include "lv_drv_conf.h"
 #include "lv_port_disp.h"
 #include "lv_port_indev.h"
+#include "sim_headless.h"
 #include "sim_usb.h"
+#include "sim_usb_session.h"
 #include "time.h"
 
 static void sim_hal_init(void);
+#ifndef SIM_HEADLESS
 static int tick_thread(void *data);
 static void memory_monitor(lv_task_t *param);
 #endif
+#endif
 
 extern lv_task_t *listener_task;
 extern lv_task_t *timeout_task;
@@ -118,6 +129,36 @@ extern const char *GIT_REV;
 extern const char *GIT_TAG;
 extern const char *GIT_BRANCH;
 
+/// Slice given to the deferred bring-up of the PN532
+#define NFC_BRINGUP_SLICE_MS 50
+
+/// Slice given to the deferred wallet and boot count checks
+#define STARTUP_CHECKS_SLICE_MS 20
+
+/**
+ * @brief Findings of the wallet checks, per wallet
+ */
+typedef enum {
+  WALLET_FINDING_PARTIAL = 1 << 0,      ///< Partial delete state
+  WALLET_FINDING_UNVERIFIED = 1 << 1,   ///< Unverified state
+  WALLET_FINDING_OUT_OF_SYNC = 1 << 2,  ///< Share not present on the cards
+  WALLET_FINDING_LOCKED = 1 << 3,       ///< Locked state
+  WALLET_FINDING_INVALID = 1 << 4,      ///< Invalid wallet
+} wallet_finding_e;
+
+/**
+ * @brief Result of the last scan by startup_checks_task()
+ */
+typedef struct {
+  bool ready;    ///< Scan done and its findings not shown yet
+  bool boot_count_checked;
+  bool check_cards_reminder;
+  uint8_t paired_card_count;
+  uint8_t wallet_findings[MAX_WALLETS_ALLOWED];
+} startup_checks_t;
+
+static startup_checks_t startup_checks = {0};
+
 /**
  * @brief
  * @details
@@ -137,6 +178,7 @@ static void clock_init(void) {
   HAL_Init();
 #endif
   SystemClock_Config();
+  clock_policy_init();
 }
 
 void reset_inactivity_timer() {
@@ -165,6 +207,69 @@ static void create_timers() {
   BSP_App_Timer_Create(BSP_APPLICATION_TIMER, systick_interrupt_cb);
 }
 
+#if USE_SIMULATOR == 0
+/**
+ * @brief One-shot background task bringing up the PN532 in the first idle
+ * time after boot
+ * @details The PN532 is only needed by card flows, which bring it up
+ * themselves through nfc_init() if they run before this task.
+ *
+ * @param budget_ms Unused, the bring-up is not split
+ * @return false Always, the task removes itself
+ */
+static bool nfc_bringup_task(uint32_t budget_ms) {
+  sched_remove_task(nfc_bringup_task);
+  nfc_init();
+  return false;
+}
+#endif
+
+/**
+ * @brief One-shot background task scanning the wallets and the boot count
+ * for the findings shown by show_startup_check_findings()
+ * @details The scan only reads the RAM copy of the flash; the screens, which
+ * block for DELAY_TIME each, are left to the main menu.
+ *
+ * @param budget_ms Unused, the scan is not split
+ * @return false Always, the task removes itself
+ */
+static bool startup_checks_task(uint32_t budget_ms) {
+  sched_remove_task(startup_checks_task);
+
+  memzero(startup_checks.wallet_findings,
+          sizeof(startup_checks.wallet_findings));
+  startup_checks.paired_card_count = get_keystore_used_count();
+
+  for (uint8_t i = 0; i < MAX_WALLETS_ALLOWED; i++) {
+    const wallet_state state = get_wallet_state(i);
+    if (state != VALID_WALLET && state != INVALID_WALLET &&
+        state != UNVERIFIED_VALID_WALLET &&
+        state != VALID_WALLET_WITHOUT_DEVICE_SHARE)
+      continue;
+
+    uint8_t findings = 0;
+    if (get_wallet_card_state(i) != 0xff && is_wallet_partial(i))
+      findings |= WALLET_FINDING_PARTIAL;
+    if (is_wallet_unverified(i))
+      findings |= WALLET_FINDING_UNVERIFIED;
+    if (is_wallet_share_not_present(i))
+      findings |= WALLET_FINDING_OUT_OF_SYNC;
+    if (is_wallet_locked(i))
+      findings |= WALLET_FINDING_LOCKED;
+    if (state == INVALID_WALLET)
+      findings |= WALLET_FINDING_INVALID;
+    startup_checks.wallet_findings[i] = findings;
+  }
+
+  if (!startup_checks.boot_count_checked) {
+    startup_checks.boot_count_checked = true;
+    startup_checks.check_cards_reminder = (get_boot_count() % 20 == 0);
+  }
+
+  startup_checks.ready = true;
+  return false;
+}
+
 /**
  * @brief Initializes the display, lvgl library and lvgl port
  * @details
@@ -254,48 +359,61 @@ static void atecc_mode_detect() {
 }
 
 void application_init() {
+  mem_diag_init();
+  trace_ring_init();
+  boot_profile_start();
   sys_flow_cntrl_u.bits.usb_buffer_free = true;
   sys_flow_cntrl_u.bits.nfc_off = true;
   CY_Reset_Not_Allow(false);
   mark_device_state(CY_APP_DEVICE_TASK | CY_APP_BUSY, 0xFF);
 #if USE_SIMULATOR == 0
-  uint32_t ret;
   clock_init();
+  boot_profile_mark(BOOT_STAGE_CLOCK);
 
   // Peripherals initialize
   comm_init();
   BSP_USB_Clock_Init();
   BSP_GPIO_Init(FW_get_hardware_version());
+#if X1WALLET_MAIN
+  // Enumerate first, so that the host sees the device while the rest boots;
+  // its requests wait in the packet ring until the first flow runs
+  libusb_init();
+#endif
   BSP_TIM2_Init();
   BSP_TIM3_Init();
   BSP_TIM6_Init();
   BSP_I2C1_Init();
   BSP_RNG_Init();
+  boot_profile_mark(BOOT_STAGE_PERIPHERALS);
   atecc_mode_detect();
-#if X1WALLET_MAIN
-  libusb_init();
-#endif
+  boot_profile_mark(BOOT_STAGE_ATECC);
   // Timer3 interrupt
   BSP_TIM3_Base_Start_IT();
   BSP_App_Timer_Init();
 
   create_timers();
   BSP_App_Timer_Start(BSP_APPLICATION_TIMER, POLLING_TIME);
+  boot_profile_mark(BOOT_STAGE_TIMERS);
 
-  ret = adafruit_pn532_init(false);
-  uint32_t response;
-  ret = adafruit_pn532_firmware_version_get(&response);
+  if (!sched_add_task(
+          nfc_bringup_task, SCHED_PRIO_LOW, NFC_BRINGUP_SLICE_MS)) {
+    nfc_init();
+  }
+  boot_profile_mark(BOOT_STAGE_NFC);
 
   display_init();
   if (get_display_rotation() == LEFT_HAND_VIEW) {
     ui_rotate();
   }
+  boot_profile_mark(BOOT_STAGE_DISPLAY);
   logger_init();
+  boot_profile_mark(BOOT_STAGE_LOGGER);
 #else
   srand(time(0));
   /*Initialize LittlevGL*/
   lv_init();
   sim_hal_init();
+  sim_usb_session_wrap_keypad(indev_keypad);
   lv_port_disp_init();
   ui_init(indev_keypad);
 
@@ -304,6 +422,7 @@ void application_init() {
   ui_set_list_choice_cb(&mark_list_choice);
 
   SIM_USB_DEVICE_Init();
+  boot_profile_mark(BOOT_STAGE_PERIPHERALS);
 #endif
   set_wallet_init();
   reset_flow_level();
@@ -312,7 +431,9 @@ void application_init() {
 
 #endif
   nfc_set_device_key_id(get_perm_self_key_id());
+  boot_profile_mark(BOOT_STAGE_FLASH);
   pow_init_hash_rate();
+  boot_profile_mark(BOOT_STAGE_POW);
   if (get_first_boot_on_update() == true) {
     logger("%X-%s", get_fwVer(), GIT_REV);
     set_auth_state(get_auth_state());
@@ -323,12 +444,36 @@ void application_init() {
 #endif
 #endif
   core_init_app_registry();
+  boot_profile_mark(BOOT_STAGE_APP_REGISTRY);
+#if (FIRMWARE_HASH_CALC == 1)
+  fw_hash_start();
+#endif
+}
+
+void schedule_startup_checks() {
+  startup_checks.ready = false;
+  if (!sched_add_task(
+          startup_checks_task, SCHED_PRIO_LOW, STARTUP_CHECKS_SLICE_MS)) {
+    // No free slot, scan right away so that the checks are not dropped
+    startup_checks_task(STARTUP_CHECKS_SLICE_MS);
+  }
 }
 
-void check_invalid_wallets() {
+bool show_startup_check_findings() {
+  if (!startup_checks.ready) {
+    return false;
+  }
+  startup_checks.ready = false;
+
+  bool shown = check_invalid_wallets();
+  shown |= check_boot_count();
+  return shown;
+}
+
+bool check_invalid_wallets() {
   bool fix = false;
   char display[64];
-  uint8_t paired_card_count = get_keystore_used_count();
+  uint8_t paired_card_count = startup_checks.paired_card_count;
 
   if (paired_card_count < MAX_KEYSTORE_ENTRY) {
     char msg[64] = {0};
@@ -339,17 +484,13 @@ void check_invalid_wallets() {
     delay_scr_init(paired_card_count == 0 ? ui_text_error_no_card_paired : msg,
                    DELAY_TIME);
     mark_core_error_screen(ui_text_card_pairing_warning, false);
-    return;
+    return true;
   }
 
   for (uint8_t i = 0; i < MAX_WALLETS_ALLOWED; i++) {
-    if (get_wallet_state(i) != VALID_WALLET &&
-        get_wallet_state(i) != INVALID_WALLET &&
-        get_wallet_state(i) != UNVERIFIED_VALID_WALLET &&
-        get_wallet_state(i) != VALID_WALLET_WITHOUT_DEVICE_SHARE)
-      continue;
+    const uint8_t findings = startup_checks.wallet_findings[i];
 
-    if (get_wallet_card_state(i) != 0xff && is_wallet_partial(i)) {
+    if (findings & WALLET_FINDING_PARTIAL) {
       snprintf(display,
                sizeof(display),
                "'%s' is in partial delete state",
@@ -357,7 +498,7 @@ void check_invalid_wallets() {
       delay_scr_init(display, DELAY_TIME);
       fix = true;
     }
-    if (is_wallet_unverified(i)) {
+    if (findings & WALLET_FINDING_UNVERIFIED) {
       snprintf(display,
                sizeof(display),
                "'%s' is in unverified state",
@@ -365,7 +506,7 @@ void check_invalid_wallets() {
       delay_scr_init(display, DELAY_TIME);
       fix = true;
     }
-    if (is_wallet_share_not_present(i)) {
+    if (findings & WALLET_FINDING_OUT_OF_SYNC) {
       snprintf(display,
                sizeof(display),
                "'%s' is out of Sync with cards",
@@ -373,7 +514,7 @@ void check_invalid_wallets() {
       delay_scr_init(display, DELAY_TIME);
       fix = true;
     }
-    if (is_wallet_locked(i)) {
+    if (findings & WALLET_FINDING_LOCKED) {
       snprintf(display,
                sizeof(display),
                "'%s' is in locked state",
@@ -381,7 +522,7 @@ void check_invalid_wallets() {
       delay_scr_init(display, DELAY_TIME);
       fix = true;
     }
-    if (get_wallet_state(i) == INVALID_WALLET) {
+    if (findings & WALLET_FINDING_INVALID) {
       snprintf(display, sizeof(display), "'%s' is invalid", get_wallet_name(i));
       delay_scr_init(display, DELAY_TIME);
       fix = true;
@@ -389,12 +530,16 @@ void check_invalid_wallets() {
   }
   if (fix)
     mark_core_error_screen(ui_text_wallet_visit_to_verify, false);
+  return fix;
 }
 
-void check_boot_count() {
-  if (get_boot_count() % 20 == 0) {
-    delay_scr_init(ui_text_its_a_while_check_your_cards, DELAY_TIME);
+bool check_boot_count() {
+  if (!startup_checks.check_cards_reminder) {
+    return false;
   }
+  startup_checks.check_cards_reminder = false;
+  delay_scr_init(ui_text_its_a_while_check_your_cards, DELAY_TIME);
+  return true;
 }
 
 void log_error_handler_faults() {
@@ -462,7 +607,8 @@ uint32_t get_device_serial() {
 
   NVIC_DisableIRQ(OTG_FS_IRQn);
   do {
-    atecc_data.status = atcab_init(atecc_data.cfg_atecc608a_iface);
+    if ((atecc_data.status = atecc_session_begin()) != ATCA_SUCCESS)
+      continue;
     atecc_data.status = atcab_read_zone(ATCA_ZONE_DATA,
                                         slot_8_serial,
                                         0,
@@ -491,7 +637,8 @@ provision_status_t check_provision_status() {
   bool usb_irq_enable_on_entry = NVIC_GetEnableIRQ(OTG_FS_IRQn);
   NVIC_DisableIRQ(OTG_FS_IRQn);
   do {
-    atecc_data.status = atcab_init(atecc_data.cfg_atecc608a_iface);
+    if ((atecc_data.status = atecc_session_begin()) != ATCA_SUCCESS)
+      continue;
     atecc_data.status = atcab_read_config_zone(cfg);
   } while (atecc_data.status != ATCA_SUCCESS && --atecc_data.retries);
   if (usb_irq_enable_on_entry == true)
@@ -564,6 +711,10 @@ void device_provision_check() {
  * library
  */
 static void sim_hal_init(void) {
+#ifdef SIM_HEADLESS
+  // no window nor tick thread, LVGL runs on the virtual time of the simulator
+  indev_keypad = sim_headless_init();
+#else
   /* Use the 'monitor' driver which creates window on PC's monitor to simulate a
    * display*/
   monitor_init();
@@ -619,8 +770,11 @@ static void sim_hal_init(void) {
    * Create a memory monitor task which prints the memory usage in
    * periodically.*/
   lv_task_create(memory_monitor, 3000, LV_TASK_PRIO_MID, NULL);
+#endif /* SIM_HEADLESS */
 }
 
+#ifndef SIM_HEADLESS
+
 /**
  * A task to measure the elapsed time for LittlevGL
  * @param data unused
@@ -652,5 +806,6 @@ static void memory_monitor(lv_task_t *param) {
          mon.frag_pct,
          (int)mon.free_biggest_size);
 }
+#endif /* SIM_HEADLESS */
 
 #endif
@@ -86,16 +86,37 @@ extern bool main_app_ready;
  */
 void application_init();
 
+/**
+ * @brief Schedules the wallet and boot count checks in the idle time
+ * @details The scan runs as a one-shot background task once the main menu is
+ * up, instead of delaying it; its findings are shown by
+ * show_startup_check_findings(). The boot count is only checked by the first
+ * scan after boot.
+ */
+void schedule_startup_checks();
+
+/**
+ * @brief Shows the findings of the last scan scheduled by
+ * schedule_startup_checks(), once
+ * @details Call before rendering the main menu.
+ *
+ * @return true If screens were shown over the main menu, which then needs to be
+ * rendered again
+ * @return false If the scan is not done yet or its findings were shown already
+ */
+bool show_startup_check_findings();
+
 /**
  * @brief This function should be called to check for unverified / partial /
  * locked state of any wallet.
  *
- * It shows a delay screen before the main menu for each state of each wallet.
+ * It shows a delay screen for each state of each wallet found by the last
+ * scan, see show_startup_check_findings().
  * @details
  *
  * @param
  *
- * @return
+ * @return true If any screen was shown
  * @retval
  *
  * @see
@@ -103,7 +124,7 @@ void application_init();
  *
  * @note
  */
-void check_invalid_wallets();
+bool check_invalid_wallets();
 
 /**
  * @brief This function should be called to check the boot count to display
@@ -111,11 +132,12 @@ void check_invalid_wallets();
  *
  * @details It checks if the number of time the device has been booted is 20 or
  * not. On 20 boots, this functions shows a delay screen with a message to check
- * the proper working of their cards
+ * the proper working of their cards. The count is read by the first scan after
+ * boot, see show_startup_check_findings().
  *
  * @param
  *
- * @return
+ * @return true If the screen was shown
  * @retval
  *
  * @see
@@ -123,7 +145,7 @@ void check_invalid_wallets();
  *
  * @note
  */
-void check_boot_count();
+bool check_boot_count();
 
 /**
  * @brief Resets inactivity timer. It is expected that this function is called
@@ -0,0 +1,215 @@
+/**
+ * @file    boot_profile.c
+ * @author  Cypherock X1 Team
+ * @brief   Duration of each stage of the boot, up to the first user flow.
+ * @copyright Copyright (c) 2023 HODL TECH PTE LTD
+ * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
+ *target=_blank>https://mitcc.org/</a>
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * (c) Copyright 2023 by HODL TECH PTE LTD
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * "Commons Clause" License Condition v1.0
+ *
+ * The Software is provided to you by the Licensor under the License,
+ * as defined below, subject to the following condition.
+ *
+ * Without limiting other conditions in the License, the grant of
+ * rights under the License will not include, and the License does not
+ * grant to you, the right to Sell the Software.
+ *
+ * For purposes of the foregoing, "Sell" means practicing any or all
+ * of the rights granted to you under the License to provide to third
+ * parties, for a fee or other consideration (including without
+ * limitation fees for hosting or consulting/ support services related
+ * to the Software), a product or service whose value derives, entirely
+ * or substantially, from the functionality of the Software. Any license
+ * notice or attribution required by the License must also include
+ * this Commons Clause License Condition notice.
+ *
+ * Software: All X1Wallet associated files.
+ * License: MIT
+ * Licensor: HODL TECH PTE LTD
+ *
+ ******************************************************************************
+ */
+
+/*****************************************************************************
+ * INCLUDES
+ *****************************************************************************/
+#include "boot_profile.h"
+
+#include "board.h"
+#include "logger.h"
+#include "trace_ring.h"
+
+#if USE_SIMULATOR == 1
+#include <time.h>
+#endif
+
+/*****************************************************************************
+ * EXTERN VARIABLES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * PRIVATE MACROS AND DEFINES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * PRIVATE TYPEDEFS
+ *****************************************************************************/
+
+/*****************************************************************************
+ * STATIC FUNCTION PROTOTYPES
+ *****************************************************************************/
+
+/**
+ * @brief Returns the time elapsed since the previous mark and starts the next
+ * interval
+ *
+ * @return uint32_t Duration in microseconds
+ */
+static uint32_t lap_us(void);
+
+/*****************************************************************************
+ * STATIC VARIABLES
+ *****************************************************************************/
+
+static const char *const stage_names[BOOT_STAGES] = {
+    [BOOT_STAGE_CLOCK] = "clock",
+    [BOOT_STAGE_PERIPHERALS] = "peripherals",
+    [BOOT_STAGE_ATECC] = "atecc",
+    [BOOT_STAGE_TIMERS] = "timers",
+    [BOOT_STAGE_NFC] = "nfc",
+    [BOOT_STAGE_DISPLAY] = "display",
+    [BOOT_STAGE_LOGGER] = "logger",
+    [BOOT_STAGE_FLASH] = "flash",
+    [BOOT_STAGE_POW] = "pow",
+    [BOOT_STAGE_APP_REGISTRY] = "app_registry",
+    [BOOT_STAGE_SPLASH] = "splash",
+    [BOOT_STAGE_FLOW_INIT] = "flow_init",
+};
+
+static uint32_t stage_us[BOOT_STAGES];
+static uint32_t total_us = 0;
+static bool ready = false;
+static bool reported = false;
+
+#if USE_SIMULATOR == 0
+static uint32_t lap_cycles;
+// clock_init() changes the core clock, every interval is converted with the
+// frequency it started with
+static uint32_t lap_hz;
+#else
+static struct timespec lap_time;
+#endif
+
+/*****************************************************************************
+ * GLOBAL VARIABLES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * STATIC FUNCTIONS
+ *****************************************************************************/
+
+#if USE_SIMULATOR == 0
+static uint32_t lap_us(void) {
+  const uint32_t now = DWT->CYCCNT;
+  const uint32_t us =
+      (uint32_t)(((uint64_t)(now - lap_cycles) * 1000000) / lap_hz);
+
+  lap_cycles = now;
+  lap_hz = SystemCoreClock;
+  return us;
+}
+#else
+static uint32_t lap_us(void) {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  const int64_t ns = (int64_t)(now.tv_sec - lap_time.tv_sec) * 1000000000 +
+                     (now.tv_nsec - lap_time.tv_nsec);
+
+  lap_time = now;
+  return (uint32_t)(ns / 1000);
+}
+#endif
+
+/*****************************************************************************
+ * GLOBAL FUNCTIONS
+ *****************************************************************************/
+
+void boot_profile_start(void) {
+#if USE_SIMULATOR == 0
+  // the cycle counter is started by trace_ring_init()
+  lap_cycles = DWT->CYCCNT;
+  lap_hz = SystemCoreClock;
+#else
+  clock_gettime(CLOCK_MONOTONIC, &lap_time);
+#endif
+}
+
+void boot_profile_mark(boot_stage_e stage) {
+  if (ready || BOOT_STAGES <= stage) {
+    return;
+  }
+
+  const uint32_t us = lap_us();
+  stage_us[stage] += us;
+  total_us += us;
+  trace_event(TRACE_BOOT_STAGE, stage);
+  ready = (BOOT_STAGE_FLOW_INIT == stage);
+}
+
+uint32_t boot_profile_get(boot_stage_e stage) {
+  if (BOOT_STAGES <= stage) {
+    return 0;
+  }
+  return stage_us[stage];
+}
+
+uint32_t boot_profile_total(void) {
+  return total_us;
+}
+
+bool boot_profile_is_ready(void) {
+  return ready;
+}
+
+void boot_profile_log_report(void) {
+  if (!ready || reported) {
+    return;
+  }
+
+  reported = true;
+  LOG_CRITICAL("boot: total %lu us", (unsigned long)total_us);
+  for (uint8_t stage = 0; stage < BOOT_STAGES; stage++) {
+    if (0 == stage_us[stage]) {
+      continue;
+    }
+    LOG_CRITICAL("boot: %s %lu us",
+                 stage_names[stage],
+                 (unsigned long)stage_us[stage]);
+  }
+}
@@ -0,0 +1,101 @@
+/**
+ * @file    boot_profile.h
+ * @author  Cypherock X1 Team
+ * @brief   Duration of each stage of the boot, up to the first user flow.
+ * @copyright Copyright (c) 2023 HODL TECH PTE LTD
+ * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
+ * target=_blank>https://mitcc.org/</a>
+ */
+#ifndef BOOT_PROFILE_H
+#define BOOT_PROFILE_H
+
+/*****************************************************************************
+ * INCLUDES
+ *****************************************************************************/
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*****************************************************************************
+ * MACROS AND DEFINES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * TYPEDEFS
+ *****************************************************************************/
+
+/**
+ * @brief Stages of the boot, in the order they run. A stage lasts from the
+ * end of the previous mark up to its own boot_profile_mark().
+ */
+typedef enum {
+  BOOT_STAGE_CLOCK = 0,     ///< clock_init()
+  BOOT_STAGE_PERIPHERALS,   ///< BSP drivers and USB; LVGL & SDL on simulator
+  BOOT_STAGE_ATECC,         ///< atecc_mode_detect()
+  BOOT_STAGE_TIMERS,        ///< Application timers
+  BOOT_STAGE_NFC,           ///< PN532 bring-up, deferred to the first idle
+  BOOT_STAGE_DISPLAY,       ///< display_init() and rotation
+  BOOT_STAGE_LOGGER,        ///< logger_init()
+  BOOT_STAGE_FLASH,         ///< Wallets and keys loaded from the flash
+  BOOT_STAGE_POW,           ///< pow_init_hash_rate()
+  BOOT_STAGE_APP_REGISTRY,  ///< core_init_app_registry()
+  BOOT_STAGE_SPLASH,        ///< Logo screen and provisioning check
+  BOOT_STAGE_FLOW_INIT,     ///< First core flow, wallet checks deferred
+  BOOT_STAGES,
+} boot_stage_e;
+
+/*****************************************************************************
+ * EXPORTED VARIABLES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * GLOBAL FUNCTION PROTOTYPES
+ *****************************************************************************/
+
+/**
+ * @brief Starts the profile; call first thing in application_init(), after
+ * trace_ring_init()
+ * @details The time spent before application_init() (reset handler, HAL and
+ * system init) is not measured.
+ */
+void boot_profile_start(void);
+
+/**
+ * @brief Ends the stage and starts the next one
+ * @details The duration is kept and the mark is traced as TRACE_BOOT_STAGE.
+ * Marks after BOOT_STAGE_FLOW_INIT, ie. once the device is ready, are
+ * ignored; stages the boot skipped keep a duration of 0.
+ *
+ * @param stage Stage which just ended
+ */
+void boot_profile_mark(boot_stage_e stage);
+
+/**
+ * @brief Returns the duration of the stage
+ *
+ * @param stage Stage to read
+ *
+ * @return uint32_t Duration in microseconds, 0 if the stage did not run
+ */
+uint32_t boot_profile_get(boot_stage_e stage);
+
+/**
+ * @brief Returns the time from boot_profile_start() to the last mark
+ *
+ * @return uint32_t Time to ready in microseconds
+ */
+uint32_t boot_profile_total(void);
+
+/**
+ * @brief Tells if the boot reached BOOT_STAGE_FLOW_INIT
+ */
+bool boot_profile_is_ready(void);
+
+/**
+ * @brief Writes the duration of every stage to the device logs, once per boot
+ * @details Only the first call after the device is ready writes, so that
+ * calling it on every host connection does not fill the logs.
+ */
+void boot_profile_log_report(void);
+
+#endif /* BOOT_PROFILE_H */
@@ -0,0 +1,210 @@
+/**
+ * @file    clock_policy.c
+ * @author  Cypherock X1 Team
+ * @brief   Scaling of the core clock between compute and idle.
+ * @copyright Copyright (c) 2023 HODL TECH PTE LTD
+ * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
+ *target=_blank>https://mitcc.org/</a>
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * (c) Copyright 2023 by HODL TECH PTE LTD
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * "Commons Clause" License Condition v1.0
+ *
+ * The Software is provided to you by the Licensor under the License,
+ * as defined below, subject to the following condition.
+ *
+ * Without limiting other conditions in the License, the grant of
+ * rights under the License will not include, and the License does not
+ * grant to you, the right to Sell the Software.
+ *
+ * For purposes of the foregoing, "Sell" means practicing any or all
+ * of the rights granted to you under the License to provide to third
+ * parties, for a fee or other consideration (including without
+ * limitation fees for hosting or consulting/ support services related
+ * to the Software), a product or service whose value derives, entirely
+ * or substantially, from the functionality of the Software. Any license
+ * notice or attribution required by the License must also include
+ * this Commons Clause License Condition notice.
+ *
+ * Software: All X1Wallet associated files.
+ * License: MIT
+ * Licensor: HODL TECH PTE LTD
+ *
+ ******************************************************************************
+ */
+
+/*****************************************************************************
+ * INCLUDES
+ *****************************************************************************/
+#include "clock_policy.h"
+
+#include "board.h"
+
+/*****************************************************************************
+ * EXTERN VARIABLES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * PRIVATE MACROS AND DEFINES
+ *****************************************************************************/
+
+/// Number of prescaler values in the tables below
+#define PRESCALER_COUNT 5
+
+/*****************************************************************************
+ * PRIVATE TYPEDEFS
+ *****************************************************************************/
+
+/*****************************************************************************
+ * STATIC FUNCTION PROTOTYPES
+ *****************************************************************************/
+
+#if USE_SIMULATOR == 0
+/**
+ * @brief Returns the position of the prescaler in the table, ie. the power of
+ * two it divides by
+ *
+ * @param table AHB or APB prescalers, in increasing order
+ * @param prescaler Prescaler to look up
+ *
+ * @return int8_t Position of the prescaler, -1 if it is not in the table
+ */
+static int8_t prescaler_shift(const uint32_t *table, uint32_t prescaler);
+#endif
+
+/*****************************************************************************
+ * STATIC VARIABLES
+ *****************************************************************************/
+
+static clock_level_e current_level = CLOCK_LEVEL_RUN;
+
+#if USE_SIMULATOR == 0
+static const uint32_t ahb_prescalers[PRESCALER_COUNT] = {RCC_SYSCLK_DIV1,
+                                                         RCC_SYSCLK_DIV2,
+                                                         RCC_SYSCLK_DIV4,
+                                                         RCC_SYSCLK_DIV8,
+                                                         RCC_SYSCLK_DIV16};
+static const uint32_t apb_prescalers[PRESCALER_COUNT] = {RCC_HCLK_DIV1,
+                                                         RCC_HCLK_DIV2,
+                                                         RCC_HCLK_DIV4,
+                                                         RCC_HCLK_DIV8,
+                                                         RCC_HCLK_DIV16};
+
+static RCC_ClkInitTypeDef level_config[2];
+static uint32_t flash_latency;
+static uint32_t run_hz;
+static bool idle_supported = false;
+#endif
+
+/*****************************************************************************
+ * GLOBAL VARIABLES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * STATIC FUNCTIONS
+ *****************************************************************************/
+
+#if USE_SIMULATOR == 0
+static int8_t prescaler_shift(const uint32_t *table, uint32_t prescaler) {
+  for (int8_t shift = 0; shift < PRESCALER_COUNT; shift++) {
+    if (table[shift] == prescaler) {
+      return shift;
+    }
+  }
+  return -1;
+}
+#endif
+
+/*****************************************************************************
+ * GLOBAL FUNCTIONS
+ *****************************************************************************/
+
+void clock_policy_init(void) {
+  current_level = CLOCK_LEVEL_RUN;
+#if USE_SIMULATOR == 0
+  RCC_ClkInitTypeDef *run = &level_config[CLOCK_LEVEL_RUN];
+  RCC_ClkInitTypeDef *idle = &level_config[CLOCK_LEVEL_IDLE];
+
+  HAL_RCC_GetClockConfig(run, &flash_latency);
+  // the SYSCLK source is left alone, hence the PLLs too
+  run->ClockType = RCC_CLOCKTYPE_HCLK | RCC_CLOCKTYPE_PCLK1 |
+                   RCC_CLOCKTYPE_PCLK2;
+  run_hz = SystemCoreClock;
+  *idle = *run;
+  idle_supported = false;
+
+  const int8_t ahb = prescaler_shift(ahb_prescalers, run->AHBCLKDivider);
+  const int8_t apb1 = prescaler_shift(apb_prescalers, run->APB1CLKDivider);
+  const int8_t apb2 = prescaler_shift(apb_prescalers, run->APB2CLKDivider);
+  if (0 > ahb || 0 > apb1 || 0 > apb2) {
+    return;
+  }
+
+  // an APB prescaler of 1 halves the timer clocks, so neither may reach it
+  int8_t shift = CLOCK_POLICY_MAX_IDLE_SHIFT;
+  while (0 < shift &&
+         (PRESCALER_COUNT <= ahb + shift || apb1 - shift < 1 ||
+          apb2 - shift < 1 || (run_hz >> shift) < CLOCK_POLICY_MIN_HCLK_HZ)) {
+    shift--;
+  }
+  if (0 == shift) {
+    return;
+  }
+
+  idle->AHBCLKDivider = ahb_prescalers[ahb + shift];
+  idle->APB1CLKDivider = apb_prescalers[apb1 - shift];
+  idle->APB2CLKDivider = apb_prescalers[apb2 - shift];
+  idle_supported = true;
+#endif
+}
+
+void clock_policy_set(clock_level_e level) {
+  if (level == current_level) {
+    return;
+  }
+#if USE_SIMULATOR == 0
+  if (!idle_supported) {
+    return;
+  }
+  // the run latency suits both levels, HAL re-arms the tick for the new HCLK
+  if (HAL_OK != HAL_RCC_ClockConfig(&level_config[level], flash_latency)) {
+    return;
+  }
+#endif
+  current_level = level;
+}
+
+clock_level_e clock_policy_get(void) {
+  return current_level;
+}
+
+uint32_t clock_policy_run_hz(void) {
+#if USE_SIMULATOR == 0
+  return run_hz;
+#else
+  return 0;
+#endif
+}
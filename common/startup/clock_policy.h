@@ -0,0 +1,83 @@
+/**
+ * @file    clock_policy.h
+ * @author  Cypherock X1 Team
+ * @brief   Scaling of the core clock between compute and idle.
+ * @copyright Copyright (c) 2023 HODL TECH PTE LTD
+ * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
+ * target=_blank>https://mitcc.org/</a>
+ */
+#ifndef CLOCK_POLICY_H
+#define CLOCK_POLICY_H
+
+/*****************************************************************************
+ * INCLUDES
+ *****************************************************************************/
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*****************************************************************************
+ * MACROS AND DEFINES
+ *****************************************************************************/
+
+/// Lowest HCLK at which the USB FS peripheral keeps working (RM0351)
+#define CLOCK_POLICY_MIN_HCLK_HZ 14200000
+/// Largest division of HCLK at the idle level, as a power of two
+#define CLOCK_POLICY_MAX_IDLE_SHIFT 2
+
+/*****************************************************************************
+ * TYPEDEFS
+ *****************************************************************************/
+
+/**
+ * @brief Clock levels of the policy
+ */
+typedef enum {
+  CLOCK_LEVEL_RUN = 0,  ///< Clocks set up by SystemClock_Config()
+  CLOCK_LEVEL_IDLE,     ///< HCLK divided, while the core sleeps for events
+} clock_level_e;
+
+/*****************************************************************************
+ * EXPORTED VARIABLES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * GLOBAL FUNCTION PROTOTYPES
+ *****************************************************************************/
+
+/**
+ * @brief Derives the idle level from the clocks set up by
+ * SystemClock_Config(); call right after it
+ * @details The boot configuration, normally the fastest the board supports,
+ * is the run level. The idle level only raises the AHB prescaler and lowers
+ * both APB prescalers by the same factor, so that SYSCLK, the PLLs (and the
+ * USB 48 MHz clock), the flash latency, the voltage range and every peripheral
+ * and timer clock stay as configured. The factor is the largest one keeping
+ * HCLK above CLOCK_POLICY_MIN_HCLK_HZ and both APB prescalers above 1; if
+ * there is none, the idle level is the run level.
+ */
+void clock_policy_init(void);
+
+/**
+ * @brief Switches to the clock level
+ * @details Compute (PBKDF2, signing, PoW, card secure channel) runs at
+ * CLOCK_LEVEL_RUN; CLOCK_LEVEL_IDLE is meant for the core sleeping on WFI
+ * for the next event. Nothing is done on the simulator.
+ *
+ * @param level Level to switch to
+ */
+void clock_policy_set(clock_level_e level);
+
+/**
+ * @brief Returns the current clock level
+ */
+clock_level_e clock_policy_get(void);
+
+/**
+ * @brief Returns the core clock of the run level
+ *
+ * @return uint32_t Frequency in Hz, 0 on the simulator
+ */
+uint32_t clock_policy_run_hz(void);
+
+#endif /* CLOCK_POLICY_H */
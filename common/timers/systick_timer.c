@@ -63,7 +63,9 @@
 #include "systick_timer.h"
 
 #include "application_startup.h"
+#include "board.h"
 #include "systick_timer_priv.h"
+#include "utils.h"
 
 /*****************************************************************************
  * EXTERN VARIABLES
@@ -131,3 +133,75 @@ void systick_set_timeout_config(bool enable) {
 uint32_t systick_get_timer_value(void) {
   return timer_ctx.timer;
 }
+
+#if USE_SIMULATOR == 0
+void systick_idle_wait(uint32_t max_ms, const volatile bool *wakeup) {
+  const uint32_t tick_cycles = SystemCoreClock / 1000;
+  const uint32_t sleep_ms =
+      CY_MIN(max_ms, SysTick_LOAD_RELOAD_Msk / tick_cycles);
+
+  if (2 > sleep_ms) {
+    __WFI();
+    return;
+  }
+
+  // interrupts stay masked till uwTick is compensated; a pending one still
+  // ends the WFI
+  __disable_irq();
+  if (*wakeup || 0 != (SCB->ICSR & SCB_ICSR_PENDSTSET_Msk)) {
+    __enable_irq();
+    return;
+  }
+
+  // the counter holds the cycles left in the current tick, the deadline is
+  // sleep_ms - 1 ticks past its end
+  SysTick->CTRL &= ~SysTick_CTRL_ENABLE_Msk;
+  const uint32_t reload = SysTick->VAL + (sleep_ms - 1) * tick_cycles;
+  SysTick->LOAD = reload;
+  SysTick->VAL = 0;
+  SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+
+  __DSB();
+  __WFI();
+  __ISB();
+
+  // reading CTRL clears COUNTFLAG, hence read it once
+  const uint32_t ctrl = SysTick->CTRL;
+  SysTick->CTRL = ctrl & ~SysTick_CTRL_ENABLE_Msk;
+  const uint32_t remaining = SysTick->VAL;
+
+  uint32_t elapsed_ms = 0;
+  uint32_t next_cycles = 0;
+  if (0 != (ctrl & SysTick_CTRL_COUNTFLAG_Msk)) {
+    // deadline reached: the pending tick interrupt counts the last tick, the
+    // counter restarted from reload since
+    const uint32_t overrun = reload - remaining;
+    elapsed_ms = sleep_ms - 1;
+    next_cycles = (overrun < tick_cycles) ? tick_cycles - overrun : 1;
+  } else {
+    // woken early: the ticks not slept through are those still ahead of the
+    // deadline
+    elapsed_ms = sleep_ms - (remaining + tick_cycles - 1) / tick_cycles;
+    next_cycles = remaining % tick_cycles;
+    if (0 == next_cycles) {
+      next_cycles = tick_cycles;
+    }
+  }
+  uwTick += elapsed_ms;
+
+  // finish the current tick, then resume the 1 ms period
+  SysTick->LOAD = next_cycles - 1;
+  SysTick->VAL = 0;
+  SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+  SysTick->LOAD = tick_cycles - 1;
+  __enable_irq();
+}
+#else
+void systick_idle_wait(uint32_t max_ms, const volatile bool *wakeup) {
+#ifdef SIM_HEADLESS
+  sim_headless_idle_wait(max_ms, wakeup);
+#else
+  BSP_DelayMs(1);
+#endif
+}
+#endif
@@ -16,6 +16,7 @@
 /*****************************************************************************
  * INCLUDES
  *****************************************************************************/
+#include <stdbool.h>
 #include <stdint.h>
 
 #include "lvgl.h"
@@ -57,4 +58,19 @@ void systick_interrupt_cb(void);
  */
 uint32_t systick_get_timer_value(void);
 
+/**
+ * @brief Sleeps with the 1 ms HAL tick suppressed till an interrupt or the
+ * deadline
+ * @details The SysTick is reprogrammed to fire once at the deadline (at most
+ * its 24 bit range) so that the core is not woken every millisecond, then
+ * uwTick is advanced by the ticks slept through. The application timer keeps
+ * running and wakes the core every POLLING_TIME for the LVGL tick and the
+ * inactivity timeout. On the simulator, sleeps for 1 ms.
+ *
+ * @param max_ms Deadline in milliseconds from now
+ * @param wakeup Flag raised by the interrupts of event sources; checked with
+ * interrupts masked, so that a wakeup raised just before the sleep is not lost
+ */
+void systick_idle_wait(uint32_t max_ms, const volatile bool *wakeup);
+
 #endif /* SYSTICK_TIMER_H */
@@ -0,0 +1,306 @@
+/**
+ * @file    usb_fuzz_main.c
+ * @author  Cypherock X1 Team
+ * @brief   Fuzzer and throughput harness of the USB packet parser
+ * @copyright Copyright (c) 2023 HODL TECH PTE LTD
+ * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
+ *target=_blank>https://mitcc.org/</a>
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * (c) Copyright 2023 by HODL TECH PTE LTD
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * "Commons Clause" License Condition v1.0
+ *
+ * The Software is provided to you by the Licensor under the License,
+ * as defined below, subject to the following condition.
+ *
+ * Without limiting other conditions in the License, the grant of
+ * rights under the License will not include, and the License does not
+ * grant to you, the right to Sell the Software.
+ *
+ * For purposes of the foregoing, "Sell" means practicing any or all
+ * of the rights granted to you under the License to provide to third
+ * parties, for a fee or other consideration (including without
+ * limitation fees for hosting or consulting/ support services related
+ * to the Software), a product or service whose value derives, entirely
+ * or substantially, from the functionality of the Software. Any license
+ * notice or attribution required by the License must also include
+ * this Commons Clause License Condition notice.
+ *
+ * Software: All X1Wallet associated files.
+ * License: MIT
+ * Licensor: HODL TECH PTE LTD
+ *
+ ******************************************************************************
+ */
+
+/*****************************************************************************
+ * INCLUDES
+ *****************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "chunk_utils.h"
+#include "memzero.h"
+#include "usb_api.h"
+#include "usb_api_priv.h"
+#include "utils.h"
+
+/*****************************************************************************
+ * PRIVATE MACROS AND DEFINES
+ *****************************************************************************/
+
+/// Packet types sent by the throughput mode, as the host sends them
+#define FUZZ_PKT_TYPE_CMD 2
+#define FUZZ_PKT_TYPE_OUT_REQ 3
+
+/// Size of the commands sent by the throughput mode
+#define FUZZ_CMD_SIZE 1024
+
+/// Largest input file replayed
+#define FUZZ_MAX_INPUT (1024 * 1024)
+
+/*****************************************************************************
+ * STATIC VARIABLES
+ *****************************************************************************/
+
+/// core.Msg {cmd {applet_id: 1}}
+static const uint8_t fuzz_core_msg[] = {10, 2, 8, 1};
+
+/// Copy of the received command, answered back as the app response
+static uint8_t echo[FUZZ_CMD_SIZE];
+
+/// Packets handed to the parser by the throughput mode
+static uint32_t packets_sent;
+
+/*****************************************************************************
+ * STATIC FUNCTIONS
+ *****************************************************************************/
+
+/**
+ * @brief Brings the transport back to its boot state so that every input
+ * runs the same way
+ */
+static void fuzz_reset(void) {
+  usb_clear_event();
+  memzero(get_comm_status(), sizeof(comm_status_t));
+}
+
+/**
+ * @brief Runs the main loop side of the transport: processes the queued
+ * packets and answers a complete command with its own message, as an app
+ */
+static void fuzz_step(void) {
+  usb_event_t evt = {0};
+  if (!usb_get_event(&evt)) {
+    return;
+  }
+  const uint16_t size = CY_MIN(evt.msg_size, sizeof(echo));
+  memcpy(echo, evt.p_msg, size);
+  usb_send_msg(fuzz_core_msg, sizeof(fuzz_core_msg), echo, size);
+}
+
+/**
+ * @brief Hands a well formed packet to the parser, as received by the ISR
+ */
+static void fuzz_send_packet(uint16_t chunk,
+                             uint16_t total,
+                             uint16_t seq,
+                             uint8_t type,
+                             const uint8_t *payload,
+                             uint8_t size) {
+  uint8_t packet[COMM_PKT_MAX_LEN] = {0};
+  packet[COMM_HEADER_INDEX] = COMM_START_OF_HEADER;
+  packet[COMM_HEADER_INDEX + 1] = COMM_START_OF_HEADER;
+  packet[COMM_CHUNK_NO_INDEX] = chunk >> 8;
+  packet[COMM_CHUNK_NO_INDEX + 1] = chunk & 0xFF;
+  packet[COMM_CHUNK_COUNT_INDEX] = total >> 8;
+  packet[COMM_CHUNK_COUNT_INDEX + 1] = total & 0xFF;
+  packet[COMM_SEQ_NO_INDEX] = seq >> 8;
+  packet[COMM_SEQ_NO_INDEX + 1] = seq & 0xFF;
+  packet[COMM_PKT_TYPE_INDEX] = type;
+  packet[COMM_PAYLOAD_LEN_INDEX] = size;
+  memcpy(packet + COMM_PAYLOAD_INDEX, payload, size);
+  const uint16_t crc = comm_crc16(packet + COMM_CHUNK_NO_INDEX,
+                                  COMM_PAYLOAD_INDEX - COMM_CHUNK_NO_INDEX +
+                                      size);
+  packet[COMM_CHECKSUM_INDEX] = crc >> 8;
+  packet[COMM_CHECKSUM_INDEX + 1] = crc & 0xFF;
+
+  comm_packet_parser(packet, COMM_PAYLOAD_INDEX + size, COMM_LIBUSB__HID);
+  packets_sent++;
+}
+
+/**
+ * @brief Uploads a command, lets it execute and fetches its output
+ */
+static void fuzz_run_command(uint16_t seq) {
+  uint8_t cmd[FUZZ_CMD_SIZE] = {0};
+  const uint16_t raw_size = sizeof(cmd) - COMM_SZ_RESERVED_SPACE -
+                            sizeof(fuzz_core_msg);
+  cmd[1] = sizeof(fuzz_core_msg);
+  cmd[2] = raw_size >> 8;
+  cmd[3] = raw_size & 0xFF;
+  memcpy(cmd + COMM_SZ_RESERVED_SPACE, fuzz_core_msg, sizeof(fuzz_core_msg));
+  for (uint16_t i = COMM_SZ_RESERVED_SPACE + sizeof(fuzz_core_msg);
+       i < sizeof(cmd);
+       i++) {
+    cmd[i] = i;
+  }
+
+  const uint16_t total = CY_CEIL_DIV(sizeof(cmd), COMM_MAX_PAYLOAD_SIZE);
+  for (uint16_t chunk = 1; chunk <= total; chunk++) {
+    const uint16_t offset = (chunk - 1) * COMM_MAX_PAYLOAD_SIZE;
+    fuzz_send_packet(chunk,
+                     total,
+                     seq,
+                     FUZZ_PKT_TYPE_CMD,
+                     cmd + offset,
+                     CY_MIN(sizeof(cmd) - offset, COMM_MAX_PAYLOAD_SIZE));
+    usb_process_rx_packets();
+  }
+  fuzz_step();
+
+  // the response echoes the command, so it spans as many chunks
+  for (uint16_t chunk = 1; chunk <= total; chunk++) {
+    const uint8_t req[6] = {0, 0, 0, 0, chunk >> 8, chunk & 0xFF};
+    fuzz_send_packet(1, 1, seq, FUZZ_PKT_TYPE_OUT_REQ, req, sizeof(req));
+    usb_process_rx_packets();
+  }
+}
+
+static double fuzz_now_s(void) {
+  struct timespec now = {0};
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+/**
+ * @brief Measures the packets per second the parser and the protocol state
+ * machine process for well formed command uploads and output fetches
+ */
+static void fuzz_throughput(double seconds) {
+  fuzz_reset();
+  packets_sent = 0;
+  uint32_t commands = 0;
+  const double start = fuzz_now_s();
+  double elapsed = 0;
+  while (elapsed < seconds) {
+    fuzz_run_command(commands + 1);
+    commands++;
+    elapsed = fuzz_now_s() - start;
+  }
+  printf("throughput,%lu commands,%lu packets,%.0f packets/s,%.2f MB/s\n",
+         (unsigned long)commands,
+         (unsigned long)packets_sent,
+         packets_sent / elapsed,
+         commands * 2.0 * FUZZ_CMD_SIZE / elapsed / 1e6);
+}
+
+/**
+ * @brief Replays packets recorded back to back, as in the rx file of the
+ * simulator file transport (/tmp/cypherock_device_in.bin)
+ */
+static void fuzz_replay_raw(const uint8_t *data, size_t size) {
+  fuzz_reset();
+  while (COMM_HEADER_SIZE <= size) {
+    const size_t length =
+        CY_MIN((size_t)COMM_HEADER_SIZE + data[COMM_PAYLOAD_LEN_INDEX], size);
+    comm_packet_parser(data, length, COMM_LIBUSB__HID);
+    fuzz_step();
+    data += length;
+    size -= length;
+  }
+}
+
+static size_t fuzz_read_file(const char *path, uint8_t *buffer) {
+  FILE *file = fopen(path, "rb");
+  if (NULL == file) {
+    perror(path);
+    exit(1);
+  }
+  const size_t size = fread(buffer, 1, FUZZ_MAX_INPUT, file);
+  fclose(file);
+  return size;
+}
+
+/*****************************************************************************
+ * GLOBAL FUNCTIONS
+ *****************************************************************************/
+
+/**
+ * @brief libFuzzer entry point
+ * @details The input is a stream of USB reports, each a length byte (taken
+ * modulo COMM_PKT_MAX_LEN + 1) followed by that many bytes. Every report is
+ * handed to comm_packet_parser() as the ISR would, then the queued packets are
+ * processed and a complete command is answered as an app would.
+ */
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
+  fuzz_reset();
+  while (0 < size) {
+    const size_t length = CY_MIN(data[0] % (COMM_PKT_MAX_LEN + 1), size - 1);
+    comm_packet_parser(data + 1, length, COMM_LIBUSB__HID);
+    fuzz_step();
+    data += length + 1;
+    size -= length + 1;
+  }
+  return 0;
+}
+
+#ifndef USB_FUZZ_LIBFUZZER
+/**
+ * @brief Entry point when built without libFuzzer
+ * @details usb_fuzz FILE... replays inputs of LLVMFuzzerTestOneInput(), eg. a
+ * crash found by the fuzzer. usb_fuzz --raw FILE... replays recorded packets.
+ * usb_fuzz --throughput [SECONDS] measures the packets processed per second.
+ */
+int main(int argc, char **argv) {
+  if (2 <= argc && 0 == strcmp(argv[1], "--throughput")) {
+    fuzz_throughput(3 <= argc ? atof(argv[2]) : 2.0);
+    return 0;
+  }
+
+  const bool raw = (2 <= argc && 0 == strcmp(argv[1], "--raw"));
+  if (argc < (raw ? 3 : 2)) {
+    printf("usage: %s [--raw] FILE... | --throughput [SECONDS]\n", argv[0]);
+    return 1;
+  }
+
+  uint8_t *buffer = malloc(FUZZ_MAX_INPUT);
+  for (int i = raw ? 2 : 1; i < argc; i++) {
+    const size_t size = fuzz_read_file(argv[i], buffer);
+    if (raw) {
+      fuzz_replay_raw(buffer, size);
+    } else {
+      LLVMFuzzerTestOneInput(buffer, size);
+    }
+    printf("%s: %lu bytes replayed\n", argv[i], (unsigned long)size);
+  }
+  free(buffer);
+  return 0;
+}
+#endif /* USB_FUZZ_LIBFUZZER */
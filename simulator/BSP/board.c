@@ -183,7 +183,11 @@ void BSP_reset(void) {
 }
 
 void BSP_DelayMs(uint32_t delayValue) {
+#ifdef SIM_HEADLESS
+  sim_headless_delay_ms(delayValue);
+#else
   SDL_Delay(delayValue);
+#endif
 }
 
 void BSP_Buzzer_Timer() {
@@ -194,7 +198,8 @@ void BSP_RNG_Init(void) {
 
 BSP_Status_t BSP_RNG_Generate(uint32_t *random32bit) {
 #ifdef USE_SIMULATOR
-  *random32bit = rand();
+  // rand() only gives 31 bits
+  *random32bit = ((uint32_t)rand() << 16) ^ (uint32_t)rand();
 #endif    // USE_SIMULATOR
 
   return BSP_OK;
@@ -59,7 +59,12 @@ extern uint8_t STM32_UID[12];
 
 #define UID_BASE (&STM32_UID[0])
 #define __IO
+#ifdef SIM_HEADLESS
+#include "sim_headless.h"
+#define uwTick sim_headless_tick_ms()
+#else
 #define uwTick clock()
+#endif
 #define NVIC_EnableIRQ(a) 0
 #define NVIC_DisableIRQ(a) 0
 #define NVIC_GetEnableIRQ(a) 0
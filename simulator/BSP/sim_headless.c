@@ -0,0 +1,407 @@
+/**
+ * @file    sim_headless.c
+ * @author  Cypherock X1 Team
+ * @brief   Simulator without a window: framebuffer display, scripted keypad
+ *          and virtual time
+ * @copyright Copyright (c) 2023 HODL TECH PTE LTD
+ * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
+ *target=_blank>https://mitcc.org/</a>
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * (c) Copyright 2023 by HODL TECH PTE LTD
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * "Commons Clause" License Condition v1.0
+ *
+ * The Software is provided to you by the Licensor under the License,
+ * as defined below, subject to the following condition.
+ *
+ * Without limiting other conditions in the License, the grant of
+ * rights under the License will not include, and the License does not
+ * grant to you, the right to Sell the Software.
+ *
+ * For purposes of the foregoing, "Sell" means practicing any or all
+ * of the rights granted to you under the License to provide to third
+ * parties, for a fee or other consideration (including without
+ * limitation fees for hosting or consulting/ support services related
+ * to the Software), a product or service whose value derives, entirely
+ * or substantially, from the functionality of the Software. Any license
+ * notice or attribution required by the License must also include
+ * this Commons Clause License Condition notice.
+ *
+ * Software: All X1Wallet associated files.
+ * License: MIT
+ * Licensor: HODL TECH PTE LTD
+ *
+ ******************************************************************************
+ */
+
+
+/*****************************************************************************
+ * INCLUDES
+ *****************************************************************************/
+#include "sim_headless.h"
+
+#ifdef SIM_HEADLESS
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "logger.h"
+#include "lvgl.h"
+#include "sim_usb.h"
+#include "ui_common.h"
+
+/*****************************************************************************
+ * EXTERN VARIABLES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * PRIVATE MACROS AND DEFINES
+ *****************************************************************************/
+
+#define SCRIPT_LINE_MAX_LEN 64
+
+/*****************************************************************************
+ * PRIVATE TYPEDEFS
+ *****************************************************************************/
+
+typedef enum {
+  SCRIPT_STEP_KEY = 0,
+  SCRIPT_STEP_WAIT,
+  SCRIPT_STEP_QUIT,
+} script_step_e;
+
+/**
+ * @brief A step of the keypad script
+ */
+typedef struct script_step {
+  script_step_e type;
+  uint32_t value;    ///< LV_KEY_* of a key step, milliseconds of a wait step
+} script_step_t;
+
+/**
+ * @brief Name of a key in the keypad script
+ */
+typedef struct script_key {
+  const char *name;
+  uint32_t key;
+} script_key_t;
+
+/*****************************************************************************
+ * STATIC FUNCTION PROTOTYPES
+ *****************************************************************************/
+
+/**
+ * @brief Returns the real time elapsed since the first call
+ *
+ * @return uint32_t Time in milliseconds
+ */
+static uint32_t real_ms(void);
+
+/**
+ * @brief Reads the keypad script named by SIM_HEADLESS_SCRIPT_ENV, if any
+ */
+static void script_load(void);
+
+/**
+ * @brief Runs the wait and quit steps which are due, up to the next key step
+ * @details A key step due raises an input edge, so that the keypad is read
+ * right away as a joystick edge would make it on the device.
+ */
+static void script_advance(void);
+
+/**
+ * @brief Keeps the area flushed by LVGL in the framebuffer
+ */
+static void framebuffer_flush(lv_disp_drv_t *disp_drv,
+                              const lv_area_t *area,
+                              lv_color_t *color_p);
+
+/**
+ * @brief Reports the keys of the script, every key is pressed for one read
+ */
+static bool script_keypad_read(lv_indev_drv_t *indev_drv,
+                               lv_indev_data_t *data);
+
+/**
+ * @brief Writes the framebuffer to SIM_HEADLESS_FRAME_ENV, if set
+ */
+static void framebuffer_dump(void);
+
+/*****************************************************************************
+ * STATIC VARIABLES
+ *****************************************************************************/
+
+static const script_key_t script_keys[] = {
+    {"up", LV_KEY_UP},
+    {"down", LV_KEY_DOWN},
+    {"left", LV_KEY_LEFT},
+    {"right", LV_KEY_RIGHT},
+    {"enter", LV_KEY_ENTER},
+    {"esc", LV_KEY_ESC},
+};
+
+static lv_color_t framebuffer[LV_HOR_RES_MAX * LV_VER_RES_MAX];
+
+static script_step_t script[SIM_HEADLESS_MAX_STEPS];
+static uint32_t script_len = 0;
+static uint32_t script_pos = 0;
+/// Virtual time at which the current wait step ends
+static uint32_t wait_until_ms = 0;
+static bool wait_started = false;
+static bool key_held = false;
+static uint32_t last_key = 0;
+
+/// Time skipped, written by the main thread; uwTick is also read by the
+/// transport thread
+static uint32_t skipped_ms = 0;
+static bool exit_requested = false;
+
+/*****************************************************************************
+ * GLOBAL VARIABLES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * STATIC FUNCTIONS
+ *****************************************************************************/
+
+static uint32_t real_ms(void) {
+  static struct timespec start = {0};
+  struct timespec now = {0};
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  if (0 == start.tv_sec && 0 == start.tv_nsec) {
+    start = now;
+  }
+  return (uint32_t)((now.tv_sec - start.tv_sec) * 1000 +
+                    (now.tv_nsec - start.tv_nsec) / 1000000);
+}
+
+static void script_load(void) {
+  const char *path = getenv(SIM_HEADLESS_SCRIPT_ENV);
+  if (NULL == path || '\0' == path[0]) {
+    return;
+  }
+
+  FILE *file = fopen(path, "r");
+  if (NULL == file) {
+    perror("ERROR (" SIM_HEADLESS_SCRIPT_ENV ")");
+    return;
+  }
+
+  char line[SCRIPT_LINE_MAX_LEN] = {0};
+  while (NULL != fgets(line, sizeof(line), file)) {
+    char name[SCRIPT_LINE_MAX_LEN] = {0};
+    unsigned long value = 0;
+    int fields = sscanf(line, "%63s %lu", name, &value);
+    if (0 >= fields || '#' == name[0]) {
+      continue;
+    }
+    if (SIM_HEADLESS_MAX_STEPS <= script_len) {
+      printf("%s: more than %d steps\n",
+             SIM_HEADLESS_SCRIPT_ENV,
+             SIM_HEADLESS_MAX_STEPS);
+      break;
+    }
+
+    script_step_t *step = &script[script_len];
+    bool found = false;
+    if (0 == strcmp(name, "wait") && 2 == fields) {
+      step->type = SCRIPT_STEP_WAIT;
+      step->value = (uint32_t)value;
+      found = true;
+    } else if (0 == strcmp(name, "quit")) {
+      step->type = SCRIPT_STEP_QUIT;
+      found = true;
+    }
+    for (size_t i = 0; !found && i < sizeof(script_keys) / sizeof(*script_keys);
+         i++) {
+      if (0 == strcmp(name, script_keys[i].name)) {
+        step->type = SCRIPT_STEP_KEY;
+        step->value = script_keys[i].key;
+        found = true;
+      }
+    }
+
+    if (found) {
+      script_len++;
+    } else {
+      printf("%s: ignoring '%s'\n", SIM_HEADLESS_SCRIPT_ENV, name);
+    }
+  }
+  fclose(file);
+}
+
+static void script_advance(void) {
+  while (script_pos < script_len) {
+    const script_step_t *step = &script[script_pos];
+
+    switch (step->type) {
+      case SCRIPT_STEP_WAIT:
+        if (!wait_started) {
+          wait_until_ms = sim_headless_tick_ms() + step->value;
+          wait_started = true;
+        }
+        if (0 < (int32_t)(wait_until_ms - sim_headless_tick_ms())) {
+          return;
+        }
+        wait_started = false;
+        break;
+
+      case SCRIPT_STEP_QUIT:
+        sim_headless_request_exit();
+        break;
+
+      case SCRIPT_STEP_KEY:
+      default:
+        ui_input_edge_isr();
+        return;
+    }
+    script_pos++;
+  }
+}
+
+static void framebuffer_flush(lv_disp_drv_t *disp_drv,
+                              const lv_area_t *area,
+                              lv_color_t *color_p) {
+  const lv_coord_t width = area->x2 - area->x1 + 1;
+
+  for (lv_coord_t y = area->y1; y <= area->y2; y++) {
+    if (0 <= y && LV_VER_RES_MAX > y && 0 <= area->x1 &&
+        LV_HOR_RES_MAX > area->x2) {
+      memcpy(&framebuffer[y * LV_HOR_RES_MAX + area->x1],
+             color_p,
+             width * sizeof(lv_color_t));
+    }
+    color_p += width;
+  }
+  lv_disp_flush_ready(disp_drv);
+}
+
+static bool script_keypad_read(lv_indev_drv_t *indev_drv,
+                               lv_indev_data_t *data) {
+  (void)indev_drv;
+
+  data->state = LV_INDEV_STATE_REL;
+  if (key_held) {
+    // released on the read after the press; read it back right away
+    key_held = false;
+    ui_input_edge_isr();
+  } else {
+    script_advance();
+    if (script_pos < script_len &&
+        SCRIPT_STEP_KEY == script[script_pos].type) {
+      last_key = script[script_pos].value;
+      data->state = LV_INDEV_STATE_PR;
+      key_held = true;
+      script_pos++;
+      ui_input_edge_isr();
+    }
+  }
+  data->key = last_key;
+
+  return false;
+}
+
+static void framebuffer_dump(void) {
+  const char *path = getenv(SIM_HEADLESS_FRAME_ENV);
+  if (NULL == path || '\0' == path[0]) {
+    return;
+  }
+
+  FILE *file = fopen(path, "w");
+  if (NULL == file) {
+    perror("ERROR (" SIM_HEADLESS_FRAME_ENV ")");
+    return;
+  }
+  // lit pixels are 1, ie. drawn black by image viewers
+  fprintf(file, "P1\n%d %d\n", LV_HOR_RES_MAX, LV_VER_RES_MAX);
+  for (int y = 0; y < LV_VER_RES_MAX; y++) {
+    for (int x = 0; x < LV_HOR_RES_MAX; x++) {
+      fputc(lv_color_to1(framebuffer[y * LV_HOR_RES_MAX + x]) ? '1' : '0',
+            file);
+    }
+    fputc('\n', file);
+  }
+  fclose(file);
+}
+
+/*****************************************************************************
+ * GLOBAL FUNCTIONS
+ *****************************************************************************/
+
+struct _lv_indev_t *sim_headless_init(void) {
+  static lv_disp_buf_t disp_buf;
+  static lv_color_t buf[LV_HOR_RES_MAX * LV_VER_RES_MAX];
+
+  real_ms();
+  script_load();
+
+  lv_disp_buf_init(&disp_buf, buf, NULL, LV_HOR_RES_MAX * LV_VER_RES_MAX);
+  lv_disp_drv_t disp_drv;
+  lv_disp_drv_init(&disp_drv);
+  disp_drv.buffer = &disp_buf;
+  disp_drv.flush_cb = framebuffer_flush;
+  lv_disp_drv_register(&disp_drv);
+
+  lv_indev_drv_t kb_drv;
+  lv_indev_drv_init(&kb_drv);
+  kb_drv.type = LV_INDEV_TYPE_KEYPAD;
+  kb_drv.read_cb = script_keypad_read;
+  return lv_indev_drv_register(&kb_drv);
+}
+
+uint32_t sim_headless_tick_ms(void) {
+  return real_ms() + __atomic_load_n(&skipped_ms, __ATOMIC_RELAXED);
+}
+
+void sim_headless_delay_ms(uint32_t ms) {
+  __atomic_fetch_add(&skipped_ms, ms, __ATOMIC_RELAXED);
+}
+
+void sim_headless_idle_wait(uint32_t max_ms, const volatile bool *wakeup) {
+  if (__atomic_load_n(&exit_requested, __ATOMIC_ACQUIRE)) {
+    logger_flush();
+    framebuffer_dump();
+    exit(EXIT_SUCCESS);
+  }
+
+  script_advance();
+  if (!*wakeup && !sim_usb_host_connected()) {
+    sim_headless_delay_ms(max_ms);
+  }
+  usleep(SIM_HEADLESS_IDLE_POLL_US);
+}
+
+void sim_headless_request_exit(void) {
+  __atomic_store_n(&exit_requested, true, __ATOMIC_RELEASE);
+}
+
+const void *sim_headless_framebuffer(void) {
+  return framebuffer;
+}
+#endif /* SIM_HEADLESS */
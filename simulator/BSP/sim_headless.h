@@ -0,0 +1,109 @@
+/**
+ * @file    sim_headless.h
+ * @author  Cypherock X1 Team
+ * @brief   Simulator without a window: framebuffer display, scripted keypad
+ *          and virtual time
+ * @copyright Copyright (c) 2023 HODL TECH PTE LTD
+ * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
+ * target=_blank>https://mitcc.org/</a>
+ */
+#ifndef SIM_HEADLESS_H
+#define SIM_HEADLESS_H
+
+/*****************************************************************************
+ * INCLUDES
+ *****************************************************************************/
+
+// lvgl.h is not included as lv_conf.h includes this header for the tick
+#include <stdbool.h>
+#include <stdint.h>
+
+/*****************************************************************************
+ * MACROS AND DEFINES
+ *****************************************************************************/
+
+/// Environment variable naming the keypad script, see sim_headless_init()
+#define SIM_HEADLESS_SCRIPT_ENV "SIM_INPUT_SCRIPT"
+/// Environment variable naming the file the last frame is written to on exit,
+/// as a plain PBM image
+#define SIM_HEADLESS_FRAME_ENV "SIM_FRAME_FILE"
+
+/// Largest number of steps of the keypad script
+#define SIM_HEADLESS_MAX_STEPS 256
+/// Real time slept by every idle wait, so that an idle simulator does not
+/// spin
+#define SIM_HEADLESS_IDLE_POLL_US 100
+
+/*****************************************************************************
+ * TYPEDEFS
+ *****************************************************************************/
+
+struct _lv_indev_t;
+
+/*****************************************************************************
+ * EXPORTED VARIABLES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * GLOBAL FUNCTION PROTOTYPES
+ *****************************************************************************/
+
+/**
+ * @brief Registers the framebuffer display and the scripted keypad with LVGL,
+ * in place of the SDL monitor, mouse and keyboard
+ * @details The keypad script, named by SIM_HEADLESS_SCRIPT_ENV, has one step
+ * per line; empty lines and lines starting with '#' are skipped:
+ *  - up, down, left, right, enter or esc: press and release the key
+ *  - wait <ms>: let <ms> of virtual time pass before the next step
+ *  - quit: exit the simulator once it next waits for an event
+ * Without a script the keypad is never pressed, which suits the session
+ * benchmark build confirming every screen itself.
+ *
+ * @return struct _lv_indev_t* The keypad input device
+ */
+struct _lv_indev_t *sim_headless_init(void);
+
+/**
+ * @brief Returns the virtual time in milliseconds, used as uwTick and as the
+ * LVGL tick
+ * @details Virtual time follows the real time, plus every delay skipped by
+ * sim_headless_delay_ms() and sim_headless_idle_wait().
+ */
+uint32_t sim_headless_tick_ms(void);
+
+/**
+ * @brief Lets the time pass without sleeping, for BSP_DelayMs()
+ *
+ * @param ms Delay in milliseconds
+ */
+void sim_headless_delay_ms(uint32_t ms);
+
+/**
+ * @brief Idle wait of get_events(), see systick_idle_wait()
+ * @details While no host is connected, the device only waits on itself (its
+ * screens, timers and the keypad script), hence the wait is skipped in
+ * virtual time. With a host connected, time is not skipped so that the
+ * transport timeouts keep their real meaning; the wait returns after
+ * SIM_HEADLESS_IDLE_POLL_US and the caller polls again. The simulator exits
+ * here once an exit is requested.
+ *
+ * @param max_ms Longest wait in milliseconds
+ * @param wakeup Flag raised by the event sources
+ */
+void sim_headless_idle_wait(uint32_t max_ms, const volatile bool *wakeup);
+
+/**
+ * @brief Requests the simulator to exit the next time it waits for an event,
+ * ie. once the session in progress is complete
+ * @details Called when the host disconnects from the socket transport and on
+ * the quit step of the keypad script. May be called from any thread.
+ */
+void sim_headless_request_exit(void);
+
+/**
+ * @brief Returns the last frame sent to the display, one lv_color_t per
+ * pixel, row by row
+ */
+const void *sim_headless_framebuffer(void);
+
+#endif /* SIM_HEADLESS_H */
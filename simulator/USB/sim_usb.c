@@ -4,6 +4,25 @@
 #include <stdlib.h>
 #include <unistd.h>
 
+#include "sim_usb_session.h"
+#include "usb_api_priv.h"
+
+#ifdef SIM_HEADLESS
+#include "sim_headless.h"
+#endif
+
+#if SIM_USB_TRANSPORT == SIM_USB_TRANSPORT_SOCKET ||                           \
+    SIM_USB_TRANSPORT == SIM_USB_TRANSPORT_SHM
+#ifdef _WIN32
+#error "Only the file transport is available on Windows"
+#endif
+#include <fcntl.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#endif
+
 #ifdef _WIN32
 #define TEMP_ENV_VAR "TEMP"
 #define SIM_USB_RX_FILE_NAME "cypherock_device_in.bin"
@@ -13,17 +32,182 @@
 #define SIM_USB_TX_FILE_NAME "/tmp/cypherock_device_out.bin"
 #endif
 
-static FILE *rx_file = NULL;
-static FILE *tx_file = NULL;
+/// Sleep of the shared memory reader while the host sends nothing
+#define SIM_USB_SHM_POLL_US 50
+/// Polls the reader spins for after a packet before it starts to sleep, the
+/// next packet of a burst usually follows right away
+#define SIM_USB_SHM_SPIN_POLLS 100000
+/// Time a transmit waits for the host to make room in the ring
+#define SIM_USB_SHM_TX_TIMEOUT_US 100000
+
 static uint8_t rec_buffer[80];
 volatile uint8_t rec_counter = 0;
 static pthread_t ptid;
 
-static void check_for_usb_data();
+#if SIM_USB_TRANSPORT != SIM_USB_TRANSPORT_NONE
 static int8_t SIM_Receive_FS(const uint8_t *Buf, const uint32_t *Len);
+#endif
+
+#if SIM_USB_TRANSPORT == SIM_USB_TRANSPORT_FILE
+static FILE *rx_file = NULL;
+static FILE *tx_file = NULL;
+
+static void check_for_usb_data();
 static uint32_t seek_pos = 0;
+#elif SIM_USB_TRANSPORT == SIM_USB_TRANSPORT_SOCKET
+/// Connected host, -1 while none; written by the reader thread only
+static volatile int client_fd = -1;
+static int listen_fd = -1;
 
-void SIM_USB_DEVICE_Init() {
+/**
+ * @brief Accepts one host at a time and hands its packets to the parser, like
+ * the USB interrupt does on the device
+ */
+static void *socket_rx_thread(void *arg) {
+  (void)arg;
+  uint8_t packet[SIM_USB_PACKET_SIZE];
+
+  while (1) {
+    int fd = accept(listen_fd, NULL, NULL);
+    if (0 > fd) {
+      perror("ERROR (usb socket accept)");
+      continue;
+    }
+    __atomic_store_n(&client_fd, fd, __ATOMIC_RELEASE);
+
+    ssize_t size = 0;
+    while (0 < (size = recv(fd, packet, sizeof(packet), 0))) {
+      uint32_t len = (uint32_t)size;
+      SIM_Receive_FS(packet, &len);
+    }
+    __atomic_store_n(&client_fd, -1, __ATOMIC_RELEASE);
+    close(fd);
+#ifdef SIM_HEADLESS
+    // the session is over once its host disconnects
+    sim_headless_request_exit();
+#endif
+  }
+  return NULL;
+}
+
+static void socket_init(void) {
+  struct sockaddr_un addr = {.sun_family = AF_UNIX};
+  snprintf(addr.sun_path, sizeof(addr.sun_path), "%s", SIM_USB_SOCKET_PATH);
+  unlink(SIM_USB_SOCKET_PATH);
+
+  listen_fd = socket(AF_UNIX, SOCK_SEQPACKET, 0);
+  if (0 > listen_fd ||
+      0 != bind(listen_fd, (struct sockaddr *)&addr, sizeof(addr)) ||
+      0 != listen(listen_fd, 1)) {
+    perror("ERROR (usb socket)");
+    return;
+  }
+  pthread_create(&ptid, NULL, socket_rx_thread, NULL);
+}
+
+static void socket_transmit(const uint8_t *data, uint8_t size) {
+  int fd = __atomic_load_n(&client_fd, __ATOMIC_ACQUIRE);
+  if (0 > fd) {
+    // no host connected, the packet is lost as on an unplugged cable
+    return;
+  }
+  if (0 > send(fd, data, size, MSG_NOSIGNAL)) {
+    perror("ERROR (usb transmit)");
+  }
+}
+#elif SIM_USB_TRANSPORT == SIM_USB_TRANSPORT_SHM
+static sim_usb_shm_t *shm = NULL;
+
+/**
+ * @brief Drains the host to device ring into the parser, like the USB
+ * interrupt does on the device
+ */
+static void *shm_rx_thread(void *arg) {
+  (void)arg;
+  sim_usb_ring_t *ring = &shm->to_device;
+  uint32_t idle_polls = 0;
+
+  while (1) {
+    const uint32_t tail = ring->tail;
+    if (tail == __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE)) {
+      if (SIM_USB_SHM_SPIN_POLLS > idle_polls) {
+        idle_polls++;
+        sched_yield();
+      } else {
+        usleep(SIM_USB_SHM_POLL_US);
+      }
+      continue;
+    }
+    idle_polls = 0;
+
+    const sim_usb_packet_t *packet = &ring->slots[tail % SIM_USB_SHM_SLOTS];
+    uint32_t len = packet->size;
+    if (SIM_USB_PACKET_SIZE < len) {
+      len = SIM_USB_PACKET_SIZE;
+    }
+    SIM_Receive_FS(packet->data, &len);
+    __atomic_store_n(&ring->tail, tail + 1, __ATOMIC_RELEASE);
+  }
+  return NULL;
+}
+
+static void shm_init(void) {
+  int fd = shm_open(SIM_USB_SHM_NAME, O_CREAT | O_RDWR, 0600);
+  if (0 > fd || 0 != ftruncate(fd, sizeof(sim_usb_shm_t))) {
+    perror("ERROR (usb shm)");
+    return;
+  }
+  shm = mmap(NULL,
+             sizeof(sim_usb_shm_t),
+             PROT_READ | PROT_WRITE,
+             MAP_SHARED,
+             fd,
+             0);
+  close(fd);
+  if (MAP_FAILED == shm) {
+    perror("ERROR (usb shm)");
+    shm = NULL;
+    return;
+  }
+  memset(shm, 0, sizeof(sim_usb_shm_t));
+  pthread_create(&ptid, NULL, shm_rx_thread, NULL);
+}
+
+static void shm_transmit(const uint8_t *data, uint8_t size) {
+  if (NULL == shm || SIM_USB_PACKET_SIZE < size) {
+    return;
+  }
+
+  sim_usb_ring_t *ring = &shm->from_device;
+  const uint32_t head = ring->head;
+  uint32_t waited_us = 0;
+  while (SIM_USB_SHM_SLOTS <=
+         head - __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE)) {
+    if (SIM_USB_SHM_TX_TIMEOUT_US <= waited_us) {
+      // the host stopped reading, the packet is lost
+      return;
+    }
+    usleep(SIM_USB_SHM_POLL_US);
+    waited_us += SIM_USB_SHM_POLL_US;
+  }
+
+  sim_usb_packet_t *packet = &ring->slots[head % SIM_USB_SHM_SLOTS];
+  memcpy(packet->data, data, size);
+  packet->size = size;
+  __atomic_store_n(&ring->head, head + 1, __ATOMIC_RELEASE);
+}
+#endif
+
+#if SIM_USB_TRANSPORT != SIM_USB_TRANSPORT_NONE
+static int8_t SIM_Receive_FS(const uint8_t *Buf, const uint32_t *Len) {
+  sim_usb_session_rx(Buf, *Len);
+  comm_packet_parser(Buf, *Len, COMM_LIBUSB__HID);
+  return (USBD_OK);
+}
+#endif
+
+#if SIM_USB_TRANSPORT == SIM_USB_TRANSPORT_FILE
+static void file_init(void) {
   char file_name[250];
 
   errno = 0;
@@ -63,7 +247,7 @@ void SIM_USB_DEVICE_Init() {
   tx_file = NULL;
 }
 
-void SIM_Transmit_FS(uint8_t *data, uint8_t size) {
+static void file_transmit(const uint8_t *data, uint8_t size) {
   char file_name[250];
 
 #ifdef _WIN32
@@ -94,12 +278,6 @@ void SIM_Transmit_FS(uint8_t *data, uint8_t size) {
   tx_file = NULL;
 }
 
-static int8_t SIM_Receive_FS(const uint8_t *Buf, const uint32_t *Len) {
-  // TODO
-  return (USBD_OK);
-  /* USER CODE END 6 */
-}
-
 static void check_for_usb_data() {
   FILE *file;
   char file_name[250];
@@ -143,7 +321,52 @@ static void check_for_usb_data() {
       fclose(file);
   }
 }
+#endif /* SIM_USB_TRANSPORT == SIM_USB_TRANSPORT_FILE */
+
+void SIM_USB_DEVICE_Init() {
+  if (sim_usb_session_init()) {
+    // the replayed session stands for the host
+    return;
+  }
+#if SIM_USB_TRANSPORT == SIM_USB_TRANSPORT_SOCKET
+  socket_init();
+#elif SIM_USB_TRANSPORT == SIM_USB_TRANSPORT_SHM
+  shm_init();
+#elif SIM_USB_TRANSPORT == SIM_USB_TRANSPORT_FILE
+  file_init();
+#endif
+}
+
+void SIM_Transmit_FS(uint8_t *data, uint8_t size) {
+  sim_usb_session_tx(data, size);
+  if (sim_usb_session_replaying()) {
+    return;
+  }
+#if SIM_USB_TRANSPORT == SIM_USB_TRANSPORT_SOCKET
+  socket_transmit(data, size);
+#elif SIM_USB_TRANSPORT == SIM_USB_TRANSPORT_SHM
+  shm_transmit(data, size);
+#elif SIM_USB_TRANSPORT == SIM_USB_TRANSPORT_FILE
+  file_transmit(data, size);
+#endif
+}
 
 void usbsim_continue_loop() {
+#if SIM_USB_TRANSPORT == SIM_USB_TRANSPORT_FILE
   check_for_usb_data();
-}
\ No newline at end of file
+#endif
+  // the other transports receive on their reader thread
+}
+
+bool sim_usb_host_connected(void) {
+  if (sim_usb_session_replaying()) {
+    return true;
+  }
+#if SIM_USB_TRANSPORT == SIM_USB_TRANSPORT_SOCKET
+  return 0 <= __atomic_load_n(&client_fd, __ATOMIC_ACQUIRE);
+#elif SIM_USB_TRANSPORT == SIM_USB_TRANSPORT_NONE
+  return false;
+#else
+  return true;
+#endif
+}
@@ -2,12 +2,37 @@
 #define __SIM_USB_HEADER__
 
 #include <errno.h>
+#include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <string.h>
 
 #include "communication.h"
 
+/// Transports of the packets exchanged with the host, chosen at build time
+/// with SIM_USB_TRANSPORT (see utilities/cmake/simulator/simulator.cmake)
+#define SIM_USB_TRANSPORT_FILE 0
+#define SIM_USB_TRANSPORT_SOCKET 1
+#define SIM_USB_TRANSPORT_SHM 2
+/// No host, transmitted packets are dropped; the fuzzer build (fuzz/) feeds
+/// the packet parser itself
+#define SIM_USB_TRANSPORT_NONE 3
+
+#ifndef SIM_USB_TRANSPORT
+#define SIM_USB_TRANSPORT SIM_USB_TRANSPORT_FILE
+#endif
+
+/// Unix-domain SOCK_SEQPACKET socket the simulator listens on; every datagram
+/// is one packet, as a USB HID report would be
+#define SIM_USB_SOCKET_PATH "/tmp/cypherock_device.sock"
+/// POSIX shared memory object holding a sim_usb_shm_t
+#define SIM_USB_SHM_NAME "/cypherock_device"
+
+/// Largest packet exchanged, same as COMM_PKT_MAX_LEN
+#define SIM_USB_PACKET_SIZE 64
+/// Packets each shared memory ring holds; must be a power of 2
+#define SIM_USB_SHM_SLOTS 64
+
 /**
  * @brief Enum to be used by application to identify interface from which data
  * was recieved and interface to which, data should be sent.
@@ -26,8 +51,46 @@ typedef enum {
   USBD_FAIL,
 } USBSIM_StatusTypeDef;
 
+/**
+ * @brief A packet in a shared memory ring
+ */
+typedef struct {
+  uint8_t size;
+  uint8_t data[SIM_USB_PACKET_SIZE];
+} sim_usb_packet_t;
+
+/**
+ * @brief Single producer single consumer ring of packets
+ * @details head and tail are free running counters; the producer fills
+ * slots[head % SIM_USB_SHM_SLOTS] then stores head + 1 with release order, the
+ * consumer reads slots[tail % SIM_USB_SHM_SLOTS] then stores tail + 1. The
+ * ring is full when head - tail == SIM_USB_SHM_SLOTS.
+ */
+typedef struct {
+  uint32_t head;
+  uint32_t tail;
+  sim_usb_packet_t slots[SIM_USB_SHM_SLOTS];
+} sim_usb_ring_t;
+
+/**
+ * @brief Layout of the SIM_USB_SHM_NAME shared memory object. The simulator
+ * creates and clears it at start; the host maps it afterwards.
+ */
+typedef struct {
+  sim_usb_ring_t to_device;
+  sim_usb_ring_t from_device;
+} sim_usb_shm_t;
+
 void SIM_USB_DEVICE_Init();
 void SIM_Transmit_FS(uint8_t *data, uint8_t size);
 void usbsim_continue_loop();
 
+/**
+ * @brief Tells if a host may be exchanging packets with the simulator
+ * @details Only the socket transport knows when the host connects; the file
+ * and shared memory transports report a host at all times, the fuzzer build
+ * never. A replayed session (see sim_usb_session.h) is a host.
+ */
+bool sim_usb_host_connected(void);
+
 #endif
\ No newline at end of file
@@ -0,0 +1,456 @@
+/**
+ * @file    sim_usb_session.c
+ * @author  Cypherock X1 Team
+ * @brief   Recording and replay of the host sessions of the simulator
+ * @copyright Copyright (c) 2023 HODL TECH PTE LTD
+ * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
+ *target=_blank>https://mitcc.org/</a>
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * (c) Copyright 2023 by HODL TECH PTE LTD
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * "Commons Clause" License Condition v1.0
+ *
+ * The Software is provided to you by the Licensor under the License,
+ * as defined below, subject to the following condition.
+ *
+ * Without limiting other conditions in the License, the grant of
+ * rights under the License will not include, and the License does not
+ * grant to you, the right to Sell the Software.
+ *
+ * For purposes of the foregoing, "Sell" means practicing any or all
+ * of the rights granted to you under the License to provide to third
+ * parties, for a fee or other consideration (including without
+ * limitation fees for hosting or consulting/ support services related
+ * to the Software), a product or service whose value derives, entirely
+ * or substantially, from the functionality of the Software. Any license
+ * notice or attribution required by the License must also include
+ * this Commons Clause License Condition notice.
+ *
+ * Software: All X1Wallet associated files.
+ * License: MIT
+ * Licensor: HODL TECH PTE LTD
+ *
+ ******************************************************************************
+ */
+
+/*****************************************************************************
+ * INCLUDES
+ *****************************************************************************/
+#include "sim_usb_session.h"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "lvgl.h"
+#include "sim_usb.h"
+#include "ui_common.h"
+#include "usb_api_priv.h"
+
+#ifdef SIM_HEADLESS
+#include "sim_headless.h"
+#endif
+
+/*****************************************************************************
+ * EXTERN VARIABLES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * PRIVATE MACROS AND DEFINES
+ *****************************************************************************/
+
+/// Sleep of the replay thread while it waits on the device
+#define REPLAY_POLL_US 100
+/// Longest line of a session file: time, type and a packet in hex
+#define SESSION_LINE_MAX_LEN (32 + 2 * SIM_USB_PACKET_SIZE)
+
+/*****************************************************************************
+ * PRIVATE TYPEDEFS
+ *****************************************************************************/
+
+typedef enum {
+  SESSION_EVENT_RX = 0,
+  SESSION_EVENT_TX,
+  SESSION_EVENT_KEY,
+} session_event_e;
+
+/**
+ * @brief An event of the replayed session
+ */
+typedef struct session_event {
+  session_event_e type;
+  uint64_t time_us;
+  uint32_t tx_before;    ///< Device packets recorded before the event
+  uint32_t key;          ///< LV_KEY_* of a key event
+  bool pressed;          ///< State of a key event
+  uint8_t size;          ///< Length of the packet of an rx or tx event
+  uint8_t data[SIM_USB_PACKET_SIZE];
+} session_event_t;
+
+typedef bool (*keypad_read_cb_t)(lv_indev_drv_t *, lv_indev_data_t *);
+
+/*****************************************************************************
+ * STATIC FUNCTION PROTOTYPES
+ *****************************************************************************/
+
+/**
+ * @brief Returns the monotonic time in microseconds
+ */
+static uint64_t now_us(void);
+
+/**
+ * @brief Appends a line to the recording
+ * @details The packets are recorded from the transport thread and the main
+ * thread, hence the lines are serialized.
+ */
+static void record_line(const char *type, const char *value);
+
+/**
+ * @brief Records a packet as an rx or tx line
+ */
+static void record_packet(const char *type,
+                          const uint8_t *data,
+                          uint32_t size);
+
+/**
+ * @brief Reads the session file into replay_events
+ *
+ * @param path Session file
+ *
+ * @return bool false if the file cannot be read
+ */
+static bool replay_load(const char *path);
+
+/**
+ * @brief Waits for the device to have sent count packets
+ *
+ * @return bool false on timeout
+ */
+static bool replay_wait_tx(uint32_t count);
+
+/**
+ * @brief Feeds the session to the device, see sim_usb_session_init()
+ */
+static void *replay_thread(void *arg);
+
+/**
+ * @brief Read callback of the keypad, records or replays its changes
+ */
+static bool session_keypad_read(lv_indev_drv_t *indev_drv,
+                                lv_indev_data_t *data);
+
+/*****************************************************************************
+ * STATIC VARIABLES
+ *****************************************************************************/
+
+static uint64_t session_start_us = 0;
+
+static FILE *record_file = NULL;
+static pthread_mutex_t record_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static bool replaying = false;
+static bool replay_paced = false;
+static session_event_t *replay_events = NULL;
+static uint32_t replay_event_count = 0;
+static uint32_t replay_tx_total = 0;
+static pthread_t replay_ptid;
+
+/// Device packets sent, written by the main thread
+static uint32_t tx_count = 0;
+
+static keypad_read_cb_t keypad_read = NULL;
+/// Last recorded keypad state
+static uint32_t recorded_key = 0;
+static bool recorded_pressed = false;
+/// Keypad state posted by the replay thread, consumed by the next read
+static uint32_t replay_key = 0;
+static bool replay_pressed = false;
+static bool replay_key_posted = false;
+
+/*****************************************************************************
+ * GLOBAL VARIABLES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * STATIC FUNCTIONS
+ *****************************************************************************/
+
+static uint64_t now_us(void) {
+  struct timespec now = {0};
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint64_t)now.tv_sec * 1000000ULL + (uint64_t)now.tv_nsec / 1000;
+}
+
+static void record_line(const char *type, const char *value) {
+  pthread_mutex_lock(&record_lock);
+  fprintf(record_file,
+          "%llu %s %s\n",
+          (unsigned long long)(now_us() - session_start_us),
+          type,
+          value);
+  fflush(record_file);
+  pthread_mutex_unlock(&record_lock);
+}
+
+static void record_packet(const char *type,
+                          const uint8_t *data,
+                          uint32_t size) {
+  char hex[2 * SIM_USB_PACKET_SIZE + 1] = {0};
+
+  if (SIM_USB_PACKET_SIZE < size) {
+    size = SIM_USB_PACKET_SIZE;
+  }
+  for (uint32_t i = 0; i < size; i++) {
+    snprintf(&hex[2 * i], 3, "%02x", data[i]);
+  }
+  record_line(type, hex);
+}
+
+static bool replay_load(const char *path) {
+  FILE *file = fopen(path, "r");
+  if (NULL == file) {
+    perror("ERROR (" SIM_USB_REPLAY_ENV ")");
+    return false;
+  }
+
+  char line[SESSION_LINE_MAX_LEN] = {0};
+  uint32_t capacity = 0;
+  uint32_t tx_seen = 0;
+  while (NULL != fgets(line, sizeof(line), file)) {
+    unsigned long long time_us = 0;
+    char type[4] = {0};
+    char value[2 * SIM_USB_PACKET_SIZE + 1] = {0};
+    unsigned long key = 0;
+    int pressed = 0;
+    if (2 > sscanf(line, "%llu %3s", &time_us, type)) {
+      continue;
+    }
+
+    if (capacity == replay_event_count) {
+      capacity = (0 == capacity) ? 256 : 2 * capacity;
+      replay_events =
+          realloc(replay_events, capacity * sizeof(session_event_t));
+      if (NULL == replay_events) {
+        fclose(file);
+        return false;
+      }
+    }
+    session_event_t *event = &replay_events[replay_event_count];
+    memset(event, 0, sizeof(session_event_t));
+    event->time_us = time_us;
+    event->tx_before = tx_seen;
+
+    if (0 == strcmp(type, "key") &&
+        2 == sscanf(line, "%*llu %*s %lu %d", &key, &pressed)) {
+      event->type = SESSION_EVENT_KEY;
+      event->key = (uint32_t)key;
+      event->pressed = (0 != pressed);
+    } else if ((0 == strcmp(type, "rx") || 0 == strcmp(type, "tx")) &&
+               1 == sscanf(line, "%*llu %*s %128s", value)) {
+      event->type =
+          (0 == strcmp(type, "rx")) ? SESSION_EVENT_RX : SESSION_EVENT_TX;
+      for (size_t i = 0; i + 1 < strlen(value); i += 2) {
+        unsigned int byte = 0;
+        sscanf(&value[i], "%2x", &byte);
+        event->data[event->size++] = (uint8_t)byte;
+      }
+    } else {
+      continue;
+    }
+
+    if (SESSION_EVENT_TX == event->type) {
+      tx_seen++;
+    }
+    replay_event_count++;
+  }
+  fclose(file);
+  replay_tx_total = tx_seen;
+  return true;
+}
+
+static bool replay_wait_tx(uint32_t count) {
+  const uint64_t start = now_us();
+  while (__atomic_load_n(&tx_count, __ATOMIC_ACQUIRE) < count) {
+    if ((uint64_t)SIM_USB_REPLAY_TIMEOUT_MS * 1000 < now_us() - start) {
+      return false;
+    }
+    usleep(REPLAY_POLL_US);
+  }
+  return true;
+}
+
+static void *replay_thread(void *arg) {
+  (void)arg;
+  const uint64_t start = now_us();
+  uint64_t last_us = start;
+  uint32_t host_packets = 0;
+  uint32_t keys = 0;
+
+  for (uint32_t i = 0; i < replay_event_count; i++) {
+    const session_event_t *event = &replay_events[i];
+    if (SESSION_EVENT_TX == event->type) {
+      continue;
+    }
+
+    if (!replay_wait_tx(event->tx_before)) {
+      printf("%s: the device sent %u of %u packets before event %u\n",
+             SIM_USB_REPLAY_ENV,
+             (unsigned)__atomic_load_n(&tx_count, __ATOMIC_ACQUIRE),
+             (unsigned)event->tx_before,
+             (unsigned)i);
+    }
+
+    if (replay_paced && 0 < i) {
+      // keep the pause of the host after the previous event
+      const uint64_t gap = event->time_us - replay_events[i - 1].time_us;
+      const uint64_t now = now_us();
+      const uint64_t base =
+          (SESSION_EVENT_TX == replay_events[i - 1].type) ? now : last_us;
+      if (base + gap > now) {
+        usleep(base + gap - now);
+      }
+    }
+
+    if (SESSION_EVENT_RX == event->type) {
+      comm_packet_parser(event->data, event->size, COMM_LIBUSB__HID);
+      host_packets++;
+    } else {
+      replay_key = event->key;
+      replay_pressed = event->pressed;
+      __atomic_store_n(&replay_key_posted, true, __ATOMIC_RELEASE);
+      ui_input_edge_isr();
+      while (__atomic_load_n(&replay_key_posted, __ATOMIC_ACQUIRE)) {
+        usleep(REPLAY_POLL_US);
+      }
+      keys++;
+    }
+    last_us = now_us();
+  }
+
+  replay_wait_tx(replay_tx_total);
+  printf(SIM_USB_REPLAY_TABLE_HEADER "\n");
+  printf("replay,%u,%u,%u,%u,%llu\n",
+         (unsigned)host_packets,
+         (unsigned)keys,
+         (unsigned)replay_tx_total,
+         (unsigned)__atomic_load_n(&tx_count, __ATOMIC_ACQUIRE),
+         (unsigned long long)(now_us() - start));
+  fflush(stdout);
+#ifdef SIM_HEADLESS
+  sim_headless_request_exit();
+#endif
+  return NULL;
+}
+
+static bool session_keypad_read(lv_indev_drv_t *indev_drv,
+                                lv_indev_data_t *data) {
+  if (replaying) {
+    if (__atomic_load_n(&replay_key_posted, __ATOMIC_ACQUIRE)) {
+      recorded_key = replay_key;
+      recorded_pressed = replay_pressed;
+      __atomic_store_n(&replay_key_posted, false, __ATOMIC_RELEASE);
+    }
+    data->key = recorded_key;
+    data->state =
+        recorded_pressed ? LV_INDEV_STATE_PR : LV_INDEV_STATE_REL;
+    return false;
+  }
+
+  const bool more = keypad_read(indev_drv, data);
+  const bool pressed = (LV_INDEV_STATE_PR == data->state);
+  if (NULL != record_file &&
+      (pressed != recorded_pressed || (pressed && data->key != recorded_key))) {
+    char line[32] = {0};
+    recorded_key = data->key;
+    recorded_pressed = pressed;
+    snprintf(line,
+             sizeof(line),
+             "%lu %d",
+             (unsigned long)recorded_key,
+             pressed ? 1 : 0);
+    record_line("key", line);
+  }
+  return more;
+}
+
+/*****************************************************************************
+ * GLOBAL FUNCTIONS
+ *****************************************************************************/
+
+bool sim_usb_session_init(void) {
+  session_start_us = now_us();
+
+  const char *replay = getenv(SIM_USB_REPLAY_ENV);
+  if (NULL != replay && '\0' != replay[0]) {
+    char path[256] = {0};
+    snprintf(path, sizeof(path), "%s", replay);
+    char *option = strrchr(path, ',');
+    if (NULL != option && 0 == strcmp(option, ",paced")) {
+      *option = '\0';
+      replay_paced = true;
+    }
+    if (replay_load(path)) {
+      replaying = true;
+      pthread_create(&replay_ptid, NULL, replay_thread, NULL);
+      return true;
+    }
+    return false;
+  }
+
+  const char *record = getenv(SIM_USB_RECORD_ENV);
+  if (NULL != record && '\0' != record[0]) {
+    record_file = fopen(record, "w");
+    if (NULL == record_file) {
+      perror("ERROR (" SIM_USB_RECORD_ENV ")");
+    }
+  }
+  return false;
+}
+
+void sim_usb_session_rx(const uint8_t *data, uint32_t size) {
+  if (NULL != record_file) {
+    record_packet("rx", data, size);
+  }
+}
+
+void sim_usb_session_tx(const uint8_t *data, uint32_t size) {
+  __atomic_fetch_add(&tx_count, 1, __ATOMIC_RELEASE);
+  if (NULL != record_file) {
+    record_packet("tx", data, size);
+  }
+}
+
+void sim_usb_session_wrap_keypad(struct _lv_indev_t *keypad) {
+  keypad_read = keypad->driver.read_cb;
+  keypad->driver.read_cb = session_keypad_read;
+}
+
+bool sim_usb_session_replaying(void) {
+  return replaying;
+}
@@ -0,0 +1,98 @@
+/**
+ * @file    sim_usb_session.h
+ * @author  Cypherock X1 Team
+ * @brief   Recording and replay of the host sessions of the simulator
+ * @copyright Copyright (c) 2023 HODL TECH PTE LTD
+ * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
+ * target=_blank>https://mitcc.org/</a>
+ */
+#ifndef SIM_USB_SESSION_H
+#define SIM_USB_SESSION_H
+
+/*****************************************************************************
+ * INCLUDES
+ *****************************************************************************/
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*****************************************************************************
+ * MACROS AND DEFINES
+ *****************************************************************************/
+
+/// Environment variable naming the session file to record to
+#define SIM_USB_RECORD_ENV "SIM_USB_RECORD"
+/// Environment variable naming the session file to replay, optionally
+/// followed by ",paced" to keep the pauses of the host
+#define SIM_USB_REPLAY_ENV "SIM_USB_REPLAY"
+
+/// Time the replay waits for a packet of the device before it gives up on
+/// the exchange and goes on
+#define SIM_USB_REPLAY_TIMEOUT_MS 10000
+
+/// Report printed at the end of a replay
+#define SIM_USB_REPLAY_TABLE_HEADER                                            \
+  "replay,host_packets,keys,device_packets_recorded,device_packets,wall_us"
+
+/*****************************************************************************
+ * TYPEDEFS
+ *****************************************************************************/
+
+struct _lv_indev_t;
+
+/*****************************************************************************
+ * EXPORTED VARIABLES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * GLOBAL FUNCTION PROTOTYPES
+ *****************************************************************************/
+
+/**
+ * @brief Starts recording or replaying as set by the environment
+ * @details A session file has one event per line, in the order they happened:
+ *  <us> rx <hex>        packet from the host
+ *  <us> tx <hex>        packet from the device
+ *  <us> key <key> <pr>  keypad state change, LV_KEY_* and 1 if pressed
+ * where <us> is the time since the start of the recording. The replay feeds
+ * the host packets and the key changes to the device from a thread, each one
+ * once the device has sent as many packets as it had before that event in
+ * the recording; hence the exchange keeps its order whatever the speed of the
+ * firmware. The replay runs at full speed unless paced, in which case every
+ * event also waits for the time that separated it from the previous event.
+ * When replaying, the transport of the build is not started.
+ *
+ * @return bool true if a session is replayed
+ */
+bool sim_usb_session_init(void);
+
+/**
+ * @brief Records a packet received from the host
+ *
+ * @param data Packet
+ * @param size Length of data
+ */
+void sim_usb_session_rx(const uint8_t *data, uint32_t size);
+
+/**
+ * @brief Records a packet sent by the device and counts it for the replay
+ *
+ * @param data Packet
+ * @param size Length of data
+ */
+void sim_usb_session_tx(const uint8_t *data, uint32_t size);
+
+/**
+ * @brief Routes the reads of the keypad through the session, to record its
+ * changes or to replay the recorded ones
+ *
+ * @param keypad Keypad input device, registered with its read callback
+ */
+void sim_usb_session_wrap_keypad(struct _lv_indev_t *keypad);
+
+/**
+ * @brief Tells if a session is being replayed
+ */
+bool sim_usb_session_replaying(void);
+
+#endif /* SIM_USB_SESSION_H */
@@ -75,6 +75,7 @@
 #include <string.h>
 
 #include "board.h"
+#include "sim_nfc_latency.h"
 
 #define STM_LOG_MODULE_NAME adafruit_pn532
 #if ADAFRUIT_PN532_LOG_ENABLED
@@ -274,6 +275,7 @@ ret_code_t adafruit_pn532_init(bool force) {
   }
 
   adafruit_pn532_pin_setup();
+  sim_nfc_latency_init();
 
   usleep(100 * 1000);
 
@@ -406,6 +408,7 @@ ret_code_t pn532_read_nfca_target_init_resp(nfc_a_tag_info *p_tag_info) {
 // simply return success; simulator nfc is always initialised
 ret_code_t adafruit_pn532_nfc_a_target_init(nfc_a_tag_info *p_tag_info,
                                             uint16_t timeout) {
+  sim_nfc_latency_activation();
   return STM_SUCCESS;
 }
 
@@ -474,6 +477,7 @@ ret_code_t adafruit_pn532_in_data_exchange(uint8_t *p_send,
 
   memcpy(p_response, m_pn532_packet_buf + PN532_DATA_OFFSET + 2, length);
   *p_response_len = length;
+  sim_nfc_latency_exchange(p_send, send_len, length);
 
   return STM_SUCCESS;
 }
@@ -602,6 +606,8 @@ ret_code_t adafruit_pn532_field_off(void) {
 }
 
 ret_code_t adafruit_pn532_release() {
+  // end of a card session
+  sim_nfc_latency_report();
   return STM_SUCCESS;
 }
 
@@ -0,0 +1,319 @@
+/**
+ * @file    sim_nfc_latency.c
+ * @author  Cypherock X1 Team
+ * @brief   Timing model of the NFC link and the X1 card for the simulator
+ * @copyright Copyright (c) 2023 HODL TECH PTE LTD
+ * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
+ *target=_blank>https://mitcc.org/</a>
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * (c) Copyright 2023 by HODL TECH PTE LTD
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * "Commons Clause" License Condition v1.0
+ *
+ * The Software is provided to you by the Licensor under the License,
+ * as defined below, subject to the following condition.
+ *
+ * Without limiting other conditions in the License, the grant of
+ * rights under the License will not include, and the License does not
+ * grant to you, the right to Sell the Software.
+ *
+ * For purposes of the foregoing, "Sell" means practicing any or all
+ * of the rights granted to you under the License to provide to third
+ * parties, for a fee or other consideration (including without
+ * limitation fees for hosting or consulting/ support services related
+ * to the Software), a product or service whose value derives, entirely
+ * or substantially, from the functionality of the Software. Any license
+ * notice or attribution required by the License must also include
+ * this Commons Clause License Condition notice.
+ *
+ * Software: All X1Wallet associated files.
+ * License: MIT
+ * Licensor: HODL TECH PTE LTD
+ *
+ ******************************************************************************
+ */
+
+/*****************************************************************************
+ * INCLUDES
+ *****************************************************************************/
+#include "sim_nfc_latency.h"
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "apdu.h"
+
+/*****************************************************************************
+ * EXTERN VARIABLES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * PRIVATE MACROS AND DEFINES
+ *****************************************************************************/
+
+/// Bits per byte on the wire: 8 data bits and the I2C ack or the ISO 14443-A
+/// parity bit
+#define BITS_PER_BYTE 9
+
+/// Bytes the PN532 adds around an InDataExchange: the command and the
+/// response frames (preamble, start code, length, checksums, TFI, command,
+/// target/status and postamble) and the ACK frame
+#define PN532_FRAMING_BYTES 24
+
+/// Bytes ISO 14443-4 adds around an APDU: PCB and CRC, in both directions
+#define RF_FRAMING_BYTES 6
+
+#define CONFIG_MAX_LEN 256
+
+/*****************************************************************************
+ * PRIVATE TYPEDEFS
+ *****************************************************************************/
+
+/**
+ * @brief Field of sim_nfc_latency_config_t settable through the environment
+ */
+typedef struct config_key {
+  const char *name;
+  size_t offset;
+} config_key_t;
+
+/*****************************************************************************
+ * STATIC FUNCTION PROTOTYPES
+ *****************************************************************************/
+
+/**
+ * @brief Returns the time taken by bytes at the bit rate
+ *
+ * @param bytes Bytes transferred
+ * @param kbps Bit rate, 0 for an instant transfer
+ *
+ * @return uint32_t Duration in microseconds
+ */
+static uint32_t transfer_us(uint32_t bytes, uint32_t kbps);
+
+/**
+ * @brief Tells if the firmware sends the APDU over the secure channel
+ *
+ * @param ins INS byte of the APDU
+ *
+ * @return bool true if the APDU is encrypted and authenticated
+ */
+static bool is_secure_ins(uint8_t ins);
+
+/**
+ * @brief Applies the key=value pairs of the environment over config
+ *
+ * @param config Model to update
+ * @param value Content of SIM_NFC_LATENCY_ENV
+ */
+static void parse_config(sim_nfc_latency_config_t *config, const char *value);
+
+/**
+ * @brief Accounts for the modeled duration and waits for it
+ *
+ * @param us Duration in microseconds
+ */
+static void spend(uint32_t us);
+
+/*****************************************************************************
+ * STATIC VARIABLES
+ *****************************************************************************/
+
+/// Estimated timing of the X1 card behind the PN532 of the device: 400 kHz
+/// I2C, 106 kbps RF and a JavaCard applet taking 10s of ms per APDU. Replace
+/// with the durations of the nfc spans of a device trace when calibrating.
+static const sim_nfc_latency_config_t x1_preset = {
+    .link_kbps = 400,
+    .rf_kbps = 106,
+    .frame_us = 1000,
+    .card_us = 15000,
+    .secure_us = 10000,
+    .activation_us = 10000,
+};
+
+static const config_key_t config_keys[] = {
+    {"link_kbps", offsetof(sim_nfc_latency_config_t, link_kbps)},
+    {"rf_kbps", offsetof(sim_nfc_latency_config_t, rf_kbps)},
+    {"frame_us", offsetof(sim_nfc_latency_config_t, frame_us)},
+    {"card_us", offsetof(sim_nfc_latency_config_t, card_us)},
+    {"secure_us", offsetof(sim_nfc_latency_config_t, secure_us)},
+    {"activation_us", offsetof(sim_nfc_latency_config_t, activation_us)},
+};
+
+static sim_nfc_latency_config_t model;
+static bool model_enabled = false;
+static bool header_printed = false;
+static sim_nfc_latency_stats_t stats;
+
+/*****************************************************************************
+ * GLOBAL VARIABLES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * STATIC FUNCTIONS
+ *****************************************************************************/
+
+static uint32_t transfer_us(uint32_t bytes, uint32_t kbps) {
+  if (0 == kbps) {
+    return 0;
+  }
+  return (uint32_t)(((uint64_t)bytes * BITS_PER_BYTE * 1000 + kbps - 1) /
+                    kbps);
+}
+
+static bool is_secure_ins(uint8_t ins) {
+  switch (ins) {
+    case APDU_UNPAIR:
+    case APDU_ADD_WALLET:
+    case APDU_RETRIEVE_WALLET:
+    case APDU_DELETE_WALLET:
+    case APDU_LIST_ALL_WALLET:
+      return true;
+    default:
+      return false;
+  }
+}
+
+static void parse_config(sim_nfc_latency_config_t *config, const char *value) {
+  char buffer[CONFIG_MAX_LEN] = {0};
+  char *saveptr = NULL;
+
+  strncpy(buffer, value, sizeof(buffer) - 1);
+  for (char *token = strtok_r(buffer, ",", &saveptr); NULL != token;
+       token = strtok_r(NULL, ",", &saveptr)) {
+    if (0 == strcmp(token, "x1")) {
+      memcpy(config, &x1_preset, sizeof(x1_preset));
+      continue;
+    }
+
+    char *separator = strchr(token, '=');
+    bool found = false;
+    if (NULL != separator) {
+      *separator = '\0';
+      for (size_t i = 0; i < sizeof(config_keys) / sizeof(config_keys[0]);
+           i++) {
+        if (0 == strcmp(token, config_keys[i].name)) {
+          uint32_t *field =
+              (uint32_t *)((uint8_t *)config + config_keys[i].offset);
+          *field = (uint32_t)strtoul(separator + 1, NULL, 10);
+          found = true;
+          break;
+        }
+      }
+    }
+    if (!found) {
+      printf("%s: ignoring '%s'\n", SIM_NFC_LATENCY_ENV, token);
+    }
+  }
+}
+
+static void spend(uint32_t us) {
+  stats.modeled_us += us;
+  if (0 < us) {
+    usleep(us);
+  }
+}
+
+/*****************************************************************************
+ * GLOBAL FUNCTIONS
+ *****************************************************************************/
+
+void sim_nfc_latency_init(void) {
+  const char *value = getenv(SIM_NFC_LATENCY_ENV);
+  sim_nfc_latency_config_t config = {0};
+
+  if (NULL == value || '\0' == value[0]) {
+    sim_nfc_latency_set(NULL);
+    return;
+  }
+
+  // Keys without a preset before them override the X1 estimates
+  memcpy(&config, &x1_preset, sizeof(x1_preset));
+  parse_config(&config, value);
+  sim_nfc_latency_set(&config);
+}
+
+void sim_nfc_latency_set(const sim_nfc_latency_config_t *config) {
+  memset(&model, 0, sizeof(model));
+  memset(&stats, 0, sizeof(stats));
+  model_enabled = (NULL != config);
+  if (model_enabled) {
+    memcpy(&model, config, sizeof(model));
+  }
+}
+
+const sim_nfc_latency_config_t *sim_nfc_latency_get(void) {
+  return &model;
+}
+
+void sim_nfc_latency_activation(void) {
+  spend(model.activation_us);
+}
+
+void sim_nfc_latency_exchange(const uint8_t *apdu,
+                              uint8_t sent,
+                              uint8_t received) {
+  uint32_t us = model.frame_us + model.card_us;
+  us += transfer_us(sent + received + PN532_FRAMING_BYTES, model.link_kbps);
+  us += transfer_us(sent + received + RF_FRAMING_BYTES, model.rf_kbps);
+
+  if (OFFSET_INS < sent && is_secure_ins(apdu[OFFSET_INS])) {
+    us += model.secure_us;
+    stats.secure++;
+  }
+
+  stats.exchanges++;
+  stats.bytes_sent += sent;
+  stats.bytes_received += received;
+  spend(us);
+}
+
+const sim_nfc_latency_stats_t *sim_nfc_latency_stats(void) {
+  return &stats;
+}
+
+void sim_nfc_latency_report(void) {
+  if (!model_enabled || 0 == stats.exchanges) {
+    memset(&stats, 0, sizeof(stats));
+    return;
+  }
+
+  if (!header_printed) {
+    printf("%s\n", SIM_NFC_LATENCY_TABLE_HEADER);
+    header_printed = true;
+  }
+  printf("nfc_sim,%u,%u,%u,%u,%llu\n",
+         stats.exchanges,
+         stats.secure,
+         stats.bytes_sent,
+         stats.bytes_received,
+         (unsigned long long)stats.modeled_us);
+  fflush(stdout);
+  memset(&stats, 0, sizeof(stats));
+}
@@ -0,0 +1,123 @@
+/**
+ * @file    sim_nfc_latency.h
+ * @author  Cypherock X1 Team
+ * @brief   Timing model of the NFC link and the X1 card for the simulator
+ * @copyright Copyright (c) 2023 HODL TECH PTE LTD
+ * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
+ * target=_blank>https://mitcc.org/</a>
+ */
+#ifndef SIM_NFC_LATENCY_H
+#define SIM_NFC_LATENCY_H
+
+/*****************************************************************************
+ * INCLUDES
+ *****************************************************************************/
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*****************************************************************************
+ * MACROS AND DEFINES
+ *****************************************************************************/
+
+/// Environment variable configuring the model, see sim_nfc_latency_init()
+#define SIM_NFC_LATENCY_ENV "SIM_NFC_LATENCY"
+
+/// Header line of the per card session report, see sim_nfc_latency_report()
+#define SIM_NFC_LATENCY_TABLE_HEADER                                          \
+  "nfc_sim,exchanges,secure,bytes_sent,bytes_received,modeled_us"
+
+/*****************************************************************************
+ * TYPEDEFS
+ *****************************************************************************/
+
+/**
+ * @brief Costs of the model; a zero field costs nothing
+ */
+typedef struct sim_nfc_latency_config {
+  uint32_t link_kbps;        ///< MCU to PN532 bus (I2C) bit rate
+  uint32_t rf_kbps;          ///< PN532 to card (ISO 14443-A) bit rate
+  uint32_t frame_us;         ///< Fixed cost of every exchange
+  uint32_t card_us;          ///< Processing of an APDU by the card
+  uint32_t secure_us;        ///< Extra processing of a secure channel APDU
+  uint32_t activation_us;    ///< Detection and selection of a card
+} sim_nfc_latency_config_t;
+
+/**
+ * @brief Exchanges modeled since the last sim_nfc_latency_report()
+ */
+typedef struct sim_nfc_latency_stats {
+  uint32_t exchanges;
+  uint32_t secure;    ///< Exchanges charged the secure channel cost
+  uint32_t bytes_sent;
+  uint32_t bytes_received;
+  uint64_t modeled_us;
+} sim_nfc_latency_stats_t;
+
+/*****************************************************************************
+ * EXPORTED VARIABLES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * GLOBAL FUNCTION PROTOTYPES
+ *****************************************************************************/
+
+/**
+ * @brief Loads the model from the SIM_NFC_LATENCY_ENV environment variable
+ * @details The variable holds either the preset "x1", the estimated timing of
+ * an X1 card, or comma separated key=value pairs overriding the preset, eg.
+ * "x1,card_us=30000" or "rf_kbps=106,card_us=12000". The keys are the fields
+ * of sim_nfc_latency_config_t. Without the variable every cost is zero and the
+ * simulated card answers instantly, as before.
+ */
+void sim_nfc_latency_init(void);
+
+/**
+ * @brief Replaces the model at runtime, eg. from a test comparing two APDU
+ * batching strategies
+ *
+ * @param config New costs, NULL to disable the model
+ */
+void sim_nfc_latency_set(const sim_nfc_latency_config_t *config);
+
+/**
+ * @brief Returns the model in use
+ *
+ * @return const sim_nfc_latency_config_t* Current costs
+ */
+const sim_nfc_latency_config_t *sim_nfc_latency_get(void);
+
+/**
+ * @brief Waits for the modeled duration of the detection of a card
+ */
+void sim_nfc_latency_activation(void);
+
+/**
+ * @brief Waits for the modeled duration of an APDU exchange
+ * @details The secure channel cost is charged to the APDUs the firmware sends
+ * over the secure channel (see nfc_secure_comm in nfc.c), identified by their
+ * INS byte.
+ *
+ * @param apdu APDU sent to the card
+ * @param sent Length of apdu
+ * @param received Length of the response of the card
+ */
+void sim_nfc_latency_exchange(const uint8_t *apdu,
+                              uint8_t sent,
+                              uint8_t received);
+
+/**
+ * @brief Returns the exchanges modeled since the last report
+ *
+ * @return const sim_nfc_latency_stats_t* Counters of the card session
+ */
+const sim_nfc_latency_stats_t *sim_nfc_latency_stats(void);
+
+/**
+ * @brief Prints the counters of the card session to stdout as
+ * SIM_NFC_LATENCY_TABLE_HEADER formatted line and clears them. Nothing is
+ * printed while the model is disabled or no APDU was exchanged.
+ */
+void sim_nfc_latency_report(void);
+
+#endif /* SIM_NFC_LATENCY_H */
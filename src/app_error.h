@@ -27,6 +27,7 @@
 
 #define RNG_ERROR_BASE          0x20000UL
 #define RNG_MCU_ERROR_BASE      (RNG_ERROR_BASE + 0x1000)   ///< Base error code for errors thrown by MCU RNG Module
+#define RNG_HEALTH_TEST_ERROR   (RNG_ERROR_BASE + 0x2000)   ///< MCU RNG output failed the repetition health test
 
 #define FLASH_ERROR_BASE        0x30000UL
 
@@ -101,7 +101,10 @@ bool card_flow_pairing(uint8_t *cards_paired) {
   uint8_t card_number;
   char display[40];
   evt_status_t event = {0};
+  bool result = true;
 
+  // Pairing keys of all the cards are written to the firewall in one go
+  sec_flash_batch_begin();
   for (card_number = 1; card_number <= MAX_KEYSTORE_ENTRY; card_number++) {
     // Check if the card #x is already paired
     if (1 == get_keystore_used_status(card_number - 1)) {
@@ -117,7 +120,8 @@ bool card_flow_pairing(uint8_t *cards_paired) {
         get_events(EVENT_CONFIG_NFC | EVENT_CONFIG_UI, MAX_INACTIVITY_TIMEOUT);
 
     if (true == event.p0_event.flag) {
-      return false;
+      result = false;
+      break;
     } else if (true == event.ui_event.event_occured &&
                UI_EVENT_REJECT == event.ui_event.event_type) {
       continue;
@@ -130,15 +134,17 @@ bool card_flow_pairing(uint8_t *cards_paired) {
     card_error =
         card_pair_operation(card_number, display, ui_text_place_card_below);
     if (CARD_OPERATION_ABORT_OPERATION == card_error) {
-      return false;
+      result = false;
+      break;
     }
 
     cards_paired_in_flow += 1;
   }
+  sec_flash_batch_commit();
 
-  if (NULL != cards_paired) {
+  if (true == result && NULL != cards_paired) {
     *cards_paired = cards_paired_in_flow;
   }
 
-  return true;
+  return result;
 }
\ No newline at end of file
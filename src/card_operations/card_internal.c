@@ -206,6 +206,7 @@ static card_error_type_e default_nfc_errors_handler(
   } else if (NFC_SC_ENC_KEY_ERROR <= card_data->nfc_data.status &&
              NFC_SC_DEC_ERROR >= card_data->nfc_data.status) {
     // Secure channel error faced. Retry or re-pair card
+    invalidate_session_key_cache();
     NFC_RETURN_ABORT_ERROR(card_data, ui_text_retry_or_repair);
   } else if (!(--card_data->nfc_data.retries)) {
     // Unknown error detected, after retries, return abort error and prompt user
@@ -231,9 +232,7 @@ static card_error_type_e handle_wait_for_card_selection(
     return CARD_OPERATION_P0_OCCURED;
   }
 
-  /* This API call is required to select the detected card as `get_events` calls
-   * the deselect function on exit */
-  nfc_wait_for_card(DEFAULT_NFC_TG_INIT_TIME);
+  /* The card detected by the NFC task is kept activated by `get_events` */
   NFC_RETURN_SUCCESS(card_data);
 }
 
@@ -247,7 +246,7 @@ static bool load_card_session_key(uint8_t *card_key_id) {
   }
 
   const uint8_t *session_key = get_keystore_pairing_key(keystore_index);
-  init_session_keys(session_key, session_key + 32, NULL);
+  init_cached_session_keys(keystore_index, session_key, session_key + 32);
   return true;
 }
 
@@ -272,6 +271,8 @@ card_error_type_e card_initialize_applet(card_operation_data_t *card_data) {
 
     instruction_scr_change_text(ui_text_card_detected, true);
 
+    // The card was just selected, the APDUs of this tap need not re-probe it
+    nfc_session_begin();
     select_applet_and_update_tapped_card(&(card_data->nfc_data));
 
     switch (card_data->nfc_data.status) {
@@ -342,6 +343,7 @@ card_error_type_e card_handle_errors(card_operation_data_t *card_data) {
       NFC_RETURN_SUCCESS(card_data);
       break;
     case SW_SECURITY_CONDITIONS_NOT_SATISFIED:
+      invalidate_session_key_cache();
       NFC_RETURN_ABORT_ERROR(card_data, ui_text_retry_or_repair);
       break;
     case SW_NOT_PAIRED:
@@ -349,6 +351,7 @@ card_error_type_e card_handle_errors(card_operation_data_t *card_data) {
        * doesn't. In practice this would happen if the card was paired with more
        * than 5 devices after being paired to the device where error occurs. */
       invalidate_keystore();
+      invalidate_session_key_cache();
       card_data->nfc_data.pairing_error = true;
       NFC_RETURN_ABORT_ERROR(card_data, ui_text_device_and_card_not_paired);
       break;
@@ -209,7 +209,8 @@ static uint8_t atecc_nfc_sign_hash(const uint8_t *hash, uint8_t *sign) {
       LOG_CRITICAL("PAIR SG: %04x, count:%d",
                    atecc_data.status,
                    DEFAULT_ATECC_RETRIES - atecc_data.retries);
-    atcab_init(atecc_data.cfg_atecc608a_iface);
+    if ((atecc_data.status = atecc_session_begin()) != ATCA_SUCCESS)
+      continue;
     atecc_data.status = atcab_sign(slot_3_nfc_pair_key, hash, sign);
   } while (atecc_data.status != ATCA_SUCCESS && --atecc_data.retries);
   if (usb_irq_enable_on_entry == true)
@@ -232,7 +233,8 @@ static uint8_t atecc_nfc_ecdh(const uint8_t *pub_key, uint8_t *shared_secret) {
       LOG_CRITICAL("ECDH: %04x, count:%d",
                    atecc_data.status,
                    DEFAULT_ATECC_RETRIES - atecc_data.retries);
-    atcab_init(atecc_data.cfg_atecc608a_iface);
+    if ((atecc_data.status = atecc_session_begin()) != ATCA_SUCCESS)
+      continue;
     atecc_data.status =
         atcab_ecdh_ioenc(slot_3_nfc_pair_key, pub_key, shared_secret, io_key);
   } while (atecc_data.status != ATCA_SUCCESS && --atecc_data.retries);
@@ -340,6 +342,7 @@ static uint32_t pair_card_postprocess(card_pairing_data_t *pair_data,
       keystore_index, buffer, sizeof(buffer), FLASH_SAVE_LATER);
   set_keystore_key_id(keystore_index, pair_data->data, 4, FLASH_SAVE_LATER);
   set_keystore_used_status(keystore_index, 1, FLASH_SAVE_NOW);
+  invalidate_session_key_cache();
 
   return SUCCESS;
 }
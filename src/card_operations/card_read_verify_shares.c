@@ -185,7 +185,7 @@ bool read_card_share(uint8_t xcor, const char *heading, const char *msg) {
 }
 
 int verify_card_share_data() {
-  uint8_t CONFIDENTIAL secret[MAX_ARBITRARY_DATA_SIZE];
+  uint8_t secret[MAX_ARBITRARY_DATA_SIZE];
   uint8_t status = 0;
   uint8_t wallet_id[WALLET_ID_SIZE] = {0};
 
@@ -193,8 +193,13 @@ int verify_card_share_data() {
   get_flash_wallet_share_by_name((const char *)wallet.wallet_name,
                                  wallet_shamir_data.mnemonic_shares[4]);
 
-  if (WALLET_IS_PIN_SET(wallet.wallet_info))
-    decrypt_shares();
+  bool decrypted = true;
+  if (WALLET_IS_PIN_SET(wallet.wallet_info)) {
+    // the shares read back from the 4 cards carry their MAC, the device share
+    // does not
+    decrypted = decrypt_shares(
+        0x1F, WALLET_IS_ARBITRARY_DATA(wallet.wallet_info) ? 0x00 : 0x0F);
+  }
   if (WALLET_IS_ARBITRARY_DATA(wallet.wallet_info)) {
     status = generate_data_5C2(wallet.arbitrary_data_size,
                                wallet_shamir_data.arbitrary_data_shares,
@@ -210,6 +215,11 @@ int verify_card_share_data() {
             sizeof(wallet_shamir_data.mnemonic_shares));
   }
 
+  if (!decrypted) {
+    LOG_ERROR("xxx40");
+    status = 0;
+  }
+
   if (status == 1) {
     // verify wallet id only if secret successfully regenerated
     mnemonic_clear();
@@ -66,6 +66,7 @@
 #include "nfc.h"
 #include "ui_instruction.h"
 #include "wallet.h"
+#include "wallet_list.h"
 
 /*****************************************************************************
  * EXTERN VARIABLES
@@ -108,6 +109,19 @@ static void record_card_write_attempt_on_flash(uint8_t card_num);
  */
 static void write_card_share_post_process(uint8_t card_num);
 
+/**
+ * @brief Checks if the wallet being written is already on the tapped card
+ * @details An add wallet APDU which reached the card may fail on the device
+ * side, eg. when the card leaves the field before its response is received.
+ * Resending it would then be rejected by the card, so the retry looks the
+ * wallet up first.
+ *
+ * @param found Set to true if a wallet with the same name and id is on the
+ * card
+ * @return ISO7816 The status word of the wallet list request
+ */
+static ISO7816 find_wallet_on_card(bool *found);
+
 /*****************************************************************************
  * STATIC VARIABLES
  *****************************************************************************/
@@ -183,6 +197,26 @@ static void write_card_share_post_process(uint8_t card_num) {
   return;
 }
 
+static ISO7816 find_wallet_on_card(bool *found) {
+  wallet_list_t wallet_list = {0};
+  *found = false;
+
+  ISO7816 status = nfc_list_all_wallet(&wallet_list);
+  if (SW_NO_ERROR != status) {
+    return status;
+  }
+
+  for (uint8_t i = 0; i < wallet_list.count && i < MAX_WALLETS_ALLOWED; i++) {
+    const wallet_metadata_t *metadata = &wallet_list.wallet[i];
+    if (0 == memcmp(metadata->name, wallet.wallet_name, NAME_SIZE) &&
+        0 == memcmp(metadata->id, wallet.wallet_id, WALLET_ID_SIZE)) {
+      *found = true;
+      break;
+    }
+  }
+  return status;
+}
+
 /*****************************************************************************
  * GLOBAL FUNCTIONS
  *****************************************************************************/
@@ -198,7 +232,10 @@ bool write_card_share(uint8_t card_num, const char *heading, const char *msg) {
   card_data.nfc_data.init_session_keys = true;
   memcpy(card_data.nfc_data.family_id, get_family_id(), FAMILY_ID_SIZE);
 
+  // the share was encrypted for every card up front, so a retry only resends
+  // the prepared wallet
   write_card_pre_process(card_num);
+  bool add_attempted = false;
 
   while (1) {
     card_data.nfc_data.acceptable_cards = 1 << (card_num - 1);
@@ -209,7 +246,20 @@ bool write_card_share(uint8_t card_num, const char *heading, const char *msg) {
 
     if (CARD_OPERATION_SUCCESS == card_data.error_type) {
       record_card_write_attempt_on_flash(card_num);
-      card_data.nfc_data.status = nfc_add_wallet(&wallet);
+
+      bool found = false;
+      if (add_attempted) {
+        // an empty card answers the list request with SW_RECORD_NOT_FOUND
+        card_data.nfc_data.status = find_wallet_on_card(&found);
+        if (SW_RECORD_NOT_FOUND == card_data.nfc_data.status) {
+          card_data.nfc_data.status = SW_NO_ERROR;
+        }
+      }
+
+      if (SW_NO_ERROR == card_data.nfc_data.status && !found) {
+        add_attempted = true;
+        card_data.nfc_data.status = nfc_add_wallet(&wallet);
+      }
 
       if (card_data.nfc_data.status == SW_NO_ERROR) {
         write_card_share_post_process(card_num);
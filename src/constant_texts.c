@@ -91,6 +91,9 @@ const char *ui_text_options_settings[NUMBER_OF_OPTIONS_SETTINGS] = {
     "View Card Version",
     "Regulatory Info",
     "Pair Cards",
+    "Toggle Session Unlock",
+    "Toggle Summary Review",
+    "Toggle Address Cache",
 #ifdef DEV_BUILD
     "Buzzer toggle",
 #endif
@@ -104,6 +107,27 @@ const char *ui_text_options_passphrase[] = {
     "Enable Passphrase Step",
 };
 
+const char *ui_text_options_seed_session[] = {
+    "Disable Session Unlock",
+    "Enable Session Unlock",
+};
+
+const char *ui_text_options_review_mode[] = {
+    "Disable Summary Review",
+    "Enable Summary Review",
+};
+
+const char *ui_text_options_xpub_cache[] = {
+    "Disable Address Cache",
+    "Enable Address Cache",
+};
+
+const char *ui_text_btc_receivers = "Receivers";
+const char *ui_text_options_receivers_review[] = {
+    "Approve receivers",
+    "Review each receiver",
+};
+
 const char *ui_text_options_logging_export[] = {
     "Disable Logs",
     "Enable Logs",
@@ -383,6 +407,14 @@ const char *ui_text_replace_account = "Replace Account";
 const char *ui_text_confirm_account = "Confirm Account";
 const char *ui_text_near_transfer_action_type = "transfer";
 const char *ui_text_near_create_account_method = "create_account";
+const char *ui_text_near_stake_action_type = "stake";
+const char *ui_text_near_add_key_action_type = "add_key";
+const char *ui_text_near_delete_key_action_type = "delete_key";
+const char *ui_text_near_delete_account_action_type = "delete_account";
+const char *ui_text_near_full_access = "Full access";
+const char *ui_text_verify_public_key = "Verify public key";
+const char *ui_text_verify_permission = "Verify permission";
+const char *ui_text_verify_beneficiary = "Verify beneficiary";
 
 // headings X1 Card flow
 const char *ui_text_family_id_hex = "F. Id (Hex)";
@@ -441,6 +473,12 @@ const char *ui_text_enable_passphrase_step =
     "Do you want to enable passphrase\n step on wallet creation?";
 const char *ui_text_disable_passphrase_step =
     "Do you want to disable passphrase\n step on wallet creation?";
+const char *ui_text_enable_seed_session =
+    "Keep wallets unlocked for 5 min or 10 requests after a card tap?";
+const char *ui_text_enable_summary_review =
+    "Show transactions with many receivers as a summary?";
+const char *ui_text_enable_xpub_cache =
+    "Remember account keys to show receive addresses without a card tap?";
 const char *ui_text_warning_txn_fee_too_high =
     "WARNING!\nTransaction fees\ntoo high, proceed?";
 const char *ui_text_enable_log_export = "Do you want to enable logging?";
@@ -31,6 +31,7 @@
 #define UI_TEXT_SEND_TOKEN_PROMPT "Send %s on %s from %s"
 #define UI_TEXT_BTC_RECEIVER "Receiver #%d"
 #define UI_TEXT_BTC_FEE "Transaction fee"
+#define UI_TEXT_BTC_RECEIVERS_SUMMARY "Send %s\nto %d receivers\nDigest %s"
 #define UI_TEXT_SIGN_PROMPT "Sign %s message on %s from %s"
 #define UI_TEXT_TXN_FEE "Transaction fee"
 #define UI_TEXT_SEND_TXN_FEE "%s %s"
@@ -76,11 +77,11 @@ extern const char *ui_text_mnemonics_number_options[];
 
 // Settings menu text
 #ifdef DEV_BUILD
-#define NUMBER_OF_OPTIONS_SETTINGS 12
+#define NUMBER_OF_OPTIONS_SETTINGS 15
 // TODO: Update after refactor - remove the following MACRO
 #define NUMBER_OF_OPTIONS_ADVANCED_OPTIONS NUMBER_OF_OPTIONS_SETTINGS
 #else
-#define NUMBER_OF_OPTIONS_SETTINGS 11
+#define NUMBER_OF_OPTIONS_SETTINGS 14
 // TODO: Update after refactor - remove the following MACRO
 #define NUMBER_OF_OPTIONS_ADVANCED_OPTIONS NUMBER_OF_OPTIONS_SETTINGS
 #endif /* DEV_BUILD*/
@@ -89,6 +90,13 @@ extern const char *ui_text_options_settings[NUMBER_OF_OPTIONS_SETTINGS];
 extern const char *ui_text_rotate_display_confirm;
 extern const char *ui_text_options_logging_export[];
 extern const char *ui_text_options_passphrase[];
+extern const char *ui_text_options_seed_session[];
+extern const char *ui_text_options_review_mode[];
+extern const char *ui_text_options_xpub_cache[];
+
+#define NUMBER_OF_OPTIONS_RECEIVERS_REVIEW 2
+extern const char *ui_text_btc_receivers;
+extern const char *ui_text_options_receivers_review[];
 
 extern const char *ui_text_pair_card_confirm;
 extern const char *ui_text_card_pairing_success;
@@ -269,6 +277,14 @@ extern const char *ui_text_replace_account;
 extern const char *ui_text_confirm_account;
 extern const char *ui_text_near_transfer_action_type;
 extern const char *ui_text_near_create_account_method;
+extern const char *ui_text_near_stake_action_type;
+extern const char *ui_text_near_add_key_action_type;
+extern const char *ui_text_near_delete_key_action_type;
+extern const char *ui_text_near_delete_account_action_type;
+extern const char *ui_text_near_full_access;
+extern const char *ui_text_verify_public_key;
+extern const char *ui_text_verify_permission;
+extern const char *ui_text_verify_beneficiary;
 
 // headings card flow
 extern const char *ui_text_family_id_hex;
@@ -310,6 +326,9 @@ extern const char *ui_text_authentication_required;
 extern const char *ui_text_start_auth_from_CySync;
 extern const char *ui_text_enable_passphrase_step;
 extern const char *ui_text_disable_passphrase_step;
+extern const char *ui_text_enable_seed_session;
+extern const char *ui_text_enable_summary_review;
+extern const char *ui_text_enable_xpub_cache;
 extern const char *ui_text_warning_txn_fee_too_high;
 extern const char *ui_text_enable_log_export;
 extern const char *ui_text_disable_log_export;
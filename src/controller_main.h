@@ -315,7 +315,7 @@ void mark_event_cancel();
  * @details This functions sets the 1 to all flow_level levels and sets
  * Counter.level to LEVEL_ONE. Sets the Counter.next_event_flag to true and
  * makes the device state as ready. The Wallet.password_double_hash is cleared
- * and a call cy_free() releases all the allocated memory on heap using
+ * and a call cy_free() zeroizes and releases all the memory allocated with
  * cy_malloc().
  *
  * @see counter, flow_level, Wallet.password_double_hash, mark_device_state(),
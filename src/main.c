@@ -83,6 +83,7 @@
                             issue*/
 #include "application_startup.h"
 #include "board.h"
+#include "boot_profile.h"
 #include "logger.h"
 #include "onboarding.h"
 #include "stdio.h"
@@ -148,9 +149,12 @@ int main(void) {
     logo_scr_init(2000);
     device_provision_check();
   }
+  boot_profile_mark(BOOT_STAGE_SPLASH);
 
   while (1) {
     engine_ctx_t *main_engine_ctx = get_core_flow_ctx();
+    // the device is ready once the first flow is chosen
+    boot_profile_mark(BOOT_STAGE_FLOW_INIT);
     engine_run(main_engine_ctx);
   }
 #else /* RUN_ENGINE */
@@ -193,6 +197,7 @@ int main(void) {
 void Error_Handler(void) {
   /* USER CODE BEGIN Error_Handler_Debug */
   /* User can add his own implementation to report the HAL error return state */
+  logger_flush();
   __disable_irq();
   while (1) {
   }
@@ -66,9 +66,13 @@
 
 #include "app_registry.h"
 #include "core_api.h"
+#include "flow_trace.h"
 #include "main_menu.h"
+#include "mem_diag.h"
 #include "manager_app.h"
+#include "session_bench.h"
 #include "status_api.h"
+#include "utils.h"
 
 /*****************************************************************************
  * EXTERN VARIABLES
@@ -109,7 +113,19 @@ void main_menu_host_interface(engine_ctx_t *ctx,
   const cy_app_desc_t *desc = registry_get_app_desc(applet_id);
 
   if (NULL != desc) {
-    desc->app(usb_evt, desc->app_config);
+    mem_diag_flow_begin(desc->id);
+    flow_trace_begin(desc->id);
+#ifdef SESSION_BENCH
+    session_bench_flow_begin(desc->id);
+#endif
+    registry_dispatch(desc, usb_evt);
+#ifdef SESSION_BENCH
+    session_bench_flow_end();
+#endif
+    flow_trace_end();
+    mem_diag_flow_end();
+    // release the decoded queries along with the UI allocations of the app
+    cy_free();
 
     /**
      * Only set main menu update true when an app is triggered. Else no display
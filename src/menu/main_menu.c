@@ -61,6 +61,7 @@
  *****************************************************************************/
 #include "main_menu.h"
 
+#include "application_startup.h"
 #include "constant_texts.h"
 #include "core_error_priv.h"
 #include "create_wallet_menu.h"
@@ -245,6 +246,12 @@ static void main_menu_reset_context(void) {
  * GLOBAL FUNCTIONS
  *****************************************************************************/
 void main_menu_initialize(engine_ctx_t *ctx, const void *data_ptr) {
+  /* The wallet checks run in the idle time of the main menu; their screens
+   * replace the main menu, which then needs to be rendered again */
+  if (show_startup_check_findings()) {
+    main_menu_set_update_req(true);
+  }
+
   handle_core_errors();
 
   /* First check if we even require to update the content on the main menu. This
@@ -65,6 +65,7 @@
 #include "core_error_priv.h"
 #include "flash_api.h"
 #include "menu_priv.h"
+#include "seed_session.h"
 #include "settings_api.h"
 #include "ui_screens.h"
 
@@ -91,6 +92,9 @@ typedef enum {
   VIEW_CARD_VERSION,
   VIEW_REGULATORY_INFO,
   PAIR_CARD,
+  TOGGLE_SEED_SESSION,
+  TOGGLE_SUMMARY_REVIEW,
+  TOGGLE_XPUB_CACHE,
 #ifdef DEV_BUILD
   TOGGLE_BUZZER,
 #endif
@@ -169,6 +173,18 @@ static void settings_menu_initialize(engine_ctx_t *ctx, const void *data_ptr) {
       (char *)(is_passphrase_enabled() ? ui_text_options_passphrase[0]
                                        : ui_text_options_passphrase[1]);
 
+  ui_text_options_settings[TOGGLE_SEED_SESSION - 1] =
+      (char *)(seed_session_is_enabled() ? ui_text_options_seed_session[0]
+                                         : ui_text_options_seed_session[1]);
+
+  ui_text_options_settings[TOGGLE_SUMMARY_REVIEW - 1] =
+      (char *)(is_summary_review_enabled() ? ui_text_options_review_mode[0]
+                                           : ui_text_options_review_mode[1]);
+
+  ui_text_options_settings[TOGGLE_XPUB_CACHE - 1] =
+      (char *)(is_xpub_cache_enabled() ? ui_text_options_xpub_cache[0]
+                                       : ui_text_options_xpub_cache[1]);
+
   menu_init((const char **)ui_text_options_settings,
             NUMBER_OF_OPTIONS_SETTINGS,
             ui_text_heading_settings,
@@ -225,6 +241,18 @@ static void settings_menu_handler(engine_ctx_t *ctx,
         pair_x1_cards();
         break;
       }
+      case TOGGLE_SEED_SESSION: {
+        toggle_seed_session();
+        break;
+      }
+      case TOGGLE_SUMMARY_REVIEW: {
+        toggle_summary_review();
+        break;
+      }
+      case TOGGLE_XPUB_CACHE: {
+        toggle_xpub_cache();
+        break;
+      }
       default: {
         // TODO: Handle all cases
         break;
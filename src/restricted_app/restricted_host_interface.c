@@ -62,9 +62,12 @@
 #include "restricted_host_interface.h"
 
 #include "core_api.h"
+#include "flow_trace.h"
 #include "manager_app.h"
+#include "mem_diag.h"
 #include "status_api.h"
 #include "ui_screens.h"
+#include "utils.h"
 
 /*****************************************************************************
  * EXTERN VARIABLES
@@ -107,7 +110,13 @@ void restricted_host_interface(engine_ctx_t *ctx,
   const cy_app_desc_t *desc = get_restricted_manager_app_desc();
 
   if (NULL != desc && applet_id == desc->id) {
-    desc->app(usb_evt, desc->app_config);
+    mem_diag_flow_begin(desc->id);
+    flow_trace_begin(desc->id);
+    registry_dispatch(desc, usb_evt);
+    flow_trace_end();
+    mem_diag_flow_end();
+    // release the decoded queries along with the UI allocations of the app
+    cy_free();
   } else {
     send_core_error_msg_to_host(CORE_UNKNOWN_APP);
   }
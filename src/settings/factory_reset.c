@@ -64,6 +64,7 @@
 #include <stdint.h>
 #include <string.h>
 
+#include "apdu.h"
 #include "card_operations.h"
 #include "coin_specific_data.h"
 #include "constant_texts.h"
@@ -322,6 +323,7 @@ void factory_reset(void) {
   }
 
   sec_flash_erase();
+  invalidate_session_key_cache();
   flash_erase();
   erase_flash_coin_specific_data();
   logger_reset_flash();
@@ -359,6 +361,7 @@ void clear_device_data(void) {
   }
 
   sec_flash_erase();
+  invalidate_session_key_cache();
   flash_clear_user_data();
   erase_flash_coin_specific_data();
   logger_reset_flash();
@@ -50,6 +50,29 @@ void toggle_log_export(void);
  */
 void toggle_passphrase(void);
 
+/**
+ * @brief This function enables/disables the session unlock, which keeps the
+ * seed of the last reconstructed wallet in RAM for back-to-back requests. The
+ * setting is not saved in flash.
+ *
+ */
+void toggle_seed_session(void);
+
+/**
+ * @brief This function enables/disables the summarized review of transactions
+ * with many receivers. The setting is saved in flash.
+ *
+ */
+void toggle_summary_review(void);
+
+/**
+ * @brief This function enables/disables the flash cache of account public
+ * nodes used to show receive addresses without a card tap. The setting is
+ * saved in flash; disabling it drops the cached nodes.
+ *
+ */
+void toggle_xpub_cache(void);
+
 /**
  * @brief This function configures the X1 vault to switch between left and right
  * handed view
@@ -65,9 +65,11 @@
 #include "constant_texts.h"
 #include "flash_api.h"
 #include "flash_struct.h"
+#include "seed_session.h"
 #include "settings_api.h"
 #include "ui_core_confirm.h"
 #include "ui_screens.h"
+#include "xpub_cache.h"
 
 /*****************************************************************************
  * EXTERN VARIABLES
@@ -133,6 +135,46 @@ void toggle_passphrase(void) {
   return;
 }
 
+void toggle_seed_session(void) {
+  if (seed_session_is_enabled()) {
+    seed_session_set_enabled(false);
+    return;
+  }
+
+  if (core_confirmation(ui_text_enable_seed_session, NULL)) {
+    seed_session_set_enabled(true);
+  }
+
+  return;
+}
+
+void toggle_summary_review(void) {
+  if (is_summary_review_enabled()) {
+    set_review_mode(REVIEW_MODE_DETAILED, FLASH_SAVE_NOW);
+    return;
+  }
+
+  if (core_confirmation(ui_text_enable_summary_review, NULL)) {
+    set_review_mode(REVIEW_MODE_SUMMARY, FLASH_SAVE_NOW);
+  }
+
+  return;
+}
+
+void toggle_xpub_cache(void) {
+  if (is_xpub_cache_enabled()) {
+    set_xpub_cache(XPUB_CACHE_DISABLED, FLASH_SAVE_NOW);
+    xpub_cache_clear();
+    return;
+  }
+
+  if (core_confirmation(ui_text_enable_xpub_cache, NULL)) {
+    set_xpub_cache(XPUB_CACHE_ENABLED, FLASH_SAVE_NOW);
+  }
+
+  return;
+}
+
 void rotate_display(void) {
   if (core_confirmation(ui_text_rotate_display_confirm, NULL)) {
     ui_rotate();
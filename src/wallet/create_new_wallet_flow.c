@@ -260,7 +260,7 @@ new_wallet_state_e new_wallet_state_handler(new_wallet_state_e current_state) {
         break;
       }
 
-      uint8_t CONFIDENTIAL temp[SHA256_DIGEST_LENGTH] = {0};
+      uint8_t temp[SHA256_DIGEST_LENGTH] = {0};
       sha256_Raw((uint8_t *)flow_level.screen_input.input_text,
                  strnlen(flow_level.screen_input.input_text,
                          sizeof(flow_level.screen_input.input_text)),
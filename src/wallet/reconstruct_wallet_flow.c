@@ -66,6 +66,9 @@
 #include "common_error.h"
 #include "constant_texts.h"
 #include "core_error.h"
+#include "events.h"
+#include "seed_session.h"
+#include "session_bench.h"
 #include "sha2.h"
 #include "shamir_wrapper.h"
 #include "status_api.h"
@@ -91,6 +94,8 @@ extern Wallet wallet;
 /*****************************************************************************
  * PRIVATE MACROS AND DEFINES
  *****************************************************************************/
+/// Passphrase, card tap and seed reconstruction, see core_status_set_progress()
+#define RECONSTRUCT_PROGRESS_STEPS 3
 
 /*****************************************************************************
  * PRIVATE TYPEDEFS
@@ -165,6 +170,19 @@ static const char *generate_mnemonics_and_verify_wallet(
     const uint8_t *secret,
     const uint8_t *wallet_id);
 
+/**
+ * @brief Takes the passphrase input of the wallet ahead of the card tap
+ * @details The seeds cached by the seed session are keyed by the passphrase,
+ * hence it is needed before the cache can be looked up. The passphrase is
+ * stored in wallet_credential_data; it stays empty if the wallet has none.
+ *
+ * @param wallet_id The wallet_id of the wallet
+ * @param reject_cb Callback to execute if the user rejects the input
+ * @return true If the passphrase step completed
+ * @return false If the wallet is not usable or the input was rejected
+ */
+static bool input_passphrase(const uint8_t *wallet_id, rejection_cb *reject_cb);
+
 /*****************************************************************************
  * STATIC VARIABLES
  *****************************************************************************/
@@ -184,6 +202,8 @@ static reconstruct_state_e reconstruct_wallet_handler(reconstruct_state_e state,
   switch (state) {
     case PASSPHRASE_INPUT: {
       set_core_flow_status(COMMON_SEED_GENERATION_STATUS_INIT);
+      core_status_set_progress(
+          CORE_PROGRESS_RECONSTRUCT, 0, RECONSTRUCT_PROGRESS_STEPS);
       if (!WALLET_IS_PASSPHRASE_SET(wallet.wallet_info)) {
         next_state = PIN_INPUT;
         break;
@@ -216,6 +236,8 @@ static reconstruct_state_e reconstruct_wallet_handler(reconstruct_state_e state,
                  "%s",
                  flow_level.screen_input.input_text);
         set_core_flow_status(COMMON_SEED_GENERATION_STATUS_PASSPHRASE);
+        core_status_set_progress(
+            CORE_PROGRESS_RECONSTRUCT, 1, RECONSTRUCT_PROGRESS_STEPS);
         next_state = PIN_INPUT;
       }
 
@@ -258,6 +280,8 @@ static reconstruct_state_e reconstruct_wallet_handler(reconstruct_state_e state,
 
       if (CARD_OPERATION_SUCCESS == card_status) {
         set_core_flow_status(COMMON_SEED_GENERATION_STATUS_PIN_CARD);
+        core_status_set_progress(
+            CORE_PROGRESS_RECONSTRUCT, 2, RECONSTRUCT_PROGRESS_STEPS);
         next_state = RECONSTRUCT_SEED;
       } else if (CARD_OPERATION_INCORRECT_PIN_ENTERED == card_status) {
         next_state = PIN_INPUT;
@@ -283,25 +307,36 @@ static reconstruct_state_e reconstruct_wallet_handler(reconstruct_state_e state,
 
     case RECONSTRUCT_SEED: {
       instruction_scr_init(ui_text_processing, NULL);
-      wallet_shamir_data.share_x_coords[1] = 5;
+      wallet_shamir_data.share_x_coords[1] = DEVICE_SHARE_X_COORD;
       get_flash_wallet_share_by_name((const char *)wallet.wallet_name,
                                      wallet_shamir_data.mnemonic_shares[1]);
       memcpy(wallet_shamir_data.share_encryption_data[1],
              wallet_shamir_data.share_encryption_data[0],
              PADDED_NONCE_SIZE + WALLET_MAC_SIZE);
 
-      if (WALLET_IS_PIN_SET(wallet.wallet_info)) {
-        decrypt_shares();
+      // only the card share carries a MAC; on a mismatch the secret is left
+      // blank, which fails the wallet verification that follows
+      if (WALLET_IS_PIN_SET(wallet.wallet_info) &&
+          !decrypt_shares(0x03, 0x01)) {
+        LOG_CRITICAL("xxx42");
+      } else if (!recover_secret_from_device_share(
+              BLOCK_SIZE,
+              wallet_shamir_data.mnemonic_shares[0],
+              wallet_shamir_data.share_x_coords[0],
+              wallet_shamir_data.mnemonic_shares[1],
+              secret_out)) {
+        recover_secret_from_shares(BLOCK_SIZE,
+                                   MINIMUM_NO_OF_SHARES,
+                                   wallet_shamir_data.mnemonic_shares,
+                                   wallet_shamir_data.share_x_coords,
+                                   secret_out);
       }
 
-      recover_secret_from_shares(BLOCK_SIZE,
-                                 MINIMUM_NO_OF_SHARES,
-                                 wallet_shamir_data.mnemonic_shares,
-                                 wallet_shamir_data.share_x_coords,
-                                 secret_out);
-
       memzero(wallet_shamir_data.mnemonic_shares,
               sizeof(wallet_shamir_data.mnemonic_shares));
+      core_status_set_progress(CORE_PROGRESS_RECONSTRUCT,
+                               RECONSTRUCT_PROGRESS_STEPS,
+                               RECONSTRUCT_PROGRESS_STEPS);
       next_state = COMPLETED;
       break;
     }
@@ -376,6 +411,25 @@ static const char *reconstruct_wallet(const uint8_t *wallet_id,
   return mnemonics;
 }
 
+static bool input_passphrase(const uint8_t *wallet_id,
+                             rejection_cb *reject_cb) {
+  if (!get_wallet_data_by_id(wallet_id, &wallet, reject_cb)) {
+    return false;
+  }
+
+  // the passphrase states hand over to PIN_INPUT once done
+  reconstruct_state_e state = PASSPHRASE_INPUT;
+  while (PIN_INPUT != state && COMPLETED > state) {
+    state = reconstruct_wallet_handler(state, NULL, reject_cb);
+  }
+
+  if (reject_cb && EARLY_EXIT == state) {
+    reject_cb(ERROR_COMMON_ERROR_USER_REJECTION_TAG,
+              ERROR_USER_REJECTION_CONFIRMATION);
+  }
+  return PIN_INPUT == state;
+}
+
 /*****************************************************************************
  * GLOBAL FUNCTIONS
  *****************************************************************************/
@@ -387,16 +441,43 @@ bool reconstruct_seed(const uint8_t *wallet_id,
   }
 
   uint8_t result = false;
+  reconstruct_state_e init_state = PASSPHRASE_INPUT;
 
   clear_wallet_data();
   mnemonic_clear();
 
-  const char *mnemonics =
-      reconstruct_wallet(wallet_id, PASSPHRASE_INPUT, reject_cb);
+#ifdef SESSION_BENCH
+  // signs with the test seed; the benchmark build runs without cards
+  mnemonic_to_seed(SESSION_BENCH_MNEMONIC, "", seed_out, NULL);
+  return true;
+#endif
+
+  // back-to-back requests in a user enabled session skip the card tap
+  if (seed_session_has_wallet(wallet_id)) {
+    if (!input_passphrase(wallet_id, reject_cb)) {
+      clear_wallet_data();
+      return false;
+    }
 
-  if (NULL != mnemonics) {
-    mnemonic_to_seed(
-        mnemonics, wallet_credential_data.passphrase, seed_out, NULL);
+    if (seed_session_fetch(
+            wallet_id, wallet_credential_data.passphrase, seed_out)) {
+      clear_wallet_data();
+      return true;
+    }
+    init_state = PIN_INPUT;
+  }
+
+  const char *mnemonics = reconstruct_wallet(wallet_id, init_state, reject_cb);
+
+  // an abort while the seed is derived is handled by the core once the flow
+  // returns
+  if (NULL != mnemonics &&
+      mnemonic_to_seed_cancellable(mnemonics,
+                                   wallet_credential_data.passphrase,
+                                   seed_out,
+                                   NULL,
+                                   events_p0_pending)) {
+    seed_session_store(wallet_id, wallet_credential_data.passphrase, seed_out);
     result = true;
   }
 
@@ -40,7 +40,9 @@
  * corresponding to wallet with wallet_id, reads the wallet shares from the X1
  * vault flash and any 1 X1 card, and reconstructs each seed using Shamir
  * reconstruction. The function informs the host in case of any early exit or
- * card abort errors
+ * card abort errors. If the seed session mode is enabled, the seed is cached
+ * and the next requests for the same wallet & passphrase are served from
+ * @ref seed_session_fetch after only the passphrase input.
  *
  * @param wallet_id The wallet_id of the wallet which needs to be reconstructed
  * @param seed_out Pointer to buffer where the seed will be copied after
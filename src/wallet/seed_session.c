@@ -0,0 +1,324 @@
+/**
+ * @file    seed_session.c
+ * @author  Cypherock X1 Team
+ * @brief   In-RAM cache of reconstructed wallet seeds for back-to-back signing
+ * @copyright Copyright (c) 2023 HODL TECH PTE LTD
+ * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
+ *target=_blank>https://mitcc.org/</a>
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * (c) Copyright 2023 by HODL TECH PTE LTD
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * "Commons Clause" License Condition v1.0
+ *
+ * The Software is provided to you by the Licensor under the License,
+ * as defined below, subject to the following condition.
+ *
+ * Without limiting other conditions in the License, the grant of
+ * rights under the License will not include, and the License does not
+ * grant to you, the right to Sell the Software.
+ *
+ * For purposes of the foregoing, "Sell" means practicing any or all
+ * of the rights granted to you under the License to provide to third
+ * parties, for a fee or other consideration (including without
+ * limitation fees for hosting or consulting/ support services related
+ * to the Software), a product or service whose value derives, entirely
+ * or substantially, from the functionality of the Software. Any license
+ * notice or attribution required by the License must also include
+ * this Commons Clause License Condition notice.
+ *
+ * Software: All X1Wallet associated files.
+ * License: MIT
+ * Licensor: HODL TECH PTE LTD
+ *
+ ******************************************************************************
+ */
+
+/*****************************************************************************
+ * INCLUDES
+ *****************************************************************************/
+#include "seed_session.h"
+
+#include <string.h>
+
+#include "bip32.h"
+#include "board.h"
+#include "coin_utils.h"
+#include "hmac.h"
+#include "memzero.h"
+#include "options.h"
+#include "task_scheduler.h"
+#include "utils.h"
+#include "wallet.h"
+
+/*****************************************************************************
+ * EXTERN VARIABLES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * PRIVATE MACROS AND DEFINES
+ *****************************************************************************/
+/// Time given to the expiry check per scheduler slice
+#define SEED_SESSION_SLICE_MS 1
+
+_Static_assert(HD_SESSION_CACHE_SEEDS >= SEED_SESSION_MAX_ENTRIES,
+               "derivation cache cannot hold every seed of the session");
+
+/*****************************************************************************
+ * PRIVATE TYPEDEFS
+ *****************************************************************************/
+typedef struct {
+  bool filled;
+  uint8_t wallet_id[WALLET_ID_SIZE];
+  uint8_t passphrase_hash[SHA256_DIGEST_LENGTH];
+  uint8_t seed[64];
+  uint32_t stored_at;
+  uint8_t uses_left;
+} seed_session_entry_t;
+
+typedef struct {
+  /// Random key of the passphrase hashes; renewed when the cache gets empty
+  uint8_t salt[32];
+  seed_session_entry_t entries[SEED_SESSION_MAX_ENTRIES];
+} seed_session_t;
+
+/*****************************************************************************
+ * STATIC FUNCTION PROTOTYPES
+ *****************************************************************************/
+/**
+ * @brief Scheduler task which wipes the cached seeds once they expire
+ *
+ * @param budget_ms Unused; the check is short
+ * @return false Always, the task has no pending work after the check
+ */
+static bool seed_session_expiry_task(uint32_t budget_ms);
+
+/**
+ * @brief Wipes the entry if it outlived SEED_SESSION_TIMEOUT_MS or has no
+ * uses left
+ *
+ * @param entry The entry to check
+ * @return true If the entry is still usable
+ * @return false If the entry is empty or was wiped
+ */
+static bool seed_session_entry_alive(seed_session_entry_t *entry);
+
+/**
+ * @brief Returns whether any entry is filled
+ */
+static bool seed_session_is_empty(void);
+
+/**
+ * @brief Computes the salted hash of the passphrase
+ *
+ * @param passphrase NULL terminated passphrase
+ * @param hash Buffer of SHA256_DIGEST_LENGTH bytes
+ */
+static void seed_session_hash_passphrase(const char *passphrase,
+                                         uint8_t *hash);
+
+/**
+ * @brief Finds the usable entry of the wallet & passphrase hash
+ *
+ * @param wallet_id The wallet_id of the wallet
+ * @param passphrase_hash Salted hash of the passphrase; NULL to match any
+ * @return seed_session_entry_t* The matching entry, NULL if none
+ */
+static seed_session_entry_t *seed_session_find(const uint8_t *wallet_id,
+                                               const uint8_t *passphrase_hash);
+
+/*****************************************************************************
+ * STATIC VARIABLES
+ *****************************************************************************/
+static bool session_enabled = false;
+static seed_session_t CONFIDENTIAL session = {0};
+
+/*****************************************************************************
+ * GLOBAL VARIABLES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * STATIC FUNCTIONS
+ *****************************************************************************/
+static bool seed_session_entry_alive(seed_session_entry_t *entry) {
+  if (!entry->filled) {
+    return false;
+  }
+
+  if ((uint32_t)(uwTick - entry->stored_at) >= SEED_SESSION_TIMEOUT_MS ||
+      0 == entry->uses_left) {
+    hd_session_cache_forget(entry->seed);
+    memzero(entry, sizeof(seed_session_entry_t));
+    return false;
+  }
+  return true;
+}
+
+static bool seed_session_is_empty(void) {
+  for (uint8_t i = 0; i < SEED_SESSION_MAX_ENTRIES; i++) {
+    if (session.entries[i].filled) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static bool seed_session_expiry_task(uint32_t budget_ms) {
+  for (uint8_t i = 0; i < SEED_SESSION_MAX_ENTRIES; i++) {
+    seed_session_entry_alive(&session.entries[i]);
+  }
+
+  if (seed_session_is_empty()) {
+    seed_session_clear();
+  }
+  return false;
+}
+
+static void seed_session_hash_passphrase(const char *passphrase,
+                                         uint8_t *hash) {
+  hmac_sha256(session.salt,
+              sizeof(session.salt),
+              (const uint8_t *)passphrase,
+              strnlen(passphrase, MAX_PASSPHRASE_INPUT_LENGTH),
+              hash);
+}
+
+static seed_session_entry_t *seed_session_find(const uint8_t *wallet_id,
+                                               const uint8_t *passphrase_hash) {
+  for (uint8_t i = 0; i < SEED_SESSION_MAX_ENTRIES; i++) {
+    seed_session_entry_t *entry = &session.entries[i];
+    if (!seed_session_entry_alive(entry) ||
+        0 != memcmp(entry->wallet_id, wallet_id, WALLET_ID_SIZE)) {
+      continue;
+    }
+
+    if (NULL == passphrase_hash ||
+        0 == memcmp(entry->passphrase_hash,
+                    passphrase_hash,
+                    sizeof(entry->passphrase_hash))) {
+      return entry;
+    }
+  }
+  return NULL;
+}
+
+/*****************************************************************************
+ * GLOBAL FUNCTIONS
+ *****************************************************************************/
+void seed_session_set_enabled(bool enable) {
+  session_enabled = enable;
+  if (!enable) {
+    seed_session_clear();
+  }
+}
+
+bool seed_session_is_enabled(void) {
+  return session_enabled;
+}
+
+void seed_session_store(const uint8_t *wallet_id,
+                        const char *passphrase,
+                        const uint8_t *seed) {
+  if (!session_enabled || NULL == wallet_id || NULL == passphrase ||
+      NULL == seed) {
+    return;
+  }
+
+  if (seed_session_is_empty()) {
+    random_generate(session.salt, sizeof(session.salt));
+  }
+
+  uint8_t passphrase_hash[SHA256_DIGEST_LENGTH] = {0};
+  seed_session_hash_passphrase(passphrase, passphrase_hash);
+
+  // replace the same seed if cached, else take a free or the oldest entry
+  seed_session_entry_t *entry = seed_session_find(wallet_id, passphrase_hash);
+  for (uint8_t i = 0; NULL == entry && i < SEED_SESSION_MAX_ENTRIES; i++) {
+    if (!seed_session_entry_alive(&session.entries[i])) {
+      entry = &session.entries[i];
+    }
+  }
+  if (NULL == entry) {
+    entry = &session.entries[0];
+    for (uint8_t i = 1; i < SEED_SESSION_MAX_ENTRIES; i++) {
+      if ((uint32_t)(uwTick - session.entries[i].stored_at) >
+          (uint32_t)(uwTick - entry->stored_at)) {
+        entry = &session.entries[i];
+      }
+    }
+  }
+
+  if (entry->filled && 0 != memcmp(entry->seed, seed, sizeof(entry->seed))) {
+    hd_session_cache_forget(entry->seed);
+  }
+  memcpy(entry->wallet_id, wallet_id, sizeof(entry->wallet_id));
+  memcpy(entry->passphrase_hash, passphrase_hash, sizeof(passphrase_hash));
+  memcpy(entry->seed, seed, sizeof(entry->seed));
+  // derivations of the seed reuse its hardened nodes while it is cached
+  hd_session_cache_admit(seed);
+  entry->stored_at = uwTick;
+  entry->uses_left = SEED_SESSION_MAX_USES;
+  entry->filled = true;
+  memzero(passphrase_hash, sizeof(passphrase_hash));
+
+  // the idle loop of get_events() runs the task, wiping the seeds on time even
+  // if no further reconstruction is requested
+  sched_add_task(
+      seed_session_expiry_task, SCHED_PRIO_LOW, SEED_SESSION_SLICE_MS);
+}
+
+bool seed_session_has_wallet(const uint8_t *wallet_id) {
+  return (NULL != wallet_id) && (NULL != seed_session_find(wallet_id, NULL));
+}
+
+bool seed_session_fetch(const uint8_t *wallet_id,
+                        const char *passphrase,
+                        uint8_t *seed_out) {
+  if (NULL == wallet_id || NULL == passphrase || NULL == seed_out ||
+      seed_session_is_empty()) {
+    return false;
+  }
+
+  uint8_t passphrase_hash[SHA256_DIGEST_LENGTH] = {0};
+  seed_session_hash_passphrase(passphrase, passphrase_hash);
+  seed_session_entry_t *entry = seed_session_find(wallet_id, passphrase_hash);
+  memzero(passphrase_hash, sizeof(passphrase_hash));
+
+  if (NULL == entry) {
+    return false;
+  }
+
+  memcpy(seed_out, entry->seed, sizeof(entry->seed));
+  entry->uses_left--;
+  seed_session_entry_alive(entry);
+  return true;
+}
+
+void seed_session_clear(void) {
+  sched_remove_task(seed_session_expiry_task);
+  hd_session_cache_clear();
+  hdnode_ckd_hmac_cache_clear();
+  memzero(&session, sizeof(session));
+}
@@ -0,0 +1,101 @@
+/**
+ * @file    seed_session.h
+ * @author  Cypherock X1 Team
+ * @brief   Header file for the in-RAM wallet seed session
+ * @copyright Copyright (c) 2023 HODL TECH PTE LTD
+ * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
+ * target=_blank>https://mitcc.org/</a>
+ */
+#ifndef SEED_SESSION_H
+#define SEED_SESSION_H
+
+/*****************************************************************************
+ * INCLUDES
+ *****************************************************************************/
+#include <stdbool.h>
+#include <stdint.h>
+
+/*****************************************************************************
+ * MACROS AND DEFINES
+ *****************************************************************************/
+/// Time after which a cached seed is wiped, counted from the card tap
+#define SEED_SESSION_TIMEOUT_MS (5 * 60 * 1000)
+/// Number of reconstructions served from a cached seed before it is wiped
+#define SEED_SESSION_MAX_USES 10
+/// Number of (wallet, passphrase) seeds cached at the same time
+#define SEED_SESSION_MAX_ENTRIES 4
+
+/*****************************************************************************
+ * TYPEDEFS
+ *****************************************************************************/
+
+/*****************************************************************************
+ * EXPORTED VARIABLES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * GLOBAL FUNCTION PROTOTYPES
+ *****************************************************************************/
+/**
+ * @brief Enables or disables the seed session mode
+ * @details The mode is kept in RAM only, so every power cycle starts with the
+ * mode disabled. Disabling the mode wipes the cached seeds.
+ *
+ * @param enable Whether the seeds should be cached after a reconstruction
+ */
+void seed_session_set_enabled(bool enable);
+
+/**
+ * @brief Returns whether the seed session mode is enabled
+ */
+bool seed_session_is_enabled(void);
+
+/**
+ * @brief Caches the seed of a wallet if the seed session mode is enabled
+ * @details The seed is keyed by the wallet_id and a salted hash of the
+ * passphrase, so that the hidden wallets of a wallet are cached separately. If
+ * all SEED_SESSION_MAX_ENTRIES are in use, the oldest seed is replaced. Each
+ * seed is wiped on SEED_SESSION_TIMEOUT_MS, after SEED_SESSION_MAX_USES
+ * fetches, or by @ref seed_session_clear. The nodes derived from the seed are
+ * cached alongside it (see hd_session_cache_admit) and wiped with it.
+ *
+ * @param wallet_id The wallet_id of the wallet the seed belongs to
+ * @param passphrase NULL terminated passphrase the seed was derived with; empty
+ * if the wallet has no passphrase
+ * @param seed 64 byte seed of the wallet
+ */
+void seed_session_store(const uint8_t *wallet_id,
+                        const char *passphrase,
+                        const uint8_t *seed);
+
+/**
+ * @brief Returns whether any seed of the wallet is cached
+ * @details Used to decide if the passphrase should be asked before the card
+ * tap, as the passphrase is needed to look up the cached seed.
+ *
+ * @param wallet_id The wallet_id of the wallet
+ */
+bool seed_session_has_wallet(const uint8_t *wallet_id);
+
+/**
+ * @brief Copies the cached seed of the wallet & passphrase, if present and not
+ * expired
+ * @details Each successful fetch uses up one of the SEED_SESSION_MAX_USES.
+ *
+ * @param wallet_id The wallet_id of the wallet whose seed is requested
+ * @param passphrase NULL terminated passphrase of the requested seed
+ * @param seed_out Buffer of 64 bytes for the seed
+ * @return true If the seed was copied to seed_out
+ * @return false If no valid seed of the wallet & passphrase is cached
+ */
+bool seed_session_fetch(const uint8_t *wallet_id,
+                        const char *passphrase,
+                        uint8_t *seed_out);
+
+/**
+ * @brief Wipes all the cached seeds, if any, along with the nodes and the
+ * BIP32 pad digests derived from them
+ */
+void seed_session_clear(void);
+
+#endif /* SEED_SESSION_H */
@@ -176,7 +176,15 @@ static sync_state_e sync_wallet_handler(sync_state_e state) {
         memcpy(temp_password_hash,
                wallet_credential_data.password_single_hash,
                SHA256_DIGEST_LENGTH);
-        decrypt_shares();
+        // only the shares of the two cards tapped are needed
+        if (!decrypt_shares(0x03, 0x03)) {
+          LOG_CRITICAL("xxx41");
+          memzero(temp_password_hash, sizeof(temp_password_hash));
+          memzero(wallet_shamir_data.mnemonic_shares,
+                  sizeof(wallet_shamir_data.mnemonic_shares));
+          next_state = SYNC_COMPLETED_WITH_ERRORS;
+          break;
+        }
       }
 
       recover_share_from_shares(BLOCK_SIZE,
@@ -103,9 +103,8 @@ static void view_seed_handler(const uint8_t *wallet_id);
  * STATIC FUNCTIONS
  *****************************************************************************/
 static void view_seed_handler(const uint8_t *wallet_id) {
-  CONFIDENTIAL char mnemonics[MAX_NUMBER_OF_MNEMONIC_WORDS]
-                             [MAX_MNEMONIC_WORD_LENGTH] = {0};
-  CONFIDENTIAL uint8_t no_of_mnemonics = 0;
+  char mnemonics[MAX_NUMBER_OF_MNEMONIC_WORDS][MAX_MNEMONIC_WORD_LENGTH] = {0};
+  uint8_t no_of_mnemonics = 0;
 
   do {
     if (!core_scroll_page(NULL, ui_text_view_seed_messages, NULL)) {
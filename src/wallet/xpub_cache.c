@@ -0,0 +1,353 @@
+/**
+ * @file    xpub_cache.c
+ * @author  Cypherock X1 Team
+ * @brief   Flash cache of account public nodes for tapless address display
+ * @copyright Copyright (c) 2023 HODL TECH PTE LTD
+ * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
+ *target=_blank>https://mitcc.org/</a>
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * (c) Copyright 2023 by HODL TECH PTE LTD
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * "Commons Clause" License Condition v1.0
+ *
+ * The Software is provided to you by the Licensor under the License,
+ * as defined below, subject to the following condition.
+ *
+ * Without limiting other conditions in the License, the grant of
+ * rights under the License will not include, and the License does not
+ * grant to you, the right to Sell the Software.
+ *
+ * For purposes of the foregoing, "Sell" means practicing any or all
+ * of the rights granted to you under the License to provide to third
+ * parties, for a fee or other consideration (including without
+ * limitation fees for hosting or consulting/ support services related
+ * to the Software), a product or service whose value derives, entirely
+ * or substantially, from the functionality of the Software. Any license
+ * notice or attribution required by the License must also include
+ * this Commons Clause License Condition notice.
+ *
+ * Software: All X1Wallet associated files.
+ * License: MIT
+ * Licensor: HODL TECH PTE LTD
+ *
+ ******************************************************************************
+ */
+
+
+/*****************************************************************************
+ * INCLUDES
+ *****************************************************************************/
+#include "xpub_cache.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#include "coin_specific_data.h"
+#include "curves.h"
+#include "flash_api.h"
+#include "hmac.h"
+#include "memzero.h"
+#include "wallet.h"
+
+/*****************************************************************************
+ * EXTERN VARIABLES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * PRIVATE MACROS AND DEFINES
+ *****************************************************************************/
+/// Layout version of xpub_cache_record_t
+#define XPUB_CACHE_VERSION 1
+/// Label of the key authenticating the records, derived from the device key
+#define XPUB_CACHE_KEY_LABEL "xpub cache"
+/// Coin specific data slot the records are kept under
+#define XPUB_CACHE_COIN_TYPE COIN_TYPE_BITCOIN
+
+/*****************************************************************************
+ * PRIVATE TYPEDEFS
+ *****************************************************************************/
+#pragma pack(push, 1)
+typedef struct {
+  uint32_t path[XPUB_CACHE_ACCOUNT_DEPTH];
+  uint8_t chain_code[32];
+  uint8_t public_key[33];
+} xpub_cache_entry_t;
+
+typedef struct {
+  uint8_t version;
+  uint8_t count;    ///< Filled entries, the newest last
+  xpub_cache_entry_t entries[XPUB_CACHE_MAX_ACCOUNTS];
+  uint8_t mac[SHA256_DIGEST_LENGTH];
+} xpub_cache_record_t;
+#pragma pack(pop)
+
+/// The flash is read in words, hence the record is kept word aligned
+typedef union {
+  xpub_cache_record_t record;
+  uint32_t words[(sizeof(xpub_cache_record_t) + 3) / 4];
+} xpub_cache_buffer_t;
+
+_Static_assert(sizeof(xpub_cache_buffer_t) <= MAX_COIN_DATA_LENGTH,
+               "xpub cache record exceeds the coin specific data limit");
+
+/*****************************************************************************
+ * STATIC FUNCTION PROTOTYPES
+ *****************************************************************************/
+/**
+ * @brief Computes the MAC of the record of the wallet
+ * @details HMAC-SHA256 over the wallet_id and the record up to the MAC, keyed
+ * by HMAC-SHA256(device private key, XPUB_CACHE_KEY_LABEL).
+ *
+ * @param wallet_id The wallet_id the record belongs to
+ * @param record The record to authenticate
+ * @param mac Buffer of SHA256_DIGEST_LENGTH bytes
+ */
+static void xpub_cache_mac(const uint8_t *wallet_id,
+                           const xpub_cache_record_t *record,
+                           uint8_t *mac);
+
+/**
+ * @brief Reads and authenticates the record of the wallet
+ *
+ * @param wallet_id The wallet_id of the wallet
+ * @param buffer Storage for the record
+ * @return true If an authentic record of the current version was read
+ * @return false Otherwise; buffer then holds an empty record
+ */
+static bool xpub_cache_load(const uint8_t *wallet_id,
+                            xpub_cache_buffer_t *buffer);
+
+/**
+ * @brief Authenticates and writes the record of the wallet
+ *
+ * @param wallet_id The wallet_id of the wallet
+ * @param buffer The record to write
+ * @return bool Whether the record was written
+ */
+static bool xpub_cache_save(const uint8_t *wallet_id,
+                            xpub_cache_buffer_t *buffer);
+
+/**
+ * @brief Finds the entry of the account in the record
+ *
+ * @param record The record to search
+ * @param path Derivation path of the account, XPUB_CACHE_ACCOUNT_DEPTH levels
+ * @return int Index of the entry, -1 if the account is not cached
+ */
+static int xpub_cache_find(const xpub_cache_record_t *record,
+                           const uint32_t *path);
+
+/*****************************************************************************
+ * STATIC VARIABLES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * GLOBAL VARIABLES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * STATIC FUNCTIONS
+ *****************************************************************************/
+static void xpub_cache_mac(const uint8_t *wallet_id,
+                           const xpub_cache_record_t *record,
+                           uint8_t *mac) {
+  uint8_t key[SHA256_DIGEST_LENGTH] = {0};
+  HMAC_SHA256_CTX ctx = {0};
+
+  hmac_sha256(get_priv_key(),
+              32,
+              (const uint8_t *)XPUB_CACHE_KEY_LABEL,
+              sizeof(XPUB_CACHE_KEY_LABEL) - 1,
+              key);
+  hmac_sha256_Init(&ctx, key, sizeof(key));
+  hmac_sha256_Update(&ctx, wallet_id, WALLET_ID_SIZE);
+  hmac_sha256_Update(&ctx,
+                     (const uint8_t *)record,
+                     offsetof(xpub_cache_record_t, mac));
+  hmac_sha256_Final(&ctx, mac);
+  memzero(key, sizeof(key));
+}
+
+static bool xpub_cache_load(const uint8_t *wallet_id,
+                            xpub_cache_buffer_t *buffer) {
+  Coin_Specific_Data_Struct csd = {.coin_type = XPUB_CACHE_COIN_TYPE,
+                                   .coin_data = (uint8_t *)buffer->words};
+  uint8_t mac[SHA256_DIGEST_LENGTH] = {0};
+  uint16_t length = 0;
+  bool status = false;
+
+  memcpy(csd.wallet_id, wallet_id, WALLET_ID_SIZE);
+  if (CSD_STATUS_OK == get_coin_data(&csd, sizeof(*buffer), &length) &&
+      sizeof(xpub_cache_record_t) == length &&
+      XPUB_CACHE_VERSION == buffer->record.version &&
+      XPUB_CACHE_MAX_ACCOUNTS >= buffer->record.count) {
+    xpub_cache_mac(wallet_id, &buffer->record, mac);
+    status = (0 == memcmp(mac, buffer->record.mac, sizeof(mac)));
+  }
+
+  if (!status) {
+    memzero(buffer, sizeof(*buffer));
+    buffer->record.version = XPUB_CACHE_VERSION;
+  }
+  return status;
+}
+
+static bool xpub_cache_save(const uint8_t *wallet_id,
+                            xpub_cache_buffer_t *buffer) {
+  Coin_Specific_Data_Struct csd = {.coin_type = XPUB_CACHE_COIN_TYPE,
+                                   .coin_data = (uint8_t *)buffer->words};
+
+  memcpy(csd.wallet_id, wallet_id, WALLET_ID_SIZE);
+  xpub_cache_mac(wallet_id, &buffer->record, buffer->record.mac);
+  return CSD_STATUS_OK == set_coin_data(&csd, sizeof(xpub_cache_record_t));
+}
+
+static int xpub_cache_find(const xpub_cache_record_t *record,
+                           const uint32_t *path) {
+  for (int i = 0; i < record->count; i++) {
+    if (0 == memcmp(record->entries[i].path,
+                    path,
+                    sizeof(record->entries[i].path))) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+/*****************************************************************************
+ * GLOBAL FUNCTIONS
+ *****************************************************************************/
+bool xpub_cache_is_usable(const uint8_t *wallet_id) {
+  uint8_t index = 0;
+
+  if (NULL == wallet_id || !is_xpub_cache_enabled() ||
+      SUCCESS_ != get_first_matching_index_by_id(wallet_id, &index)) {
+    return false;
+  }
+
+  uint8_t info = get_wallet_info(index);
+  return !WALLET_IS_PIN_SET(info) && !WALLET_IS_PASSPHRASE_SET(info);
+}
+
+bool xpub_cache_path_supported(const uint32_t *path, uint32_t path_length) {
+  if (NULL == path || XPUB_CACHE_ACCOUNT_DEPTH >= path_length) {
+    return false;
+  }
+
+  for (uint32_t i = 0; i < path_length; i++) {
+    bool hardened = (0 != (path[i] & 0x80000000));
+    if (hardened != (i < XPUB_CACHE_ACCOUNT_DEPTH)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool xpub_cache_store(const uint8_t *wallet_id,
+                      const uint32_t *path,
+                      const HDNode *account) {
+  xpub_cache_buffer_t buffer = {0};
+
+  if (NULL == path || NULL == account || !xpub_cache_is_usable(wallet_id)) {
+    return false;
+  }
+
+  xpub_cache_load(wallet_id, &buffer);
+  xpub_cache_record_t *record = &buffer.record;
+  int index = xpub_cache_find(record, path);
+  if (0 <= index &&
+      0 == memcmp(record->entries[index].public_key,
+                  account->public_key,
+                  sizeof(record->entries[index].public_key))) {
+    // already cached; spare the flash a write
+    return true;
+  }
+
+  if (0 > index) {
+    if (XPUB_CACHE_MAX_ACCOUNTS == record->count) {
+      memmove(&record->entries[0],
+              &record->entries[1],
+              (XPUB_CACHE_MAX_ACCOUNTS - 1) * sizeof(xpub_cache_entry_t));
+      record->count--;
+    }
+    index = record->count++;
+  }
+
+  xpub_cache_entry_t *entry = &record->entries[index];
+  memcpy(entry->path, path, sizeof(entry->path));
+  memcpy(entry->chain_code, account->chain_code, sizeof(entry->chain_code));
+  memcpy(entry->public_key, account->public_key, sizeof(entry->public_key));
+  return xpub_cache_save(wallet_id, &buffer);
+}
+
+bool xpub_cache_derive(const uint8_t *wallet_id,
+                       const uint32_t *path,
+                       uint32_t path_length,
+                       HDNode *node) {
+  xpub_cache_buffer_t buffer = {0};
+  bool status = false;
+
+  if (NULL == node || !xpub_cache_path_supported(path, path_length) ||
+      !xpub_cache_is_usable(wallet_id) ||
+      !xpub_cache_load(wallet_id, &buffer)) {
+    return false;
+  }
+
+  int index = xpub_cache_find(&buffer.record, path);
+  if (0 <= index) {
+    const xpub_cache_entry_t *entry = &buffer.record.entries[index];
+    memzero(node, sizeof(HDNode));
+    node->depth = XPUB_CACHE_ACCOUNT_DEPTH;
+    node->child_num = path[XPUB_CACHE_ACCOUNT_DEPTH - 1];
+    memcpy(node->chain_code, entry->chain_code, sizeof(node->chain_code));
+    memcpy(node->public_key, entry->public_key, sizeof(node->public_key));
+    node->curve = get_curve_by_name(SECP256K1_NAME);
+
+    status = true;
+    for (uint32_t i = XPUB_CACHE_ACCOUNT_DEPTH; i < path_length && status;
+         i++) {
+      status = (1 == hdnode_public_ckd(node, path[i]));
+    }
+  }
+
+  if (!status) {
+    memzero(node, sizeof(HDNode));
+  }
+  return status;
+}
+
+void xpub_cache_clear(void) {
+  xpub_cache_buffer_t buffer = {0};
+
+  for (uint8_t i = 0; i < MAX_WALLETS_ALLOWED; i++) {
+    const uint8_t *wallet_id = get_wallet_id(i);
+    if (xpub_cache_load(wallet_id, &buffer) && 0 < buffer.record.count) {
+      memzero(&buffer, sizeof(buffer));
+      buffer.record.version = XPUB_CACHE_VERSION;
+      xpub_cache_save(wallet_id, &buffer);
+    }
+  }
+}
@@ -0,0 +1,100 @@
+/**
+ * @file    xpub_cache.h
+ * @author  Cypherock X1 Team
+ * @brief   Header file for the flash cache of account public nodes
+ * @copyright Copyright (c) 2023 HODL TECH PTE LTD
+ * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
+ * target=_blank>https://mitcc.org/</a>
+ */
+#ifndef XPUB_CACHE_H
+#define XPUB_CACHE_H
+
+/*****************************************************************************
+ * INCLUDES
+ *****************************************************************************/
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "bip32.h"
+
+/*****************************************************************************
+ * MACROS AND DEFINES
+ *****************************************************************************/
+/// Depth of the cached nodes: purpose', coin_type' and account'
+#define XPUB_CACHE_ACCOUNT_DEPTH 3
+/// Number of accounts cached per wallet; the oldest account is replaced
+#define XPUB_CACHE_MAX_ACCOUNTS 6
+
+/*****************************************************************************
+ * TYPEDEFS
+ *****************************************************************************/
+
+/*****************************************************************************
+ * EXPORTED VARIABLES
+ *****************************************************************************/
+
+/*****************************************************************************
+ * GLOBAL FUNCTION PROTOTYPES
+ *****************************************************************************/
+/**
+ * @brief Returns whether the public nodes of the wallet may be cached
+ * @details The cache is used only if the user enabled it from the settings
+ * and the wallet has neither a PIN nor a passphrase. The nodes of a
+ * passphrase wallet depend on the passphrase, and a PIN wallet keeps asking
+ * for the PIN before anything about it is shown.
+ *
+ * @param wallet_id The wallet_id of the wallet
+ */
+bool xpub_cache_is_usable(const uint8_t *wallet_id);
+
+/**
+ * @brief Returns whether the path is a non-hardened child of a cacheable
+ * account node
+ * @details The path must have XPUB_CACHE_ACCOUNT_DEPTH hardened levels
+ * followed by at least one non-hardened level.
+ *
+ * @param path Derivation path
+ * @param path_length Number of levels in path
+ */
+bool xpub_cache_path_supported(const uint32_t *path, uint32_t path_length);
+
+/**
+ * @brief Caches the public part of the account node of the wallet in flash
+ * @details The record of the wallet is authenticated with a key derived from
+ * the device private key. Nothing is stored if the wallet is not usable with
+ * the cache, see @ref xpub_cache_is_usable.
+ *
+ * @param wallet_id The wallet_id of the wallet
+ * @param path Derivation path of the account, XPUB_CACHE_ACCOUNT_DEPTH levels
+ * @param account The account node; only its chain code and public key are kept
+ *
+ * @return bool Whether the node is cached
+ */
+bool xpub_cache_store(const uint8_t *wallet_id,
+                      const uint32_t *path,
+                      const HDNode *account);
+
+/**
+ * @brief Derives the public node of the path from the cached account node
+ * @details Only public derivation (hdnode_public_ckd) is used, so the
+ * resulting node has no private key. A record failing authentication is
+ * treated as missing.
+ *
+ * @param wallet_id The wallet_id of the wallet
+ * @param path Derivation path, see @ref xpub_cache_path_supported
+ * @param path_length Number of levels in path
+ * @param node Storage for the derived public node
+ *
+ * @return bool Whether the node was derived from the cache
+ */
+bool xpub_cache_derive(const uint8_t *wallet_id,
+                       const uint32_t *path,
+                       uint32_t path_length,
+                       HDNode *node);
+
+/**
+ * @brief Drops the cached nodes of every wallet
+ */
+void xpub_cache_clear(void);
+
+#endif /* XPUB_CACHE_H */
@@ -111,6 +111,33 @@ LoopFillZerobss:
 	cmp	r2, r3
 	bcc	FillZerobss
 
+/* Copy the code placed in SRAM2 from flash */
+	ldr	r0, =_ssram2_text
+	ldr	r1, =_esram2_text
+	ldr	r2, =_sisram2_text
+	b	LoopCopySram2Text
+
+CopySram2Text:
+	ldr	r3, [r2], #4
+	str	r3, [r0], #4
+
+LoopCopySram2Text:
+	cmp	r0, r1
+	bcc	CopySram2Text
+
+/* Zero fill the rest of SRAM2: the confidential data, and whatever was left
+   there before the reset */
+	ldr	r1, =_esram2
+	movs	r3, #0
+	b	LoopFillZeroSram2
+
+FillZeroSram2:
+	str	r3, [r0], #4
+
+LoopFillZeroSram2:
+	cmp	r0, r1
+	bcc	FillZeroSram2
+
 /* Call static constructors */
     bl __libc_init_array
 /* Call the application's entry point.*/
@@ -0,0 +1,279 @@
+/**
+ * @file    btc_script_tests.c
+ * @brief   Unit tests for the streaming PSBT reader
+ * @copyright Copyright (c) 2023 HODL TECH PTE LTD
+ * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
+ *target=_blank>https://mitcc.org/</a>
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * (c) Copyright 2023 by HODL TECH PTE LTD
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * "Commons Clause" License Condition v1.0
+ *
+ * The Software is provided to you by the Licensor under the License,
+ * as defined below, subject to the following condition.
+ *
+ * Without limiting other conditions in the License, the grant of
+ * rights under the License will not include, and the License does not
+ * grant to you, the right to Sell the Software.
+ *
+ * For purposes of the foregoing, "Sell" means practicing any or all
+ * of the rights granted to you under the License to provide to third
+ * parties, for a fee or other consideration (including without
+ * limitation fees for hosting or consulting/ support services related
+ * to the Software), a product or service whose value derives, entirely
+ * or substantially, from the functionality of the Software. Any license
+ * notice or attribution required by the License must also include
+ * this Commons Clause License Condition notice.
+ *
+ * Software: All X1Wallet associated files.
+ * License: MIT
+ * Licensor: HODL TECH PTE LTD
+ *
+ ******************************************************************************
+ */
+
+#include "btc_psbt.h"
+#include "memzero.h"
+#include "unity_fixture.h"
+#include "utils.h"
+
+/// Counts what the reader handed over for the test PSBT
+typedef struct {
+  uint8_t prev_txn_hash[2][32];
+  uint32_t prev_output_index[2];
+  uint32_t inputs;
+  uint32_t outputs;
+  uint32_t locktime;
+  uint64_t utxo_value[2];
+  uint32_t sighash;
+  uint32_t derivations;
+} psbt_test_record_t;
+
+static psbt_test_record_t record;
+static uint8_t psbt[926];
+
+static bool psbt_test_meta(void *user,
+                           uint32_t version,
+                           uint32_t input_count,
+                           uint32_t output_count,
+                           uint32_t locktime) {
+  record.locktime = locktime;
+  return 2 == version && 2 == input_count && 2 == output_count;
+}
+
+static bool psbt_test_input(void *user,
+                            uint32_t index,
+                            const uint8_t *prev_txn_hash,
+                            uint32_t prev_output_index,
+                            uint32_t sequence) {
+  memcpy(record.prev_txn_hash[index], prev_txn_hash, 32);
+  record.prev_output_index[index] = prev_output_index;
+  record.inputs++;
+  return true;
+}
+
+static bool psbt_test_output(void *user,
+                             uint32_t index,
+                             uint64_t value,
+                             const uint8_t *script,
+                             uint16_t script_len) {
+  record.outputs++;
+  return 22 == script_len;
+}
+
+static bool psbt_test_get_outpoint(void *user,
+                                   uint32_t index,
+                                   uint8_t *prev_txn_hash,
+                                   uint32_t *prev_output_index) {
+  memcpy(prev_txn_hash, record.prev_txn_hash[index], 32);
+  *prev_output_index = record.prev_output_index[index];
+  return true;
+}
+
+static bool psbt_test_utxo(void *user,
+                           uint32_t index,
+                           uint64_t value,
+                           const uint8_t *script,
+                           uint16_t script_len) {
+  record.utxo_value[index] = value;
+  return true;
+}
+
+static bool psbt_test_sighash(void *user, uint32_t index, uint32_t sighash) {
+  record.sighash = sighash;
+  return true;
+}
+
+static bool psbt_test_derivation(void *user,
+                                 btc_psbt_map_e map,
+                                 uint32_t index,
+                                 const uint8_t *public_key,
+                                 uint32_t fingerprint,
+                                 const uint32_t *path,
+                                 uint8_t depth) {
+  record.derivations++;
+  return 0xdeadbeef == fingerprint && 5 == depth && 0x80000054 == path[0];
+}
+
+static const btc_psbt_handler_t handler = {
+    .tx_meta = psbt_test_meta,
+    .tx_input = psbt_test_input,
+    .tx_output = psbt_test_output,
+    .get_outpoint = psbt_test_get_outpoint,
+    .utxo = psbt_test_utxo,
+    .sighash = psbt_test_sighash,
+    .bip32_derivation = psbt_test_derivation,
+};
+
+static bool psbt_test_read(const uint8_t *data, uint32_t size, uint32_t chunk) {
+  btc_psbt_t reader;
+  bool status = true;
+
+  btc_psbt_init(&reader, &handler, NULL);
+  for (uint32_t offset = 0; offset < size && status; offset += chunk) {
+    status = btc_psbt_update(
+        &reader, data + offset, CY_MIN(chunk, size - offset));
+  }
+  return btc_psbt_final(&reader) && status;
+}
+
+TEST_GROUP(btc_psbt_test);
+
+/**
+ * @brief Test setup for the PSBT reader tests.
+ * @details Loads a PSBT with an unsigned transaction of two inputs and two
+ * outputs. The first input spends a legacy output given as a non-witness
+ * UTXO, the second a segwit output given as a non-witness UTXO followed by
+ * the matching witness UTXO. Unknown global and output records are included
+ * to be skipped.
+ */
+TEST_SETUP(btc_psbt_test) {
+  memzero(&record, sizeof(record));
+  hex_string_to_byte_array(
+      "70736274ff01009a020000000279be68b3f4c275b6b76d12d380568cc2044521932546b9"
+      "825c33d3e03e4a87e10100000000fdffffff8c176207156d7bf7f139e6a7269f61bc31e2"
+      "e51ed1194d50bccac98ff42bb2b70100000000feffffff02a08601000000000016001422"
+      "22222222222222222222222222222222222222204e000000000000160014444444444444"
+      "444444444444444444444444444400350c0029fc77777777777777777777777777777777"
+      "777777777777777777777777777777777777777777777777fd2c01888888888888888888"
+      "888888888888888888888888888888888888888888888888888888888888888888888888"
+      "888888888888888888888888888888888888888888888888888888888888888888888888"
+      "888888888888888888888888888888888888888888888888888888888888888888888888"
+      "888888888888888888888888888888888888888888888888888888888888888888888888"
+      "888888888888888888888888888888888888888888888888888888888888888888888888"
+      "888888888888888888888888888888888888888888888888888888888888888888888888"
+      "888888888888888888888888888888888888888888888888888888888888888888888888"
+      "888888888888888888888888888888888888888888888888888888888888888888888888"
+      "88888801fb04000000000001007702000000013333333333333333333333333333333333"
+      "3333333333333333333333333333330000000003010203ffffffff028813000000000000"
+      "160014222222222222222222222222222222222222222240e20100000000001976a91411"
+      "1111111111111111111111111111111111111188ac000000000103040100000022060266"
+      "6666666666666666666666666666666666666666666666666666666666666618deadbeef"
+      "540000800000008000000080000000000300000000010074020000000199999999999999"
+      "999999999999999999999999999999999999999999999999990000000003040506ffffff"
+      "ff0250c30000000000001600142222222222222222222222222222222222222222307500"
+      "000000000016001444444444444444444444444444444444444444440000000001011f30"
+      "750000000000001600144444444444444444444444444444444444444444002202026666"
+      "66666666666666666666666666666666666666666666666666666666666618deadbeef54"
+      "000080000000800000008000000000030000000002fc01019900",
+      sizeof(psbt) * 2,
+      psbt);
+}
+
+TEST_TEAR_DOWN(btc_psbt_test) {
+  memzero(&record, sizeof(record));
+}
+
+TEST(btc_psbt_test, btc_psbt_read_in_chunks) {
+  const uint32_t chunks[] = {sizeof(psbt), 7, 1};
+
+  for (uint32_t i = 0; i < sizeof(chunks) / sizeof(chunks[0]); i++) {
+    memzero(&record, sizeof(record));
+    TEST_ASSERT_TRUE(psbt_test_read(psbt, sizeof(psbt), chunks[i]));
+    TEST_ASSERT_EQUAL_UINT32(2, record.inputs);
+    TEST_ASSERT_EQUAL_UINT32(2, record.outputs);
+    TEST_ASSERT_EQUAL_UINT32(800000, record.locktime);
+    TEST_ASSERT_EQUAL_UINT64(123456, record.utxo_value[0]);
+    TEST_ASSERT_EQUAL_UINT64(30000, record.utxo_value[1]);
+    TEST_ASSERT_EQUAL_UINT32(1, record.sighash);
+    TEST_ASSERT_EQUAL_UINT32(2, record.derivations);
+  }
+}
+
+TEST(btc_psbt_test, btc_psbt_read_malformed) {
+  uint8_t data[sizeof(psbt) + 1] = {0};
+
+  // truncated within the last output map
+  TEST_ASSERT_FALSE(psbt_test_read(psbt, sizeof(psbt) - 1, 7));
+
+  // trailing byte after the last output map
+  memcpy(data, psbt, sizeof(psbt));
+  TEST_ASSERT_FALSE(psbt_test_read(data, sizeof(data), 7));
+
+  // wrong magic
+  data[0] = 'P';
+  TEST_ASSERT_FALSE(psbt_test_read(data, sizeof(psbt), 7));
+}
+
+TEST(btc_psbt_test, btc_psbt_read_tampered_utxo) {
+  // a byte of the scriptSig in the non-witness UTXO; the txid no longer
+  // matches the outpoint of the first input
+  psbt[561] ^= 0x01;
+  TEST_ASSERT_FALSE(psbt_test_read(psbt, sizeof(psbt), sizeof(psbt)));
+  TEST_ASSERT_EQUAL_UINT64(0, record.utxo_value[0]);
+}
+
+TEST(btc_psbt_test, btc_psbt_read_witness_utxo_only) {
+  // the non-witness UTXO of the second input becomes an unknown record which
+  // is skipped, leaving the unverified witness UTXO alone
+  psbt[706] = 0x0e;
+  TEST_ASSERT_FALSE(psbt_test_read(psbt, sizeof(psbt), 7));
+  TEST_ASSERT_EQUAL_UINT64(0, record.utxo_value[1]);
+}
+
+TEST(btc_psbt_test, btc_psbt_read_witness_utxo_mismatch) {
+  // the witness UTXO of the second input declares a higher value than the
+  // verified non-witness UTXO
+  psbt[827] ^= 0x01;
+  TEST_ASSERT_FALSE(psbt_test_read(psbt, sizeof(psbt), 7));
+}
+
+TEST(btc_psbt_test, btc_psbt_write_partial_sig) {
+  uint8_t public_key[33] = {0x02};
+  uint8_t signature[74] = {0x30};
+  uint8_t out[BTC_PSBT_PARTIAL_SIG_MAX_SIZE] = {0};
+
+  TEST_ASSERT_EQUAL_UINT16(
+      BTC_PSBT_PARTIAL_SIG_MAX_SIZE,
+      btc_psbt_write_partial_sig(public_key, signature, 73, out));
+  TEST_ASSERT_EQUAL_UINT8(34, out[0]);
+  TEST_ASSERT_EQUAL_UINT8(0x02, out[1]);
+  TEST_ASSERT_EQUAL_UINT8(0x02, out[2]);
+  TEST_ASSERT_EQUAL_UINT8(73, out[35]);
+  TEST_ASSERT_EQUAL_UINT8(0x30, out[36]);
+  TEST_ASSERT_EQUAL_UINT16(
+      0, btc_psbt_write_partial_sig(public_key, signature, 74, out));
+}
@@ -59,6 +59,7 @@
 #include "btc_helpers.h"
 #include "btc_priv.h"
 #include "curves.h"
+#include "doge_app.h"
 #include "flash_config.h"
 #include "ltc_app.h"
 #include "unity_fixture.h"
@@ -133,3 +134,20 @@ TEST(btc_script_test, btc_script_ltc_p2sh_address1) {
       0, addr_len, "Address encoding failure");
   TEST_ASSERT_EQUAL_STRING(expected_address, actual_address);
 }
+
+TEST(btc_script_test, btc_script_doge_segwit_has_no_address) {
+  char actual_address[110] = "";
+  uint8_t script_pub[110] = {0};
+
+  g_btc_app = get_doge_app_desc()->app_config;
+
+  TEST_ASSERT_TRUE(btc_is_purpose_supported(PURPOSE_LEGACY));
+  TEST_ASSERT_FALSE(btc_is_purpose_supported(PURPOSE_NSEGWIT));
+  hex_string_to_byte_array(
+      "0014b47d15d9f6dee10a23ad1cae8230545c207ff125", 44, script_pub);
+  TEST_ASSERT_EQUAL_INT(-1,
+                        btc_get_script_pub_address(script_pub,
+                                                   22,
+                                                   actual_address,
+                                                   sizeof(actual_address)));
+}
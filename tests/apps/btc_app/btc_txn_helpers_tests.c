@@ -69,6 +69,18 @@
 
 uint32_t get_transaction_weight(const btc_txn_context_t *txn_ctx);
 
+/**
+ * @brief Accounts every input and output, as fetching the transaction does
+ */
+static void account_txn(btc_txn_context_t *txn_ctx) {
+  for (int idx = 0; idx < txn_ctx->metadata.input_count; idx++) {
+    btc_txn_account_input(txn_ctx, &txn_ctx->inputs[idx]);
+  }
+  for (int idx = 0; idx < txn_ctx->metadata.output_count; idx++) {
+    btc_txn_account_output(txn_ctx, &txn_ctx->outputs[idx]);
+  }
+}
+
 TEST_GROUP(btc_txn_helper_test);
 
 /**
@@ -359,6 +371,47 @@ TEST(btc_txn_helper_test, btc_txn_helper_verify_input_p2wpkh_fail) {
   TEST_ASSERT_EQUAL_INT(2, btc_verify_input(raw_txn, 929, &input));
 }
 
+TEST(btc_txn_helper_test, btc_txn_helper_verify_input_record_values) {
+  // version 2, one input and three OP_TRUE outputs of 1000, 20000 & 300000
+  uint8_t raw_txn[81] = {0};
+  hex_string_to_byte_array(
+      "0200000001111111111111111111111111111111111111111111111111111111111111"
+      "11110100000000ffffffff03e8030000000000000151204e0000000000000151e09304"
+      "0000000000015100000000",
+      162,
+      raw_txn);
+  uint8_t txn_hash[32] = {0};
+  hex_string_to_byte_array(
+      "8d89c905685eb2e089c1db375aa212a665ec729abf75c815c19a58b6b2d553f9",
+      64,
+      txn_hash);
+  btc_verify_input_t verifier = {0};
+  uint64_t values[3] = {0};
+  uint32_t count = 0;
+
+  btc_verify_input_init(&verifier, txn_hash, 1, 20000);
+  btc_verify_input_record_values(&verifier, values, 3, &count);
+  TEST_ASSERT_TRUE(btc_verify_input_update(&verifier, raw_txn, 40));
+  TEST_ASSERT_TRUE(
+      btc_verify_input_update(&verifier, raw_txn + 40, sizeof(raw_txn) - 40));
+  TEST_ASSERT_EQUAL_INT(0, btc_verify_input_final(&verifier));
+  TEST_ASSERT_EQUAL_UINT32(3, count);
+  TEST_ASSERT_EQUAL_UINT64(1000, values[0]);
+  TEST_ASSERT_EQUAL_UINT64(20000, values[1]);
+  TEST_ASSERT_EQUAL_UINT64(300000, values[2]);
+
+  // more outputs than the storage: nothing is recorded
+  memzero(values, sizeof(values));
+  btc_verify_input_init(&verifier, txn_hash, 1, 20000);
+  btc_verify_input_record_values(&verifier, values, 2, &count);
+  TEST_ASSERT_TRUE(
+      btc_verify_input_update(&verifier, raw_txn, sizeof(raw_txn)));
+  TEST_ASSERT_EQUAL_INT(0, btc_verify_input_final(&verifier));
+  TEST_ASSERT_EQUAL_UINT32(0, count);
+  TEST_ASSERT_EQUAL_UINT64(0, values[0]);
+  TEST_ASSERT_EQUAL_UINT64(0, values[1]);
+}
+
 /* FIX: Required to fix the hardcoded value of 106 (2 + 33 + 71) since the
  * signature part of the script can vary (71 bytes | 72 bytes | 73 bytes).
  * Check the get_transaction_weight function. */
@@ -386,13 +439,14 @@ TEST(btc_txn_helper_test, btc_txn_helper_transaction_weight_legacy1) {
       .inputs = NULL,
       .outputs = NULL,
   };
-  txn_ctx.inputs = (btc_txn_input_t *)malloc(sizeof(btc_txn_input_t));
+  txn_ctx.inputs = (btc_txn_input_t *)calloc(1, sizeof(btc_txn_input_t));
   txn_ctx.outputs =
-      (btc_sign_txn_output_t *)malloc(sizeof(btc_sign_txn_output_t) * 2);
+      (btc_sign_txn_output_t *)calloc(2, sizeof(btc_sign_txn_output_t));
 
   hex_string_to_byte_array("76a9149e8bf5383534bbcdecbf2f25e1c61d50ccab94de88ac",
                            50,
                            txn_ctx.inputs[0].script_pub_key.bytes);
+  txn_ctx.inputs[0].script_type = SCRIPT_TYPE_P2PKH;
   /* Input 0 ScriptSig:
    * 47304402205291ec6f7870d49158d3e03cd7f3cdf33044cbd248d63f73ed46f4e83bac173f022053639907c363acd4c2c7774616417a4bb2c0817e49f630841e9329970f7d5d01012103c5d52e46f6a9312127d552f201ec7cde3c8fae420731bc198c650ac1f685ae8b
    */
@@ -403,6 +457,7 @@ TEST(btc_txn_helper_test, btc_txn_helper_transaction_weight_legacy1) {
   /* 76a9148d10806ee8786726bf2d2b03b7168fbd96f1475088ac */
   txn_ctx.outputs[1].script_pub_key.size = 25;
 
+  account_txn(&txn_ctx);
   uint32_t weight = get_transaction_weight(&txn_ctx);
   uint32_t fixed_weight =
       fix_legacy_weight(weight, txn_ctx.metadata.input_count, script_sig_size);
@@ -428,13 +483,14 @@ TEST(btc_txn_helper_test, btc_txn_helper_transaction_weight_legacy2) {
       .inputs = NULL,
       .outputs = NULL,
   };
-  txn_ctx.inputs = (btc_txn_input_t *)malloc(sizeof(btc_txn_input_t));
+  txn_ctx.inputs = (btc_txn_input_t *)calloc(1, sizeof(btc_txn_input_t));
   txn_ctx.outputs =
-      (btc_sign_txn_output_t *)malloc(sizeof(btc_sign_txn_output_t) * 2);
+      (btc_sign_txn_output_t *)calloc(2, sizeof(btc_sign_txn_output_t));
 
   hex_string_to_byte_array("76a914f9f6a393d59b793a421b5f995bb09da767ec4f6588ac",
                            50,
                            txn_ctx.inputs[0].script_pub_key.bytes);
+  txn_ctx.inputs[0].script_type = SCRIPT_TYPE_P2PKH;
   /* Input 0 ScriptSig:
    * 493046022100cacdac51a47bdd90c9c2f11450b929f131c0433bb6f651a333611d2e01cb2da9022100de25c004529df921fc0e181fcd069b75851f6791999512bdc18632aa0e5fd641012103bd32d9b96614bbc1efb50cfc78b19430ef1297fe68ae8a276b35f46e097440d4
    */
@@ -445,6 +501,7 @@ TEST(btc_txn_helper_test, btc_txn_helper_transaction_weight_legacy2) {
   /* 76a914699dbaa9e46b869021b3d567cbb3e8e6915ecdd288ac */
   txn_ctx.outputs[1].script_pub_key.size = 25;
 
+  account_txn(&txn_ctx);
   uint32_t weight = get_transaction_weight(&txn_ctx);
   uint32_t fixed_weight =
       fix_legacy_weight(weight, txn_ctx.metadata.input_count, script_sig_size);
@@ -479,9 +536,9 @@ TEST(btc_txn_helper_test, btc_txn_helper_transaction_weight_segwit1) {
       .inputs = NULL,
       .outputs = NULL,
   };
-  txn_ctx.inputs = (btc_txn_input_t *)malloc(sizeof(btc_txn_input_t));
+  txn_ctx.inputs = (btc_txn_input_t *)calloc(1, sizeof(btc_txn_input_t));
   txn_ctx.outputs =
-      (btc_sign_txn_output_t *)malloc(2 * sizeof(btc_sign_txn_output_t));
+      (btc_sign_txn_output_t *)calloc(2, sizeof(btc_sign_txn_output_t));
 
   /* FIX: store the size for witnesses here due to the absence of designated
    * struct fields */
@@ -502,11 +559,13 @@ TEST(btc_txn_helper_test, btc_txn_helper_transaction_weight_segwit1) {
   hex_string_to_byte_array("00147c343c768adcb9b01d32e0ab2d5bb4b9657053d9",
                            44,
                            txn_ctx.inputs[0].script_pub_key.bytes);
+  txn_ctx.inputs[0].script_type = SCRIPT_TYPE_P2WPKH;
   /* 76a9149adeade91a046e530e0b162686cb281ce4d9a70188ac */
   txn_ctx.outputs[0].script_pub_key.size = 25;
   /* 00147c343c768adcb9b01d32e0ab2d5bb4b9657053d9 */
   txn_ctx.outputs[1].script_pub_key.size = 22;
 
+  account_txn(&txn_ctx);
   uint32_t txn_weight = get_transaction_weight(&txn_ctx);
   uint32_t fixed_weight =
       fix_segwit_weight(txn_weight, txn_ctx.metadata.input_count, witness_size);
@@ -533,9 +592,9 @@ TEST(btc_txn_helper_test, btc_txn_helper_transaction_weight_segwit2) {
       .inputs = NULL,
       .outputs = NULL,
   };
-  txn_ctx.inputs = (btc_txn_input_t *)malloc(sizeof(btc_txn_input_t));
+  txn_ctx.inputs = (btc_txn_input_t *)calloc(1, sizeof(btc_txn_input_t));
   txn_ctx.outputs =
-      (btc_sign_txn_output_t *)malloc(sizeof(btc_sign_txn_output_t));
+      (btc_sign_txn_output_t *)calloc(1, sizeof(btc_sign_txn_output_t));
   btc_txn_input_t *input = &txn_ctx.inputs[0];
   btc_sign_txn_output_t *output = &txn_ctx.outputs[0];
 
@@ -558,9 +617,11 @@ TEST(btc_txn_helper_test, btc_txn_helper_transaction_weight_segwit2) {
   hex_string_to_byte_array("00149031c2a9996e57eb787967e794358e823595b666",
                            44,
                            input->script_pub_key.bytes);
+  input->script_type = SCRIPT_TYPE_P2WPKH;
   /* 76a914d2192be350c2e4b16d4905d0c356080c331e34de88ac */
   output->script_pub_key.size = 25;
 
+  account_txn(&txn_ctx);
   uint32_t txn_weight = get_transaction_weight(&txn_ctx);
   uint32_t fixed_weight =
       fix_segwit_weight(txn_weight, txn_ctx.metadata.input_count, witness_size);
@@ -628,6 +689,7 @@ TEST(btc_txn_helper_test, btc_txn_helper_p2pkh_digest_1_2) {
       .value = 11014713900,
       .prev_output_index = 0,
       .script_pub_key = {.size = 25},
+      .script_type = SCRIPT_TYPE_P2PKH,
       .change_index = 0,
       .address_index = 0,
       .sequence = UINT32_MAX,
@@ -693,6 +755,7 @@ TEST(btc_txn_helper_test, btc_txn_helper_p2wpkh_digest_1_2) {
       .value = 76425,
       .prev_output_index = 0,
       .script_pub_key = {.size = 22},
+      .script_type = SCRIPT_TYPE_P2WPKH,
       .change_index = 0,
       .address_index = 1,
       .sequence = UINT32_MAX,
@@ -787,9 +850,9 @@ TEST(btc_txn_helper_test, btc_txn_helper_get_fee) {
       .inputs = NULL,
       .outputs = NULL,
   };
-  txn_ctx.inputs = (btc_txn_input_t *)malloc(3 * sizeof(btc_txn_input_t));
+  txn_ctx.inputs = (btc_txn_input_t *)calloc(3, sizeof(btc_txn_input_t));
   txn_ctx.outputs =
-      (btc_sign_txn_output_t *)malloc(2 * sizeof(btc_sign_txn_output_t));
+      (btc_sign_txn_output_t *)calloc(2, sizeof(btc_sign_txn_output_t));
 
   txn_ctx.inputs[0].value = 5136;
   txn_ctx.inputs[1].value = 336366;
@@ -799,6 +862,7 @@ TEST(btc_txn_helper_test, btc_txn_helper_get_fee) {
   txn_ctx.outputs[1].value = 341352;
 
   uint64_t fee = 0;
+  account_txn(&txn_ctx);
   TEST_ASSERT_EQUAL_UINT(true, btc_get_txn_fee(&txn_ctx, &fee));
   TEST_ASSERT_EQUAL_UINT(1932, fee);
 
@@ -821,9 +885,9 @@ TEST(btc_txn_helper_test, btc_txn_helper_get_fee_overspend) {
       .inputs = NULL,
       .outputs = NULL,
   };
-  txn_ctx.inputs = (btc_txn_input_t *)malloc(1 * sizeof(btc_txn_input_t));
+  txn_ctx.inputs = (btc_txn_input_t *)calloc(1, sizeof(btc_txn_input_t));
   txn_ctx.outputs =
-      (btc_sign_txn_output_t *)malloc(2 * sizeof(btc_sign_txn_output_t));
+      (btc_sign_txn_output_t *)calloc(2, sizeof(btc_sign_txn_output_t));
 
   txn_ctx.inputs[0].value = 5000;
 
@@ -831,8 +895,26 @@ TEST(btc_txn_helper_test, btc_txn_helper_get_fee_overspend) {
   txn_ctx.outputs[1].value = 2;
 
   uint64_t fee = 0;
+  account_txn(&txn_ctx);
   TEST_ASSERT_EQUAL_UINT(false, btc_get_txn_fee(&txn_ctx, &fee));
 
   free(txn_ctx.inputs);
   free(txn_ctx.outputs);
 }
+
+TEST(btc_txn_helper_test, btc_txn_helper_get_fee_overflow) {
+  /* output values wrapping around to less than the input */
+  btc_txn_context_t txn_ctx = {0};
+  btc_txn_input_t input = {.value = 5000};
+  btc_sign_txn_output_t output = {.value = UINT64_MAX};
+
+  btc_txn_account_input(&txn_ctx, &input);
+  btc_txn_account_output(&txn_ctx, &output);
+  output.value = 2;
+  btc_txn_account_output(&txn_ctx, &output);
+
+  uint64_t fee = 0;
+  TEST_ASSERT_EQUAL_UINT64(1, txn_ctx.totals.output_value);
+  TEST_ASSERT_EQUAL_UINT(false, btc_get_txn_fee(&txn_ctx, &fee));
+  TEST_ASSERT_EQUAL_UINT64(UINT64_MAX, fee);
+}
@@ -57,9 +57,10 @@
  */
 
 #include "curves.h"
-#include "eth_app.h"
+#include "evm_chains.h"
 #include "evm_helpers.h"
 #include "evm_priv.h"
+#include "evm_typed_data_helper.h"
 #include "flash_config.h"
 #include "pb_decode.h"
 #include "pb_encode.h"
@@ -82,7 +83,7 @@ static const uint8_t core_msg[] = {10, 2, 8, 1};
  * performing tests. buffer of packet(s) of data.
  */
 TEST_SETUP(evm_sign_msg_test) {
-  g_evm_app = get_eth_app_desc()->app_config;
+  g_evm_app = evm_get_chain(1);
 }
 
 /**
@@ -294,11 +295,13 @@ TEST(evm_sign_msg_test, evm_sign_msg_test_personal_sign_hash) {
          &query.sign_msg.initiate,
          sizeof(evm_sign_msg_initiate_request_t));
 
-  // Set the msg_data to ctx
+  // Digest the msg_data as it is received in chunks
   char *string = "4D7920656D61696C206973206A6F686E40646F652E636F6D202D203136393"
                  "3383938333735353631";
-  ctx.msg_data = buffer;
   hex_string_to_byte_array(string, ctx.init.total_msg_size * 2, buffer);
+  evm_personal_data_digest_init(&ctx.msg_sha3_ctx, ctx.init.total_msg_size);
+  keccak_Update(&ctx.msg_sha3_ctx, buffer, 15);
+  keccak_Update(&ctx.msg_sha3_ctx, buffer + 15, ctx.init.total_msg_size - 15);
   TEST_ASSERT_TRUE(evm_get_msg_data_digest(&ctx, digest));
   TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_digest, digest, SHA256_DIGEST_LENGTH);
 }
@@ -327,11 +330,46 @@ TEST(evm_sign_msg_test, evm_sign_msg_test_eth_sign_hash) {
          &query.sign_msg.initiate,
          sizeof(evm_sign_msg_initiate_request_t));
 
-  // Set the msg_data to ctx
+  // Digest the msg_data as it is received
   char *string = "4D7920656D61696C206973206A6F686E40646F652E636F6D202D203136393"
                  "3383938343031363333";
-  ctx.msg_data = buffer;
   hex_string_to_byte_array(string, ctx.init.total_msg_size * 2, buffer);
+  evm_personal_data_digest_init(&ctx.msg_sha3_ctx, ctx.init.total_msg_size);
+  keccak_Update(&ctx.msg_sha3_ctx, buffer, ctx.init.total_msg_size);
   TEST_ASSERT_TRUE(evm_get_msg_data_digest(&ctx, digest));
   TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_digest, digest, SHA256_DIGEST_LENGTH);
 }
+
+static bool accept_typed_data_node(const char *title, const char *value) {
+  return true;
+}
+
+TEST(evm_sign_msg_test, evm_sign_msg_test_empty_typed_data_stream_hash) {
+  uint8_t buffer[128] = {0};
+  uint8_t digest[SHA256_DIGEST_LENGTH] = {0};
+  uint8_t expected_digest[SHA256_DIGEST_LENGTH] = {
+      48, 26,  80,  178, 145, 211, 60,  225, 232, 233, 6,
+      78, 63,  106, 108, 81,  217, 2,   236, 34,  137, 43,
+      80, 213, 138, 191, 99,  87,  198, 164, 85,  65};
+  evm_typed_data_stream_t stream;
+
+  // domain & message nodes of the empty typed data test, each length-prefixed
+  char *string =
+      "3a0a06646f6d61696e1007220c454950373132446f6d61696e322020bcc3f8105eea47"
+      "d067386e42e60246e89393cd61c512edd1e87688890fb9143b0a076d65737361676510"
+      "07220c454950373132446f6d61696e322020bcc3f8105eea47d067386e42e60246e893"
+      "93cd61c512edd1e87688890fb914";
+  hex_string_to_byte_array(string, 238, buffer);
+
+  // result must not depend on how the stream is chunked
+  for (size_t chunk = 1; chunk <= 119; chunk += 59) {
+    evm_typed_data_stream_init(&stream, accept_typed_data_node);
+    for (size_t offset = 0; offset < 119; offset += chunk) {
+      TEST_ASSERT_TRUE(evm_typed_data_stream_feed(
+          &stream, buffer + offset, CY_MIN(chunk, 119 - offset)));
+    }
+    TEST_ASSERT_TRUE(evm_typed_data_stream_digest(&stream, digest));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_digest, digest, SHA256_DIGEST_LENGTH);
+    evm_typed_data_stream_clear(&stream);
+  }
+}
@@ -57,9 +57,10 @@
  */
 
 #include "curves.h"
-#include "eth_app.h"
+#include "evm_chains.h"
 #include "evm_helpers.h"
 #include "evm_priv.h"
+#include "evm_txn_helpers.h"
 #include "flash_config.h"
 #include "pb_decode.h"
 #include "pb_encode.h"
@@ -85,7 +86,7 @@ pb_ostream_t ostream;
  * performing tests. buffer of packet(s) of data.
  */
 TEST_SETUP(evm_txn_test) {
-  g_evm_app = get_eth_app_desc()->app_config;
+  g_evm_app = evm_get_chain(1);
   ostream = pb_ostream_from_buffer(buffer, sizeof(buffer));
 }
 
@@ -371,3 +372,133 @@ TEST(evm_txn_test, evm_txn_token_deposit) {
 
 // large transaction test
 // https://etherscan.io/getRawTx?tx=0x2d6a7b0f6adeff38423d4c62cd8b6ccb708ddad85da5d3d06756ad4d8a04a6a2
+
+TEST(evm_txn_test, evm_txn_whitelist_lookup) {
+  const erc20_contracts_t *contracts = g_evm_app->whitelisted_contracts;
+  const uint16_t count = g_evm_app->whitelisted_contracts_count;
+  const erc20_contracts_t *match = NULL;
+  uint8_t unknown[EVM_ADDRESS_LENGTH] = {0};
+
+  for (uint16_t idx = 0; idx < count; idx++) {
+    // binary search requires strictly ascending addresses
+    if (0 < idx) {
+      TEST_ASSERT_LESS_THAN_INT(
+          0,
+          memcmp(contracts[idx - 1].address,
+                 contracts[idx].address,
+                 EVM_ADDRESS_LENGTH));
+    }
+    TEST_ASSERT_TRUE(evm_lookup_whitelisted_contract(
+        contracts, count, contracts[idx].address, &match));
+    TEST_ASSERT_EQUAL_PTR(&contracts[idx], match);
+  }
+
+  TEST_ASSERT_FALSE(
+      evm_lookup_whitelisted_contract(contracts, count, unknown, &match));
+  TEST_ASSERT_NULL(match);
+}
+
+TEST(evm_txn_test, evm_txn_selector_lookup) {
+  for (uint16_t idx = 0; idx < evm_functions_count; idx++) {
+    // binary search requires strictly ascending selectors
+    if (0 < idx) {
+      TEST_ASSERT_LESS_THAN_UINT32(evm_functions[idx].selector,
+                                   evm_functions[idx - 1].selector);
+    }
+    TEST_ASSERT_EQUAL_PTR(&evm_functions[idx],
+                          evm_lookup_function(evm_functions[idx].selector));
+  }
+
+  TEST_ASSERT_EQUAL_UINT8(2, evm_lookup_function(EVM_transfer_TAG)->num_args);
+  TEST_ASSERT_NULL(evm_lookup_function(0x00000000));
+  TEST_ASSERT_NULL(evm_lookup_function(0xffffffff));
+}
+
+TEST(evm_txn_test, evm_txn_stream_chunked) {
+  uint8_t raw_txn[44] = {0};
+  uint8_t expected[32] = {0};
+  uint8_t digest[32] = {0};
+  evm_txn_context_t *context =
+      (evm_txn_context_t *)malloc(sizeof(evm_txn_context_t));
+
+  hex_string_to_byte_array("eb1685050775d80082627094b3c152026d3722cb4acf2fb853f"
+                           "e107dd96bbb5e872386f26fc1000080018080",
+                           88,
+                           raw_txn);
+  keccak_256(raw_txn, sizeof(raw_txn), expected);
+
+  // decoding & digest must not depend on how the transaction is chunked
+  for (size_t chunk = 1; chunk <= sizeof(raw_txn); chunk++) {
+    memzero(context, sizeof(evm_txn_context_t));
+    evm_txn_stream_init(context);
+    for (size_t offset = 0; offset < sizeof(raw_txn); offset += chunk) {
+      TEST_ASSERT_TRUE(evm_txn_stream_update(
+          context,
+          &raw_txn[offset],
+          CY_MIN(chunk, sizeof(raw_txn) - offset)));
+    }
+    TEST_ASSERT_EQUAL_INT(0, evm_txn_stream_final(context));
+    keccak_Final(&context->sha3_ctx, digest);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, digest, sizeof(digest));
+    TEST_ASSERT_EQUAL_UINT8(1, context->transaction_info.chain_id[0]);
+    TEST_ASSERT_EQUAL_UINT8(0xb3, context->transaction_info.to_address[0]);
+    TEST_ASSERT_EQUAL(EVM_TXN_NO_DATA, context->txn_type);
+  }
+
+  // bytes after the outer list are rejected
+  TEST_ASSERT_FALSE(evm_txn_stream_update(context, raw_txn, 1));
+  free(context);
+}
+
+TEST(evm_txn_test, evm_txn_eip1559_envelope) {
+  uint8_t raw_txn[91] = {0};
+  evm_txn_context_t *context =
+      (evm_txn_context_t *)malloc(sizeof(evm_txn_context_t));
+  memzero(context, sizeof(evm_txn_context_t));
+
+  // type 2 envelope with an access list of one address & one storage key
+  hex_string_to_byte_array(
+      "02f8580105016482520894bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb8080f838f7"
+      "94cccccccccccccccccccccccccccccccccccccccce1a0dddddddddddddddddddddddddd"
+      "dddddddddddddddddddddddddddddddddddddd",
+      182,
+      raw_txn);
+  TEST_ASSERT_EQUAL_INT(
+      0, evm_decode_unsigned_txn(raw_txn, sizeof(raw_txn), context));
+  TEST_ASSERT_EQUAL_UINT8(EVM_TXN_ENVELOPE_EIP1559, context->stream.envelope);
+  TEST_ASSERT_EQUAL_UINT8(5, context->transaction_info.nonce[0]);
+  // maxFeePerGas is decoded as the gas price
+  TEST_ASSERT_EQUAL_UINT8(0x64, context->transaction_info.gas_price[0]);
+  TEST_ASSERT_EQUAL_UINT8(0xbb, context->transaction_info.to_address[0]);
+  TEST_ASSERT_TRUE(evm_validate_unsigned_txn(context));
+
+  // type 0 is reserved for untyped transactions
+  raw_txn[0] = 0x00;
+  TEST_ASSERT_EQUAL_INT(
+      -1, evm_decode_unsigned_txn(raw_txn, sizeof(raw_txn), context));
+  free(context);
+}
+
+TEST(evm_txn_test, evm_txn_checksum_address_cache) {
+  // EIP-55 test vectors
+  const char *expected[] = {"0x5aAeb6053F3E94C9b9A09f33669435E7Ef1BeAed",
+                            "0xfB6916095ca1df60bB79Ce92cE3Ea74c37c5d359",
+                            "0xdbF03B407c01E7cD3CBea99509d93f8DDDC8C6FB",
+                            "0xD1220A0cf47c7B9Be7A2E6BA89F429762e7b9aDb",
+                            "0x52908400098527886E0F7030069857D2E4169EE7"};
+  uint8_t address[5][EVM_ADDRESS_LENGTH] = {0};
+  char text[EVM_ADDRESS_STRING_SIZE] = "";
+
+  evm_address_cache_clear();
+  for (int i = 0; i < 5; i++) {
+    hex_string_to_byte_array(expected[i] + 2, 40, address[i]);
+    evm_format_address(address[i], text);
+    TEST_ASSERT_EQUAL_STRING(expected[i], text);
+  }
+  // the first address was replaced in the cache, the last one is kept
+  evm_format_address(address[0], text);
+  TEST_ASSERT_EQUAL_STRING(expected[0], text);
+  evm_format_address(address[4], text);
+  TEST_ASSERT_EQUAL_STRING(expected[4], text);
+  evm_address_cache_clear();
+}
@@ -59,6 +59,7 @@
 #include "near.h"
 #include "near_context.h"
 #include "near_helpers.h"
+#include "near_txn_helpers.h"
 #include "unity_fixture.h"
 #include "utils.h"
 
@@ -89,7 +90,11 @@ TEST(near_helper_test, near_helper_send_decoder_transfer_action) {
   TEST_ASSERT_TRUE(near_parse_transaction(raw_txn, 230, &utxn));
 
   // Verify that the txn contains an action of type 'TRANSFER'
-  TEST_ASSERT_EQUAL_UINT8(NEAR_ACTION_TRANSFER, utxn.actions_type);
+  near_action_iterator iterator = {0};
+  near_action_view action = {0};
+  near_action_iterator_init(&iterator, &utxn);
+  TEST_ASSERT_TRUE(near_action_iterator_next(&iterator, &action));
+  TEST_ASSERT_EQUAL_UINT8(NEAR_ACTION_TRANSFER, action.type);
 
   // Verify receiver address
   const char expected_receiver[] =
@@ -100,7 +105,7 @@ TEST(near_helper_test, near_helper_send_decoder_transfer_action) {
   // Verify transfer amount
   const char expected_amount[] = "Verify amount\n22.129003433752526485\nNEAR";
   char amount_decimal_string[100] = "";
-  get_amount_string(utxn.action.transfer.amount,
+  get_amount_string(action.action.transfer.amount,
                     amount_decimal_string,
                     sizeof(amount_decimal_string));
 
@@ -115,14 +120,18 @@ TEST(near_helper_test,
       "8be1dc6fc38a1b68902fd9d27ad5681a0849a1819aaeab815900000e0000006379706865"
       "726f636b2e6e6561726c9db75a59d0c3ad6b57db90865045b41a98690e3a7fe61cdfda87"
       "413cb5d19b010000000300788799cb4b5c6c310a000000000000",
-      260,
+      268,
       raw_txn);
 
   near_unsigned_txn utxn = {0};
-  TEST_ASSERT_TRUE(near_parse_transaction(raw_txn, 130, &utxn));
+  TEST_ASSERT_TRUE(near_parse_transaction(raw_txn, 134, &utxn));
 
   // Verify that the txn contains an action of type 'TRANSFER'
-  TEST_ASSERT_EQUAL_UINT8(NEAR_ACTION_TRANSFER, utxn.actions_type);
+  near_action_iterator iterator = {0};
+  near_action_view action = {0};
+  near_action_iterator_init(&iterator, &utxn);
+  TEST_ASSERT_TRUE(near_action_iterator_next(&iterator, &action));
+  TEST_ASSERT_EQUAL_UINT8(NEAR_ACTION_TRANSFER, action.type);
 
   // Verify receiver address
   const char expected_receiver[] = "cypherock.near";
@@ -132,7 +141,7 @@ TEST(near_helper_test,
   // Verify transfer amount
   const char expected_amount[] = "Verify amount\n0.0481353634875\nNEAR";
   char amount_decimal_string[100] = "";
-  get_amount_string(utxn.action.transfer.amount,
+  get_amount_string(action.action.transfer.amount,
                     amount_decimal_string,
                     sizeof(amount_decimal_string));
 
@@ -159,13 +168,17 @@ TEST(near_helper_test,
   TEST_ASSERT_TRUE(near_parse_transaction(raw_txn, 312, &utxn));
 
   // Verify that the txn contains an action of type 'FUNCTION_CALL'
-  TEST_ASSERT_EQUAL_UINT8(NEAR_ACTION_FUNCTION_CALL, utxn.actions_type);
+  near_action_iterator iterator = {0};
+  near_action_view action = {0};
+  near_action_iterator_init(&iterator, &utxn);
+  TEST_ASSERT_TRUE(near_action_iterator_next(&iterator, &action));
+  TEST_ASSERT_EQUAL_UINT8(NEAR_ACTION_FUNCTION_CALL, action.type);
 
   // Verify that the method in the function call is add account
   const char expected_method[] = "create_account";
   TEST_ASSERT_EQUAL_STRING_LEN(expected_method,
-                               (char *)utxn.action.fn_call.method_name,
-                               utxn.action.fn_call.method_name_length);
+                               (char *)action.action.fn_call.method_name,
+                               action.action.fn_call.method_name_length);
 
   // Verify the account owner
   const char expected_account_owner[] =
@@ -176,20 +189,66 @@ TEST(near_helper_test,
   // Verify new account ID
   const char expected_account_name[] = "hodl_test_1234.near";
   char account[NEAR_ACC_ID_MAX_LEN + 1] = {0};
-  near_get_new_account_id_from_fn_args((const char *)utxn.action.fn_call.args,
-                                       utxn.action.fn_call.args_length,
+  near_get_new_account_id_from_fn_args((const char *)action.action.fn_call.args,
+                                       action.action.fn_call.args_length,
                                        account);
   TEST_ASSERT_EQUAL_STRING(expected_account_name, account);
 
   // Verify amount string
   const char expected_amount[] = "Verify amount\n0.1\nNEAR";
   char amount_decimal_string[100] = "";
-  get_amount_string(utxn.action.fn_call.deposit,
+  get_amount_string(action.action.fn_call.deposit,
                     amount_decimal_string,
                     sizeof(amount_decimal_string));
   TEST_ASSERT_EQUAL_STRING(expected_amount, amount_decimal_string);
 }
 
+TEST(near_helper_test, near_helper_send_decoder_multiple_actions) {
+  uint8_t raw_txn[300] = {0};
+  hex_string_to_byte_array(
+      "120000006379706865726f636b686f646c2e6e65617200ae9a093e6907e86d9770f39b0c"
+      "8be1dc6fc38a1b68902fd9d27ad5681a0849a1819aaeab815900000e0000006379706865"
+      "726f636b2e6e6561726c9db75a59d0c3ad6b57db90865045b41a98690e3a7fe61cdfda87"
+      "413cb5d19b030000000300788799cb4b5c6c310a0000000000000500ae9a093e6907e86d"
+      "9770f39b0c8be1dc6fc38a1b68902fd9d27ad5681a0849a1000000000000000001070e00"
+      "00006379706865726f636b2e6e656172",
+      392,
+      raw_txn);
+
+  near_unsigned_txn utxn = {0};
+  TEST_ASSERT_TRUE(near_parse_transaction(raw_txn, 196, &utxn));
+  TEST_ASSERT_EQUAL_UINT32(3, utxn.action_count);
+
+  near_action_iterator iterator = {0};
+  near_action_view action = {0};
+  near_action_iterator_init(&iterator, &utxn);
+
+  TEST_ASSERT_TRUE(near_action_iterator_next(&iterator, &action));
+  TEST_ASSERT_EQUAL_UINT8(NEAR_ACTION_TRANSFER, action.type);
+
+  TEST_ASSERT_TRUE(near_action_iterator_next(&iterator, &action));
+  TEST_ASSERT_EQUAL_UINT8(NEAR_ACTION_ADD_KEY, action.type);
+  TEST_ASSERT_EQUAL_UINT8(NEAR_CURVE_ED25519,
+                          action.action.add_key.public_key.key_type);
+  TEST_ASSERT_EQUAL_UINT8(1, action.action.add_key.full_access);
+
+  TEST_ASSERT_TRUE(near_action_iterator_next(&iterator, &action));
+  TEST_ASSERT_EQUAL_UINT8(NEAR_ACTION_DELETE_ACCOUNT, action.type);
+  const char expected_beneficiary[] = "cypherock.near";
+  TEST_ASSERT_EQUAL_STRING_LEN(expected_beneficiary,
+                               action.action.del_acc.beneficiary_id,
+                               action.action.del_acc.beneficiary_id_length);
+
+  TEST_ASSERT_FALSE(near_action_iterator_next(&iterator, &action));
+  TEST_ASSERT_EQUAL_UINT32(0, iterator.remaining);
+
+  // A truncated final action fails the parsing of the whole transaction
+  TEST_ASSERT_FALSE(near_parse_transaction(raw_txn, 195, &utxn));
+
+  // Trailing bytes after the last action are never shown but would be signed
+  TEST_ASSERT_FALSE(near_parse_transaction(raw_txn, 197, &utxn));
+}
+
 TEST(near_helper_test, near_helper_sign_txn) {
   uint8_t raw_txn[350] = {0};
   hex_string_to_byte_array(
@@ -90,7 +90,7 @@ TEST(near_txn_user_verification_test,
   near_unsigned_txn utxn = {0};
   TEST_ASSERT_TRUE(near_parse_transaction(raw_txn, 230, &utxn));
 
-  TEST_ASSERT_TRUE(user_verification_transfer(&utxn));
+  TEST_ASSERT_TRUE(user_verification_actions(&utxn));
 }
 
 TEST(near_txn_user_verification_test,
@@ -101,13 +101,13 @@ TEST(near_txn_user_verification_test,
       "8be1dc6fc38a1b68902fd9d27ad5681a0849a1819aaeab815900000e0000006379706865"
       "726f636b2e6e6561726c9db75a59d0c3ad6b57db90865045b41a98690e3a7fe61cdfda87"
       "413cb5d19b010000000300788799cb4b5c6c310a000000000000",
-      260,
+      268,
       raw_txn);
 
   near_unsigned_txn utxn = {0};
-  TEST_ASSERT_TRUE(near_parse_transaction(raw_txn, 130, &utxn));
+  TEST_ASSERT_TRUE(near_parse_transaction(raw_txn, 134, &utxn));
 
-  TEST_ASSERT_TRUE(user_verification_transfer(&utxn));
+  TEST_ASSERT_TRUE(user_verification_actions(&utxn));
 }
 
 TEST(near_txn_user_verification_test,
@@ -129,5 +129,5 @@ TEST(near_txn_user_verification_test,
   near_unsigned_txn utxn = {0};
   TEST_ASSERT_TRUE(near_parse_transaction(raw_txn, 312, &utxn));
 
-  TEST_ASSERT_TRUE(user_verification_function(&utxn));
+  TEST_ASSERT_TRUE(user_verification_actions(&utxn));
 }
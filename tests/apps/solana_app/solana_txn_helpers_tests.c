@@ -0,0 +1,146 @@
+/**
+ * @file    solana_txn_helpers_tests.c
+ * @author  Cypherock X1 Team
+ * @brief   Unit tests for Solana transaction helpers
+ * @copyright Copyright (c) 2023 HODL TECH PTE LTD
+ * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
+ *target=_blank>https://mitcc.org/</a>
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * (c) Copyright 2023 by HODL TECH PTE LTD
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * "Commons Clause" License Condition v1.0
+ *
+ * The Software is provided to you by the Licensor under the License,
+ * as defined below, subject to the following condition.
+ *
+ * Without limiting other conditions in the License, the grant of
+ * rights under the License will not include, and the License does not
+ * grant to you, the right to Sell the Software.
+ *
+ * For purposes of the foregoing, "Sell" means practicing any or all
+ * of the rights granted to you under the License to provide to third
+ * parties, for a fee or other consideration (including without
+ * limitation fees for hosting or consulting/ support services related
+ * to the Software), a product or service whose value derives, entirely
+ * or substantially, from the functionality of the Software. Any license
+ * notice or attribution required by the License must also include
+ * this Commons Clause License Condition notice.
+ *
+ * Software: All X1Wallet associated files.
+ * License: MIT
+ * Licensor: HODL TECH PTE LTD
+ *
+ ******************************************************************************
+ */
+
+#include "solana_txn_helpers.h"
+#include "unity_fixture.h"
+#include "utils.h"
+
+/**
+ * @brief Serializes a transaction of transfers from account 0 to account 1
+ *
+ * @param txn Storage for the serialized transaction
+ * @param count Number of transfer instructions to add
+ * @return uint16_t Size of the serialized transaction
+ */
+static uint16_t build_transfer_txn(uint8_t *txn, uint8_t count) {
+  uint16_t offset = 0;
+
+  // header: 1 signer, 0 read-only signers, 1 read-only non-signer
+  txn[offset++] = 1;
+  txn[offset++] = 0;
+  txn[offset++] = 1;
+
+  // accounts: funding, recipient & system program
+  txn[offset++] = 3;
+  memset(txn + offset, 0x11, SOLANA_ACCOUNT_ADDRESS_LENGTH);
+  offset += SOLANA_ACCOUNT_ADDRESS_LENGTH;
+  memset(txn + offset, 0x22, SOLANA_ACCOUNT_ADDRESS_LENGTH);
+  offset += SOLANA_ACCOUNT_ADDRESS_LENGTH;
+  memset(txn + offset, 0x00, SOLANA_ACCOUNT_ADDRESS_LENGTH);
+  offset += SOLANA_ACCOUNT_ADDRESS_LENGTH;
+
+  memset(txn + offset, 0xbb, SOLANA_BLOCKHASH_LENGTH);
+  offset += SOLANA_BLOCKHASH_LENGTH;
+
+  txn[offset++] = count;
+  for (uint8_t i = 0; i < count; i++) {
+    const uint8_t instruction[] = {
+        2, 2, 0, 1, 12, SSI_TRANSFER, 0, 0, 0, i + 1, 0, 0, 0, 0, 0, 0, 0};
+    memcpy(txn + offset, instruction, sizeof(instruction));
+    offset += sizeof(instruction);
+  }
+  return offset;
+}
+
+TEST_GROUP(solana_txn_helper_test);
+
+TEST_SETUP(solana_txn_helper_test) {
+}
+
+TEST_TEAR_DOWN(solana_txn_helper_test) {
+  return;
+}
+
+TEST(solana_txn_helper_test, solana_txn_batch_transfer) {
+  uint8_t txn[300] = {0};
+  solana_unsigned_txn utxn = {0};
+  const uint16_t size = build_transfer_txn(txn, 3);
+
+  TEST_ASSERT_EQUAL_INT(SOL_OK,
+                        solana_byte_array_to_unsigned_txn(txn, size, &utxn));
+  TEST_ASSERT_EQUAL_INT(SOL_OK, solana_validate_unsigned_txn(&utxn));
+  TEST_ASSERT_EQUAL_UINT16(3, utxn.instructions_count);
+
+  for (uint8_t i = 0; i < 3; i++) {
+    const solana_instruction *instruction = &utxn.instructions[i];
+    // the instruction must refer the received buffer
+    TEST_ASSERT_TRUE(txn < instruction->opaque_data &&
+                     instruction->opaque_data < txn + size);
+    TEST_ASSERT_EQUAL_PTR(utxn.account_addresses,
+                          instruction->program.transfer.funding_account);
+    TEST_ASSERT_EQUAL_PTR(
+        utxn.account_addresses + SOLANA_ACCOUNT_ADDRESS_LENGTH,
+        instruction->program.transfer.recipient_account);
+    TEST_ASSERT_EQUAL_UINT64(i + 1, instruction->program.transfer.lamports);
+  }
+}
+
+TEST(solana_txn_helper_test, solana_txn_instruction_limit) {
+  uint8_t txn[400] = {0};
+  solana_unsigned_txn utxn = {0};
+  uint16_t size = build_transfer_txn(txn, SOLANA_MAX_INSTRUCTIONS + 1);
+
+  TEST_ASSERT_EQUAL_INT(SOL_V_UNSUPPORTED_INSTRUCTION_COUNT,
+                        solana_byte_array_to_unsigned_txn(txn, size, &utxn));
+
+  // a truncated instruction list must not be accepted
+  size = build_transfer_txn(txn, 2);
+  TEST_ASSERT_EQUAL_INT(
+      SOL_D_READ_SIZE_MISMATCH,
+      solana_byte_array_to_unsigned_txn(txn, size - 4, &utxn));
+}
@@ -0,0 +1,167 @@
+/**
+ * @file    app_registry_tests.c
+ * @author  Cypherock X1 Team
+ * @brief   Unit tests for the app registry
+ * @copyright Copyright (c) 2023 HODL TECH PTE LTD
+ * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
+ *target=_blank>https://mitcc.org/</a>
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * (c) Copyright 2023 by HODL TECH PTE LTD
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * "Commons Clause" License Condition v1.0
+ *
+ * The Software is provided to you by the Licensor under the License,
+ * as defined below, subject to the following condition.
+ *
+ * Without limiting other conditions in the License, the grant of
+ * rights under the License will not include, and the License does not
+ * grant to you, the right to Sell the Software.
+ *
+ * For purposes of the foregoing, "Sell" means practicing any or all
+ * of the rights granted to you under the License to provide to third
+ * parties, for a fee or other consideration (including without
+ * limitation fees for hosting or consulting/ support services related
+ * to the Software), a product or service whose value derives, entirely
+ * or substantially, from the functionality of the Software. Any license
+ * notice or attribution required by the License must also include
+ * this Commons Clause License Condition notice.
+ *
+ * Software: All X1Wallet associated files.
+ * License: MIT
+ * Licensor: HODL TECH PTE LTD
+ *
+ ******************************************************************************
+ */
+
+/*****************************************************************************
+ * INCLUDES
+ *****************************************************************************/
+#include "app_registry.h"
+#include "unity_fixture.h"
+#include "usb_api_priv.h"
+
+/*****************************************************************************
+ * PRIVATE MACROS AND DEFINES
+ *****************************************************************************/
+/// App ids no app of the firmware uses
+#define TEST_APP_ID 15
+#define TEST_PLAIN_APP_ID 16
+
+/*****************************************************************************
+ * STATIC FUNCTION PROTOTYPES
+ *****************************************************************************/
+static void test_app_main(usb_event_t usb_evt, const void *app_config);
+static void test_app_init(const void *app_config);
+
+/*****************************************************************************
+ * STATIC VARIABLES
+ *****************************************************************************/
+static const uint32_t test_app_config = 0xC0FFEE;
+static const void *init_config = NULL;
+static uint8_t init_count = 0;
+static uint8_t app_runs = 0;
+
+static const cy_app_desc_t test_app_desc = {.id = TEST_APP_ID,
+                                            .version = {1, 0, 0},
+                                            .app = test_app_main,
+                                            .app_config = &test_app_config,
+                                            .init = test_app_init};
+
+static const cy_app_desc_t test_plain_app_desc = {.id = TEST_PLAIN_APP_ID,
+                                                  .version = {1, 0, 0},
+                                                  .app = test_app_main,
+                                                  .app_config = NULL};
+
+/*****************************************************************************
+ * STATIC FUNCTIONS
+ *****************************************************************************/
+static void test_app_main(usb_event_t usb_evt, const void *app_config) {
+  app_runs++;
+}
+
+static void test_app_init(const void *app_config) {
+  init_config = app_config;
+  init_count++;
+}
+
+/*****************************************************************************
+ * GLOBAL FUNCTIONS
+ *****************************************************************************/
+TEST_GROUP(app_registry_test);
+
+TEST_SETUP(app_registry_test) {
+  // the registry outlives the tests; the second registration is rejected
+  registry_add_app(&test_app_desc);
+  registry_add_app(&test_plain_app_desc);
+}
+
+TEST_TEAR_DOWN(app_registry_test) {
+}
+
+TEST(app_registry_test, init_runs_once_on_first_lookup) {
+  TEST_ASSERT_FALSE(registry_add_app(&test_app_desc));
+  TEST_ASSERT_EQUAL_PTR(&test_app_desc, registry_get_app_desc(TEST_APP_ID));
+  TEST_ASSERT_EQUAL_PTR(&test_app_desc, registry_get_app_desc(TEST_APP_ID));
+
+  TEST_ASSERT_EQUAL_UINT8(1, init_count);
+  TEST_ASSERT_EQUAL_PTR(&test_app_config, init_config);
+}
+
+TEST(app_registry_test, app_without_init) {
+  TEST_ASSERT_EQUAL_PTR(&test_plain_app_desc,
+                        registry_get_app_desc(TEST_PLAIN_APP_ID));
+}
+
+TEST(app_registry_test, unknown_app_id) {
+  TEST_ASSERT_NULL(registry_get_app_desc(3));
+  TEST_ASSERT_NULL(registry_get_app_desc(REGISTRY_MAX_APPS));
+  TEST_ASSERT_NULL(registry_get_app_desc(UINT32_MAX));
+}
+
+TEST(app_registry_test, dispatch_counts_invocations) {
+  registry_app_stats_t stats = {0};
+  usb_event_t usb_evt = {0};
+
+  registry_reset_app_stats();
+  app_runs = 0;
+  usb_stream_set_accepted(true);
+  registry_dispatch(&test_app_desc, usb_evt);
+  registry_dispatch(&test_app_desc, usb_evt);
+
+  TEST_ASSERT_EQUAL_UINT8(2, app_runs);
+  TEST_ASSERT_FALSE(get_comm_status()->stream_accepted);
+  TEST_ASSERT_TRUE(registry_get_app_stats(TEST_APP_ID, &stats));
+  TEST_ASSERT_EQUAL_UINT32(2, stats.invocations);
+  TEST_ASSERT_LESS_OR_EQUAL_UINT32(stats.total_ms, stats.max_ms);
+  TEST_ASSERT_TRUE(registry_get_app_stats(TEST_PLAIN_APP_ID, &stats));
+  TEST_ASSERT_EQUAL_UINT32(0, stats.invocations);
+  TEST_ASSERT_FALSE(registry_get_app_stats(REGISTRY_MAX_APPS, &stats));
+
+  registry_reset_app_stats();
+  TEST_ASSERT_TRUE(registry_get_app_stats(TEST_APP_ID, &stats));
+  TEST_ASSERT_EQUAL_UINT32(0, stats.invocations);
+  TEST_ASSERT_EQUAL_UINT32(0, stats.total_ms);
+}
@@ -180,3 +180,21 @@ TEST(event_getter_test, disabled_events) {
   TEST_ASSERT_TRUE(evt_status.p0_event.inactivity_evt);
   TEST_ASSERT_FALSE(evt_status.p0_event.abort_evt);
 }
+
+TEST(event_getter_test, work_event) {
+  events_set_work_done();
+  // trigger an usb event
+  usb_set_event(4, core_msg, 0, NULL);
+
+  evt_status_t evt_status = get_events(EVENT_CONFIG_WORK, 5000);
+  TEST_ASSERT_FALSE(evt_status.p0_event.flag);
+  TEST_ASSERT_FALSE(evt_status.usb_event.flag);
+  TEST_ASSERT_TRUE(evt_status.work_done);
+
+  // the completion is returned once
+  events_set_work_done();
+  events_reset_work_done();
+  evt_status = get_events(EVENT_CONFIG_USB | EVENT_CONFIG_WORK, 5000);
+  TEST_ASSERT_TRUE(evt_status.usb_event.flag);
+  TEST_ASSERT_FALSE(evt_status.work_done);
+}
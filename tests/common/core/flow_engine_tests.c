@@ -61,6 +61,7 @@
  *****************************************************************************/
 #include "flow_engine.h"
 #include "nfc_events_priv.h"
+#include "task_scheduler.h"
 #include "ui_events_priv.h"
 #include "unity_fixture.h"
 #include "usb_api_priv.h"
@@ -80,6 +81,7 @@ typedef struct {
   bool p0_event;
   bool ui_event;
   bool usb_event;
+  bool work_event;
 } event_callback_tester_t;
 
 /*****************************************************************************
@@ -94,7 +96,11 @@ event_callback_tester_t callback_test = {.p0_event = true,
                                          .ui_event = true,
                                          .usb_event = true};
 
+const evt_config_t engine_work_evt_config = {.evt_selection = EVENT_CONFIG_WORK,
+                                             .timeout = 1200};
+
 static const uint8_t core_msg[] = {10, 2, 8, 1};
+static uint8_t work_slices = 0;
 
 /*****************************************************************************
  * GLOBAL VARIABLES
@@ -170,6 +176,24 @@ static void usb_callback(engine_ctx_t *ctx,
   return;
 }
 
+static bool work_task(uint32_t budget_ms) {
+  // one slice of a long computation
+  if (3 > ++work_slices) {
+    return true;
+  }
+
+  sched_remove_task(work_task);
+  events_set_work_done();
+  return false;
+}
+
+static void work_callback(engine_ctx_t *ctx, const void *data_ptr) {
+  callback_test.work_event = true;
+  TEST_ASSERT_EQUAL_UINT8(3, work_slices);
+  TEST_ASSERT_TRUE(engine_reset_flow(ctx));
+  return;
+}
+
 /*****************************************************************************
  * GLOBAL FUNCTIONS
  *****************************************************************************/
@@ -204,6 +228,15 @@ TEST_SETUP(flow_engine_tests) {
   engine_test_flow[2].nfc_cb = NULL;
   engine_test_flow[2].evt_cfg_ptr = &engine_test_evt_config;
   engine_test_flow[2].flow_data_ptr = NULL;
+
+  engine_test_flow[3].step_init_cb = NULL;
+  engine_test_flow[3].p0_cb = NULL;
+  engine_test_flow[3].ui_cb = NULL;
+  engine_test_flow[3].usb_cb = NULL;
+  engine_test_flow[3].nfc_cb = NULL;
+  engine_test_flow[3].work_cb = work_callback;
+  engine_test_flow[3].evt_cfg_ptr = &engine_work_evt_config;
+  engine_test_flow[3].flow_data_ptr = NULL;
 }
 
 TEST_TEAR_DOWN(flow_engine_tests) {
@@ -244,4 +277,28 @@ TEST(flow_engine_tests, engine_use_case_test) {
 
   TEST_ASSERT_TRUE(callback_test.ui_event);
   TEST_ASSERT_TRUE(callback_test.usb_event);
-}
\ No newline at end of file
+}
+
+TEST(flow_engine_tests, engine_work_test) {
+  flow_step_t *engine_test_buffer[10];
+
+  engine_ctx_t flow_list = {
+      .array = &engine_test_buffer[0],
+      .current_index = 0,
+      .max_capacity = sizeof(engine_test_buffer) / sizeof(flow_step_t *),
+      .size_of_element = sizeof(flow_step_t *),
+      .num_of_elements = 0};
+
+  TEST_ASSERT_TRUE(engine_reset_flow(&flow_list));
+  engine_add_next_flow_step(&flow_list, &engine_test_flow[3]);
+
+  // Start the work of the step, sliced by the scheduler while the engine waits
+  callback_test.work_event = false;
+  work_slices = 0;
+  events_reset_work_done();
+  TEST_ASSERT_TRUE(sched_add_task(work_task, SCHED_PRIO_MID, 1));
+
+  engine_run(&flow_list);
+
+  TEST_ASSERT_TRUE(callback_test.work_event);
+}
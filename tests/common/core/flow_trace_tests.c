@@ -0,0 +1,114 @@
+/**
+ * @file    flow_trace_tests.c
+ * @author  Cypherock X1 Team
+ * @brief   Unit tests for the flow status trace
+ * @copyright Copyright (c) 2023 HODL TECH PTE LTD
+ * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
+ *target=_blank>https://mitcc.org/</a>
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * (c) Copyright 2023 by HODL TECH PTE LTD
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * "Commons Clause" License Condition v1.0
+ *
+ * The Software is provided to you by the Licensor under the License,
+ * as defined below, subject to the following condition.
+ *
+ * Without limiting other conditions in the License, the grant of
+ * rights under the License will not include, and the License does not
+ * grant to you, the right to Sell the Software.
+ *
+ * For purposes of the foregoing, "Sell" means practicing any or all
+ * of the rights granted to you under the License to provide to third
+ * parties, for a fee or other consideration (including without
+ * limitation fees for hosting or consulting/ support services related
+ * to the Software), a product or service whose value derives, entirely
+ * or substantially, from the functionality of the Software. Any license
+ * notice or attribution required by the License must also include
+ * this Commons Clause License Condition notice.
+ *
+ * Software: All X1Wallet associated files.
+ * License: MIT
+ * Licensor: HODL TECH PTE LTD
+ *
+ ******************************************************************************
+ */
+/*****************************************************************************
+ * INCLUDES
+ *****************************************************************************/
+#include "flow_trace.h"
+#include "status_api.h"
+#include "unity_fixture.h"
+
+/*****************************************************************************
+ * GLOBAL FUNCTIONS
+ *****************************************************************************/
+TEST_GROUP(flow_trace_test);
+
+TEST_SETUP(flow_trace_test) {
+  set_core_flow_status(0);
+  set_app_flow_status(0);
+}
+
+TEST_TEAR_DOWN(flow_trace_test) {
+  flow_trace_end();
+}
+
+TEST(flow_trace_test, records_transitions_of_the_flow) {
+  set_app_flow_status(3);
+  flow_trace_begin(2);
+  set_app_flow_status(1);
+  set_app_flow_status(1);
+  set_core_flow_status(1);
+  set_app_flow_status(2);
+  flow_trace_end();
+  set_app_flow_status(4);
+
+  const flow_trace_t *trace = flow_trace_get();
+  TEST_ASSERT_EQUAL_UINT32(2, trace->app_id);
+  TEST_ASSERT_FALSE(trace->active);
+  TEST_ASSERT_EQUAL_UINT8(3, trace->count);
+  TEST_ASSERT_EQUAL_UINT8(0, trace->dropped);
+  TEST_ASSERT_EQUAL_HEX16(0x0001, trace->entries[0].flow_status);
+  TEST_ASSERT_EQUAL_HEX16(0x0101, trace->entries[1].flow_status);
+  TEST_ASSERT_EQUAL_HEX16(0x0102, trace->entries[2].flow_status);
+  TEST_ASSERT_TRUE(trace->entries[1].at >= trace->entries[0].at);
+  TEST_ASSERT_TRUE(trace->duration >= trace->entries[2].at);
+}
+
+TEST(flow_trace_test, counts_dropped_transitions) {
+  flow_trace_begin(2);
+  for (uint8_t status = 1; status <= FLOW_TRACE_MAX_ENTRIES + 5; status++) {
+    set_app_flow_status(status);
+  }
+
+  const flow_trace_t *trace = flow_trace_get();
+  TEST_ASSERT_TRUE(trace->active);
+  TEST_ASSERT_EQUAL_UINT8(FLOW_TRACE_MAX_ENTRIES, trace->count);
+  TEST_ASSERT_EQUAL_UINT8(5, trace->dropped);
+  TEST_ASSERT_EQUAL_HEX16(
+      FLOW_TRACE_MAX_ENTRIES,
+      trace->entries[FLOW_TRACE_MAX_ENTRIES - 1].flow_status);
+}
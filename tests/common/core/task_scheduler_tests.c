@@ -0,0 +1,143 @@
+/**
+ * @file    task_scheduler_tests.c
+ * @author  Cypherock X1 Team
+ * @brief   Unit tests for the cooperative task scheduler
+ * @copyright Copyright (c) 2023 HODL TECH PTE LTD
+ * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
+ *target=_blank>https://mitcc.org/</a>
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * (c) Copyright 2023 by HODL TECH PTE LTD
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * "Commons Clause" License Condition v1.0
+ *
+ * The Software is provided to you by the Licensor under the License,
+ * as defined below, subject to the following condition.
+ *
+ * Without limiting other conditions in the License, the grant of
+ * rights under the License will not include, and the License does not
+ * grant to you, the right to Sell the Software.
+ *
+ * For purposes of the foregoing, "Sell" means practicing any or all
+ * of the rights granted to you under the License to provide to third
+ * parties, for a fee or other consideration (including without
+ * limitation fees for hosting or consulting/ support services related
+ * to the Software), a product or service whose value derives, entirely
+ * or substantially, from the functionality of the Software. Any license
+ * notice or attribution required by the License must also include
+ * this Commons Clause License Condition notice.
+ *
+ * Software: All X1Wallet associated files.
+ * License: MIT
+ * Licensor: HODL TECH PTE LTD
+ *
+ ******************************************************************************
+ */
+/*****************************************************************************
+ * INCLUDES
+ *****************************************************************************/
+#include "memzero.h"
+#include "task_scheduler.h"
+#include "unity_fixture.h"
+
+/*****************************************************************************
+ * PRIVATE MACROS AND DEFINES
+ *****************************************************************************/
+#define TEST_BUDGET_MS 0xFFFFFF
+
+/*****************************************************************************
+ * STATIC VARIABLES
+ *****************************************************************************/
+static char run_log[16] = {0};
+static uint8_t run_count = 0;
+static uint8_t low_runs_left = 0;
+static uint8_t high_runs_left = 0;
+
+/*****************************************************************************
+ * STATIC FUNCTIONS
+ *****************************************************************************/
+static bool low_task(uint32_t budget_ms) {
+  run_log[run_count++] = 'L';
+  return (0 != --low_runs_left);
+}
+
+static bool high_task(uint32_t budget_ms) {
+  run_log[run_count++] = 'H';
+  return (0 != --high_runs_left);
+}
+
+static bool preempting_task(uint32_t budget_ms) {
+  run_log[run_count++] = 'P';
+  sched_preempt();
+  return true;
+}
+
+static bool self_removing_task(uint32_t budget_ms) {
+  run_log[run_count++] = 'R';
+  sched_remove_task(self_removing_task);
+  return true;
+}
+
+/*****************************************************************************
+ * GLOBAL FUNCTIONS
+ *****************************************************************************/
+TEST_GROUP(task_scheduler_test);
+
+TEST_SETUP(task_scheduler_test) {
+  memzero(run_log, sizeof(run_log));
+  run_count = 0;
+}
+
+TEST_TEAR_DOWN(task_scheduler_test) {
+  sched_remove_task(low_task);
+  sched_remove_task(high_task);
+  sched_remove_task(preempting_task);
+  sched_remove_task(self_removing_task);
+}
+
+TEST(task_scheduler_test, priority_order_until_idle) {
+  low_runs_left = 2;
+  high_runs_left = 3;
+  TEST_ASSERT_TRUE(sched_add_task(low_task, SCHED_PRIO_LOW, 10));
+  TEST_ASSERT_TRUE(sched_add_task(high_task, SCHED_PRIO_HIGH, 10));
+
+  TEST_ASSERT_FALSE(sched_run_until_idle(TEST_BUDGET_MS));
+  TEST_ASSERT_EQUAL_STRING("HHHLL", run_log);
+}
+
+TEST(task_scheduler_test, preempt_returns_with_pending_work) {
+  TEST_ASSERT_TRUE(sched_add_task(preempting_task, SCHED_PRIO_MID, 10));
+
+  TEST_ASSERT_TRUE(sched_run_until_idle(TEST_BUDGET_MS));
+  TEST_ASSERT_EQUAL_STRING("P", run_log);
+}
+
+TEST(task_scheduler_test, task_removes_itself) {
+  TEST_ASSERT_TRUE(sched_add_task(self_removing_task, SCHED_PRIO_MID, 10));
+
+  TEST_ASSERT_FALSE(sched_run_until_idle(TEST_BUDGET_MS));
+  TEST_ASSERT_FALSE(sched_run_until_idle(TEST_BUDGET_MS));
+  TEST_ASSERT_EQUAL_STRING("R", run_log);
+}
@@ -0,0 +1,217 @@
+/**
+ * @file    address_encoding_tests.c
+ * @author  Cypherock X1 Team
+ * @brief   Unit tests for Base58 and Bech32 address encoding
+ * @copyright Copyright (c) 2023 HODL TECH PTE LTD
+ * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
+ *target=_blank>https://mitcc.org/</a>
+ ******************************************************************************
+ * @attention
+ *
+ * (c) Copyright 2023 by HODL TECH PTE LTD
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * "Commons Clause" License Condition v1.0
+ *
+ * The Software is provided to you by the Licensor under the License,
+ * as defined below, subject to the following condition.
+ *
+ * Without limiting other conditions in the License, the grant of
+ * rights under the License will not include, and the License does not
+ * grant to you, the right to Sell the Software.
+ *
+ * For purposes of the foregoing, "Sell" means practicing any or all
+ * of the rights granted to you under the License to provide to third
+ * parties, for a fee or other consideration (including without
+ * limitation fees for hosting or consulting/ support services related
+ * to the Software), a product or service whose value derives, entirely
+ * or substantially, from the functionality of the Software. Any license
+ * notice or attribution required by the License must also include
+ * this Commons Clause License Condition notice.
+ *
+ * Software: All X1Wallet associated files.
+ * License: MIT
+ * Licensor: HODL TECH PTE LTD
+ *
+ ******************************************************************************
+ */
+
+#include <string.h>
+#include <time.h>
+
+#include "base58.h"
+#include "logger.h"
+#include "segwit_addr.h"
+#include "unity_fixture.h"
+
+#define B58_BENCH_ROUNDS 2000
+/// Length of a serialized extended key with its checksum
+#define B58_BENCH_LEN 82
+
+static const char reference_digits[] =
+    "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz";
+
+static uint8_t buffer[B58_BENCH_LEN] = {0};
+
+/**
+ * @brief Digit-at-a-time Base58 encoder used as reference
+ */
+static size_t reference_b58enc(char *b58, const uint8_t *bin, size_t binsz) {
+  uint8_t digits[2 * B58_BENCH_LEN] = {0};
+  size_t count = 0, zcount = 0, out = 0;
+
+  while (zcount < binsz && !bin[zcount])
+    ++zcount;
+  for (size_t i = zcount; i < binsz; i++) {
+    uint32_t carry = bin[i];
+    for (size_t j = 0; j < count; j++) {
+      carry += (uint32_t)digits[j] << 8;
+      digits[j] = carry % 58;
+      carry /= 58;
+    }
+    while (carry) {
+      digits[count++] = carry % 58;
+      carry /= 58;
+    }
+  }
+
+  for (size_t i = 0; i < zcount; i++)
+    b58[out++] = '1';
+  while (count)
+    b58[out++] = reference_digits[digits[--count]];
+  b58[out] = '\0';
+  return out + 1;
+}
+
+/**
+ * @brief Bit-wise BCH checksum step used as reference
+ */
+static uint32_t reference_polymod_step(uint32_t pre) {
+  static const uint32_t generator[5] = {
+      0x3b6a57b2, 0x26508e6d, 0x1ea119fa, 0x3d4233dd, 0x2a1462b3};
+  uint32_t chk = (pre & 0x1FFFFFF) << 5;
+  for (uint8_t i = 0; i < 5; i++) {
+    if ((pre >> (25 + i)) & 1)
+      chk ^= generator[i];
+  }
+  return chk;
+}
+
+TEST_GROUP(address_encoding_test);
+
+TEST_SETUP(address_encoding_test) {
+  for (uint16_t i = 0; i < sizeof(buffer); i++) {
+    buffer[i] = (uint8_t)(i * 37 + 11);
+  }
+}
+
+TEST_TEAR_DOWN(address_encoding_test) {
+  return;
+}
+
+TEST(address_encoding_test, base58_known_vector) {
+  const uint8_t data[] = {0x00, 0x00, 0x9d, 0x6b, 0xc3, 0x13,
+                          0x62, 0x70, 0xb9, 0x50, 0xdb, 0x22};
+  char b58[32] = "";
+  size_t b58sz = sizeof(b58);
+
+  TEST_ASSERT_TRUE(b58enc(b58, &b58sz, data, sizeof(data)));
+  TEST_ASSERT_EQUAL_STRING("119qxsVJoXcFzCLZ", b58);
+  TEST_ASSERT_EQUAL(17, b58sz);
+}
+
+TEST(address_encoding_test, base58_matches_reference) {
+  char expected[2 * B58_BENCH_LEN] = "";
+  char b58[2 * B58_BENCH_LEN] = "";
+
+  for (uint16_t len = 0; len <= sizeof(buffer); len++) {
+    // exercise the leading zero handling as well
+    for (uint8_t zeros = 0; zeros < 3 && zeros <= len; zeros++) {
+      uint8_t data[B58_BENCH_LEN] = {0};
+      size_t b58sz = sizeof(b58);
+      memcpy(data + zeros, buffer, len - zeros);
+
+      size_t expected_sz = reference_b58enc(expected, data, len);
+      TEST_ASSERT_TRUE(b58enc(b58, &b58sz, data, len));
+      TEST_ASSERT_EQUAL(expected_sz, b58sz);
+      TEST_ASSERT_EQUAL_STRING(expected, b58);
+
+      // one byte short of the required output size
+      b58sz = expected_sz - 1;
+      TEST_ASSERT_FALSE(b58enc(b58, &b58sz, data, len));
+      TEST_ASSERT_EQUAL(expected_sz, b58sz);
+    }
+  }
+}
+
+TEST(address_encoding_test, bech32_polymod_matches_reference) {
+  uint32_t pre = 1;
+  for (uint32_t i = 0; i < 4096; i++) {
+    pre = (pre * 2654435761u + i) & 0x3FFFFFFF;
+    TEST_ASSERT_EQUAL_HEX32(reference_polymod_step(pre),
+                            bech32_polymod_step(pre));
+  }
+}
+
+TEST(address_encoding_test, segwit_known_vector) {
+  const uint8_t program[20] = {
+      0x75, 0x1e, 0x76, 0xe8, 0x19, 0x91, 0x96, 0xd4, 0x54, 0x94,
+      0x1c, 0x45, 0xd1, 0xb3, 0xa3, 0x23, 0xf1, 0x43, 0x3b, 0xd6};
+  char address[100] = "";
+
+  TEST_ASSERT_EQUAL(
+      1, segwit_addr_encode(address, "bc", 0, program, sizeof(program)));
+  TEST_ASSERT_EQUAL_STRING("bc1qw508d6qejxtdg4y5r3zarvary0c5xw7kv8f3t4",
+                           address);
+}
+
+/**
+ * @brief Micro-benchmark of the limb based Base58 encoder against the
+ * digit-at-a-time reference
+ * @details Both encoders run over extended key sized inputs; the timings are
+ * logged and the limb based encoder is expected to be no slower than
+ * reference.
+ */
+TEST(address_encoding_test, benchmark) {
+  char b58[2 * B58_BENCH_LEN] = "";
+  volatile size_t sink = 0;
+  clock_t start = clock();
+  for (uint16_t round = 0; round < B58_BENCH_ROUNDS; round++) {
+    buffer[0] = (uint8_t)round | 1;
+    sink ^= reference_b58enc(b58, buffer, sizeof(buffer));
+  }
+  clock_t reference_ticks = clock() - start;
+
+  start = clock();
+  for (uint16_t round = 0; round < B58_BENCH_ROUNDS; round++) {
+    size_t b58sz = sizeof(b58);
+    buffer[0] = (uint8_t)round | 1;
+    b58enc(b58, &b58sz, buffer, sizeof(buffer));
+    sink ^= b58sz;
+  }
+  clock_t limb_ticks = clock() - start;
+
+  LOG_SWV("base58 digit-wise: %ld, limb: %ld ticks\n",
+          (long)reference_ticks,
+          (long)limb_ticks);
+  TEST_ASSERT_TRUE(limb_ticks <= reference_ticks);
+}
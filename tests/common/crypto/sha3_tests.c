@@ -0,0 +1,160 @@
+/**
+ * @file    sha3_tests.c
+ * @author  Cypherock X1 Team
+ * @brief   Known-answer tests for SHA-3 and Keccak hashing
+ * @copyright Copyright (c) 2023 HODL TECH PTE LTD
+ * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
+ *target=_blank>https://mitcc.org/</a>
+ ******************************************************************************
+ * @attention
+ *
+ * (c) Copyright 2023 by HODL TECH PTE LTD
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * "Commons Clause" License Condition v1.0
+ *
+ * The Software is provided to you by the Licensor under the License,
+ * as defined below, subject to the following condition.
+ *
+ * Without limiting other conditions in the License, the grant of
+ * rights under the License will not include, and the License does not
+ * grant to you, the right to Sell the Software.
+ *
+ * For purposes of the foregoing, "Sell" means practicing any or all
+ * of the rights granted to you under the License to provide to third
+ * parties, for a fee or other consideration (including without
+ * limitation fees for hosting or consulting/ support services related
+ * to the Software), a product or service whose value derives, entirely
+ * or substantially, from the functionality of the Software. Any license
+ * notice or attribution required by the License must also include
+ * this Commons Clause License Condition notice.
+ *
+ * Software: All X1Wallet associated files.
+ * License: MIT
+ * Licensor: HODL TECH PTE LTD
+ *
+ ******************************************************************************
+ */
+
+#include <string.h>
+
+#include "sha3.h"
+#include "unity_fixture.h"
+#include "utils.h"
+
+/// Longer than one SHA3-256 block, hence exercises more than one permutation
+#define SHA3_LONG_MSG_LEN 200
+
+static uint8_t long_msg[SHA3_LONG_MSG_LEN] = {0};
+
+TEST_GROUP(sha3_test);
+
+TEST_SETUP(sha3_test) {
+  memset(long_msg, 'a', sizeof(long_msg));
+}
+
+TEST_TEAR_DOWN(sha3_test) {
+  return;
+}
+
+TEST(sha3_test, keccak_256_known_answers) {
+  uint8_t expected[SHA3_256_DIGEST_LENGTH] = {0};
+  uint8_t digest[SHA3_256_DIGEST_LENGTH] = {0};
+
+  hex_string_to_byte_array(
+      "c5d2460186f7233c927e7db2dcc703c0e500b653ca82273b7bfad8045d85a470",
+      64,
+      expected);
+  keccak_256((const uint8_t *)"", 0, digest);
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, digest, sizeof(digest));
+
+  hex_string_to_byte_array(
+      "4e03657aea45a94fc7d47ba826c8d667c0d1e6e33a64a036ec44f58fa12d6c45",
+      64,
+      expected);
+  keccak_256((const uint8_t *)"abc", 3, digest);
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, digest, sizeof(digest));
+
+  hex_string_to_byte_array(
+      "96ea54061def936c4be90b518992fdc6f12f535068a256229aca54267b4d084d",
+      64,
+      expected);
+  keccak_256(long_msg, sizeof(long_msg), digest);
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, digest, sizeof(digest));
+}
+
+TEST(sha3_test, sha3_256_known_answers) {
+  uint8_t expected[SHA3_256_DIGEST_LENGTH] = {0};
+  uint8_t digest[SHA3_256_DIGEST_LENGTH] = {0};
+
+  hex_string_to_byte_array(
+      "a7ffc6f8bf1ed76651c14756a061d662f580ff4de43b49fa82d80a4b80f8434a",
+      64,
+      expected);
+  sha3_256((const uint8_t *)"", 0, digest);
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, digest, sizeof(digest));
+
+  hex_string_to_byte_array(
+      "3a985da74fe225b2045c172d6bd390bd855f086e3e9d525b46bfe24511431532",
+      64,
+      expected);
+  sha3_256((const uint8_t *)"abc", 3, digest);
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, digest, sizeof(digest));
+
+  hex_string_to_byte_array(
+      "cce34485baf2bf2aca99b94833892a4f52896d3d153f7b840cc4f9fe695f1387",
+      64,
+      expected);
+  sha3_256(long_msg, sizeof(long_msg), digest);
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, digest, sizeof(digest));
+}
+
+TEST(sha3_test, sha3_512_known_answer) {
+  uint8_t expected[SHA3_512_DIGEST_LENGTH] = {0};
+  uint8_t digest[SHA3_512_DIGEST_LENGTH] = {0};
+
+  hex_string_to_byte_array(
+      "b751850b1a57168a5693cd924b6b096e08f621827444f70d884f5d0240d2712e"
+      "10e116e9192af3c91a7ec57647e3934057340b4cf408d5a56592f8274eec53f0",
+      128,
+      expected);
+  sha3_512((const uint8_t *)"abc", 3, digest);
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, digest, sizeof(digest));
+}
+
+TEST(sha3_test, incremental_matches_one_shot) {
+  uint8_t expected[SHA3_256_DIGEST_LENGTH] = {0};
+  uint8_t digest[SHA3_256_DIGEST_LENGTH] = {0};
+  SHA3_CTX ctx = {0};
+
+  keccak_256(long_msg, sizeof(long_msg), expected);
+  // odd chunk sizes split blocks and feed unaligned input
+  for (uint8_t chunk = 1; chunk < 20; chunk++) {
+    keccak_256_Init(&ctx);
+    for (uint16_t offset = 0; offset < sizeof(long_msg); offset += chunk) {
+      uint16_t len = sizeof(long_msg) - offset;
+      keccak_Update(&ctx, long_msg + offset, len < chunk ? len : chunk);
+    }
+    keccak_Final(&ctx, digest);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, digest, sizeof(digest));
+  }
+}
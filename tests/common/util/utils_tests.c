@@ -56,17 +56,22 @@
  ******************************************************************************
  */
 
+#include <string.h>
+
 #include "lv_symbol_def.h"
+#include "pb_arena.h"
 #include "unity_fixture.h"
 #include "utils.h"
 
 TEST_GROUP(utils_tests);
 
 TEST_SETUP(utils_tests) {
+  cy_free();
   return;
 }
 
 TEST_TEAR_DOWN(utils_tests) {
+  cy_free();
   return;
 }
 
@@ -226,3 +231,107 @@ TEST(utils_tests, escape_string_invalid_args) {
   result = string_to_escaped_string(utf_8_string, utf_8_string, 8);
   TEST_ASSERT_EQUAL_UINT8(1, result);
 }
+
+TEST(utils_tests, arena_alloc_zeroed_and_aligned) {
+  uint8_t *first = cy_malloc(3);
+  uint8_t *second = cy_malloc(16);
+
+  TEST_ASSERT_EQUAL(0, (uintptr_t)first % 8);
+  TEST_ASSERT_EQUAL(0, (uintptr_t)second % 8);
+  TEST_ASSERT_TRUE(second >= first + 3);
+  TEST_ASSERT_EACH_EQUAL_UINT8(0, second, 16);
+  memset(first, 0xA5, 3);
+  memset(second, 0xA5, 16);
+  TEST_ASSERT_EACH_EQUAL_UINT8(0xA5, first, 3);
+}
+
+TEST(utils_tests, arena_reset_to_mark_zeroizes) {
+  uint8_t *kept = cy_malloc(8);
+  memset(kept, 0x11, 8);
+  cy_arena_mark_t mark = cy_arena_mark();
+  uint8_t *scratch = cy_malloc(32);
+  memset(scratch, 0x22, 32);
+
+  cy_arena_reset(mark);
+  TEST_ASSERT_EACH_EQUAL_UINT8(0x11, kept, 8);
+  TEST_ASSERT_EACH_EQUAL_UINT8(0, scratch, 32);
+  // the released space is handed out again
+  TEST_ASSERT_EQUAL_PTR(scratch, cy_malloc(32));
+}
+
+TEST(utils_tests, arena_falls_back_to_heap) {
+  uint8_t *head = cy_malloc(CY_ARENA_SIZE - 8);
+  cy_arena_mark_t mark = cy_arena_mark();
+  uint8_t *large = cy_malloc(64);
+  uint8_t *tail = cy_malloc(8);
+
+  TEST_ASSERT_NOT_NULL(large);
+  TEST_ASSERT_EACH_EQUAL_UINT8(0, large, 64);
+  TEST_ASSERT_EQUAL_PTR(head + CY_ARENA_SIZE - 8, tail);
+  memset(large, 0x33, 64);
+
+  cy_arena_reset(mark);
+  TEST_ASSERT_EQUAL_PTR(tail, cy_malloc(8));
+}
+
+TEST(utils_tests, arena_pb_realloc_grows_top_block_in_place) {
+  uint8_t *field = pb_realloc(NULL, 4);
+  memset(field, 0x44, 4);
+
+  TEST_ASSERT_EQUAL_PTR(field, pb_realloc(field, 40));
+  TEST_ASSERT_EACH_EQUAL_UINT8(0x44, field, 4);
+  TEST_ASSERT_EACH_EQUAL_UINT8(0, field + 4, 36);
+  // the next block starts past the grown one
+  TEST_ASSERT_TRUE((uint8_t *)cy_malloc(1) >= field + 40);
+}
+
+TEST(utils_tests, arena_pb_realloc_moves_covered_block) {
+  uint8_t *field = pb_realloc(NULL, 8);
+  memset(field, 0x55, 8);
+  uint8_t *next = pb_realloc(NULL, 8);
+
+  uint8_t *moved = pb_realloc(field, 16);
+  TEST_ASSERT_TRUE(moved > next);
+  TEST_ASSERT_EACH_EQUAL_UINT8(0x55, moved, 8);
+  TEST_ASSERT_EACH_EQUAL_UINT8(0, moved + 8, 8);
+  TEST_ASSERT_EACH_EQUAL_UINT8(0, field, 8);
+
+  pb_free(moved);
+  cy_free();
+  TEST_ASSERT_EACH_EQUAL_UINT8(0, moved, 16);
+}
+
+TEST(utils_tests, decimal_string_formats_amounts) {
+  uint8_t max_256[32] = {0};
+  memset(max_256, 0xff, sizeof(max_256));
+  // 10^9 crosses a chunk boundary, 12345 is padded after the decimal point
+  const uint8_t billion[] = {0x00, 0x3b, 0x9a, 0xca, 0x00};
+  const uint8_t small[] = {0x30, 0x39};
+  char out[100] = "";
+
+  TEST_ASSERT_TRUE(
+      byte_array_to_decimal_string(max_256, 32, 18, out, sizeof(out)));
+  TEST_ASSERT_EQUAL_STRING("115792089237316195423570985008687907853269984665640"
+                           "564039457.584007913129639935",
+                           out);
+  TEST_ASSERT_TRUE(
+      byte_array_to_decimal_string(billion, 5, 9, out, sizeof(out)));
+  TEST_ASSERT_EQUAL_STRING("1", out);
+  TEST_ASSERT_TRUE(
+      byte_array_to_decimal_string(billion, 5, 0, out, sizeof(out)));
+  TEST_ASSERT_EQUAL_STRING("1000000000", out);
+  TEST_ASSERT_TRUE(byte_array_to_decimal_string(small, 2, 18, out, 100));
+  TEST_ASSERT_EQUAL_STRING("0.000000000000012345", out);
+  TEST_ASSERT_TRUE(byte_array_to_decimal_string(small, 0, 18, out, 100));
+  TEST_ASSERT_EQUAL_STRING("0", out);
+}
+
+TEST(utils_tests, decimal_string_short_out_buff) {
+  const uint8_t value[] = {0x12, 0x34, 0x56};
+  char out[9] = "";
+
+  // "11930.46" needs 9 bytes with the terminator
+  TEST_ASSERT_TRUE(byte_array_to_decimal_string(value, 3, 2, out, 9));
+  TEST_ASSERT_EQUAL_STRING("11930.46", out);
+  TEST_ASSERT_FALSE(byte_array_to_decimal_string(value, 3, 2, out, 8));
+}
@@ -0,0 +1,278 @@
+/**
+ * @file    flash_journal_tests.c
+ * @author  Cypherock X1 Team
+ * @brief   Unit tests for the flash journal on the simulator flash
+ * @copyright Copyright (c) 2023 HODL TECH PTE LTD
+ * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
+ *target=_blank>https://mitcc.org/</a>
+ ******************************************************************************
+ * @attention
+ *
+ * (c) Copyright 2023 by HODL TECH PTE LTD
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * "Commons Clause" License Condition v1.0
+ *
+ * The Software is provided to you by the Licensor under the License,
+ * as defined below, subject to the following condition.
+ *
+ * Without limiting other conditions in the License, the grant of
+ * rights under the License will not include, and the License does not
+ * grant to you, the right to Sell the Software.
+ *
+ * For purposes of the foregoing, "Sell" means practicing any or all
+ * of the rights granted to you under the License to provide to third
+ * parties, for a fee or other consideration (including without
+ * limitation fees for hosting or consulting/ support services related
+ * to the Software), a product or service whose value derives, entirely
+ * or substantially, from the functionality of the Software. Any license
+ * notice or attribution required by the License must also include
+ * this Commons Clause License Condition notice.
+ *
+ * Software: All X1Wallet associated files.
+ * License: MIT
+ * Licensor: HODL TECH PTE LTD
+ *
+ ******************************************************************************
+ */
+
+#include <string.h>
+
+#include "flash_if.h"
+#include "flash_journal.h"
+#include "unity_fixture.h"
+
+#if USE_SIMULATOR == 1
+
+/// The journal takes the data region of the flash struct; it is restored
+/// after each test
+#define TEST_BASE_ADDR FLASH_DATA_ADDRESS
+#define TEST_BANK_SIZE (2 * FLASH_PAGE_SIZE)
+#define TEST_IMAGE_SIZE 256
+/// Offset of the first delta record: the snapshot, its seal and generation
+#define TEST_RECORDS_OFFSET (TEST_IMAGE_SIZE + 16)
+
+static uint32_t flash_backup[2 * TEST_BANK_SIZE / sizeof(uint32_t)];
+static uint8_t journal_image[TEST_IMAGE_SIZE];
+static flash_journal_t journal;
+
+/// The simulator flash driver counts lengths in words
+static void test_flash_read(uint32_t addr, void *data, uint32_t len) {
+  read_cmd(addr, (uint32_t *)data, len / sizeof(uint32_t));
+}
+
+static void test_flash_write(uint32_t addr, const void *data, uint32_t len) {
+  write_cmd(addr, (const uint32_t *)data, len / sizeof(uint32_t));
+}
+
+static uint32_t test_bank_addr(uint8_t bank) {
+  return TEST_BASE_ADDR + bank * TEST_BANK_SIZE;
+}
+
+static void test_fill(uint8_t *image, uint8_t seed) {
+  for (uint16_t i = 0; i < TEST_IMAGE_SIZE; i++) {
+    image[i] = (uint8_t)(seed + i * 7);
+  }
+}
+
+/// Forgets the state in RAM and loads the journal again from flash
+static bool test_reload(void) {
+  memset(&journal, 0, sizeof(journal));
+  memset(journal_image, 0, sizeof(journal_image));
+  journal.base_addr = TEST_BASE_ADDR;
+  journal.bank_size = TEST_BANK_SIZE;
+  journal.image_size = TEST_IMAGE_SIZE;
+  journal.image = journal_image;
+  return flash_journal_load(&journal);
+}
+
+/// Saves whole new images until the journal compacts into the other bank
+static void test_save_until_compacted(uint8_t *image) {
+  const uint8_t bank = journal.bank;
+  uint8_t seed = image[0];
+
+  while (bank == journal.bank) {
+    test_fill(image, ++seed);
+    flash_journal_save(&journal, image);
+  }
+}
+
+TEST_GROUP(flash_journal_test);
+
+TEST_SETUP(flash_journal_test) {
+  test_flash_read(TEST_BASE_ADDR, flash_backup, sizeof(flash_backup));
+  erase_cmd(TEST_BASE_ADDR, sizeof(flash_backup));
+  TEST_ASSERT_FALSE(test_reload());
+}
+
+TEST_TEAR_DOWN(flash_journal_test) {
+  erase_cmd(TEST_BASE_ADDR, sizeof(flash_backup));
+  test_flash_write(TEST_BASE_ADDR, flash_backup, sizeof(flash_backup));
+}
+
+TEST(flash_journal_test, load_picks_newer_generation) {
+  uint8_t image[TEST_IMAGE_SIZE] = {0};
+  uint8_t old_page[FLASH_PAGE_SIZE] = {0};
+
+  // generation 1 on bank 0, then 2 on bank 1
+  test_fill(image, 1);
+  flash_journal_save(&journal, image);
+  TEST_ASSERT_EQUAL_UINT8(0, journal.bank);
+  test_save_until_compacted(image);
+  TEST_ASSERT_EQUAL_UINT8(1, journal.bank);
+
+  // generation 3 goes back to bank 0; keep bank 1 as if its erase was lost
+  test_flash_read(test_bank_addr(1), old_page, sizeof(old_page));
+  test_save_until_compacted(image);
+  TEST_ASSERT_EQUAL_UINT8(0, journal.bank);
+  TEST_ASSERT_TRUE(3 == journal.generation);
+  test_flash_write(test_bank_addr(1), old_page, sizeof(old_page));
+
+  TEST_ASSERT_TRUE(test_reload());
+  TEST_ASSERT_EQUAL_UINT8(0, journal.bank);
+  TEST_ASSERT_TRUE(3 == journal.generation);
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(image, journal_image, TEST_IMAGE_SIZE);
+
+  // the stale bank is dropped, so the next load finds the same
+  TEST_ASSERT_TRUE(test_reload());
+  TEST_ASSERT_EQUAL_UINT8(0, journal.bank);
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(image, journal_image, TEST_IMAGE_SIZE);
+}
+
+TEST(flash_journal_test, compaction_interrupted_before_erase) {
+  uint8_t image[TEST_IMAGE_SIZE] = {0};
+  uint8_t old_page[FLASH_PAGE_SIZE] = {0};
+
+  test_fill(image, 1);
+  flash_journal_save(&journal, image);
+  test_flash_read(test_bank_addr(0), old_page, sizeof(old_page));
+
+  // the new bank is sealed, the old one is not yet erased
+  test_save_until_compacted(image);
+  test_flash_write(test_bank_addr(0), old_page, sizeof(old_page));
+
+  TEST_ASSERT_TRUE(test_reload());
+  TEST_ASSERT_EQUAL_UINT8(1, journal.bank);
+  TEST_ASSERT_TRUE(2 == journal.generation);
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(image, journal_image, TEST_IMAGE_SIZE);
+
+  // saves carry on from the recovered bank
+  image[5] ^= 0xFF;
+  flash_journal_save(&journal, image);
+  TEST_ASSERT_TRUE(test_reload());
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(image, journal_image, TEST_IMAGE_SIZE);
+}
+
+TEST(flash_journal_test, torn_save_is_dropped) {
+  uint8_t image[TEST_IMAGE_SIZE] = {0};
+  uint8_t expected[TEST_IMAGE_SIZE] = {0};
+  uint8_t word[FLASH_JOURNAL_ALIGN] = {0};
+
+  test_fill(image, 1);
+  flash_journal_save(&journal, image);
+  memcpy(expected, image, sizeof(expected));
+
+  // a save of two records; the data of the last one is torn
+  const uint32_t offset = journal.write_offset;
+  image[0] ^= 0xFF;
+  image[100] ^= 0xFF;
+  flash_journal_save(&journal, image);
+  const uint32_t last_data = test_bank_addr(journal.bank) + offset +
+                             2 * FLASH_JOURNAL_ALIGN +
+                             FLASH_JOURNAL_ALIGNED(1);
+  test_flash_read(last_data, word, sizeof(word));
+  word[0] ^= 0x01;
+  test_flash_write(last_data, word, sizeof(word));
+
+  // neither record of the save applies
+  TEST_ASSERT_TRUE(test_reload());
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, journal_image, TEST_IMAGE_SIZE);
+  TEST_ASSERT_EQUAL_UINT32(TEST_BANK_SIZE, journal.write_offset);
+
+  // the next save compacts past the torn record
+  expected[7] ^= 0xFF;
+  flash_journal_save(&journal, expected);
+  TEST_ASSERT_TRUE(test_reload());
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, journal_image, TEST_IMAGE_SIZE);
+}
+
+TEST(flash_journal_test, legacy_unsealed_image) {
+  uint8_t image[TEST_IMAGE_SIZE] = {0};
+
+  // the layout written before the journal: the image alone on bank 0
+  test_fill(image, 9);
+  test_flash_write(test_bank_addr(0), image, sizeof(image));
+
+  TEST_ASSERT_TRUE(test_reload());
+  TEST_ASSERT_EQUAL_UINT8(0, journal.bank);
+  TEST_ASSERT_TRUE(0 == journal.generation);
+  TEST_ASSERT_EQUAL_UINT32(TEST_RECORDS_OFFSET, journal.write_offset);
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(image, journal_image, TEST_IMAGE_SIZE);
+
+  // deltas follow the blank seal slot
+  image[3] ^= 0xFF;
+  flash_journal_save(&journal, image);
+  TEST_ASSERT_TRUE(test_reload());
+  TEST_ASSERT_EQUAL_UINT8(0, journal.bank);
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(image, journal_image, TEST_IMAGE_SIZE);
+
+  // the first compaction seals generation 1 on bank 1
+  test_save_until_compacted(image);
+  TEST_ASSERT_TRUE(test_reload());
+  TEST_ASSERT_EQUAL_UINT8(1, journal.bank);
+  TEST_ASSERT_TRUE(1 == journal.generation);
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(image, journal_image, TEST_IMAGE_SIZE);
+}
+
+TEST(flash_journal_test, save_range_reload) {
+  uint8_t image[TEST_IMAGE_SIZE] = {0};
+  const uint8_t range[] = {0x10, 0x20, 0x30, 0x40, 0x50};
+
+  test_fill(image, 1);
+  flash_journal_save(&journal, image);
+
+  // bytes equal to the persisted ones are not programmed
+  const uint32_t offset = journal.write_offset;
+  flash_journal_save_range(&journal, 40, image + 40, 16);
+  TEST_ASSERT_EQUAL_UINT32(offset, journal.write_offset);
+
+  flash_journal_save_range(&journal, 40, range, sizeof(range));
+  TEST_ASSERT_EQUAL_UINT32(
+      offset + FLASH_JOURNAL_ALIGN + FLASH_JOURNAL_ALIGNED(sizeof(range)),
+      journal.write_offset);
+  memcpy(image + 40, range, sizeof(range));
+
+  TEST_ASSERT_TRUE(test_reload());
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(image, journal_image, TEST_IMAGE_SIZE);
+
+  // ranges keep coming through compactions
+  for (uint16_t i = 0; i < 2 * TEST_BANK_SIZE / FLASH_JOURNAL_ALIGN; i++) {
+    uint8_t byte = (uint8_t)(image[i % TEST_IMAGE_SIZE] + 1);
+    flash_journal_save_range(&journal, i % TEST_IMAGE_SIZE, &byte, 1);
+    image[i % TEST_IMAGE_SIZE] = byte;
+  }
+  TEST_ASSERT_TRUE(0 < journal.generation);
+  TEST_ASSERT_TRUE(test_reload());
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(image, journal_image, TEST_IMAGE_SIZE);
+}
+
+#endif /* USE_SIMULATOR == 1 */
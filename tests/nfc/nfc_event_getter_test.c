@@ -77,13 +77,13 @@ TEST_GROUP(nfc_events_manual_test);
 
 TEST_SETUP(nfc_events_manual_test) {
   instruction_scr_init("Dummy", "NFC EVENT TEST");
-  lv_task_handler();
+  ui_task_handler();
   return;
 }
 
 TEST_TEAR_DOWN(nfc_events_manual_test) {
   instruction_scr_destructor();
-  lv_task_handler();
+  ui_task_handler();
   nfc_reset_event();
   return;
 }
@@ -0,0 +1,40 @@
+/**
+ * @file    perf_baselines.h
+ * @author  Cypherock X1 Team
+ * @brief   Baselines of the performance regression gate
+ * @copyright Copyright (c) 2023 HODL TECH PTE LTD
+ * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
+ * target=_blank>https://mitcc.org/</a>
+ */
+#ifndef PERF_BASELINES_H
+#define PERF_BASELINES_H
+
+/*****************************************************************************
+ * MACROS AND DEFINES
+ *****************************************************************************/
+
+/// Growth of a count over its baseline that fails the gate, in percent
+#define PERF_GATE_TOLERANCE_PCT 3
+
+/*
+ * Count of one run of each kernel of perf_gate_tests.c; 0 while not recorded,
+ * which skips the check. Every run of the unit tests prints
+ * "perf,<kernel>,<count>,<baseline>" for each kernel; copy the counts here
+ * when a change is expected to move them. Counts below the baseline do not
+ * fail, but lower the baseline so that the gain is kept.
+ */
+#if USE_SIMULATOR == 0
+// core cycles of the device, firmware build of the CI toolchain
+#define PERF_BASELINE_BTC_P2PKH_DIGEST 0
+#define PERF_BASELINE_EVM_RLP_DECODE 0
+#define PERF_BASELINE_EIP712_HASH_STRUCT 0
+#define PERF_BASELINE_SOLANA_PARSE 0
+#else
+// user space instructions of the simulator on x86-64 Linux, CI toolchain
+#define PERF_BASELINE_BTC_P2PKH_DIGEST 0
+#define PERF_BASELINE_EVM_RLP_DECODE 0
+#define PERF_BASELINE_EIP712_HASH_STRUCT 0
+#define PERF_BASELINE_SOLANA_PARSE 0
+#endif
+
+#endif /* PERF_BASELINES_H */
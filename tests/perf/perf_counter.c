@@ -1,7 +1,7 @@
 /**
- * @file    optimism_app.c
+ * @file    perf_counter.c
  * @author  Cypherock X1 Team
- * @brief   Optimism application configuration and helpers
+ * @brief   Deterministic work counter of the performance regression gate
  * @copyright Copyright (c) 2023 HODL TECH PTE LTD
  * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
  *target=_blank>https://mitcc.org/</a>
@@ -56,30 +56,26 @@
  ******************************************************************************
  */
 
+
 /*****************************************************************************
  * INCLUDES
  *****************************************************************************/
-
-#include "optimism_app.h"
-
-#include <stddef.h>
-
-#include "evm_main.h"
+#include "perf_counter.h"
+
+#if USE_SIMULATOR == 0
+#include "board.h"
+#elif defined(__linux__)
+#include <linux/perf_event.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 /*****************************************************************************
  * EXTERN VARIABLES
  *****************************************************************************/
 
-/**
- * @brief Whitelisted contracts with respective token symbol
- * @details A map of Ethereum contract addresses with their token symbols. These
- * will enable the device to verify the ERC20 token transaction in a
- * user-friendly manner.
- *
- * @see erc20_contracts_t
- */
-extern const erc20_contracts_t optimism_contracts[];
-
 /*****************************************************************************
  * PRIVATE MACROS AND DEFINES
  *****************************************************************************/
@@ -92,43 +88,14 @@ extern const erc20_contracts_t optimism_contracts[];
  * STATIC FUNCTION PROTOTYPES
  *****************************************************************************/
 
-/**
- * @brief Checks if the provided token address is whitelisted and return the
- * matching contract instance.
- *
- * @param address Reference to the buffer containing the token address
- * @param contract Pointer to store the matched contract address instance
- *
- * @return bool Indicating if the provided token address is whitelisted
- * @return true If the address matches to an entry in the whitelist
- * @return false If the address does not match to an entry in the whitelist
- */
-static bool is_token_whitelisted(const uint8_t *address,
-                                 const erc20_contracts_t **contract);
-
 /*****************************************************************************
  * STATIC VARIABLES
  *****************************************************************************/
 
-static const evm_config_t optimism_app_config = {
-    .lunit_name = "ETH",
-    .name = "Optimism",
-    .chain_id = 10,
-
-    // whitelisted contracts
-    .is_token_whitelisted = is_token_whitelisted,
-};
-
-static const cy_app_desc_t optimism_app_desc = {
-    .id = 14,
-    .version =
-        {
-            .major = 1,
-            .minor = 0,
-            .patch = 0,
-        },
-    .app = evm_main,
-    .app_config = &optimism_app_config};
+#if USE_SIMULATOR == 1 && defined(__linux__)
+/// File descriptor of the perf event, -1 until opened
+static int perf_fd = -1;
+#endif
 
 /*****************************************************************************
  * GLOBAL VARIABLES
@@ -138,18 +105,67 @@ static const cy_app_desc_t optimism_app_desc = {
  * STATIC FUNCTIONS
  *****************************************************************************/
 
-static bool is_token_whitelisted(const uint8_t *address,
-                                 const erc20_contracts_t **contract) {
-  if (NULL != contract) {
-    *contract = NULL;
+/*****************************************************************************
+ * GLOBAL FUNCTIONS
+ *****************************************************************************/
+
+#if USE_SIMULATOR == 0
+bool perf_counter_init(void) {
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+  return true;
+}
+
+void perf_counter_start(void) {
+  __disable_irq();
+  DWT->CYCCNT = 0;
+}
+
+uint64_t perf_counter_stop(void) {
+  const uint32_t cycles = DWT->CYCCNT;
+  __enable_irq();
+  return cycles;
+}
+#elif defined(__linux__)
+bool perf_counter_init(void) {
+  if (0 <= perf_fd) {
+    return true;
   }
+
+  struct perf_event_attr attr;
+  memset(&attr, 0, sizeof(attr));
+  attr.type = PERF_TYPE_HARDWARE;
+  attr.size = sizeof(attr);
+  attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+  attr.disabled = 1;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  perf_fd = (int)syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+  return 0 <= perf_fd;
+}
+
+void perf_counter_start(void) {
+  ioctl(perf_fd, PERF_EVENT_IOC_RESET, 0);
+  ioctl(perf_fd, PERF_EVENT_IOC_ENABLE, 0);
+}
+
+uint64_t perf_counter_stop(void) {
+  uint64_t count = 0;
+  ioctl(perf_fd, PERF_EVENT_IOC_DISABLE, 0);
+  if (sizeof(count) != read(perf_fd, &count, sizeof(count))) {
+    return 0;
+  }
+  return count;
+}
+#else
+bool perf_counter_init(void) {
   return false;
 }
 
-/*****************************************************************************
- * GLOBAL FUNCTIONS
- *****************************************************************************/
+void perf_counter_start(void) {
+}
 
-const cy_app_desc_t *get_optimism_app_desc() {
-  return &optimism_app_desc;
-}
\ No newline at end of file
+uint64_t perf_counter_stop(void) {
+  return 0;
+}
+#endif
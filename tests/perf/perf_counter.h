@@ -1,28 +1,24 @@
 /**
- * @file    bsc_app.h
+ * @file    perf_counter.h
  * @author  Cypherock X1 Team
- * @brief   Binance Smart Chain application configuration
+ * @brief   Deterministic work counter of the performance regression gate
  * @copyright Copyright (c) 2023 HODL TECH PTE LTD
  * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
  * target=_blank>https://mitcc.org/</a>
  */
-#ifndef BSC_APP_H
-#define BSC_APP_H
+#ifndef PERF_COUNTER_H
+#define PERF_COUNTER_H
 
 /*****************************************************************************
  * INCLUDES
  *****************************************************************************/
-
-#include "app_registry.h"
-#include "evm_context.h"
+#include <stdbool.h>
+#include <stdint.h>
 
 /*****************************************************************************
  * MACROS AND DEFINES
  *****************************************************************************/
 
-/// Number of entries in whitelisted contracts list
-#define BSC_WHITELISTED_CONTRACTS_COUNT 0
-
 /*****************************************************************************
  * TYPEDEFS
  *****************************************************************************/
@@ -36,10 +32,26 @@
  *****************************************************************************/
 
 /**
- * @brief Returns the config for Binance Smart Chain chin app descriptor
+ * @brief Opens the counter: retired user space instructions of the simulator
+ * on Linux (perf events), core cycles of the device (DWT).
+ * @details Can be called again; only the first call opens the counter.
+ *
+ * @return bool True if the counter can be used, false eg. on other hosts or
+ * when perf events are not permitted (perf_event_paranoid > 2)
+ */
+bool perf_counter_init(void);
+
+/**
+ * @brief Resets and starts the counter. The device also masks the interrupts
+ * until perf_counter_stop() so that they are not counted.
+ */
+void perf_counter_start(void);
+
+/**
+ * @brief Stops the counter
  *
- * @return A const reference to cy_app_desc_t
+ * @return uint64_t Count since perf_counter_start()
  */
-const cy_app_desc_t *get_bsc_app_desc();
+uint64_t perf_counter_stop(void);
 
-#endif    // BSC_APP_H
+#endif /* PERF_COUNTER_H */
@@ -0,0 +1,319 @@
+/**
+ * @file    perf_gate_tests.c
+ * @author  Cypherock X1 Team
+ * @brief   Regression gate on the work done by the hot kernels of the apps
+ * @copyright Copyright (c) 2023 HODL TECH PTE LTD
+ * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
+ *target=_blank>https://mitcc.org/</a>
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * (c) Copyright 2023 by HODL TECH PTE LTD
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * "Commons Clause" License Condition v1.0
+ *
+ * The Software is provided to you by the Licensor under the License,
+ * as defined below, subject to the following condition.
+ *
+ * Without limiting other conditions in the License, the grant of
+ * rights under the License will not include, and the License does not
+ * grant to you, the right to Sell the Software.
+ *
+ * For purposes of the foregoing, "Sell" means practicing any or all
+ * of the rights granted to you under the License to provide to third
+ * parties, for a fee or other consideration (including without
+ * limitation fees for hosting or consulting/ support services related
+ * to the Software), a product or service whose value derives, entirely
+ * or substantially, from the functionality of the Software. Any license
+ * notice or attribution required by the License must also include
+ * this Commons Clause License Condition notice.
+ *
+ * Software: All X1Wallet associated files.
+ * License: MIT
+ * Licensor: HODL TECH PTE LTD
+ *
+ ******************************************************************************
+ */
+
+/*****************************************************************************
+ * INCLUDES
+ *****************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "btc_app.h"
+#include "btc_priv.h"
+#include "btc_txn_helpers.h"
+#include "eip712_utils.h"
+#include "evm_chains.h"
+#include "evm_priv.h"
+#include "evm_txn_helpers.h"
+#include "pb_decode.h"
+#include "perf_baselines.h"
+#include "perf_counter.h"
+#include "solana_txn_helpers.h"
+#include "unity_fixture.h"
+#include "utils.h"
+
+/*****************************************************************************
+ * PRIVATE MACROS AND DEFINES
+ *****************************************************************************/
+
+/// Runs of a kernel; the lowest count is kept so that a stray interrupt or
+/// page fault does not fail the gate
+#define PERF_GATE_RUNS 5
+
+/// Transfers of the solana transaction, as many as a transaction may have
+#define PERF_SOLANA_TRANSFERS SOLANA_MAX_INSTRUCTIONS
+
+/*****************************************************************************
+ * STATIC VARIABLES
+ *****************************************************************************/
+
+static btc_txn_input_t btc_input;
+static btc_sign_txn_output_t btc_outputs[2];
+static btc_txn_context_t btc_context;
+static evm_txn_context_t *evm_context = NULL;
+static uint8_t evm_txn[91];
+static evm_sign_typed_data_struct_t typed_data;
+static uint8_t typed_data_bytes[572];
+static uint8_t solana_txn[400];
+static uint16_t solana_txn_size = 0;
+static solana_unsigned_txn solana_utxn;
+static uint8_t digest[32];
+/// Result of the last run of a kernel
+static volatile bool kernel_ok;
+
+/*****************************************************************************
+ * STATIC FUNCTIONS
+ *****************************************************************************/
+
+/**
+ * @brief Measures the kernel and checks the count against its baseline
+ * @details The kernel runs once unmeasured to warm up, then PERF_GATE_RUNS
+ * times measured. Prints "perf,<name>,<count>,<baseline>", then fails if the
+ * count exceeds the baseline by more than PERF_GATE_TOLERANCE_PCT.
+ */
+static void perf_gate(const char *name,
+                      void (*kernel)(void),
+                      uint64_t baseline) {
+  static char message[128];
+
+  if (!perf_counter_init()) {
+    TEST_IGNORE_MESSAGE("no instruction counter on this host");
+  }
+
+  kernel();
+  TEST_ASSERT_TRUE(kernel_ok);
+
+  uint64_t count = UINT64_MAX;
+  for (uint8_t run = 0; run < PERF_GATE_RUNS; run++) {
+    perf_counter_start();
+    kernel();
+    const uint64_t sample = perf_counter_stop();
+    count = CY_MIN(count, sample);
+  }
+  printf("perf,%s,%llu,%llu\n",
+         name,
+         (unsigned long long)count,
+         (unsigned long long)baseline);
+
+  if (0 == baseline) {
+    TEST_IGNORE_MESSAGE("no baseline recorded");
+  }
+  if (count * 100 > baseline * (100 + PERF_GATE_TOLERANCE_PCT)) {
+    snprintf(message,
+             sizeof(message),
+             "%s regressed: %llu over the baseline %llu",
+             name,
+             (unsigned long long)count,
+             (unsigned long long)baseline);
+    TEST_FAIL_MESSAGE(message);
+  }
+}
+
+static void __attribute__((noinline)) kernel_btc_p2pkh_digest(void) {
+  kernel_ok = btc_digest_input(&btc_context, 0, digest);
+}
+
+static void __attribute__((noinline)) kernel_evm_rlp_decode(void) {
+  memzero(evm_context, sizeof(evm_txn_context_t));
+  kernel_ok =
+      (0 == evm_decode_unsigned_txn(evm_txn, sizeof(evm_txn), evm_context));
+}
+
+static void __attribute__((noinline)) kernel_eip712_hash_struct(void) {
+  kernel_ok = (0 == hash_struct(&typed_data.message, digest));
+}
+
+static void __attribute__((noinline)) kernel_solana_parse(void) {
+  memzero(&solana_utxn, sizeof(solana_utxn));
+  kernel_ok = (SOL_OK == solana_byte_array_to_unsigned_txn(
+                             solana_txn, solana_txn_size, &solana_utxn));
+}
+
+/*****************************************************************************
+ * GLOBAL FUNCTIONS
+ *****************************************************************************/
+TEST_GROUP(perf_gate_test);
+
+TEST_SETUP(perf_gate_test) {
+  g_btc_app = get_btc_app_desc()->app_config;
+  g_evm_app = evm_get_chain(1);
+}
+
+TEST_TEAR_DOWN(perf_gate_test) {
+  g_btc_app = NULL;
+  g_evm_app = NULL;
+  if (NULL != evm_context) {
+    free(evm_context);
+    evm_context = NULL;
+  }
+  pb_release(EVM_SIGN_TYPED_DATA_STRUCT_FIELDS, &typed_data);
+}
+
+TEST(perf_gate_test, btc_p2pkh_digest) {
+  // one input, two outputs; the fixture of btc_txn_helper_p2pkh_digest_1_2
+  btc_input = (btc_txn_input_t){
+      .value = 11014713900,
+      .prev_output_index = 0,
+      .script_pub_key = {.size = 25},
+      .script_type = SCRIPT_TYPE_P2PKH,
+      .sequence = UINT32_MAX,
+  };
+  btc_outputs[0] = (btc_sign_txn_output_t){
+      .value = 1100000000,
+      .script_pub_key = {.size = 25},
+  };
+  btc_outputs[1] = (btc_sign_txn_output_t){
+      .value = 9883316624,
+      .script_pub_key = {.size = 25},
+      .is_change = true,
+      .has_changes_index = true,
+  };
+  btc_context = (btc_txn_context_t){
+      .metadata = {.version = 2,
+                   .input_count = 1,
+                   .output_count = 2,
+                   .sighash = 1,
+                   .locktime = 0},
+      .change_output_idx = 1,
+  };
+  btc_context.inputs = &btc_input;
+  btc_context.outputs = btc_outputs;
+  hex_string_to_byte_array(
+      "630ff449462972b58a3e79d7117ddbc87df95b572185fbaea94282bd7f15c5e7",
+      64,
+      btc_input.prev_txn_hash);
+  hex_string_to_byte_array("76a91448f551693d43698002e0fe9f514aecf6f94f75f688ac",
+                           50,
+                           btc_input.script_pub_key.bytes);
+  hex_string_to_byte_array("76a914e05d7d7e46ff0ad8b53091a4d2edc69b60f251b888ac",
+                           50,
+                           btc_outputs[0].script_pub_key.bytes);
+  hex_string_to_byte_array("76a914a4695d02b19af59cdc2a524ce34eca9af5e1353688ac",
+                           50,
+                           btc_outputs[1].script_pub_key.bytes);
+
+  perf_gate("btc_p2pkh_digest",
+            kernel_btc_p2pkh_digest,
+            PERF_BASELINE_BTC_P2PKH_DIGEST);
+}
+
+TEST(perf_gate_test, evm_rlp_decode) {
+  // type 2 envelope with an access list; the fixture of
+  // evm_txn_eip1559_envelope
+  hex_string_to_byte_array(
+      "02f8580105016482520894bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb8080f838f7"
+      "94cccccccccccccccccccccccccccccccccccccccce1a0dddddddddddddddddddddddddd"
+      "dddddddddddddddddddddddddddddddddddddd",
+      182,
+      evm_txn);
+  evm_context = (evm_txn_context_t *)malloc(sizeof(evm_txn_context_t));
+  TEST_ASSERT_NOT_NULL(evm_context);
+
+  perf_gate(
+      "evm_rlp_decode", kernel_evm_rlp_decode, PERF_BASELINE_EVM_RLP_DECODE);
+}
+
+TEST(perf_gate_test, eip712_hash_struct) {
+  // Mail of the EIP-712 specification; the fixture of
+  // evm_sign_msg_test_typed_data_hash
+  hex_string_to_byte_array(
+      "0ae6010a06646f6d61696e10071804220c454950373132446f6d61696e32208b73c3c69b"
+      "b8fe3d512ecc4cf759cc79239f7b179b0ffacaa9a75d522b39400f3a1e0a046e616d6510"
+      "03180a2206737472696e672a0a4574686572204d61696c3a180a0776657273696f6e1003"
+      "18012206737472696e672a01313a360a07636861696e49641820220775696e743235362a"
+      "2000000000000000000000000000000000000000000000000000000000000000013a360a"
+      "11766572696679696e67436f6e7472616374100518142207616464726573732a14cccccc"
+      "cccccccccccccccccccccccccccccccccc12d0020a076d6573736167651007180322044d"
+      "61696c3220a0cedeb2dc280ba39b857546d74f5549c3a1d7bdc2dd96bf881f76108e23da"
+      "c23a7a0a0466726f6d100718022206506572736f6e3220b9d8c78acf9b987311de6c7b45"
+      "bb6a9c8e1bf361fa7fd3467a2163f994c795003a170a046e616d65100318032206737472"
+      "696e672a03436f773a2b0a0677616c6c6574100518142207616464726573732a14cd2a3d"
+      "9f938e13cd947ec05abc7fe734df8dd8263a780a02746f100718022206506572736f6e32"
+      "20b9d8c78acf9b987311de6c7b45bb6a9c8e1bf361fa7fd3467a2163f994c795003a170a"
+      "046e616d65100318032206737472696e672a03426f623a2b0a0677616c6c657410051814"
+      "2207616464726573732a14bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb3a230a0863"
+      "6f6e74656e74731003180b2206737472696e672a0b48656c6c6f2c20426f6221",
+      sizeof(typed_data_bytes) * 2,
+      typed_data_bytes);
+  pb_istream_t istream =
+      pb_istream_from_buffer(typed_data_bytes, sizeof(typed_data_bytes));
+  TEST_ASSERT_TRUE(
+      pb_decode(&istream, EVM_SIGN_TYPED_DATA_STRUCT_FIELDS, &typed_data));
+
+  perf_gate("eip712_hash_struct",
+            kernel_eip712_hash_struct,
+            PERF_BASELINE_EIP712_HASH_STRUCT);
+}
+
+TEST(perf_gate_test, solana_parse) {
+  // transfers from account 0 to account 1, as built by the solana txn helper
+  // tests
+  uint16_t offset = 0;
+  solana_txn[offset++] = 1;
+  solana_txn[offset++] = 0;
+  solana_txn[offset++] = 1;
+  solana_txn[offset++] = 3;
+  memset(solana_txn + offset, 0x11, SOLANA_ACCOUNT_ADDRESS_LENGTH);
+  offset += SOLANA_ACCOUNT_ADDRESS_LENGTH;
+  memset(solana_txn + offset, 0x22, SOLANA_ACCOUNT_ADDRESS_LENGTH);
+  offset += SOLANA_ACCOUNT_ADDRESS_LENGTH;
+  memset(solana_txn + offset, 0x00, SOLANA_ACCOUNT_ADDRESS_LENGTH);
+  offset += SOLANA_ACCOUNT_ADDRESS_LENGTH;
+  memset(solana_txn + offset, 0xbb, SOLANA_BLOCKHASH_LENGTH);
+  offset += SOLANA_BLOCKHASH_LENGTH;
+  solana_txn[offset++] = PERF_SOLANA_TRANSFERS;
+  for (uint8_t i = 0; i < PERF_SOLANA_TRANSFERS; i++) {
+    const uint8_t instruction[] = {
+        2, 2, 0, 1, 12, SSI_TRANSFER, 0, 0, 0, i + 1, 0, 0, 0, 0, 0, 0, 0};
+    memcpy(solana_txn + offset, instruction, sizeof(instruction));
+    offset += sizeof(instruction);
+  }
+  solana_txn_size = offset;
+
+  perf_gate("solana_parse", kernel_solana_parse, PERF_BASELINE_SOLANA_PARSE);
+}
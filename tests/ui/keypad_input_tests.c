@@ -0,0 +1,128 @@
+/**
+ * @file    keypad_input_tests.c
+ * @author  Cypherock X1 Team
+ * @brief   Unit tests for the interrupt driven joystick input
+ * @copyright Copyright (c) 2023 HODL TECH PTE LTD
+ * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
+ *target=_blank>https://mitcc.org/</a>
+ ******************************************************************************
+ * @attention
+ *
+ * (c) Copyright 2023 by HODL TECH PTE LTD
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * "Commons Clause" License Condition v1.0
+ *
+ * The Software is provided to you by the Licensor under the License,
+ * as defined below, subject to the following condition.
+ *
+ * Without limiting other conditions in the License, the grant of
+ * rights under the License will not include, and the License does not
+ * grant to you, the right to Sell the Software.
+ *
+ * For purposes of the foregoing, "Sell" means practicing any or all
+ * of the rights granted to you under the License to provide to third
+ * parties, for a fee or other consideration (including without
+ * limitation fees for hosting or consulting/ support services related
+ * to the Software), a product or service whose value derives, entirely
+ * or substantially, from the functionality of the Software. Any license
+ * notice or attribution required by the License must also include
+ * this Commons Clause License Condition notice.
+ *
+ * Software: All X1Wallet associated files.
+ * License: MIT
+ * Licensor: HODL TECH PTE LTD
+ *
+ ******************************************************************************
+ */
+
+#include "keypad_input.h"
+#include "unity_fixture.h"
+
+static uint32_t lines = 0;
+static uint8_t timer_starts = 0;
+
+static uint32_t fake_read_lines(void) {
+  return lines;
+}
+
+static void fake_timer_start(uint32_t ms) {
+  TEST_ASSERT_EQUAL(KEYPAD_DEBOUNCE_MS, ms);
+  timer_starts++;
+}
+
+static lv_indev_drv_t indev_drv;
+
+TEST_GROUP(keypad_input_test);
+
+TEST_SETUP(keypad_input_test) {
+  lines = 0;
+  timer_starts = 0;
+  lv_indev_drv_init(&indev_drv);
+  keypad_input_init(&indev_drv, fake_read_lines, fake_timer_start);
+}
+
+TEST_TEAR_DOWN(keypad_input_test) {
+  return;
+}
+
+TEST(keypad_input_test, bounces_settle_to_one_press) {
+  lv_indev_data_t data = {0};
+
+  // the contact bounces; every edge pushes the sample back
+  lines = 5;
+  keypad_input_edge_isr();
+  lines = 0;
+  keypad_input_edge_isr();
+  lines = 5;
+  keypad_input_edge_isr();
+  TEST_ASSERT_EQUAL(3, timer_starts);
+  TEST_ASSERT_EQUAL(0, keypad_input_get_key());
+
+  keypad_input_timer_isr();
+  TEST_ASSERT_EQUAL(5, keypad_input_get_key());
+  TEST_ASSERT_FALSE(indev_drv.read_cb(&indev_drv, &data));
+  TEST_ASSERT_EQUAL(LV_KEY_ENTER, data.key);
+  TEST_ASSERT_EQUAL(LV_INDEV_STATE_PR, data.state);
+
+  // no change on the lines; the key stays pressed
+  keypad_input_timer_isr();
+  TEST_ASSERT_FALSE(indev_drv.read_cb(&indev_drv, &data));
+  TEST_ASSERT_EQUAL(LV_INDEV_STATE_PR, data.state);
+}
+
+TEST(keypad_input_test, short_press_is_not_lost) {
+  lv_indev_data_t data = {0};
+
+  // press & release settle before LVGL gets to read the keypad
+  lines = 4;
+  keypad_input_timer_isr();
+  lines = 0;
+  keypad_input_timer_isr();
+
+  TEST_ASSERT_TRUE(indev_drv.read_cb(&indev_drv, &data));
+  TEST_ASSERT_EQUAL(LV_KEY_RIGHT, data.key);
+  TEST_ASSERT_EQUAL(LV_INDEV_STATE_PR, data.state);
+  TEST_ASSERT_FALSE(indev_drv.read_cb(&indev_drv, &data));
+  TEST_ASSERT_EQUAL(LV_KEY_RIGHT, data.key);
+  TEST_ASSERT_EQUAL(LV_INDEV_STATE_REL, data.state);
+}
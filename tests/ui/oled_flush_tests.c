@@ -0,0 +1,149 @@
+/**
+ * @file    oled_flush_tests.c
+ * @author  Cypherock X1 Team
+ * @brief   Unit tests for the OLED flush path
+ * @copyright Copyright (c) 2023 HODL TECH PTE LTD
+ * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
+ *target=_blank>https://mitcc.org/</a>
+ ******************************************************************************
+ * @attention
+ *
+ * (c) Copyright 2023 by HODL TECH PTE LTD
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * "Commons Clause" License Condition v1.0
+ *
+ * The Software is provided to you by the Licensor under the License,
+ * as defined below, subject to the following condition.
+ *
+ * Without limiting other conditions in the License, the grant of
+ * rights under the License will not include, and the License does not
+ * grant to you, the right to Sell the Software.
+ *
+ * For purposes of the foregoing, "Sell" means practicing any or all
+ * of the rights granted to you under the License to provide to third
+ * parties, for a fee or other consideration (including without
+ * limitation fees for hosting or consulting/ support services related
+ * to the Software), a product or service whose value derives, entirely
+ * or substantially, from the functionality of the Software. Any license
+ * notice or attribution required by the License must also include
+ * this Commons Clause License Condition notice.
+ *
+ * Software: All X1Wallet associated files.
+ * License: MIT
+ * Licensor: HODL TECH PTE LTD
+ *
+ ******************************************************************************
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "oled_flush.h"
+#include "unity_fixture.h"
+
+static lv_color_t pixels[LV_HOR_RES_MAX * LV_VER_RES_MAX];
+static uint8_t pages[OLED_FRAME_SIZE];
+
+static oled_window_t sent_window;
+static uint16_t sent_len = 0;
+static uint8_t sent_count = 0;
+
+static void fake_write_async(const oled_window_t *window,
+                             const uint8_t *data,
+                             uint16_t len) {
+  (void)data;
+  sent_window = *window;
+  sent_len = len;
+  sent_count++;
+}
+
+TEST_GROUP(oled_flush_test);
+
+TEST_SETUP(oled_flush_test) {
+  srand(1);
+  for (uint16_t i = 0; i < sizeof(pixels) / sizeof(pixels[0]); i++) {
+    pixels[i].full = rand() & 1;
+  }
+  sent_count = 0;
+}
+
+TEST_TEAR_DOWN(oled_flush_test) {
+  return;
+}
+
+TEST(oled_flush_test, pack_matches_reference) {
+  const lv_area_t areas[] = {
+      {0, 0, LV_HOR_RES_MAX - 1, LV_VER_RES_MAX - 1},
+      {5, 8, 5, 15},
+      {3, 16, 20, 39},
+      {120, 56, 127, 63},
+  };
+
+  for (uint8_t i = 0; i < sizeof(areas) / sizeof(areas[0]); i++) {
+    const lv_area_t *area = &areas[i];
+    const lv_coord_t width = lv_area_get_width(area);
+    const lv_coord_t height = lv_area_get_height(area);
+    oled_pack_pages(area, pixels, pages);
+
+    for (lv_coord_t page = 0; page < height / OLED_PAGE_HEIGHT; page++) {
+      for (lv_coord_t x = 0; x < width; x++) {
+        uint8_t expected = 0;
+        for (uint8_t row = 0; row < OLED_PAGE_HEIGHT; row++) {
+          expected |= pixels[(page * OLED_PAGE_HEIGHT + row) * width + x].full
+                      << row;
+        }
+        TEST_ASSERT_EQUAL_HEX8(expected, pages[page * width + x]);
+      }
+    }
+  }
+}
+
+TEST(oled_flush_test, flush_sends_dirty_pages) {
+  static lv_disp_buf_t disp_buf;
+  lv_disp_drv_t disp_drv;
+  lv_disp_drv_init(&disp_drv);
+  lv_disp_buf_init(
+      &disp_buf, pixels, NULL, sizeof(pixels) / sizeof(pixels[0]));
+  disp_drv.buffer = &disp_buf;
+  oled_flush_init(&disp_drv, fake_write_async);
+
+  lv_area_t area = {.x1 = 10, .y1 = 13, .x2 = 29, .y2 = 17};
+  disp_drv.rounder_cb(&disp_drv, &area);
+  TEST_ASSERT_EQUAL(8, area.y1);
+  TEST_ASSERT_EQUAL(23, area.y2);
+
+  disp_drv.flush_cb(&disp_drv, &area, pixels);
+  TEST_ASSERT_EQUAL(1, sent_count);
+  TEST_ASSERT_EQUAL(10, sent_window.col_start);
+  TEST_ASSERT_EQUAL(29, sent_window.col_end);
+  TEST_ASSERT_EQUAL(1, sent_window.page_start);
+  TEST_ASSERT_EQUAL(2, sent_window.page_end);
+  TEST_ASSERT_EQUAL(40, sent_len);
+
+  // second area waits in the other buffer for the first transfer
+  disp_drv.flush_cb(&disp_drv, &area, pixels);
+  TEST_ASSERT_EQUAL(1, sent_count);
+  oled_flush_transfer_done();
+  TEST_ASSERT_EQUAL(2, sent_count);
+  oled_flush_transfer_done();
+}
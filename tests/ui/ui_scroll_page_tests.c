@@ -73,7 +73,7 @@ void Ui_HorScrUnitTests(void) {
       MENU_SCROLL_HORIZONTAL,
       true);
   while (1) {
-    lv_task_handler();
+    ui_task_handler();
   }
 }
 
@@ -0,0 +1,112 @@
+/**
+ * @file    oled_flush_tests.c
+ * @author  Cypherock X1 Team
+ * @brief   Unit tests for the text pagination of the scroll page
+ * @copyright Copyright (c) 2023 HODL TECH PTE LTD
+ * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
+ *target=_blank>https://mitcc.org/</a>
+ ******************************************************************************
+ * @attention
+ *
+ * (c) Copyright 2023 by HODL TECH PTE LTD
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * "Commons Clause" License Condition v1.0
+ *
+ * The Software is provided to you by the Licensor under the License,
+ * as defined below, subject to the following condition.
+ *
+ * Without limiting other conditions in the License, the grant of
+ * rights under the License will not include, and the License does not
+ * grant to you, the right to Sell the Software.
+ *
+ * For purposes of the foregoing, "Sell" means practicing any or all
+ * of the rights granted to you under the License to provide to third
+ * parties, for a fee or other consideration (including without
+ * limitation fees for hosting or consulting/ support services related
+ * to the Software), a product or service whose value derives, entirely
+ * or substantially, from the functionality of the Software. Any license
+ * notice or attribution required by the License must also include
+ * this Commons Clause License Condition notice.
+ *
+ * Software: All X1Wallet associated files.
+ * License: MIT
+ * Licensor: HODL TECH PTE LTD
+ *
+ ******************************************************************************
+ */
+
+#include <string.h>
+
+#include "ui_text_pages.h"
+#include "unity_fixture.h"
+
+static ui_text_pages_t pages;
+static char page_text[UI_TEXT_PAGE_MAX_SIZE];
+static lv_style_t style;
+
+TEST_GROUP(ui_text_pages_test);
+
+TEST_SETUP(ui_text_pages_test) {
+  lv_style_copy(&style, &lv_style_plain);
+  style.text.font = &lv_font_roboto_12;
+  style.text.line_space = 2;
+}
+
+TEST_TEAR_DOWN(ui_text_pages_test) {
+  return;
+}
+
+TEST(ui_text_pages_test, pages_cover_text) {
+  const char text[] =
+      "Verify the receive address on the device and on the desktop app before "
+      "sharing it with anyone.\nThe address below belongs to the first account "
+      "of the wallet and is derived from the seed stored on the cards.";
+  const lv_coord_t height = 2 * lv_font_get_line_height(style.text.font) + 2;
+
+  TEST_ASSERT_TRUE(ui_text_pages_layout(&pages, text, &style, 100, height));
+  TEST_ASSERT_TRUE(1 < pages.page_count);
+  TEST_ASSERT_EQUAL(0, pages.page_start[0]);
+  TEST_ASSERT_EQUAL(strlen(text), pages.page_start[pages.page_count]);
+
+  for (uint16_t page = 0; page < pages.page_count; page++) {
+    TEST_ASSERT_TRUE(pages.page_start[page] < pages.page_start[page + 1]);
+
+    ui_text_pages_get(&pages, page, page_text);
+    lv_point_t size;
+    lv_txt_get_size(&size,
+                    page_text,
+                    style.text.font,
+                    style.text.letter_space,
+                    style.text.line_space,
+                    100,
+                    LV_TXT_FLAG_NONE);
+    TEST_ASSERT_TRUE(size.y <= height);
+  }
+}
+
+TEST(ui_text_pages_test, empty_text_has_one_page) {
+  TEST_ASSERT_TRUE(ui_text_pages_layout(&pages, "", &style, 100, 40));
+  TEST_ASSERT_EQUAL(1, pages.page_count);
+  ui_text_pages_get(&pages, 0, page_text);
+  TEST_ASSERT_EQUAL_STRING("", page_text);
+}
@@ -67,6 +67,7 @@ TEST_GROUP_RUNNER(event_getter_test) {
   RUN_TEST_CASE(event_getter_test, listening_all_events);
   RUN_TEST_CASE(event_getter_test, listening_all_available_one);
   RUN_TEST_CASE(event_getter_test, disabled_events);
+  RUN_TEST_CASE(event_getter_test, work_event);
 }
 
 TEST_GROUP_RUNNER(xpub) {
@@ -85,9 +86,56 @@ TEST_GROUP_RUNNER(usb_evt_api_test) {
   RUN_TEST_CASE(usb_evt_api_test, consume_and_free)
   RUN_TEST_CASE(usb_evt_api_test, consume_and_respond)
   RUN_TEST_CASE(usb_evt_api_test, stitch_data_chunks)
+  RUN_TEST_CASE(usb_evt_api_test, stitch_data_chunks_aborted)
   RUN_TEST_CASE(usb_evt_api_test, send_data_chunks)
 }
 
+TEST_GROUP_RUNNER(usb_crc_test) {
+  RUN_TEST_CASE(usb_crc_test, known_vector);
+  RUN_TEST_CASE(usb_crc_test, update_matches_reference);
+  RUN_TEST_CASE(usb_crc_test, buffer_matches_reference);
+}
+
+#if USE_SIMULATOR == 1
+TEST_GROUP_RUNNER(flash_journal_test) {
+  RUN_TEST_CASE(flash_journal_test, load_picks_newer_generation);
+  RUN_TEST_CASE(flash_journal_test, compaction_interrupted_before_erase);
+  RUN_TEST_CASE(flash_journal_test, torn_save_is_dropped);
+  RUN_TEST_CASE(flash_journal_test, legacy_unsealed_image);
+  RUN_TEST_CASE(flash_journal_test, save_range_reload);
+}
+#endif
+
+TEST_GROUP_RUNNER(oled_flush_test) {
+  RUN_TEST_CASE(oled_flush_test, pack_matches_reference);
+  RUN_TEST_CASE(oled_flush_test, flush_sends_dirty_pages);
+}
+
+TEST_GROUP_RUNNER(ui_text_pages_test) {
+  RUN_TEST_CASE(ui_text_pages_test, pages_cover_text);
+  RUN_TEST_CASE(ui_text_pages_test, empty_text_has_one_page);
+}
+
+TEST_GROUP_RUNNER(keypad_input_test) {
+  RUN_TEST_CASE(keypad_input_test, bounces_settle_to_one_press);
+  RUN_TEST_CASE(keypad_input_test, short_press_is_not_lost);
+}
+
+TEST_GROUP_RUNNER(address_encoding_test) {
+  RUN_TEST_CASE(address_encoding_test, base58_known_vector);
+  RUN_TEST_CASE(address_encoding_test, base58_matches_reference);
+  RUN_TEST_CASE(address_encoding_test, bech32_polymod_matches_reference);
+  RUN_TEST_CASE(address_encoding_test, segwit_known_vector);
+  RUN_TEST_CASE(address_encoding_test, benchmark);
+}
+
+TEST_GROUP_RUNNER(sha3_test) {
+  RUN_TEST_CASE(sha3_test, keccak_256_known_answers);
+  RUN_TEST_CASE(sha3_test, sha3_256_known_answers);
+  RUN_TEST_CASE(sha3_test, sha3_512_known_answer);
+  RUN_TEST_CASE(sha3_test, incremental_matches_one_shot);
+}
+
 TEST_GROUP_RUNNER(ui_events_test) {
   RUN_TEST_CASE(ui_events_test, set_confirm);
   RUN_TEST_CASE(ui_events_test, set_cancel);
@@ -122,6 +170,25 @@ TEST_GROUP_RUNNER(array_lists_tests) {
 }
 TEST_GROUP_RUNNER(flow_engine_tests) {
   RUN_TEST_CASE(flow_engine_tests, engine_use_case_test);
+  RUN_TEST_CASE(flow_engine_tests, engine_work_test);
+}
+
+TEST_GROUP_RUNNER(app_registry_test) {
+  RUN_TEST_CASE(app_registry_test, init_runs_once_on_first_lookup);
+  RUN_TEST_CASE(app_registry_test, app_without_init);
+  RUN_TEST_CASE(app_registry_test, unknown_app_id);
+  RUN_TEST_CASE(app_registry_test, dispatch_counts_invocations);
+}
+
+TEST_GROUP_RUNNER(task_scheduler_test) {
+  RUN_TEST_CASE(task_scheduler_test, priority_order_until_idle);
+  RUN_TEST_CASE(task_scheduler_test, preempt_returns_with_pending_work);
+  RUN_TEST_CASE(task_scheduler_test, task_removes_itself);
+}
+
+TEST_GROUP_RUNNER(flow_trace_test) {
+  RUN_TEST_CASE(flow_trace_test, records_transitions_of_the_flow);
+  RUN_TEST_CASE(flow_trace_test, counts_dropped_transitions);
 }
 
 TEST_GROUP_RUNNER(manager_api_test) {
@@ -138,6 +205,8 @@ TEST_GROUP_RUNNER(btc_txn_helper_test) {
   RUN_TEST_CASE(btc_txn_helper_test, btc_txn_helper_verify_input_p2pkh_fail);
   RUN_TEST_CASE(btc_txn_helper_test, btc_txn_helper_verify_input_p2wpkh);
   RUN_TEST_CASE(btc_txn_helper_test, btc_txn_helper_verify_input_p2wpkh_fail);
+  RUN_TEST_CASE(btc_txn_helper_test,
+                btc_txn_helper_verify_input_record_values);
 
   RUN_TEST_CASE(btc_txn_helper_test, btc_txn_helper_transaction_weight_legacy1);
   RUN_TEST_CASE(btc_txn_helper_test, btc_txn_helper_transaction_weight_legacy2);
@@ -158,6 +227,7 @@ TEST_GROUP_RUNNER(btc_txn_helper_test) {
 
   RUN_TEST_CASE(btc_txn_helper_test, btc_txn_helper_get_fee);
   RUN_TEST_CASE(btc_txn_helper_test, btc_txn_helper_get_fee_overspend);
+  RUN_TEST_CASE(btc_txn_helper_test, btc_txn_helper_get_fee_overflow);
 }
 
 TEST_GROUP_RUNNER(btc_helper_test) {
@@ -173,6 +243,16 @@ TEST_GROUP_RUNNER(btc_script_test) {
   RUN_TEST_CASE(btc_script_test, btc_script_ltc_nsegwit_address);
   RUN_TEST_CASE(btc_script_test, btc_script_ltc_legacy_address);
   RUN_TEST_CASE(btc_script_test, btc_script_ltc_p2sh_address1);
+  RUN_TEST_CASE(btc_script_test, btc_script_doge_segwit_has_no_address);
+}
+
+TEST_GROUP_RUNNER(btc_psbt_test) {
+  RUN_TEST_CASE(btc_psbt_test, btc_psbt_read_in_chunks);
+  RUN_TEST_CASE(btc_psbt_test, btc_psbt_read_malformed);
+  RUN_TEST_CASE(btc_psbt_test, btc_psbt_read_tampered_utxo);
+  RUN_TEST_CASE(btc_psbt_test, btc_psbt_read_witness_utxo_only);
+  RUN_TEST_CASE(btc_psbt_test, btc_psbt_read_witness_utxo_mismatch);
+  RUN_TEST_CASE(btc_psbt_test, btc_psbt_write_partial_sig);
 }
 
 TEST_GROUP_RUNNER(evm_txn_test) {
@@ -181,10 +261,17 @@ TEST_GROUP_RUNNER(evm_txn_test) {
   RUN_TEST_CASE(evm_txn_test, evm_txn_haka_transfer);
   RUN_TEST_CASE(evm_txn_test, evm_txn_blind_signing);
   RUN_TEST_CASE(evm_txn_test, evm_txn_token_deposit);
+  RUN_TEST_CASE(evm_txn_test, evm_txn_whitelist_lookup);
+  RUN_TEST_CASE(evm_txn_test, evm_txn_selector_lookup);
+  RUN_TEST_CASE(evm_txn_test, evm_txn_stream_chunked);
+  RUN_TEST_CASE(evm_txn_test, evm_txn_eip1559_envelope);
+  RUN_TEST_CASE(evm_txn_test, evm_txn_checksum_address_cache);
 }
 
 TEST_GROUP_RUNNER(evm_sign_msg_test) {
   RUN_TEST_CASE(evm_sign_msg_test, evm_sign_msg_test_empty_typed_data_hash);
+  RUN_TEST_CASE(evm_sign_msg_test,
+                evm_sign_msg_test_empty_typed_data_stream_hash);
   RUN_TEST_CASE(evm_sign_msg_test,
                 evm_sign_msg_test_domain_only_typed_data_hash);
   RUN_TEST_CASE(evm_sign_msg_test, evm_sign_msg_test_typed_data_hash);
@@ -198,6 +285,7 @@ TEST_GROUP_RUNNER(near_helper_test) {
                 near_helper_send_decoder_transfer_action_to_explicit_account);
   RUN_TEST_CASE(near_helper_test,
                 near_helper_send_decoder_function_call_explicit_account);
+  RUN_TEST_CASE(near_helper_test, near_helper_send_decoder_multiple_actions);
   RUN_TEST_CASE(near_helper_test, near_helper_sign_txn);
 }
 
@@ -215,6 +303,18 @@ TEST_GROUP_RUNNER(solana_add_account_test) {
   RUN_TEST_CASE(solana_add_account_test, solana_get_addr_action);
 }
 
+TEST_GROUP_RUNNER(solana_txn_helper_test) {
+  RUN_TEST_CASE(solana_txn_helper_test, solana_txn_batch_transfer);
+  RUN_TEST_CASE(solana_txn_helper_test, solana_txn_instruction_limit);
+}
+
+TEST_GROUP_RUNNER(perf_gate_test) {
+  RUN_TEST_CASE(perf_gate_test, btc_p2pkh_digest);
+  RUN_TEST_CASE(perf_gate_test, evm_rlp_decode);
+  RUN_TEST_CASE(perf_gate_test, eip712_hash_struct);
+  RUN_TEST_CASE(perf_gate_test, solana_parse);
+}
+
 TEST_GROUP_RUNNER(utils_tests) {
   RUN_TEST_CASE(utils_tests, der_to_sig_1);
   RUN_TEST_CASE(utils_tests, der_to_sig_2);
@@ -224,4 +324,11 @@ TEST_GROUP_RUNNER(utils_tests) {
   RUN_TEST_CASE(utils_tests, escape_string_invalid_non_print_utf);
   RUN_TEST_CASE(utils_tests, escape_string_short_out_buff);
   RUN_TEST_CASE(utils_tests, escape_string_invalid_args);
+  RUN_TEST_CASE(utils_tests, arena_alloc_zeroed_and_aligned);
+  RUN_TEST_CASE(utils_tests, arena_reset_to_mark_zeroizes);
+  RUN_TEST_CASE(utils_tests, arena_falls_back_to_heap);
+  RUN_TEST_CASE(utils_tests, arena_pb_realloc_grows_top_block_in_place);
+  RUN_TEST_CASE(utils_tests, arena_pb_realloc_moves_covered_block);
+  RUN_TEST_CASE(utils_tests, decimal_string_formats_amounts);
+  RUN_TEST_CASE(utils_tests, decimal_string_short_out_buff);
 }
\ No newline at end of file
@@ -84,25 +84,40 @@ void RunAllTests(void) {
   RUN_TEST_GROUP(p0_events_test);
   RUN_TEST_GROUP(ui_events_test);
   RUN_TEST_GROUP(usb_evt_api_test);
+  RUN_TEST_GROUP(usb_crc_test);
+#if USE_SIMULATOR == 1
+  RUN_TEST_GROUP(flash_journal_test);
+#endif
+  RUN_TEST_GROUP(oled_flush_test);
+  RUN_TEST_GROUP(ui_text_pages_test);
+  RUN_TEST_GROUP(keypad_input_test);
   RUN_TEST_GROUP(nfc_events_test);
 #ifdef NFC_EVENT_CARD_DETECT_MANUAL_TEST
   RUN_TEST_GROUP(nfc_events_manual_test);
 #endif
   RUN_TEST_GROUP(xpub);
+  RUN_TEST_GROUP(address_encoding_test);
+  RUN_TEST_GROUP(sha3_test);
   RUN_TEST_GROUP(array_lists_tests);
   RUN_TEST_GROUP(flow_engine_tests);
+  RUN_TEST_GROUP(task_scheduler_test);
+  RUN_TEST_GROUP(app_registry_test);
+  RUN_TEST_GROUP(flow_trace_test);
   RUN_TEST_GROUP(manager_api_test);
   RUN_TEST_GROUP(btc_txn_helper_test);
   RUN_TEST_GROUP(btc_helper_test);
   RUN_TEST_GROUP(btc_script_test);
+  RUN_TEST_GROUP(btc_psbt_test);
   RUN_TEST_GROUP(evm_txn_test);
   RUN_TEST_GROUP(evm_sign_msg_test);
   RUN_TEST_GROUP(near_helper_test);
   RUN_TEST_GROUP(solana_add_account_test);
+  RUN_TEST_GROUP(solana_txn_helper_test);
 #ifdef NEAR_FLOW_MANUAL_TEST
   RUN_TEST_GROUP(near_txn_user_verification_test);
 #endif
   RUN_TEST_GROUP(utils_tests);
+  RUN_TEST_GROUP(perf_gate_test);
 }
 
 /**
@@ -160,7 +160,56 @@ TEST(usb_evt_api_test, consume_and_respond) {
  * and usb-event module should support such expectations.
  */
 TEST(usb_evt_api_test, stitch_data_chunks) {
-  LOG_SWV("usb evt stitch_data_chunks\n");
+  comm_status_t *comm_status = get_comm_status();
+  const uint8_t *segment = NULL;
+  uint16_t size = 0;
+
+  // a command fitting in the buffer has nothing left to pull
+  TEST_ASSERT_EQUAL_UINT32(0, usb_stream_get_remaining());
+  TEST_ASSERT_EQUAL(USB_STREAM_END, usb_stream_pull(&segment, &size));
+
+  // the usb event carries the first segment of a streamed command
+  comm_status->stream_active = true;
+  comm_status->stream_total_length = 3 * COMM_BUFFER_SIZE;
+  comm_status->stream_received_length = COMM_BUFFER_SIZE;
+  comm_status->stream_segment_length = COMM_BUFFER_SIZE;
+  comm_status->stream_segment_state = COMM_STREAM_SEGMENT_HELD;
+  TEST_ASSERT_EQUAL_UINT32(2 * COMM_BUFFER_SIZE, usb_stream_get_remaining());
+
+  // pulling releases the held segment to the host
+  TEST_ASSERT_EQUAL(USB_STREAM_PENDING, usb_stream_pull(&segment, &size));
+  TEST_ASSERT_EQUAL(COMM_STREAM_SEGMENT_FILLING,
+                    comm_status->stream_segment_state);
+  TEST_ASSERT_EQUAL(USB_STREAM_PENDING, usb_stream_pull(&segment, &size));
+
+  // the host uploads the rest of the command as the last segment
+  comm_status->stream_received_length = comm_status->stream_total_length;
+  comm_status->stream_segment_length = 100;
+  comm_status->stream_segment_state = COMM_STREAM_SEGMENT_READY;
+  TEST_ASSERT_EQUAL(USB_STREAM_SEGMENT, usb_stream_pull(&segment, &size));
+  TEST_ASSERT_EQUAL_PTR(get_io_buffer(), segment);
+  TEST_ASSERT_EQUAL_UINT16(100, size);
+  TEST_ASSERT_EQUAL_UINT32(0, usb_stream_get_remaining());
+
+  TEST_ASSERT_EQUAL(USB_STREAM_END, usb_stream_pull(&segment, &size));
+  TEST_ASSERT_FALSE(comm_status->stream_active);
+}
+
+/**
+ * @brief Test behaviour of a streamed command whose upload failed.
+ * @details The app pulling the segments is told that the message is unusable
+ * rather than waiting for more segments.
+ */
+TEST(usb_evt_api_test, stitch_data_chunks_aborted) {
+  comm_status_t *comm_status = get_comm_status();
+  const uint8_t *segment = NULL;
+  uint16_t size = 0;
+
+  comm_status->stream_active = true;
+  comm_status->stream_segment_state = COMM_STREAM_SEGMENT_ABORTED;
+  TEST_ASSERT_EQUAL(USB_STREAM_ERROR, usb_stream_pull(&segment, &size));
+  usb_reset_state();
+  TEST_ASSERT_EQUAL(USB_STREAM_END, usb_stream_pull(&segment, &size));
 }
 
 /**
@@ -0,0 +1,123 @@
+/**
+ * @file    usb_crc_tests.c
+ * @author  Cypherock X1 Team
+ * @brief   Unit tests for CRC-16 engine of usb-comm module
+ * @copyright Copyright (c) 2023 HODL TECH PTE LTD
+ * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
+ *target=_blank>https://mitcc.org/</a>
+ ******************************************************************************
+ * @attention
+ *
+ * (c) Copyright 2023 by HODL TECH PTE LTD
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject
+ * to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * "Commons Clause" License Condition v1.0
+ *
+ * The Software is provided to you by the Licensor under the License,
+ * as defined below, subject to the following condition.
+ *
+ * Without limiting other conditions in the License, the grant of
+ * rights under the License will not include, and the License does not
+ * grant to you, the right to Sell the Software.
+ *
+ * For purposes of the foregoing, "Sell" means practicing any or all
+ * of the rights granted to you under the License to provide to third
+ * parties, for a fee or other consideration (including without
+ * limitation fees for hosting or consulting/ support services related
+ * to the Software), a product or service whose value derives, entirely
+ * or substantially, from the functionality of the Software. Any license
+ * notice or attribution required by the License must also include
+ * this Commons Clause License Condition notice.
+ *
+ * Software: All X1Wallet associated files.
+ * License: MIT
+ * Licensor: HODL TECH PTE LTD
+ *
+ ******************************************************************************
+ */
+
+#include "unity_fixture.h"
+#include "usb_api.h"
+#include "usb_api_priv.h"
+
+static uint8_t buffer[COMM_PKT_MAX_LEN] = {0};
+
+/**
+ * @brief Bit-wise CRC-16/XMODEM (augmented form) used as reference
+ */
+static uint16_t reference_crc16(uint16_t crc_in, uint8_t byte) {
+  uint32_t crc = crc_in;
+  uint32_t in = byte | 0x100;
+
+  do {
+    crc <<= 1;
+    in <<= 1;
+    if (in & 0x100)
+      ++crc;
+    if (crc & 0x10000)
+      crc ^= 0x1021;
+  } while (!(in & 0x10000));
+
+  return crc & 0xffff;
+}
+
+static uint16_t reference_crc16_buffer(const uint8_t *data, uint16_t length) {
+  uint16_t crc = 0;
+  for (uint16_t i = 0; i < length; i++) {
+    crc = reference_crc16(crc, data[i]);
+  }
+  crc = reference_crc16(crc, 0);
+  return reference_crc16(crc, 0);
+}
+
+TEST_GROUP(usb_crc_test);
+
+TEST_SETUP(usb_crc_test) {
+  for (uint16_t i = 0; i < sizeof(buffer); i++) {
+    buffer[i] = (uint8_t)(i * 37 + 11);
+  }
+}
+
+TEST_TEAR_DOWN(usb_crc_test) {
+  return;
+}
+
+TEST(usb_crc_test, known_vector) {
+  const uint8_t check[] = "123456789";
+  TEST_ASSERT_EQUAL_HEX16(0x31C3, comm_crc16(check, sizeof(check) - 1));
+}
+
+TEST(usb_crc_test, update_matches_reference) {
+  uint16_t crc = 0, expected = 0;
+  for (uint16_t i = 0; i < sizeof(buffer); i++) {
+    crc = update_crc16(crc, buffer[i]);
+    expected = reference_crc16(expected, buffer[i]);
+    TEST_ASSERT_EQUAL_HEX16(expected, crc);
+  }
+}
+
+TEST(usb_crc_test, buffer_matches_reference) {
+  for (uint16_t len = 0; len <= sizeof(buffer); len++) {
+    TEST_ASSERT_EQUAL_HEX16(reference_crc16_buffer(buffer, len),
+                            comm_crc16(buffer, len));
+  }
+}
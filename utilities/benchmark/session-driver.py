@@ -0,0 +1,619 @@
+#!/usr/bin/env python3
+"""Runs scripted signing sessions against the simulator and reports timings.
+
+The simulator must be built with the socket transport and the session
+benchmark build option:
+
+  cmake -DCMAKE_BUILD_PLATFORM=Simulator -DFIRMWARE_TYPE=Main \\
+        -DSIM_USB_TRANSPORT=socket -DSESSION_BENCH_SWITCH=ON ...
+
+That build confirms every screen as soon as it is drawn and signs with the
+seed of SESSION_BENCH_MNEMONIC (common/core/session_bench.h) instead of
+tapping the cards. The wallet signed for must still exist on the simulated
+device; the first wallet reported by the manager app is used unless
+--wallet-id is given. The sessions with 100 and 200 BTC inputs need the High
+capacity profile (-DCAPACITY_PROFILE=High). Adding -DSIM_HEADLESS_SWITCH=ON
+builds the simulator without a window, on virtual time; it then exits when
+the driver disconnects.
+
+The messages are built with the Python protobuf modules generated from
+common/cypherock-common/proto:
+
+  protoc --proto_path=common/cypherock-common/proto --python_out=<dir> \\
+         $(find common/cypherock-common/proto -name "*.proto")
+
+For every session the driver prints one line with the time measured on the
+host, followed by the phase timings the simulator prints when the app flow
+returns (refer session_bench_flow_end()), when the simulator is started by
+the driver:
+
+  host,<session>,<wall_us>,<commands>,<bytes_out>,<bytes_in>
+  session,<app_id>,<total_us>,<transport_us>,<parsing_us>,<derivation_us>,
+          <hashing_us>,<signing_us>,<other_us>
+
+The EIP-712 sessions fill the type hashes with SHA3-256 in place of Keccak-256
+as the standard library has no Keccak; the device does not check them, so the
+timings are the same while the signatures differ from a wallet's.
+"""
+import argparse
+import hashlib
+import importlib
+import os
+import queue
+import socket
+import struct
+import subprocess
+import sys
+import threading
+import time
+
+# Refer usb_api_priv.h
+PKT_TYPE_STATUS_ACK = 4
+PKT_TYPE_CMD = 2
+PKT_TYPE_OUT_REQ = 3
+PKT_TYPE_CMD_ACK = 5
+PKT_TYPE_OUT_RESP = 6
+PKT_TYPE_ERROR = 7
+START_OF_HEADER = 0x55
+HEADER_SIZE = 16
+PACKET_SIZE = 64
+MAX_PAYLOAD_SIZE = PACKET_SIZE - HEADER_SIZE
+
+# Refer the app descriptors of the apps
+APPLET_MANAGER = 1
+APPLET_BTC = 2
+APPLET_ETH = 7
+APPLET_SOLANA = 10
+
+HARDENED = 0x80000000
+# CAPACITY_CHUNK_SIZE of the Standard profile
+CHUNK_SIZE = 2048
+RESPONSE_TIMEOUT_S = 60
+
+
+def crc16(data):
+    """CRC-16/XMODEM, as comm_crc16() of usb_internals.c"""
+    crc = 0
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else crc << 1
+            crc &= 0xFFFF
+    return crc
+
+
+def snake(name):
+    return "".join("_" + c.lower() if c.isupper() else c for c in name)
+
+
+def field(message, name):
+    """Returns the name of the field of the message, which is spelt either in
+    snake case or in camel case by the proto files"""
+    for descriptor in message.DESCRIPTOR.fields:
+        if snake(descriptor.name) == name:
+            return descriptor.name
+    raise KeyError(f"{message.DESCRIPTOR.full_name} has no field {name}")
+
+
+def sub(message, name):
+    """Returns the sub-message, selecting it in its oneof"""
+    child = getattr(message, field(message, name))
+    child.SetInParent()
+    return child
+
+
+def fill(message, **values):
+    for name, value in values.items():
+        attr = field(message, name)
+        if isinstance(value, list):
+            getattr(message, attr).extend(value)
+        else:
+            setattr(message, attr, value)
+    return message
+
+
+def enum_value(message, name, suffix):
+    """Returns the value of the enum field whose name ends with the suffix"""
+    descriptor = message.DESCRIPTOR.fields_by_name[field(message, name)]
+    matches = [
+        value.number for value in descriptor.enum_type.values
+        if value.name == suffix or value.name.endswith("_" + suffix)
+    ]
+    if len(matches) != 1:
+        raise KeyError(f"{descriptor.enum_type.full_name} has no {suffix}")
+    return matches[0]
+
+
+def sha256d(data):
+    return hashlib.sha256(hashlib.sha256(data).digest()).digest()
+
+
+def varint(value):
+    if value < 0xFD:
+        return bytes([value])
+    if value <= 0xFFFF:
+        return b"\xfd" + struct.pack("<H", value)
+    return b"\xfe" + struct.pack("<I", value)
+
+
+def compact_u16(value):
+    out = bytearray()
+    while True:
+        byte = value & 0x7F
+        value >>= 7
+        if value:
+            out.append(byte | 0x80)
+        else:
+            out.append(byte)
+            return bytes(out)
+
+
+def rlp(item):
+    if isinstance(item, int):
+        item = item.to_bytes((item.bit_length() + 7) // 8, "big")
+    if isinstance(item, list):
+        payload = b"".join(rlp(x) for x in item)
+        return rlp_length(len(payload), 0xC0) + payload
+    if len(item) == 1 and item[0] < 0x80:
+        return item
+    return rlp_length(len(item), 0x80) + item
+
+
+def rlp_length(length, offset):
+    if length < 56:
+        return bytes([offset + length])
+    encoded = length.to_bytes((length.bit_length() + 7) // 8, "big")
+    return bytes([offset + 55 + len(encoded)]) + encoded
+
+
+class Protos:
+    """Generated protobuf modules"""
+
+    def __init__(self, path):
+        sys.path.insert(0, path)
+        self.core = importlib.import_module("core_pb2")
+        self.manager = importlib.import_module("manager.core_pb2")
+        self.btc = importlib.import_module("btc.core_pb2")
+        self.evm = importlib.import_module("evm.core_pb2")
+        self.solana = importlib.import_module("solana.core_pb2")
+        sign_msg = importlib.import_module("evm.sign_msg_pb2")
+        self.typed_data = sign_msg.SignTypedDataStruct
+        self.typed_node = sign_msg.SignTypedDataNode
+
+
+class Device:
+    """Speaks the packet protocol of usb_internals.c over the socket
+    transport of the simulator"""
+
+    def __init__(self, path, protos):
+        self.sock = socket.socket(socket.AF_UNIX, socket.SOCK_SEQPACKET)
+        self.sock.connect(path)
+        self.sock.settimeout(RESPONSE_TIMEOUT_S)
+        self.protos = protos
+        self.sequence = 0
+        self.commands = 0
+        self.bytes_out = 0
+        self.bytes_in = 0
+
+    def close(self):
+        self.sock.close()
+
+    def send_packet(self, chunk, total, packet_type, payload):
+        packet = bytearray(HEADER_SIZE) + payload
+        packet[0] = packet[1] = START_OF_HEADER
+        struct.pack_into(">HHHB", packet, 4, chunk, total, self.sequence,
+                         packet_type)
+        struct.pack_into(">I", packet, 11, int(time.monotonic() * 1000)
+                         & 0xFFFFFFFF)
+        packet[15] = len(payload)
+        struct.pack_into(">H", packet, 2, crc16(packet[4:]))
+        self.sock.send(bytes(packet))
+
+    def recv_packet(self, expected_type):
+        while True:
+            packet = self.sock.recv(PACKET_SIZE)
+            if len(packet) < HEADER_SIZE or packet[0] != START_OF_HEADER:
+                continue
+            length = packet[15]
+            if crc16(packet[4:HEADER_SIZE + length]) != struct.unpack_from(
+                    ">H", packet, 2)[0]:
+                raise IOError("Checksum mismatch in a packet of the device")
+            chunk, total, sequence, packet_type = struct.unpack_from(
+                ">HHHB", packet, 4)
+            payload = packet[HEADER_SIZE:HEADER_SIZE + length]
+            if packet_type == PKT_TYPE_ERROR:
+                raise IOError(f"Device error {payload[4] << 8 | payload[5]}")
+            if packet_type == expected_type or (
+                    expected_type == PKT_TYPE_OUT_RESP
+                    and packet_type == PKT_TYPE_STATUS_ACK):
+                return packet_type, chunk, total, payload
+
+    def command(self, applet_id, query):
+        """Sends the query to the app and returns its raw result"""
+        core = self.protos.core.Msg()
+        sub(core, "cmd").applet_id = applet_id
+        proto = core.SerializeToString()
+        raw = query.SerializeToString()
+        data = struct.pack(">HH", len(proto), len(raw)) + proto + raw
+
+        self.sequence = (self.sequence + 1) % 0xFFFF
+        self.commands += 1
+        self.bytes_out += len(data)
+        chunks = [
+            data[i:i + MAX_PAYLOAD_SIZE]
+            for i in range(0, len(data), MAX_PAYLOAD_SIZE)
+        ]
+        for index, chunk in enumerate(chunks, start=1):
+            self.send_packet(index, len(chunks), PKT_TYPE_CMD, chunk)
+            self.recv_packet(PKT_TYPE_CMD_ACK)
+
+        # the device answers with its status until the output is ready
+        output = bytearray()
+        chunk_no, total = 1, 1
+        while chunk_no <= total:
+            self.send_packet(1, 1, PKT_TYPE_OUT_REQ,
+                             struct.pack(">HHH", 0, 2, chunk_no))
+            packet_type, chunk, total, payload = self.recv_packet(
+                PKT_TYPE_OUT_RESP)
+            if packet_type == PKT_TYPE_STATUS_ACK:
+                time.sleep(0.0005)
+                total = 1
+                continue
+            output += payload
+            chunk_no = chunk + 1
+        self.bytes_in += len(output)
+        proto_len, raw_len = struct.unpack_from(">HH", output)
+        return bytes(output[4 + proto_len:4 + proto_len + raw_len])
+
+    def query(self, applet_id, query, result_type):
+        result = result_type()
+        result.ParseFromString(self.command(applet_id, query))
+        for descriptor, _ in result.ListFields():
+            if descriptor.name.endswith("error"):
+                raise RuntimeError(f"App error: {result}")
+        return result
+
+
+def fetch_wallet_id(device, protos):
+    query = protos.manager.Query()
+    sub(sub(query, "get_wallets"), "initiate")
+    result = device.query(APPLET_MANAGER, query, protos.manager.Result)
+    wallets = sub(sub(result, "get_wallets"), "result")
+    wallets = getattr(wallets, field(wallets, "wallet_list"))
+    if not wallets:
+        raise RuntimeError("The simulator has no wallet, create one first")
+    return bytes(wallets[0].id)
+
+
+def chunked(data, chunk_size):
+    total = max(1, (len(data) + chunk_size - 1) // chunk_size)
+    for index in range(total):
+        chunk = data[index * chunk_size:(index + 1) * chunk_size]
+        remaining = max(0, len(data) - (index + 1) * chunk_size)
+        yield index, total, chunk, remaining
+
+
+def fill_chunk(request, index, total, chunk, remaining):
+    fill(sub(request, "chunk_payload"), chunk=chunk, chunk_index=index,
+         total_chunks=total, remaining_size=remaining)
+
+
+def btc_session(device, protos, wallet_id, inputs, segwit):
+    purpose = 84 if segwit else 44
+    app = protos.btc
+
+    def sign_txn():
+        query = app.Query()
+        return query, sub(query, "sign_txn")
+
+    query, request = sign_txn()
+    fill(sub(request, "initiate"), wallet_id=wallet_id,
+         derivation_path=[purpose | HARDENED, HARDENED, HARDENED])
+    device.query(APPLET_BTC, query, app.Result)
+
+    query, request = sign_txn()
+    fill(sub(request, "meta"), version=2, input_count=inputs, output_count=1,
+         sighash=1, locktime=0)
+    device.query(APPLET_BTC, query, app.Result)
+
+    total = 0
+    for index in range(inputs):
+        key_hash = hashlib.new("ripemd160", bytes([index % 256]) * 33).digest() \
+            if "ripemd160" in hashlib.algorithms_available \
+            else hashlib.sha256(bytes([index % 256]) * 33).digest()[:20]
+        script = (b"\x00\x14" + key_hash if segwit else
+                  b"\x76\xa9\x14" + key_hash + b"\x88\xac")
+        value = 100000 + index
+        prev_txn = (struct.pack("<I", 2) + varint(1) +
+                    hashlib.sha256(struct.pack("<I", index)).digest() +
+                    struct.pack("<I", 0) + varint(0) + b"\xff\xff\xff\xff" +
+                    varint(1) + struct.pack("<Q", value) + varint(len(script))
+                    + script + struct.pack("<I", 0))
+        total += value
+
+        query, request = sign_txn()
+        fill(sub(request, "input"), prev_txn=prev_txn,
+             prev_txn_hash=sha256d(prev_txn), prev_output_index=0,
+             script_pub_key=script, value=value, sequence=0xFFFFFFFF,
+             change_index=0, address_index=index)
+        device.query(APPLET_BTC, query, app.Result)
+
+    query, request = sign_txn()
+    fill(sub(request, "output"), script_pub_key=b"\x00\x14" + bytes(20),
+         value=total - 1000 * inputs, is_change=False)
+    device.query(APPLET_BTC, query, app.Result)
+
+    for index in range(inputs):
+        query, request = sign_txn()
+        signature = sub(request, "signature")
+        if "index" in signature.DESCRIPTOR.fields_by_name:
+            signature.index = index
+        device.query(APPLET_BTC, query, app.Result)
+
+
+def evm_session(device, protos, wallet_id, calldata):
+    app = protos.evm
+    to = bytes.fromhex("d8da6bf26964af9d7eed9e03e53415d37aa96045")
+    txn = rlp([
+        0, 20 * 10**9, 21000 + 16 * len(calldata), to,
+        0 if calldata else 10**17, calldata, 1, b"", b""
+    ])
+
+    query = app.Query()
+    fill(sub(sub(query, "sign_txn"), "initiate"), wallet_id=wallet_id,
+         derivation_path=[44 | HARDENED, 60 | HARDENED, HARDENED, 0, 0],
+         transaction_size=len(txn))
+    device.query(APPLET_ETH, query, app.Result)
+
+    for index, total, chunk, remaining in chunked(txn, CHUNK_SIZE):
+        query = app.Query()
+        fill_chunk(sub(sub(query, "sign_txn"), "txn_data"), index, total,
+                   chunk, remaining)
+        device.query(APPLET_ETH, query, app.Result)
+
+    query = app.Query()
+    sub(sub(query, "sign_txn"), "signature")
+    device.query(APPLET_ETH, query, app.Result)
+
+
+def typed_node(protos, name, type_name, kind, data=b"", children=()):
+    node = protos.typed_node()
+    fill(node, name=name, struct_name=type_name)
+    node_type = enum_value(node, "type", kind)
+    setattr(node, field(node, "type"), node_type)
+    if children:
+        getattr(node, field(node, "children")).extend(children)
+        setattr(node, field(node, "size"), len(children))
+    else:
+        setattr(node, field(node, "size"), len(data))
+        setattr(node, field(node, "data"), data)
+    if kind == "STRUCT":
+        members = ",".join(
+            f"{child.struct_name} {child.name}" for child in children)
+        setattr(node, field(node, "type_hash"),
+                hashlib.sha3_256(f"{type_name}({members})".encode()).digest())
+    return node
+
+
+def uint(protos, name, value, bits=256):
+    return typed_node(protos, name, f"uint{bits}", "UINT",
+                      value.to_bytes(bits // 8, "big"))
+
+
+def address(protos, name, index):
+    return typed_node(protos, name, "address", "ADDRESS",
+                      hashlib.sha256(bytes([index])).digest()[:20])
+
+
+def eip712_domain(protos, name, version, verifier):
+    return typed_node(protos, "domain", "EIP712Domain", "STRUCT", children=[
+        typed_node(protos, "name", "string", "STRING", name.encode()),
+        typed_node(protos, "version", "string", "STRING", version.encode()),
+        uint(protos, "chainId", 1),
+        address(protos, "verifyingContract", verifier),
+    ])
+
+
+def eip712_permit(protos):
+    return eip712_domain(protos, "USD Coin", "2", 1), typed_node(
+        protos, "message", "Permit", "STRUCT", children=[
+            address(protos, "owner", 2),
+            address(protos, "spender", 3),
+            uint(protos, "value", 10**12),
+            uint(protos, "nonce", 0),
+            uint(protos, "deadline", 2**32),
+        ])
+
+
+def eip712_seaport(protos):
+
+    def item(name, type_name, index, recipient):
+        members = [
+            uint(protos, "itemType", 2, 8),
+            address(protos, "token", 10 + index),
+            uint(protos, "identifierOrCriteria", 1000 + index),
+            uint(protos, "startAmount", 1),
+            uint(protos, "endAmount", 1),
+        ]
+        if recipient:
+            members.append(address(protos, "recipient", 20 + index))
+        return typed_node(protos, name, type_name, "STRUCT", children=members)
+
+    offer = [item(str(i), "OfferItem", i, False) for i in range(2)]
+    consideration = [
+        item(str(i), "ConsiderationItem", i, True) for i in range(3)
+    ]
+    return eip712_domain(protos, "Seaport", "1.5", 4), typed_node(
+        protos, "message", "OrderComponents", "STRUCT", children=[
+            address(protos, "offerer", 5),
+            address(protos, "zone", 6),
+            typed_node(protos, "offer", "OfferItem[]", "ARRAY",
+                       children=offer),
+            typed_node(protos, "consideration", "ConsiderationItem[]",
+                       "ARRAY", children=consideration),
+            uint(protos, "orderType", 0, 8),
+            uint(protos, "startTime", 1700000000),
+            uint(protos, "endTime", 1800000000),
+            typed_node(protos, "zoneHash", "bytes32", "BYTES", bytes(32)),
+            uint(protos, "salt", 12345),
+            typed_node(protos, "conduitKey", "bytes32", "BYTES", bytes(32)),
+            uint(protos, "counter", 0),
+        ])
+
+
+def eip712_session(device, protos, wallet_id, builder):
+    app = protos.evm
+    domain, message = builder(protos)
+    typed_data = protos.typed_data()
+    getattr(typed_data, field(typed_data, "domain")).CopyFrom(domain)
+    getattr(typed_data, field(typed_data, "message")).CopyFrom(message)
+    data = typed_data.SerializeToString()
+
+    query = app.Query()
+    initiate = sub(sub(query, "sign_msg"), "initiate")
+    fill(initiate, wallet_id=wallet_id,
+         derivation_path=[44 | HARDENED, 60 | HARDENED, HARDENED, 0, 0],
+         total_msg_size=len(data))
+    setattr(initiate, field(initiate, "message_type"),
+            enum_value(initiate, "message_type", "SIGN_TYPED_DATA"))
+    device.query(APPLET_ETH, query, app.Result)
+
+    for index, total, chunk, remaining in chunked(data, CHUNK_SIZE):
+        query = app.Query()
+        fill_chunk(sub(sub(query, "sign_msg"), "msg_data"), index, total,
+                   chunk, remaining)
+        device.query(APPLET_ETH, query, app.Result)
+
+    query = app.Query()
+    sub(sub(query, "sign_msg"), "signature")
+    device.query(APPLET_ETH, query, app.Result)
+
+
+def solana_session(device, protos, wallet_id, instructions):
+    app = protos.solana
+    recipients = [
+        hashlib.sha256(bytes([index])).digest()
+        for index in range(instructions)
+    ]
+    accounts = [hashlib.sha256(b"payer").digest()] + recipients + [bytes(32)]
+    program = len(accounts) - 1
+    txn = bytes([1, 0, 1]) + compact_u16(len(accounts)) + b"".join(accounts)
+    txn += bytes(32) + compact_u16(instructions)
+    for index in range(instructions):
+        data = struct.pack("<IQ", 2, 1000000 * (index + 1))
+        txn += (bytes([program]) + compact_u16(2) + bytes([0, index + 1]) +
+                compact_u16(len(data)) + data)
+
+    query = app.Query()
+    fill(sub(sub(query, "sign_txn"), "initiate"), wallet_id=wallet_id,
+         derivation_path=[44 | HARDENED, 501 | HARDENED, HARDENED, HARDENED],
+         transaction_size=len(txn))
+    device.query(APPLET_SOLANA, query, app.Result)
+
+    for index, total, chunk, remaining in chunked(txn, CHUNK_SIZE):
+        query = app.Query()
+        fill_chunk(sub(sub(query, "sign_txn"), "txn_data"), index, total,
+                   chunk, remaining)
+        device.query(APPLET_SOLANA, query, app.Result)
+
+    query = app.Query()
+    sub(sub(query, "sign_txn"), "verify")
+    device.query(APPLET_SOLANA, query, app.Result)
+
+    query = app.Query()
+    fill(sub(sub(query, "sign_txn"), "signature"), blockhash=bytes(32))
+    device.query(APPLET_SOLANA, query, app.Result)
+
+
+SESSIONS = {
+    "btc-p2pkh-1": lambda d, p, w: btc_session(d, p, w, 1, False),
+    "btc-p2pkh-10": lambda d, p, w: btc_session(d, p, w, 10, False),
+    "btc-p2pkh-100": lambda d, p, w: btc_session(d, p, w, 100, False),
+    "btc-p2pkh-200": lambda d, p, w: btc_session(d, p, w, 200, False),
+    "btc-p2wpkh-1": lambda d, p, w: btc_session(d, p, w, 1, True),
+    "btc-p2wpkh-10": lambda d, p, w: btc_session(d, p, w, 10, True),
+    "btc-p2wpkh-100": lambda d, p, w: btc_session(d, p, w, 100, True),
+    "btc-p2wpkh-200": lambda d, p, w: btc_session(d, p, w, 200, True),
+    "evm-transfer": lambda d, p, w: evm_session(d, p, w, b""),
+    "evm-calldata-8k": lambda d, p, w: evm_session(
+        d, p, w, bytes.fromhex("12345678") + bytes(range(256)) * 32),
+    "eip712-permit": lambda d, p, w: eip712_session(d, p, w, eip712_permit),
+    "eip712-seaport": lambda d, p, w: eip712_session(d, p, w, eip712_seaport),
+    "solana-8-transfers": lambda d, p, w: solana_session(d, p, w, 8),
+}
+
+
+def read_reports(stream, reports):
+    for line in stream:
+        line = line.strip()
+        if line.startswith("session,") and not line.startswith(
+                "session,app_id"):
+            reports.put(line)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--proto-path", required=True,
+                        help="Directory of the generated *_pb2.py modules")
+    parser.add_argument("--simulator",
+                        help="Simulator to start; its reports are collected")
+    parser.add_argument("--socket", default="/tmp/cypherock_device.sock",
+                        help="Socket of the simulator (SIM_USB_SOCKET_PATH)")
+    parser.add_argument("--wallet-id", help="Hex id of the wallet to sign for")
+    parser.add_argument("--repeat", type=int, default=1,
+                        help="Runs of each session")
+    parser.add_argument("sessions", nargs="*", default=list(SESSIONS),
+                        metavar="session",
+                        help=f"Sessions to run: {', '.join(SESSIONS)}")
+    args = parser.parse_args()
+    for name in args.sessions:
+        if name not in SESSIONS:
+            parser.error(f"unknown session {name}")
+
+    protos = Protos(args.proto_path)
+    simulator = None
+    reports = queue.Queue()
+    if args.simulator:
+        simulator = subprocess.Popen([args.simulator],
+                                     stdout=subprocess.PIPE,
+                                     text=True)
+        threading.Thread(target=read_reports,
+                         args=(simulator.stdout, reports),
+                         daemon=True).start()
+        deadline = time.monotonic() + 10
+        while not os.path.exists(args.socket):
+            if time.monotonic() > deadline:
+                raise RuntimeError(f"{args.socket} did not show up")
+            time.sleep(0.1)
+
+    device = Device(args.socket, protos)
+    try:
+        wallet_id = (bytes.fromhex(args.wallet_id)
+                     if args.wallet_id else fetch_wallet_id(device, protos))
+        if simulator:
+            reports.get(timeout=RESPONSE_TIMEOUT_S)
+        print("host,session,wall_us,commands,bytes_out,bytes_in")
+        print("session,app_id,total_us,transport_us,parsing_us,derivation_us,"
+              "hashing_us,signing_us,other_us")
+        for name in args.sessions:
+            for _ in range(args.repeat):
+                commands, bytes_out, bytes_in = (device.commands,
+                                                 device.bytes_out,
+                                                 device.bytes_in)
+                start = time.monotonic()
+                SESSIONS[name](device, protos, wallet_id)
+                wall_us = int((time.monotonic() - start) * 1e6)
+                print(f"host,{name},{wall_us},{device.commands - commands},"
+                      f"{device.bytes_out - bytes_out},"
+                      f"{device.bytes_in - bytes_in}")
+                if simulator:
+                    print(reports.get(timeout=RESPONSE_TIMEOUT_S))
+                sys.stdout.flush()
+    finally:
+        device.close()
+        if simulator:
+            simulator.terminate()
+
+
+if __name__ == "__main__":
+    main()
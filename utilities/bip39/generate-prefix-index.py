@@ -0,0 +1,101 @@
+#!/usr/bin/env python3
+"""Generates the two letter prefix index of the BIP-39 english wordlist.
+
+The sorted wordlist is read from common/libraries/crypto/bip39_english.h and
+the index of the first word for every two letter prefix is emitted as a C
+table, so that word lookups need not scan the whole wordlist. Refer
+mnemonic_find_prefix() in common/libraries/crypto/bip39.c
+"""
+import argparse
+import os
+import re
+import string
+
+DEFAULT_WORDLIST = os.path.join("common", "libraries", "crypto",
+                                "bip39_english.h")
+DEFAULT_OUTPUT = os.path.join("generated", "bip39", "bip39_prefix_index.c")
+
+# Refer BIP39_WORDS of bip39.h
+WORD_COUNT = 2048
+LETTERS = string.ascii_lowercase
+VALUES_PER_LINE = 12
+
+HEADER = """/**
+ * @file    bip39_prefix_index.c
+ * @author  Cypherock X1 Team
+ * @brief   Two letter prefix index of the BIP-39 english wordlist.
+ *          Generated by utilities/bip39/generate-prefix-index.py from
+ *          {wordlist}; do not edit.
+ * @copyright Copyright (c) 2023 HODL TECH PTE LTD
+ * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
+ * target=_blank>https://mitcc.org/</a>
+ */
+#include "bip39.h"
+"""
+
+
+def load_wordlist(path):
+    with open(path, "r") as wordlist_file:
+        source = wordlist_file.read()
+
+    table = re.search(r"wordlist\[\]\s*=\s*\{(.*?)\};", source, re.S)
+    if table is None:
+        raise ValueError(f"No wordlist found in {path}")
+    words = re.findall(r'"([^"]*)"', table.group(1))
+    if WORD_COUNT != len(words):
+        raise ValueError(f"Expected {WORD_COUNT} words, found {len(words)}")
+    for word in words:
+        if len(word) < 2 or any(letter not in LETTERS for letter in word):
+            raise ValueError(f"Unsupported word '{word}'")
+    if words != sorted(words):
+        raise ValueError("Wordlist is not sorted")
+    return words
+
+
+def build_index(words):
+    # index[26 * a + b] is the first word with a prefix >= (a, b), so that the
+    # words with prefix (a, b) are in [index[26 * a + b], index[26 * a + b + 1])
+    index = []
+    position = 0
+    for first in LETTERS:
+        for second in LETTERS:
+            while position < len(words) and words[position][:2] < first + second:
+                position += 1
+            index.append(position)
+    index.append(len(words))
+    return index
+
+
+def render(index, wordlist):
+    lines = [HEADER.format(wordlist=wordlist.replace(os.sep, "/"))]
+    lines.append("const uint16_t bip39_prefix_index[BIP39_PREFIX_INDEX_SIZE] = {")
+    for start in range(0, len(index), VALUES_PER_LINE):
+        values = index[start:start + VALUES_PER_LINE]
+        lines.append("    " + ", ".join(str(value) for value in values) + ",")
+    lines.append("};")
+    return "\n".join(lines) + "\n"
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--wordlist", default=DEFAULT_WORDLIST,
+                        help=f"Path to the wordlist. Defaults to `{DEFAULT_WORDLIST}`")
+    parser.add_argument("--output", default=DEFAULT_OUTPUT,
+                        help=f"Path to the output. Defaults to `{DEFAULT_OUTPUT}`")
+    args = parser.parse_args()
+
+    index = build_index(load_wordlist(args.wordlist))
+    source = render(index, args.wordlist)
+
+    os.makedirs(os.path.dirname(args.output), exist_ok=True)
+    # keep the timestamp intact when nothing changed to avoid rebuilds
+    if os.path.exists(args.output):
+        with open(args.output, "r") as output:
+            if output.read() == source:
+                return
+    with open(args.output, "w") as output:
+        output.write(source)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,165 @@
+#!/usr/bin/env python3
+"""Generates the capacity profile of the firmware from a few top-level limits.
+
+The profile derives the size of the buffers that bound how large a request the
+device can serve (comm buffer, signing pool, BTC input/output limits & chunk
+size) and writes them to a header. The nanopb options under common/proto-options
+refer the same values as @NAME@ placeholders; they are rendered into the options
+directory used by utilities/proto/generate-protob.sh so that the wire limits and
+the buffers never disagree. The RAM reserved by the
+profile is checked against a fixed budget here and again by the compiler.
+"""
+import argparse
+import os
+import re
+
+DEFAULT_OPTIONS_DIR = os.path.join("common", "proto-options")
+DEFAULT_OUTPUT_DIR = "generated"
+
+# RAM (of the 96K) which the profile buffers may take; the rest is left for the
+# stack, the heap and the other statics
+RAM_BUDGET = 72 * 1024
+
+# Bytes of the signing pool taken by the BTC context (btc_txn_context_t) and by
+# each input (btc_txn_input_t); btc_txn.c asserts that these are not exceeded
+BTC_CONTEXT_BYTES = 2048
+BTC_INPUT_BYTES = 136
+
+# BTC inputs + outputs accepted by every build; a profile may only raise it
+BTC_MIN_UTXO_SUM = 200
+
+PROFILES = {
+    "standard": {
+        "comm_buffer_kb": 6,
+        "comm_buffer_slots": 2,
+        "btc_max_utxo_sum": 200,
+        "ui_heap_kb": 6,
+        "arena_kb": 4,
+    },
+    # treasury use: bigger transactions in exchange for RAM
+    "high": {
+        "comm_buffer_kb": 8,
+        "comm_buffer_slots": 2,
+        "btc_max_utxo_sum": 316,
+        "ui_heap_kb": 6,
+        "arena_kb": 4,
+    },
+}
+
+HEADER = """/**
+ * @file    capacity_config.h
+ * @author  Cypherock X1 Team
+ * @brief   Capacity profile '{profile}' of the firmware.
+ *          Generated by utilities/capacity/generate-capacity.py; do not edit.
+ * @copyright Copyright (c) 2023 HODL TECH PTE LTD
+ * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
+ * target=_blank>https://mitcc.org/</a>
+ */
+#ifndef CAPACITY_CONFIG_H
+#define CAPACITY_CONFIG_H
+"""
+
+FOOTER = """
+_Static_assert(CAPACITY_RAM_USED <= CAPACITY_RAM_BUDGET,
+               "Capacity profile does not fit the RAM budget");
+
+#endif /* CAPACITY_CONFIG_H */
+"""
+
+
+def derive(limits):
+    comm_buffer = limits["comm_buffer_kb"] * 1024
+    utxo_sum = limits["btc_max_utxo_sum"]
+    # the pool fits the largest BTC transaction, rounded up to a KB; the BTC
+    # context & its 3 arrays are each padded to 8 bytes in the pool
+    txn_pool = BTC_CONTEXT_BYTES + 3 * 8 + utxo_sum * BTC_INPUT_BYTES
+    txn_pool = (txn_pool + 1023) // 1024 * 1024
+    values = {
+        "CAPACITY_COMM_BUFFER_SIZE": comm_buffer,
+        "CAPACITY_COMM_BUFFER_SLOTS": limits["comm_buffer_slots"],
+        "CAPACITY_TXN_POOL_SIZE": txn_pool,
+        "CAPACITY_UI_HEAP_SIZE": limits["ui_heap_kb"] * 1024,
+        "CAPACITY_ARENA_SIZE": limits["arena_kb"] * 1024,
+        # a third of the buffer, leaving room for the envelope of the chunk
+        "CAPACITY_CHUNK_SIZE": comm_buffer // 3 // 512 * 512,
+        "CAPACITY_BTC_CONTEXT_BYTES": BTC_CONTEXT_BYTES,
+        "CAPACITY_BTC_INPUT_BYTES": BTC_INPUT_BYTES,
+        "CAPACITY_BTC_MAX_UTXO_SUM": utxo_sum,
+    }
+    values["CAPACITY_RAM_USED"] = (
+        values["CAPACITY_COMM_BUFFER_SIZE"] * values["CAPACITY_COMM_BUFFER_SLOTS"]
+        + values["CAPACITY_TXN_POOL_SIZE"] + values["CAPACITY_UI_HEAP_SIZE"]
+        + values["CAPACITY_ARENA_SIZE"])
+    values["CAPACITY_RAM_BUDGET"] = RAM_BUDGET
+    return values
+
+
+def render_header(profile, values):
+    lines = [HEADER.format(profile=profile)]
+    for name, value in values.items():
+        lines.append(f"#define {name} {value}")
+    return "\n".join(lines) + "\n" + FOOTER
+
+
+def render_options(text, values, path):
+    def substitute(match):
+        name = match.group(1)
+        if name not in values:
+            raise ValueError(f"Unknown capacity '{name}' in {path}")
+        return str(values[name])
+
+    return re.sub(r"@([A-Z0-9_]+)@", substitute, text)
+
+
+def write_if_changed(path, content):
+    # keep the timestamp intact when nothing changed to avoid rebuilds
+    if os.path.exists(path):
+        with open(path, "r") as output:
+            if output.read() == content:
+                return
+    os.makedirs(os.path.dirname(path), exist_ok=True)
+    with open(path, "w") as output:
+        output.write(content)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--profile", type=str.lower, default="standard",
+                        choices=sorted(PROFILES.keys()),
+                        help="Capacity profile. Defaults to `standard`")
+    parser.add_argument("--options-dir", default=DEFAULT_OPTIONS_DIR,
+                        help=f"Options templates. Defaults to `{DEFAULT_OPTIONS_DIR}`")
+    parser.add_argument("--output-dir", default=DEFAULT_OUTPUT_DIR,
+                        help=f"Output directory. Defaults to `{DEFAULT_OUTPUT_DIR}`")
+    args = parser.parse_args()
+
+    limits = PROFILES[args.profile]
+    if limits["btc_max_utxo_sum"] < BTC_MIN_UTXO_SUM:
+        raise ValueError(f"Profile '{args.profile}' accepts "
+                         f"{limits['btc_max_utxo_sum']} BTC inputs + outputs, "
+                         f"at least {BTC_MIN_UTXO_SUM} are required")
+    values = derive(limits)
+    if values["CAPACITY_RAM_USED"] > values["CAPACITY_RAM_BUDGET"]:
+        raise ValueError(f"Profile '{args.profile}' takes "
+                         f"{values['CAPACITY_RAM_USED']} bytes of RAM, the "
+                         f"budget is {values['CAPACITY_RAM_BUDGET']}")
+
+    write_if_changed(
+        os.path.join(args.output_dir, "capacity", "capacity_config.h"),
+        render_header(args.profile, values))
+
+    for root, _, files in os.walk(args.options_dir):
+        for name in files:
+            if not name.endswith(".options"):
+                continue
+            path = os.path.join(root, name)
+            with open(path, "r") as template:
+                content = render_options(template.read(), values, path)
+            rel_path = os.path.relpath(path, args.options_dir)
+            write_if_changed(
+                os.path.join(args.output_dir, "proto-options", rel_path),
+                content)
+
+
+if __name__ == "__main__":
+    main()
@@ -15,6 +15,10 @@ IF(UNIT_TESTS_SWITCH)
         #need these macros to correctly configure unity test framework
         add_compile_definitions(UNITY_INCLUDE_CONFIG_H)
         add_compile_definitions(UNITY_FIXTURE_NO_EXTRAS)
+ELSEIF(BENCHMARKS_SWITCH)
+        file(GLOB_RECURSE SOURCES "stm32-hal/*.*" "common/*.*" "src/*.*" "apps/*.*" "benchmarks/*.*")
+        #exclude src/main.c from the compilation list as it needs to be overriden by benchmarks_main.c
+        LIST(REMOVE_ITEM SOURCES "${PROJECT_SOURCE_DIR}/src/main.c")
 ELSE()
         file(GLOB_RECURSE SOURCES "stm32-hal/*.*" "common/*.*" "src/*.*" "apps/*.*")
 ENDIF(UNIT_TESTS_SWITCH)
@@ -25,6 +29,16 @@ add_compile_definitions(USE_SIMULATOR=0 USE_BIP32_CACHE=0 USE_BIP39_CACHE=0 STM3
 IF (DEV_SWITCH)
     add_compile_definitions(DEV_BUILD)
 ENDIF(DEV_SWITCH)
+IF (SESSION_BENCH_SWITCH)
+    # auto-accepts the confirmations and signs with a fixed test seed
+    message(FATAL_ERROR "SESSION_BENCH_SWITCH is only available for the simulator")
+ENDIF(SESSION_BENCH_SWITCH)
+IF (FUZZ_SWITCH)
+    message(FATAL_ERROR "FUZZ_SWITCH is only available for the simulator")
+ENDIF(FUZZ_SWITCH)
+IF (SIM_HEADLESS_SWITCH)
+    message(FATAL_ERROR "SIM_HEADLESS_SWITCH is only available for the simulator")
+ENDIF(SIM_HEADLESS_SWITCH)
 
 if ("${FIRMWARE_TYPE}" STREQUAL "Main")
     add_compile_definitions(X1WALLET_INITIAL=0 X1WALLET_MAIN=1)
@@ -48,13 +62,6 @@ target_include_directories(${EXECUTABLE} PRIVATE
         apps/btc_family/doge
         apps/btc_family/ltc
         apps/evm_family
-        apps/evm_family/eth
-        apps/evm_family/polygon
-        apps/evm_family/bsc
-        apps/evm_family/fantom
-        apps/evm_family/avalanche
-        apps/evm_family/optimism
-        apps/evm_family/arbitrum
         apps/near_app
         apps/solana_app
 
@@ -87,8 +94,11 @@ target_include_directories(${EXECUTABLE} PRIVATE
 
         common/interfaces/card_interface
         common/interfaces/desktop_app_interface
+        common/interfaces/display_interface
         common/interfaces/flash_interface
+        common/interfaces/input_interface
         common/interfaces/user_interface
+        common/libraries/aes_engine
         common/libraries/atecc
         common/libraries/atecc/atcacert
         common/libraries/atecc/basic
@@ -179,6 +189,9 @@ target_include_directories(${EXECUTABLE} PRIVATE
         $<$<BOOL:UNIT_TESTS_SWITCH>:${PROJECT_SOURCE_DIR}/tests/apps/evm_app>
         $<$<BOOL:UNIT_TESTS_SWITCH>:${PROJECT_SOURCE_DIR}/tests/apps/near_app>
         $<$<BOOL:UNIT_TESTS_SWITCH>:${PROJECT_SOURCE_DIR}/tests/apps/solana_app>
+
+        #benchmark build
+        $<$<BOOL:${BENCHMARKS_SWITCH}>:${PROJECT_SOURCE_DIR}/benchmarks>
         )
 
 target_compile_options(${EXECUTABLE} PRIVATE
@@ -195,6 +208,7 @@ target_link_options(${EXECUTABLE} PRIVATE
         -mcpu=cortex-m4 -mthumb -mfpu=fpv4-sp-d16
         -mfloat-abi=hard -u _printf_float -lc -lm -lnosys
         -Wl,-Map=${PROJECT_NAME}.map,--cref -Wl,--gc-sections
+        -Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc,--wrap=free
         )
 
 # Used to suppress compile time warnings in libraries
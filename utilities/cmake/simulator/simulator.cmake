@@ -6,6 +6,14 @@ IF(UNIT_TESTS_SWITCH)
         #need these macros to correctly configure unity test framework
         add_compile_definitions(UNITY_INCLUDE_CONFIG_H)
         add_compile_definitions(UNITY_FIXTURE_NO_EXTRAS)
+ELSEIF(BENCHMARKS_SWITCH)
+        file(GLOB_RECURSE SOURCES "simulator/*.*" "common/*.*" "src/*.*" "apps/*.*" "benchmarks/*.*")
+        #exclude src/main.c from the compilation list as it needs to be overriden by benchmarks_main.c
+        LIST(REMOVE_ITEM SOURCES "${PROJECT_SOURCE_DIR}/src/main.c")
+ELSEIF(FUZZ_SWITCH)
+        file(GLOB_RECURSE SOURCES "simulator/*.*" "common/*.*" "src/*.*" "apps/*.*" "fuzz/*.*")
+        #exclude src/main.c from the compilation list as it needs to be overriden by usb_fuzz_main.c
+        LIST(REMOVE_ITEM SOURCES "${PROJECT_SOURCE_DIR}/src/main.c")
 ELSE()
         file(GLOB_RECURSE SOURCES "simulator/*.*" "common/*.*" "src/*.*" "apps/*.*")
 ENDIF(UNIT_TESTS_SWITCH)
@@ -14,6 +22,32 @@ add_compile_definitions(USE_SIMULATOR=1 ATCAPRINTF USE_MONERO=1 USE_BIP32_CACHE=
 IF (DEV_SWITCH)
     add_compile_definitions(DEV_BUILD)
 ENDIF(DEV_SWITCH)
+IF (SESSION_BENCH_SWITCH)
+    add_compile_definitions(SESSION_BENCH)
+ENDIF(SESSION_BENCH_SWITCH)
+IF (SIM_HEADLESS_SWITCH)
+    add_compile_definitions(SIM_HEADLESS)
+ENDIF(SIM_HEADLESS_SWITCH)
+
+# Transport of the USB packets exchanged with the host: file (default), socket
+# (Unix-domain socket) or shm (shared memory rings); refer simulator/USB/sim_usb.h
+set(SIM_USB_TRANSPORT "file" CACHE STRING "USB transport of the simulator")
+set_property(CACHE SIM_USB_TRANSPORT PROPERTY STRINGS file socket shm)
+if (FUZZ_SWITCH)
+    # the harness feeds the packet parser itself and drops the responses
+    add_compile_definitions(USB_FUZZ SIM_USB_TRANSPORT=3)
+    if (CMAKE_C_COMPILER_ID MATCHES "Clang")
+        add_compile_definitions(USB_FUZZ_LIBFUZZER)
+        add_compile_options(-fsanitize=fuzzer-no-link,address,undefined)
+        add_link_options(-fsanitize=fuzzer,address,undefined)
+    endif()
+elseif ("${SIM_USB_TRANSPORT}" STREQUAL "socket")
+    add_compile_definitions(SIM_USB_TRANSPORT=1)
+elseif ("${SIM_USB_TRANSPORT}" STREQUAL "shm")
+    add_compile_definitions(SIM_USB_TRANSPORT=2)
+elseif (NOT "${SIM_USB_TRANSPORT}" STREQUAL "file")
+    message(FATAL_ERROR "Unknown SIM_USB_TRANSPORT ${SIM_USB_TRANSPORT}. Use file, socket or shm")
+endif()
 
 set(EXECUTABLE_OUTPUT_PATH ${PROJECT_SOURCE_DIR}/bin)
 set(EXECUTABLE ${PROJECT_NAME})
@@ -44,13 +78,6 @@ target_include_directories(${PROJECT_NAME} PRIVATE
         apps/btc_family/doge
         apps/btc_family/ltc
         apps/evm_family
-        apps/evm_family/eth
-        apps/evm_family/polygon
-        apps/evm_family/bsc
-        apps/evm_family/fantom
-        apps/evm_family/avalanche
-        apps/evm_family/optimism
-        apps/evm_family/arbitrum
         apps/near_app
 
         apps/solana_app
@@ -84,8 +111,11 @@ target_include_directories(${PROJECT_NAME} PRIVATE
 
         common/interfaces/card_interface
         common/interfaces/desktop_app_interface
+        common/interfaces/display_interface
         common/interfaces/flash_interface
+        common/interfaces/input_interface
         common/interfaces/user_interface
+        common/libraries/aes_engine
         common/libraries/atecc
         common/libraries/atecc/atcacert
         common/libraries/atecc/basic
@@ -155,12 +185,20 @@ target_include_directories(${PROJECT_NAME} PRIVATE
         $<$<BOOL:UNIT_TESTS_SWITCH>:${PROJECT_SOURCE_DIR}/tests/apps/evm_app>
         $<$<BOOL:UNIT_TESTS_SWITCH>:${PROJECT_SOURCE_DIR}/tests/apps/near_app>
         $<$<BOOL:UNIT_TESTS_SWITCH>:${PROJECT_SOURCE_DIR}/tests/apps/solana_app>
+
+        #benchmark build
+        $<$<BOOL:${BENCHMARKS_SWITCH}>:${PROJECT_SOURCE_DIR}/benchmarks>
         )
 
 IF(UNIT_TESTS_SWITCH)
         target_compile_options(${EXECUTABLE} PRIVATE --coverage -g -O0)
         target_link_libraries(${EXECUTABLE} PRIVATE -lgcov )
 ENDIF(UNIT_TESTS_SWITCH)
-target_link_libraries(${EXECUTABLE} PRIVATE ${SDL2_LIBRARIES} -lm)
+# the session replay (simulator/USB/sim_usb_session.h) runs on a thread
+target_link_libraries(${EXECUTABLE} PRIVATE ${SDL2_LIBRARIES} -lm -lpthread)
+if ("${SIM_USB_TRANSPORT}" STREQUAL "shm")
+    # shm_open() is in librt before glibc 2.34
+    target_link_libraries(${EXECUTABLE} PRIVATE -lrt)
+endif()
 target_link_options(${EXECUTABLE} PRIVATE ${inherited})
 add_custom_target (run COMMAND ${EXECUTABLE_OUTPUT_PATH}/${EXECUTABLE})
@@ -0,0 +1,101 @@
+#!/usr/bin/env python3
+"""Generates the precomputed curve point tables of the fixed-base comb.
+
+For a window of w bits the table of a curve holds the points
+(2j+1) * 2^(w*i) * G for i < ceil(256 / w) and j < 2^(w-1), in the format of
+common/libraries/crypto/secp256k1.table. These are used by scalar_multiply()
+in common/libraries/crypto/ecdsa.c when USE_PRECOMPUTED_CP_WINDOW is w. Wider
+windows take fewer point additions per public key but more flash.
+"""
+import argparse
+import os
+
+DEFAULT_OUTPUT_DIR = os.path.join("generated", "crypto")
+
+# Refer common/libraries/crypto/secp256k1.c & nist256p1.c
+CURVES = {
+    "secp256k1": {
+        "p": 2**256 - 2**32 - 977,
+        "a": 0,
+        "gx": 0x79BE667EF9DCBBAC55A06295CE870B07029BFCDB2DCE28D959F2815B16F81798,
+        "gy": 0x483ADA7726A3C4655DA4FBFC0E1108A8FD17B448A68554199C47D08FFB10D4B8,
+    },
+    "nist256p1": {
+        "p": 2**256 - 2**224 + 2**192 + 2**96 - 1,
+        "a": -3,
+        "gx": 0x6B17D1F2E12C4247F8BCE6E563A440F277037D812DEB33A0F4A13945D898C296,
+        "gy": 0x4FE342E2FE1A7F9B8EE7EB4A7C0F9E162BCE33576B315ECECBB6406837BF51F5,
+    },
+}
+
+
+def point_double(curve, point):
+    p = curve["p"]
+    x, y = point
+    slope = (3 * x * x + curve["a"]) * pow(2 * y, -1, p) % p
+    rx = (slope * slope - 2 * x) % p
+    return rx, (slope * (x - rx) - y) % p
+
+
+def point_add(curve, first, second):
+    if first == second:
+        return point_double(curve, first)
+    p = curve["p"]
+    (x1, y1), (x2, y2) = first, second
+    slope = (y2 - y1) * pow(x2 - x1, -1, p) % p
+    rx = (slope * slope - x1 - x2) % p
+    return rx, (slope * (x1 - rx) - y1) % p
+
+
+def limbs(value):
+    # bignum256 digits in base 2^30, refer common/libraries/crypto/bignum.c
+    return ", ".join(f"0x{(value >> (30 * i)) & 0x3FFFFFFF:08x}"
+                     for i in range(9))
+
+
+def render(curve, window):
+    windows = (256 + window - 1) // window
+    points = 1 << (window - 1)
+    base = (curve["gx"], curve["gy"])
+    lines = []
+    for i in range(windows):
+        lines.append("\t{")
+        odd = base
+        double = point_double(curve, base)
+        for j in range(points):
+            multiple = f"{2 * j + 1:2d}*2^{window * i}*G"
+            lines.append(f"\t\t/* {multiple}: */")
+            lines.append(f"\t\t{{{{{{{limbs(odd[0])}}}}},")
+            lines.append(f"\t\t {{{{{limbs(odd[1])}}}}}}},")
+            odd = point_add(curve, odd, double)
+        lines.append("\t},")
+        for _ in range(window):
+            base = point_double(curve, base)
+    return "\n".join(lines) + "\n"
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--window", type=int, required=True,
+                        help="Window of the comb in bits, from 2 to 8")
+    parser.add_argument("--output-dir", default=DEFAULT_OUTPUT_DIR,
+                        help=f"Output directory. Defaults to `{DEFAULT_OUTPUT_DIR}`")
+    args = parser.parse_args()
+    if not 2 <= args.window <= 8:
+        raise ValueError(f"Unsupported window {args.window}")
+
+    os.makedirs(args.output_dir, exist_ok=True)
+    for name, curve in CURVES.items():
+        source = render(curve, args.window)
+        output_path = os.path.join(args.output_dir, f"{name}_cp.table")
+        # keep the timestamp intact when nothing changed to avoid rebuilds
+        if os.path.exists(output_path):
+            with open(output_path, "r") as output:
+                if output.read() == source:
+                    continue
+        with open(output_path, "w") as output:
+            output.write(source)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,130 @@
+#!/usr/bin/env python3
+"""Generates the sorted EVM function selector table used for clear signing.
+
+The declarative spec (a JSON list of selector, name, signature & args) is
+validated and emitted as a C table sorted by selector so that the firmware can
+binary-search it. Refer evm_lookup_function() in apps/evm_family/evm_contracts.c
+"""
+import argparse
+import json
+import os
+import re
+
+DEFAULT_SPEC = os.path.join("apps", "evm_family", "evm_selectors.json")
+DEFAULT_OUTPUT = os.path.join("generated", "evm", "evm_selectors.c")
+
+# ABI types supported by ETH_ExtractArguments(); refer Abi_Type_e of abi.h
+ABI_TYPES = {
+    "uint256": "Abi_uint256_e",
+    "address": "Abi_address_e",
+    "bytes32": "Abi_bytes_e",
+    "int256": "Abi_int256_e",
+    "bool": "Abi_bool_e",
+    "bytes": "Abi_bytes_dynamic_e",
+    "uint256[]": "Abi_uint256_array_dynamic_e",
+}
+
+# Limits of the fields of evm_function_t
+MAX_ARGS = 255
+MAX_TEXT_LENGTH = 100
+
+HEADER = """/**
+ * @file    evm_selectors.c
+ * @author  Cypherock X1 Team
+ * @brief   EVM function selector table for clear signing.
+ *          Generated by utilities/evm/generate-selectors.py from
+ *          {spec}; do not edit.
+ * @copyright Copyright (c) 2023 HODL TECH PTE LTD
+ * <br/> You may obtain a copy of license at <a href="https://mitcc.org/"
+ * target=_blank>https://mitcc.org/</a>
+ */
+#include "evm_contracts.h"
+"""
+
+
+def load_spec(path):
+    with open(path, "r") as spec_file:
+        entries = json.load(spec_file)
+
+    functions = {}
+    for entry in entries:
+        selector = entry["selector"]
+        if not re.fullmatch(r"0x[0-9a-fA-F]{8}", selector):
+            raise ValueError(f"Invalid selector '{selector}'")
+        selector = int(selector, 16)
+        if selector in functions:
+            raise ValueError(f"Duplicate selector 0x{selector:08x}")
+
+        name = entry["name"]
+        signature = entry["signature"]
+        if not signature.startswith(name + "("):
+            raise ValueError(f"Signature '{signature}' does not match '{name}'")
+        title = f"Function: {name}"
+        for text in (title, signature):
+            if len(text) >= MAX_TEXT_LENGTH or '"' in text or "\\" in text:
+                raise ValueError(f"Unsupported text '{text}'")
+
+        args = entry["args"]
+        if len(args) > MAX_ARGS:
+            raise ValueError(f"Too many arguments for '{signature}'")
+        for arg in args:
+            if arg not in ABI_TYPES:
+                raise ValueError(f"Unsupported type '{arg}' in '{signature}'")
+
+        functions[selector] = (title, signature, args)
+
+    return functions
+
+
+def render(functions, spec):
+    lines = [HEADER.format(spec=spec.replace(os.sep, "/"))]
+
+    for selector, (_, _, args) in sorted(functions.items()):
+        if 0 == len(args):
+            continue
+        lines.append(f"static const Abi_Type_e evm_args_{selector:08x}[] = {{")
+        lines.extend(f"    {ABI_TYPES[arg]}," for arg in args)
+        lines.append("};")
+        lines.append("")
+
+    lines.append("/// Sorted in ascending order of the selector")
+    lines.append("const evm_function_t evm_functions[] = {")
+    for selector, (title, signature, args) in sorted(functions.items()):
+        arg_types = f"evm_args_{selector:08x}" if args else "NULL"
+        lines.append(f"    {{0x{selector:08x},")
+        lines.append(f'     "{title}",')
+        lines.append(f'     "{signature}",')
+        lines.append(f"     {arg_types},")
+        lines.append(f"     {len(args)}}},")
+    lines.append("};")
+    lines.append("")
+    lines.append("const uint16_t evm_functions_count =")
+    lines.append("    sizeof(evm_functions) / sizeof(evm_functions[0]);")
+    return "\n".join(lines) + "\n"
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--spec", default=DEFAULT_SPEC,
+                        help=f"Path to the spec. Defaults to `{DEFAULT_SPEC}`")
+    parser.add_argument("--output", default=DEFAULT_OUTPUT,
+                        help=f"Path to the output. Defaults to `{DEFAULT_OUTPUT}`")
+    args = parser.parse_args()
+
+    functions = load_spec(args.spec)
+    if 0xFFFF < len(functions):
+        raise ValueError("Too many selectors")
+    source = render(functions, args.spec)
+
+    os.makedirs(os.path.dirname(args.output), exist_ok=True)
+    # keep the timestamp intact when nothing changed to avoid rebuilds
+    if os.path.exists(args.output):
+        with open(args.output, "r") as output:
+            if output.read() == source:
+                return
+    with open(args.output, "w") as output:
+        output.write(source)
+
+
+if __name__ == "__main__":
+    main()
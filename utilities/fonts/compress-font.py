@@ -0,0 +1,164 @@
+#!/usr/bin/env python3
+"""Compresses the glyph bitmaps of a 1 bpp LVGL font generated by lv_font_conv.
+
+The font file is rewritten in place. Every glyph is encoded on its own so that
+lv_font_get_bitmap_fmt_txt() can decode only the glyph being drawn:
+
+  1. each row of the glyph box is XORed with the row above it; the vertical
+     strokes of the glyphs then leave a few set bits only where an edge starts
+     or ends
+  2. the bits are coded as runs of zeros ended by a one, 2 bits per code. A
+     code of 0..2 skips that many zeros and sets the next bit, a code of 3
+     skips 3 zeros. Codes are packed MSB first; the unused codes of the last
+     byte are 3 and the zeros after the last one are implicit
+
+A glyph whose code is not shorter than its plain bitmap is stored plain. The
+decoder tells the two apart from the size of the glyph, taken from the
+bitmap_index of the next glyph; a trailing glyph description marks the end of
+the last glyph.
+"""
+import argparse
+import re
+
+# must match LV_FONT_FMT_TXT_RLE_BITMAP_MAX in lv_font_fmt_txt.h
+BITMAP_MAX = 32
+
+RUN_MAX = 3
+
+
+def glyph_bits(data, width, height):
+    bits = []
+    for i in range(width * height):
+        bits.append((data[i // 8] >> (7 - i % 8)) & 1)
+    return bits
+
+
+def encode(bits, width):
+    delta = bits[:width] + [
+        bits[i] ^ bits[i - width] for i in range(width, len(bits))
+    ]
+    codes = []
+    run = 0
+    for bit in delta:
+        if not bit:
+            run += 1
+            continue
+        while run >= RUN_MAX:
+            codes.append(RUN_MAX)
+            run -= RUN_MAX
+        codes.append(run)
+        run = 0
+    while len(codes) % 4:
+        codes.append(RUN_MAX)
+    return [
+        (codes[i] << 6) | (codes[i + 1] << 4) | (codes[i + 2] << 2)
+        | codes[i + 3] for i in range(0, len(codes), 4)
+    ]
+
+
+def decode(code, width, height):
+    """Reference of the decoder in lv_font_fmt_txt.c, used to self-check"""
+    size = width * height
+    delta = [0] * size
+    pos = 0
+    for byte in code:
+        for shift in (6, 4, 2, 0):
+            run = (byte >> shift) & 3
+            pos += run
+            if run == RUN_MAX:
+                continue
+            if pos < size:
+                delta[pos] = 1
+            pos += 1
+    for i in range(width, size):
+        delta[i] ^= delta[i - width]
+    return delta
+
+
+def format_bytes(data):
+    lines = []
+    for i in range(0, len(data), 8):
+        lines.append("    " + ", ".join(hex(x) for x in data[i:i + 8]) + ",")
+    return lines
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("font", help="Font source generated by lv_font_conv")
+    args = parser.parse_args()
+
+    with open(args.font, "r") as font:
+        source = font.read()
+
+    if re.search(r"\.bitmap_format = 1", source):
+        raise ValueError(f"{args.font} is already compressed")
+    if not re.search(r"\.bpp = 1,", source):
+        raise ValueError(f"{args.font} is not a 1 bpp font")
+
+    bitmap = re.search(
+        r"(glyph_bitmap\[\] = \{\n)(.*?)(\n\};)", source, flags=re.S)
+    # the glyphs are separated by their "/* U+XXXX ... */" comments
+    blocks = re.split(r"\n(?=    /\* U\+)", bitmap.group(2).strip("\n"))
+    glyph_dsc = re.search(
+        r"(glyph_dsc\[\] = \{\n)(.*?)(\n\};)", source, flags=re.S)
+    dsc_lines = glyph_dsc.group(2).split("\n")
+    entries = [
+        tuple(int(x) for x in re.search(
+            r"\.bitmap_index = (\d+), .*\.box_w = (\d+), \.box_h = (\d+)",
+            line).groups()) for line in dsc_lines[1:]
+    ]
+    if len(entries) != len(blocks):
+        raise ValueError("Glyph bitmaps and descriptions do not match")
+
+    data = [
+        int(x, 16) for x in re.findall(
+            r"0x[0-9a-f]+", re.sub(r"/\*.*?\*/", "", bitmap.group(2)))
+    ]
+
+    out_blocks = []
+    out_dsc = [dsc_lines[0]]
+    index = 0
+    plain_size = 0
+    for (start, width, height), block, line in zip(entries, blocks,
+                                                   dsc_lines[1:]):
+        size = (width * height + 7) // 8
+        if size > BITMAP_MAX:
+            raise ValueError(f"Glyph at {start} exceeds {BITMAP_MAX} bytes")
+        plain = data[start:start + size]
+        bits = glyph_bits(plain, width, height)
+        code = encode(bits, width) if bits else plain
+        if len(code) >= size:
+            code = plain
+        elif decode(code, width, height) != bits:
+            raise ValueError(f"Glyph at {start} does not round trip")
+        plain_size += size
+
+        comment = block.split("\n")[0]
+        out_blocks.append("\n".join([comment] + format_bytes(code)))
+        out_dsc.append(
+            re.sub(r"\.bitmap_index = \d+", f".bitmap_index = {index}", line))
+        index += len(code)
+
+    out_dsc[-1] += ","
+    out_dsc.append(
+        f"    {{.bitmap_index = {index}, .adv_w = 0, .box_w = 0, .box_h = 0, "
+        ".ofs_x = 0, .ofs_y = 0} /* end of the last glyph */")
+
+    source = (source[:bitmap.start(2)] + "\n\n".join(out_blocks).rstrip(",")
+              + source[bitmap.end(2):])
+    glyph_dsc = re.search(
+        r"(glyph_dsc\[\] = \{\n)(.*?)(\n\};)", source, flags=re.S)
+    source = (source[:glyph_dsc.start(2)] + "\n".join(out_dsc)
+              + source[glyph_dsc.end(2):])
+    source = source.replace(".bitmap_format = 0,", ".bitmap_format = 1,")
+    source = re.sub(r"( \* Opts: .*\n)",
+                    r"\1 * Compressed: utilities/fonts/compress-font.py\n",
+                    source, count=1)
+
+    with open(args.font, "w") as font:
+        font.write(source)
+    print(f"{args.font}: {plain_size} -> {index} bytes of glyph bitmaps")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,170 @@
+#!/usr/bin/env python3
+"""Decodes the logs exported from a device into text.
+
+With the BINARY_LOGS build option, the firmware logs compact binary records
+carrying the address of the format string instead of the formatted text (refer
+logger_pack_record() in common/logger/logger.c). The format strings are read
+from the ELF image of the same build. Text entries, e.g. written before a
+firmware update, are passed through as is.
+"""
+import argparse
+import re
+import struct
+import sys
+
+RECORD_MARKER = 0xB1
+RECORD_HEADER_SIZE = 12
+# Refer LOG_MAX_SIZE of common/logger/logger.h
+RECORD_MAX_SIZE = 128
+PADDING = (0x00, 0x20, 0xFF)
+
+SHF_ALLOC = 0x2
+SHT_NOBITS = 8
+
+CONVERSION = re.compile(
+    r"%(?P<flags>[-+ #0]*)(?P<width>\*|\d+)?(?:\.(?P<precision>\*|\d+))?"
+    r"(?P<length>hh|h|ll|l|L|z|j|t)?(?P<conversion>[diouxXcspfFeEgGaA%n])")
+
+
+class Firmware:
+    """Looks up format strings in the loadable sections of an ELF32 image."""
+
+    def __init__(self, path):
+        with open(path, "rb") as elf:
+            self.image = elf.read()
+        if self.image[:4] != b"\x7fELF" or self.image[4] != 1:
+            raise ValueError(f"{path} is not an ELF32 image")
+        shoff, = struct.unpack_from("<I", self.image, 0x20)
+        shentsize, shnum = struct.unpack_from("<HH", self.image, 0x2E)
+        self.sections = []
+        for index in range(shnum):
+            _, sh_type, flags, addr, offset, size = struct.unpack_from(
+                "<IIIIII", self.image, shoff + index * shentsize)
+            if flags & SHF_ALLOC and sh_type != SHT_NOBITS and size:
+                self.sections.append((addr, offset, size))
+
+    def string(self, address):
+        for addr, offset, size in self.sections:
+            if addr <= address < addr + size:
+                start = offset + address - addr
+                end = self.image.index(b"\0", start, offset + size)
+                return self.image[start:end].decode("ascii", "replace")
+        return None
+
+
+class Arguments:
+    """Reads the packed arguments of a record in order."""
+
+    def __init__(self, data):
+        self.data = data
+        self.offset = 0
+
+    def take(self, fmt):
+        size = struct.calcsize(fmt)
+        if self.offset + size > len(self.data):
+            raise IndexError
+        value, = struct.unpack_from(fmt, self.data, self.offset)
+        self.offset += size
+        return value
+
+    def string(self):
+        size = self.take("<B")
+        if self.offset + size > len(self.data):
+            raise IndexError
+        value = self.data[self.offset:self.offset + size]
+        self.offset += size
+        return value.decode("ascii", "replace")
+
+
+def format_record(fmt, args):
+    """Applies the packed arguments to the printf style format."""
+
+    def convert(match):
+        spec = match.groupdict()
+        conversion = spec["conversion"]
+        if conversion == "%":
+            return "%"
+        width = spec["width"] or ""
+        precision = spec["precision"]
+        if width == "*":
+            width = str(args.take("<i"))
+        if precision == "*":
+            precision = str(args.take("<i"))
+        precision = "" if precision is None else "." + precision
+        pattern = "%" + spec["flags"] + width + precision
+
+        if conversion == "s":
+            return (pattern + "s") % args.string()
+        if conversion in "fFeEgGaA":
+            conversion = "e" if conversion in "aA" else conversion
+            return (pattern + conversion) % args.take("<d")
+        wide = spec["length"] == "ll"
+        if conversion in "di":
+            return (pattern + "d") % args.take("<q" if wide else "<i")
+        value = args.take("<Q" if wide else "<I")
+        if conversion == "c":
+            return (pattern + "c") % chr(value & 0xFF)
+        if conversion == "p":
+            return "0x%08x" % value
+        if conversion == "n":
+            return ""
+        return (pattern + ("d" if conversion == "u" else conversion)) % value
+
+    try:
+        return CONVERSION.sub(convert, fmt)
+    except IndexError:
+        return CONVERSION.split(fmt)[0] + " <truncated>"
+
+
+def decode(data, firmware):
+    """Yields the text of the log entries found in the exported data."""
+    index = 0
+    while index < len(data):
+        byte = data[index]
+        if byte in PADDING:
+            index += 1
+            continue
+
+        if byte == RECORD_MARKER and index + RECORD_HEADER_SIZE <= len(data):
+            size = data[index + 1]
+            record = data[index:index + size]
+            if (RECORD_HEADER_SIZE < size <= RECORD_MAX_SIZE and
+                    size % 8 == 0 and len(record) == size):
+                count, tick, fmt_id = struct.unpack_from("<HII", record, 2)
+                args = Arguments(record[RECORD_HEADER_SIZE:].rstrip(b" "))
+                args.data = args.data[:-1]    # terminator
+                if fmt_id:
+                    fmt = firmware.string(fmt_id) if firmware else None
+                    if fmt is None:
+                        fmt = f"<unknown format 0x{fmt_id:08x}>"
+                else:
+                    try:
+                        fmt = args.string()
+                    except IndexError:
+                        fmt = "<truncated>"
+                yield f"{count}. [{tick}] {format_record(fmt, args)}"
+                index += size
+                continue
+
+        end = data.find(b"\n", index)
+        end = len(data) if end < 0 else end
+        line = data[index:end].decode("ascii", "replace").rstrip("\r ")
+        if line:
+            yield line
+        index = end + 1
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("logs", help="Logs exported from the device")
+    parser.add_argument("--elf", help="ELF image of the firmware that logged")
+    args = parser.parse_args()
+
+    firmware = Firmware(args.elf) if args.elf else None
+    with open(args.logs, "rb") as logs:
+        for line in decode(logs.read(), firmware):
+            sys.stdout.write(line + "\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -8,9 +8,11 @@ NANOPB_GEN="$(pwd)/vendor/nanopb/generator/nanopb_generator.py"
 PYTHON_VERSION="$(python3 --version)" || exit 1
 OUTPUT_DIR="$(pwd)/generated/proto"
 PROTO_SRC="$(pwd)/common/cypherock-common/proto"
-OPTIONS_DIR="$(pwd)/common/proto-options/"
+# Rendered from common/proto-options by utilities/capacity/generate-capacity.py
+OPTIONS_DIR="$(pwd)/generated/proto-options/"
 
 test -d "${PROTO_SRC}"
+test -d "${OPTIONS_DIR}"
 test -f "${NANOPB_GEN}"
 
 echo -e "Detected ${PYTHON_VERSION} (at $(which python3))"